@@ -0,0 +1,21 @@
+// Generated by native/bluenoise (pio run -e bluenoise -t exec), do not edit.
+// 16 x 16 tileable void-and-cluster thresholds, row by row; see METABALL_NOISE_MASK.
+
+const unsigned char BlueNoise16[] PROGMEM = {
+0x1c, 0xa0, 0xc2, 0xf1, 0x22, 0x84, 0xa9, 0x50, 0x69, 0x06, 0x41, 0xcb, 0x13, 0x87, 0xdc, 0x75, 
+0xe4, 0x81, 0x04, 0x6f, 0x3f, 0x5e, 0xf3, 0x2e, 0xe2, 0x9c, 0xfb, 0x56, 0xac, 0x26, 0xb8, 0x3b, 
+0x60, 0xbd, 0x4d, 0xe0, 0xae, 0xc8, 0x0d, 0x7c, 0xb2, 0x20, 0x8b, 0x34, 0xe9, 0x6a, 0xd7, 0x0e, 
+0xa8, 0xfe, 0x2f, 0x98, 0x19, 0x8f, 0x39, 0xd2, 0x47, 0x63, 0xc6, 0x78, 0x03, 0x99, 0x51, 0x89, 
+0x21, 0x43, 0x7a, 0xd6, 0x55, 0xf8, 0x66, 0x9a, 0xed, 0x11, 0xdb, 0xa5, 0x45, 0xf7, 0x2d, 0xcd, 
+0xec, 0x94, 0x08, 0xb3, 0x28, 0x7e, 0x02, 0xba, 0x2c, 0x8d, 0x54, 0x23, 0xc1, 0x7f, 0xb1, 0x68, 
+0xa4, 0x59, 0xca, 0x6b, 0xe8, 0xa3, 0xde, 0x4e, 0x73, 0xff, 0xbc, 0x67, 0xe3, 0x17, 0x4b, 0x0c, 
+0x7d, 0x31, 0xf6, 0x48, 0x1e, 0x3a, 0xc7, 0x1a, 0xab, 0x3d, 0x0a, 0x9f, 0x33, 0x93, 0xd0, 0xe1, 
+0xb7, 0x15, 0x8a, 0x9d, 0xc0, 0x77, 0x91, 0x61, 0xcf, 0x88, 0xda, 0x7b, 0xf5, 0x5b, 0x72, 0x3e, 
+0xef, 0x62, 0xd9, 0x09, 0x58, 0xf9, 0x0f, 0xe6, 0x2a, 0x5a, 0x1b, 0x49, 0xaa, 0x00, 0xc3, 0x25, 
+0x4c, 0xa6, 0x71, 0xc9, 0x30, 0xaf, 0x44, 0x70, 0xa1, 0xf2, 0xb4, 0xce, 0x2b, 0xea, 0x97, 0x83, 
+0xd1, 0x37, 0x1f, 0xee, 0x82, 0x95, 0xd8, 0xbe, 0x14, 0x3c, 0x74, 0x90, 0x65, 0x40, 0xb5, 0x12, 
+0xfc, 0x96, 0xbb, 0x46, 0x5d, 0x01, 0x27, 0x53, 0x8c, 0xcc, 0x07, 0xfa, 0x18, 0xd4, 0x6d, 0x57, 
+0x86, 0x0b, 0x76, 0xe7, 0xa2, 0xc5, 0xfd, 0x79, 0xeb, 0x5f, 0x9e, 0x4f, 0xa7, 0x80, 0xe5, 0x29, 
+0xad, 0x64, 0xd5, 0x16, 0x36, 0x6c, 0x42, 0xb0, 0x1d, 0x35, 0xdf, 0x24, 0xbf, 0x38, 0x05, 0xc4, 
+0xf4, 0x32, 0x52, 0x8e, 0xb6, 0xdd, 0x10, 0x92, 0xd3, 0xb9, 0x85, 0x6e, 0xf0, 0x5c, 0x9b, 0x4a, 
+};
@@ -0,0 +1,69 @@
+// Generated by native/bluenoise (pio run -e bluenoise -t exec), do not edit.
+// 32 x 32 tileable void-and-cluster thresholds, row by row; see METABALL_NOISE_MASK.
+
+const unsigned char BlueNoise32[] PROGMEM = {
+0x1d, 0xd6, 0xae, 0x41, 0x16, 0x9c, 0xf0, 0x26, 0xc3, 0xfb, 0x1c, 0xda, 0x33, 0x97, 0xce, 0x2a, 
+0xe8, 0x51, 0x37, 0x15, 0xa7, 0x48, 0xbc, 0x95, 0x54, 0x81, 0x1a, 0xc6, 0x70, 0xda, 0x9e, 0x3c, 
+0x85, 0x6a, 0x29, 0xf5, 0x5a, 0x71, 0xb4, 0x52, 0x6c, 0x95, 0xb2, 0x4c, 0x89, 0xf0, 0x48, 0x6c, 
+0x19, 0xb0, 0x73, 0xd8, 0x63, 0xcb, 0x21, 0xe7, 0xce, 0x42, 0xe0, 0x95, 0x34, 0x0b, 0x61, 0xe3, 
+0xc7, 0x03, 0xa6, 0x81, 0xc6, 0x30, 0xd5, 0x13, 0xe7, 0x36, 0x08, 0xe1, 0x74, 0x0e, 0xa9, 0xd6, 
+0x92, 0xf4, 0x25, 0x8a, 0xee, 0x02, 0x76, 0x36, 0x6b, 0x07, 0xaa, 0x4f, 0x7d, 0xf0, 0xb6, 0x4b, 
+0x98, 0xec, 0x4e, 0xdd, 0x0c, 0xa0, 0x45, 0x8b, 0xa9, 0x7d, 0x57, 0xbb, 0x26, 0xc4, 0x37, 0x7f, 
+0x06, 0x5e, 0xb9, 0x3b, 0x53, 0xb0, 0x9e, 0xfc, 0xb8, 0x89, 0xf3, 0x20, 0xd1, 0xa1, 0x17, 0x2f, 
+0x73, 0x3b, 0x67, 0x24, 0x8f, 0xff, 0x5f, 0xdd, 0x27, 0xca, 0xf3, 0x9a, 0x65, 0xfa, 0x55, 0xe0, 
+0x44, 0xca, 0x98, 0x11, 0xe4, 0x81, 0x46, 0x18, 0x57, 0x29, 0x60, 0xc1, 0x3f, 0x68, 0x8a, 0xfc, 
+0x14, 0xac, 0xd8, 0xba, 0x74, 0x3a, 0xc1, 0x01, 0x69, 0x49, 0x19, 0x3d, 0x86, 0x11, 0x93, 0xad, 
+0x20, 0x7b, 0xfe, 0x6b, 0xc6, 0x2d, 0xdd, 0x8e, 0xcc, 0xe4, 0x9a, 0x78, 0x09, 0xdc, 0x51, 0xbc, 
+0xe4, 0x84, 0x07, 0x56, 0xe8, 0x17, 0x82, 0xb1, 0xec, 0x7a, 0xa4, 0xdd, 0xb7, 0x2d, 0xcd, 0x6a, 
+0xea, 0x33, 0x4d, 0xa7, 0x1c, 0x64, 0xb3, 0x0a, 0x74, 0x3b, 0x14, 0xae, 0xeb, 0x33, 0xa4, 0x22, 
+0xc8, 0x49, 0x97, 0x32, 0xa4, 0xd3, 0x4f, 0x99, 0x31, 0xc0, 0x09, 0x52, 0x70, 0xee, 0x46, 0x00, 
+0x88, 0xbd, 0x0c, 0xd7, 0x7e, 0x3a, 0xf6, 0x99, 0x4d, 0xbe, 0xf5, 0x54, 0x8f, 0xcb, 0x7c, 0x61, 
+0x2e, 0x70, 0xfa, 0xc2, 0x68, 0x23, 0xf6, 0x10, 0x62, 0x8d, 0xfc, 0xcc, 0x1d, 0x9e, 0xb4, 0x58, 
+0xd4, 0xa0, 0x5e, 0xf2, 0x93, 0xbd, 0x57, 0x21, 0xd7, 0x88, 0x2f, 0x6f, 0x1c, 0x47, 0x04, 0xed, 
+0x8a, 0x16, 0xaa, 0x0b, 0x47, 0x90, 0x72, 0xc5, 0xdf, 0x45, 0x29, 0x61, 0x8b, 0x39, 0x77, 0xf9, 
+0x1a, 0x3c, 0x73, 0x28, 0x47, 0x08, 0xde, 0xaa, 0x69, 0x01, 0xa5, 0xd2, 0xb5, 0xfd, 0x9d, 0xb3, 
+0xde, 0x5d, 0xd4, 0x80, 0xe9, 0xcd, 0x37, 0xa2, 0x1f, 0xab, 0x79, 0xb5, 0xeb, 0x0e, 0xc5, 0x2b, 
+0x96, 0xe2, 0xac, 0xc8, 0xeb, 0x6d, 0x84, 0x34, 0xfa, 0x49, 0xe9, 0x5c, 0x29, 0x76, 0x56, 0x3e, 
+0x24, 0x96, 0x43, 0x2e, 0xb4, 0x55, 0x07, 0x83, 0x5d, 0xf1, 0x04, 0xd0, 0x4a, 0xa5, 0xdf, 0x62, 
+0x82, 0x50, 0x12, 0x8c, 0x20, 0xa3, 0xbe, 0x14, 0xc7, 0x9b, 0x80, 0x11, 0x94, 0xe2, 0x0e, 0xc4, 
+0x6e, 0xb8, 0xf8, 0x77, 0x1c, 0x94, 0xee, 0xd2, 0xba, 0x39, 0x97, 0x5a, 0x25, 0x72, 0x3e, 0xba, 
+0x06, 0xf4, 0xb5, 0x66, 0x53, 0xd8, 0x3f, 0x5d, 0x75, 0x22, 0x3d, 0xbc, 0xce, 0x34, 0x84, 0xf2, 
+0x18, 0x50, 0x01, 0xa6, 0xe0, 0x6c, 0x2c, 0x4a, 0x75, 0x1b, 0xd9, 0x7e, 0xfe, 0x92, 0x17, 0xd1, 
+0x9b, 0x41, 0xcf, 0x30, 0xfd, 0x05, 0x96, 0xec, 0xcf, 0xaf, 0xe6, 0x6b, 0x4f, 0xa8, 0x63, 0x9c, 
+0xea, 0x83, 0xda, 0x60, 0x40, 0xc3, 0x9b, 0x11, 0xf5, 0xa3, 0x43, 0xbf, 0x0a, 0xae, 0xe7, 0x56, 
+0x6e, 0x22, 0x7d, 0x9f, 0x6f, 0xb9, 0x85, 0x2c, 0x4c, 0x09, 0x8d, 0x1f, 0xf8, 0x05, 0xd6, 0x2e, 
+0xbe, 0x3a, 0xc8, 0x8d, 0x0f, 0xfd, 0x59, 0xb7, 0x88, 0x62, 0xe7, 0x2b, 0x68, 0x4b, 0x84, 0x2f, 
+0xdb, 0xac, 0xea, 0x15, 0x48, 0xe1, 0x1e, 0x66, 0xf9, 0xa3, 0x5b, 0xc0, 0x85, 0x42, 0xb2, 0x5b, 
+0x74, 0xa0, 0x1f, 0x32, 0xaf, 0x7d, 0x25, 0xdf, 0x35, 0x02, 0xb2, 0x90, 0xcd, 0xf2, 0x1b, 0xbf, 
+0x8e, 0x00, 0x53, 0xc8, 0x8c, 0x39, 0xa9, 0xc4, 0x78, 0x3c, 0xd5, 0x30, 0x6f, 0xe5, 0x8f, 0x10, 
+0x4a, 0xe1, 0x67, 0xf1, 0xce, 0x45, 0xa5, 0x6e, 0xd3, 0x50, 0x7b, 0x18, 0x38, 0x76, 0xa3, 0x44, 
+0xfb, 0x65, 0x31, 0xb1, 0xf6, 0x5e, 0xd7, 0x06, 0x9a, 0x1a, 0xed, 0xad, 0x14, 0xc7, 0x28, 0xff, 
+0xc1, 0x08, 0x91, 0x52, 0x75, 0x05, 0xeb, 0x16, 0xc2, 0x9a, 0xf1, 0xdb, 0xbc, 0x5b, 0xe1, 0x12, 
+0x7b, 0xcf, 0x99, 0x71, 0x10, 0x27, 0x80, 0x48, 0xdf, 0x58, 0x7e, 0x94, 0x4d, 0x63, 0xa2, 0x7c, 
+0x3e, 0xac, 0xd4, 0x19, 0xbb, 0x99, 0x55, 0x8c, 0x3e, 0x22, 0x60, 0x43, 0x0d, 0x98, 0x2d, 0xb1, 
+0x50, 0x23, 0xed, 0x43, 0xd1, 0x9e, 0xef, 0xba, 0x6e, 0x2b, 0xcc, 0x00, 0xf2, 0x33, 0xdc, 0x1a, 
+0xf0, 0x61, 0x7f, 0x38, 0xf8, 0x2a, 0xd0, 0x67, 0xf7, 0xb9, 0x77, 0xab, 0x8b, 0xd2, 0x6b, 0xf1, 
+0x88, 0xc0, 0x08, 0x82, 0xb7, 0x67, 0x36, 0x0d, 0xa8, 0xf9, 0x40, 0xb8, 0x72, 0xd0, 0x87, 0x54, 
+0x97, 0x24, 0xe5, 0xa1, 0x4e, 0x7a, 0xb0, 0x1e, 0xa1, 0x0a, 0xe2, 0x2c, 0xff, 0x4a, 0x03, 0xca, 
+0x3a, 0xa0, 0x5b, 0xe5, 0x1d, 0x4b, 0x92, 0xd9, 0x21, 0x8e, 0x64, 0x9d, 0x25, 0xa9, 0x0b, 0xbb, 
+0x35, 0xc9, 0x04, 0x69, 0xd8, 0x0d, 0xe9, 0x44, 0x80, 0x36, 0xc9, 0x58, 0x1d, 0x7f, 0xa7, 0x62, 
+0x17, 0x75, 0xd3, 0x2e, 0xaa, 0xff, 0xc3, 0x5c, 0x79, 0xe3, 0x13, 0xc9, 0x57, 0x44, 0xfb, 0x6c, 
+0xe2, 0x52, 0x89, 0xbf, 0x3f, 0x91, 0x5e, 0xbd, 0xdb, 0x92, 0x68, 0x9f, 0xc0, 0xe9, 0x31, 0xdb, 
+0xaf, 0xf7, 0x45, 0x95, 0x71, 0x02, 0x85, 0x2d, 0xb3, 0x51, 0x38, 0xf4, 0x86, 0xd5, 0x20, 0x81, 
+0x10, 0xa6, 0xee, 0x16, 0xad, 0xfe, 0x23, 0x72, 0x02, 0x4c, 0xf3, 0x0f, 0x40, 0x6f, 0x8f, 0x53, 
+0x27, 0x8d, 0x12, 0xc9, 0x59, 0xe0, 0x42, 0xf3, 0x0b, 0x93, 0xbd, 0x6d, 0x04, 0x9c, 0x5f, 0xb1, 
+0x3b, 0x71, 0x2c, 0x59, 0x7c, 0x34, 0xca, 0xa2, 0xe5, 0x28, 0xd0, 0x87, 0xb6, 0xd7, 0x0c, 0xef, 
+0xc2, 0x66, 0xe6, 0x37, 0xb6, 0x19, 0xa1, 0xc5, 0x65, 0xd5, 0x21, 0xa8, 0xe8, 0x31, 0xc3, 0xd9, 
+0x86, 0xf7, 0xc6, 0x98, 0xd6, 0x4f, 0x13, 0x86, 0x55, 0xae, 0x78, 0x35, 0x5c, 0x24, 0x9d, 0x46, 
+0x7f, 0x06, 0xa5, 0x79, 0xd9, 0x90, 0x4e, 0x7a, 0x32, 0xe6, 0x83, 0x42, 0x54, 0x7a, 0x18, 0x4c, 
+0xa4, 0x01, 0x65, 0x1e, 0xe6, 0xb0, 0x6a, 0xf5, 0x3d, 0xc5, 0x15, 0xfc, 0xab, 0xe4, 0x6a, 0xb8, 
+0x32, 0xfd, 0x4b, 0x1b, 0x60, 0x2a, 0xef, 0x12, 0xaf, 0x58, 0x0c, 0xcd, 0xb7, 0xfe, 0x96, 0xe3, 
+0x26, 0xb4, 0x49, 0x83, 0x3c, 0x07, 0x91, 0xcc, 0x1e, 0x9c, 0x63, 0x91, 0x0a, 0x4e, 0xcb, 0x1b, 
+0x94, 0xd1, 0xad, 0x8b, 0xe8, 0xb3, 0x6d, 0xcb, 0x89, 0xf6, 0x9f, 0x2a, 0x66, 0x13, 0x39, 0x5f, 
+0x73, 0xea, 0xcf, 0x9f, 0xfb, 0xb9, 0x5d, 0x30, 0x76, 0xed, 0x46, 0xdc, 0x77, 0x38, 0x87, 0xec, 
+0x59, 0x6d, 0x28, 0xc7, 0x41, 0x05, 0x9b, 0x3d, 0x1f, 0x47, 0x70, 0xde, 0xa8, 0x87, 0xd2, 0xc2, 
+0x93, 0x35, 0x0f, 0x69, 0x27, 0x4d, 0xe3, 0xa7, 0xd3, 0x03, 0xb6, 0x26, 0xc4, 0xf7, 0xa6, 0x00, 
+0x3f, 0xde, 0x0e, 0x78, 0x5a, 0xd4, 0xf4, 0x64, 0xdc, 0xbe, 0x8e, 0x03, 0x41, 0xef, 0x51, 0x09, 
+0xf8, 0x56, 0x8c, 0xc1, 0xda, 0x7c, 0x0d, 0x8a, 0x40, 0x5f, 0x7e, 0xa2, 0x5a, 0x15, 0x64, 0xbb, 
+0x82, 0x9d, 0xbf, 0xf9, 0x90, 0x2b, 0x7b, 0x0f, 0xab, 0x2f, 0xfa, 0x5c, 0xb5, 0x23, 0x79, 0xb2, 
+};
@@ -0,0 +1,261 @@
+// Generated by native/bluenoise (pio run -e bluenoise -t exec), do not edit.
+// 64 x 64 tileable void-and-cluster thresholds, row by row; see METABALL_NOISE_MASK.
+
+const unsigned char BlueNoise64[] PROGMEM = {
+0xe3, 0x50, 0x24, 0xd1, 0xaf, 0x49, 0x7c, 0x27, 0xfa, 0x45, 0x6c, 0x99, 0xd8, 0x73, 0xbd, 0x32, 
+0x62, 0xe9, 0x50, 0xa5, 0xfc, 0x03, 0xbe, 0xea, 0x0e, 0xde, 0xba, 0x4a, 0xcf, 0x73, 0xc1, 0x23, 
+0xd9, 0x34, 0x51, 0xea, 0x3f, 0xde, 0x82, 0x03, 0xc1, 0x92, 0x27, 0x67, 0x18, 0xea, 0x2d, 0x64, 
+0x80, 0xa7, 0x5c, 0x2b, 0x73, 0x49, 0xa6, 0x81, 0xba, 0x43, 0xfb, 0x14, 0xe2, 0xc0, 0x03, 0xaa, 
+0x77, 0xb8, 0x98, 0x6e, 0x00, 0xed, 0x1a, 0xc2, 0xa5, 0x04, 0xcd, 0x13, 0x3c, 0xea, 0x4c, 0xac, 
+0xd5, 0x26, 0xc9, 0x3c, 0x67, 0xd8, 0x98, 0x36, 0x53, 0x92, 0x7f, 0x06, 0x61, 0x33, 0x8b, 0xa1, 
+0xff, 0x00, 0xb4, 0x68, 0xa1, 0x26, 0x60, 0xa7, 0xe6, 0x70, 0xfe, 0xc5, 0x43, 0xb3, 0x8f, 0xfb, 
+0x45, 0x0d, 0xda, 0xb1, 0x00, 0xfe, 0x1c, 0x54, 0xea, 0x9a, 0x2c, 0x7c, 0x3a, 0xa2, 0x62, 0x42, 
+0x0f, 0xf0, 0x38, 0x58, 0xdf, 0xa8, 0x8c, 0x67, 0x39, 0x83, 0xe5, 0xb2, 0x5f, 0x1c, 0x97, 0x04, 
+0x6e, 0x92, 0x12, 0xb9, 0x88, 0x56, 0x21, 0x78, 0xb2, 0xd3, 0x27, 0xfb, 0xa8, 0xe7, 0x0d, 0x51, 
+0x6e, 0x86, 0xcd, 0x1b, 0x8b, 0xc7, 0xf8, 0x3c, 0x1c, 0x56, 0x0c, 0xa1, 0x7a, 0x59, 0xcd, 0x1b, 
+0xba, 0x99, 0x4c, 0x84, 0xd1, 0x95, 0xc7, 0x6f, 0x0b, 0xd4, 0x5c, 0xcc, 0x8f, 0x1e, 0xde, 0xc9, 
+0x28, 0x86, 0xd6, 0x1b, 0x78, 0x2f, 0x52, 0xd5, 0xf1, 0x59, 0x24, 0x7a, 0xa0, 0xd1, 0x83, 0xf4, 
+0x35, 0xdc, 0x7d, 0xf1, 0x18, 0xa9, 0xc8, 0xf4, 0x16, 0x44, 0x6b, 0xc3, 0x3e, 0x7d, 0xda, 0xc6, 
+0x40, 0xa9, 0x2e, 0xf1, 0x49, 0x0d, 0x73, 0x98, 0xbc, 0x85, 0xd2, 0x2f, 0xef, 0x10, 0x3a, 0x6e, 
+0xe5, 0x2f, 0xf6, 0x69, 0x3b, 0x5b, 0x27, 0xb5, 0x3d, 0x8a, 0x19, 0xad, 0xf1, 0x52, 0x73, 0x9a, 
+0x4e, 0x67, 0xb1, 0x9e, 0xc6, 0xfb, 0x09, 0xaf, 0x17, 0x91, 0xbf, 0x47, 0xff, 0x2c, 0x57, 0xba, 
+0x45, 0xae, 0x5c, 0x2e, 0x4c, 0xe5, 0x38, 0x61, 0x84, 0xe2, 0x9e, 0x1c, 0x8f, 0x5a, 0x2b, 0xb2, 
+0x19, 0xe6, 0x5c, 0x77, 0xd8, 0xae, 0x54, 0x2c, 0xe0, 0x42, 0xb1, 0x63, 0x96, 0xd7, 0x83, 0xaa, 
+0x51, 0x8d, 0x1d, 0xbe, 0x0f, 0xf0, 0x83, 0xdb, 0xa2, 0xf5, 0x75, 0x45, 0x06, 0xbc, 0x33, 0xfc, 
+0xc0, 0xe6, 0x11, 0x43, 0x5d, 0x90, 0x3d, 0x7e, 0xcb, 0x32, 0xe8, 0x0d, 0x6b, 0xc3, 0x18, 0x76, 
+0xe6, 0x09, 0x9b, 0xd1, 0x71, 0x8d, 0x0a, 0x9f, 0xba, 0x00, 0x52, 0xef, 0xb6, 0x0f, 0xf7, 0x64, 
+0x9a, 0x7f, 0x09, 0xbd, 0x36, 0x90, 0xec, 0xc5, 0x14, 0x76, 0xf6, 0x01, 0x4d, 0xbb, 0x23, 0xdf, 
+0x05, 0xcb, 0x7b, 0xa6, 0xe1, 0x9a, 0x44, 0x07, 0x62, 0x2f, 0xc0, 0xd9, 0x68, 0x83, 0xa5, 0x0a, 
+0x91, 0x36, 0x75, 0xf0, 0x25, 0xbf, 0xe6, 0x68, 0x4e, 0xa3, 0x72, 0xb2, 0x38, 0x8b, 0xd7, 0xa3, 
+0x27, 0x68, 0xfd, 0x14, 0xc3, 0xb1, 0x55, 0xfa, 0x2d, 0xd0, 0x7b, 0x35, 0xd3, 0x70, 0x93, 0x39, 
+0xd8, 0x4c, 0xf9, 0xa2, 0x1e, 0x69, 0x07, 0x84, 0x5e, 0xa3, 0x25, 0x8a, 0xe7, 0x6c, 0x3e, 0x98, 
+0x5e, 0xeb, 0x38, 0x56, 0x23, 0x68, 0xcb, 0x79, 0xe6, 0x54, 0x1c, 0x95, 0x2b, 0xeb, 0xcf, 0x5c, 
+0x23, 0xd8, 0x9b, 0xcb, 0x84, 0x10, 0xa0, 0x1f, 0xf7, 0x06, 0xdc, 0x55, 0x9a, 0xea, 0x01, 0x52, 
+0x88, 0xb8, 0x49, 0x7f, 0x3b, 0x23, 0xdd, 0x75, 0x48, 0x95, 0x62, 0xa9, 0x23, 0x48, 0xca, 0x0b, 
+0xb7, 0x27, 0x8b, 0x3d, 0xe1, 0xcf, 0x47, 0xfd, 0xb6, 0x4b, 0xd6, 0x37, 0xad, 0x14, 0xfd, 0xc7, 
+0x71, 0x12, 0xb8, 0x91, 0xd5, 0x34, 0xb9, 0x17, 0xaa, 0x8a, 0xfb, 0xb3, 0x57, 0x15, 0x41, 0x7a, 
+0xb5, 0x49, 0x0b, 0x52, 0x65, 0xb7, 0x48, 0xd3, 0x93, 0x80, 0x2b, 0xc9, 0x1d, 0x63, 0x40, 0xf6, 
+0xce, 0x33, 0xda, 0x94, 0xee, 0x66, 0x9b, 0x0f, 0xc3, 0xee, 0x16, 0xdf, 0x86, 0xf4, 0xa4, 0x7b, 
+0xe5, 0x6b, 0xc8, 0x57, 0x75, 0xaf, 0x94, 0x34, 0x16, 0xe6, 0x65, 0xc8, 0x79, 0x58, 0x8d, 0x2e, 
+0xab, 0x45, 0xf3, 0x77, 0x04, 0xfd, 0x85, 0x4c, 0xd0, 0x3b, 0x01, 0x73, 0xdd, 0xbf, 0x98, 0xf7, 
+0xe1, 0x6d, 0xa6, 0xfd, 0x29, 0xe1, 0x76, 0x35, 0x5f, 0xb9, 0x46, 0xfb, 0x83, 0xc0, 0xab, 0x7a, 
+0x10, 0xaf, 0x1e, 0x5d, 0x03, 0xce, 0x41, 0xb2, 0x27, 0x83, 0x3e, 0xbb, 0x05, 0x55, 0x2c, 0x5d, 
+0x1c, 0xac, 0x02, 0xf2, 0x14, 0x28, 0x60, 0xc7, 0x7b, 0x8e, 0x1e, 0x9d, 0x0b, 0xe4, 0xb8, 0x19, 
+0x81, 0xcd, 0x21, 0x50, 0xb1, 0x5e, 0x9d, 0x29, 0xee, 0x69, 0xa4, 0x47, 0x87, 0x2e, 0x65, 0x04, 
+0x84, 0x1f, 0xd4, 0x3c, 0x8a, 0xaa, 0x00, 0xc4, 0xf1, 0x12, 0xa7, 0x6a, 0x0c, 0xe1, 0x25, 0x95, 
+0x56, 0x71, 0xe8, 0xa5, 0xbb, 0x7a, 0xf7, 0x8e, 0x52, 0xcb, 0x5f, 0x9d, 0x6f, 0xea, 0xb3, 0x8e, 
+0xfe, 0x46, 0x99, 0x7e, 0xc0, 0xeb, 0xa2, 0x04, 0xf0, 0x42, 0xbd, 0x51, 0xd2, 0x33, 0x4a, 0xf2, 
+0x5c, 0x9f, 0xe0, 0x94, 0x3a, 0xe9, 0x0c, 0x72, 0xbf, 0x1e, 0xe1, 0xca, 0x13, 0xec, 0xae, 0x3a, 
+0x9f, 0x57, 0xbb, 0x70, 0x19, 0xed, 0x58, 0x9c, 0x26, 0x73, 0xd3, 0x2f, 0x99, 0x5a, 0x3b, 0xd6, 
+0xbd, 0x43, 0x85, 0x25, 0x50, 0x33, 0x1a, 0x69, 0xe4, 0x08, 0xfb, 0x2f, 0xce, 0x42, 0x12, 0xc4, 
+0x35, 0x63, 0xdc, 0x30, 0x4e, 0x86, 0x3b, 0xd1, 0x6d, 0xab, 0x2a, 0xf5, 0x81, 0x98, 0x6f, 0xd6, 
+0x02, 0x36, 0x6e, 0x13, 0xbc, 0x7e, 0xd6, 0xa8, 0x55, 0x90, 0x37, 0x5e, 0x9c, 0x78, 0x52, 0xcc, 
+0x2a, 0xe7, 0x09, 0x98, 0xcc, 0x45, 0x7e, 0xdf, 0x3f, 0x8d, 0xeb, 0x4a, 0xb5, 0xf0, 0x76, 0x1b, 
+0xfc, 0x0b, 0xc7, 0xf1, 0x9b, 0xdf, 0xc0, 0xa9, 0x39, 0x9a, 0x7e, 0x17, 0xaa, 0x86, 0xda, 0x74, 
+0xa2, 0xcc, 0x1a, 0xb1, 0x68, 0xe3, 0x1d, 0x93, 0x55, 0x10, 0xdb, 0x67, 0x07, 0xb6, 0x23, 0xa7, 
+0x88, 0xb8, 0xfa, 0x53, 0xcd, 0x1c, 0x48, 0x32, 0xf1, 0x0e, 0xb7, 0xf8, 0x25, 0xc0, 0x0f, 0xf3, 
+0x8f, 0x7b, 0x47, 0xf8, 0x62, 0x2b, 0xad, 0x0c, 0xc1, 0x5b, 0x14, 0x7d, 0xc7, 0x07, 0x8e, 0xa9, 
+0x66, 0x9e, 0x36, 0x6b, 0x07, 0x7d, 0x5d, 0x10, 0xd4, 0x6f, 0xc1, 0x4f, 0xe4, 0x61, 0x28, 0x53, 
+0x0c, 0x81, 0xf6, 0x94, 0x09, 0xb9, 0x49, 0xfb, 0xc2, 0x7a, 0x91, 0x45, 0xc7, 0x56, 0xec, 0x40, 
+0x64, 0xda, 0x27, 0x82, 0xa4, 0x63, 0xe3, 0x95, 0xc7, 0x82, 0x6b, 0x44, 0x8a, 0xda, 0x3e, 0x64, 
+0x18, 0xdb, 0xac, 0x24, 0xbc, 0x8c, 0xd4, 0x6d, 0xfe, 0x95, 0xae, 0x25, 0x67, 0x42, 0xdb, 0x4f, 
+0x22, 0xe5, 0x55, 0x90, 0xca, 0x40, 0xff, 0x8c, 0x47, 0x21, 0xf0, 0x37, 0x91, 0x01, 0xf8, 0xb9, 
+0xe3, 0x2c, 0x57, 0x40, 0xca, 0x75, 0xa4, 0x2d, 0x16, 0xe8, 0x36, 0xa9, 0xfe, 0x16, 0x7f, 0xcf, 
+0x0f, 0x49, 0x9d, 0x08, 0xee, 0x2c, 0x78, 0x05, 0x5c, 0x22, 0xd6, 0xb0, 0x02, 0x6f, 0xa2, 0xb7, 
+0xc9, 0x37, 0x5b, 0x77, 0x06, 0xef, 0x3c, 0x1f, 0x4f, 0x32, 0xe7, 0xcf, 0xa1, 0xf5, 0x2f, 0xb3, 
+0xce, 0x82, 0xb6, 0x15, 0xda, 0xa0, 0x2c, 0xb9, 0xdf, 0xa3, 0x63, 0xb4, 0xd4, 0x78, 0x9c, 0x3e, 
+0x89, 0xae, 0x70, 0xec, 0x22, 0xe1, 0x5c, 0x84, 0xb6, 0x61, 0xd2, 0x24, 0x6f, 0x9c, 0x37, 0xba, 
+0x91, 0xf1, 0x74, 0xb5, 0x3e, 0xd4, 0xbd, 0xa9, 0xfc, 0x38, 0x9f, 0x55, 0xe6, 0x31, 0xfe, 0x50, 
+0x0a, 0x93, 0xeb, 0xd2, 0x9d, 0x56, 0x81, 0xa5, 0xbe, 0x74, 0x02, 0x54, 0x81, 0x12, 0x61, 0x7b, 
+0x03, 0x3f, 0xf5, 0x29, 0x74, 0x5a, 0x18, 0x79, 0x54, 0x06, 0x83, 0x19, 0x2d, 0x4c, 0xcd, 0x14, 
+0x64, 0xc5, 0x05, 0xa1, 0x87, 0x3a, 0x0a, 0xf3, 0x3f, 0x9e, 0x03, 0x87, 0xc2, 0x5d, 0xe5, 0x20, 
+0x6b, 0x30, 0xcb, 0x55, 0x8f, 0x69, 0x14, 0x4d, 0x88, 0xde, 0x79, 0x1a, 0xbc, 0x96, 0x20, 0x7f, 
+0x65, 0xa9, 0x1d, 0x4a, 0x30, 0xc4, 0xe0, 0x0f, 0xf4, 0x8b, 0xdc, 0x36, 0xbf, 0x92, 0xd4, 0xea, 
+0x9b, 0x6a, 0xa5, 0x4c, 0xc0, 0xf1, 0xaa, 0xe8, 0x31, 0xc0, 0xf9, 0x94, 0xe9, 0x6b, 0xa6, 0xe1, 
+0x26, 0xfd, 0x47, 0xd8, 0x62, 0xbd, 0xcf, 0x96, 0x72, 0xdd, 0x52, 0xf2, 0x41, 0x0d, 0xac, 0x50, 
+0xde, 0xa3, 0x14, 0xfd, 0x20, 0xe5, 0x9e, 0x2e, 0xc3, 0x09, 0x46, 0xee, 0x84, 0x60, 0xcf, 0xe3, 
+0x3a, 0xf9, 0x72, 0x8c, 0xb0, 0x17, 0x6e, 0x43, 0x5d, 0x22, 0x9f, 0x6b, 0xfc, 0x46, 0x1b, 0x53, 
+0x2e, 0xc9, 0x0f, 0xe0, 0x83, 0x05, 0x41, 0x8b, 0xd2, 0x6f, 0x3f, 0x59, 0xc2, 0x10, 0x38, 0x8e, 
+0x54, 0x7c, 0x95, 0x33, 0x13, 0xa7, 0x4e, 0x29, 0x17, 0xbb, 0x2d, 0xa3, 0xd0, 0x75, 0xed, 0x84, 
+0x01, 0xbd, 0x60, 0x39, 0x80, 0xc6, 0x5b, 0xf3, 0x70, 0xad, 0x63, 0xca, 0x36, 0x07, 0x47, 0xb2, 
+0x23, 0xc4, 0x02, 0xdd, 0x5f, 0xf2, 0x99, 0xd6, 0xb3, 0xcd, 0x4c, 0x0a, 0xa8, 0x2a, 0xc5, 0xb0, 
+0x87, 0xfa, 0x5f, 0x93, 0x35, 0x6c, 0xbd, 0x5c, 0x13, 0xa0, 0x24, 0xde, 0xac, 0x7e, 0xee, 0xb3, 
+0xd3, 0x17, 0xbf, 0xe9, 0x6d, 0xfa, 0x7d, 0xd7, 0x60, 0xec, 0x7f, 0x64, 0x1b, 0x94, 0x29, 0xc9, 
+0x44, 0x71, 0x96, 0xd3, 0xaf, 0x04, 0x40, 0x93, 0x1c, 0xd4, 0x2a, 0x90, 0xa9, 0xf4, 0x74, 0x98, 
+0x5b, 0x80, 0x41, 0xbb, 0x25, 0x3b, 0x85, 0x07, 0x30, 0x72, 0xe8, 0xbc, 0x7c, 0x5c, 0xee, 0x6c, 
+0x16, 0x3d, 0xac, 0x22, 0xcd, 0x9d, 0xe3, 0x28, 0xf7, 0xb4, 0x79, 0x09, 0x4d, 0x29, 0x65, 0x03, 
+0x42, 0x5f, 0xa6, 0x20, 0x89, 0x3d, 0x02, 0xac, 0x94, 0x46, 0x08, 0xb0, 0xfb, 0x3a, 0x5e, 0x9e, 
+0xf8, 0x25, 0xe3, 0x4d, 0x2b, 0x76, 0xde, 0xb7, 0x4f, 0x82, 0xf9, 0x16, 0x4e, 0xbe, 0x14, 0xd4, 
+0xf2, 0x9e, 0xe2, 0x6d, 0xa6, 0xc8, 0x57, 0xf8, 0xaa, 0x8c, 0x15, 0x39, 0xde, 0x90, 0x0c, 0xa0, 
+0xdf, 0x7c, 0xd5, 0x58, 0xf3, 0x11, 0x4d, 0x90, 0x65, 0x45, 0xd1, 0x8b, 0xfd, 0x9d, 0xc8, 0x87, 
+0xf7, 0x75, 0xe0, 0x4f, 0xc9, 0xb5, 0x67, 0xef, 0x33, 0xc6, 0xe0, 0x89, 0x4f, 0xb8, 0xdb, 0x15, 
+0x7f, 0xc3, 0x0d, 0x8a, 0xf6, 0xa3, 0x60, 0x11, 0xe7, 0x39, 0xa3, 0x76, 0xdb, 0x64, 0x89, 0x33, 
+0x09, 0x4c, 0x1e, 0x91, 0x0d, 0xe7, 0x78, 0x1f, 0x41, 0x63, 0xef, 0x9b, 0x21, 0x48, 0xce, 0x34, 
+0x4f, 0xb9, 0x01, 0x74, 0x42, 0xb7, 0x7e, 0xc6, 0x04, 0xe5, 0x31, 0xbf, 0x5e, 0x3b, 0xe6, 0x21, 
+0xb9, 0x33, 0x08, 0x9b, 0x2d, 0xdd, 0x1a, 0x8b, 0x58, 0x13, 0x72, 0x26, 0xd2, 0x0a, 0x6a, 0xa9, 
+0x41, 0x58, 0xb2, 0x6a, 0x1a, 0xca, 0x32, 0x86, 0xc2, 0x6a, 0x00, 0xc8, 0x3d, 0x20, 0xea, 0xa7, 
+0xcc, 0xb9, 0x61, 0xfe, 0x31, 0x47, 0x9b, 0xbf, 0xda, 0xb2, 0x4f, 0xcb, 0x6d, 0xb8, 0x62, 0xfc, 
+0x89, 0x28, 0xed, 0x90, 0xa4, 0x1f, 0xd9, 0x35, 0xab, 0x97, 0x6e, 0x19, 0xae, 0x0b, 0x70, 0x50, 
+0x97, 0xd8, 0x84, 0xf2, 0x5d, 0x7f, 0x46, 0xd5, 0xba, 0xa0, 0xf5, 0x40, 0x95, 0x7c, 0xe5, 0x30, 
+0xf3, 0x8d, 0xd6, 0x3c, 0xea, 0x52, 0x97, 0xfc, 0x22, 0xaf, 0x53, 0xf0, 0x9a, 0xb4, 0x52, 0x70, 
+0x84, 0x2c, 0xd7, 0x76, 0xb4, 0xd0, 0x67, 0x01, 0x82, 0x2a, 0x11, 0x7d, 0xf4, 0x04, 0x98, 0x1b, 
+0xab, 0x6a, 0xc8, 0x31, 0x64, 0xfe, 0x59, 0x76, 0xee, 0x26, 0x54, 0xf4, 0x7e, 0xda, 0xc5, 0xa7, 
+0x0f, 0x62, 0x42, 0xb4, 0x14, 0xa6, 0xf9, 0x2b, 0x76, 0x1d, 0x64, 0xac, 0xc1, 0x54, 0x1e, 0xc8, 
+0x72, 0x04, 0x28, 0xa1, 0x7b, 0xb5, 0x06, 0x71, 0x3e, 0xde, 0x8c, 0x2b, 0x7c, 0x0d, 0xe2, 0x3c, 
+0xf6, 0x9d, 0x04, 0x54, 0x89, 0x16, 0xe4, 0x57, 0xfa, 0x95, 0xc1, 0x34, 0xa6, 0x43, 0xd5, 0x78, 
+0xe5, 0x0c, 0x4c, 0xde, 0xaf, 0x08, 0x40, 0xd2, 0x11, 0x86, 0xce, 0xa1, 0x48, 0x2b, 0x89, 0x3d, 
+0xf6, 0x79, 0xc9, 0x26, 0xe4, 0x6b, 0x06, 0x94, 0xcc, 0x4a, 0xdc, 0x01, 0x2e, 0xfd, 0xa4, 0x49, 
+0x95, 0xb4, 0xe2, 0x62, 0x15, 0xd9, 0x4a, 0xc7, 0xa5, 0x60, 0x18, 0xb9, 0x66, 0xd1, 0x94, 0x1b, 
+0x69, 0x47, 0xad, 0xe1, 0x3d, 0x98, 0x2c, 0xa9, 0x3e, 0x6c, 0xdf, 0x52, 0xe8, 0x84, 0x28, 0x55, 
+0x38, 0xc1, 0x96, 0x1a, 0x71, 0x87, 0xbe, 0x9f, 0x62, 0xb6, 0x39, 0x01, 0xea, 0x63, 0x1b, 0xdf, 
+0xb2, 0x18, 0x96, 0x57, 0x89, 0xc0, 0x50, 0xb2, 0x37, 0xef, 0x8e, 0x77, 0xd0, 0x88, 0x67, 0x0f, 
+0xed, 0x5b, 0x43, 0xc5, 0x91, 0x33, 0xed, 0x83, 0x0e, 0xf3, 0xcc, 0x45, 0xff, 0x31, 0x59, 0xb0, 
+0x11, 0xe9, 0x82, 0x21, 0xc0, 0xf6, 0x73, 0xcc, 0x18, 0xb0, 0x09, 0x63, 0x1d, 0xcc, 0xa1, 0xf8, 
+0xb3, 0x7e, 0x5f, 0xf6, 0xcb, 0x2c, 0xec, 0x1d, 0x47, 0xfa, 0x74, 0x90, 0xb2, 0xc8, 0x9c, 0x6e, 
+0x53, 0x30, 0xed, 0xd0, 0x3c, 0x1f, 0xdb, 0x7a, 0x62, 0x14, 0xb7, 0x58, 0x3c, 0x1b, 0xe0, 0xbe, 
+0x2f, 0x84, 0x12, 0xff, 0x6b, 0xab, 0x1d, 0x56, 0x9a, 0x37, 0x73, 0xa8, 0x04, 0x8b, 0xc0, 0xda, 
+0x76, 0x34, 0xc9, 0x58, 0x6a, 0x07, 0x4b, 0x8c, 0xee, 0x7c, 0xc9, 0x97, 0xb8, 0x70, 0x07, 0x65, 
+0x17, 0xd2, 0x27, 0x42, 0xa2, 0x4e, 0x68, 0x93, 0xc6, 0x2a, 0xd7, 0x15, 0x54, 0x30, 0xff, 0x08, 
+0xd4, 0x80, 0xa4, 0x01, 0x6f, 0xfd, 0x9d, 0x0a, 0xe9, 0xa1, 0x27, 0xf6, 0x98, 0xaf, 0x44, 0x77, 
+0x9d, 0xd9, 0xb7, 0x29, 0x4d, 0xd0, 0x79, 0xbf, 0xe4, 0x22, 0x92, 0x57, 0xe8, 0x7a, 0x22, 0x4b, 
+0xa9, 0x8d, 0x0c, 0xf0, 0xa0, 0xb3, 0xd9, 0x35, 0x5b, 0x24, 0x48, 0xfd, 0x32, 0x45, 0xeb, 0x92, 
+0x4b, 0xa5, 0xe9, 0x8a, 0x14, 0xdc, 0xb2, 0x05, 0x7e, 0x59, 0xa4, 0x6d, 0xe0, 0x82, 0x4a, 0x8f, 
+0xc0, 0x42, 0x61, 0xbc, 0x93, 0x4a, 0x31, 0xc5, 0x87, 0x4e, 0xc8, 0x6a, 0x08, 0xd3, 0x61, 0xf9, 
+0x03, 0x3f, 0x71, 0xa4, 0x8e, 0x0a, 0xf6, 0x3f, 0x69, 0xb7, 0xdd, 0x15, 0xcf, 0x3d, 0x9a, 0xf7, 
+0x60, 0xd7, 0xb6, 0x44, 0x2a, 0x81, 0x1b, 0xc2, 0xa5, 0xe7, 0x87, 0x11, 0x78, 0xd3, 0xae, 0x2d, 
+0xde, 0x72, 0x04, 0x5a, 0xc5, 0x7a, 0x39, 0xee, 0xcf, 0x12, 0xf2, 0x3f, 0xc1, 0x19, 0xaf, 0x2a, 
+0xe6, 0x10, 0xf6, 0x2a, 0xd4, 0x7d, 0xaa, 0x5c, 0x21, 0xde, 0x40, 0x82, 0xe7, 0x31, 0x8b, 0x21, 
+0xc2, 0x59, 0xef, 0x1b, 0xdf, 0x5e, 0x2f, 0xb0, 0x06, 0x48, 0x7e, 0x32, 0xac, 0x6b, 0xc6, 0x17, 
+0x3a, 0x21, 0x6f, 0x96, 0xe5, 0x60, 0xfb, 0x94, 0x02, 0x6a, 0xb6, 0xda, 0xa4, 0x52, 0x0e, 0x7d, 
+0xc3, 0x39, 0xb9, 0x97, 0xf5, 0x28, 0x61, 0x9c, 0x4b, 0xae, 0x88, 0x24, 0x9a, 0xeb, 0x71, 0x5d, 
+0x9d, 0x77, 0xad, 0x52, 0x19, 0xe8, 0x0e, 0xf3, 0x6f, 0xb1, 0x11, 0xbb, 0x55, 0xa6, 0xcb, 0x4f, 
+0xac, 0x7f, 0xcd, 0x37, 0xbd, 0x7d, 0x9e, 0xdb, 0x8d, 0xfc, 0xc2, 0x5a, 0xf3, 0x0c, 0x50, 0xe2, 
+0x7e, 0xfa, 0x4e, 0xc3, 0x08, 0x3c, 0x74, 0x4f, 0xd1, 0x41, 0x2e, 0x5b, 0x1f, 0x90, 0xef, 0x5d, 
+0x1c, 0xff, 0x6a, 0x48, 0x0d, 0xad, 0xe0, 0x1c, 0x73, 0x32, 0xdd, 0x66, 0x51, 0x03, 0xb8, 0xd5, 
+0x1c, 0x3d, 0xdc, 0x8f, 0x69, 0xb6, 0x3e, 0xcb, 0x8c, 0x34, 0x9a, 0xff, 0x20, 0x78, 0x0a, 0xf1, 
+0x2c, 0x92, 0x0f, 0x6c, 0x4b, 0xf1, 0x1f, 0x54, 0x71, 0x13, 0x95, 0x24, 0x9f, 0x77, 0xb8, 0x91, 
+0xcb, 0xa5, 0x15, 0x86, 0xd1, 0x9c, 0xbb, 0x26, 0x82, 0xe2, 0x9e, 0xf7, 0xbf, 0x3e, 0xce, 0xb3, 
+0x83, 0xa1, 0x2e, 0xe6, 0x82, 0x51, 0xc9, 0x8c, 0xfd, 0xba, 0x0d, 0xc6, 0xf7, 0x8e, 0x2d, 0x47, 
+0xf3, 0x86, 0x12, 0xc7, 0x2d, 0x9e, 0x79, 0x51, 0x06, 0xe5, 0x5d, 0x71, 0x3d, 0xe0, 0x98, 0x65, 
+0xd1, 0x40, 0xe7, 0xb3, 0x96, 0x00, 0xcc, 0xad, 0x2d, 0xd3, 0x66, 0xec, 0x43, 0xda, 0x2e, 0x05, 
+0x41, 0x65, 0xe8, 0x35, 0x56, 0xe1, 0x0f, 0xf3, 0xac, 0x18, 0x76, 0x08, 0x84, 0x69, 0x2a, 0x00, 
+0x4b, 0xd5, 0x12, 0xc4, 0xa5, 0x36, 0x6b, 0x02, 0x41, 0x5b, 0x81, 0xa3, 0x38, 0x78, 0xcd, 0xa5, 
+0x6a, 0xbe, 0x58, 0xfc, 0x48, 0xe0, 0x1c, 0xf8, 0xa4, 0xc3, 0x16, 0xd6, 0x8a, 0xc1, 0x48, 0x1d, 
+0x7a, 0xa7, 0x5a, 0x23, 0xd3, 0x77, 0x42, 0x87, 0xe9, 0x3d, 0xb5, 0x18, 0x89, 0xab, 0x5b, 0xeb, 
+0x99, 0x22, 0xb4, 0x72, 0xaa, 0x2a, 0x6a, 0x90, 0x46, 0x61, 0xcb, 0x4e, 0xde, 0xab, 0xf4, 0x96, 
+0xe9, 0x60, 0x91, 0x70, 0x1e, 0xd9, 0xb4, 0xe8, 0x96, 0xd3, 0x1f, 0x49, 0xdc, 0x13, 0x5c, 0xe9, 
+0x0b, 0x35, 0xa8, 0x76, 0x02, 0xbc, 0x92, 0x66, 0x3b, 0x7f, 0x4c, 0xb1, 0x2e, 0x0e, 0xf9, 0xb8, 
+0xdd, 0x07, 0xf0, 0x88, 0x36, 0xf8, 0x5f, 0xc4, 0x0b, 0x9b, 0x53, 0xce, 0x6c, 0x20, 0xc3, 0x75, 
+0xbc, 0x53, 0xd7, 0x00, 0xfc, 0x80, 0xc8, 0x33, 0xb9, 0xeb, 0x24, 0x99, 0x36, 0x19, 0x55, 0x78, 
+0x34, 0xbb, 0x41, 0xf9, 0x56, 0x84, 0x17, 0x61, 0x2d, 0xaf, 0xef, 0x67, 0xb6, 0x99, 0x25, 0x80, 
+0x96, 0xe3, 0x21, 0x8b, 0xd8, 0x5a, 0x2e, 0xb0, 0xd9, 0x21, 0x95, 0xf4, 0x66, 0xa0, 0x59, 0x86, 
+0x29, 0x50, 0xa0, 0x69, 0xbb, 0x11, 0xa7, 0x25, 0x6f, 0xf9, 0x7f, 0x02, 0xe2, 0x3c, 0xfe, 0x0f, 
+0x34, 0xef, 0x89, 0x3f, 0x9a, 0x17, 0x4f, 0xdc, 0x04, 0xa3, 0x7b, 0xfe, 0xbc, 0x89, 0xd8, 0xc5, 
+0x1e, 0xa7, 0x0c, 0xca, 0x2b, 0xec, 0x9d, 0xce, 0x4d, 0x72, 0x0e, 0x88, 0x33, 0xfe, 0xc5, 0x3c, 
+0x54, 0xce, 0x66, 0xae, 0x38, 0xed, 0x85, 0x0a, 0xf0, 0x5e, 0xc6, 0x01, 0x7c, 0xe7, 0x39, 0xae, 
+0x72, 0xc8, 0x3c, 0x1a, 0xd9, 0x50, 0x94, 0xd4, 0x48, 0xae, 0x31, 0xbd, 0x8d, 0xa5, 0x57, 0x7e, 
+0xce, 0x1a, 0x6d, 0xc5, 0x5d, 0xae, 0xf1, 0x67, 0x86, 0x3b, 0x57, 0x12, 0x6c, 0x44, 0x08, 0x9e, 
+0x68, 0xdb, 0x74, 0x8c, 0xab, 0x44, 0x75, 0x09, 0xf5, 0x93, 0xc6, 0xe7, 0x58, 0x00, 0x69, 0xb1, 
+0xf3, 0x07, 0x43, 0xc6, 0x11, 0x72, 0xcd, 0x49, 0x99, 0x76, 0x32, 0x46, 0xb5, 0x23, 0xd0, 0x14, 
+0xe4, 0x8d, 0xfb, 0xad, 0x70, 0xec, 0x31, 0x81, 0xe3, 0x1e, 0x5f, 0xf2, 0x4b, 0x25, 0xdb, 0x96, 
+0xaf, 0x4c, 0xa2, 0x27, 0xe8, 0x38, 0x8f, 0x25, 0xd3, 0xab, 0xe7, 0xc4, 0x95, 0xe1, 0x5d, 0xfa, 
+0x29, 0x4b, 0xf2, 0x5b, 0x19, 0xdf, 0xc0, 0x29, 0xaa, 0x3b, 0x1e, 0x45, 0xa6, 0xd4, 0x85, 0x1d, 
+0xa1, 0x74, 0x8f, 0xf8, 0x53, 0xa1, 0x28, 0xb6, 0x1d, 0xd2, 0xea, 0x9f, 0xdc, 0x53, 0x93, 0x67, 
+0x46, 0x02, 0x60, 0x27, 0x85, 0x09, 0xba, 0x62, 0x0f, 0x92, 0xd0, 0x77, 0x0e, 0xb8, 0x65, 0x06, 
+0x73, 0xfa, 0xd5, 0x08, 0x79, 0xd0, 0x13, 0xbe, 0x4a, 0x0b, 0x72, 0x31, 0x1f, 0xaf, 0x37, 0x84, 
+0xb8, 0x94, 0x02, 0xb4, 0x38, 0x69, 0x91, 0x53, 0x7d, 0xe2, 0x68, 0xbf, 0x7b, 0x29, 0xec, 0x4a, 
+0xdc, 0x31, 0xba, 0x24, 0x80, 0xdd, 0x66, 0xff, 0x89, 0x57, 0x12, 0x68, 0x84, 0x09, 0xc5, 0xf1, 
+0xa6, 0xbc, 0xd8, 0x4c, 0xcb, 0xa1, 0x43, 0xfd, 0xc7, 0x4d, 0x9f, 0x3a, 0xe0, 0x83, 0xef, 0x42, 
+0x8c, 0x31, 0x60, 0x94, 0xb1, 0x53, 0x70, 0x9c, 0xf9, 0x83, 0xd9, 0x4f, 0xf3, 0x7a, 0xcc, 0x15, 
+0xe4, 0x40, 0xd2, 0x7c, 0xee, 0xc7, 0x12, 0xfc, 0xb7, 0x06, 0xd7, 0x9a, 0x13, 0x61, 0xb5, 0x94, 
+0x10, 0x5e, 0xe5, 0xa8, 0x16, 0x3f, 0xc9, 0x06, 0x38, 0xa5, 0xbe, 0x29, 0xfa, 0x3e, 0x7b, 0x31, 
+0x1d, 0x80, 0x37, 0x96, 0xf0, 0x20, 0x79, 0xa8, 0x2d, 0x6d, 0xec, 0x15, 0xa9, 0x50, 0x2c, 0xc1, 
+0xe3, 0x13, 0xbb, 0x44, 0xf6, 0x2a, 0xe3, 0x3c, 0x5d, 0x28, 0xb4, 0x97, 0x62, 0x04, 0xa0, 0x58, 
+0x73, 0x22, 0x61, 0x9f, 0x26, 0x4d, 0xa3, 0x35, 0x5d, 0x8d, 0x49, 0x30, 0xfa, 0xcd, 0x3a, 0x6e, 
+0xd2, 0x8a, 0x44, 0x6d, 0xef, 0x97, 0x5a, 0xb0, 0x79, 0xed, 0x48, 0xcf, 0x99, 0xb0, 0x5c, 0xda, 
+0x9e, 0x66, 0xe5, 0x0e, 0x6e, 0x57, 0xdf, 0x03, 0x8c, 0xbd, 0x22, 0xca, 0x6a, 0xd6, 0x9a, 0x1e, 
+0x58, 0x9f, 0xdb, 0x81, 0x0f, 0x8b, 0xc3, 0x01, 0xa5, 0xcd, 0x16, 0x3b, 0xc1, 0xe7, 0x47, 0xd7, 
+0xa7, 0xeb, 0xba, 0x10, 0x89, 0xe4, 0x6d, 0xcf, 0x21, 0xf0, 0x71, 0xac, 0x82, 0x54, 0x05, 0xf2, 
+0xa6, 0x1f, 0xc8, 0x02, 0xbd, 0x2f, 0x82, 0xe4, 0x20, 0x65, 0x8d, 0x0e, 0x6e, 0x20, 0xbf, 0x0b, 
+0xff, 0x51, 0xc1, 0xad, 0x34, 0x93, 0xb5, 0x40, 0xf2, 0x56, 0x7f, 0x42, 0x8e, 0x01, 0xf5, 0x77, 
+0xc4, 0x36, 0x6e, 0x24, 0xce, 0x64, 0xad, 0x77, 0xf0, 0x89, 0x69, 0xfd, 0x7d, 0x23, 0x90, 0x33, 
+0x0a, 0x87, 0x4f, 0xf9, 0x3b, 0xb2, 0x05, 0x81, 0x9c, 0xbd, 0x0d, 0xe0, 0x23, 0x9e, 0xc2, 0x7d, 
+0x34, 0x56, 0xfc, 0x7a, 0x4e, 0xd5, 0x10, 0x46, 0xbc, 0xdb, 0x33, 0xf4, 0x4e, 0xe5, 0x8b, 0x46, 
+0x7a, 0x15, 0x2b, 0x86, 0xf8, 0xce, 0x1c, 0x77, 0xd7, 0x12, 0xaf, 0xfa, 0x2b, 0x5e, 0xb3, 0x45, 
+0xe8, 0x0d, 0xf2, 0xb6, 0x51, 0xe1, 0x2f, 0x47, 0x1f, 0x50, 0xd8, 0x0d, 0xa3, 0x5a, 0xbc, 0xf4, 
+0x64, 0xca, 0x29, 0x76, 0xc5, 0x58, 0xd9, 0x47, 0xe9, 0x39, 0x59, 0xc8, 0x42, 0xe8, 0x63, 0x19, 
+0xde, 0xb6, 0x9c, 0x2a, 0x8e, 0xac, 0xf9, 0x9d, 0x5b, 0x00, 0xa0, 0xb4, 0x80, 0xce, 0x31, 0xa8, 
+0xd4, 0x97, 0xca, 0x5b, 0x08, 0x47, 0x64, 0xc3, 0x29, 0x96, 0x66, 0xd2, 0x9f, 0xc7, 0x17, 0x88, 
+0xa7, 0x5b, 0x93, 0x3f, 0xa2, 0x17, 0x91, 0xea, 0xc8, 0x9c, 0x30, 0xb7, 0x45, 0xd3, 0x14, 0x78, 
+0xb0, 0x44, 0xdd, 0xa4, 0x1a, 0x92, 0x2d, 0xad, 0x67, 0x1b, 0x97, 0x6c, 0x85, 0x0b, 0xb2, 0x49, 
+0x88, 0x67, 0x0c, 0xe3, 0x60, 0x1d, 0x6f, 0x35, 0x8a, 0xd2, 0x71, 0x41, 0x18, 0x64, 0x04, 0xf2, 
+0x68, 0x39, 0xec, 0x75, 0xa4, 0xe4, 0x83, 0xa8, 0x4d, 0xea, 0x38, 0x0c, 0x4d, 0x75, 0xdd, 0x26, 
+0x42, 0xd0, 0x74, 0x04, 0xfc, 0x7d, 0x56, 0xb0, 0x08, 0x5e, 0x74, 0xe3, 0x8d, 0x6d, 0x37, 0xdf, 
+0x21, 0x97, 0x00, 0x5f, 0xf3, 0x72, 0xe1, 0x0b, 0x7d, 0xfd, 0xb4, 0xdc, 0x30, 0xf8, 0x92, 0xd4, 
+0x22, 0xee, 0x43, 0xb9, 0xcf, 0x49, 0xe8, 0xc2, 0x16, 0xf6, 0x25, 0xbe, 0xec, 0x91, 0xc2, 0x51, 
+0x21, 0xb5, 0x18, 0x40, 0xd5, 0x15, 0x33, 0xf9, 0x06, 0x71, 0xc0, 0x86, 0xe6, 0x32, 0xae, 0x68, 
+0x85, 0xed, 0x2c, 0xba, 0x65, 0xd3, 0xc1, 0x39, 0x85, 0xf8, 0xa6, 0x26, 0x03, 0xf7, 0xa9, 0x86, 
+0x58, 0xfe, 0x7c, 0xbd, 0x35, 0x4b, 0xb7, 0x9a, 0xd1, 0x2a, 0x4d, 0x11, 0xa8, 0x55, 0x72, 0x38, 
+0xc4, 0x98, 0x76, 0x2e, 0xa2, 0x05, 0x7f, 0xae, 0x45, 0x63, 0x87, 0x53, 0xa3, 0x3a, 0x73, 0x9e, 
+0xd8, 0x7b, 0x8f, 0xbe, 0x68, 0x97, 0xb7, 0x5e, 0x90, 0xdd, 0xaa, 0x22, 0x61, 0x97, 0xff, 0x06, 
+0xb6, 0x19, 0x9f, 0xde, 0x3c, 0x13, 0x27, 0x6e, 0xd6, 0x19, 0x44, 0xca, 0x5b, 0xbf, 0x4b, 0x0e, 
+0xc4, 0x2e, 0xd2, 0x13, 0x8e, 0xeb, 0x15, 0x5e, 0x40, 0xbf, 0x90, 0x7b, 0xca, 0x20, 0xe4, 0x00, 
+0xaa, 0x57, 0x11, 0xf3, 0x8a, 0x64, 0xd5, 0x27, 0x99, 0xe7, 0xc9, 0x07, 0xda, 0x24, 0xf7, 0x0e, 
+0x45, 0xf0, 0x58, 0x05, 0xf6, 0x4e, 0x20, 0xd1, 0x3f, 0x18, 0x54, 0xef, 0xb8, 0x12, 0x4a, 0xcc, 
+0x34, 0x59, 0x7d, 0x4c, 0x8e, 0xab, 0xf5, 0x9b, 0x51, 0xba, 0x91, 0xe9, 0x78, 0x2f, 0x92, 0xed, 
+0x6a, 0x9d, 0x50, 0xaa, 0x66, 0xc9, 0x28, 0x88, 0xee, 0x03, 0x62, 0xf5, 0x3c, 0x97, 0xb6, 0x65, 
+0xff, 0x82, 0xd8, 0x4d, 0xc5, 0x38, 0xfb, 0x56, 0x0e, 0x75, 0x32, 0xaa, 0x7c, 0x62, 0xcb, 0x89, 
+0xb0, 0x2a, 0xa0, 0xc9, 0x36, 0x87, 0xe9, 0x6b, 0xc2, 0x82, 0xa0, 0x3d, 0x7b, 0xd6, 0x8e, 0x6f, 
+0xac, 0xf8, 0xca, 0x0c, 0xe9, 0x5a, 0x78, 0x01, 0xe0, 0x2c, 0x68, 0x13, 0xa2, 0xdd, 0x1f, 0xb4, 
+0x3d, 0xdb, 0x1e, 0xe6, 0x3e, 0x7b, 0xa7, 0xd5, 0x70, 0xab, 0xdd, 0x19, 0x59, 0xd9, 0x85, 0x4a, 
+0x1a, 0x35, 0x9e, 0x23, 0xad, 0x13, 0x79, 0xa7, 0xdd, 0xb8, 0x4d, 0xfe, 0x19, 0x9c, 0x54, 0x35, 
+0xe6, 0x6c, 0x1b, 0xe2, 0x72, 0xae, 0x0e, 0xa3, 0x2e, 0xfc, 0x02, 0xc4, 0x2b, 0x59, 0x1d, 0xe4, 
+0x08, 0x93, 0x26, 0x6c, 0xb5, 0x30, 0xcc, 0x44, 0xb1, 0x80, 0xfc, 0x3e, 0x52, 0xbb, 0x63, 0x81, 
+0x05, 0x8d, 0x73, 0xbb, 0x0b, 0xfc, 0x53, 0x1a, 0x49, 0x32, 0x99, 0xbc, 0x77, 0x09, 0x2c, 0xeb, 
+0xb9, 0xcd, 0x6d, 0xea, 0x59, 0x92, 0xcd, 0x3f, 0x69, 0x20, 0x8d, 0xc3, 0x3e, 0xdf, 0xb7, 0x00, 
+0x7f, 0xc3, 0x43, 0x94, 0x57, 0x28, 0xd3, 0x4a, 0x92, 0x5a, 0x70, 0xe2, 0x96, 0xf7, 0xa4, 0x43, 
+0x62, 0xc1, 0x48, 0xd8, 0x97, 0x15, 0x87, 0xec, 0x5f, 0x0d, 0xa9, 0xc8, 0x88, 0x0b, 0xf4, 0x46, 
+0xce, 0xf9, 0x26, 0x5a, 0x99, 0x2f, 0x90, 0xbe, 0xf5, 0x83, 0x22, 0x46, 0xf2, 0xca, 0xa8, 0x70, 
+0x90, 0x41, 0x05, 0x83, 0xc0, 0x2e, 0xe7, 0x01, 0x9c, 0xed, 0x5f, 0x09, 0x71, 0x87, 0x26, 0xf9, 
+0xa4, 0x5a, 0xdc, 0x0a, 0xfe, 0xbc, 0x78, 0xed, 0x1e, 0xd9, 0xad, 0x48, 0x16, 0x6b, 0xc7, 0x81, 
+0x1b, 0xee, 0x77, 0x3a, 0xfe, 0x51, 0xb9, 0x25, 0x9f, 0xd7, 0x36, 0x6e, 0x24, 0xe3, 0x99, 0x2b, 
+0xad, 0x4e, 0xa3, 0xe8, 0xca, 0x64, 0xdd, 0x0e, 0x5b, 0xb1, 0xd1, 0x66, 0x8a, 0x36, 0x55, 0x11, 
+0xe3, 0x5f, 0xb0, 0xf9, 0x1c, 0x71, 0x4b, 0x81, 0xbf, 0x38, 0xd5, 0xa3, 0xef, 0x4f, 0xd0, 0x66, 
+0x39, 0x19, 0xb1, 0x85, 0x34, 0x9c, 0x05, 0x63, 0xc6, 0x37, 0x0c, 0x87, 0xb9, 0x39, 0x26, 0xe0, 
+0x50, 0xa6, 0x8c, 0x07, 0xa9, 0x67, 0xd2, 0x3e, 0x74, 0x1d, 0xf0, 0x96, 0xd1, 0x55, 0x75, 0xc4, 
+0x65, 0x14, 0x7e, 0x37, 0x02, 0x7c, 0xaa, 0x3a, 0x74, 0xe5, 0x05, 0x9b, 0x1c, 0xb5, 0xed, 0xa0, 
+0x21, 0xd4, 0x30, 0x51, 0x98, 0xd7, 0xb2, 0xf4, 0x27, 0x52, 0x7b, 0x1a, 0x34, 0xb1, 0x0c, 0x99, 
+0xe9, 0x75, 0xc6, 0x4d, 0x6d, 0xe4, 0x43, 0x8d, 0xa7, 0x7c, 0xee, 0xd1, 0x53, 0xf3, 0x8d, 0xb3, 
+0x6f, 0x30, 0xbe, 0x23, 0xe2, 0x80, 0x0f, 0xf5, 0x8b, 0xb5, 0x5c, 0x42, 0x11, 0xaa, 0x3b, 0x08, 
+0xef, 0x91, 0xdb, 0xc2, 0x4b, 0xf4, 0x23, 0xcc, 0x8e, 0x4e, 0x33, 0xfe, 0xd7, 0x60, 0x79, 0x46, 
+0x89, 0xc2, 0x6a, 0xa8, 0x10, 0x3a, 0x61, 0x0b, 0x93, 0xe1, 0xac, 0xca, 0x8f, 0x6a, 0xc1, 0x46, 
+0x8a, 0x2c, 0xf6, 0x12, 0xd1, 0xab, 0x18, 0xf5, 0x51, 0x20, 0x66, 0x9b, 0x10, 0x78, 0xd5, 0x03, 
+0xfb, 0xdc, 0x5d, 0xcc, 0x4a, 0x32, 0x9b, 0xc3, 0x4b, 0x03, 0xe1, 0x81, 0xbe, 0xf7, 0x8a, 0xd6, 
+0xb1, 0x3f, 0x1f, 0x6c, 0xb5, 0x98, 0x5e, 0xe9, 0x11, 0xc4, 0xab, 0x7c, 0x3d, 0x0a, 0xc7, 0x2b, 
+0xfb, 0x07, 0x7c, 0xdf, 0xf1, 0x8b, 0xc6, 0xa6, 0x70, 0x18, 0x63, 0x40, 0xfb, 0x25, 0xe2, 0x17, 
+0xd6, 0x5f, 0xa5, 0x92, 0x28, 0x61, 0xc4, 0x30, 0xd6, 0xb4, 0x40, 0xc2, 0x2f, 0x5e, 0xa0, 0x44, 
+0x87, 0x10, 0x9b, 0x71, 0xf7, 0xb3, 0x5f, 0x24, 0x6d, 0xcb, 0x9e, 0x28, 0x6f, 0x1a, 0x60, 0x26, 
+0x7a, 0x5a, 0xa2, 0xe4, 0x30, 0x15, 0x7f, 0x41, 0xa1, 0x6d, 0x1f, 0x54, 0xbc, 0x8c, 0xe6, 0xa2, 
+0x5a, 0xb7, 0x43, 0x27, 0x5c, 0x1e, 0x43, 0xff, 0x2f, 0xb7, 0xec, 0x02, 0x80, 0x55, 0x9f, 0x76, 
+0xb0, 0x03, 0x3e, 0x74, 0xdb, 0x48, 0x86, 0x6c, 0x95, 0x00, 0xff, 0x8a, 0xe7, 0xb1, 0x1e, 0xc5, 
+0x56, 0xaf, 0x3b, 0x1b, 0x85, 0x05, 0xd9, 0xed, 0x92, 0x37, 0xfd, 0x51, 0xd3, 0xa1, 0xeb, 0x4c, 
+0xc6, 0xff, 0x0c, 0x88, 0x51, 0xf8, 0xba, 0xdb, 0x2a, 0xef, 0xd0, 0x98, 0xf5, 0x17, 0x4a, 0x6c, 
+0x1d, 0xd8, 0x85, 0xb2, 0x9b, 0xcd, 0x7e, 0x57, 0xd7, 0x88, 0x4e, 0x9b, 0xda, 0xbb, 0x36, 0xf5, 
+0x4c, 0xc5, 0xe8, 0xb5, 0x0a, 0xfb, 0xbd, 0x15, 0xe2, 0x5c, 0x7a, 0x1a, 0x4a, 0xd8, 0x73, 0x2d, 
+0xe0, 0x7b, 0xbd, 0xea, 0x56, 0xa6, 0x41, 0x79, 0x16, 0xb0, 0x65, 0x09, 0x8f, 0x32, 0xb6, 0x00, 
+0x93, 0x37, 0xab, 0xd7, 0x75, 0x9d, 0x08, 0x68, 0x4f, 0x86, 0x01, 0x63, 0x2f, 0x77, 0xaf, 0xcf, 
+0x91, 0x35, 0xeb, 0x0d, 0x69, 0xe2, 0x06, 0xa0, 0x16, 0x3b, 0xd0, 0x23, 0x6b, 0x10, 0x8e, 0x1f, 
+0x68, 0x88, 0x2d, 0x59, 0x80, 0x25, 0x9a, 0x3d, 0xae, 0x29, 0xcf, 0xa8, 0x67, 0x07, 0x8f, 0xf2, 
+0x0b, 0x49, 0x28, 0xd5, 0x8f, 0x2d, 0xba, 0xd0, 0x4f, 0xe4, 0x7e, 0xc4, 0x46, 0xdf, 0x6c, 0x82, 
+0xe1, 0x22, 0x69, 0x44, 0x1a, 0xce, 0x3a, 0x8f, 0xcb, 0xb4, 0x44, 0xd9, 0xb8, 0xe2, 0x3b, 0x06, 
+0xf7, 0x55, 0x73, 0xc4, 0x4d, 0x34, 0xb3, 0xeb, 0x64, 0xbe, 0x79, 0xa7, 0xf8, 0x47, 0xd7, 0xab, 
+0xeb, 0x0e, 0xd0, 0xa2, 0xec, 0x50, 0xcf, 0x75, 0xf4, 0x4e, 0x85, 0x35, 0xee, 0xbb, 0x3f, 0xa2, 
+0x6c, 0xc3, 0x9f, 0x60, 0x11, 0xf4, 0x6b, 0x0a, 0xa2, 0x32, 0x1c, 0xf1, 0xa8, 0x10, 0x58, 0xcc, 
+0x41, 0xb3, 0xf0, 0xc1, 0x5e, 0xe6, 0xad, 0x24, 0xfa, 0x18, 0x7a, 0x8f, 0x21, 0x59, 0x9c, 0x80, 
+0xbe, 0x17, 0xa8, 0x29, 0xfa, 0x94, 0x70, 0x22, 0x8c, 0xf2, 0x09, 0x59, 0x32, 0xc7, 0x74, 0x53, 
+0x39, 0x95, 0x6e, 0x3f, 0x13, 0xb3, 0x66, 0x07, 0x93, 0xc6, 0x0d, 0xd9, 0x97, 0x20, 0x5d, 0xcf, 
+0x8b, 0x16, 0xff, 0x80, 0x3a, 0xc9, 0x99, 0x5a, 0xda, 0x88, 0xbb, 0x56, 0x28, 0x8a, 0xfa, 0x17, 
+0x9c, 0x79, 0x0a, 0x8e, 0x2b, 0x7f, 0x49, 0x6f, 0xa1, 0x5f, 0x31, 0xf1, 0xa4, 0x12, 0xed, 0x45, 
+0x65, 0x95, 0xd2, 0x7d, 0x10, 0xba, 0x52, 0xd6, 0x37, 0x4b, 0xaf, 0xdc, 0x85, 0x9d, 0x03, 0xbf, 
+0xde, 0x20, 0xf5, 0xc2, 0x8c, 0xdc, 0x34, 0xe3, 0x24, 0x63, 0xac, 0x6e, 0x4b, 0x81, 0xf7, 0x30, 
+};
@@ -0,0 +1,1256 @@
+// Generated by native/tiles (pio run -e tiles -t exec), do not edit.
+// 200 x 200 texels, row by row.
+// Two 4 bit levels a byte, the first texel in the high nibble; see MetaBallTables.h.
+
+const unsigned char BlueNoisePacked[] PROGMEM = {
+0x43, 0xc0, 0x29, 0xfd, 0xb4, 0xe9, 0xcf, 0x83, 0xd9, 0xad, 0xb7, 0xeb, 0x2c, 0x86, 0x32, 0x16, 
+0xe5, 0x29, 0xef, 0xc4, 0x5d, 0x85, 0xc6, 0x94, 0x70, 0x92, 0xd9, 0xf0, 0x3a, 0x25, 0x9b, 0x80, 
+0xa3, 0xfc, 0x29, 0x6c, 0xb6, 0x47, 0x9c, 0xe4, 0x0f, 0x80, 0xf9, 0x5e, 0x18, 0x2d, 0x59, 0x1d, 
+0x5f, 0xac, 0x63, 0xac, 0x64, 0x8a, 0x14, 0xa8, 0xad, 0x12, 0x5a, 0x84, 0xb6, 0xe0, 0x3f, 0x04, 
+0xe9, 0x38, 0x61, 0x48, 0x50, 0x49, 0xb3, 0x0b, 0xe2, 0x5c, 0xea, 0xec, 0x25, 0xa6, 0xf0, 0x78, 
+0x5f, 0xc5, 0x28, 0x39, 0x56, 0x24, 0x2f, 0xa4, 0x2a, 0xc1, 0x3c, 0x72, 0xfd, 0xc9, 0x24, 0x02, 
+0x8f, 0x63, 0xb1, 0xce, 0xe6, 0x8f, 0x3c, 0x85, 0x70, 0x28, 0x31, 0xc6, 0xb1, 0x35, 0x14, 0x16, 
+0xd4, 0x1a, 0xfc, 0xad, 0x8b, 0xc8, 0x14, 0x6a, 0x1a, 0x0f, 0xd2, 0xac, 0x3d, 0xea, 0x72, 0x5b, 
+0x74, 0xfd, 0x37, 0x2e, 0xb8, 0x15, 0xd0, 0xf4, 0x72, 0xfb, 0x35, 0x6b, 0x8b, 0x63, 0x27, 0xb9, 
+0xca, 0xe8, 0x0c, 0xb7, 0xa3, 0x48, 0x12, 0xf8, 0x31, 0xef, 0x9c, 0xe0, 0x28, 0x9f, 0xe3, 0x10, 
+0x63, 0xac, 0x5a, 0xb8, 0x7d, 0xcf, 0xa2, 0xdf, 0x7e, 0xa1, 0x78, 0x94, 0x79, 0x61, 0xb5, 0x39, 
+0x7f, 0xc1, 0xb4, 0xc2, 0x69, 0xd7, 0xbc, 0x6f, 0x0a, 0x8e, 0x86, 0xcd, 0x16, 0x35, 0x90, 0xd4, 
+0x37, 0x05, 0xd6, 0xf5, 0x7a, 0xbd, 0x85, 0x6b, 0xa7, 0x1a, 0x59, 0x13, 0xfa, 0xc5, 0xbe, 0x25, 
+0x7e, 0x86, 0xfc, 0x90, 0x8f, 0x62, 0xe8, 0x42, 0x30, 0xe4, 0xbd, 0x83, 0xbf, 0x28, 0x47, 0x0f, 
+0x68, 0x54, 0xc1, 0xe8, 0xe1, 0xb8, 0x61, 0xd5, 0x96, 0xea, 0x7b, 0x3e, 0x09, 0xd1, 0xe2, 0xad, 
+0x14, 0xac, 0x6e, 0x41, 0x37, 0x24, 0xaf, 0x30, 0xe8, 0x1e, 0xc7, 0x49, 0xdb, 0x50, 0x64, 0x2f, 
+0x5c, 0x60, 0x4c, 0x7d, 0xd1, 0xf7, 0x2d, 0x61, 0x35, 0x02, 0xe7, 0x50, 0x28, 0xdf, 0x5e, 0xd6, 
+0xd0, 0xf8, 0x27, 0x0d, 0x43, 0x05, 0x85, 0xea, 0xb0, 0x31, 0x40, 0xd3, 0xcd, 0x14, 0xb0, 0x3e, 
+0x8b, 0xfd, 0x7a, 0x6b, 0x81, 0xaf, 0x49, 0xab, 0x14, 0x02, 0x9f, 0x30, 0x3d, 0x52, 0xed, 0xb6, 
+0x28, 0xe4, 0x69, 0xa0, 0xf4, 0xc2, 0xa3, 0x7e, 0xa3, 0x9c, 0x15, 0x7f, 0xa6, 0x97, 0x26, 0x0e, 
+0x75, 0x96, 0xbe, 0x1b, 0x2c, 0x0b, 0x84, 0xca, 0x36, 0x90, 0xfc, 0xa1, 0x4d, 0x04, 0x62, 0x8a, 
+0x58, 0x47, 0x90, 0x8f, 0x72, 0xeb, 0x1a, 0xd6, 0xf5, 0xd0, 0x67, 0x2c, 0x6d, 0xb5, 0x9b, 0xe0, 
+0x57, 0xa2, 0xdb, 0x86, 0xb3, 0x7b, 0x96, 0xfb, 0x98, 0x49, 0x14, 0xe9, 0xcb, 0x64, 0x9b, 0x39, 
+0xb6, 0x34, 0x02, 0x1a, 0x53, 0xb4, 0xce, 0x6a, 0xb7, 0xae, 0xd2, 0x71, 0x4e, 0xb7, 0xf9, 0x82, 
+0x75, 0x9f, 0x6a, 0x75, 0x90, 0x62, 0xbf, 0x2c, 0xe6, 0xc2, 0x70, 0x3e, 0xc9, 0xf5, 0xa1, 0xc7, 
+0x1b, 0xea, 0x70, 0x4e, 0xc9, 0x0d, 0x14, 0xd8, 0x3b, 0x08, 0xeb, 0x54, 0x2c, 0x74, 0xb8, 0x0c, 
+0xb4, 0xd0, 0xaf, 0xc3, 0x8c, 0x03, 0xd5, 0xa4, 0x86, 0x19, 0xf7, 0x25, 0x0c, 0x5b, 0x37, 0x4f, 
+0xb2, 0x8c, 0xf5, 0xd2, 0xce, 0x1c, 0xb5, 0x43, 0xc0, 0x95, 0x38, 0x30, 0x8b, 0x9f, 0xb5, 0xe9, 
+0x40, 0x73, 0x06, 0x32, 0xaf, 0x38, 0x5e, 0x71, 0xad, 0x2e, 0x28, 0x35, 0x25, 0xce, 0xb6, 0xc0, 
+0xf3, 0x9d, 0x71, 0xdf, 0xc1, 0x9b, 0xac, 0x7f, 0x2a, 0xe9, 0x1b, 0x28, 0x1f, 0x86, 0xb3, 0x9f, 
+0x76, 0x92, 0xa5, 0xe4, 0xbe, 0x31, 0xc2, 0xe4, 0x2c, 0xe4, 0x15, 0x70, 0x35, 0x9e, 0xbd, 0x86, 
+0x15, 0x7d, 0x4e, 0x85, 0x68, 0x04, 0x62, 0xa9, 0x35, 0x37, 0xf6, 0xc7, 0x5d, 0xa6, 0x51, 0xd7, 
+0xf5, 0x1e, 0x6d, 0x92, 0x16, 0xf3, 0xb5, 0x91, 0xb4, 0xea, 0x27, 0x9e, 0xcd, 0xf3, 0x60, 0xaf, 
+0xd7, 0xe2, 0xe9, 0x16, 0xe7, 0xa1, 0xb9, 0x81, 0x6a, 0x37, 0x3e, 0xd9, 0x6d, 0x7f, 0x09, 0xfc, 
+0xa2, 0x43, 0xc2, 0x81, 0xa6, 0xf9, 0xcf, 0x8d, 0x8c, 0x0c, 0x19, 0x34, 0xf0, 0x54, 0xd1, 0xa0, 
+0xf7, 0x13, 0xa8, 0x25, 0xa7, 0x2f, 0x04, 0x85, 0x74, 0xd6, 0xf8, 0x4c, 0x85, 0x06, 0x48, 0xf5, 
+0x3c, 0x24, 0x08, 0xdc, 0x32, 0xde, 0x4c, 0x19, 0x60, 0xa8, 0x6b, 0x1f, 0xa7, 0x8b, 0x93, 0xe9, 
+0xd8, 0x35, 0x14, 0xa2, 0xdb, 0x82, 0x61, 0x9e, 0xd2, 0x9c, 0xe8, 0xf1, 0x7b, 0xe9, 0xb0, 0xc2, 
+0x91, 0xf3, 0xb2, 0x90, 0xad, 0x80, 0xb3, 0xf9, 0x5a, 0x85, 0xe8, 0x62, 0xfa, 0x68, 0xf1, 0x63, 
+0x05, 0xa4, 0xde, 0x83, 0x1a, 0x47, 0x5c, 0x39, 0x05, 0x3e, 0x60, 0x4f, 0xd0, 0x9f, 0x6a, 0x18, 
+0x2b, 0x4a, 0xd5, 0x46, 0x1d, 0x81, 0x96, 0xfd, 0x3d, 0x2a, 0x15, 0xb3, 0x14, 0x6b, 0xf4, 0xcd, 
+0x89, 0xca, 0xf6, 0xbc, 0x8b, 0xe6, 0x09, 0xf7, 0x1d, 0xb5, 0xae, 0x2a, 0x2e, 0x81, 0x25, 0x90, 
+0xd9, 0xf3, 0xd9, 0x0d, 0xc1, 0x9b, 0xf4, 0x15, 0xa8, 0x05, 0x70, 0xa3, 0xec, 0x2f, 0x4d, 0x95, 
+0xc3, 0x16, 0xfc, 0x46, 0xb0, 0xfc, 0x7c, 0x4f, 0x73, 0xc0, 0xbd, 0x30, 0xb5, 0xf4, 0xb6, 0x25, 
+0xd0, 0x42, 0xa3, 0x5f, 0x70, 0xe6, 0x8c, 0xf8, 0x36, 0xe4, 0xa1, 0x57, 0xe2, 0xc1, 0x40, 0xad, 
+0x15, 0x0c, 0x4b, 0xe9, 0x38, 0x17, 0xb1, 0x56, 0xc9, 0x1b, 0x0a, 0xe8, 0xbd, 0x94, 0x2c, 0xb7, 
+0x3b, 0x5c, 0x20, 0x8f, 0xc3, 0x16, 0x2b, 0xe7, 0x4b, 0x6e, 0xa4, 0x29, 0x5b, 0x84, 0xd6, 0x97, 
+0xf9, 0xe7, 0x60, 0xe2, 0x6b, 0x27, 0x18, 0x5e, 0x24, 0xa4, 0xc2, 0xdb, 0x40, 0x83, 0xc9, 0x6b, 
+0x0f, 0xa5, 0xed, 0x63, 0xb2, 0x7c, 0xa2, 0x64, 0xa7, 0x5d, 0x7c, 0x62, 0xfb, 0xd9, 0xbf, 0x6d, 
+0x95, 0x7b, 0x03, 0x80, 0xe5, 0xd2, 0x8a, 0x18, 0xc4, 0x2a, 0x1e, 0x80, 0xa1, 0xf9, 0x85, 0xb7, 
+0x17, 0x13, 0x0d, 0x9e, 0x8c, 0x6d, 0x81, 0xea, 0xb4, 0x82, 0xa0, 0x64, 0xbc, 0x92, 0x7e, 0xc4, 
+0x0a, 0xd7, 0x9c, 0xf7, 0x38, 0xd9, 0x52, 0xd7, 0xce, 0xb5, 0x29, 0xae, 0x25, 0xf8, 0xd6, 0x25, 
+0x2f, 0x0a, 0x8f, 0x52, 0xd8, 0x19, 0x7e, 0x46, 0x5e, 0x9e, 0x83, 0x09, 0xcf, 0x07, 0xd0, 0xc7, 
+0x01, 0xe7, 0x0e, 0x2c, 0x53, 0x12, 0x98, 0xa5, 0x13, 0xe5, 0xd3, 0x41, 0x90, 0x8f, 0x73, 0x58, 
+0xa6, 0xe5, 0x71, 0xd5, 0x94, 0x2c, 0x3a, 0x1f, 0x4a, 0x15, 0x1f, 0xb8, 0xe3, 0xf0, 0x3a, 0xe9, 
+0x14, 0x63, 0x82, 0x48, 0x31, 0x69, 0xea, 0x62, 0xb7, 0x9d, 0x05, 0xf2, 0x5e, 0x79, 0x26, 0xb9, 
+0x5c, 0x46, 0xe2, 0xfd, 0xed, 0xa8, 0x7b, 0x23, 0xa1, 0xaf, 0x75, 0x96, 0x2c, 0x5d, 0xe3, 0x7d, 
+0x21, 0x3f, 0xa8, 0x1b, 0xf6, 0x3e, 0x26, 0x4a, 0xce, 0x13, 0x7a, 0x81, 0x42, 0x7f, 0xc3, 0x7c, 
+0x0e, 0x93, 0x41, 0xc8, 0xb4, 0xc6, 0xe3, 0x9a, 0xe6, 0x4f, 0xda, 0x3b, 0xa0, 0x74, 0xad, 0x1a, 
+0x52, 0x83, 0xa5, 0xe6, 0xfa, 0x5c, 0x3b, 0x80, 0xe8, 0xbd, 0xc3, 0x7b, 0xdc, 0x80, 0xba, 0x7f, 
+0xbd, 0x62, 0xae, 0x0d, 0x2f, 0xc2, 0xa4, 0xf3, 0xc8, 0x79, 0x07, 0x8c, 0x7d, 0xb8, 0x4e, 0x52, 
+0x0b, 0x49, 0x26, 0x0c, 0x7e, 0x03, 0xd6, 0xe0, 0xcf, 0xd3, 0x1c, 0x4a, 0xf1, 0x4b, 0x49, 0xd1, 
+0x6e, 0xb4, 0xad, 0x52, 0x7e, 0x37, 0x1a, 0x07, 0x49, 0x5f, 0xd4, 0x7f, 0x56, 0x24, 0xc2, 0xd0, 
+0x4f, 0x90, 0x5a, 0xbe, 0x5d, 0x76, 0x05, 0xd2, 0x79, 0x5a, 0xb3, 0x90, 0x57, 0xbc, 0xf6, 0x0f, 
+0x9a, 0x0d, 0x40, 0xf6, 0x47, 0x6d, 0xbf, 0x7e, 0x36, 0x71, 0xb0, 0x41, 0x72, 0xb0, 0x58, 0x12, 
+0xfd, 0x2c, 0x6f, 0x46, 0xeb, 0x15, 0xf2, 0xb8, 0x49, 0x2d, 0x97, 0x46, 0xba, 0x40, 0xf5, 0x1f, 
+0x96, 0xa2, 0xf9, 0x0c, 0x65, 0xe0, 0xc6, 0x94, 0x83, 0x90, 0xdb, 0x80, 0xb1, 0xdf, 0x5b, 0xe5, 
+0x32, 0xf6, 0xc7, 0x39, 0xd6, 0xc7, 0xd8, 0xb4, 0x5c, 0x9a, 0xe1, 0xa9, 0xb2, 0x78, 0x5f, 0xd2, 
+0x8c, 0x6f, 0x27, 0xca, 0x39, 0x15, 0xf0, 0x3e, 0xc0, 0xbd, 0x9c, 0x45, 0xc3, 0x0c, 0x61, 0xc0, 
+0xbd, 0x90, 0xb9, 0xfb, 0x71, 0xb8, 0x62, 0x18, 0x79, 0xfb, 0xc3, 0x96, 0xc0, 0x1f, 0x81, 0xcf, 
+0x24, 0x60, 0xa4, 0xd5, 0xc6, 0x49, 0x7a, 0x82, 0xbc, 0x02, 0x95, 0x09, 0x1c, 0xe2, 0xa6, 0xdc, 
+0xfb, 0x69, 0x3c, 0xd8, 0x75, 0x39, 0x07, 0xc2, 0x84, 0xdc, 0x79, 0x13, 0xd0, 0x65, 0x1f, 0xd3, 
+0x1d, 0x58, 0x6a, 0xd2, 0x04, 0x3d, 0x65, 0x28, 0x31, 0xb4, 0x93, 0xe1, 0xb7, 0x5e, 0x62, 0x57, 
+0xe6, 0x42, 0xa1, 0x2a, 0x07, 0x92, 0x0a, 0xcf, 0x58, 0x13, 0xf5, 0xe3, 0xa2, 0xf7, 0x5c, 0x43, 
+0x6e, 0x4a, 0x07, 0x90, 0x53, 0xea, 0x0b, 0x38, 0xb0, 0xd7, 0xc8, 0xa7, 0x49, 0x85, 0x3c, 0x6f, 
+0x68, 0x72, 0x3a, 0x95, 0xc1, 0xf6, 0x73, 0x48, 0x6e, 0x3d, 0xfc, 0x4a, 0x03, 0x42, 0x8e, 0x5f, 
+0x4d, 0xd5, 0x6e, 0xa7, 0xd9, 0xe8, 0x1b, 0x38, 0x2e, 0x3e, 0x1b, 0xe1, 0x9f, 0x3a, 0x84, 0xda, 
+0x58, 0x95, 0xf8, 0x93, 0x50, 0xde, 0x26, 0xf0, 0x4b, 0xed, 0x2a, 0x8e, 0x0a, 0x90, 0x6d, 0x4c, 
+0x7e, 0xbe, 0x2b, 0x59, 0xf7, 0x2e, 0x1c, 0x48, 0x7e, 0xb7, 0xc4, 0xed, 0x97, 0xac, 0x71, 0x6c, 
+0xf0, 0xa8, 0x4b, 0xe9, 0x2a, 0xc7, 0xe6, 0x48, 0xce, 0xb5, 0xe6, 0x14, 0x2a, 0xec, 0x17, 0x08, 
+0xd6, 0x40, 0x27, 0xf8, 0x50, 0xbe, 0x4b, 0x3a, 0xd7, 0x18, 0x6e, 0x16, 0xf5, 0x82, 0x41, 0xbf, 
+0x16, 0x2f, 0x18, 0x2d, 0x1d, 0xeb, 0x8f, 0xe3, 0x78, 0x4a, 0xd0, 0xe2, 0xc9, 0x42, 0x58, 0xfc, 
+0x5e, 0xc0, 0x7a, 0x12, 0xa8, 0x3a, 0x03, 0x46, 0x0b, 0x94, 0xf6, 0xa7, 0x0b, 0x85, 0xc3, 0x65, 
+0xd4, 0x5d, 0xe6, 0x2f, 0x40, 0xd3, 0x1c, 0x26, 0xa8, 0x4a, 0x7a, 0x59, 0xc7, 0x16, 0x53, 0xb5, 
+0x37, 0xf4, 0x3a, 0x0f, 0xa2, 0x48, 0x7a, 0x60, 0xb4, 0x93, 0x7b, 0x5e, 0xc9, 0x10, 0x8a, 0x0b, 
+0x1f, 0x25, 0xfd, 0xa8, 0x42, 0xd3, 0xc1, 0xa3, 0xd4, 0x80, 0xc9, 0xdf, 0x16, 0x4d, 0x39, 0xbd, 
+0x79, 0x62, 0x9a, 0xbf, 0x13, 0xbd, 0x9b, 0x0d, 0xca, 0x71, 0xd8, 0xf6, 0x4e, 0xb2, 0x5d, 0x94, 
+0x2c, 0xea, 0xf6, 0x5c, 0x3d, 0xeb, 0xa5, 0xea, 0xb3, 0x51, 0xd6, 0x42, 0xa3, 0xe2, 0x6c, 0x5a, 
+0x06, 0xba, 0x09, 0x62, 0x79, 0xa6, 0xc4, 0xeb, 0x76, 0x2c, 0x9f, 0xb8, 0x2d, 0x31, 0xd2, 0xcf, 
+0x5d, 0x91, 0xaf, 0x29, 0xb7, 0x80, 0xb1, 0xc7, 0xb2, 0xe9, 0x5d, 0x4f, 0xe1, 0x3e, 0x0b, 0x2e, 
+0x13, 0xb8, 0xfc, 0x1e, 0xad, 0x15, 0xec, 0x68, 0x5c, 0x0d, 0x32, 0xc8, 0x5c, 0xec, 0x5f, 0x20, 
+0x65, 0x2f, 0xd5, 0x76, 0x4d, 0x80, 0x35, 0x07, 0xa5, 0xb6, 0x08, 0x5f, 0x06, 0xe3, 0x51, 0xb7, 
+0x38, 0xa0, 0xc5, 0x80, 0xe3, 0x0f, 0x46, 0x25, 0x9e, 0x8c, 0x64, 0x92, 0x3f, 0x26, 0x91, 0x5c, 
+0x90, 0xa4, 0xd3, 0xb8, 0xe6, 0x03, 0x9d, 0x09, 0xa7, 0x47, 0x0c, 0x40, 0x7a, 0x94, 0x29, 0x0b, 
+0xe6, 0x91, 0xf9, 0xb4, 0xd2, 0xe7, 0xe3, 0xb0, 0xd5, 0x1f, 0x25, 0x93, 0x0f, 0xbe, 0x72, 0x5e, 
+0x17, 0xc5, 0x79, 0x46, 0x1c, 0x64, 0x70, 0x8e, 0x02, 0xe4, 0xa6, 0x39, 0xe6, 0xa7, 0x1a, 0x70, 
+0xb6, 0x7c, 0x54, 0x8a, 0x69, 0xd0, 0x92, 0x76, 0x2c, 0x8b, 0x92, 0x83, 0x19, 0x6f, 0xb0, 0xef, 
+0x26, 0x18, 0x07, 0xa3, 0xbd, 0x8a, 0x32, 0xf9, 0x3a, 0x6c, 0x9b, 0x2e, 0xe1, 0x9f, 0xe7, 0xc2, 
+0x97, 0xba, 0x48, 0x25, 0xbf, 0x27, 0xe2, 0xf4, 0x6c, 0x8b, 0xdd, 0x7c, 0x47, 0x15, 0x1f, 0x86, 
+0xb4, 0x8d, 0x3c, 0x07, 0x26, 0xf8, 0x97, 0x0d, 0x2a, 0x75, 0xb2, 0x73, 0xe5, 0x19, 0x3f, 0x7b, 
+0x20, 0xf7, 0xcd, 0x57, 0xd0, 0xc5, 0x83, 0x17, 0xf8, 0x51, 0x4d, 0x7e, 0x4a, 0x3d, 0x8b, 0xd6, 
+0xc4, 0x14, 0x50, 0xad, 0xa6, 0xfa, 0x1e, 0x08, 0xa3, 0x2e, 0xb9, 0xc4, 0x6a, 0xc2, 0x8f, 0x08, 
+0x15, 0xc3, 0xfc, 0xb5, 0x39, 0xf2, 0x9d, 0xf0, 0x5f, 0x45, 0xc4, 0xf9, 0x05, 0x37, 0x04, 0xdb, 
+0xeb, 0x38, 0x59, 0x47, 0x3a, 0xfb, 0x49, 0xdf, 0x94, 0xe6, 0xc6, 0xbd, 0x05, 0xe1, 0xe7, 0xc9, 
+0x3c, 0x74, 0x24, 0xb5, 0xd2, 0x1f, 0x9d, 0xe0, 0x9d, 0x6a, 0x93, 0xca, 0x1b, 0x57, 0x13, 0x1f, 
+0xa2, 0xbe, 0x3a, 0xd5, 0xe0, 0x7b, 0x5e, 0xaf, 0x8d, 0x30, 0xc1, 0xf6, 0x5b, 0x41, 0xec, 0x4f, 
+0x0b, 0xcd, 0x29, 0x31, 0xdd, 0xa6, 0x81, 0xf3, 0x84, 0xfa, 0x2e, 0xc4, 0xb1, 0xac, 0x92, 0xa1, 
+0x8f, 0xb7, 0x1e, 0x08, 0x9e, 0x98, 0xdc, 0x73, 0x40, 0x94, 0xd6, 0xbd, 0x9f, 0xb6, 0x13, 0x5d, 
+0x3f, 0x6b, 0x4d, 0xba, 0x4f, 0x08, 0x24, 0x18, 0xdc, 0x51, 0xb7, 0x1c, 0x7d, 0xa2, 0x7b, 0x3d, 
+0xaf, 0xe6, 0xcf, 0x70, 0x5d, 0x49, 0x16, 0xbd, 0x90, 0x75, 0x2c, 0x71, 0x27, 0x01, 0x94, 0x1e, 
+0x78, 0xb4, 0x62, 0x50, 0x46, 0x0a, 0xd9, 0x1e, 0x8c, 0x65, 0x0c, 0x5a, 0x34, 0x1e, 0x51, 0x79, 
+0x3f, 0x92, 0xea, 0x58, 0x06, 0x97, 0xa4, 0x02, 0xac, 0x1f, 0x28, 0x64, 0x1b, 0x7e, 0x5b, 0x4a, 
+0x0c, 0xf8, 0x3a, 0x96, 0x82, 0xf6, 0x85, 0xb8, 0x81, 0x42, 0xe4, 0xa7, 0xa1, 0x76, 0xd5, 0x90, 
+0x63, 0xd4, 0xf6, 0xb5, 0xc2, 0x04, 0x95, 0x24, 0xc3, 0x60, 0xa3, 0xf8, 0x2e, 0x73, 0xb2, 0x52, 
+0x41, 0x79, 0xdf, 0xa2, 0x91, 0x70, 0x72, 0x53, 0xd9, 0xb6, 0xd9, 0x6f, 0x40, 0x6a, 0xe2, 0x49, 
+0x32, 0x08, 0xe1, 0x58, 0x72, 0x19, 0x3a, 0x82, 0xa7, 0x0e, 0xcf, 0x12, 0xc4, 0xda, 0xe0, 0x65, 
+0xba, 0xeb, 0xcf, 0x52, 0xa1, 0x38, 0xda, 0xfb, 0x8f, 0xc2, 0xf6, 0x73, 0x04, 0xea, 0x73, 0x86, 
+0xeb, 0x73, 0x8f, 0xd2, 0x7d, 0x04, 0xc9, 0x6e, 0xbd, 0xf0, 0x6c, 0xe8, 0x64, 0xc9, 0x41, 0xdb, 
+0x5c, 0x2a, 0x4e, 0x78, 0xe1, 0x97, 0xd1, 0x52, 0xd3, 0x70, 0xae, 0xd6, 0xf6, 0x3b, 0x90, 0xc6, 
+0xe4, 0xc0, 0xb2, 0xaf, 0x8e, 0x70, 0x81, 0xe6, 0x95, 0xd7, 0xfc, 0xaf, 0x51, 0xbf, 0x56, 0x1d, 
+0x9b, 0xc1, 0x8e, 0x9c, 0x7e, 0x05, 0x47, 0x08, 0xb5, 0xdf, 0x9c, 0xe6, 0x71, 0xe3, 0x7c, 0x0a, 
+0x8e, 0x73, 0x8c, 0x6e, 0xb8, 0xf6, 0xda, 0x0c, 0x4a, 0xcb, 0x51, 0x5c, 0xf6, 0xb2, 0xa3, 0x85, 
+0x6c, 0x82, 0x3a, 0x8c, 0xf3, 0x65, 0x27, 0x8c, 0x4d, 0xf9, 0x05, 0x3d, 0x19, 0x35, 0x80, 0xea, 
+0x9b, 0x82, 0xd2, 0xf0, 0x92, 0xdc, 0x0b, 0x6b, 0x58, 0x6b, 0xf1, 0xc3, 0x42, 0x3c, 0x51, 0xb9, 
+0xf3, 0x75, 0xaf, 0x39, 0x71, 0xf8, 0x21, 0xd2, 0x53, 0xb6, 0x4f, 0x9e, 0xba, 0x4c, 0x15, 0x23, 
+0x8a, 0xcf, 0x75, 0xd2, 0x0e, 0x93, 0x84, 0x7d, 0x25, 0xac, 0xd9, 0x30, 0xe2, 0x9b, 0x33, 0x81, 
+0xb7, 0xe9, 0x4c, 0xb0, 0x56, 0xf4, 0x6f, 0x71, 0xda, 0xc8, 0xeb, 0xd6, 0xe4, 0xa3, 0x41, 0x8a, 
+0x09, 0x5b, 0x1f, 0x42, 0xd1, 0xca, 0x0d, 0x90, 0x5d, 0x93, 0x4b, 0xf3, 0xd5, 0x83, 0xf9, 0xd3, 
+0x18, 0x4e, 0x57, 0xda, 0xe9, 0x0f, 0xb6, 0xe3, 0x19, 0x8d, 0x39, 0x0e, 0x6b, 0x71, 0xec, 0x79, 
+0x6e, 0xb2, 0x7b, 0xc5, 0xf5, 0x0e, 0x9b, 0x4c, 0x45, 0x96, 0xa2, 0x4e, 0x1e, 0x37, 0x58, 0x0a, 
+0x79, 0x58, 0xf3, 0x75, 0x0d, 0xbe, 0x0c, 0x62, 0xea, 0x46, 0xc9, 0xa6, 0xc9, 0xe2, 0x0b, 0x37, 
+0x06, 0xcf, 0x47, 0xd9, 0x4e, 0x06, 0x1e, 0x8b, 0x38, 0xb5, 0xfd, 0x03, 0xb9, 0x12, 0x54, 0xbc, 
+0xa4, 0x6e, 0x17, 0xe6, 0xd3, 0x08, 0x2e, 0x78, 0x42, 0xa0, 0x93, 0x04, 0x63, 0x26, 0x13, 0x41, 
+0xe2, 0x86, 0xe9, 0x3d, 0x4f, 0x3a, 0x27, 0xb5, 0x69, 0x4f, 0x54, 0x2a, 0x74, 0x1c, 0x72, 0x79, 
+0x1e, 0x07, 0xd0, 0x7b, 0xe3, 0xd8, 0x03, 0xb0, 0x16, 0x35, 0x94, 0x07, 0x5b, 0x0c, 0xfa, 0x4b, 
+0x02, 0x93, 0x58, 0x14, 0xc0, 0x7d, 0xa4, 0x32, 0x61, 0xc3, 0x61, 0x8b, 0x7f, 0x14, 0xe7, 0x90, 
+0xac, 0x90, 0xd4, 0xf6, 0xec, 0x1b, 0xa4, 0xe1, 0xa8, 0x12, 0x8a, 0x74, 0xd8, 0x0d, 0xe0, 0x3f, 
+0x14, 0x7d, 0x8c, 0x62, 0xf1, 0x83, 0x9a, 0xf2, 0x15, 0xb9, 0x43, 0x69, 0xf6, 0x2a, 0x1b, 0x86, 
+0xe4, 0xa7, 0xf8, 0x17, 0xf8, 0x0c, 0x59, 0x04, 0xa9, 0x4d, 0x51, 0x9f, 0xc1, 0xd7, 0xcb, 0xda, 
+0x9e, 0xb9, 0xfc, 0x99, 0x7c, 0x0b, 0x15, 0xf2, 0xbc, 0x86, 0xd8, 0xe3, 0xb8, 0x02, 0xb7, 0xcf, 
+0x2c, 0xb0, 0x8e, 0x46, 0xb4, 0x82, 0xa6, 0x49, 0x06, 0x9a, 0xc6, 0xf9, 0x4e, 0xbd, 0x1c, 0xf9, 
+0xde, 0x14, 0x51, 0x68, 0xf5, 0x7c, 0xda, 0xf2, 0xa5, 0x39, 0xe0, 0xf8, 0xca, 0xd8, 0x5f, 0x3e, 
+0x0a, 0x3c, 0xb5, 0xf8, 0x64, 0x2e, 0xa9, 0x2b, 0x16, 0xf7, 0x0d, 0x8c, 0x5f, 0x46, 0xb3, 0xf0, 
+0x6b, 0x37, 0x58, 0x6d, 0x80, 0xfa, 0x3e, 0xa5, 0xda, 0x7e, 0x06, 0x47, 0x87, 0xd2, 0xaf, 0xc1, 
+0x5d, 0x0c, 0x64, 0x9c, 0x0f, 0x6d, 0x2b, 0x62, 0x5b, 0x82, 0xad, 0xfb, 0x2f, 0x6c, 0xab, 0x34, 
+0xda, 0x8e, 0x52, 0x8f, 0x50, 0x71, 0x84, 0x6f, 0x3a, 0x6d, 0x7c, 0xa6, 0x17, 0x0e, 0x49, 0x0c, 
+0x1f, 0xd7, 0x9e, 0x15, 0x8e, 0x6f, 0x59, 0xa0, 0xcf, 0xac, 0xf2, 0xc8, 0x5f, 0x24, 0x19, 0x83, 
+0xc7, 0xa2, 0x86, 0xa2, 0x46, 0xa7, 0x8e, 0xd3, 0x9a, 0xf1, 0x36, 0x0d, 0x7f, 0xc1, 0x56, 0x9b, 
+0x04, 0x72, 0xda, 0x72, 0x69, 0xf8, 0x01, 0xd3, 0xdb, 0x81, 0x65, 0xc8, 0x4d, 0x36, 0x2b, 0x63, 
+0x9c, 0x9e, 0x51, 0xda, 0x25, 0xac, 0x2b, 0x93, 0xac, 0x46, 0x15, 0x09, 0x48, 0x52, 0xbc, 0x1b, 
+0xfc, 0x3e, 0x85, 0xa2, 0x97, 0xe3, 0xf2, 0xe3, 0x85, 0x1c, 0x3e, 0xad, 0x1f, 0x3d, 0x64, 0x73, 
+0x81, 0xe0, 0x7e, 0x06, 0x70, 0x53, 0x16, 0xd1, 0x3b, 0x4d, 0xc0, 0xb1, 0x52, 0xf4, 0x93, 0x08, 
+0x95, 0xfb, 0x14, 0x6a, 0x83, 0x5a, 0x36, 0xd3, 0xa2, 0x83, 0xd1, 0xe5, 0x37, 0x04, 0x53, 0xeb, 
+0x2d, 0xb6, 0xde, 0x52, 0xc0, 0x5f, 0x3e, 0x15, 0x83, 0xfc, 0x2b, 0x04, 0xc2, 0x4b, 0xa4, 0x9b, 
+0x58, 0x2a, 0xc3, 0xd5, 0xe3, 0xfb, 0x04, 0x9b, 0xd5, 0x72, 0xa6, 0x92, 0x05, 0xfc, 0x3e, 0x09, 
+0x25, 0x9e, 0xa4, 0xf0, 0x27, 0x03, 0xd8, 0x94, 0xcf, 0x19, 0xf4, 0x1e, 0x57, 0x29, 0xbd, 0x8f, 
+0x1b, 0xde, 0x38, 0xf3, 0x64, 0x91, 0xb0, 0x4e, 0x3a, 0x58, 0x97, 0x1b, 0xad, 0x79, 0x50, 0x74, 
+0x9a, 0x60, 0xeb, 0x16, 0xca, 0x52, 0x48, 0xd2, 0xfb, 0x3d, 0xab, 0x47, 0xce, 0x69, 0x35, 0xae, 
+0xc8, 0x90, 0x6f, 0x4c, 0xe3, 0xa2, 0x8d, 0xf2, 0x6c, 0x1d, 0x80, 0xb7, 0x0d, 0x4a, 0x72, 0xb8, 
+0xd2, 0x6d, 0x89, 0x07, 0xa0, 0x87, 0x30, 0xb6, 0x8d, 0x15, 0x97, 0xbd, 0xb0, 0x93, 0x5e, 0xa7, 
+0xd6, 0x08, 0xe7, 0xc3, 0x1e, 0x47, 0xe2, 0x71, 0x86, 0xa1, 0x5c, 0xf3, 0x0c, 0x4d, 0xe8, 0xcf, 
+0x7a, 0x64, 0x97, 0x5b, 0xea, 0x0c, 0x71, 0x8b, 0xe5, 0xf9, 0xb2, 0x0e, 0x72, 0x86, 0x0d, 0x6b, 
+0x0e, 0xbf, 0x47, 0x2c, 0x73, 0x06, 0x91, 0x5e, 0xa0, 0xd7, 0x6d, 0x87, 0xcf, 0x12, 0xbd, 0x56, 
+0x32, 0xf0, 0xb8, 0xfc, 0x27, 0xd4, 0x92, 0x9f, 0x37, 0x9f, 0xc5, 0x7a, 0x94, 0xe7, 0x9f, 0x09, 
+0x81, 0xa2, 0xfd, 0x82, 0x74, 0xcb, 0x2e, 0xb7, 0x2d, 0x67, 0xc5, 0x09, 0xe7, 0xaf, 0x24, 0xec, 
+0x6f, 0xb0, 0x9f, 0x41, 0xa9, 0xeb, 0x1c, 0x6e, 0x35, 0xf4, 0x9f, 0xa1, 0xf3, 0xab, 0xc0, 0x37, 
+0xf6, 0xc1, 0x86, 0x31, 0x8e, 0x6d, 0x25, 0x1f, 0x9b, 0x09, 0x81, 0xfb, 0xc2, 0x79, 0xe8, 0x16, 
+0x8a, 0x17, 0x51, 0x34, 0xd1, 0xc0, 0xfa, 0x1d, 0x73, 0xf1, 0x4e, 0x7d, 0x4a, 0x71, 0x4f, 0x65, 
+0xb3, 0xe4, 0xca, 0x7d, 0x48, 0x37, 0x0a, 0x3e, 0x6a, 0xf8, 0x4d, 0xa7, 0x8c, 0x53, 0x9f, 0x2d, 
+0x40, 0xb6, 0x40, 0xf9, 0xc8, 0xa4, 0xd3, 0x65, 0x0b, 0x83, 0xc7, 0x5d, 0xb0, 0xd7, 0x1a, 0xc3, 
+0x1c, 0x80, 0x26, 0x35, 0xf4, 0xc5, 0x71, 0x49, 0x0f, 0x3d, 0x59, 0x50, 0xe4, 0xa1, 0xf3, 0xb4, 
+0x83, 0x09, 0x6b, 0x95, 0x29, 0x5c, 0x36, 0x9e, 0x46, 0x25, 0x7f, 0x49, 0x2c, 0xb1, 0xc2, 0x74, 
+0xd7, 0x6e, 0x29, 0xd4, 0x17, 0xea, 0xf4, 0xcf, 0x2b, 0x39, 0x3a, 0xd6, 0x25, 0xd6, 0xd4, 0xa5, 
+0x0e, 0xd3, 0x4a, 0x2e, 0x5f, 0xd3, 0xbc, 0x72, 0xb9, 0x38, 0xd2, 0x46, 0x38, 0x96, 0xac, 0x35, 
+0x18, 0xd6, 0xc8, 0xa3, 0xdb, 0x72, 0x83, 0x02, 0x96, 0x1d, 0xe5, 0x8b, 0x05, 0x2c, 0x72, 0xf0, 
+0xf1, 0xbe, 0x25, 0x09, 0x58, 0x9e, 0xc7, 0xa1, 0x4e, 0x56, 0xe1, 0xae, 0x3f, 0xa1, 0xfa, 0x08, 
+0x24, 0xa3, 0x06, 0xf0, 0x56, 0xe5, 0xae, 0xdb, 0x27, 0x0d, 0xab, 0x6e, 0xb6, 0x17, 0x81, 0xc3, 
+0x89, 0x0e, 0x79, 0xd2, 0xbd, 0x4c, 0x74, 0x1f, 0x31, 0x8e, 0x2c, 0x70, 0xcb, 0xd1, 0xa3, 0x1d, 
+0x7a, 0x36, 0xe8, 0x5c, 0x93, 0x08, 0x45, 0xf8, 0xa4, 0x29, 0x0d, 0x75, 0xa5, 0xc0, 0xfb, 0x84, 
+0xeb, 0x73, 0xc2, 0x6c, 0x48, 0x2b, 0x0d, 0x97, 0xb2, 0x96, 0x0a, 0xf8, 0x5e, 0x47, 0x5c, 0x9f, 
+0x0b, 0x5d, 0x20, 0x6a, 0xf0, 0x2b, 0x3e, 0x05, 0x19, 0x0e, 0xaf, 0x5e, 0xaf, 0xc2, 0xa6, 0x1f, 
+0x9c, 0x8e, 0x1b, 0x93, 0x96, 0x70, 0xac, 0xb7, 0xe3, 0xd5, 0x23, 0xe6, 0xb1, 0x0c, 0x84, 0xb7, 
+0x95, 0xd4, 0x6d, 0x3e, 0x76, 0xfd, 0xb8, 0xe9, 0xbd, 0x2b, 0x48, 0x17, 0xd9, 0xe6, 0x2c, 0x13, 
+0xda, 0x9e, 0x3f, 0xa6, 0xdb, 0x5c, 0x40, 0xa6, 0xf1, 0xa5, 0xf1, 0xa8, 0xdb, 0xa5, 0x1a, 0xf3, 
+0x72, 0xf9, 0x7e, 0xb8, 0x1e, 0x50, 0xa4, 0x0e, 0x15, 0xbd, 0x6c, 0x21, 0xbd, 0x75, 0x2b, 0x93, 
+0x1f, 0x78, 0x46, 0x0a, 0x81, 0x0f, 0x49, 0xe3, 0xa9, 0x6f, 0x85, 0x14, 0xc1, 0x4e, 0x82, 0xe0, 
+0x6b, 0xfa, 0x1b, 0x3a, 0xde, 0x28, 0xf9, 0xe4, 0xc9, 0xe5, 0x27, 0xd9, 0xe8, 0x5c, 0x16, 0x8c, 
+0x14, 0x79, 0x4c, 0xd3, 0x46, 0xa3, 0x5e, 0x62, 0x2b, 0x4f, 0x86, 0x3f, 0x1a, 0x07, 0x8b, 0x52, 
+0x9f, 0xa3, 0xd2, 0xf1, 0x26, 0x0b, 0x82, 0x5a, 0xc1, 0x95, 0x42, 0x72, 0x4a, 0x70, 0xf7, 0xc0, 
+0x4a, 0x38, 0x4f, 0x82, 0x75, 0x0c, 0x62, 0x94, 0x1f, 0x2a, 0x38, 0xe5, 0x78, 0x3b, 0x2e, 0xc7, 
+0x64, 0xf7, 0xd5, 0x4a, 0x85, 0x80, 0x64, 0x95, 0x6b, 0xd8, 0xf6, 0xae, 0x8c, 0xf9, 0x0a, 0x7d, 
+0x60, 0xec, 0x47, 0x0e, 0xc2, 0x6d, 0xa1, 0xe2, 0xc6, 0xda, 0x8b, 0x07, 0xf1, 0x5c, 0x37, 0xfd, 
+0x86, 0xca, 0xd4, 0x5c, 0x31, 0x2d, 0x0e, 0x76, 0x14, 0xa5, 0xa3, 0xb2, 0x74, 0x6a, 0x0f, 0xb6, 
+0x24, 0xf7, 0x2b, 0x47, 0x90, 0x5d, 0x20, 0x79, 0xd0, 0xf1, 0x97, 0xda, 0xa1, 0xd5, 0x2d, 0x18, 
+0x5b, 0x4f, 0xc1, 0xed, 0x74, 0x85, 0x79, 0x6c, 0xbe, 0x92, 0xe9, 0xb0, 0xe3, 0xb1, 0x9d, 0xb5, 
+0xf1, 0xd6, 0x92, 0x5e, 0x6c, 0x1e, 0x09, 0x7e, 0x42, 0xfb, 0x4d, 0x0c, 0x73, 0x68, 0xf1, 0xb3, 
+0x2c, 0xe0, 0x64, 0x90, 0xe2, 0x09, 0x28, 0xb0, 0xde, 0x3c, 0xf2, 0xcf, 0x03, 0x74, 0x1b, 0x32, 
+0x74, 0x13, 0x58, 0x3f, 0x59, 0x3a, 0xf8, 0xd6, 0x94, 0xb2, 0x3d, 0x75, 0xf9, 0x45, 0x1d, 0x65, 
+0xbd, 0x29, 0xa4, 0xb0, 0x2f, 0x30, 0x82, 0x79, 0xf9, 0xa6, 0x84, 0xe2, 0x87, 0xc0, 0x71, 0xd6, 
+0x0d, 0xbd, 0x84, 0x73, 0xcb, 0xa3, 0x9d, 0xf3, 0xce, 0x8b, 0xfa, 0xe5, 0x27, 0xc8, 0x40, 0xc1, 
+0x73, 0xe9, 0xb7, 0x49, 0xce, 0x26, 0x98, 0x40, 0x6c, 0x1f, 0xc0, 0x43, 0x85, 0x74, 0xf1, 0x57, 
+0x48, 0x6f, 0xc0, 0x69, 0xc7, 0x3a, 0xc3, 0xb9, 0x82, 0xb6, 0xbd, 0x5a, 0xcd, 0x92, 0x78, 0xe5, 
+0xad, 0x09, 0xc5, 0xcd, 0x06, 0xa8, 0x9d, 0x53, 0xac, 0xb6, 0xd1, 0xf6, 0x2b, 0x4a, 0x71, 0x7b, 
+0x2a, 0xc2, 0xd9, 0x7d, 0xa6, 0x8c, 0xed, 0x0b, 0x28, 0xc6, 0x14, 0x2a, 0x7d, 0x09, 0xf9, 0x5b, 
+0x31, 0xb7, 0x2f, 0x81, 0x38, 0x70, 0xe2, 0x96, 0xa9, 0x75, 0xfb, 0xc1, 0x75, 0xd7, 0x39, 0x1c, 
+0xfb, 0x3f, 0xd4, 0x8f, 0xa3, 0x16, 0x2c, 0x90, 0xd6, 0x05, 0xc0, 0xa1, 0x5a, 0x24, 0x63, 0x58, 
+0xba, 0x5d, 0xbf, 0x35, 0xe8, 0x50, 0x3f, 0xd0, 0x69, 0x70, 0xb3, 0xca, 0x2e, 0xa2, 0xb7, 0xea, 
+0xd1, 0xcb, 0x68, 0xda, 0xfc, 0x24, 0x7a, 0x3e, 0x05, 0x8e, 0x18, 0xf0, 0x3f, 0x48, 0x23, 0x10, 
+0x63, 0x86, 0x0c, 0xa3, 0x1b, 0xe7, 0x40, 0x79, 0x9f, 0x42, 0xfb, 0x1e, 0x85, 0x83, 0xe5, 0x39, 
+0xc6, 0x1d, 0x95, 0xd4, 0x9e, 0x57, 0xf5, 0x04, 0xf0, 0xb9, 0x62, 0x7a, 0x4e, 0x02, 0xe9, 0xc5, 
+0x3e, 0x57, 0x18, 0xc0, 0xd8, 0xfb, 0x39, 0xce, 0xac, 0x4f, 0x6d, 0x3c, 0x51, 0xdc, 0x63, 0x5a, 
+0xe4, 0x0f, 0xbc, 0x5a, 0x84, 0x16, 0x9b, 0x35, 0x97, 0xf5, 0xe1, 0xf5, 0x81, 0x9e, 0x75, 0x8e, 
+0x6b, 0x1c, 0x80, 0xc1, 0xf3, 0x06, 0x29, 0x6e, 0xc6, 0xac, 0x76, 0xa2, 0xb3, 0xf5, 0xe2, 0x7f, 
+0x85, 0x60, 0x95, 0x26, 0x0f, 0x36, 0x0d, 0x21, 0x50, 0xae, 0x31, 0x8d, 0x4b, 0xe1, 0x46, 0xd7, 
+0x5a, 0xd5, 0xfb, 0x8e, 0x91, 0xed, 0xa5, 0x28, 0xf6, 0x25, 0xaf, 0x26, 0x4b, 0x15, 0x73, 0xa6, 
+0xd4, 0x1a, 0x97, 0xb8, 0x0f, 0x73, 0xe0, 0xb8, 0x1d, 0x0a, 0x3b, 0xec, 0x82, 0xe4, 0x1b, 0x5c, 
+0x7d, 0x95, 0xb7, 0x0f, 0x18, 0xcb, 0x4f, 0x24, 0xa6, 0x2d, 0x60, 0x46, 0x05, 0xb1, 0x85, 0x7f, 
+0xe4, 0xa2, 0x19, 0xd0, 0x2c, 0x62, 0xd1, 0x36, 0x0e, 0x9d, 0x2a, 0x1e, 0xc0, 0xb9, 0x79, 0xb4, 
+0xde, 0xb3, 0xf4, 0x2b, 0x3f, 0x73, 0xea, 0xd7, 0x4e, 0x4c, 0x73, 0xeb, 0xf4, 0x2e, 0x1c, 0x3e, 
+0x51, 0xca, 0x4d, 0x90, 0xb4, 0xed, 0x3f, 0xba, 0x85, 0x9a, 0xe3, 0x98, 0xc6, 0x8b, 0x6f, 0x96, 
+0x2a, 0x73, 0xa9, 0x4e, 0x1c, 0x90, 0x96, 0xc4, 0xf5, 0xa4, 0x3f, 0x6c, 0x48, 0xc3, 0xdb, 0x1d, 
+0x3c, 0x8e, 0xd0, 0x82, 0xb0, 0xfc, 0x20, 0xd2, 0x59, 0xc4, 0x69, 0xf3, 0x64, 0x8c, 0x14, 0x69, 
+0x1a, 0x57, 0xde, 0x3f, 0x13, 0xaf, 0x48, 0xdb, 0x6a, 0x2e, 0x06, 0x97, 0xe5, 0x18, 0xe7, 0xd2, 
+0x9f, 0x3a, 0xc1, 0xb2, 0x08, 0x6f, 0x8e, 0x46, 0xb8, 0x95, 0x79, 0xfd, 0x2c, 0x47, 0x5f, 0x7b, 
+0x42, 0x6d, 0x30, 0x6a, 0x27, 0x61, 0x8b, 0xd9, 0x18, 0xd9, 0x62, 0x46, 0x9b, 0x8e, 0xa0, 0x98, 
+0xb0, 0x6a, 0x95, 0x8d, 0x7b, 0x82, 0x08, 0x53, 0xc7, 0x1a, 0x84, 0xd2, 0x4c, 0xe2, 0xb7, 0x5a, 
+0xe3, 0x1d, 0x2c, 0x5f, 0x1b, 0x6f, 0xc0, 0xb2, 0xa3, 0x71, 0xe3, 0x72, 0xb7, 0x0b, 0x7d, 0x09, 
+0x1d, 0x70, 0x89, 0x6f, 0x71, 0xa2, 0x94, 0xcf, 0x37, 0x96, 0x5f, 0x4c, 0xea, 0x18, 0xb2, 0x5c, 
+0x1f, 0xb3, 0x7d, 0x25, 0x3d, 0xf2, 0xa8, 0x09, 0x62, 0x70, 0xc2, 0x53, 0x94, 0x73, 0x9c, 0xbe, 
+0x3a, 0xc4, 0xa3, 0xbc, 0x85, 0xe7, 0x4d, 0x94, 0x7b, 0xa0, 0x3b, 0x79, 0xf1, 0xeb, 0x34, 0xa7, 
+0x95, 0xb0, 0xe3, 0x08, 0x6e, 0x4a, 0x2d, 0xe4, 0x09, 0x3d, 0xa1, 0x6e, 0x45, 0x04, 0xfb, 0x2f, 
+0x01, 0x62, 0x1c, 0x46, 0x8e, 0xd4, 0xf0, 0x29, 0x06, 0xf9, 0x6d, 0xfb, 0x19, 0x5c, 0x07, 0x19, 
+0xf7, 0x04, 0x81, 0xd0, 0x4f, 0x97, 0x40, 0xa3, 0xd8, 0x04, 0xe6, 0x58, 0xf6, 0xd4, 0xaf, 0x1a, 
+0xd2, 0xc6, 0x19, 0x5b, 0x3f, 0xa5, 0xe4, 0x0a, 0x5e, 0x64, 0x6d, 0x75, 0xae, 0x5c, 0x38, 0xa6, 
+0x32, 0x5f, 0xd0, 0xa7, 0xb9, 0x6e, 0xa8, 0xfc, 0xa8, 0x06, 0x4c, 0x5a, 0xdc, 0xea, 0x38, 0xae, 
+0x1f, 0xbd, 0x53, 0x15, 0x09, 0x7e, 0x05, 0xf1, 0x3a, 0x06, 0xf2, 0x6e, 0xd3, 0xe5, 0xca, 0x0d, 
+0x25, 0x40, 0xec, 0x10, 0xe3, 0xc8, 0x6c, 0xd9, 0xd8, 0x0f, 0x85, 0x7c, 0xfc, 0xb4, 0xf5, 0x07, 
+0xcb, 0xa7, 0x18, 0xa5, 0xdc, 0xa7, 0xf5, 0xd3, 0x51, 0x83, 0x6c, 0xea, 0x4d, 0x41, 0xca, 0x43, 
+0x6e, 0x83, 0xf6, 0xdb, 0x51, 0xad, 0x6f, 0xc7, 0x2b, 0x57, 0xca, 0xe7, 0x4c, 0x58, 0x91, 0xda, 
+0x07, 0xe2, 0x8b, 0x65, 0x38, 0xe9, 0xf3, 0xde, 0x62, 0xb1, 0x7d, 0x3c, 0xb0, 0x9f, 0xb0, 0x13, 
+0xd1, 0x2a, 0xe1, 0xd0, 0x8d, 0xb7, 0x3e, 0x4d, 0x22, 0x40, 0x52, 0x07, 0x37, 0xcb, 0x27, 0xf2, 
+0x48, 0x15, 0x6e, 0x07, 0xd6, 0x18, 0xaf, 0x78, 0xcf, 0x62, 0xb9, 0x76, 0xe9, 0xd2, 0xb9, 0x0a, 
+0x17, 0x94, 0xd2, 0x35, 0xda, 0x9c, 0x66, 0xb8, 0x5d, 0x1a, 0x29, 0x43, 0x1b, 0x7c, 0x3a, 0x18, 
+0x26, 0x08, 0x93, 0xd9, 0x23, 0xfd, 0x59, 0xd7, 0x3e, 0x54, 0xb8, 0x0c, 0x2b, 0xca, 0x2b, 0x57, 
+0x2e, 0xb3, 0x72, 0x09, 0xf2, 0xd4, 0x9a, 0x17, 0x3e, 0x8c, 0x29, 0x35, 0x9c, 0x1f, 0x38, 0x60, 
+0x92, 0xed, 0x2b, 0x3e, 0x41, 0xc9, 0x30, 0xc9, 0xf5, 0x14, 0xa5, 0x28, 0x04, 0x8c, 0x28, 0xf6, 
+0x24, 0xd2, 0x8a, 0xe9, 0x68, 0xb0, 0x49, 0xb6, 0x7c, 0x26, 0x81, 0x95, 0xe8, 0xdf, 0x9b, 0xd4, 
+0xe1, 0x4f, 0xe1, 0x7d, 0x59, 0xfb, 0xd4, 0x92, 0x84, 0xa0, 0x6b, 0xd2, 0x43, 0xb8, 0xd4, 0xa0, 
+0xc2, 0x58, 0x4c, 0x58, 0x3f, 0x12, 0x68, 0xfb, 0x87, 0x3d, 0x18, 0xf3, 0xc9, 0x74, 0xfb, 0x17, 
+0xf5, 0x19, 0x4f, 0xb3, 0x5a, 0xe7, 0x2c, 0x64, 0xe6, 0x91, 0x3c, 0x04, 0x91, 0x8e, 0x29, 0x68, 
+0xd6, 0x05, 0xd8, 0x0f, 0x97, 0x08, 0xee, 0x8c, 0xa7, 0x0b, 0xe3, 0xc4, 0xb6, 0x40, 0x5b, 0x1d, 
+0xe6, 0x0d, 0xb5, 0x2f, 0xc6, 0xa3, 0xa5, 0x76, 0xca, 0x65, 0xd5, 0xe2, 0xb0, 0xd7, 0xc0, 0x7c, 
+0x9e, 0x6f, 0xb9, 0x1e, 0x87, 0xc5, 0x35, 0xc4, 0xf5, 0xd7, 0xf5, 0x2f, 0x4e, 0x09, 0xfa, 0xc7, 
+0x1b, 0x67, 0x35, 0x8b, 0x59, 0xa6, 0x93, 0xab, 0x30, 0x73, 0x18, 0xcf, 0xb3, 0xcf, 0x24, 0x0a, 
+0xe9, 0x10, 0xc5, 0x2d, 0x84, 0xf1, 0xbf, 0x6e, 0xb6, 0xac, 0xe9, 0x61, 0x40, 0xf5, 0xa4, 0x2a, 
+0x60, 0xf2, 0x7d, 0x5c, 0xa3, 0xd6, 0xc0, 0x6d, 0xf4, 0xb1, 0xe8, 0xfb, 0x80, 0x5b, 0xe6, 0x2b, 
+0xf6, 0xa0, 0xd3, 0xe1, 0xe7, 0x9f, 0x74, 0xc3, 0x5c, 0x6a, 0x5b, 0x61, 0x35, 0xa6, 0x12, 0x8f, 
+0x09, 0xe8, 0xf7, 0xa2, 0x84, 0xa3, 0x91, 0xd8, 0x3e, 0x06, 0xf0, 0xc9, 0x28, 0x0f, 0x1a, 0x73, 
+0xc6, 0xa2, 0xf8, 0xbf, 0x2a, 0x40, 0x34, 0x5a, 0x1f, 0xa0, 0xe7, 0x82, 0x0a, 0x36, 0xc7, 0xd3, 
+0xa5, 0x1c, 0x43, 0x0d, 0x3a, 0x0c, 0xe1, 0x9f, 0x1d, 0x20, 0xd5, 0x18, 0xe4, 0xc9, 0xe2, 0x56, 
+0x1e, 0x29, 0xd5, 0x8c, 0x67, 0xf5, 0xe9, 0x7f, 0x37, 0xad, 0x81, 0x30, 0xd4, 0x7c, 0x04, 0xbe, 
+0xac, 0x82, 0xb7, 0xe1, 0xd5, 0x9b, 0x30, 0x8e, 0x28, 0xb7, 0x2e, 0x89, 0x07, 0x3c, 0x50, 0x41, 
+0xad, 0x39, 0x7a, 0xe5, 0x92, 0xc7, 0x64, 0xba, 0x03, 0x2c, 0x31, 0xad, 0xa1, 0xf3, 0x04, 0xd7, 
+0xec, 0x8f, 0x79, 0x5d, 0xa2, 0xc6, 0x1d, 0x4f, 0xb3, 0x7a, 0x6e, 0x5a, 0x48, 0x5b, 0x7e, 0x81, 
+0xfd, 0x3b, 0xc8, 0x4d, 0x48, 0xe4, 0x61, 0x45, 0x37, 0xd9, 0xe7, 0xdb, 0x35, 0x29, 0xd1, 0xac, 
+0x7e, 0x1a, 0x29, 0x18, 0xb9, 0xe6, 0x8d, 0x69, 0xf4, 0x82, 0x5a, 0x06, 0x3b, 0x68, 0xcb, 0xf6, 
+0xda, 0x1f, 0x6b, 0x0d, 0x97, 0x65, 0xb8, 0xf3, 0x15, 0xb3, 0x26, 0xb1, 0xbd, 0x05, 0x37, 0xc9, 
+0x2a, 0x15, 0x39, 0x51, 0x29, 0x6e, 0x1c, 0x94, 0x82, 0xae, 0x5a, 0x64, 0x90, 0xf3, 0xb4, 0x52, 
+0xbd, 0x69, 0xab, 0x73, 0xc5, 0xf1, 0x24, 0x81, 0xd3, 0x59, 0xf2, 0xc0, 0x8b, 0xe6, 0x9f, 0x57, 
+0x24, 0xd8, 0xaf, 0x92, 0x09, 0x40, 0xdb, 0x61, 0x47, 0xb3, 0xb8, 0x60, 0x5e, 0x0d, 0x2c, 0x09, 
+0xb1, 0xd2, 0x41, 0x64, 0x5a, 0x47, 0x26, 0x0f, 0x91, 0x2d, 0xb9, 0xed, 0x80, 0xb5, 0xc2, 0x08, 
+0x6e, 0xc7, 0xb4, 0xf6, 0x3b, 0x5f, 0x0b, 0xe4, 0x17, 0xd5, 0x2f, 0x7b, 0x27, 0xce, 0x4b, 0xe7, 
+0xd8, 0x4f, 0x37, 0x04, 0x27, 0x59, 0x38, 0xa4, 0xf3, 0xad, 0x03, 0x2c, 0xea, 0x8d, 0x90, 0xd4, 
+0x62, 0x9c, 0x6e, 0xa5, 0xf8, 0xde, 0xb7, 0xfd, 0x7d, 0x34, 0xb3, 0x6f, 0xb4, 0xd7, 0x1f, 0xb1, 
+0xd6, 0x49, 0x0a, 0xce, 0x15, 0xf2, 0xe1, 0x6e, 0x92, 0x7b, 0xdf, 0x0b, 0x7e, 0x0c, 0x17, 0x95, 
+0x7a, 0x05, 0xac, 0x08, 0xe9, 0x6c, 0x24, 0x6b, 0xd6, 0x2e, 0x53, 0xeb, 0x3e, 0x50, 0x94, 0x2c, 
+0x9b, 0x6f, 0x47, 0x3e, 0x67, 0xf9, 0xad, 0xcb, 0x8d, 0x19, 0xf5, 0xda, 0x6b, 0x58, 0x06, 0x31, 
+0xcf, 0x28, 0x6a, 0xdf, 0x29, 0x06, 0x23, 0x80, 0xd9, 0x8c, 0x45, 0xd6, 0xf3, 0x0b, 0xa3, 0x05, 
+0x1d, 0x39, 0x78, 0x24, 0x1e, 0x91, 0x49, 0xca, 0x8c, 0x14, 0xce, 0x58, 0x0b, 0x41, 0xea, 0x79, 
+0x40, 0x2a, 0x7c, 0x58, 0xe8, 0xaf, 0x20, 0xd3, 0x70, 0x63, 0x96, 0x0b, 0x5a, 0x08, 0xe6, 0x08, 
+0x2e, 0x06, 0x2c, 0x83, 0xe7, 0xbe, 0xd6, 0x38, 0x7a, 0x38, 0x49, 0xdb, 0x18, 0xc6, 0x49, 0x63, 
+0xa8, 0x4b, 0xea, 0x3f, 0xf4, 0xd8, 0x1b, 0x4e, 0x3b, 0x0e, 0x5c, 0x1f, 0x5a, 0x8c, 0x28, 0x06, 
+0x9d, 0x8f, 0xce, 0xa7, 0xd1, 0x29, 0x8a, 0xd5, 0x2d, 0x0a, 0x53, 0xe2, 0x06, 0xbe, 0x1b, 0x81, 
+0x3f, 0xca, 0x5f, 0xa8, 0x69, 0x41, 0xe3, 0x46, 0xb3, 0x5f, 0x9d, 0xa5, 0x26, 0x1d, 0x79, 0xc2, 
+0xa8, 0xc2, 0x8e, 0x9c, 0xa6, 0x05, 0xf0, 0xca, 0x5b, 0x0a, 0xd5, 0x6f, 0x3d, 0xf7, 0x0d, 0x26, 
+0xc6, 0xd8, 0x96, 0x5b, 0xd6, 0xf4, 0x1f, 0x29, 0xe3, 0x17, 0x4b, 0x71, 0xbc, 0xa1, 0xd2, 0x4a, 
+0x31, 0xfc, 0x72, 0xdc, 0xa5, 0xc9, 0x8a, 0x54, 0xac, 0x12, 0x81, 0xf0, 0xbd, 0x06, 0xf2, 0x53, 
+0x4e, 0x0d, 0x18, 0xc5, 0xf2, 0x68, 0x35, 0x0d, 0x96, 0x3c, 0x47, 0x29, 0x61, 0x58, 0x39, 0x73, 
+0x81, 0xe6, 0xaf, 0x7d, 0xa1, 0x64, 0x26, 0x13, 0x84, 0x7c, 0x10, 0xf8, 0x2c, 0x84, 0x17, 0x85, 
+0xcf, 0x35, 0x93, 0xe4, 0x97, 0x31, 0xd7, 0x23, 0xe7, 0xca, 0xd7, 0x91, 0xc8, 0xeb, 0x17, 0xec, 
+0xaf, 0x4a, 0x23, 0x07, 0x45, 0xe6, 0x1b, 0xf4, 0x8f, 0xbc, 0x26, 0x9d, 0x27, 0x6f, 0x82, 0x1b, 
+0x05, 0x6b, 0x97, 0x3b, 0xf8, 0x23, 0xe0, 0xf2, 0x73, 0xbe, 0x6b, 0x41, 0x6c, 0x5d, 0x9f, 0x95, 
+0xf2, 0x85, 0xcf, 0x8e, 0x8d, 0x62, 0x95, 0xa3, 0x17, 0x4f, 0x30, 0xe2, 0x90, 0x6d, 0x59, 0x6c, 
+0x45, 0x9c, 0xb0, 0x9f, 0x7a, 0x59, 0x3b, 0xe0, 0x9c, 0xd0, 0xf7, 0xb8, 0xc0, 0xe9, 0xe1, 0xfd, 
+0xa7, 0xdf, 0xa0, 0xdb, 0x2c, 0x40, 0x5b, 0x32, 0x4c, 0x09, 0x7b, 0xe0, 0xfa, 0xe4, 0xb5, 0x6b, 
+0x96, 0x3b, 0xdf, 0x1a, 0x97, 0x48, 0x07, 0xac, 0x0e, 0x69, 0x4c, 0xb5, 0xd0, 0x52, 0x50, 0xbf, 
+0x71, 0x4a, 0x43, 0x17, 0x30, 0xb6, 0xf8, 0xde, 0xb0, 0xf9, 0x57, 0x13, 0x61, 0x79, 0x3e, 0x38, 
+0xe3, 0xc3, 0x7d, 0xe4, 0x98, 0x2d, 0x15, 0xea, 0x05, 0xa6, 0xb4, 0xc1, 0x85, 0x90, 0x78, 0xda, 
+0x70, 0xb8, 0x51, 0x3d, 0x94, 0xe6, 0x17, 0xb0, 0x64, 0xa4, 0xce, 0x4f, 0x7b, 0x2d, 0xb6, 0xd7, 
+0xf3, 0x84, 0xab, 0x39, 0x2f, 0x1e, 0x75, 0xd6, 0x0c, 0x27, 0xe1, 0x75, 0x27, 0xb3, 0x9d, 0x14, 
+0x58, 0x26, 0xb7, 0x85, 0x0c, 0x23, 0x7e, 0x46, 0xe7, 0x9d, 0x3c, 0x7f, 0xa5, 0xfd, 0x2c, 0x59, 
+0xc2, 0x69, 0xf2, 0xd4, 0x0f, 0xe2, 0x9c, 0x63, 0xe0, 0xca, 0xdf, 0x62, 0x5b, 0xc2, 0x0f, 0x61, 
+0x3b, 0x9f, 0x7e, 0x34, 0xad, 0x68, 0xdb, 0xf5, 0x9e, 0x82, 0xe5, 0x61, 0x97, 0x2c, 0x3d, 0x7b, 
+0xd3, 0xe4, 0xdb, 0x05, 0xb9, 0x15, 0x92, 0xa7, 0xec, 0xa3, 0xfb, 0x24, 0x91, 0xfd, 0x18, 0xad, 
+0xe1, 0xca, 0x3f, 0x25, 0xdf, 0x32, 0xea, 0x06, 0x70, 0xd7, 0xa3, 0x2e, 0xc1, 0xf8, 0x01, 0x68, 
+0xd0, 0x93, 0x51, 0x9b, 0x5c, 0xdf, 0x0e, 0x1e, 0x8a, 0x63, 0x4a, 0xc2, 0x9b, 0xf8, 0x4c, 0xa4, 
+0xe8, 0x14, 0x62, 0xea, 0xfb, 0xa0, 0x4c, 0x23, 0xe4, 0x96, 0xb1, 0x8a, 0x03, 0xf8, 0x91, 0x50, 
+0x83, 0xb5, 0xa8, 0x46, 0x37, 0xd0, 0x3a, 0x7c, 0x18, 0x5a, 0x04, 0x7d, 0x25, 0xf2, 0x51, 0x8d, 
+0x91, 0xf8, 0x5a, 0x98, 0xfa, 0x83, 0xc8, 0x2d, 0x50, 0x2e, 0x06, 0x82, 0x6c, 0x51, 0x9b, 0xc3, 
+0xe4, 0xd8, 0x1a, 0xe0, 0xc9, 0x2a, 0x68, 0xf1, 0x4a, 0xfd, 0x0c, 0x51, 0x3b, 0x06, 0x48, 0xc6, 
+0xdc, 0x49, 0x75, 0x36, 0x74, 0xe5, 0x06, 0xb4, 0x92, 0xac, 0x64, 0xcd, 0x2b, 0x93, 0xfa, 0x56, 
+0x93, 0xda, 0x7b, 0x92, 0xe5, 0xfa, 0x8e, 0x42, 0x05, 0x92, 0x76, 0x4a, 0x7c, 0x08, 0xb1, 0xe7, 
+0x34, 0x16, 0xd2, 0x9f, 0x1a, 0xce, 0xac, 0x57, 0x46, 0xd3, 0xfd, 0x6a, 0xb8, 0xe0, 0xc5, 0x2d, 
+0x95, 0xb1, 0x6e, 0xac, 0xe9, 0x17, 0x0f, 0x19, 0xd1, 0x59, 0xe5, 0x96, 0xb3, 0x7d, 0x6e, 0x2b, 
+0xa8, 0x6b, 0xc3, 0x9e, 0x37, 0x4a, 0xd1, 0x3c, 0x46, 0x10, 0xa5, 0xa8, 0xf9, 0xca, 0x93, 0xcd, 
+0x1b, 0x93, 0x70, 0x26, 0xa8, 0x3b, 0xf4, 0x68, 0x57, 0x1f, 0x04, 0xa7, 0xd2, 0x86, 0x48, 0xf7, 
+0x5f, 0x82, 0xe9, 0x1a, 0x72, 0x50, 0xeb, 0xd0, 0xab, 0x28, 0xbe, 0x91, 0xe6, 0x70, 0x9e, 0x85, 
+0xfa, 0x51, 0xc0, 0xd8, 0xb1, 0x65, 0x2e, 0xc3, 0x94, 0xc7, 0x1c, 0x8c, 0xf7, 0x1b, 0x59, 0xd4, 
+0x1f, 0x59, 0xf2, 0x5b, 0x8e, 0x7a, 0x03, 0x6b, 0x75, 0x37, 0x08, 0x30, 0x0e, 0x71, 0x89, 0x40, 
+0x75, 0x1f, 0x8a, 0xf0, 0x7d, 0x24, 0xf9, 0x47, 0x26, 0xd3, 0xcd, 0x2b, 0xfa, 0x4c, 0x71, 0x1d, 
+0xf4, 0xc1, 0xa5, 0x91, 0xe3, 0x07, 0x91, 0xb5, 0x0e, 0x63, 0xe5, 0xbe, 0x27, 0xed, 0x6f, 0x04, 
+0xb3, 0x71, 0x47, 0xfa, 0x34, 0xfd, 0xbe, 0x9f, 0x0d, 0x60, 0x59, 0x23, 0xeb, 0xd5, 0xb3, 0xce, 
+0x61, 0xae, 0x1b, 0xd0, 0x94, 0xd7, 0xc3, 0x05, 0xe8, 0xac, 0x62, 0x9f, 0x81, 0x7f, 0x53, 0x7c, 
+0x0b, 0x4f, 0x52, 0xb3, 0x17, 0x4d, 0x68, 0xf2, 0x4e, 0x8f, 0x47, 0x05, 0xb1, 0x62, 0xe4, 0x62, 
+0xa8, 0xe3, 0xcf, 0x2c, 0x2d, 0x4b, 0xd6, 0x4f, 0x1c, 0x5b, 0xf8, 0xc4, 0x0d, 0x29, 0xf4, 0xde, 
+0x52, 0x9b, 0x51, 0xfc, 0xd2, 0xa4, 0x3b, 0x64, 0xe6, 0xac, 0x83, 0x1b, 0xe1, 0xb9, 0x76, 0xa5, 
+0x78, 0x2f, 0xb8, 0x3a, 0x29, 0x8e, 0x2c, 0xf7, 0x4c, 0xe6, 0xf4, 0x7a, 0x2b, 0xc0, 0x27, 0x90, 
+0xab, 0x83, 0x4c, 0x71, 0xd6, 0x5f, 0xd0, 0x28, 0x60, 0xa2, 0x64, 0x85, 0xc2, 0x9b, 0xe7, 0xca, 
+0x70, 0x86, 0xd9, 0x28, 0x3c, 0x75, 0xc4, 0x28, 0xc6, 0x1a, 0x5d, 0x8f, 0x2b, 0x3f, 0x14, 0xc3, 
+0x5d, 0xc4, 0x1d, 0x25, 0x8d, 0xb1, 0xd7, 0x1a, 0x8e, 0xc2, 0x94, 0x3a, 0x5a, 0x0b, 0x3a, 0xf6, 
+0xd8, 0xfa, 0x0b, 0x7d, 0x3b, 0x64, 0xa0, 0x86, 0x8a, 0x72, 0x08, 0xa0, 0xb6, 0x23, 0xd9, 0x1e, 
+0x8e, 0xc6, 0x51, 0xba, 0x8c, 0x4b, 0xd3, 0x86, 0x1e, 0x97, 0xd2, 0x91, 0xc3, 0x1e, 0x0d, 0x65, 
+0xa4, 0xf5, 0x1e, 0x30, 0xc3, 0x06, 0x3d, 0xe6, 0x70, 0x64, 0x38, 0x60, 0xc8, 0x2b, 0x1e, 0xd8, 
+0xf6, 0x98, 0xbf, 0x64, 0x51, 0xd9, 0x2b, 0x8a, 0xe0, 0xc8, 0xa5, 0xbb, 0xde, 0x57, 0x3c, 0x1b, 
+0x74, 0xe4, 0x2d, 0x0f, 0x42, 0xa3, 0x7f, 0x05, 0xbf, 0x03, 0x97, 0xa3, 0xfb, 0x2e, 0x4b, 0x6d, 
+0x40, 0x79, 0x8d, 0x61, 0x96, 0x2a, 0x9f, 0xac, 0x36, 0x23, 0xa6, 0xfd, 0x5b, 0x07, 0xfb, 0x0c, 
+0x7d, 0x1c, 0x95, 0x18, 0xc2, 0x39, 0xd3, 0xf1, 0x50, 0xd9, 0x17, 0xeb, 0x30, 0xe6, 0xa3, 0xd9, 
+0x3e, 0x90, 0x75, 0x2a, 0x63, 0xb0, 0xe9, 0x76, 0x71, 0xf0, 0x6e, 0xa5, 0xb9, 0x46, 0x0e, 0x5d, 
+0xa8, 0x57, 0x5b, 0x9d, 0x08, 0x3c, 0x28, 0xb6, 0xe9, 0xea, 0x84, 0x05, 0xcf, 0xd7, 0xab, 0xd3, 
+0xa2, 0x5a, 0x36, 0x03, 0x51, 0xd4, 0x5c, 0x2e, 0x8f, 0x47, 0x0f, 0x52, 0x94, 0xb1, 0x3e, 0x74, 
+0x18, 0xc9, 0x0f, 0xa3, 0xe9, 0x0a, 0x83, 0x56, 0xdb, 0xe1, 0x4b, 0x6e, 0x94, 0x8d, 0xf0, 0x5e, 
+0x17, 0x98, 0x02, 0x96, 0x9c, 0x4e, 0x2a, 0xbe, 0x3d, 0xe7, 0x08, 0x61, 0xaf, 0x9e, 0x8c, 0x04, 
+0x38, 0x4a, 0x51, 0x9e, 0x25, 0x86, 0x2e, 0xb4, 0x3e, 0x5b, 0x56, 0x98, 0xbe, 0x2f, 0x53, 0x9f, 
+0xc5, 0xbe, 0x2c, 0xf6, 0x4a, 0x8f, 0xc4, 0xd7, 0x19, 0x38, 0x4d, 0x23, 0xad, 0x5a, 0x42, 0x70, 
+0x3d, 0x1f, 0xca, 0x87, 0x2f, 0x9e, 0x42, 0xf2, 0xc6, 0xe7, 0xaf, 0x48, 0x1c, 0x51, 0xd9, 0xca, 
+0x21, 0xb4, 0xf0, 0x49, 0xf7, 0xd8, 0x9c, 0xb7, 0xea, 0x3f, 0x0a, 0x19, 0xc2, 0x6c, 0xe3, 0xd4, 
+0xc7, 0x26, 0xf9, 0x15, 0xf7, 0x3e, 0xb4, 0xd6, 0x2c, 0x6f, 0xb1, 0xa8, 0x15, 0x9f, 0x0a, 0x38, 
+0x12, 0x6b, 0x1c, 0x8b, 0x52, 0xe4, 0xcf, 0x1a, 0x3e, 0xb1, 0x54, 0x07, 0x80, 0xb4, 0xc5, 0x3d, 
+0x17, 0x45, 0x14, 0x9b, 0x2e, 0xc1, 0xd7, 0xe6, 0xa3, 0xf9, 0x3d, 0x70, 0x9a, 0x71, 0xe2, 0x2c, 
+0x47, 0xa7, 0xca, 0x12, 0x41, 0x84, 0x95, 0x17, 0x2d, 0x51, 0xb8, 0x0f, 0xb5, 0xfc, 0x1a, 0xc8, 
+0x57, 0x18, 0xec, 0x9f, 0xc6, 0x82, 0x53, 0x14, 0xc0, 0x2b, 0xc0, 0xa7, 0x3a, 0x0b, 0x51, 0xda, 
+0x35, 0x7b, 0x42, 0x7e, 0x38, 0x91, 0xe2, 0x75, 0xb0, 0x3f, 0x1e, 0x25, 0xb0, 0x7b, 0x85, 0xd6, 
+0xb3, 0xa1, 0x8a, 0x61, 0x8e, 0xda, 0x52, 0xcd, 0x90, 0x25, 0x78, 0x05, 0x81, 0x73, 0x7d, 0xeb, 
+0x37, 0xc6, 0x8d, 0x5c, 0xdf, 0xa5, 0x74, 0xe3, 0x8d, 0xa6, 0x7b, 0x5d, 0x07, 0x6d, 0x9f, 0xc5, 
+0xa4, 0x82, 0xdf, 0xb8, 0xeb, 0x0b, 0xf7, 0xc6, 0xf8, 0x69, 0x38, 0x40, 0xc1, 0xbe, 0x05, 0xaf, 
+0x6c, 0x08, 0xca, 0xf6, 0x1c, 0x30, 0xd6, 0xd6, 0x7a, 0xf7, 0x08, 0xcb, 0xe0, 0xa6, 0x3e, 0x96, 
+0x2d, 0x7a, 0x6f, 0x25, 0x9c, 0x3d, 0x37, 0x15, 0xa4, 0xbb, 0x9d, 0xfb, 0x96, 0x83, 0x78, 0x65, 
+0xf9, 0x42, 0x96, 0x0e, 0x9f, 0x0c, 0xe8, 0x1f, 0xb6, 0xc5, 0x69, 0xc1, 0xe6, 0xc4, 0x57, 0x4f, 
+0x9d, 0x26, 0xe3, 0xf0, 0x4d, 0xf5, 0x72, 0xcf, 0x35, 0x0b, 0x48, 0xa3, 0x6b, 0xcf, 0x14, 0xbc, 
+0xfa, 0x4c, 0x05, 0x24, 0xf0, 0xa2, 0x3e, 0x29, 0x70, 0x39, 0xd2, 0x6a, 0x0b, 0x30, 0x3e, 0x64, 
+0xf8, 0x2b, 0x07, 0x2e, 0x1f, 0xc5, 0x90, 0x64, 0x52, 0xda, 0x3d, 0x05, 0xa0, 0x4b, 0xe2, 0xb9, 
+0x7d, 0x5a, 0x48, 0xd3, 0x25, 0xf4, 0xa4, 0x70, 0xe8, 0x6f, 0x43, 0x8f, 0xc3, 0xd2, 0xdf, 0x26, 
+0x93, 0xfd, 0x25, 0x83, 0xa1, 0x84, 0x06, 0xe9, 0x60, 0xea, 0x0b, 0x6d, 0x20, 0xf6, 0x17, 0x25, 
+0xe3, 0xae, 0xf1, 0xdb, 0x17, 0xed, 0x8f, 0x73, 0xb2, 0x86, 0x3a, 0x54, 0x70, 0xe3, 0xb8, 0xe6, 
+0x49, 0xa0, 0xc9, 0xa1, 0x64, 0xac, 0x28, 0x96, 0x79, 0x3d, 0xb4, 0x90, 0xa7, 0xe1, 0xcf, 0x07, 
+0xe9, 0x4a, 0xd9, 0xe2, 0x39, 0xdf, 0x89, 0xa7, 0xd8, 0x4c, 0xb9, 0x04, 0x5b, 0xe6, 0x0b, 0xe4, 
+0xf7, 0xcf, 0x98, 0x1c, 0xa4, 0xe3, 0x9d, 0x46, 0x93, 0xb1, 0x7a, 0x2a, 0x8e, 0x76, 0x18, 0x37, 
+0xe2, 0x7f, 0x06, 0xdf, 0x42, 0x70, 0xcb, 0x18, 0xbd, 0x93, 0x61, 0xd9, 0xb5, 0xa2, 0x9b, 0x19, 
+0x04, 0x96, 0xa3, 0x4a, 0xc5, 0x78, 0xb1, 0xfc, 0x4e, 0x2e, 0xb3, 0x47, 0xc9, 0x68, 0x5f, 0x38, 
+0xa7, 0xd3, 0x9e, 0xa0, 0x8d, 0x40, 0x94, 0x3e, 0x90, 0x5c, 0x13, 0xa5, 0x6a, 0x4e, 0x70, 0x9d, 
+0x2a, 0xd4, 0x2a, 0x03, 0xcf, 0x28, 0xe3, 0xd8, 0xc3, 0xf5, 0x0b, 0xc2, 0xe1, 0x80, 0x2e, 0x68, 
+0xc4, 0x69, 0x37, 0x5c, 0x13, 0x80, 0x36, 0x84, 0x70, 0x52, 0x6c, 0x06, 0xb2, 0xe1, 0x75, 0xaf, 
+0xca, 0x2f, 0x7a, 0x19, 0x51, 0x84, 0x1b, 0x72, 0x60, 0xa7, 0x51, 0xbd, 0x28, 0x6e, 0xd3, 0xec, 
+0x03, 0x94, 0xce, 0xac, 0x19, 0xc5, 0xa3, 0x51, 0x3e, 0x8f, 0x26, 0xf1, 0x75, 0xb1, 0xeb, 0x53, 
+0xf4, 0x0c, 0xe7, 0x5e, 0x5b, 0xe5, 0x97, 0x0e, 0x13, 0x1c, 0x4a, 0x70, 0xb9, 0x5d, 0x79, 0xca, 
+0x3f, 0x24, 0xa1, 0xce, 0x4c, 0x60, 0x4c, 0x64, 0xb1, 0x6c, 0x5b, 0x86, 0xc3, 0xa6, 0x4b, 0xd0, 
+0xec, 0x1d, 0x2f, 0xc6, 0x1b, 0x86, 0xf7, 0x4b, 0x71, 0x5b, 0x60, 0x52, 0xe0, 0x89, 0x7f, 0x35, 
+0xca, 0x6c, 0xb7, 0x3d, 0x2a, 0xf8, 0x1d, 0x92, 0xe5, 0xf7, 0xcb, 0x0f, 0xa8, 0xe1, 0xbe, 0x3f, 
+0x36, 0x9f, 0x3d, 0x82, 0x67, 0x18, 0x4d, 0x83, 0xbc, 0x26, 0xe5, 0xdf, 0xc8, 0xd3, 0xfc, 0x80, 
+0xfa, 0x40, 0x85, 0x67, 0xfb, 0x1f, 0x82, 0x45, 0xf4, 0xb1, 0x8e, 0x8c, 0xa9, 0xb3, 0xd9, 0x4a, 
+0xe0, 0x7c, 0x8e, 0x72, 0x8d, 0x67, 0xb0, 0x3c, 0x72, 0x0c, 0x1f, 0xb5, 0x9d, 0xa6, 0xe2, 0xd6, 
+0x37, 0x1a, 0x0f, 0x26, 0x57, 0xbe, 0xd9, 0x74, 0x15, 0x9b, 0xf8, 0x2d, 0x7e, 0x92, 0xd0, 0xf2, 
+0x5f, 0xb2, 0xf8, 0xc1, 0x83, 0x97, 0xb5, 0x38, 0xf4, 0x70, 0x9c, 0xe5, 0xd9, 0x7e, 0x4c, 0x8b, 
+0xa6, 0xe1, 0x4d, 0x80, 0xe3, 0x4f, 0x59, 0x1f, 0x50, 0xb3, 0xeb, 0x46, 0xac, 0x29, 0x5e, 0x26, 
+0xdb, 0x4a, 0x74, 0x19, 0xc5, 0xa4, 0x70, 0xc3, 0xe0, 0xc4, 0xc2, 0x6f, 0x0e, 0x7a, 0xb0, 0x73, 
+0x15, 0xe0, 0x86, 0x47, 0x5c, 0x2b, 0xfb, 0x29, 0x15, 0xda, 0x06, 0x9d, 0x06, 0x8d, 0x2b, 0x07, 
+0x50, 0x61, 0x75, 0xb3, 0xd4, 0x2a, 0x40, 0x3a, 0xc1, 0xa2, 0x5f, 0x4d, 0x9f, 0x86, 0x3d, 0x83, 
+0x7f, 0x49, 0x05, 0x89, 0xfc, 0xe4, 0x5b, 0x1e, 0x90, 0x81, 0x63, 0x0f, 0xa2, 0xe1, 0x5a, 0x1f, 
+0x53, 0xaf, 0x73, 0xa9, 0x70, 0xd8, 0x04, 0x65, 0xbf, 0x50, 0xad, 0x19, 0xc3, 0xed, 0x13, 0x29, 
+0x0c, 0x31, 0x97, 0xf3, 0x47, 0xcb, 0x2a, 0x47, 0xb7, 0xa1, 0xd0, 0xab, 0x6c, 0x75, 0x28, 0xae, 
+0x19, 0x4b, 0x18, 0xc9, 0x31, 0x6f, 0x29, 0xd8, 0x1d, 0x0b, 0x6a, 0xb4, 0x9f, 0x5b, 0xe0, 0xad, 
+0x49, 0x3d, 0x29, 0x4a, 0xb7, 0x9b, 0x2a, 0xe1, 0xb9, 0x17, 0x70, 0x4d, 0x93, 0x74, 0xbe, 0x17, 
+0xb3, 0xf6, 0x49, 0xe4, 0xdf, 0x4e, 0xa0, 0xe2, 0x89, 0xf1, 0x6c, 0x9e, 0x64, 0xf8, 0xd2, 0xa6, 
+0x1a, 0x4d, 0x96, 0x2e, 0x0b, 0x23, 0xfd, 0x24, 0x1b, 0x26, 0xd8, 0x37, 0xe4, 0xc2, 0xfb, 0x6d, 
+0xb7, 0x9d, 0x38, 0x09, 0xb1, 0x61, 0x46, 0xc1, 0xd4, 0x95, 0xae, 0x92, 0x72, 0xe4, 0x86, 0x2e, 
+0x50, 0x95, 0x8b, 0x6e, 0x46, 0xfd, 0xb1, 0x5d, 0x12, 0xb5, 0xe6, 0x1f, 0x90, 0x38, 0x7e, 0x48, 
+0x2e, 0x4d, 0xc5, 0x03, 0x87, 0xdf, 0x36, 0x40, 0x85, 0xc1, 0xd5, 0xb7, 0xf3, 0x8e, 0x2e, 0x51, 
+0x7a, 0x37, 0x95, 0x73, 0x68, 0x15, 0xe8, 0xcf, 0x61, 0x46, 0x4c, 0xf3, 0x6d, 0xe5, 0xda, 0xe6, 
+0xbf, 0x6c, 0x85, 0x3e, 0xa5, 0x0a, 0x3d, 0x62, 0x18, 0x9c, 0x28, 0xd6, 0xb5, 0xe7, 0xbf, 0x18, 
+0x2c, 0x40, 0xb7, 0x80, 0xb3, 0x5c, 0x0b, 0x4a, 0x6c, 0x8a, 0x6b, 0xac, 0x57, 0x83, 0xae, 0x9b, 
+0x67, 0xaa, 0x58, 0x91, 0x48, 0x26, 0xce, 0x7d, 0x4c, 0x8b, 0xd9, 0xe2, 0x6e, 0xb3, 0x71, 0xeb, 
+0xd9, 0xa3, 0xfc, 0x7a, 0xb7, 0xb6, 0xfd, 0xa3, 0xb8, 0x05, 0x26, 0xc8, 0xaf, 0x70, 0x8c, 0x2d, 
+0x5d, 0xce, 0x36, 0xc5, 0x19, 0xa1, 0x8d, 0x6f, 0xc2, 0x06, 0x8a, 0xed, 0xbf, 0x97, 0xa0, 0x42, 
+0xa6, 0x2c, 0x93, 0x8f, 0xa0, 0xd2, 0xe1, 0xca, 0xe0, 0xfb, 0x35, 0x12, 0x8c, 0xfd, 0x09, 0x18, 
+0xa4, 0x03, 0x93, 0x18, 0x40, 0x91, 0x2d, 0x9c, 0x28, 0xec, 0x70, 0xbf, 0x9b, 0x36, 0xf4, 0x71, 
+0xc0, 0x39, 0x24, 0x53, 0x7e, 0xb6, 0x3e, 0x4c, 0xf7, 0xe2, 0xa7, 0xf8, 0x15, 0xe0, 0x71, 0x38, 
+0xe0, 0xfd, 0x10, 0x54, 0xdf, 0x41, 0xe2, 0xd3, 0xec, 0x07, 0x3b, 0x52, 0x8f, 0x03, 0xe0, 0x5b, 
+0xa8, 0x1f, 0xc5, 0x83, 0x14, 0x6c, 0x1e, 0x42, 0x4e, 0x12, 0x40, 0x51, 0x7a, 0xc9, 0xae, 0x03, 
+0x96, 0x39, 0xe3, 0xa4, 0x2a, 0x15, 0xb2, 0x9f, 0xb3, 0x6f, 0x32, 0x9b, 0x45, 0xad, 0x2c, 0x17, 
+0x36, 0x2e, 0x3f, 0x9c, 0x17, 0xb5, 0x70, 0xd6, 0x2c, 0x48, 0x94, 0xf2, 0x4c, 0x7a, 0x7d, 0xae, 
+0x51, 0xa3, 0xa7, 0x5b, 0x2e, 0x8c, 0xbf, 0x5c, 0xe2, 0xcf, 0xa7, 0x04, 0x63, 0x71, 0xb5, 0x85, 
+0x0d, 0x70, 0xb5, 0xca, 0x4f, 0x6d, 0xc8, 0xeb, 0xa5, 0x19, 0xda, 0x15, 0x90, 0x86, 0xe3, 0x0d, 
+0x3d, 0x4c, 0xf4, 0x9f, 0x5b, 0x94, 0x6c, 0x8e, 0x20, 0x97, 0xb4, 0x7a, 0x65, 0xaf, 0xd4, 0x0a, 
+0xc6, 0x5a, 0x74, 0x81, 0x36, 0x24, 0xb0, 0x4a, 0xf0, 0x8b, 0x50, 0x9d, 0x06, 0xc9, 0xa7, 0xcf, 
+0xd2, 0x35, 0xe8, 0x4b, 0xe2, 0xd1, 0x57, 0x9f, 0x86, 0x7f, 0x90, 0xe3, 0x7d, 0x0a, 0x7c, 0x70, 
+0xe8, 0x9e, 0x49, 0x52, 0xb0, 0xa4, 0x68, 0x5e, 0xd9, 0xf1, 0xae, 0x4c, 0x8e, 0x6b, 0x1d, 0x57, 
+0x96, 0x14, 0xc0, 0x67, 0x3d, 0x85, 0xee, 0x4c, 0xf6, 0x17, 0x26, 0x1a, 0x37, 0x84, 0x5d, 0x8f, 
+0xbd, 0x9e, 0x29, 0xe3, 0xc4, 0x2e, 0x91, 0xe2, 0x79, 0x1a, 0x05, 0x90, 0xf2, 0x8e, 0x07, 0x2d, 
+0x3b, 0xd2, 0xc5, 0xb7, 0xb9, 0x28, 0xad, 0x62, 0x13, 0x82, 0xbf, 0x62, 0x3c, 0xd3, 0xf0, 0xc1, 
+0x9e, 0x39, 0x18, 0xf3, 0xd2, 0x9e, 0x26, 0xcd, 0xfa, 0xd8, 0x9e, 0x7c, 0x6a, 0xd3, 0x97, 0x6b, 
+0xf8, 0x3e, 0xd8, 0x39, 0x46, 0xf0, 0x71, 0xc5, 0x7c, 0x4f, 0xbc, 0x05, 0xe0, 0xc3, 0xd8, 0x61, 
+0x5c, 0x84, 0xe5, 0x1b, 0x37, 0x13, 0x0f, 0xc8, 0xe7, 0xcd, 0x1b, 0x20, 0x64, 0x3d, 0x57, 0x91, 
+0x57, 0x3f, 0x6a, 0x80, 0xeb, 0x2f, 0x82, 0x9f, 0xb0, 0x74, 0x21, 0x83, 0x09, 0xa5, 0xde, 0x8b, 
+0x5d, 0x60, 0x3a, 0x1b, 0x12, 0x75, 0x4f, 0x17, 0xaf, 0x87, 0xc6, 0x83, 0xeb, 0x63, 0x8d, 0x63, 
+0xd7, 0xa3, 0x5c, 0x6f, 0x84, 0x15, 0x89, 0x15, 0x6e, 0x16, 0x30, 0xeb, 0xad, 0x7e, 0x3a, 0x1d, 
+0xb6, 0x85, 0xa8, 0x6f, 0x20, 0xb6, 0x27, 0xb6, 0x94, 0x1c, 0xaf, 0x09, 0x40, 0xe6, 0x32, 0xd2, 
+0x5e, 0x12, 0xfa, 0xd5, 0x19, 0x50, 0x51, 0x6b, 0x08, 0xbc, 0x39, 0xf2, 0x0a, 0x86, 0x28, 0x13, 
+0xc9, 0x25, 0x4a, 0xb2, 0xe9, 0x2b, 0x2d, 0xaf, 0x2d, 0xc7, 0xb6, 0x49, 0x1f, 0x81, 0x9e, 0x7a, 
+0x8c, 0x0a, 0x2c, 0x3b, 0x1a, 0x0d, 0x42, 0xc3, 0xd5, 0xae, 0x5d, 0x43, 0xa9, 0xfd, 0x9c, 0x7a, 
+0xd4, 0xf9, 0x04, 0x92, 0x09, 0xfc, 0xbe, 0x48, 0x5f, 0x0b, 0xd6, 0xa3, 0x61, 0xd5, 0x30, 0xdb, 
+0x50, 0xe4, 0xfb, 0x1b, 0x41, 0xc6, 0xe9, 0x0a, 0x2c, 0x9f, 0xa2, 0xfe, 0x14, 0xc7, 0xa2, 0x74, 
+0xc0, 0x95, 0x18, 0x4a, 0x9e, 0x20, 0xb4, 0xd9, 0xc8, 0x5e, 0xad, 0x50, 0xe8, 0xf5, 0x38, 0xc3, 
+0x57, 0xb1, 0x5f, 0x80, 0xb8, 0x74, 0xc1, 0x32, 0xec, 0xa7, 0xbf, 0x2e, 0xd5, 0xa2, 0xd6, 0xae, 
+0x8d, 0x31, 0xea, 0xdb, 0x69, 0xeb, 0x1e, 0x6d, 0x47, 0xf6, 0x09, 0x48, 0x65, 0xe8, 0x5d, 0x2d, 
+0x53, 0x45, 0x7c, 0x4f, 0x2e, 0x7b, 0x84, 0xf6, 0xec, 0x98, 0x1b, 0xf1, 0x86, 0x08, 0x37, 0xe6, 
+0x15, 0x2b, 0x36, 0xf5, 0x71, 0xb3, 0x7c, 0x4e, 0xb2, 0x57, 0x17, 0x5d, 0x6c, 0xa8, 0x30, 0xc8, 
+0xe4, 0xb2, 0xaf, 0x41, 0x7a, 0xc7, 0x92, 0x6e, 0x8a, 0xf1, 0x83, 0xd6, 0x5e, 0x70, 0x4c, 0x93, 
+0xa8, 0xfb, 0xec, 0x58, 0xf3, 0x6c, 0xdb, 0x7f, 0x24, 0xd9, 0xe2, 0x36, 0x41, 0xc3, 0x4f, 0x1a, 
+0x2b, 0x69, 0x15, 0x7b, 0xf2, 0x4c, 0x9a, 0x6b, 0x41, 0xce, 0x58, 0xf6, 0x74, 0x21, 0xda, 0x74, 
+0x81, 0xe4, 0x79, 0x13, 0x57, 0xb5, 0x94, 0x6f, 0x34, 0x17, 0x83, 0x0a, 0x80, 0x3a, 0xc6, 0x1d, 
+0xa0, 0x1b, 0x2a, 0x0b, 0x7b, 0xae, 0x20, 0xa5, 0x39, 0x5f, 0x60, 0xd9, 0x74, 0x2e, 0x67, 0x94, 
+0xbe, 0x1a, 0xc1, 0xb8, 0xdc, 0x70, 0x8d, 0x02, 0xe8, 0x6d, 0xa1, 0x6f, 0x7c, 0x3a, 0x2f, 0x90, 
+0x39, 0x41, 0xe9, 0x5b, 0x0d, 0x91, 0xe7, 0x9c, 0x92, 0x48, 0x05, 0xd7, 0x05, 0x27, 0xb1, 0xe9, 
+0x0b, 0x3d, 0x65, 0x07, 0xd2, 0x05, 0x39, 0x14, 0x71, 0xea, 0x40, 0x5c, 0xca, 0x63, 0xc7, 0x0d, 
+0xbf, 0x89, 0x06, 0x9c, 0x74, 0x0d, 0xeb, 0x1e, 0x98, 0xd6, 0xe0, 0x4d, 0xfa, 0x69, 0x04, 0xab, 
+0x9d, 0xe4, 0x69, 0x0c, 0xa3, 0x6e, 0x05, 0xcb, 0x2f, 0x0c, 0xe0, 0x78, 0x0c, 0xda, 0xf9, 0x5e, 
+0xb5, 0xd8, 0xe5, 0xf3, 0xc9, 0xf4, 0xe3, 0x7f, 0x61, 0xc6, 0xf4, 0x8c, 0xd0, 0x4c, 0x2a, 0x31, 
+0x8b, 0x5c, 0x3d, 0x05, 0xc3, 0x94, 0xf2, 0x90, 0xf3, 0x6e, 0xa4, 0xb9, 0xc3, 0x0f, 0x5c, 0x93, 
+0x15, 0xd9, 0xd3, 0xcb, 0x2e, 0xd6, 0x7f, 0x42, 0x76, 0x5c, 0x86, 0x0e, 0x3f, 0xd3, 0xcf, 0x3a, 
+0x4c, 0xbd, 0x45, 0xc4, 0x8a, 0x18, 0xce, 0xb6, 0x9c, 0x68, 0x1e, 0xcd, 0xab, 0x47, 0x26, 0xe1, 
+0x0f, 0x81, 0x6a, 0xf9, 0x52, 0x7d, 0xc8, 0x35, 0xdf, 0x3a, 0x29, 0x63, 0x05, 0xb3, 0x18, 0x39, 
+0x50, 0x2f, 0xb7, 0xe1, 0x05, 0x8b, 0xf3, 0xd5, 0xf9, 0xc2, 0xbf, 0x79, 0x4d, 0x69, 0x2b, 0xd2, 
+0x5a, 0x36, 0x2d, 0x71, 0x6c, 0x19, 0x30, 0xb7, 0x53, 0x71, 0x8c, 0x92, 0x8e, 0x03, 0x9b, 0x17, 
+0x6b, 0x81, 0xe9, 0x5f, 0x0e, 0x3a, 0x18, 0xbf, 0x27, 0xd6, 0xc6, 0x57, 0x4d, 0x95, 0x13, 0x6e, 
+0x19, 0xb8, 0x20, 0xa6, 0xc8, 0xf0, 0x65, 0x8f, 0x57, 0x0b, 0x2c, 0x9d, 0xa3, 0xe1, 0x35, 0xb3, 
+0x76, 0xa1, 0x9b, 0x26, 0xe9, 0x60, 0xaf, 0x62, 0xfd, 0x53, 0xa1, 0x2f, 0x14, 0xeb, 0x7a, 0x60, 
+0x8e, 0x09, 0xf9, 0xb4, 0xb8, 0x3e, 0xb4, 0x81, 0xe3, 0x61, 0x4a, 0xe0, 0x2a, 0x68, 0x4d, 0x7a, 
+0xd1, 0x79, 0xd6, 0xf2, 0x7d, 0x83, 0x2c, 0x34, 0x9c, 0x29, 0x14, 0x82, 0x41, 0x6a, 0x83, 0x0e, 
+0x3a, 0x83, 0x75, 0x3b, 0xf8, 0xc0, 0x5c, 0x3d, 0x3f, 0x42, 0xda, 0x81, 0xcd, 0x9a, 0xc5, 0xe3, 
+0x4a, 0x7d, 0x5d, 0x3e, 0x2f, 0xa5, 0x7c, 0x6a, 0xc4, 0x97, 0xf5, 0x3a, 0x84, 0xf1, 0x83, 0xeb, 
+0x2a, 0x0c, 0xfa, 0xd7, 0x57, 0xe4, 0x6d, 0xe4, 0x2a, 0x73, 0xb1, 0x71, 0xa4, 0xf8, 0x50, 0x61, 
+0xf4, 0x9b, 0xf9, 0xd1, 0x8c, 0x06, 0x5e, 0x8b, 0x1f, 0x28, 0x3c, 0x09, 0x4b, 0x6e, 0x48, 0x7d, 
+0x58, 0x0d, 0x42, 0xf3, 0x52, 0xc6, 0x1d, 0x38, 0xe4, 0xc2, 0x5e, 0x26, 0xca, 0xbf, 0x2c, 0x79, 
+0xb5, 0x1f, 0xc0, 0xf3, 0xcf, 0x4e, 0x5c, 0xab, 0xe4, 0xca, 0x5d, 0x6b, 0xf7, 0x3e, 0x6c, 0xae, 
+0xb7, 0xf3, 0x5d, 0xb7, 0x51, 0xe1, 0xf9, 0xae, 0x49, 0x1e, 0x7a, 0x18, 0x9a, 0x7e, 0x56, 0xf4, 
+0x2e, 0x52, 0x60, 0x1b, 0xcf, 0x48, 0x1b, 0x79, 0x4c, 0x03, 0xe4, 0x2d, 0x68, 0x1c, 0x0d, 0x61, 
+0xc0, 0xba, 0x0d, 0xc1, 0x6e, 0x84, 0x78, 0x04, 0x2d, 0x3c, 0x18, 0xb9, 0x0e, 0x4a, 0x9e, 0xd9, 
+0x2b, 0xc3, 0xae, 0x7c, 0x2b, 0x07, 0x2a, 0x6c, 0x4e, 0xae, 0x47, 0x04, 0x73, 0xb5, 0xd7, 0x8e, 
+0x17, 0x0c, 0x9d, 0x3a, 0xb6, 0xf3, 0xb9, 0x7b, 0x6d, 0xa3, 0xe7, 0x15, 0x60, 0x7a, 0x90, 0xad, 
+0x40, 0x78, 0x51, 0xf4, 0x8d, 0x7b, 0x52, 0x49, 0x58, 0x2b, 0x08, 0x14, 0x16, 0xe1, 0x79, 0x08, 
+0x2b, 0x0a, 0x7d, 0x06, 0x92, 0xd0, 0xc6, 0x29, 0xdc, 0x4b, 0xd1, 0x60, 0x27, 0xe3, 0x8b, 0xf4, 
+0x60, 0x8b, 0x1c, 0x29, 0xa6, 0x0b, 0xf9, 0x7d, 0x60, 0x2a, 0x6f, 0x12, 0x85, 0x7d, 0x81, 0xb3, 
+0x0f, 0x36, 0x8a, 0xe5, 0xe9, 0x65, 0x83, 0x97, 0xb4, 0x2d, 0x15, 0xca, 0xfa, 0x09, 0xf5, 0x37, 
+0xdc, 0x15, 0xc2, 0x4e, 0x68, 0x15, 0xfb, 0x49, 0x68, 0xd4, 0xe5, 0x1f, 0x25, 0x18, 0xd2, 0xfd, 
+0xca, 0x6e, 0xa1, 0x53, 0xad, 0x42, 0xf1, 0x60, 0xc2, 0x95, 0x0d, 0x1e, 0x90, 0xf8, 0x46, 0xaf, 
+0xf3, 0xdf, 0x6c, 0x37, 0x9f, 0x3d, 0xa6, 0xb3, 0x4e, 0x03, 0x9b, 0x6c, 0x0a, 0x6a, 0x3f, 0x7c, 
+0x39, 0x82, 0xf4, 0xce, 0x64, 0xf8, 0x52, 0x3a, 0x41, 0xe8, 0x91, 0xf4, 0x07, 0x93, 0x6c, 0x85, 
+0xd6, 0xb4, 0xd5, 0x0e, 0xc2, 0xd8, 0x3e, 0x75, 0xe8, 0xc3, 0x4e, 0x52, 0x85, 0xde, 0x94, 0xad, 
+0xeb, 0x1b, 0x95, 0xf8, 0x7a, 0xec, 0x24, 0x27, 0x42, 0xec, 0x2f, 0x50, 0xf8, 0x9b, 0xf2, 0xd3, 
+0x85, 0x6e, 0x4a, 0x08, 0x52, 0x8f, 0x73, 0x85, 0x0e, 0x97, 0x12, 0xd0, 0x5e, 0x16, 0x89, 0x3b, 
+0x79, 0xb3, 0xca, 0x59, 0x21, 0x70, 0x4d, 0xbf, 0x6c, 0x97, 0xa5, 0xe9, 0x37, 0xe8, 0xa5, 0xc2, 
+0x47, 0x31, 0xcb, 0x2c, 0xa8, 0x12, 0x4b, 0x05, 0xd1, 0xc4, 0x0d, 0x81, 0xca, 0x2e, 0x8d, 0x2e, 
+0x4f, 0x3d, 0x17, 0x5a, 0xfd, 0x06, 0xba, 0x13, 0xa9, 0xd1, 0xcb, 0xf6, 0xea, 0x57, 0x4e, 0xab, 
+0x6f, 0x28, 0x40, 0xea, 0xbf, 0x08, 0x21, 0x7b, 0x63, 0xe5, 0x0a, 0xc0, 0x31, 0xa7, 0x8c, 0x2a, 
+0xfb, 0x73, 0xc0, 0x75, 0x08, 0x4f, 0x26, 0xad, 0x49, 0x50, 0x9f, 0xcb, 0x90, 0x74, 0xba, 0x4a, 
+0xd3, 0x06, 0x79, 0xb6, 0x1b, 0x87, 0x2d, 0xcf, 0x6a, 0x3d, 0x0a, 0xbf, 0xa2, 0xdb, 0x58, 0x3f, 
+0xca, 0x3c, 0xf0, 0xcd, 0x80, 0xf6, 0x09, 0x16, 0xbf, 0xe8, 0x62, 0x90, 0x83, 0xe1, 0x48, 0xbf, 
+0x45, 0x1e, 0x73, 0x68, 0xfb, 0x59, 0xe0, 0x93, 0x4c, 0xb6, 0xe8, 0xea, 0x25, 0x68, 0xe2, 0x9f, 
+0x56, 0x9c, 0x40, 0x89, 0x17, 0xc5, 0x9b, 0xe2, 0x57, 0x4a, 0xd5, 0x7f, 0x70, 0x36, 0x49, 0x18, 
+0xc2, 0xb3, 0xc1, 0x75, 0x3c, 0xea, 0xcf, 0x37, 0x32, 0x9c, 0xaf, 0x94, 0x39, 0xb6, 0xf4, 0x69, 
+0xdf, 0x5e, 0x0a, 0x63, 0x09, 0x15, 0x2f, 0xb3, 0xea, 0x61, 0xd7, 0x0c, 0x21, 0xd7, 0xb6, 0x13, 
+0xdc, 0xf1, 0x86, 0xe2, 0x16, 0xec, 0x40, 0x5e, 0xc0, 0xf2, 0xb8, 0x41, 0xeb, 0x95, 0x6c, 0x16, 
+0x73, 0x4a, 0xec, 0x97, 0x05, 0x81, 0xb4, 0x26, 0x5d, 0x4e, 0x74, 0xe8, 0x35, 0x2c, 0xbe, 0x74, 
+0x1b, 0x59, 0xc2, 0x07, 0xad, 0xb2, 0x4f, 0xba, 0x1c, 0xd8, 0x45, 0xf1, 0x2e, 0x07, 0x91, 0x47, 
+0x9b, 0xe3, 0xa5, 0x7b, 0x31, 0xd3, 0x6f, 0x5b, 0xc6, 0x90, 0xd4, 0x20, 0x9c, 0x3e, 0x08, 0x2b, 
+0x5c, 0xe7, 0xa5, 0xd7, 0x04, 0xd8, 0xf2, 0xd8, 0x1a, 0x05, 0x79, 0x15, 0x9d, 0x64, 0xe6, 0x1c, 
+0xf0, 0x7a, 0x81, 0xbe, 0x26, 0xb2, 0x15, 0xd8, 0xe4, 0xce, 0x86, 0xc5, 0x2c, 0x94, 0xca, 0x35, 
+0xfb, 0x3e, 0x48, 0x71, 0xa6, 0x95, 0xd0, 0x7c, 0x95, 0xad, 0x2f, 0x83, 0x94, 0xd5, 0x09, 0x63, 
+0x72, 0x0e, 0x42, 0x9d, 0x1c, 0x80, 0x31, 0x5b, 0x2f, 0xa7, 0xe7, 0x9f, 0x1a, 0x28, 0xcb, 0xf0, 
+0xd7, 0xa3, 0x41, 0xae, 0xc6, 0xd3, 0xf7, 0xd3, 0x1c, 0x69, 0xc0, 0x75, 0x32, 0x60, 0xb7, 0xd8, 
+0x9b, 0x53, 0xd5, 0xcf, 0x1c, 0x09, 0x6c, 0x0d, 0x98, 0xf0, 0x7a, 0x13, 0xe4, 0x2f, 0xa6, 0x8e, 
+0xb6, 0x1c, 0x93, 0xec, 0x14, 0x9e, 0x0f, 0x24, 0xc9, 0x50, 0x69, 0x4e, 0xc6, 0x82, 0x3b, 0xdc, 
+0x1f, 0x50, 0x73, 0xd8, 0x5d, 0x12, 0xdc, 0x35, 0x89, 0x48, 0xcf, 0x92, 0xb6, 0x7a, 0x49, 0x18, 
+0xd7, 0x3f, 0x82, 0xe8, 0x69, 0x80, 0x2e, 0xaf, 0x48, 0x23, 0xae, 0x35, 0xbe, 0x18, 0x3a, 0xd5, 
+0x27, 0xac, 0x6f, 0xdb, 0x4d, 0x8a, 0xcf, 0x84, 0xe9, 0xf6, 0x7e, 0x94, 0x8d, 0x64, 0x2c, 0xa3, 
+0x7b, 0x91, 0x52, 0x3b, 0x91, 0xc7, 0xf6, 0xb3, 0x80, 0xa1, 0x6b, 0x95, 0xe8, 0x24, 0xe9, 0x1e, 
+0xd9, 0x4a, 0xe2, 0x64, 0x74, 0xf8, 0xc0, 0xa3, 0x68, 0x4f, 0x13, 0xe4, 0x2b, 0x5b, 0x9d, 0xc7, 
+0x08, 0xa3, 0x70, 0xda, 0x5f, 0x27, 0x96, 0x4a, 0x82, 0xb3, 0x28, 0xb6, 0xaf, 0x72, 0xcb, 0x50, 
+0xa4, 0xdd, 0xf0, 0x64, 0xa7, 0x3b, 0xa8, 0x1a, 0x4b, 0xf3, 0x59, 0x70, 0xc1, 0xdf, 0x63, 0x5d, 
+0x13, 0xf0, 0x1d, 0x6b, 0x0a, 0x1b, 0x50, 0xd4, 0x1c, 0x6a, 0xc4, 0xd5, 0x0e, 0xbd, 0x71, 0x9f, 
+0x07, 0x36, 0x91, 0x7b, 0xf6, 0x3e, 0x81, 0x3a, 0x7f, 0x52, 0x71, 0xa3, 0x70, 0x5b, 0xc2, 0xf6, 
+0xd1, 0xb0, 0x95, 0x0d, 0x8e, 0x5c, 0x9d, 0x67, 0x4f, 0x58, 0x04, 0xe2, 0x5f, 0x47, 0xc0, 0x52, 
+0xaf, 0x08, 0x5b, 0x64, 0x8b, 0xf1, 0x83, 0xaf, 0xa9, 0x1a, 0x26, 0x9e, 0x4b, 0x2d, 0x8a, 0x67, 
+0x1e, 0x61, 0x42, 0x59, 0xfb, 0xd1, 0xec, 0x43, 0x14, 0xd5, 0xbf, 0x0d, 0x6f, 0x5d, 0x86, 0xe3, 
+0x16, 0xea, 0x4e, 0x72, 0xf3, 0x67, 0x29, 0x8e, 0x2d, 0x9f, 0x2c, 0xe2, 0x79, 0x68, 0xb1, 0xef, 
+0xa3, 0x70, 0xa7, 0x1b, 0x79, 0xc5, 0xbf, 0x43, 0xf5, 0xe4, 0xa7, 0x9b, 0x2e, 0x4f, 0x60, 0x82, 
+0xc6, 0x40, 0x85, 0xc2, 0x4d, 0xbf, 0xbe, 0x40, 0xd9, 0x12, 0x4c, 0x09, 0xc1, 0x3e, 0x96, 0x0d, 
+0xb4, 0x2d, 0x35, 0xa0, 0x3a, 0x7f, 0xd6, 0xe4, 0x24, 0x0f, 0x38, 0xa1, 0x9e, 0x2a, 0xd9, 0x7a, 
+0x8b, 0x9e, 0x28, 0xfc, 0x74, 0xbd, 0x32, 0xcf, 0x30, 0x75, 0xce, 0x1b, 0x15, 0x6e, 0x3f, 0x51, 
+0xae, 0x97, 0x1b, 0xf9, 0xc5, 0xaf, 0x8e, 0xb1, 0x52, 0x6b, 0x52, 0x8b, 0xd8, 0xa0, 0xc1, 0x4a, 
+0x39, 0x0c, 0x4a, 0x0d, 0x92, 0x3c, 0x13, 0xd9, 0x8b, 0x1a, 0xc5, 0x73, 0xb6, 0x18, 0x46, 0x5b, 
+0x0d, 0x2e, 0xa6, 0x48, 0x5d, 0x92, 0xc4, 0xe9, 0x4e, 0x38, 0xd7, 0x2a, 0xc6, 0x82, 0xec, 0x3f, 
+0x70, 0x82, 0x9e, 0x7b, 0x9f, 0x7a, 0xcf, 0x6a, 0x81, 0x52, 0x57, 0x2c, 0x85, 0xeb, 0x75, 0xf2, 
+0x5d, 0x84, 0xbf, 0x5e, 0xa8, 0xf9, 0x17, 0xbe, 0x59, 0x42, 0x81, 0xa7, 0xcb, 0x67, 0x1e, 0x4c, 
+0x2b, 0x60, 0xc4, 0x1d, 0x05, 0x26, 0xd4, 0xb1, 0x3a, 0x61, 0xf7, 0x91, 0x6a, 0xd4, 0x79, 0x58, 
+0xbf, 0xc1, 0x7d, 0xb8, 0x06, 0x35, 0xc4, 0x50, 0x38, 0x3c, 0x06, 0x3a, 0xd7, 0x94, 0x97, 0xe1, 
+0x79, 0xe3, 0x86, 0x8c, 0x71, 0xea, 0x2f, 0xb5, 0x8f, 0xb7, 0x85, 0xa1, 0x5e, 0x94, 0xf2, 0xd0, 
+0xf4, 0x7d, 0xb0, 0x8f, 0x3c, 0x40, 0x3d, 0x12, 0xb3, 0xe5, 0xb3, 0xf0, 0xc6, 0x19, 0x25, 0x97, 
+0x19, 0xd7, 0x05, 0x1a, 0x5b, 0xc5, 0x3b, 0x15, 0x31, 0xd2, 0x53, 0x09, 0xde, 0x9c, 0x0f, 0xa3, 
+0x1f, 0x4a, 0xda, 0x8e, 0x6a, 0x0c, 0x13, 0x97, 0x21, 0xa6, 0xda, 0x28, 0x1e, 0xc7, 0xb4, 0xc2, 
+0x8e, 0xa3, 0xc6, 0x0f, 0x85, 0x37, 0xf2, 0x8f, 0x3e, 0xc0, 0xa5, 0x76, 0xe9, 0x5c, 0xa4, 0xd5, 
+0xbe, 0x92, 0x0d, 0x6c, 0x73, 0x8a, 0x49, 0x1d, 0x5a, 0xf0, 0xd8, 0x2e, 0xce, 0x14, 0xb8, 0xf4, 
+0x2e, 0x1f, 0x0c, 0x6f, 0x40, 0x6f, 0x3d, 0xe2, 0x9d, 0x57, 0x61, 0x47, 0xc0, 0x4d, 0x0f, 0xc6, 
+0xd0, 0x75, 0x0b, 0x6a, 0x9c, 0x03, 0xad, 0x94, 0xa9, 0x7b, 0xfa, 0x7e, 0x68, 0x1a, 0x78, 0x68, 
+0x2a, 0xe1, 0xbe, 0x0e, 0x43, 0x1b, 0xf8, 0x6d, 0x27, 0xf8, 0xd6, 0xdf, 0x96, 0xb4, 0x8e, 0xb4, 
+0x63, 0x78, 0x46, 0xd9, 0x7a, 0x60, 0x13, 0x4b, 0x29, 0xf8, 0x6a, 0xd2, 0x6c, 0x4e, 0x04, 0xf6, 
+0xc2, 0xa3, 0x0d, 0xf6, 0x05, 0x1d, 0x9b, 0x5a, 0x1c, 0xea, 0x69, 0xb6, 0x95, 0xb8, 0xd1, 0xf9, 
+0x0f, 0x18, 0x60, 0xe8, 0x23, 0x8c, 0xfa, 0x1f, 0xd5, 0x0b, 0x26, 0x3e, 0x2c, 0xb8, 0x3a, 0xb7, 
+0x6a, 0x75, 0xd1, 0x97, 0xca, 0x63, 0xda, 0x23, 0xac, 0x25, 0xb9, 0x05, 0xb2, 0x3e, 0x8c, 0xe9, 
+0x2a, 0x69, 0x74, 0xb2, 0x3f, 0xbe, 0x9c, 0x84, 0x17, 0xe5, 0xf2, 0x61, 0xe6, 0x82, 0x59, 0x5c, 
+0x1f, 0x4c, 0x0d, 0x1b, 0x4d, 0x57, 0xc4, 0xac, 0xbe, 0x63, 0xc4, 0xea, 0x0b, 0x31, 0xa0, 0x48, 
+0x2e, 0xc0, 0x9c, 0x17, 0xf0, 0xc2, 0xeb, 0x15, 0xc2, 0xd8, 0x7f, 0x90, 0x73, 0x62, 0xd0, 0x4f, 
+0x9b, 0x73, 0x59, 0xd7, 0x49, 0x5e, 0x85, 0x93, 0xb9, 0xf5, 0x24, 0xd3, 0x7d, 0x80, 0x14, 0xe2, 
+0x17, 0x34, 0x72, 0xb3, 0xc4, 0x2b, 0xe3, 0xa7, 0xf6, 0x05, 0x83, 0x47, 0x4c, 0x6d, 0xfc, 0xa8, 
+0x74, 0x61, 0xe4, 0x91, 0x40, 0xf9, 0xb3, 0x6d, 0x05, 0x8c, 0x57, 0x18, 0xd7, 0xad, 0x61, 0xa4, 
+0xf8, 0xa0, 0xb3, 0x06, 0xd3, 0xf2, 0x1e, 0x94, 0x89, 0x24, 0x31, 0xed, 0x2b, 0xa8, 0x2c, 0x7c, 
+0x50, 0xd1, 0xc4, 0x0d, 0x93, 0xb6, 0xf3, 0xa5, 0xf7, 0x0f, 0x83, 0x62, 0x70, 0xf9, 0x61, 0x97, 
+0x4d, 0x95, 0x7c, 0xea, 0x18, 0x73, 0xf6, 0x5e, 0x2a, 0x4a, 0x83, 0x6e, 0x08, 0xf5, 0xbc, 0x5d, 
+0xec, 0x4e, 0xb5, 0x8b, 0x04, 0xe1, 0xcb, 0x20, 0xad, 0x1f, 0x2a, 0x1e, 0x7d, 0x38, 0xcf, 0x09, 
+0xb2, 0x4b, 0xec, 0x5a, 0xdc, 0xf9, 0xe5, 0xd8, 0x6a, 0xd7, 0x95, 0xc1, 0x4b, 0xce, 0x6a, 0xe5, 
+0x19, 0x42, 0x70, 0x5f, 0xc0, 0x7d, 0x60, 0xfd, 0xb9, 0x23, 0x70, 0xf8, 0x24, 0xe1, 0x8f, 0xb5, 
+0xe1, 0x38, 0x1e, 0x73, 0xd6, 0x9f, 0x57, 0xac, 0x48, 0xbc, 0x5a, 0x07, 0xd6, 0xc8, 0x6a, 0x53, 
+0xf6, 0x51, 0xb4, 0x9f, 0x3b, 0x4f, 0x9e, 0x76, 0x28, 0xe2, 0x49, 0xe7, 0x19, 0xa5, 0xb1, 0xf5, 
+0x8a, 0x84, 0xd2, 0xc3, 0x6e, 0x2e, 0x28, 0x63, 0x5c, 0xe2, 0xa1, 0xb9, 0x8d, 0x6c, 0x0f, 0xa9, 
+0x4b, 0x39, 0x12, 0x61, 0xa8, 0x07, 0x91, 0xd6, 0x2e, 0x78, 0xaf, 0x35, 0xf7, 0x4b, 0x96, 0xd2, 
+0xb0, 0x69, 0x17, 0xa5, 0xf6, 0x39, 0x61, 0x73, 0x94, 0x10, 0xb6, 0x02, 0x7e, 0x03, 0x1d, 0x29, 
+0xad, 0x17, 0x2b, 0x08, 0xda, 0xf9, 0x3d, 0x61, 0x39, 0xfa, 0x3c, 0x53, 0x86, 0xdc, 0xea, 0x4b, 
+0xcf, 0x9b, 0x04, 0xd9, 0x05, 0xcf, 0xb5, 0xca, 0x07, 0x21, 0x4d, 0x82, 0xf1, 0x71, 0xe6, 0xdf, 
+0x1b, 0x0f, 0xd9, 0x07, 0xa0, 0x9d, 0x70, 0xa1, 0x7b, 0x87, 0x31, 0xab, 0xf0, 0x7c, 0x58, 0x0c, 
+0x3c, 0x32, 0xd7, 0x9d, 0x34, 0xc1, 0x5f, 0xba, 0x18, 0xba, 0x4f, 0x1b, 0xd0, 0x46, 0x8d, 0x35, 
+0x41, 0xf3, 0x57, 0xd2, 0xc6, 0x06, 0xeb, 0x84, 0x3b, 0x2d, 0x43, 0xfa, 0x59, 0xd0, 0x46, 0x89, 
+0xc3, 0x60, 0xc4, 0x78, 0x4f, 0x2b, 0xe3, 0x8e, 0x17, 0xde, 0x8b, 0xf0, 0x7e, 0x6c, 0x8a, 0xf9, 
+0xc5, 0x8f, 0x8c, 0x6f, 0x38, 0x29, 0xf9, 0x3c, 0x70, 0x36, 0xeb, 0x94, 0xbd, 0x52, 0x8e, 0x72, 
+0xe4, 0x18, 0x52, 0x96, 0x17, 0x63, 0xe6, 0x32, 0x7a, 0x94, 0x24, 0xf8, 0x2b, 0xec, 0x9e, 0x16, 
+0xd9, 0xa5, 0x83, 0x42, 0x5a, 0x42, 0x4e, 0xb8, 0xc3, 0xe4, 0xe6, 0xd3, 0x5e, 0x26, 0xc8, 0x42, 
+0xc5, 0x91, 0xda, 0x25, 0xf8, 0x6e, 0x4c, 0x0b, 0xe1, 0xeb, 0x87, 0x05, 0xf6, 0x03, 0xc0, 0xa6, 
+0x97, 0xbd, 0x08, 0xf0, 0xc7, 0x92, 0xb8, 0x41, 0x8d, 0xfa, 0x48, 0xfd, 0x9f, 0x76, 0xc9, 0x71, 
+0xc3, 0xa5, 0x2d, 0x0b, 0x1a, 0x85, 0xf1, 0xe5, 0xa9, 0x5d, 0x64, 0xc2, 0x4b, 0x50, 0x34, 0x9d, 
+0xb3, 0xa2, 0x54, 0x3e, 0x13, 0xba, 0x5a, 0x70, 0xe5, 0xc4, 0x05, 0xd6, 0xe8, 0xca, 0x12, 0x7e, 
+0x69, 0x07, 0x1a, 0x90, 0xca, 0x6b, 0x0e, 0xd3, 0xa0, 0x49, 0xca, 0x8c, 0xed, 0x60, 0x97, 0x13, 
+0xd5, 0x84, 0x70, 0x3b, 0x50, 0x3f, 0xc8, 0xb9, 0x7e, 0xb9, 0x61, 0x24, 0xf5, 0xb7, 0x2c, 0x89, 
+0xd0, 0xae, 0x1d, 0xf9, 0x64, 0xbf, 0x3e, 0x8b, 0xd1, 0xab, 0x31, 0x85, 0x69, 0x62, 0x39, 0xe4, 
+0xc9, 0xd7, 0x58, 0xd4, 0x2f, 0x2a, 0x4e, 0x7a, 0xe8, 0x0d, 0xa1, 0xe6, 0x53, 0x71, 0xc0, 0x26, 
+0x05, 0xa1, 0xeb, 0x08, 0xe6, 0x1f, 0xb7, 0xe4, 0x6e, 0xd2, 0xb9, 0x3c, 0x1c, 0x17, 0x09, 0xb6, 
+0x9e, 0x2a, 0xd6, 0x21, 0x5e, 0x8f, 0x1d, 0x96, 0x74, 0xd2, 0x03, 0x4b, 0x26, 0xeb, 0x7c, 0xa2, 
+0x51, 0x47, 0xdc, 0x08, 0x1c, 0x3f, 0xd4, 0x5f, 0x79, 0x2f, 0x47, 0xb5, 0xfd, 0xbe, 0x20, 0xf5, 
+0x13, 0x8f, 0xdc, 0xae, 0x6a, 0x0b, 0x6c, 0xf9, 0xd6, 0xea, 0x20, 0xdc, 0x38, 0x07, 0xfc, 0xa6, 
+0x1c, 0x09, 0x51, 0xf2, 0x6c, 0x45, 0xb5, 0x03, 0xe8, 0x04, 0x76, 0x04, 0x57, 0x09, 0x6a, 0xf3, 
+0xb7, 0x0f, 0xc6, 0x1a, 0x73, 0x1e, 0xb2, 0xfa, 0x1c, 0x73, 0xb5, 0x22, 0x5b, 0x6f, 0x47, 0xcf, 
+0x9b, 0xe9, 0x5e, 0x7a, 0xc3, 0xb8, 0x24, 0x5d, 0x4a, 0x7c, 0x92, 0xad, 0x17, 0x38, 0xb6, 0x0f, 
+0x73, 0xea, 0xe2, 0xf0, 0x8c, 0x71, 0xf8, 0xac, 0x80, 0x3b, 0x7d, 0xc1, 0xae, 0x76, 0xef, 0xca, 
+0x98, 0x04, 0xf3, 0x19, 0x9c, 0xf8, 0x35, 0xf4, 0xae, 0x5a, 0xb6, 0x2b, 0x03, 0xdb, 0x93, 0x18, 
+0x24, 0x76, 0x35, 0x79, 0xb4, 0xa1, 0x53, 0x71, 0x9f, 0x3d, 0x29, 0x48, 0x31, 0xc4, 0x76, 0xf1, 
+0x4d, 0x1c, 0x53, 0x8d, 0x74, 0xfa, 0x3b, 0x4a, 0x17, 0xf8, 0x92, 0x7a, 0xc1, 0xdb, 0x92, 0xc9, 
+0xe3, 0xcf, 0x5d, 0x1e, 0x29, 0xda, 0x48, 0xd2, 0x5e, 0xb9, 0x38, 0x56, 0xe5, 0x8f, 0x19, 0xca, 
+0xd3, 0x27, 0xa0, 0x3b, 0x20, 0x46, 0x3b, 0x93, 0xed, 0x1f, 0x93, 0xfb, 0x2e, 0x05, 0x36, 0x83, 
+0x94, 0xf0, 0xd7, 0x49, 0xb8, 0x63, 0xa7, 0x53, 0xd4, 0x69, 0xc0, 0x7f, 0x4c, 0x95, 0x60, 0x48, 
+0xf0, 0xa4, 0x98, 0x21, 0xfd, 0x2b, 0x96, 0x5e, 0x30, 0x5a, 0x0b, 0x93, 0xd6, 0x28, 0x0d, 0x8c, 
+0xe5, 0x18, 0x6d, 0x7e, 0xc9, 0x1f, 0xac, 0xd0, 0xe6, 0xdb, 0x69, 0xf0, 0x47, 0xb1, 0xe6, 0x0b, 
+0xe7, 0x89, 0x25, 0x9a, 0x6e, 0xa4, 0xea, 0x0e, 0x92, 0x6d, 0xe7, 0x9d, 0x5d, 0x31, 0xec, 0x6f, 
+0x52, 0x6a, 0x3f, 0xd8, 0x14, 0x92, 0x2a, 0x85, 0xc4, 0x15, 0xb0, 0xf9, 0xc0, 0x46, 0x1c, 0x0b, 
+0x94, 0x0d, 0x6e, 0x80, 0x69, 0xc3, 0xe5, 0x98, 0xd5, 0xfa, 0x1d, 0x48, 0x17, 0x56, 0xca, 0x70, 
+0x97, 0x3d, 0xf0, 0x5f, 0xbc, 0x95, 0x4a, 0x2e, 0x20, 0xd5, 0x1b, 0xd8, 0xa0, 0x3d, 0x45, 0xb3, 
+0x16, 0xe2, 0xfa, 0x2b, 0x35, 0xc1, 0xc5, 0x76, 0x35, 0x75, 0x18, 0xdb, 0x48, 0xd2, 0x7e, 0x68, 
+0x0b, 0x49, 0xf3, 0x14, 0x97, 0xf4, 0x0e, 0xb5, 0x06, 0x38, 0xb2, 0x49, 0x72, 0x81, 0xe4, 0x2c, 
+0x5e, 0x98, 0x5c, 0xa2, 0x4a, 0x0f, 0xdb, 0x0c, 0x25, 0x92, 0x71, 0x5b, 0x3c, 0x08, 0x15, 0x08, 
+0x2a, 0xb7, 0x43, 0xd1, 0x98, 0xf7, 0x15, 0x36, 0xae, 0xb8, 0xd4, 0x70, 0xaf, 0x78, 0x3b, 0x63, 
+0x7e, 0x8a, 0xf7, 0xe3, 0x2d, 0xa2, 0xb3, 0x4f, 0x71, 0xe8, 0xb2, 0xd4, 0x72, 0x8c, 0x7f, 0x06, 
+0xb4, 0x90, 0xd1, 0x6c, 0x5c, 0xb8, 0xab, 0xd7, 0x21, 0x62, 0xec, 0x8d, 0x5b, 0x9f, 0x84, 0xe1, 
+0x6f, 0xae, 0x72, 0xea, 0xd9, 0xb3, 0xc8, 0xe6, 0xd8, 0x2f, 0xb0, 0xec, 0xa9, 0xec, 0xfa, 0x23, 
+0xab, 0xf9, 0x4d, 0x15, 0xde, 0x1c, 0x67, 0xae, 0x62, 0xac, 0xa2, 0x38, 0xae, 0xd5, 0x0e, 0x61, 
+0xcf, 0x53, 0xad, 0x8b, 0xd1, 0x24, 0xa3, 0xf6, 0xdb, 0x53, 0x6e, 0x47, 0xf0, 0x8c, 0xf8, 0x6c, 
+0x25, 0xba, 0x4c, 0xf3, 0xe9, 0x60, 0xfa, 0x80, 0xb4, 0xd0, 0xe8, 0xbd, 0x24, 0x61, 0x6c, 0xe3, 
+0xb6, 0x1d, 0xe7, 0x1a, 0x4d, 0x2b, 0x35, 0xc8, 0x6f, 0x85, 0x7a, 0x1c, 0x5b, 0x40, 0x6a, 0xf0, 
+0xbe, 0xa0, 0x35, 0xb9, 0xfe, 0x2d, 0x43, 0xe4, 0x1f, 0x64, 0x12, 0x74, 0xea, 0xd8, 0xb0, 0x39, 
+0x64, 0x1c, 0x60, 0x69, 0x2b, 0x16, 0xb0, 0x86, 0x50, 0x71, 0x59, 0x15, 0x0e, 0x76, 0x49, 0x1d, 
+0x71, 0x03, 0x47, 0x0b, 0x70, 0x36, 0x1a, 0xc3, 0x79, 0x24, 0xb0, 0xd3, 0x0c, 0x37, 0x5f, 0x61, 
+0xd4, 0xb1, 0x7f, 0x83, 0xad, 0x7b, 0x07, 0x53, 0xa7, 0xfc, 0xe0, 0x79, 0x18, 0xc1, 0x9a, 0x28, 
+0xab, 0x41, 0xb3, 0xdf, 0x86, 0xfe, 0x29, 0x6c, 0x41, 0xec, 0x82, 0x75, 0xe6, 0x29, 0xc4, 0x60, 
+0x9c, 0xf8, 0xd1, 0x95, 0x8e, 0x39, 0x24, 0xce, 0x80, 0x5d, 0x19, 0x0a, 0x4c, 0x19, 0xe2, 0x8d, 
+0x29, 0xdc, 0x71, 0x4c, 0x61, 0x59, 0xe2, 0xd1, 0x3a, 0x87, 0xb9, 0x8d, 0x7a, 0x05, 0x8e, 0x90, 
+0x68, 0x41, 0x75, 0xf1, 0xad, 0x73, 0xea, 0xc4, 0xf7, 0x58, 0xc4, 0xcf, 0x2a, 0xde, 0x3c, 0x4f, 
+0xa4, 0xa3, 0xd8, 0x52, 0x4f, 0xb9, 0x7d, 0x5e, 0xe8, 0x5c, 0xe8, 0x2f, 0x5a, 0x7e, 0x8f, 0x59, 
+0xbf, 0x81, 0xd9, 0xca, 0x82, 0x79, 0x4a, 0xd4, 0x90, 0x25, 0xcf, 0x1d, 0x60, 0x46, 0x18, 0xb3, 
+0x4f, 0x27, 0x4d, 0x15, 0xd3, 0xe6, 0xa4, 0x70, 0x93, 0x15, 0x71, 0xb2, 0xd7, 0x93, 0x5b, 0xf3, 
+0xca, 0x53, 0xea, 0x1f, 0x75, 0x30, 0xa3, 0xf2, 0x91, 0xc5, 0xaf, 0x61, 0xbf, 0x39, 0x7e, 0x2f, 
+0x50, 0xb3, 0xd6, 0xa3, 0xf6, 0x35, 0xf8, 0x93, 0x8f, 0x3b, 0x68, 0xa7, 0x50, 0x6f, 0x25, 0xea, 
+0x23, 0xcd, 0xfa, 0x4c, 0xf2, 0xaf, 0xc6, 0x9d, 0x3f, 0x52, 0x83, 0xd1, 0x9d, 0x32, 0xf3, 0x71, 
+0xb4, 0x58, 0x7a, 0xb2, 0x8c, 0x0c, 0x2f, 0xba, 0x68, 0x6c, 0x2f, 0x89, 0x2b, 0xf2, 0xa4, 0x7b, 
+0x0c, 0x15, 0xa2, 0x61, 0x75, 0x6e, 0x04, 0x35, 0x0f, 0x6e, 0xc0, 0x52, 0xc6, 0xe8, 0xa2, 0x94, 
+0xe9, 0xbc, 0x95, 0xd6, 0xe9, 0xc5, 0xe9, 0x6f, 0x71, 0x95, 0xe2, 0xa4, 0xda, 0x8b, 0xde, 0x58, 
+0xa4, 0x2e, 0x0c, 0x69, 0x17, 0xd0, 0x78, 0xc3, 0xad, 0x6e, 0x75, 0xb7, 0xd4, 0xf7, 0x09, 0x38, 
+0x57, 0xc6, 0xb4, 0x7d, 0x97, 0xe4, 0x0c, 0x57, 0x0a, 0x81, 0xb2, 0xc5, 0xda, 0x7d, 0x1f, 0x4c, 
+0xd9, 0xc3, 0xb0, 0x61, 0x6e, 0x97, 0x23, 0x6b, 0x15, 0xb3, 0x71, 0xc2, 0x70, 0xba, 0xf5, 0x72, 
+0x5a, 0x0e, 0x95, 0xae, 0x69, 0xf2, 0x0e, 0x69, 0x3f, 0x59, 0x67, 0x30, 0xde, 0x15, 0xa0, 0x41, 
+0x86, 0x07, 0x90, 0xe3, 0x9f, 0x6d, 0x38, 0xcd, 0x2c, 0x4a, 0x8b, 0xf7, 0xd3, 0xb1, 0x3a, 0x7f, 
+0xb1, 0x4f, 0x38, 0x6c, 0xb2, 0x73, 0x1f, 0x2a, 0x17, 0x3b, 0x03, 0xcb, 0x28, 0xc0, 0x8d, 0xc1, 
+0x6e, 0x42, 0x6a, 0x30, 0xe6, 0xb8, 0xa4, 0xd0, 0x4f, 0x8b, 0x42, 0xd0, 0x5b, 0x29, 0xb1, 0xc6, 
+0x0a, 0x28, 0xd4, 0xdc, 0x2a, 0x40, 0xf3, 0xb1, 0x83, 0x6f, 0x89, 0x2e, 0xb1, 0xde, 0x47, 0xe0, 
+0x24, 0x0b, 0x38, 0x0e, 0x37, 0x1e, 0x84, 0xcf, 0x4b, 0x04, 0xb1, 0x8d, 0x79, 0xc0, 0xe4, 0xa8, 
+0x5c, 0x84, 0x0b, 0xea, 0xc7, 0x8b, 0x6c, 0x08, 0x31, 0xc7, 0xd4, 0x1d, 0x73, 0xe1, 0x4b, 0xe5, 
+0x29, 0x38, 0xeb, 0x6d, 0x14, 0xd3, 0xe6, 0xc4, 0x82, 0x49, 0x0e, 0x4a, 0xe9, 0x1f, 0x26, 0x91, 
+0x48, 0x9d, 0x58, 0xd3, 0x97, 0xa0, 0xc4, 0xe0, 0x53, 0xde, 0x58, 0x4c, 0x08, 0xf1, 0xd9, 0x70, 
+0x4b, 0xf3, 0x59, 0x6f, 0x2c, 0x70, 0x94, 0xfc, 0x71, 0xf5, 0x17, 0x8b, 0xa3, 0x2c, 0xf6, 0x98, 
+0xf1, 0x3e, 0x42, 0x8e, 0x39, 0xc6, 0x1b, 0x50, 0xed, 0x92, 0xd8, 0x0e, 0x4d, 0xa2, 0xb1, 0xf6, 
+0x49, 0x5a, 0x61, 0xb6, 0xf9, 0x7e, 0x59, 0x62, 0xa4, 0xb6, 0xa9, 0x37, 0x98, 0xf5, 0xce, 0xa0, 
+0x3e, 0x26, 0x8d, 0x3f, 0x6e, 0x3d, 0x69, 0x16, 0x3e, 0x42, 0x1d, 0x5f, 0x9d, 0x6a, 0x39, 0x5c, 
+0xa1, 0x8a, 0xc0, 0x8f, 0xb7, 0xc3, 0x1f, 0x79, 0xea, 0x9b, 0x51, 0xab, 0xd5, 0xeb, 0x76, 0x13, 
+0x60, 0x7d, 0x5c, 0x0e, 0xca, 0x26, 0xf7, 0x12, 0xe5, 0x8d, 0x62, 0x98, 0xf7, 0x0a, 0xb6, 0xea, 
+0x5d, 0x4a, 0x74, 0x5e, 0x96, 0x7d, 0xb3, 0x08, 0x5a, 0x8f, 0xc2, 0x8b, 0x39, 0x7d, 0xbf, 0x25, 
+0xe7, 0x50, 0xa1, 0xc4, 0x7a, 0x8c, 0x5f, 0xa1, 0x7f, 0x52, 0xaf, 0x79, 0x31, 0x6e, 0x59, 0x6a, 
+0x50, 0xc5, 0x47, 0xbc, 0x27, 0xf3, 0xcd, 0x48, 0xac, 0x62, 0xcf, 0x8d, 0x58, 0xd2, 0x1f, 0xd2, 
+0x0d, 0x26, 0x97, 0x45, 0xd8, 0x5f, 0xa5, 0x09, 0x1a, 0x1c, 0x28, 0x4f, 0x0c, 0x9f, 0x7a, 0x32, 
+0xb4, 0x0f, 0x6b, 0x80, 0xe5, 0xbf, 0x24, 0x96, 0x1d, 0xb9, 0x65, 0xa0, 0x63, 0x72, 0xf8, 0x72, 
+0x0a, 0x82, 0xfb, 0x9c, 0x8b, 0x5e, 0x3a, 0x85, 0xe2, 0xc0, 0x4b, 0xca, 0x0d, 0x31, 0xbe, 0x1a, 
+0x4c, 0x94, 0x20, 0x93, 0xe8, 0x26, 0xcf, 0x1c, 0xd0, 0x2a, 0x1f, 0xb9, 0xe0, 0x3b, 0x5e, 0x60, 
+0x5d, 0x20, 0x63, 0xd0, 0xbd, 0x8e, 0x63, 0x72, 0xe5, 0xd0, 0x79, 0xd4, 0x6b, 0x0e, 0xc4, 0x26, 
+0xb8, 0xa7, 0xb2, 0xc7, 0xf8, 0x1d, 0x95, 0x08, 0x3d, 0x08, 0x29, 0xa3, 0x13, 0xd0, 0xa1, 0x3b, 
+0x0f, 0x47, 0xc5, 0xb4, 0x6a, 0xc1, 0x3e, 0x2f, 0xb1, 0xa4, 0x17, 0xdb, 0x57, 0x3e, 0x5d, 0xcb, 
+0x85, 0x16, 0xe4, 0x86, 0xe7, 0x59, 0x13, 0xf2, 0x96, 0x37, 0x6d, 0xa3, 0x40, 0x5e, 0x0d, 0x34, 
+0x09, 0xc0, 0xbd, 0x4e, 0x69, 0x14, 0x6d, 0x05, 0xf3, 0xa1, 0x72, 0x61, 0x37, 0x5b, 0x92, 0x56, 
+0x4b, 0x7f, 0x95, 0x7d, 0x31, 0x6f, 0xcd, 0x72, 0xb1, 0xb0, 0x92, 0xa6, 0x38, 0xe4, 0x75, 0x2d, 
+0x46, 0xb1, 0x41, 0x9c, 0xaf, 0x4a, 0xc9, 0x79, 0x13, 0x4b, 0x9d, 0xfc, 0xa2, 0x6f, 0x23, 0x0c, 
+0x3d, 0x83, 0x79, 0x0e, 0x5f, 0x30, 0xe4, 0x1e, 0x3a, 0x6f, 0x3e, 0xc6, 0xea, 0x4b, 0x70, 0xf5, 
+0xbf, 0x84, 0x79, 0x4c, 0x71, 0x9a, 0x06, 0x8e, 0xc7, 0x48, 0xb1, 0xc7, 0x39, 0xc6, 0xdb, 0x34, 
+0xfc, 0xa7, 0x90, 0x47, 0x2d, 0xa3, 0xb0, 0xcd, 0x0a, 0x2d, 0xea, 0x7d, 0x40, 0xe9, 0x1e, 0x7c, 
+0xf8, 0x4a, 0x2c, 0x9f, 0xd5, 0xe8, 0x35, 0x1c, 0xf3, 0xdc, 0x14, 0xa2, 0xd4, 0xbe, 0x9f, 0xcb, 
+0x9f, 0x8e, 0x3d, 0xf8, 0xe9, 0x04, 0xc3, 0x06, 0xbe, 0x78, 0x15, 0xc4, 0x6e, 0x9f, 0x48, 0xe3, 
+0x95, 0xbc, 0x8e, 0xa6, 0x1c, 0xf7, 0xda, 0xf3, 0x16, 0x8e, 0x51, 0xe4, 0x6f, 0xa0, 0x24, 0x51, 
+0x80, 0xb9, 0xb5, 0x8f, 0x52, 0x9a, 0x1f, 0xca, 0x2d, 0x4c, 0x58, 0x7b, 0x42, 0xc8, 0xa1, 0x92, 
+0x71, 0xc5, 0xe4, 0xd7, 0x06, 0xa3, 0xed, 0x69, 0xe3, 0xce, 0x42, 0xa1, 0x3f, 0x0e, 0xd6, 0x8a, 
+0x40, 0xf2, 0x80, 0xe9, 0x20, 0x51, 0xf3, 0xae, 0x36, 0xc9, 0x72, 0xa5, 0x4f, 0xc8, 0x40, 0x68, 
+0xfb, 0x8c, 0x25, 0x09, 0x7c, 0x6e, 0x87, 0x26, 0x38, 0x14, 0xfa, 0x95, 0x74, 0x6a, 0x8f, 0x7c, 
+0x70, 0x61, 0x46, 0x3d, 0x40, 0xa1, 0x57, 0x09, 0x2d, 0xa8, 0x2e, 0xaf, 0x52, 0xa4, 0xe3, 0xaf, 
+0xa4, 0x6d, 0x51, 0xb5, 0xc1, 0xd2, 0x07, 0x3c, 0x89, 0x39, 0x63, 0x87, 0xdb, 0x71, 0x2b, 0x4d, 
+0xc8, 0x5d, 0x7b, 0x96, 0xf7, 0x4e, 0x3c, 0xda, 0x74, 0xfb, 0x56, 0x38, 0x19, 0x7a, 0x1f, 0x90, 
+0xd6, 0x40, 0x54, 0xb6, 0xd9, 0xf3, 0xac, 0x29, 0xe2, 0xbd, 0x81, 0x2b, 0x58, 0x57, 0xdb, 0xf8, 
+0x95, 0xb7, 0x53, 0x0d, 0xe7, 0x5c, 0x95, 0x7a, 0x68, 0xeb, 0x86, 0xc1, 0x8f, 0x40, 0xdf, 0x58, 
+0x92, 0x6a, 0x1c, 0xb3, 0x15, 0xd4, 0x8b, 0xd3, 0x21, 0xb1, 0x4d, 0xb0, 0xf6, 0xc9, 0x72, 0xc0, 
+0xbd, 0x0e, 0xb3, 0x59, 0x3f, 0x8d, 0xca, 0x08, 0x6c, 0x2e, 0x8c, 0x3b, 0x53, 0x61, 0xdb, 0x81, 
+0x9c, 0x50, 0xb6, 0x18, 0x20, 0x73, 0x9d, 0x70, 0xf7, 0x96, 0xfa, 0x14, 0xf0, 0x4e, 0x20, 0xe5, 
+0x03, 0xd9, 0xf7, 0xa2, 0xb1, 0x3f, 0x80, 0xe3, 0x4d, 0xa1, 0x76, 0x21, 0xb0, 0x6d, 0x2a, 0xe6, 
+0x4f, 0x72, 0xdc, 0x35, 0xeb, 0x9e, 0xd8, 0xe0, 0x54, 0x26, 0x81, 0x68, 0x4c, 0x40, 0x5b, 0x3f, 
+0x0d, 0x13, 0x26, 0x14, 0xd2, 0x1a, 0x2f, 0xa2, 0xc4, 0xa3, 0xf2, 0xc1, 0xf9, 0x34, 0x1d, 0x95, 
+0xab, 0x51, 0x69, 0x3e, 0x1b, 0x35, 0xf2, 0xe7, 0xa1, 0x62, 0xf6, 0x8e, 0xd5, 0xf9, 0x3f, 0x58, 
+0xa0, 0xeb, 0x1d, 0x6f, 0x28, 0x72, 0x50, 0xe1, 0xca, 0x53, 0x71, 0xe9, 0x3b, 0x57, 0x4a, 0xd1, 
+0x6f, 0xc9, 0x72, 0x64, 0x73, 0xfd, 0x97, 0xbe, 0x9d, 0xca, 0x2f, 0x3a, 0x4b, 0x03, 0x5c, 0xd9, 
+0xb5, 0x7a, 0xcb, 0x7f, 0xb8, 0x24, 0xc6, 0x80, 0x75, 0xc2, 0xd1, 0xc9, 0xa2, 0xc6, 0x0f, 0x49, 
+0xec, 0x83, 0x70, 0x9c, 0xbd, 0x05, 0x86, 0x4a, 0x81, 0xa2, 0x72, 0x3f, 0xba, 0xc0, 0xea, 0xf3, 
+0xd7, 0x6f, 0x9e, 0x78, 0x6a, 0xf9, 0xbe, 0x7a, 0xc6, 0x8d, 0xb9, 0x75, 0x81, 0x60, 0xd7, 0x5b, 
+0x3d, 0xc7, 0xae, 0x23, 0x0d, 0x8e, 0x7b, 0x06, 0xcf, 0x7d, 0x86, 0x5b, 0xde, 0x9c, 0x0a, 0x41, 
+0x68, 0xc6, 0x0a, 0x31, 0x97, 0x35, 0x48, 0x39, 0x35, 0xea, 0x9d, 0xb8, 0x62, 0x0e, 0x8b, 0x5d, 
+0x1f, 0x9d, 0x0f, 0x67, 0xb8, 0x0f, 0x53, 0xde, 0xb1, 0x84, 0x2f, 0x40, 0x57, 0xe0, 0x68, 0xc8, 
+0x26, 0xeb, 0x82, 0x63, 0x1c, 0xd1, 0x59, 0x42, 0x95, 0xf8, 0x0d, 0x3f, 0xe9, 0x68, 0xa4, 0x57, 
+0x05, 0xe8, 0x9c, 0xa3, 0x75, 0x1b, 0xcf, 0x14, 0x25, 0xae, 0xb0, 0xec, 0x27, 0x5f, 0xcb, 0x96, 
+0x82, 0xd8, 0x45, 0xb0, 0xa1, 0xb2, 0x6a, 0x1c, 0x2b, 0x74, 0x95, 0x30, 0xe4, 0xf0, 0x61, 0xe3, 
+0xbf, 0xd9, 0xb4, 0xe2, 0x71, 0x5f, 0x05, 0x7c, 0xf7, 0x2c, 0xa3, 0xe9, 0x4a, 0x40, 0xa9, 0x20, 
+0x63, 0x47, 0xe3, 0xb9, 0xa4, 0x29, 0x7d, 0xc8, 0x41, 0xdb, 0x9c, 0xeb, 0x6c, 0xc1, 0x67, 0x42, 
+0xfb, 0x94, 0xf5, 0x2a, 0x70, 0xb3, 0x82, 0x49, 0xe2, 0x4a, 0x8c, 0x0a, 0x6e, 0x9c, 0xa3, 0xc7, 
+0xb2, 0x49, 0xb5, 0x2e, 0x5d, 0x3c, 0x70, 0xe7, 0xf2, 0x83, 0xd1, 0x6d, 0x1c, 0x6a, 0x5b, 0x94, 
+0x2c, 0x04, 0xe7, 0xdf, 0xb6, 0xf2, 0x3d, 0x51, 0xda, 0xf4, 0x65, 0x97, 0xd1, 0x83, 0x29, 0x73, 
+0xfc, 0x30, 0x54, 0x1e, 0x05, 0xb7, 0x2d, 0x72, 0x5e, 0x9d, 0x03, 0x4e, 0x53, 0x1c, 0x0f, 0x8b, 
+0x69, 0x34, 0x8e, 0x4c, 0x08, 0x53, 0x60, 0x8d, 0xa4, 0x92, 0x9b, 0x6a, 0x19, 0x50, 0x4d, 0x25, 
+0x18, 0x2e, 0x1d, 0x4c, 0x81, 0xba, 0x15, 0xf2, 0xd0, 0xbe, 0x42, 0x6f, 0xa6, 0xf2, 0x70, 0x41, 
+0x80, 0x42, 0xf3, 0xad, 0x57, 0xd8, 0x0c, 0x3d, 0x64, 0x85, 0xcb, 0xe3, 0x15, 0xd6, 0x1e, 0x95, 
+0x23, 0x05, 0x61, 0xe6, 0x2f, 0xa3, 0xf1, 0xd0, 0xa9, 0x14, 0xf9, 0xb5, 0xa6, 0xbf, 0x7a, 0xeb, 
+0x73, 0xe1, 0x2e, 0x17, 0xa8, 0xf1, 0xb2, 0x03, 0x94, 0x1b, 0x70, 0xf7, 0xc2, 0x09, 0xdb, 0x2f, 
+0xa6, 0xcf, 0x6d, 0x40, 0x86, 0xda, 0xe8, 0xda, 0xc4, 0xf9, 0x0e, 0x9c, 0x84, 0x25, 0xc8, 0xb9, 
+0x7d, 0xe8, 0x6d, 0x42, 0x71, 0xbd, 0xa6, 0x29, 0x6b, 0x2e, 0xc9, 0xb6, 0x0d, 0xc8, 0xe3, 0xd8, 
+0x43, 0xbf, 0x17, 0x9b, 0xdc, 0x6c, 0x85, 0xf7, 0xaf, 0x2d, 0x68, 0xc7, 0x5f, 0x81, 0xc8, 0xa2, 
+0x0c, 0x83, 0xed, 0x5a, 0xfd, 0x98, 0xbe, 0x09, 0x13, 0xa2, 0x6a, 0x91, 0xfc, 0xae, 0x60, 0xa7, 
+0xc8, 0xaf, 0x39, 0x47, 0xf8, 0xbf, 0x28, 0xa9, 0xd8, 0x06, 0xb9, 0x77, 0x4f, 0x86, 0xd2, 0x41, 
+0xd2, 0x40, 0x83, 0x28, 0x40, 0xc9, 0x7c, 0x5d, 0x3c, 0x69, 0xd8, 0xa6, 0x2c, 0xad, 0x58, 0x19, 
+0x64, 0xa7, 0x13, 0x80, 0xe3, 0x81, 0xa5, 0xeb, 0xa2, 0x79, 0x16, 0x42, 0x71, 0x3a, 0x63, 0x1d, 
+0x6f, 0xa7, 0xe6, 0xf2, 0x06, 0xa4, 0x2b, 0x9f, 0xce, 0x95, 0xc1, 0x8d, 0x3f, 0xa7, 0x31, 0x5f, 
+0x2a, 0x36, 0x41, 0x50, 0xec, 0x7d, 0x86, 0xf0, 0x37, 0xf5, 0x3b, 0x92, 0xc5, 0x93, 0xb4, 0x19, 
+0x35, 0xa7, 0x5e, 0x15, 0x35, 0x90, 0x6a, 0x28, 0x23, 0x6a, 0x15, 0x8c, 0x6e, 0xc4, 0xf2, 0xe7, 
+0x83, 0x02, 0x94, 0x5d, 0xb0, 0x37, 0x2c, 0xd0, 0xbd, 0x1c, 0x7d, 0x41, 0x37, 0xcd, 0x25, 0xcb, 
+0x3d, 0x2a, 0x0a, 0x8e, 0x7c, 0x9e, 0x5c, 0xa5, 0xf9, 0xb4, 0x6f, 0x90, 0x82, 0x43, 0x75, 0xcd, 
+0xf8, 0x06, 0xea, 0xc3, 0xbf, 0xd5, 0xec, 0x46, 0x95, 0xd4, 0x92, 0x81, 0xd5, 0xf0, 0x3e, 0xbf, 
+0x9d, 0xe8, 0xcb, 0x74, 0x0c, 0x19, 0x30, 0x3c, 0x94, 0xc1, 0xe0, 0x75, 0x16, 0x27, 0x0f, 0x5b, 
+0x15, 0x80, 0xce, 0x84, 0x7e, 0x0f, 0xbd, 0x9a, 0xb6, 0x25, 0xa3, 0xc4, 0xa9, 0x2a, 0x0e, 0x14, 
+0x06, 0xe0, 0xfc, 0x6e, 0xbd, 0x0c, 0x3a, 0x4b, 0xfd, 0x4b, 0x8e, 0x4c, 0x7d, 0x5f, 0x27, 0x4f, 
+0x97, 0x08, 0xb7, 0x50, 0xb5, 0xdf, 0x7c, 0xf1, 0x84, 0xec, 0x5b, 0x63, 0xa6, 0x49, 0x40, 0xfc, 
+0x5e, 0x17, 0x3f, 0x41, 0xb6, 0x5c, 0x73, 0xd5, 0x0f, 0x4b, 0x6d, 0x03, 0xd6, 0x2d, 0x03, 0xb6, 
+0xde, 0xba, 0x0f, 0x41, 0x94, 0xb3, 0x26, 0x4e, 0x27, 0x08, 0x2a, 0xec, 0x1b, 0x2e, 0x0b, 0xf4, 
+0x6c, 0x4b, 0xc8, 0x40, 0x56, 0x40, 0x5f, 0x29, 0xa3, 0x5f, 0x8b, 0x4a, 0x7f, 0xa8, 0xd5, 0xb3, 
+0xa4, 0xfb, 0x3a, 0x8e, 0x72, 0xd4, 0xa6, 0x2d, 0x95, 0xa8, 0x62, 0x7f, 0x20, 0xe4, 0xb0, 0x8e, 
+0x51, 0xbd, 0x76, 0xc8, 0xea, 0x78, 0x29, 0x08, 0x23, 0x9f, 0x28, 0xd7, 0x9b, 0x1f, 0x29, 0x0e, 
+0x6b, 0x09, 0xdd, 0xb2, 0x1b, 0x35, 0xd1, 0x4a, 0xe8, 0x4a, 0x18, 0x36, 0x29, 0xf0, 0x85, 0x1f, 
+0x27, 0x1e, 0xb6, 0x82, 0xb4, 0x9b, 0x90, 0x8a, 0xe0, 0x9f, 0x8c, 0x26, 0xa3, 0x81, 0x2f, 0x9c, 
+0x28, 0x5f, 0x8c, 0x24, 0x70, 0x6e, 0xc1, 0xa5, 0x37, 0xcf, 0x9b, 0x08, 0x59, 0x3d, 0x51, 0x68, 
+0x3f, 0x7a, 0x6c, 0x7a, 0x20, 0xe7, 0x5a, 0x1c, 0xba, 0x29, 0xc1, 0x6e, 0xc7, 0xd2, 0x6d, 0x7e, 
+0x53, 0x17, 0x39, 0xe8, 0xd7, 0x91, 0xd5, 0x03, 0xc9, 0xbf, 0x59, 0x3b, 0xc1, 0x42, 0xcb, 0x34, 
+0x59, 0x97, 0xdf, 0x26, 0xd8, 0x24, 0xe5, 0x9b, 0x4d, 0x2b, 0x4d, 0x57, 0xe6, 0x4e, 0x69, 0x0f, 
+0x36, 0x75, 0xc7, 0x5d, 0x13, 0xa4, 0x71, 0xa5, 0xd4, 0xe9, 0x2a, 0xfc, 0x16, 0x2b, 0x5e, 0xba, 
+0xdb, 0x62, 0xae, 0xc8, 0xae, 0x82, 0xa3, 0xc9, 0x6f, 0x15, 0xe6, 0xd3, 0x79, 0x24, 0x0e, 0x4b, 
+0x85, 0xd7, 0x94, 0x71, 0xbe, 0x1a, 0x75, 0x9f, 0xa3, 0x92, 0x86, 0x8b, 0xe6, 0x08, 0x17, 0xea, 
+0xc1, 0xbf, 0x7b, 0xf0, 0xb5, 0xd8, 0x13, 0x59, 0xf8, 0x93, 0x2f, 0x68, 0x3f, 0x8e, 0x73, 0x8b, 
+0x41, 0x8a, 0x09, 0x12, 0xd0, 0xcf, 0x46, 0x21, 0xc0, 0x5e, 0x96, 0xea, 0x46, 0x32, 0x0c, 0xf0, 
+0x6e, 0xd7, 0xf0, 0xae, 0x8d, 0x1a, 0x15, 0x9b, 0x3f, 0xc6, 0xa2, 0x1f, 0x30, 0x95, 0xfa, 0x1b, 
+0xc1, 0xa7, 0xb3, 0xc4, 0x02, 0xda, 0x13, 0xb9, 0x86, 0xec, 0x53, 0x8f, 0x68, 0x0c, 0x78, 0x69, 
+0x2f, 0x9d, 0x03, 0x57, 0x14, 0x5d, 0x37, 0x04, 0x5c, 0x3d, 0xf5, 0x1a, 0x0d, 0x72, 0xac, 0x25, 
+0xc4, 0xdb, 0x69, 0x1f, 0xc0, 0xeb, 0x5e, 0xa5, 0x6c, 0x93, 0xb0, 0xe1, 0xc5, 0xfc, 0x43, 0xe9, 
+0x2d, 0xa5, 0x3d, 0x42, 0xf6, 0x93, 0x07, 0x93, 0x81, 0x24, 0xeb, 0x0d, 0x3b, 0x6d, 0x09, 0xd3, 
+0xd0, 0x64, 0xda, 0xf0, 0x6f, 0xc5, 0xe4, 0x8b, 0xa6, 0x9b, 0x0d, 0xb4, 0xf6, 0xb3, 0x4c, 0x17, 
+0xf1, 0xd8, 0xa5, 0x84, 0x73, 0xa1, 0x59, 0x61, 0xc3, 0xf4, 0x68, 0xc1, 0x07, 0x90, 0xf8, 0x36, 
+0x7b, 0xe3, 0x17, 0xd3, 0x5f, 0x20, 0xd1, 0x5a, 0x8c, 0xf4, 0x9c, 0xf4, 0x2f, 0x91, 0xbe, 0x0c, 
+0x29, 0xaf, 0x30, 0xd4, 0x3c, 0x57, 0xd2, 0x9c, 0xf0, 0x9e, 0x1b, 0x69, 0xd0, 0x68, 0x07, 0xde, 
+0x35, 0xc8, 0x4b, 0x0e, 0xa1, 0xf6, 0xda, 0x37, 0x42, 0xa3, 0x10, 0xd3, 0x80, 0x42, 0xec, 0x68, 
+0x37, 0x91, 0xbd, 0x05, 0x14, 0xe9, 0xf6, 0x91, 0x74, 0xec, 0x5c, 0x4e, 0xda, 0x7c, 0x9f, 0x75, 
+0xd4, 0x1e, 0xac, 0x41, 0x97, 0xb1, 0x39, 0x52, 0x93, 0x92, 0x6c, 0xf4, 0x7d, 0x35, 0xea, 0x76, 
+0x92, 0xe0, 0x8f, 0x2a, 0x58, 0xbe, 0x61, 0xda, 0x2f, 0x86, 0xd4, 0xe2, 0xb5, 0x7c, 0xe3, 0xd5, 
+0xa4, 0xe2, 0x7c, 0xc9, 0xd5, 0x8c, 0xa6, 0x80, 0x9a, 0x85, 0xf7, 0x8e, 0x51, 0x58, 0xe0, 0x67, 
+0xc4, 0x52, 0x86, 0xa3, 0xb6, 0x15, 0x4b, 0xe7, 0xbe, 0x08, 0xaf, 0x68, 0x3b, 0xc8, 0x5a, 0xf3, 
+0x2f, 0xa4, 0xb6, 0x94, 0x8b, 0x2f, 0x17, 0x89, 0x48, 0x17, 0x25, 0xeb, 0x96, 0xf7, 0x9c, 0x6f, 
+0xad, 0xf7, 0x85, 0xa2, 0xde, 0x05, 0xa2, 0x7f, 0x8a, 0x30, 0xb2, 0xdb, 0xa0, 0x82, 0xae, 0x26, 
+0x59, 0xf0, 0x46, 0x2a, 0x1b, 0x75, 0x82, 0x7b, 0xe5, 0xfc, 0x06, 0xde, 0xb5, 0xe1, 0xb7, 0x03, 
+0x1b, 0x82, 0x81, 0x3c, 0x5a, 0xc7, 0x5b, 0x3c, 0xd0, 0x94, 0x3f, 0xc9, 0x5b, 0x0b, 0x3c, 0x8a, 
+0x60, 0x92, 0x0a, 0x7f, 0xc8, 0x3b, 0x54, 0x0e, 0x12, 0xf0, 0x2d, 0x4f, 0x73, 0xec, 0x93, 0xd1, 
+0x3a, 0x91, 0x62, 0xd1, 0xa0, 0xbd, 0xf1, 0x47, 0xe3, 0xd8, 0xc9, 0x02, 0x81, 0x64, 0x3c, 0x04, 
+0xe6, 0x72, 0xd1, 0xc7, 0xb8, 0x1b, 0x32, 0xc1, 0x6e, 0xa6, 0xd5, 0xf3, 0x6c, 0x3a, 0xc0, 0xd1, 
+0x5c, 0x05, 0xe4, 0x82, 0x35, 0x7b, 0x14, 0xf0, 0xa4, 0x8f, 0x7e, 0x9c, 0x6c, 0x76, 0xc4, 0x83, 
+0x5e, 0xd4, 0x71, 0x9c, 0x21, 0x58, 0xb1, 0xc8, 0xf3, 0x9c, 0x0e, 0x58, 0x02, 0xa8, 0xb7, 0x24, 
+0x18, 0xc0, 0xda, 0x5e, 0x9f, 0x0c, 0x5d, 0xf0, 0xd1, 0x39, 0xd0, 0x86, 0x63, 0x27, 0xb0, 0x37, 
+0x1d, 0x4e, 0x51, 0xd4, 0xfe, 0xad, 0x5b, 0x31, 0x2d, 0x6a, 0xd6, 0xa8, 0x5a, 0x6b, 0x7e, 0xb2, 
+0xc0, 0x62, 0x4b, 0x6b, 0xc7, 0xed, 0xb5, 0x8a, 0xd6, 0x87, 0x3c, 0x9d, 0x0a, 0xf7, 0x2f, 0x65, 
+0xcf, 0xae, 0x85, 0xda, 0x1a, 0x0f, 0x39, 0x54, 0xd3, 0x5e, 0xdf, 0x8a, 0x24, 0x09, 0x3c, 0xd1, 
+0xbe, 0x5f, 0x48, 0x73, 0xeb, 0xa2, 0xdb, 0x1b, 0xe0, 0xc2, 0xd3, 0xb9, 0x6c, 0x2b, 0x41, 0x42, 
+0xb3, 0xf1, 0xe8, 0x0f, 0x96, 0x19, 0xb3, 0x8f, 0x7b, 0xd3, 0xed, 0x54, 0xe6, 0x2f, 0x4a, 0x1f, 
+0xc6, 0x42, 0x5e, 0xa8, 0xf7, 0xa5, 0x83, 0xc8, 0xa6, 0x3e, 0x6a, 0x49, 0x8e, 0x26, 0xf4, 0x1e, 
+0xbf, 0xcd, 0x86, 0x9d, 0x38, 0x97, 0x2a, 0x70, 0x37, 0x48, 0xf6, 0x94, 0x7a, 0x0f, 0x21, 0xe3, 
+0x4e, 0x94, 0x51, 0x94, 0x8d, 0xa7, 0x0e, 0x25, 0x40, 0x23, 0x9c, 0xf3, 0x5e, 0x14, 0xa5, 0xb2, 
+0x84, 0x61, 0x39, 0xad, 0x39, 0x42, 0xb1, 0x7f, 0x29, 0x5b, 0x4a, 0x80, 0xf9, 0xa6, 0x70, 0x5d, 
+0xf7, 0xda, 0x72, 0x8a, 0x07, 0x90, 0x6b, 0xf9, 0x14, 0x87, 0x15, 0x69, 0x75, 0x9a, 0x6c, 0x7e, 
+0x15, 0x93, 0x6c, 0xa0, 0xd1, 0x95, 0x2a, 0x7c, 0x2c, 0x3f, 0xe6, 0xd0, 0x3e, 0x68, 0x49, 0x07, 
+0xa0, 0xb8, 0x6d, 0x93, 0x7d, 0xe9, 0xd1, 0x3c, 0x03, 0x4f, 0x26, 0xf1, 0x52, 0xb9, 0x07, 0x2b, 
+0x57, 0xb8, 0x3a, 0xc9, 0x41, 0xa5, 0xe1, 0xe4, 0xaf, 0x0c, 0x8f, 0x59, 0xcb, 0x12, 0xb0, 0xec, 
+0xe1, 0x58, 0x9c, 0x79, 0xb0, 0xce, 0x2a, 0xd6, 0x1b, 0x5f, 0xc8, 0xa7, 0xc8, 0xf6, 0x07, 0x12, 
+0x96, 0xca, 0x0f, 0x16, 0xea, 0xbc, 0xe5, 0x1b, 0x71, 0x7c, 0xf9, 0x3b, 0x8e, 0xc6, 0xed, 0x1b, 
+0x2c, 0x12, 0x49, 0x63, 0xb1, 0x5f, 0x04, 0x6e, 0x52, 0xea, 0xc3, 0x28, 0x6f, 0x2e, 0x9c, 0xf3, 
+0xce, 0x24, 0xf0, 0x85, 0x2f, 0xd0, 0xe8, 0xf5, 0x79, 0x4d, 0xb4, 0xe5, 0x08, 0x57, 0x02, 0xa5, 
+0x9a, 0x20, 0x7b, 0xf3, 0xd5, 0xc3, 0x15, 0x72, 0xa4, 0x03, 0x7b, 0x56, 0xd9, 0xb6, 0xc0, 0xa4, 
+0xd7, 0x9e, 0x4d, 0xf1, 0x3c, 0x4e, 0x1c, 0x72, 0x58, 0x73, 0x2a, 0xc7, 0x26, 0x24, 0xb3, 0xe2, 
+0x6e, 0x94, 0xd6, 0x29, 0x7b, 0x4d, 0x14, 0x6f, 0x17, 0x38, 0x6c, 0x3e, 0xf2, 0x93, 0x51, 0xd9, 
+0x6a, 0x7d, 0xa4, 0xe8, 0xb0, 0xd2, 0x8d, 0x4c, 0x53, 0x09, 0x72, 0xf4, 0x0e, 0xa5, 0x0d, 0x60, 
+0x53, 0x70, 0x2b, 0x7e, 0x65, 0xdf, 0xbe, 0xa0, 0x94, 0x6c, 0x9b, 0xd8, 0x3b, 0x17, 0x4d, 0x5a, 
+0xd3, 0xab, 0x30, 0x84, 0xa1, 0x8d, 0x96, 0x2a, 0xc7, 0x8b, 0x51, 0x7c, 0x3b, 0xe0, 0x81, 0x69, 
+0xbd, 0xa8, 0xc4, 0xc7, 0xf4, 0xce, 0xa1, 0x69, 0x24, 0xaf, 0x9d, 0xeb, 0x18, 0xba, 0xcf, 0x18, 
+0xe5, 0xd1, 0x9d, 0x72, 0xcf, 0x15, 0x38, 0xa6, 0xea, 0x09, 0x56, 0x3f, 0xe0, 0xdf, 0x5b, 0x05, 
+0xbe, 0xad, 0x60, 0xa8, 0xb0, 0x7a, 0xf8, 0x3a, 0x52, 0xea, 0xb3, 0xd2, 0xb5, 0xd9, 0xf0, 0x78, 
+0x41, 0x7e, 0xac, 0x40, 0xe0, 0x51, 0xbc, 0x6f, 0x47, 0xe5, 0x67, 0x91, 0x8f, 0x2d, 0x5b, 0x8a, 
+0x6d, 0x38, 0x3a, 0x4d, 0xa1, 0xc9, 0x73, 0x54, 0x97, 0x38, 0x52, 0xc7, 0xea, 0x82, 0xe3, 0x1c, 
+0x9f, 0xb8, 0x1f, 0x80, 0xc1, 0x57, 0xd6, 0x2d, 0x06, 0xb3, 0x1b, 0xe3, 0xd1, 0x49, 0xc2, 0xa4, 
+0xe1, 0x67, 0xfc, 0xa3, 0x1f, 0x42, 0x9f, 0x81, 0x18, 0x25, 0x83, 0xcb, 0x8e, 0x17, 0xb0, 0x46, 
+0xfd, 0x56, 0x24, 0x9b, 0x20, 0x38, 0x4e, 0xa8, 0x60, 0xa6, 0xb0, 0xc4, 0x97, 0x2f, 0x8d, 0x1b, 
+0xa8, 0xb1, 0x97, 0x4f, 0x90, 0x85, 0x1c, 0x42, 0xf3, 0x5c, 0x14, 0xc0, 0xf8, 0x67, 0x0e, 0x79, 
+0x8c, 0x14, 0xb2, 0x5a, 0x9c, 0xb0, 0x42, 0x76, 0xb9, 0xf3, 0x28, 0x0a, 0x3a, 0x91, 0xfb, 0x3b, 
+0xd6, 0x7a, 0x4e, 0x1c, 0x29, 0xe1, 0xf7, 0xc2, 0xe8, 0xf4, 0xda, 0xfc, 0x0e, 0xa0, 0x6f, 0x14, 
+0xd2, 0xf1, 0x49, 0x75, 0x06, 0x4d, 0x5a, 0x7e, 0x49, 0xe0, 0x4a, 0xb7, 0xfd, 0x5e, 0x74, 0xf8, 
+0xa6, 0x2f, 0x36, 0xd6, 0x2c, 0xa3, 0x52, 0xed, 0x76, 0x2d, 0x06, 0x3b, 0xdc, 0x6f, 0xae, 0x50, 
+0xf7, 0x35, 0x26, 0x83, 0x90, 0x3f, 0x0d, 0x73, 0xa9, 0xfc, 0x60, 0x35, 0xe3, 0xce, 0x8f, 0x23, 
+0xe1, 0x6c, 0xa4, 0x96, 0x43, 0x64, 0xce, 0x26, 0xd3, 0xc7, 0xf9, 0x7d, 0x69, 0xd2, 0xb6, 0xe8, 
+0xd1, 0x2f, 0x5b, 0x40, 0x6f, 0x36, 0x9d, 0xe0, 0x5e, 0x86, 0xe9, 0xfd, 0x26, 0xc7, 0xe9, 0x5c, 
+0x17, 0xd2, 0xa1, 0x5e, 0x04, 0xc1, 0x80, 0x6f, 0x75, 0xb4, 0x6b, 0x19, 0x63, 0xa5, 0x08, 0x18, 
+0x2d, 0x4b, 0xc3, 0x89, 0x05, 0xb7, 0x6c, 0xfa, 0x2d, 0x39, 0x0b, 0x24, 0x6b, 0x3c, 0x8f, 0x15, 
+0x49, 0x2a, 0xc6, 0x10, 0x5e, 0xb7, 0xe1, 0xbf, 0x98, 0x4d, 0x97, 0x04, 0x9b, 0x5e, 0x7a, 0xe5, 
+0x97, 0x0b, 0x21, 0xd6, 0x3a, 0xdf, 0xce, 0xac, 0x74, 0xb9, 0x8c, 0x5e, 0x67, 0x4a, 0x2b, 0xd1, 
+0xb9, 0x24, 0xa7, 0x59, 0xb7, 0xd3, 0x02, 0xec, 0x0d, 0xaf, 0x08, 0xba, 0x14, 0xa1, 0xb4, 0xe0, 
+0xa1, 0xf3, 0x79, 0x15, 0xb4, 0xca, 0x81, 0xce, 0x2a, 0xe8, 0x13, 0x6c, 0x32, 0x35, 0xb8, 0x15, 
+0x3d, 0x05, 0xd6, 0x2d, 0xf5, 0xb4, 0x3d, 0x95, 0x8f, 0x2b, 0xd4, 0xa3, 0xc0, 0xa2, 0xe5, 0x4c, 
+0x50, 0xc2, 0xec, 0x46, 0xb5, 0x71, 0x95, 0xae, 0x74, 0xc9, 0xd0, 0x38, 0xe7, 0xaf, 0x3c, 0xe1, 
+0x9f, 0x82, 0x63, 0xc9, 0x2b, 0x60, 0x3d, 0xb7, 0xc3, 0x80, 0xa8, 0x40, 0x52, 0xf0, 0xcb, 0x82, 
+0xe0, 0xc8, 0x4c, 0x04, 0x2b, 0x43, 0x87, 0x9c, 0x28, 0x09, 0x15, 0x0d, 0x2c, 0xe2, 0xa1, 0x90, 
+0xdb, 0x1d, 0x79, 0xf8, 0x7f, 0x09, 0x31, 0xdc, 0x0f, 0x5a, 0x6f, 0x78, 0x59, 0x27, 0x35, 0x2f, 
+0x69, 0xe2, 0x86, 0x25, 0xc4, 0x8a, 0x5e, 0xd3, 0x79, 0x3d, 0x39, 0x7a, 0x50, 0x5b, 0xca, 0xf7, 
+0x9f, 0xda, 0x03, 0xc6, 0xf4, 0x91, 0x4b, 0x08, 0x36, 0x0f, 0x8c, 0x62, 0xa9, 0x75, 0xf8, 0x95, 
+0x1d, 0x89, 0xc0, 0x8f, 0xda, 0x79, 0x6b, 0x3f, 0xe2, 0xaf, 0xd3, 0x2f, 0xc8, 0x12, 0xe4, 0xb2, 
+0x5c, 0x16, 0x97, 0x58, 0xd1, 0x4a, 0xe0, 0xd7, 0x1e, 0xaf, 0x85, 0x92, 0xd4, 0xf5, 0xc3, 0x8d, 
+0xc6, 0xb7, 0x16, 0x4d, 0xa7, 0x31, 0xb2, 0x7f, 0xd8, 0xec, 0xe5, 0x4a, 0xe5, 0x4b, 0x76, 0x3b, 
+0x86, 0x16, 0xd3, 0x5f, 0x23, 0x8e, 0x06, 0x41, 0x4c, 0x57, 0xcf, 0x84, 0x28, 0x3d, 0x8b, 0x21, 
+0xeb, 0xce, 0x9d, 0x7c, 0x08, 0x5d, 0x0c, 0xf9, 0x8d, 0x61, 0xc0, 0x4a, 0xf0, 0xe6, 0x06, 0xf3, 
+0xc9, 0xf2, 0x45, 0x14, 0xb0, 0x74, 0xfb, 0x81, 0xa7, 0xeb, 0x8f, 0xa4, 0xca, 0x9d, 0x70, 0xe3, 
+0xc0, 0xe3, 0x02, 0xed, 0x4f, 0x63, 0xf7, 0x26, 0x18, 0x4f, 0x29, 0x70, 0x98, 0x30, 0x67, 0xb1, 
+0x63, 0xfa, 0x56, 0x9d, 0x0a, 0x45, 0x2e, 0x0a, 0xc5, 0x7c, 0x95, 0x8b, 0xd5, 0x73, 0xc1, 0xf4, 
+0xa0, 0xb2, 0x6f, 0x4a, 0x1e, 0x3a, 0x5f, 0xc8, 0x52, 0x9f, 0x5d, 0x9a, 0x36, 0x16, 0xa1, 0xf1, 
+0x7c, 0xd2, 0xe9, 0xf4, 0x5e, 0xa4, 0xf7, 0xbc, 0x74, 0xa5, 0x3b, 0xea, 0x3d, 0xae, 0x15, 0xa6, 
+0xeb, 0x90, 0x54, 0xad, 0x34, 0x06, 0x1a, 0x42, 0xd3, 0xc7, 0x4a, 0x36, 0x03, 0xe7, 0xb9, 0x6b, 
+0x15, 0x8b, 0x4d, 0x26, 0x81, 0xd7, 0xa8, 0xe2, 0xa6, 0xd8, 0x25, 0xea, 0x26, 0x2d, 0x52, 0x69, 
+0xe1, 0x36, 0x2b, 0x5e, 0x48, 0x6a, 0xc7, 0x3b, 0x82, 0xb5, 0x1b, 0xd9, 0x3e, 0xb1, 0xd1, 0x5c, 
+0x15, 0xc9, 0xe8, 0x4a, 0x5d, 0x79, 0x08, 0x1f, 0x78, 0xfb, 0xc4, 0xf6, 0x30, 0xe2, 0xb1, 0xf4, 
+0x26, 0x0d, 0x47, 0xb6, 0xe7, 0x94, 0x9e, 0x17, 0x95, 0x18, 0xe3, 0xa1, 0xf4, 0xbd, 0x86, 0x0b, 
+0x4a, 0x0d, 0x28, 0xc3, 0xa5, 0x06, 0xb1, 0x8d, 0x19, 0x0c, 0x82, 0x09, 0x6f, 0xdc, 0x81, 0xc7, 
+0x82, 0x64, 0xb2, 0x90, 0x6c, 0x2f, 0xe1, 0x69, 0x76, 0xf8, 0x3f, 0x96, 0xb9, 0xf1, 0xb8, 0xd1, 
+0xbe, 0xa2, 0x4f, 0x27, 0xdc, 0x2a, 0xe9, 0x1b, 0xe4, 0x36, 0xc0, 0xd6, 0xe3, 0x19, 0xc7, 0x03, 
+0xc9, 0x37, 0xc1, 0x7c, 0x25, 0xfb, 0x49, 0xa1, 0xb7, 0x2f, 0xb5, 0x61, 0xa7, 0x0c, 0x4a, 0x85, 
+0xc0, 0x56, 0x8c, 0xfa, 0x6e, 0xb1, 0x52, 0xde, 0x90, 0xb4, 0xde, 0xc6, 0x4d, 0x30, 0x8a, 0x27, 
+0x9e, 0xa4, 0x76, 0x3a, 0xc9, 0xb9, 0x2e, 0x08, 0x31, 0xdb, 0x0b, 0x5d, 0x2f, 0xbd, 0x27, 0x09, 
+0x6c, 0xa0, 0x3f, 0x17, 0xcf, 0x85, 0xeb, 0x60, 0x8e, 0x93, 0xc2, 0x6c, 0x2b, 0x73, 0xb5, 0xec, 
+0x31, 0x06, 0x2f, 0x50, 0xfb, 0x18, 0xe7, 0xdf, 0x73, 0x47, 0x8c, 0xf0, 0xd2, 0x9b, 0xd0, 0x5e, 
+0x20, 0x69, 0x25, 0xf4, 0x84, 0x59, 0xd1, 0x8e, 0x49, 0x60, 0x73, 0xae, 0x5a, 0x91, 0xf3, 0x89, 
+0xb5, 0x7e, 0x4d, 0x59, 0xf5, 0xb0, 0xe9, 0xf3, 0x78, 0xac, 0x3f, 0x68, 0xc5, 0xd1, 0x49, 0xfc, 
+0x5e, 0xd9, 0xe7, 0x02, 0xf9, 0xad, 0x43, 0x72, 0xd7, 0x37, 0xfc, 0x06, 0x82, 0xc6, 0x29, 0x31, 
+0xa2, 0xce, 0x71, 0xbd, 0x24, 0x81, 0xda, 0xe0, 0x5e, 0x3f, 0x6a, 0x5c, 0xd5, 0x7f, 0x38, 0x69, 
+0xc3, 0x84, 0x6b, 0xe3, 0xd2, 0x76, 0x4b, 0xe5, 0x31, 0x7b, 0x49, 0x4f, 0xb1, 0x5f, 0x7a, 0x47, 
+0xfe, 0x61, 0xfa, 0x42, 0xa9, 0xb4, 0xda, 0x49, 0x3e, 0x5a, 0x04, 0x3a, 0x1d, 0xba, 0x39, 0x54, 
+0xac, 0x41, 0x74, 0xac, 0x85, 0xe4, 0xd0, 0xb7, 0xca, 0x07, 0x3c, 0x59, 0x03, 0xfd, 0x4c, 0x60, 
+0x2c, 0x7d, 0x4a, 0x52, 0x1c, 0xb0, 0x92, 0xf7, 0x0a, 0xe8, 0x45, 0xa0, 0xeb, 0x17, 0x0d, 0x12, 
+0xf0, 0x98, 0xc0, 0xe3, 0x18, 0x62, 0x15, 0xeb, 0x67, 0x32, 0xfa, 0x08, 0x49, 0x04, 0xa9, 0x35, 
+0xe3, 0xf4, 0x7b, 0x5c, 0x98, 0x64, 0x95, 0x4c, 0x6b, 0xfc, 0x72, 0x8c, 0x81, 0x57, 0x1c, 0x91, 
+0xea, 0x25, 0xd1, 0xb4, 0x07, 0xa0, 0xe9, 0x5b, 0x4f, 0x18, 0xca, 0x96, 0xd9, 0x2f, 0x20, 0xc7, 
+0x2d, 0xa3, 0x0e, 0x81, 0x95, 0x4d, 0x91, 0x8d, 0x75, 0xf7, 0x81, 0xb6, 0xd4, 0x7c, 0xf9, 0xc2, 
+0x95, 0x0e, 0x2d, 0x17, 0xe1, 0x5e, 0xbe, 0x17, 0x3b, 0xa6, 0xe9, 0x13, 0x62, 0xfd, 0xa6, 0xd2, 
+0xca, 0x71, 0xb2, 0xf7, 0x84, 0x06, 0xb2, 0xef, 0x46, 0xf2, 0x6a, 0xb1, 0x62, 0x71, 0xb2, 0xd9, 
+0x44, 0x6e, 0x58, 0xb6, 0xa3, 0xe6, 0x25, 0xa7, 0xb4, 0xac, 0xf9, 0x3d, 0x4e, 0x1c, 0x86, 0xeb, 
+0x1f, 0xbd, 0x81, 0xcb, 0x4a, 0xa1, 0xd0, 0xf6, 0xe3, 0x0d, 0xe1, 0x8f, 0x05, 0x30, 0x5e, 0x46, 
+0x3b, 0xd8, 0x4f, 0x38, 0x40, 0x8a, 0x6f, 0x2e, 0xd5, 0xf8, 0x41, 0xc7, 0x09, 0xce, 0x14, 0x20, 
+0xeb, 0x68, 0xe5, 0x9e, 0x48, 0x69, 0xc5, 0xd0, 0xb9, 0x0b, 0x75, 0xb0, 0xe2, 0x3c, 0x03, 0xe8, 
+0x2a, 0x19, 0x61, 0x68, 0xec, 0x96, 0x4c, 0xb6, 0x83, 0xa8, 0x62, 0x94, 0xfd, 0x13, 0x8c, 0x5d, 
+0xeb, 0x17, 0x30, 0xb6, 0xf5, 0x8d, 0x59, 0xd5, 0xcf, 0xbe, 0x18, 0x7a, 0x3a, 0x85, 0xe4, 0x83, 
+0xc4, 0xd6, 0xf8, 0x62, 0xec, 0xa2, 0x9c, 0xe4, 0x97, 0xcb, 0xf7, 0xc1, 0x9e, 0x07, 0x48, 0xb1, 
+0x79, 0xbd, 0x51, 0xa4, 0xc5, 0x26, 0xf2, 0x7d, 0x18, 0x7c, 0x94, 0x81, 0x2b, 0xa8, 0x3c, 0xa7, 
+0x3a, 0x8c, 0x9b, 0x0d, 0xfa, 0x0c, 0x6a, 0x5b, 0x6f, 0xc1, 0x3c, 0x7a, 0x91, 0xbd, 0x26, 0xf2, 
+0xa6, 0x53, 0xf7, 0xc3, 0x81, 0x4c, 0xa7, 0x13, 0xa0, 0xf1, 0x4b, 0x63, 0xf2, 0x7e, 0x3f, 0x38, 
+0xc5, 0x9e, 0x6c, 0xb1, 0xf6, 0xb3, 0x2d, 0xf4, 0x53, 0x71, 0x8f, 0x92, 0xbf, 0xd0, 0x5d, 0xc0, 
+0x69, 0x08, 0xf4, 0x27, 0x94, 0x85, 0xf9, 0x74, 0x90, 0x3e, 0x18, 0x0a, 0x13, 0x58, 0x4c, 0x0d, 
+0x80, 0xc1, 0xd7, 0x0c, 0x9f, 0xa1, 0x3c, 0x0a, 0x71, 0x3d, 0x63, 0x02, 0xe1, 0x50, 0x42, 0xa4, 
+0xf5, 0x2d, 0xa0, 0x28, 0xd0, 0x53, 0x92, 0xd3, 0x78, 0xa3, 0xc5, 0x09, 0xf2, 0x5e, 0x36, 0xc7, 
+0xd5, 0xf2, 0x76, 0x04, 0xed, 0x26, 0xf3, 0x91, 0x72, 0x4e, 0x12, 0xe0, 0x94, 0xbe, 0x58, 0x05, 
+0x36, 0x29, 0x7a, 0x8e, 0x4d, 0x2b, 0x79, 0x6f, 0xb5, 0xd0, 0x3b, 0xd8, 0xc5, 0xbe, 0x82, 0xca, 
+0x6d, 0x5c, 0x4a, 0x2d, 0x60, 0x8a, 0x47, 0x35, 0x90, 0xee, 0x57, 0xb0, 0xba, 0xfc, 0x35, 0x0d, 
+0x41, 0x73, 0xf2, 0x8a, 0xd5, 0x73, 0xb6, 0xaf, 0x05, 0xae, 0xc4, 0xe2, 0xd5, 0xca, 0x6b, 0x4e, 
+0x79, 0xd2, 0xf9, 0x65, 0xbe, 0x49, 0xb3, 0xf5, 0x13, 0x85, 0xc9, 0xf5, 0xb8, 0xf8, 0x1f, 0x7a, 
+0xc8, 0x39, 0xde, 0x83, 0x6d, 0x93, 0x6c, 0xfa, 0x53, 0xcf, 0x79, 0xe6, 0xf0, 0xd1, 0x9e, 0x86, 
+0xc4, 0x0d, 0xb2, 0xfa, 0x49, 0x1c, 0x4d, 0xf9, 0xb5, 0xe4, 0x16, 0xc5, 0x8c, 0x69, 0xd8, 0xac, 
+0x37, 0x20, 0xae, 0x3b, 0xd8, 0xf4, 0xc0, 0x37, 0x0e, 0x8a, 0x02, 0xd4, 0xa7, 0x9f, 0x64, 0x26, 
+0xf7, 0x25, 0x7f, 0x18, 0x4b, 0x19, 0x0e, 0x7a, 0x4b, 0xf2, 0x1f, 0x8b, 0xd7, 0x8a, 0x09, 0xc7, 
+0x16, 0x2d, 0xa7, 0x84, 0xa6, 0x9b, 0xca, 0x63, 0xf2, 0xea, 0xd0, 0xb3, 0xdc, 0x20, 0x91, 0xb1, 
+0xc8, 0x42, 0xf3, 0xd6, 0xc0, 0x57, 0x1c, 0x31, 0xf2, 0x76, 0x2a, 0x8b, 0x80, 0xe7, 0xb1, 0x34, 
+0xd0, 0x59, 0x5a, 0xd4, 0x6b, 0xfa, 0x61, 0xdb, 0x04, 0x7b, 0xf5, 0x36, 0xe8, 0xa2, 0xb0, 0x41, 
+0x9b, 0x4e, 0x62, 0xa3, 0xe8, 0x69, 0x71, 0xa3, 0x06, 0x7e, 0x5b, 0x16, 0x20, 0x8a, 0xd7, 0xaf, 
+0xe0, 0x3b, 0x54, 0x61, 0xed, 0x68, 0x4d, 0x6f, 0x0a, 0x51, 0xe5, 0xda, 0xb5, 0x1f, 0x4d, 0x80, 
+0x31, 0xc2, 0x8e, 0xc0, 0x93, 0xac, 0x04, 0x9e, 0x17, 0xe6, 0x8c, 0x51, 0xe2, 0xc6, 0x9d, 0x31, 
+0x42, 0x4c, 0x26, 0x3d, 0xe9, 0x74, 0x0d, 0xe1, 0xce, 0x30, 0x64, 0x18, 0x4b, 0x81, 0x52, 0x78, 
+0x16, 0xd3, 0x75, 0x86, 0xaf, 0xb7, 0x80, 0xa2, 0x8a, 0xeb, 0x4a, 0xe7, 0x95, 0xaf, 0x05, 0xd2, 
+0xad, 0x62, 0x4d, 0x7b, 0x6a, 0x3e, 0xc2, 0x80, 0xe1, 0x4c, 0x73, 0x95, 0xce, 0xa0, 0x81, 0x90, 
+0xb4, 0x17, 0x6e, 0xca, 0x53, 0x7b, 0x84, 0xf4, 0xb1, 0xa4, 0xe6, 0x5d, 0xec, 0x39, 0x0a, 0x83, 
+0xc9, 0x74, 0x2b, 0x03, 0x5a, 0xd7, 0x2f, 0xc8, 0xa2, 0x9f, 0x91, 0x59, 0x2c, 0x79, 0xb6, 0xf1, 
+0x97, 0x63, 0xc9, 0x5b, 0xee, 0x6a, 0x0a, 0x4d, 0xa1, 0xe8, 0xd3, 0xb5, 0xd3, 0xa2, 0xf2, 0x6c, 
+0x97, 0x50, 0xb5, 0x8e, 0xaf, 0x95, 0xdf, 0x48, 0x25, 0xfb, 0x69, 0x2b, 0x85, 0xfd, 0x8e, 0xec, 
+0xa0, 0x6d, 0x9e, 0xcf, 0x4a, 0x8f, 0xeb, 0xd3, 0x51, 0x0e, 0x5c, 0x94, 0xf1, 0x3d, 0x68, 0x3c, 
+0x14, 0xdc, 0x8e, 0x70, 0x54, 0xcf, 0xa8, 0xe2, 0x8d, 0x17, 0x14, 0xb3, 0x87, 0x2d, 0x05, 0xf2, 
+0x71, 0xe2, 0x4e, 0xd7, 0x2f, 0xcd, 0x38, 0x71, 0xce, 0x25, 0x0c, 0xa0, 0x7d, 0xf3, 0x2d, 0x97, 
+0x81, 0xbf, 0x63, 0xeb, 0x6f, 0x3c, 0xf6, 0x39, 0x71, 0xf8, 0x0d, 0x37, 0x45, 0xc0, 0x3b, 0xc7, 
+0x4d, 0x30, 0x72, 0x84, 0x3e, 0xca, 0x27, 0xf6, 0x84, 0x73, 0xd5, 0x82, 0x7d, 0x42, 0x9b, 0x62, 
+0x8f, 0x54, 0xba, 0x70, 0xd3, 0xae, 0x4a, 0x0c, 0x61, 0x7b, 0x1a, 0x70, 0xca, 0x13, 0x85, 0xf3, 
+0x70, 0x42, 0x93, 0x07, 0x5f, 0x3c, 0x47, 0x05, 0x92, 0x61, 0x42, 0x0e, 0x93, 0xb9, 0x61, 0xe7, 
+0x5c, 0x49, 0x20, 0xd8, 0xab, 0x31, 0x63, 0xae, 0x81, 0x90, 0x53, 0x09, 0xf2, 0x9b, 0xf6, 0x9d, 
+0xae, 0x59, 0x8b, 0xc4, 0xa8, 0x5c, 0x97, 0xb3, 0x85, 0xa9, 0x25, 0xe6, 0x49, 0xfa, 0x3d, 0x62, 
+0x95, 0x0c, 0x8b, 0x04, 0x2d, 0x5a, 0x2d, 0x74, 0x0d, 0x19, 0x0d, 0x8e, 0xc4, 0x2a, 0x6b, 0x90, 
+0xfb, 0xd5, 0x7e, 0x30, 0x9f, 0xb4, 0xec, 0xa1, 0xeb, 0x08, 0xe0, 0x31, 0xca, 0x0f, 0x6b, 0x1f, 
+0x5b, 0x6f, 0x51, 0xfa, 0x0c, 0x97, 0x0d, 0x4f, 0x26, 0xd8, 0x2f, 0x72, 0x9d, 0x0e, 0x63, 0xbe, 
+0x64, 0xd7, 0xad, 0x16, 0x9b, 0xac, 0x6a, 0xb2, 0xd4, 0x89, 0x26, 0xb3, 0xec, 0xb9, 0x8c, 0xa7, 
+0xf6, 0xd3, 0xfb, 0x30, 0xad, 0x76, 0xbe, 0x45, 0xf0, 0x89, 0x2c, 0x58, 0xeb, 0x37, 0xdb, 0x5c, 
+0x45, 0xd5, 0x80, 0xf5, 0x0b, 0x4d, 0x2e, 0x17, 0xf3, 0x6d, 0x16, 0xf0, 0xe6, 0x40, 0xfb, 0x0d, 
+0xa1, 0x6c, 0x95, 0x8f, 0xe3, 0x7a, 0x61, 0xfa, 0xc6, 0x17, 0x4c, 0x19, 0xa6, 0xb5, 0xa4, 0x52, 
+0x9d, 0x73, 0x5d, 0x4e, 0x27, 0x18, 0xd6, 0xad, 0x16, 0x58, 0xf0, 0x5d, 0x65, 0x26, 0x4d, 0xb9, 
+0x42, 0xd9, 0x1e, 0x9c, 0x30, 0x92, 0xc4, 0xd7, 0x41, 0xd6, 0xe3, 0xa8, 0x9b, 0x16, 0x3b, 0x5d, 
+0x4b, 0x34, 0x92, 0xc1, 0x89, 0xf0, 0xe2, 0x8c, 0xe3, 0xe1, 0x7f, 0x59, 0x1c, 0xb0, 0xfd, 0xa1, 
+0x84, 0x0e, 0x61, 0x45, 0xb2, 0x84, 0x16, 0xa8, 0xd2, 0x0f, 0x5a, 0x92, 0x6d, 0x5b, 0xfa, 0x0f, 
+0xe4, 0xaf, 0x26, 0xe8, 0x70, 0xc3, 0xac, 0x27, 0x91, 0xf8, 0x06, 0xa4, 0xd0, 0xbf, 0x42, 0xc4, 
+0xa1, 0xd8, 0xc9, 0x73, 0xf8, 0x40, 0xe1, 0xb1, 0xac, 0x2f, 0x4b, 0x75, 0xe8, 0x9d, 0xe8, 0x5f, 
+0x28, 0x3e, 0x7c, 0xfb, 0x06, 0xbf, 0xc0, 0x79, 0x5b, 0x3a, 0x12, 0xf8, 0x3b, 0xa2, 0x76, 0x9b, 
+0x39, 0xdf, 0x8a, 0x5f, 0xc7, 0x5b, 0x42, 0x68, 0x1d, 0x8e, 0xa6, 0x83, 0xe5, 0xb2, 0x81, 0x5e, 
+0x2c, 0x4f, 0x9c, 0x18, 0xe5, 0x8f, 0x8e, 0x57, 0xd2, 0x63, 0xb4, 0xa5, 0x08, 0x64, 0x0d, 0x48, 
+0xe7, 0x36, 0xe8, 0x47, 0xf7, 0x53, 0xdc, 0xe1, 0x90, 0xda, 0x7d, 0xf2, 0x46, 0x9c, 0x13, 0x7c, 
+0x14, 0xe7, 0x41, 0x73, 0x26, 0x70, 0xda, 0x31, 0xda, 0x61, 0xe4, 0x6c, 0x36, 0x3b, 0x7f, 0x92, 
+0xb8, 0x29, 0x8a, 0x72, 0xeb, 0x72, 0x54, 0x15, 0xb2, 0xc7, 0x49, 0x36, 0x48, 0xd3, 0x9e, 0x32, 
+0x90, 0x3b, 0x60, 0x3b, 0xd5, 0x0d, 0x21, 0x73, 0xe8, 0x12, 0xe3, 0xa1, 0xf6, 0xce, 0x8b, 0x47, 
+0x5e, 0x0d, 0xc3, 0x1f, 0x72, 0xb0, 0x72, 0x16, 0x08, 0xf3, 0xad, 0x5a, 0xeb, 0x47, 0x01, 0xeb, 
+0x97, 0x3c, 0xe7, 0xc6, 0x40, 0x7e, 0x06, 0xa3, 0x07, 0xc1, 0xc0, 0xa3, 0xb4, 0xa5, 0x97, 0xf2, 
+0xd4, 0xbc, 0x92, 0xb0, 0x62, 0xc5, 0x12, 0x9c, 0x2d, 0xb6, 0x89, 0x37, 0xc5, 0xf4, 0x90, 0x5c, 
+0xea, 0x38, 0x5e, 0x8f, 0xb9, 0x26, 0xe9, 0xc5, 0xac, 0xb4, 0x85, 0x4f, 0x92, 0xf9, 0x71, 0xad, 
+0xea, 0xc2, 0x5c, 0x3d, 0x57, 0xe5, 0x0d, 0xc5, 0x98, 0x3f, 0xce, 0x8a, 0xe5, 0xaf, 0xbe, 0x7d, 
+0x09, 0x60, 0xc6, 0x1d, 0xb4, 0xf1, 0x5a, 0xe4, 0x7f, 0x96, 0xc8, 0x94, 0xca, 0x59, 0x87, 0x4d, 
+0x80, 0x43, 0x69, 0x0c, 0xf7, 0x39, 0x4e, 0xa8, 0x0e, 0xa4, 0xbe, 0xd9, 0xe4, 0x1c, 0x7d, 0x03, 
+0x72, 0x3f, 0xbc, 0x52, 0x0f, 0xa5, 0x1a, 0x29, 0xfb, 0x5a, 0x4c, 0x7f, 0xb2, 0xa4, 0x69, 0x4f, 
+0x0c, 0xe1, 0xd0, 0xb9, 0x6f, 0x29, 0x5f, 0x7c, 0x9f, 0x8a, 0xb4, 0xe0, 0x6a, 0x1f, 0x20, 0x5f, 
+0x83, 0xc1, 0x6b, 0x38, 0x71, 0xfb, 0xd0, 0x46, 0x0d, 0x80, 0xb2, 0xdf, 0x30, 0x5f, 0x9c, 0x18, 
+0x63, 0x4e, 0xb5, 0x82, 0x40, 0x7e, 0x90, 0x4a, 0x90, 0xc3, 0x6f, 0x14, 0x0d, 0x1a, 0x60, 0xd7, 
+0x30, 0x81, 0x25, 0xca, 0xf3, 0xe8, 0xa5, 0xf8, 0x67, 0xad, 0x27, 0x96, 0x02, 0xb4, 0xa1, 0x5f, 
+0x06, 0xd3, 0xb6, 0xeb, 0x27, 0xfa, 0xc5, 0xd1, 0xa9, 0x1b, 0x82, 0x64, 0xc5, 0x6c, 0x15, 0x73, 
+0xa9, 0xe1, 0x68, 0xe6, 0x9a, 0x58, 0x37, 0x96, 0xd8, 0x08, 0xf4, 0xd0, 0xd7, 0x38, 0x2e, 0x29, 
+0xd5, 0xd2, 0x7e, 0xd5, 0x87, 0xb2, 0xc8, 0x31, 0xc7, 0x1e, 0x38, 0x1d, 0x43, 0x0d, 0x7d, 0x5a, 
+0x38, 0xd4, 0xb8, 0xad, 0x16, 0xa7, 0xde, 0x2b, 0x05, 0x72, 0x6a, 0x2c, 0x75, 0xa3, 0x95, 0x42, 
+0xd8, 0xa1, 0x27, 0xec, 0xb7, 0xc0, 0x2d, 0xf7, 0xb9, 0x5d, 0x68, 0xe1, 0xf2, 0xae, 0xb8, 0x7b, 
+0xf6, 0x3a, 0x82, 0x41, 0xfc, 0x6d, 0x74, 0x02, 0x75, 0x1b, 0x24, 0xb0, 0x3e, 0x58, 0xcf, 0x1c, 
+0xae, 0x83, 0xfd, 0x7b, 0x28, 0x4f, 0x01, 0x95, 0x1c, 0x92, 0x0f, 0x83, 0x52, 0x6f, 0x5c, 0x0f, 
+0x92, 0x8f, 0x84, 0xb0, 0xc2, 0x6b, 0x42, 0xb0, 0xfd, 0xc1, 0xda, 0xf3, 0x4c, 0x52, 0xb6, 0xa5, 
+0x81, 0xcf, 0xb5, 0x60, 0x48, 0x9f, 0xb1, 0x2a, 0x13, 0x96, 0x5f, 0x64, 0xea, 0x5b, 0xc0, 0xe5, 
+0xa7, 0xe4, 0x18, 0x2f, 0xc5, 0x17, 0xc6, 0xe2, 0x4e, 0xb1, 0x48, 0x69, 0xfc, 0xb4, 0x9f, 0xb7, 
+0xe2, 0xcf, 0xd6, 0x8b, 0x6e, 0x38, 0xd3, 0xa0, 0x31, 0x8a, 0x63, 0xa1, 0x4f, 0x21, 0x3b, 0x75, 
+0x68, 0x41, 0x52, 0x3a, 0x7c, 0xe5, 0xbf, 0x9b, 0x69, 0x3b, 0xf9, 0x8e, 0xb9, 0xc6, 0xe9, 0x7e, 
+0xc9, 0x14, 0x07, 0xd3, 0x85, 0x6a, 0x04, 0x93, 0xec, 0x5a, 0x7c, 0xf8, 0x4b, 0x5d, 0x64, 0xb7, 
+0xec, 0xd0, 0xa7, 0xdb, 0x53, 0xa0, 0x2e, 0xd2, 0x64, 0x8d, 0xf5, 0xc7, 0x41, 0x86, 0x20, 0x5b, 
+0x19, 0xd6, 0xe8, 0x3f, 0x2b, 0x63, 0x91, 0xdb, 0xe1, 0x60, 0x48, 0xb6, 0xef, 0x2b, 0x09, 0xca, 
+0x08, 0x37, 0x4a, 0x96, 0x1c, 0x26, 0xac, 0x81, 0x6e, 0x39, 0xf3, 0x17, 0xb8, 0x3f, 0xc0, 0x4d, 
+0x58, 0x2e, 0x05, 0x31, 0x93, 0x61, 0x70, 0xf1, 0x2c, 0x5e, 0xb6, 0x85, 0xfd, 0x5f, 0x48, 0xc6, 
+0xd7, 0x8d, 0xaf, 0x2c, 0xdb, 0xf7, 0xd9, 0xe4, 0x02, 0x62, 0x07, 0xc5, 0x2e, 0x71, 0xa3, 0xc6, 
+0x34, 0xf0, 0x3d, 0x16, 0x32, 0xda, 0xb5, 0x4b, 0x2f, 0x1c, 0x6c, 0x1b, 0x70, 0xae, 0x63, 0x26, 
+0xae, 0x38, 0xa2, 0xc1, 0x94, 0x83, 0xe4, 0x12, 0x8e, 0xbd, 0x79, 0x68, 0xfb, 0x90, 0x39, 0xa6, 
+0x25, 0xcf, 0x4a, 0xe8, 0x7f, 0x2b, 0x01, 0x7d, 0x94, 0xe0, 0x7f, 0x85, 0xc3, 0xad, 0x93, 0xc5, 
+0xa4, 0xd7, 0xe3, 0x26, 0xe4, 0xdf, 0x0b, 0x24, 0xfb, 0x9d, 0x3e, 0x49, 0xb7, 0xda, 0x05, 0xa9, 
+0xf0, 0x52, 0x9a, 0xc1, 0x31, 0xa6, 0xd8, 0xca, 0xd8, 0xe5, 0x3e, 0xa4, 0x49, 0x71, 0x04, 0xd2, 
+0x97, 0xb2, 0xe0, 0x92, 0xc0, 0x5b, 0x60, 0x49, 0x03, 0x2a, 0x60, 0xbe, 0x89, 0xdf, 0x93, 0xd1, 
+0x4a, 0x40, 0xe5, 0x0e, 0x1a, 0xa7, 0x8c, 0x5a, 0xb5, 0xf7, 0xe3, 0x90, 0x7d, 0x49, 0x8e, 0x3a, 
+0x64, 0x12, 0x95, 0xcd, 0x17, 0x0f, 0x4b, 0xe5, 0x0f, 0xa1, 0x69, 0xa7, 0xd6, 0x15, 0x3b, 0x04, 
+0xa1, 0xe7, 0xd4, 0x1e, 0xd9, 0xb7, 0x8d, 0x31, 0xa4, 0x39, 0xd4, 0xc5, 0x08, 0xa5, 0xd3, 0xa4, 
+0x27, 0xb5, 0xf2, 0xe0, 0x38, 0x15, 0xad, 0x79, 0x1c, 0x92, 0x6e, 0xd8, 0x70, 0x57, 0x0f, 0x25, 
+0x04, 0x25, 0x8e, 0xc2, 0x5c, 0x9e, 0x75, 0xe7, 0x9e, 0xc7, 0xa4, 0x27, 0x50, 0xab, 0x8c, 0x3d, 
+0x2f, 0x49, 0xac, 0xf6, 0xb3, 0x17, 0x9b, 0x5f, 0xa6, 0xe2, 0x49, 0xe3, 0x86, 0xec, 0x2d, 0x63, 
+0x1b, 0x54, 0xa6, 0x8c, 0x9f, 0x8d, 0x68, 0xb9, 0x57, 0xd4, 0x2f, 0x08, 0xd0, 0x86, 0x1d, 0x8f, 
+0xba, 0x30, 0xd2, 0x7f, 0xd8, 0xfd, 0xb0, 0xf9, 0x4b, 0xc6, 0x90, 0x7a, 0x36, 0xd7, 0xce, 0x5f, 
+0x04, 0xaf, 0x2e, 0xc2, 0xe3, 0x52, 0xb6, 0xf0, 0x93, 0x12, 0x3b, 0x65, 0xde, 0x67, 0xae, 0x2b, 
+0x6d, 0x2c, 0x74, 0x0e, 0x9f, 0x41, 0x7a, 0x67, 0x9e, 0xc8, 0x40, 0xe5, 0xb6, 0x8a, 0x57, 0x1a, 
+0xc2, 0xa4, 0xcb, 0x7a, 0xdf, 0x8c, 0x13, 0x7b, 0x3d, 0x74, 0x1b, 0x2c, 0x60, 0x52, 0xf1, 0xbf, 
+0x24, 0xd1, 0x95, 0x06, 0x0b, 0xd3, 0xe7, 0x20, 0xe4, 0xc3, 0x6d, 0x31, 0x83, 0xc8, 0xf5, 0xcb, 
+0x7d, 0x15, 0x84, 0xa7, 0xf3, 0xc7, 0xe1, 0x2e, 0x06, 0x3c, 0x2a, 0x3d, 0xf2, 0x1e, 0x6b, 0x4e, 
+0x7c, 0x3a, 0x40, 0xc5, 0x26, 0xe7, 0xb5, 0x90, 0x3b, 0x53, 0x78, 0x53, 0xe2, 0x81, 0xd3, 0x6e, 
+0xc9, 0x24, 0xb0, 0x3b, 0x2c, 0x87, 0x95, 0x87, 0xc6, 0xa8, 0xc3, 0x8b, 0x5e, 0x6c, 0xe0, 0xf9, 
+0x1c, 0x02, 0x54, 0x8f, 0x31, 0xf8, 0x1b, 0xc8, 0x60, 0xd8, 0x2c, 0xb4, 0xd0, 0x62, 0xfb, 0x63, 
+0xf0, 0x24, 0xd9, 0x35, 0x4f, 0xe8, 0x16, 0x8c, 0x39, 0x6e, 0x4d, 0x6f, 0x40, 0x6b, 0xf0, 0x84, 
+0xfb, 0x83, 0xc9, 0x68, 0xce, 0x62, 0xf7, 0xdb, 0x86, 0x18, 0x51, 0xa8, 0x59, 0xda, 0xf0, 0x7d, 
+0xa4, 0xd0, 0xa7, 0x1f, 0x4a, 0x93, 0xfa, 0x09, 0xd6, 0x10, 0x9d, 0xb5, 0x7d, 0x19, 0xf7, 0x14, 
+0x6b, 0x49, 0xac, 0x32, 0x91, 0x5e, 0xb7, 0x93, 0x68, 0xc4, 0xa1, 0xe4, 0xa1, 0x9c, 0x1a, 0xb1, 
+0x76, 0xb4, 0xfb, 0x82, 0x50, 0xf5, 0x18, 0x69, 0x5e, 0x3c, 0x40, 0xd1, 0x92, 0xf0, 0x5d, 0x2a, 
+0x47, 0xd9, 0x48, 0x6a, 0x48, 0xbd, 0xfa, 0x07, 0xa5, 0xa4, 0x9f, 0x62, 0xd5, 0xb9, 0xe4, 0x1f, 
+0x5b, 0x3c, 0x81, 0xa2, 0xda, 0xce, 0x1b, 0xf0, 0x8b, 0x35, 0xdf, 0x24, 0x17, 0x0b, 0x2a, 0x91, 
+0x8a, 0xea, 0x36, 0xda, 0x29, 0xda, 0x05, 0xe3, 0x08, 0x9b, 0x41, 0xae, 0x9e, 0x4f, 0x7c, 0x4e, 
+0xd0, 0x28, 0x48, 0xb5, 0xf1, 0x95, 0x2c, 0x30, 0x92, 0xc7, 0xb1, 0xe2, 0x5a, 0x8b, 0x46, 0x38, 
+0xa4, 0xb5, 0x3e, 0xb2, 0xa8, 0xc0, 0x51, 0x8b, 0x6f, 0xa7, 0x2d, 0xaf, 0x1e, 0x02, 0xf8, 0xcc, 
+0x67, 0xe5, 0x2e, 0x4c, 0xae, 0x57, 0xa1, 0x4d, 0xb7, 0x9c, 0xad, 0xf1, 0xb8, 0x0b, 0xfa, 0x35, 
+0xb4, 0xd7, 0x9e, 0x71, 0xc0, 0xa2, 0xf1, 0xc2, 0xf2, 0x69, 0x16, 0xc2, 0xec, 0x73, 0xe5, 0x1b, 
+0x73, 0x16, 0xf0, 0x89, 0x27, 0x9d, 0x45, 0xe7, 0x48, 0x57, 0x92, 0x6d, 0x91, 0x79, 0x03, 0x9e, 
+0xb5, 0xc4, 0x80, 0xc3, 0xd5, 0x14, 0x9c, 0x75, 0x31, 0x5f, 0x37, 0xb2, 0xa5, 0x16, 0xe8, 0x42, 
+0x15, 0xb2, 0xad, 0x1b, 0x37, 0xb5, 0xe1, 0x92, 0x7b, 0x6e, 0xa6, 0xe8, 0x5f, 0x60, 0xe5, 0x7c, 
+0xc3, 0xfe, 0x2c, 0xf1, 0xe2, 0xcd, 0x08, 0xc6, 0xe3, 0xf7, 0xd7, 0xe4, 0x7d, 0x09, 0x41, 0x53, 
+0xb7, 0x9d, 0x36, 0x29, 0x3d, 0x1a, 0x6f, 0x85, 0x0f, 0x30, 0xc6, 0xf9, 0x3e, 0x36, 0x3c, 0x47, 
+0x4f, 0x51, 0x76, 0xce, 0x7b, 0x31, 0x54, 0xb8, 0xf3, 0x68, 0x5b, 0x38, 0xe7, 0x4c, 0x37, 0xd9, 
+0x40, 0x6d, 0x08, 0x3a, 0x4e, 0xca, 0x36, 0xad, 0xc4, 0x0f, 0x1a, 0xc9, 0x0b, 0x1d, 0x35, 0xea, 
+0x46, 0xea, 0xb6, 0x7a, 0x2f, 0x9d, 0xf5, 0xe6, 0xbf, 0x28, 0xd0, 0x1e, 0xec, 0x68, 0xae, 0xc5, 
+0xfd, 0xeb, 0x3c, 0x70, 0xf7, 0xc8, 0x06, 0x95, 0x6f, 0xa1, 0x63, 0xce, 0x08, 0x3d, 0x04, 0x9b, 
+0xd1, 0x4b, 0x84, 0x39, 0x06, 0x19, 0x57, 0x09, 0x63, 0x86, 0xa5, 0x70, 0x95, 0x14, 0xb3, 0xf0, 
+0xb3, 0x4f, 0xc8, 0xea, 0xd4, 0x58, 0xb0, 0xe5, 0x0b, 0x84, 0xd0, 0x7b, 0x29, 0xad, 0x28, 0x50, 
+0x6a, 0x0e, 0x52, 0x0d, 0x6a, 0x3e, 0x92, 0x81, 0x08, 0xfa, 0xd0, 0x6c, 0x5d, 0x4c, 0x1e, 0x6d, 
+0x05, 0xae, 0x05, 0xe1, 0x8f, 0xb2, 0xa7, 0xdf, 0x90, 0x7c, 0x2d, 0x53, 0x6e, 0xa7, 0x62, 0x3e, 
+0x63, 0xfa, 0xc8, 0x0c, 0x2d, 0x14, 0xe2, 0xe0, 0x68, 0x13, 0x7a, 0x27, 0x09, 0x6d, 0xa3, 0xb9, 
+0x7a, 0x41, 0x24, 0x09, 0x74, 0x28, 0x05, 0xd9, 0x40, 0xe5, 0x3f, 0x8c, 0x24, 0xe9, 0xca, 0x74, 
+0xac, 0x27, 0xc8, 0x12, 0xca, 0x7d, 0x2e, 0x7b, 0xf7, 0xbd, 0x3a, 0xec, 0x7b, 0xf1, 0x2c, 0xf3, 
+0xd8, 0xa9, 0x26, 0xa9, 0x2c, 0x6a, 0x13, 0x60, 0x82, 0xf1, 0xc7, 0xad, 0x67, 0xf3, 0xc9, 0x25, 
+0xd4, 0x85, 0xeb, 0x3e, 0xc8, 0x1a, 0x8d, 0x9b, 0x1c, 0x85, 0xd4, 0xca, 0xe5, 0x6c, 0x72, 0xf0, 
+0x92, 0xbe, 0x97, 0x4b, 0x19, 0xb2, 0x8a, 0xb3, 0x6a, 0x94, 0xfc, 0x16, 0x2e, 0x58, 0x1b, 0xf0, 
+0x81, 0xc5, 0xb8, 0x1c, 0x79, 0x41, 0x62, 0xb5, 0x7f, 0x83, 0x85, 0xc4, 0xda, 0x05, 0xb1, 0x8f, 
+0x34, 0xb1, 0x5f, 0x64, 0x20, 0xfd, 0xc6, 0xd1, 0x3c, 0x6a, 0x9f, 0xb2, 0x93, 0xa7, 0xb2, 0xe0, 
+0xad, 0x60, 0x4f, 0x06, 0xe5, 0xfa, 0x3e, 0x76, 0xf3, 0x59, 0x1c, 0x0d, 0x25, 0xa0, 0x46, 0x24, 
+0x15, 0x9a, 0xe4, 0x2b, 0x60, 0xdf, 0xc0, 0x5d, 0x58, 0xe5, 0x7b, 0xc4, 0x9b, 0xd6, 0x38, 0x4f, 
+0x2c, 0x05, 0x81, 0xea, 0xc6, 0x19, 0x07, 0x2a, 0x7d, 0x5f, 0xb7, 0x5e, 0x27, 0xb2, 0xa0, 0xf6, 
+0x39, 0x24, 0xb9, 0xe3, 0x87, 0x60, 0x38, 0x2a, 0xe7, 0x4f, 0x6d, 0x70, 0xc3, 0x15, 0x73, 0x59, 
+0xb4, 0xaf, 0x94, 0x7a, 0xeb, 0x23, 0xdf, 0xb5, 0x2d, 0xa7, 0xe9, 0xf4, 0x90, 0x5a, 0xd0, 0x97, 
+0xb4, 0xec, 0x9e, 0x4b, 0xc9, 0xe7, 0x38, 0x2d, 0xb6, 0x9b, 0x59, 0xf8, 0xb9, 0x0e, 0x31, 0x6d, 
+0xc6, 0xf1, 0xd9, 0x45, 0x83, 0x7b, 0x2d, 0x89, 0x31, 0x65, 0x0f, 0xb3, 0x80, 0xe6, 0xfa, 0x64, 
+0x83, 0xd8, 0xec, 0x8f, 0xb3, 0xd0, 0x57, 0x8a, 0xe4, 0x52, 0x7e, 0x83, 0xf1, 0xb2, 0xfd, 0x2f, 
+0x60, 0x39, 0xf2, 0xb8, 0x19, 0xea, 0x6d, 0x73, 0x0f, 0xb4, 0xf5, 0xd1, 0x42, 0x91, 0x43, 0x08, 
+0x4e, 0x0f, 0x48, 0x72, 0xbd, 0x0f, 0x15, 0xa4, 0xca, 0xf9, 0xdc, 0xf5, 0x3d, 0x08, 0x14, 0x2f, 
+0x9e, 0x6d, 0xbe, 0x08, 0xd2, 0x16, 0x3b, 0x16, 0x35, 0x78, 0x60, 0x48, 0xf0, 0xb4, 0x2d, 0x61, 
+0xdc, 0xb2, 0xf7, 0x31, 0xf2, 0x84, 0x72, 0x05, 0x62, 0x06, 0xce, 0xa0, 0xe8, 0x31, 0x74, 0x2a, 
+0x5f, 0x5d, 0x74, 0xa0, 0x05, 0xa8, 0x06, 0xbe, 0xc1, 0xf7, 0x95, 0x1c, 0xbd, 0x9b, 0x4c, 0x15, 
+0xac, 0x7a, 0x25, 0x8e, 0xa5, 0xf1, 0xb0, 0x39, 0x7e, 0x48, 0xcf, 0x51, 0xc8, 0x1a, 0x6b, 0x4a, 
+0xc4, 0x90, 0x86, 0x19, 0xd5, 0xa7, 0xc0, 0x5d, 0x96, 0x32, 0xf4, 0x9e, 0x58, 0x3c, 0x6a, 0xc8, 
+0xfb, 0xe6, 0xca, 0xfc, 0x93, 0x79, 0x6c, 0x1e, 0x8a, 0x7d, 0x8c, 0x61, 0xd2, 0x14, 0x36, 0x0b, 
+0x86, 0xcb, 0xe9, 0xc7, 0x48, 0xb0, 0x92, 0xc6, 0xf7, 0x9c, 0xd5, 0xfc, 0x9d, 0xfa, 0x19, 0xda, 
+0x38, 0x65, 0xc0, 0xa3, 0x84, 0x73, 0x6e, 0xc9, 0xc6, 0xa1, 0xdf, 0xc8, 0xdf, 0x94, 0xa1, 0x74, 
+0x95, 0xd2, 0xeb, 0x0d, 0x27, 0x13, 0xb8, 0xe6, 0x72, 0xd4, 0xc3, 0x71, 0x95, 0xc3, 0xad, 0x3f, 
+0x70, 0xe2, 0x8a, 0x7d, 0x2e, 0x14, 0xb3, 0x1c, 0x0c, 0x69, 0x75, 0xd6, 0x1a, 0x62, 0xb0, 0xd3, 
+0x7e, 0xb9, 0x1d, 0x02, 0x76, 0xe3, 0xd7, 0x34, 0xc8, 0x2e, 0x46, 0xa3, 0x4d, 0xb8, 0x1c, 0x02, 
+0xa7, 0xd1, 0x97, 0x30, 0x95, 0x70, 0xd7, 0x52, 0x6c, 0x5e, 0x3a, 0x5e, 0x14, 0x59, 0x32, 0xfb, 
+0x85, 0xe7, 0xad, 0x71, 0xd4, 0x93, 0x5a, 0x0d, 0x51, 0xe3, 0x47, 0xd8, 0x14, 0xe8, 0x02, 0xa1, 
+0x40, 0x2c, 0xe7, 0x26, 0xce, 0x1e, 0x84, 0xb7, 0xf2, 0xe9, 0x0b, 0x45, 0x30, 0xe5, 0x69, 0x31, 
+0xa2, 0xbd, 0x38, 0xfb, 0x1c, 0x6a, 0xc6, 0x87, 0x4c, 0x9a, 0x0c, 0x29, 0xc9, 0xe6, 0xaf, 0x2b, 
+0x36, 0x80, 0xf1, 0x64, 0x85, 0x3f, 0x92, 0x6c, 0x93, 0x6d, 0x8a, 0xf7, 0x29, 0x32, 0xec, 0x2d, 
+0x0e, 0x59, 0x3a, 0x69, 0x24, 0xd3, 0xf5, 0x8f, 0x90, 0xca, 0x5a, 0xb7, 0xf1, 0x60, 0x9c, 0xe1, 
+0xf0, 0x7a, 0x56, 0xbf, 0x61, 0xb4, 0xe2, 0xc6, 0xd2, 0x3a, 0x29, 0x1e, 0xa1, 0xb0, 0xdc, 0x26, 
+0x92, 0xc0, 0xe4, 0x70, 0x3c, 0x90, 0xb2, 0xe9, 0x2f, 0x07, 0xf3, 0x6a, 0x2b, 0x6a, 0xc2, 0xa3, 
+0x5a, 0x2b, 0x58, 0x7e, 0x8a, 0x64, 0x3b, 0xf2, 0x50, 0xa9, 0x2f, 0xd5, 0x0b, 0xa5, 0xd1, 0x8f, 
+0xa8, 0xb9, 0x2b, 0xe7, 0x54, 0x71, 0x95, 0x2d, 0x63, 0xf8, 0x04, 0xea, 0xf3, 0xd6, 0xf5, 0x4b, 
+0x62, 0x14, 0x8d, 0x59, 0xfd, 0x2b, 0x79, 0xba, 0x2c, 0xa6, 0x4d, 0x0f, 0x4b, 0x5f, 0x1d, 0x54, 
+0xbe, 0x74, 0xa3, 0x87, 0x4b, 0xcf, 0x17, 0xcf, 0xb5, 0x07, 0xc6, 0xad, 0x5d, 0x28, 0x1e, 0xd0, 
+0x5d, 0xbf, 0x42, 0x7a, 0x86, 0xe2, 0xf9, 0x84, 0xce, 0x75, 0x0a, 0xf4, 0x8e, 0xcf, 0x4b, 0x74, 
+0x8d, 0x26, 0x74, 0x8b, 0xdf, 0x7b, 0x8d, 0xae, 0x46, 0xf2, 0x84, 0x5c, 0x76, 0xa1, 0xd8, 0x1c, 
+0xf7, 0x08, 0xf6, 0x0f, 0xbd, 0x6f, 0x3d, 0xb3, 0x5c, 0xf1, 0x75, 0x89, 0xd7, 0x6c, 0x41, 0x93, 
+0xc1, 0x73, 0x8e, 0x21, 0x7d, 0x4f, 0x04, 0x6d, 0x0c, 0xf6, 0xec, 0x47, 0x9a, 0x14, 0x92, 0xc0, 
+0x5b, 0x24, 0xa8, 0x2d, 0x8c, 0xab, 0x02, 0xe7, 0x0a, 0x4e, 0x53, 0xd0, 0xf7, 0x1e, 0x1b, 0x38, 
+0x19, 0x07, 0x39, 0x70, 0x8d, 0x1b, 0xf0, 0xbf, 0x93, 0x07, 0xd4, 0x40, 0x8e, 0xa4, 0x92, 0x13, 
+0xa1, 0x7f, 0x46, 0x29, 0x34, 0xa8, 0xc5, 0xd3, 0xb2, 0x4d, 0x03, 0xd5, 0x03, 0x9d, 0xb8, 0x51, 
+0xa6, 0x08, 0x59, 0xf3, 0xc7, 0xf9, 0xa1, 0xf3, 0x05, 0xa3, 0x61, 0x59, 0x8d, 0x5c, 0x7f, 0xa0, 
+0x3d, 0xb4, 0xe5, 0xa4, 0x93, 0xd5, 0xc4, 0x89, 0x27, 0x09, 0xc1, 0x6f, 0x1a, 0x8d, 0xb0, 0xe1, 
+0x4b, 0xf3, 0x7b, 0x69, 0x8e, 0x5f, 0x69, 0xcb, 0x51, 0x37, 0xca, 0x2f, 0x9a, 0x28, 0x0b, 0x1f, 
+0x0c, 0xe5, 0x7d, 0x38, 0x19, 0x71, 0xec, 0x1f, 0x31, 0x7f, 0x69, 0xc4, 0x38, 0xd6, 0x91, 0xe7, 
+0x5d, 0x49, 0x7f, 0xc6, 0xae, 0xcb, 0x5c, 0x2f, 0xc5, 0x36, 0x85, 0x16, 0xd4, 0x86, 0x9e, 0xb1, 
+0x93, 0xc1, 0xe8, 0xbe, 0x4b, 0x8c, 0x09, 0xca, 0x6e, 0x02, 0x71, 0xe5, 0x6c, 0x98, 0xb6, 0x1e, 
+0x96, 0xf3, 0x16, 0xeb, 0x93, 0xb2, 0xd1, 0xd0, 0x59, 0x13, 0x5e, 0x79, 0xc8, 0x20, 0xbe, 0x31, 
+0xb0, 0x2a, 0x31, 0xd6, 0xe9, 0x52, 0x8b, 0x2e, 0x06, 0xe1, 0x3b, 0xe6, 0x1e, 0x35, 0x72, 0x98, 
+0x04, 0x72, 0x3a, 0xc6, 0x82, 0x0a, 0xd1, 0xe5, 0x2a, 0x4b, 0x03, 0x6e, 0x9d, 0x68, 0xe5, 0x18, 
+0x63, 0xe5, 0x49, 0xa6, 0x57, 0x3b, 0xf6, 0xbe, 0xcf, 0x8d, 0x36, 0xa6, 0x9d, 0x53, 0xe1, 0x8b, 
+0xc1, 0x90, 0xc4, 0x8a, 0x39, 0xc2, 0x58, 0x37, 0xd2, 0x46, 0x1e, 0xa3, 0x6a, 0x1d, 0x9c, 0x37, 
+0xe2, 0xbc, 0x12, 0x5e, 0x65, 0xb7, 0xd5, 0x60, 0x7e, 0x53, 0xd5, 0xf1, 0x7b, 0xd4, 0xb9, 0x80, 
+0xaf, 0x15, 0xe9, 0x7a, 0xc1, 0xb6, 0xd2, 0x70, 0xd4, 0xf7, 0x3a, 0x68, 0xb4, 0xec, 0xac, 0x13, 
+0x5d, 0xfc, 0x7f, 0x4c, 0x7f, 0x6e, 0x89, 0xb4, 0x20, 0xac, 0x16, 0xf3, 0x7a, 0xb9, 0x70, 0xd4, 
+0xc8, 0xbf, 0xae, 0x4b, 0xec, 0x59, 0xf6, 0x42, 0xce, 0x95, 0x8b, 0x3c, 0xf1, 0x9c, 0x2d, 0x80, 
+0x4f, 0xb1, 0x3a, 0xbd, 0x41, 0xca, 0xf3, 0xd8, 0xd2, 0xa8, 0x01, 0x75, 0x42, 0x5b, 0x0f, 0x92, 
+0xcf, 0x8a, 0x74, 0x05, 0xe3, 0xf7, 0xbd, 0x41, 0xb5, 0x0d, 0xa1, 0xc0, 0x59, 0x7f, 0x8d, 0x48, 
+0x09, 0xf4, 0x2e, 0xa8, 0x0a, 0xf3, 0x8a, 0x97, 0xcf, 0x06, 0x2f, 0x3a, 0xd2, 0x09, 0xb2, 0x84, 
+0xd2, 0x96, 0xf2, 0xc4, 0xe7, 0x3a, 0x42, 0xf3, 0x58, 0x04, 0x9a, 0xf4, 0x61, 0x95, 0xe8, 0x2f, 
+0xc2, 0x68, 0x06, 0x8e, 0x71, 0x48, 0x59, 0x8b, 0x38, 0xa4, 0x0f, 0x3c, 0x8f, 0x7e, 0x90, 0xb8, 
+0xd5, 0x24, 0xe6, 0xa2, 0x7d, 0x41, 0x80, 0xd7, 0x26, 0xb1, 0xd7, 0x9e, 0xa5, 0x16, 0xf4, 0x08, 
+0x63, 0x7a, 0x5f, 0x73, 0xa2, 0x9c, 0x4f, 0x27, 0xeb, 0x87, 0x16, 0x30, 0xbf, 0x1c, 0x4e, 0xa9, 
+0x0d, 0x69, 0x74, 0xc5, 0x04, 0x12, 0xcf, 0xd9, 0x6a, 0x52, 0x6f, 0x92, 0xef, 0x68, 0xe4, 0x9f, 
+0xb1, 0xc3, 0xa0, 0x7b, 0xec, 0x7a, 0x80, 0x52, 0xc5, 0x64, 0xe0, 0x4d, 0x13, 0x9a, 0x4c, 0x86, 
+0x94, 0xc7, 0x6e, 0x06, 0xf3, 0x51, 0x8a, 0x36, 0x91, 0x2c, 0xd0, 0xb2, 0xe7, 0xaf, 0xc0, 0x5c, 
+0x9e, 0xca, 0x0b, 0x15, 0x70, 0xd4, 0xb2, 0xd4, 0xb6, 0xad, 0x21, 0x0e, 0x51, 0xdb, 0x75, 0xa6, 
+0x4b, 0x63, 0x4d, 0x53, 0xc0, 0xf8, 0xc5, 0x3f, 0x09, 0x6c, 0x3f, 0x53, 0xa8, 0xe0, 0x3a, 0x03, 
+0x73, 0xdc, 0x29, 0xd5, 0xad, 0xe5, 0x2c, 0x9e, 0x57, 0x06, 0x87, 0x39, 0x50, 0x62, 0xde, 0xb9, 
+0x45, 0x96, 0x3c, 0x27, 0xfa, 0x1e, 0x2a, 0x83, 0x86, 0xd6, 0xa7, 0x52, 0x1e, 0xb8, 0x03, 0xc6, 
+0x7a, 0x31, 0xd6, 0x37, 0xd5, 0xe2, 0x45, 0xf2, 0x25, 0x31, 0x6d, 0xfb, 0x7d, 0x19, 0xc6, 0xf2, 
+0xa4, 0xe8, 0xb0, 0xe1, 0xf5, 0xbf, 0x14, 0xca, 0x8c, 0xae, 0xd4, 0xec, 0x7d, 0xf8, 0x69, 0xc6, 
+0x1d, 0x24, 0x72, 0x8b, 0x27, 0x13, 0x6e, 0xc9, 0x3e, 0xa8, 0xf5, 0xa0, 0x9f, 0x03, 0xe6, 0xac, 
+0x36, 0x1d, 0x2c, 0x1e, 0x0a, 0x1f, 0xa6, 0xf1, 0x96, 0x7d, 0x0d, 0x9b, 0x83, 0x1b, 0x96, 0xb0, 
+0x1d, 0x47, 0xc5, 0xeb, 0x5f, 0xa8, 0x36, 0xf7, 0xb1, 0x08, 0xb0, 0x61, 0xcf, 0x4d, 0xeb, 0x0d, 
+0xaf, 0x4c, 0xa5, 0x1e, 0x72, 0xd8, 0xbe, 0x51, 0xc6, 0x83, 0xc1, 0xdf, 0xfb, 0x9e, 0x31, 0xb8, 
+0xc4, 0x1d, 0xa5, 0x81, 0xc4, 0xb5, 0x90, 0xb2, 0x38, 0x69, 0xed, 0x89, 0xb6, 0xeb, 0xc9, 0x60, 
+0x4a, 0x2e, 0x7b, 0x85, 0x7d, 0x62, 0xd7, 0x4b, 0x27, 0x13, 0x9a, 0xe7, 0x20, 0x73, 0x06, 0x21, 
+0x5a, 0x45, 0x17, 0x58, 0xac, 0x69, 0xbe, 0x3f, 0x64, 0xeb, 0x64, 0x8f, 0x65, 0xb3, 0x17, 0xe3, 
+0x2c, 0x57, 0xbd, 0x59, 0xfb, 0x93, 0x68, 0x4d, 0x97, 0x5c, 0x82, 0xb7, 0xe3, 0xb4, 0x2a, 0x14, 
+0xcf, 0x5e, 0x25, 0xd9, 0xfb, 0x2a, 0x6f, 0x18, 0x19, 0x20, 0xda, 0x12, 0x49, 0x4d, 0x3e, 0x48, 
+0xba, 0x82, 0x15, 0xc6, 0x81, 0xe9, 0x08, 0x69, 0xc1, 0xf5, 0x09, 0x84, 0xd3, 0x5f, 0x85, 0x62, 
+0x23, 0x04, 0x8c, 0x4f, 0x96, 0x7f, 0x3d, 0xae, 0x20, 0xfc, 0x2e, 0xa7, 0xfc, 0x0b, 0x70, 0x31, 
+0xe8, 0x0d, 0x34, 0x29, 0x6f, 0x84, 0x03, 0x1c, 0xb0, 0xc1, 0x5f, 0x3a, 0x8e, 0xad, 0x83, 0x14, 
+0xd5, 0xfa, 0xb8, 0x9f, 0xb0, 0xeb, 0x2f, 0xe0, 0x4e, 0x35, 0x1d, 0x60, 0xa1, 0xd8, 0x90, 0x2a, 
+0x19, 0x0d, 0x49, 0xc8, 0x6d, 0x4c, 0x84, 0x24, 0x08, 0x5e, 0xfa, 0xb3, 0xd2, 0xe1, 0x3c, 0x04, 
+0x8e, 0x29, 0x76, 0xe6, 0x28, 0xa7, 0xac, 0x48, 0x76, 0x3e, 0x92, 0x4a, 0xc6, 0xe4, 0x7b, 0x5e, 
+0xc6, 0xfc, 0x79, 0xc2, 0x50, 0x6c, 0x94, 0xf2, 0x3b, 0x57, 0x4f, 0x3b, 0x0a, 0x4c, 0x26, 0x3f, 
+0xb0, 0xac, 0x0b, 0x94, 0xca, 0x7d, 0x2e, 0x70, 0x3c, 0x09, 0x61, 0x49, 0x6d, 0x85, 0x7d, 0x48, 
+0x1a, 0x42, 0x6c, 0x5a, 0x64, 0xa8, 0x5f, 0x8e, 0xc3, 0xb9, 0xdf, 0xa4, 0x79, 0xf3, 0x98, 0x0c, 
+0xd4, 0x06, 0x5d, 0xf9, 0xb6, 0x92, 0xd5, 0xc4, 0x63, 0x7a, 0x3c, 0x3a, 0x78, 0x0f, 0x8a, 0x4c, 
+0x8c, 0x52, 0xfd, 0x47, 0xd4, 0x7f, 0x6b, 0x0e, 0x92, 0xa1, 0x0f, 0x7a, 0xeb, 0x17, 0x30, 0x16, 
+0x5b, 0x96, 0x9e, 0x7a, 0x50, 0xdb, 0xf1, 0xc9, 0x0e, 0x13, 0x0f, 0x12, 0xc5, 0xa0, 0xd6, 0xbd, 
+0x34, 0x8c, 0x5f, 0x08, 0xa1, 0x82, 0x51, 0xf7, 0xe3, 0xd5, 0xea, 0x79, 0xd8, 0x2d, 0xa2, 0xd8, 
+0x75, 0x97, 0xed, 0xa1, 0x57, 0xd6, 0x2e, 0x3f, 0x61, 0xfa, 0x5b, 0x6a, 0xe5, 0xb3, 0xbe, 0x2c, 
+0xa7, 0x19, 0x3b, 0x06, 0xc5, 0xf9, 0xea, 0xd3, 0xcf, 0x27, 0x1b, 0xa5, 0x17, 0x05, 0x58, 0x6e, 
+0x13, 0x6a, 0xeb, 0x16, 0x52, 0xb9, 0xc2, 0x57, 0x0e, 0x14, 0x0e, 0x1a, 0xd8, 0xf0, 0x97, 0x5b, 
+0x2e, 0xcb, 0x27, 0x3e, 0x73, 0x1a, 0x7b, 0x3e, 0xb2, 0xd8, 0x23, 0x54, 0x17, 0xe9, 0x7c, 0x3d, 
+0x62, 0xc5, 0xad, 0x8f, 0x70, 0x4f, 0x52, 0x5f, 0xc3, 0x65, 0x83, 0xd4, 0xb7, 0x5d, 0x8b, 0x69, 
+0x0f, 0x81, 0xc5, 0x70, 0xfb, 0x1a, 0x29, 0xb6, 0x35, 0xeb, 0x8a, 0x60, 0xb9, 0x28, 0x03, 0x60, 
+0x4e, 0x0f, 0xb6, 0x14, 0xfe, 0x2b, 0x04, 0xc8, 0x9e, 0x29, 0x4a, 0x8c, 0x9c, 0x63, 0x09, 0x41, 
+0xd8, 0x2e, 0x85, 0x70, 0xf3, 0xe0, 0xf4, 0xde, 0x37, 0xd0, 0x42, 0x78, 0x1b, 0x3c, 0xd6, 0x03, 
+0x9e, 0xbe, 0x2c, 0x0f, 0x94, 0xd7, 0x25, 0xd9, 0xf7, 0x8f, 0x07, 0xba, 0x3c, 0x8c, 0x73, 0x84, 
+0x26, 0xc5, 0xda, 0x1f, 0x49, 0x64, 0x6e, 0xb0, 0x9f, 0x6e, 0x15, 0x98, 0x1a, 0x63, 0xcf, 0xad, 
+0xbf, 0x36, 0x2e, 0x95, 0x1f, 0x84, 0xe9, 0x4c, 0xe2, 0xbd, 0x1c, 0xa1, 0xd9, 0x4e, 0x0a, 0x72, 
+0xb6, 0x9e, 0x47, 0xde, 0xb4, 0x7e, 0x3f, 0x92, 0x58, 0xe0, 0xd3, 0x2c, 0xf9, 0x24, 0x0d, 0x37, 
+0xf5, 0xce, 0x4b, 0xfc, 0x6a, 0x71, 0x3c, 0x9a, 0x31, 0xd5, 0x97, 0x2e, 0x14, 0xc7, 0xf5, 0x10, 
+0x0e, 0x48, 0xcf, 0x27, 0x7c, 0x46, 0x1d, 0xa3, 0x5b, 0x85, 0xc6, 0x89, 0x2b, 0x86, 0x3e, 0xb0, 
+0x69, 0xe5, 0x1a, 0xf7, 0xc8, 0x46, 0xa9, 0x3b, 0x8b, 0xc0, 0x84, 0xa2, 0x31, 0xd4, 0x3e, 0x41, 
+0xf5, 0xaf, 0x6b, 0xf9, 0xc1, 0x38, 0x14, 0xd8, 0x0a, 0x2d, 0x1c, 0x45, 0x2b, 0x8c, 0x4c, 0x06, 
+0xf5, 0xc0, 0x79, 0x16, 0x82, 0xb5, 0xda, 0x0b, 0x37, 0xa2, 0x07, 0x23, 0x9a, 0x38, 0x7b, 0x38, 
+0x07, 0xac, 0x29, 0x5e, 0x3f, 0x0c, 0x22, 0x53, 0x8c, 0x26, 0x91, 0xa6, 0xd3, 0x7c, 0x6e, 0x74, 
+0x0d, 0x7c, 0xf9, 0x4d, 0x94, 0x17, 0xa2, 0x91, 0x4c, 0x95, 0x85, 0xd0, 0xca, 0x84, 0xf1, 0x86, 
+0x5b, 0x13, 0xbd, 0x79, 0x29, 0xa2, 0xd8, 0xbe, 0x14, 0xfa, 0x3f, 0xb6, 0x9d, 0x1a, 0x92, 0x1a, 
+0x4c, 0x1a, 0xb8, 0x5f, 0x4a, 0x38, 0x94, 0x2d, 0x52, 0xf1, 0x3d, 0x75, 0x21, 0xe3, 0x6f, 0xc8, 
+0xcb, 0x56, 0x8a, 0xd9, 0x60, 0x42, 0x9d, 0x06, 0xea, 0xf6, 0xbe, 0x73, 0x6b, 0x7f, 0x59, 0x8f, 
+0xd0, 0x42, 0x9f, 0xa3, 0x91, 0xea, 0x4e, 0x25, 0xa0, 0xc8, 0x16, 0x4e, 0x8d, 0xb5, 0xfb, 0xc0, 
+0x5d, 0x64, 0x0f, 0x6d, 0x64, 0xf1, 0x6e, 0xc8, 0x1a, 0x46, 0xbe, 0x90, 0x61, 0xad, 0x83, 0xbe, 
+0x0b, 0x42, 0xa5, 0x9b, 0x6a, 0x15, 0x68, 0xb1, 0x62, 0xac, 0x6d, 0x58, 0xd2, 0x3e, 0xb2, 0xf7, 
+0x56, 0x0e, 0xb3, 0xda, 0xf9, 0xd6, 0x03, 0xed, 0xdf, 0x57, 0x14, 0x35, 0xd9, 0x07, 0x94, 0x0e, 
+0x26, 0x2c, 0x4d, 0xf5, 0x7e, 0x5f, 0x71, 0xc2, 0xd1, 0xf0, 0xce, 0x7b, 0x16, 0xb7, 0xe4, 0xc1, 
+0xf6, 0x7b, 0xa1, 0x60, 0xea, 0x1d, 0xb0, 0x6c, 0x2e, 0xb8, 0x13, 0x52, 0x74, 0x9c, 0x02, 0xac, 
+0xf4, 0x0c, 0x3a, 0x16, 0x3a, 0xd8, 0x17, 0x2d, 0xb3, 0x87, 0xd1, 0x8f, 0xd4, 0x9f, 0x37, 0xf2, 
+0xa1, 0x2d, 0x76, 0x9f, 0x71, 0xf9, 0xd5, 0x2b, 0xe2, 0xa7, 0xb4, 0x0a, 0x5d, 0xd8, 0x1a, 0x8d, 
+0xf5, 0xe4, 0x0f, 0x54, 0x79, 0xf8, 0x1c, 0x1f, 0x28, 0x9e, 0x23, 0xe0, 0xeb, 0xf8, 0x13, 0xea, 
+0x6f, 0x8c, 0x07, 0x42, 0x9e, 0x3a, 0x75, 0xc2, 0x08, 0x5f, 0x9a, 0x45, 0x83, 0x0d, 0xb6, 0xac, 
+0x82, 0xbe, 0x1c, 0x58, 0xca, 0x4e, 0x73, 0x9c, 0x09, 0x32, 0xd4, 0x98, 0x6b, 0x75, 0xa3, 0x90, 
+0xda, 0x49, 0xb0, 0x8a, 0xd4, 0x95, 0xd2, 0x95, 0x47, 0x29, 0xf2, 0x38, 0x9d, 0x75, 0xdb, 0xea, 
+0xc0, 0x37, 0x85, 0x91, 0x5e, 0xa8, 0x72, 0xec, 0x97, 0xf6, 0xe5, 0xc7, 0x46, 0xe2, 0x3c, 0x5b, 
+0x37, 0x61, 0xdb, 0x96, 0x5f, 0x68, 0x41, 0x3b, 0x8c, 0x2b, 0x18, 0x49, 0x0c, 0x83, 0xd2, 0x7f, 
+0x62, 0x75, 0xf4, 0x3b, 0x27, 0xb3, 0xd6, 0x8c, 0x16, 0x3d, 0x7e, 0x37, 0xd3, 0xbc, 0x0b, 0x59, 
+0x85, 0x04, 0x9c, 0x0b, 0x14, 0x61, 0x9a, 0xeb, 0xd6, 0xc2, 0x80, 0xf4, 0x73, 0xb4, 0x2c, 0x80, 
+0xbc, 0x59, 0xfe, 0x01, 0xf6, 0x5d, 0x6a, 0x27, 0x0f, 0x70, 0xb1, 0x84, 0xfb, 0x68, 0xb0, 0xe2, 
+0x39, 0xd2, 0xf1, 0x58, 0xf3, 0xc1, 0x5d, 0x36, 0xc2, 0x0f, 0x3e, 0x8c, 0xf1, 0xe4, 0x7a, 0x5f, 
+0x14, 0x2f, 0x37, 0x61, 0x85, 0xfd, 0x4e, 0x3b, 0x82, 0x51, 0xfb, 0x40, 0x52, 0x1b, 0x3a, 0x18, 
+0xf0, 0xb5, 0xa8, 0xc0, 0x2e, 0xca, 0x54, 0x0c, 0x93, 0x0c, 0xea, 0xd2, 0x49, 0x3e, 0x6e, 0xc7, 
+0x3a, 0x5f, 0x09, 0xc3, 0x9b, 0x03, 0xc1, 0x6c, 0x09, 0x19, 0x7b, 0x0a, 0xde, 0x0a, 0x45, 0xba, 
+0x40, 0x57, 0xad, 0x74, 0xc3, 0x7e, 0xd6, 0x37, 0xd5, 0xb8, 0xe4, 0x38, 0x14, 0xf4, 0xd6, 0x9e, 
+0x8d, 0x1e, 0x7d, 0x16, 0x2a, 0x71, 0x42, 0x79, 0x4a, 0x38, 0x3b, 0xfd, 0x35, 0xa8, 0x6d, 0xb2, 
+0x71, 0xe9, 0x5a, 0x6c, 0x8e, 0x06, 0x8d, 0xc4, 0x80, 0x7f, 0x82, 0xf7, 0x09, 0xb7, 0x1a, 0x43, 
+0xb8, 0xa6, 0xc1, 0xbd, 0xa6, 0xca, 0x09, 0xb4, 0xeb, 0x1a, 0x1d, 0x70, 0xc7, 0xdb, 0x36, 0x8e, 
+0xac, 0x48, 0x9f, 0x05, 0xad, 0x90, 0xf6, 0x49, 0xa8, 0x41, 0x8e, 0x27, 0xeb, 0xa7, 0x50, 0x96, 
+0xd0, 0x67, 0x2a, 0x16, 0xf4, 0x18, 0xb6, 0xd1, 0xe4, 0xaf, 0x97, 0xe8, 0x5f, 0x4c, 0x2f, 0x24, 
+0x7b, 0x59, 0xc0, 0x81, 0xcf, 0xe2, 0x4f, 0x12, 0xfb, 0xa2, 0x58, 0xf4, 0x9c, 0x2f, 0x05, 0x7c, 
+0x07, 0x9a, 0x1c, 0x35, 0xb1, 0xa4, 0x6b, 0xf3, 0xe3, 0xdb, 0x6a, 0xc5, 0xd0, 0xf1, 0xc0, 0x79, 
+0x5b, 0xc2, 0xf5, 0x06, 0xa3, 0xd0, 0xe3, 0x7f, 0x1a, 0x43, 0xa7, 0x2e, 0x6a, 0xd5, 0x93, 0xab, 
+0x5f, 0xc8, 0x6c, 0x17, 0x05, 0x30, 0xe4, 0x87, 0x03, 0x85, 0xec, 0x2f, 0x39, 0x64, 0xa2, 0x6f, 
+0x93, 0xe4, 0x0d, 0x92, 0x7f, 0xd2, 0x6d, 0x4c, 0x23, 0x7c, 0x3e, 0x1f, 0x60, 0xe3, 0x7a, 0xd8, 
+0x14, 0xd2, 0xb5, 0xf4, 0xaf, 0xbd, 0x53, 0xd8, 0xdb, 0x6d, 0x28, 0x51, 0x7d, 0x58, 0x2b, 0x0a, 
+0x3d, 0xb6, 0x3a, 0xd8, 0x31, 0xb6, 0x2f, 0x9d, 0x68, 0x91, 0x86, 0xc9, 0x60, 0x8e, 0x0b, 0xa1, 
+0xe0, 0x83, 0xcd, 0x2f, 0xa5, 0xd3, 0x8b, 0x21, 0xd6, 0x9f, 0x09, 0x2d, 0xc1, 0x6f, 0x08, 0xf3, 
+0x7c, 0x89, 0xe4, 0x91, 0xe1, 0x36, 0x3a, 0xde, 0x8c, 0x47, 0x2c, 0x41, 0x57, 0xeb, 0xf0, 0x4b, 
+0x12, 0xb4, 0x0e, 0x61, 0x83, 0x24, 0xd9, 0xea, 0xdf, 0xc8, 0xb3, 0x52, 0xfb, 0xd6, 0x14, 0x57, 
+0x0d, 0x7c, 0xb8, 0x5d, 0x41, 0x9a, 0x7f, 0x13, 0x50, 0xa5, 0x1b, 0x7e, 0x65, 0xd1, 0x8a, 0x52, 
+0xd5, 0xbf, 0xc5, 0x1c, 0x5f, 0x08, 0xe1, 0x7c, 0x13, 0x80, 0xbf, 0x50, 0x29, 0x1e, 0x4a, 0xf6, 
+0xb9, 0x06, 0xe3, 0xd5, 0x28, 0x6e, 0x07, 0x59, 0xfc, 0x8e, 0x3d, 0x53, 0x04, 0xad, 0x53, 0xae, 
+0x4d, 0x3c, 0x42, 0x75, 0x86, 0xb7, 0x49, 0x6b, 0x2c, 0x61, 0xf7, 0xaf, 0x74, 0xc3, 0x85, 0xc4, 
+0x05, 0x9c, 0x42, 0xb1, 0xa2, 0x75, 0x62, 0xd4, 0xb7, 0xde, 0x98, 0x13, 0x50, 0xfb, 0x8d, 0x9b, 
+0xc2, 0x82, 0x95, 0xd9, 0xf5, 0xd7, 0x9c, 0xd4, 0xea, 0x6e, 0x02, 0x63, 0x74, 0x29, 0x6f, 0xd9, 
+0xc4, 0x2e, 0x8b, 0xd9, 0xa2, 0x51, 0xf3, 0xe1, 0xa6, 0xe2, 0x5c, 0x9b, 0xe7, 0x8b, 0xe2, 0x83, 
+0x9b, 0xf4, 0x5b, 0x9c, 0x7a, 0x40, 0x96, 0x3a, 0x39, 0x64, 0xa3, 0x9b, 0x57, 0x94, 0x79, 0xa4, 
+0xb7, 0xe9, 0x0c, 0x38, 0x23, 0xec, 0x14, 0x97, 0xc0, 0xa3, 0x8e, 0xc0, 0x61, 0x49, 0x17, 0xab, 
+0x7e, 0x2b, 0x7d, 0x08, 0x17, 0x96, 0xe9, 0xfc, 0x3d, 0xf1, 0xad, 0x08, 0x4b, 0xe0, 0x84, 0x5c, 
+0x08, 0x2b, 0x7e, 0xa1, 0xa8, 0x3d, 0x7e, 0x96, 0xd4, 0xf3, 0xba, 0x7f, 0x58, 0xa0, 0x4c, 0x7f, 
+0x92, 0x6a, 0x16, 0x0f, 0x94, 0xd6, 0x17, 0xb7, 0x38, 0x1f, 0x15, 0x28, 0x05, 0xb9, 0xa5, 0xb9, 
+0x1b, 0xe0, 0x71, 0xa3, 0x76, 0x0a, 0x73, 0x16, 0xf8, 0xe4, 0x70, 0x9b, 0x80, 0xc8, 0x31, 0x6d, 
+0x41, 0xe3, 0x6a, 0x5d, 0x10, 0x8a, 0x70, 0x2f, 0x31, 0x86, 0x2f, 0x8e, 0xd7, 0xbc, 0xf7, 0x0d, 
+0x2f, 0xc1, 0xe1, 0xc7, 0xf5, 0x35, 0x74, 0xd9, 0xfc, 0x28, 0x6d, 0xaf, 0x4b, 0xd1, 0xb5, 0x2b, 
+0x3d, 0xa5, 0xb0, 0xd4, 0xf8, 0x50, 0xfa, 0x25, 0xbd, 0x2b, 0x15, 0xa0, 0x29, 0x51, 0xe3, 0x5f, 
+0x19, 0x75, 0xce, 0x92, 0x4e, 0xd0, 0xe1, 0x63, 0x7e, 0x12, 0xa1, 0x5e, 0x2b, 0xc1, 0xd0, 0x3c, 
+0x06, 0x3b, 0x16, 0x2b, 0xd7, 0xe3, 0x4d, 0x36, 0x80, 0xca, 0xed, 0x20, 0x6c, 0xa6, 0xa4, 0x9b, 
+0xec, 0x31, 0x7d, 0xf0, 0xd8, 0x54, 0xcc, 0x50, 0xaf, 0x95, 0xcf, 0x4c, 0x31, 0xb9, 0xda, 0x53, 
+0xf4, 0xd9, 0xbf, 0x58, 0x2b, 0x7c, 0x40, 0xfc, 0x76, 0xc2, 0xfe, 0x46, 0xae, 0xdb, 0xc7, 0x04, 
+0x15, 0x20, 0x5c, 0xe4, 0x6a, 0x35, 0xe3, 0x62, 0xc1, 0xb9, 0xf1, 0xa0, 0x45, 0x7a, 0xf0, 0x31, 
+0xe5, 0x6f, 0x46, 0xe9, 0x87, 0xe2, 0xf6, 0x81, 0x2a, 0xc3, 0x64, 0xcf, 0x95, 0x0f, 0x83, 0xd7, 
+0xe4, 0xc8, 0xb6, 0x9c, 0x63, 0xd2, 0xa0, 0x3b, 0xa6, 0x95, 0xa4, 0xdf, 0x4d, 0xaf, 0x6b, 0x39, 
+0x80, 0x59, 0x8e, 0x79, 0xe2, 0xc9, 0xfe, 0xa4, 0x05, 0xcb, 0x8f, 0xa2, 0xe5, 0x83, 0x24, 0x8f, 
+0xe0, 0x53, 0xec, 0xf3, 0x17, 0x4f, 0x62, 0x47, 0x39, 0xda, 0x26, 0xe8, 0xd1, 0xc3, 0x28, 0x0a, 
+0x5d, 0x60, 0xc2, 0xe7, 0xa2, 0x61, 0x4a, 0x0e, 0xc5, 0x0f, 0x96, 0xa3, 0x4e, 0x53, 0x89, 0xd7, 
+0x15, 0x83, 0x4e, 0xab, 0x9f, 0xe8, 0x92, 0x58, 0x90, 0xd8, 0xab, 0x4d, 0x80, 0xda, 0x2c, 0x67, 
+0xea, 0x15, 0x3b, 0x68, 0x90, 0x39, 0x8c, 0x03, 0xf4, 0x08, 0xc4, 0xeb, 0x5e, 0x19, 0xd8, 0x07, 
+0xa4, 0xe7, 0x2c, 0x4b, 0x69, 0x24, 0x7b, 0x2d, 0xa0, 0xf6, 0x86, 0xd7, 0xf7, 0x13, 0x87, 0xb9, 
+0x90, 0x54, 0x8c, 0x0d, 0x7f, 0x6a, 0x45, 0x24, 0xbe, 0x67, 0x50, 0x86, 0xe9, 0x16, 0x07, 0xc4, 
+0xb1, 0xfa, 0x7c, 0x5a, 0x49, 0xd7, 0x20, 0x67, 0xd8, 0xad, 0x38, 0xac, 0x5f, 0x07, 0xf3, 0xb7, 
+0x43, 0x6e, 0xb7, 0xe9, 0xc2, 0x84, 0x85, 0x1c, 0x1b, 0x6f, 0xc7, 0x36, 0x9a, 0x38, 0x2e, 0x91, 
+0xd9, 0x0d, 0xb3, 0x09, 0xb2, 0xf0, 0x91, 0x52, 0x6a, 0x36, 0xa1, 0xdb, 0x1f, 0x75, 0x09, 0xf5, 
+0x97, 0x64, 0x1e, 0x83, 0xb0, 0xde, 0x89, 0x4c, 0xad, 0x7b, 0x1d, 0x67, 0xb1, 0xca, 0x31, 0x97, 
+0x3d, 0x74, 0xb2, 0xe3, 0x1d, 0x6b, 0xa5, 0x1e, 0x0a, 0xfd, 0x0e, 0x14, 0x85, 0xbc, 0x1f, 0x52, 
+0x04, 0xec, 0xf0, 0x26, 0x27, 0xc9, 0x2f, 0x54, 0xa1, 0xe2, 0xca, 0xd1, 0x84, 0x13, 0xa3, 0xdc, 
+0x3a, 0x4e, 0x95, 0x19, 0x37, 0xd6, 0x0b, 0x1b, 0x82, 0xeb, 0x8c, 0x5a, 0x04, 0xb0, 0xeb, 0x0e, 
+0x24, 0xb1, 0x89, 0x02, 0xad, 0x80, 0xd6, 0x24, 0x71, 0xfb, 0xd6, 0x9f, 0x3c, 0x80, 0x5d, 0xa1, 
+0xf4, 0xbd, 0x5c, 0x52, 0x7f, 0xa6, 0x15, 0xcf, 0x4a, 0xd6, 0x8c, 0xf7, 0x0d, 0xc4, 0xf7, 0x3e, 
+0x43, 0xc2, 0xd7, 0x13, 0xaf, 0x3e, 0x85, 0xc2, 0xf9, 0x62, 0xc0, 0xe5, 0x2f, 0x2a, 0x52, 0xa2, 
+0xd9, 0x57, 0xd6, 0xf0, 0xb6, 0x0f, 0xa6, 0x8c, 0x94, 0x09, 0x3f, 0x79, 0x36, 0x1a, 0x59, 0x4f, 
+0xd3, 0x94, 0x93, 0xda, 0xb9, 0x82, 0x6b, 0xe5, 0xae, 0xb0, 0x7e, 0x29, 0xd4, 0xb0, 0x7f, 0x38, 
+0xfa, 0xcd, 0x9f, 0x26, 0x1f, 0x8b, 0x2d, 0xf8, 0xeb, 0x42, 0xed, 0x37, 0x15, 0x61, 0x93, 0xeb, 
+0x2f, 0x68, 0x27, 0x5a, 0x68, 0xad, 0x5c, 0xeb, 0x5f, 0xa5, 0x93, 0xbd, 0xfa, 0x70, 0xe3, 0xa5, 
+0x7e, 0x29, 0x73, 0xbd, 0x07, 0xe1, 0x60, 0xf8, 0xb1, 0x48, 0xea, 0x38, 0x62, 0xb5, 0x4a, 0x3d, 
+0x52, 0x80, 0xd9, 0x2a, 0x7d, 0x8b, 0x4e, 0x6c, 0x02, 0xcb, 0x90, 0xa4, 0x58, 0xb4, 0x7f, 0x13, 
+0xa6, 0x4e, 0xc9, 0xf4, 0x6e, 0x2f, 0x0a, 0x5e, 0xa4, 0xc2, 0x3e, 0x5d, 0x7f, 0x6e, 0xa4, 0xdc, 
+0x8d, 0x5e, 0x3c, 0x86, 0xa0, 0x2e, 0x70, 0x82, 0x5d, 0xc3, 0x49, 0x17, 0x16, 0x34, 0xb6, 0xac, 
+0x06, 0x8c, 0x51, 0x6b, 0x50, 0x76, 0x05, 0xb9, 0x7d, 0x50, 0x6a, 0x30, 0xa5, 0x09, 0x85, 0x9f, 
+0xda, 0xcf, 0x48, 0x19, 0x6c, 0x41, 0xf9, 0xd1, 0xf4, 0x73, 0x16, 0x47, 0x18, 0x21, 0xc9, 0x06, 
+0x15, 0x35, 0x92, 0xc0, 0x64, 0xde, 0x19, 0x48, 0x63, 0xa7, 0xb9, 0x3a, 0x4d, 0x62, 0x7e, 0x4d, 
+0x09, 0xe1, 0xf0, 0x69, 0xeb, 0x52, 0xb6, 0x0a, 0x51, 0x6f, 0x0a, 0x8d, 0x78, 0x51, 0x6f, 0xd7, 
+0xe0, 0xd3, 0xa8, 0xb7, 0xd0, 0x85, 0x07, 0x8c, 0x03, 0xb8, 0x4c, 0x82, 0x58, 0xe8, 0x90, 0x71, 
+0x2b, 0x31, 0x80, 0x25, 0x14, 0xb8, 0x72, 0x0b, 0x7e, 0x6d, 0xac, 0x6e, 0x40, 0x6a, 0xfc, 0x8d, 
+0x5d, 0x8d, 0x3f, 0x13, 0x7f, 0x93, 0xe9, 0xa2, 0xe3, 0xbf, 0xa8, 0xe0, 0x4a, 0x2e, 0x84, 0xc6, 
+0x2f, 0xca, 0xe2, 0x6c, 0x09, 0x37, 0x2d, 0x5f, 0x38, 0xda, 0xc4, 0x38, 0xc0, 0xce, 0xa9, 0xd3, 
+0xec, 0x47, 0xdf, 0x48, 0xb9, 0xdb, 0x84, 0xf9, 0xa1, 0x5b, 0x6f, 0x2e, 0x9d, 0x24, 0xe3, 0xce, 
+0x29, 0xcb, 0x0a, 0x17, 0xbe, 0x37, 0x9d, 0x2b, 0x47, 0xf9, 0xe5, 0xcf, 0xc4, 0x92, 0x5b, 0x24, 
+0xea, 0xe7, 0x32, 0xb6, 0x19, 0xf5, 0x2d, 0x64, 0xf9, 0xb3, 0xf3, 0x1e, 0xa7, 0x5a, 0x17, 0x3c, 
+0x1b, 0x15, 0xbc, 0x4f, 0x58, 0xcd, 0x7e, 0xba, 0xfc, 0x20, 0xdf, 0xc1, 0x39, 0x83, 0x52, 0xe7, 
+0xbf, 0x18, 0x53, 0x0a, 0xaf, 0x29, 0x05, 0x8e, 0x5c, 0x26, 0x4d, 0x71, 0xc4, 0x81, 0x46, 0x2d, 
+0x95, 0xb3, 0xf1, 0x97, 0xd3, 0x71, 0x4b, 0x73, 0x48, 0x1e, 0xa0, 0xcb, 0x19, 0x06, 0x70, 0xeb, 
+0x29, 0x35, 0xf2, 0xb0, 0x96, 0xfb, 0x57, 0x1c, 0xe2, 0x4e, 0x1d, 0x73, 0xbe, 0x82, 0xc0, 0xb5, 
+0x1c, 0x85, 0xd1, 0x75, 0x06, 0x3f, 0x59, 0xd5, 0x38, 0x5c, 0x4c, 0x51, 0x80, 0x3a, 0x14, 0x83, 
+0x0d, 0x7e, 0x6d, 0x81, 0x30, 0xb5, 0xd4, 0x8c, 0x28, 0x6b, 0x09, 0x2c, 0x12, 0xd8, 0xba, 0xd2, 
+0x5c, 0x1d, 0xeb, 0x9f, 0xd7, 0x4f, 0x61, 0x9a, 0xe1, 0xa5, 0x49, 0x63, 0x79, 0x6a, 0x49, 0xa5, 
+0xe4, 0xc0, 0xf9, 0x14, 0x93, 0x7e, 0x1d, 0x73, 0x71, 0x8c, 0x6d, 0x9b, 0x4a, 0x0d, 0xb0, 0x4e, 
+0x6a, 0xd2, 0xce, 0xa3, 0xcf, 0x07, 0xc6, 0xe1, 0xb5, 0x8d, 0x5f, 0x1a, 0xe5, 0xbc, 0x68, 0x74, 
+0x5e, 0x3e, 0x2a, 0x56, 0xf7, 0xd1, 0x84, 0x7c, 0x5a, 0x20, 0x3a, 0x35, 0x79, 0x17, 0x6b, 0x25, 
+0xd0, 0x96, 0xa4, 0x87, 0xf2, 0x6f, 0x96, 0xb8, 0xfb, 0x91, 0x48, 0xf2, 0xca, 0x0a, 0x17, 0xaf, 
+0xdc, 0x6d, 0x72, 0xb6, 0x92, 0xba, 0x30, 0xfb, 0x96, 0x2f, 0x9a, 0x0f, 0x3c, 0x4e, 0x7f, 0x4a, 
+0x7e, 0x56, 0x14, 0x59, 0x7f, 0x82, 0x45, 0x06, 0x3d, 0xa2, 0x7d, 0xb3, 0x67, 0x2b, 0x0c, 0xf0, 
+0x5e, 0x3f, 0x64, 0x72, 0xf1, 0xa6, 0x7b, 0x3c, 0x8c, 0x5b, 0xa6, 0xe5, 0xb5, 0x4e, 0xb1, 0x27, 
+0x1f, 0x85, 0x8f, 0x69, 0x80, 0x59, 0x75, 0x17, 0x16, 0xd9, 0x82, 0xd4, 0xaf, 0x06, 0x3a, 0x9d, 
+0x6f, 0x90, 0x4f, 0x2e, 0xc8, 0xb5, 0x9f, 0xc8, 0x04, 0x9b, 0x0c, 0xf3, 0x18, 0xd6, 0xe9, 0xde, 
+0x0f, 0xc4, 0x90, 0xda, 0x47, 0xf3, 0xde, 0x1c, 0x4a, 0x0a, 0x20, 0xd4, 0x2d, 0x7e, 0x63, 0xb7, 
+0x1f, 0x6d, 0xf8, 0x34, 0x72, 0xb0, 0x8f, 0xda, 0xe6, 0x14, 0xc9, 0x65, 0xce, 0x84, 0x1d, 0x57, 
+0xda, 0x18, 0x3b, 0xc0, 0x84, 0xa0, 0xfc, 0x8e, 0x03, 0xa6, 0xbd, 0x79, 0x28, 0x0e, 0x39, 0x25, 
+0xd0, 0xf8, 0xd2, 0x8d, 0x1b, 0x91, 0xb0, 0xd7, 0x8b, 0xd4, 0xe5, 0xd1, 0x60, 0xd4, 0x28, 0x1c, 
+0x0c, 0x92, 0x74, 0xfc, 0x63, 0xac, 0x23, 0xb1, 0xc3, 0xfa, 0x0c, 0x9f, 0x82, 0x44, 0x0b, 0x51, 
+0x82, 0xbc, 0xe8, 0x05, 0x21, 0x37, 0x3a, 0x09, 0x61, 0x2c, 0x71, 0x3b, 0x2a, 0xe3, 0xd8, 0x6a, 
+0xe4, 0xc9, 0x51, 0xa4, 0x85, 0xa2, 0xfb, 0x38, 0x1c, 0x29, 0x16, 0x39, 0x6d, 0x8b, 0x4e, 0xc9, 
+0x40, 0x5b, 0xc0, 0xa4, 0xd8, 0x42, 0x90, 0xeb, 0x19, 0x5e, 0x45, 0x02, 0x5c, 0x8e, 0x27, 0x1a, 
+0x37, 0x0a, 0xc6, 0x3b, 0x06, 0x2d, 0x51, 0x6d, 0x5d, 0x9c, 0x73, 0x1b, 0xc4, 0xe0, 0x92, 0xf4, 
+0xc6, 0xcb, 0x16, 0xe8, 0xcb, 0x46, 0x7a, 0x5b, 0x83, 0x57, 0xce, 0x3c, 0x06, 0x22, 0x90, 0xaf, 
+0x7e, 0x90, 0xcd, 0x43, 0xfa, 0x30, 0xea, 0x80, 0xd9, 0xe1, 0x7a, 0xd5, 0xe4, 0xb3, 0xe6, 0x4b, 
+0x5c, 0xad, 0xf9, 0x7e, 0xd6, 0x94, 0x2c, 0x4d, 0x8c, 0xae, 0xb8, 0xd3, 0xaf, 0x0a, 0xd4, 0x95, 
+0xd7, 0x64, 0x59, 0x02, 0xb8, 0x0f, 0x2c, 0x6b, 0x2b, 0x3d, 0x65, 0xe7, 0xfa, 0x5b, 0x7a, 0xfc, 
+0x51, 0xe3, 0x57, 0x16, 0xaf, 0x24, 0x81, 0xe9, 0x50, 0xbd, 0x56, 0xa4, 0x96, 0xf3, 0xac, 0x7b, 
+0x4f, 0x07, 0xbe, 0x3f, 0xd2, 0xb4, 0xf2, 0xe8, 0x59, 0xfb, 0x9f, 0x92, 0x3f, 0x12, 0xae, 0x62, 
+0x75, 0x9f, 0x7b, 0x1a, 0xe3, 0x95, 0xc7, 0xf0, 0x39, 0x1e, 0x31, 0x4e, 0x2d, 0xf8, 0x28, 0x5a, 
+0xf4, 0x9d, 0x6b, 0x42, 0xa3, 0x85, 0xf9, 0x70, 0x7b, 0x6d, 0x5c, 0x35, 0xb2, 0x46, 0xc4, 0x19, 
+0x72, 0x68, 0xd2, 0x2d, 0x0e, 0x71, 0x63, 0xca, 0x03, 0xf1, 0x75, 0xfb, 0x67, 0xd5, 0x26, 0xe4, 
+0x5d, 0x84, 0xf0, 0x8c, 0xf0, 0xac, 0x2e, 0x7d, 0x63, 0x75, 0x37, 0x0f, 0x7d, 0x08, 0x19, 0x13, 
+0x6d, 0x24, 0xd5, 0x20, 0x97, 0x29, 0xda, 0x3e, 0x8c, 0x7a, 0xf8, 0xd3, 0x6c, 0x71, 0xe7, 0x1f, 
+0xc2, 0xd8, 0x19, 0x2d, 0x8a, 0x39, 0x5c, 0x80, 0x58, 0xe6, 0x79, 0x1c, 0x7e, 0x40, 0x62, 0x7b, 
+0xa4, 0x76, 0xd4, 0xa9, 0xd1, 0xc4, 0x2d, 0x45, 0x17, 0x2e, 0x4a, 0x26, 0x5e, 0x7c, 0xc9, 0xf6, 
+0x96, 0x0a, 0x4a, 0x16, 0xe7, 0xcf, 0x18, 0x7c, 0x1d, 0xb6, 0x13, 0xbe, 0x15, 0xe9, 0x12, 0xf7, 
+0x1e, 0xa0, 0xf8, 0xe6, 0xda, 0x1f, 0x57, 0xa9, 0x63, 0x92, 0x8e, 0x14, 0x7b, 0x8d, 0x93, 0xa1, 
+0x30, 0x4f, 0x07, 0xc1, 0xb7, 0x39, 0x6b, 0x62, 0x43, 0x8f, 0x1b, 0x49, 0xf1, 0xdb, 0xce, 0x93, 
+0x59, 0xe4, 0xae, 0xcb, 0x07, 0x9f, 0x0c, 0x8e, 0xbf, 0xc8, 0x0f, 0x59, 0x03, 0xd2, 0x53, 0x6b, 
+0x1f, 0x4a, 0xb2, 0xd8, 0x50, 0x7a, 0x4f, 0x6e, 0x19, 0x64, 0xd1, 0x6a, 0x4c, 0xa3, 0x0d, 0x4a, 
+0x13, 0x7a, 0xc4, 0xe0, 0x8e, 0xc2, 0x80, 0x5f, 0x3a, 0x83, 0x68, 0xc7, 0xdb, 0xf8, 0x09, 0xdb, 
+0xa0, 0x92, 0x50, 0x7c, 0x1b, 0x3e, 0x5f, 0xd2, 0x31, 0xa5, 0x3b, 0xe5, 0x94, 0x2e, 0xc8, 0x62, 
+};
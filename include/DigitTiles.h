@@ -0,0 +1,8333 @@
+// Generated by native/tiles (pio run -e tiles -t exec), do not edit.
+// Ten digit tiles of 64 x 104 pixels, two bytes (u, v) per pixel, rows top to bottom.
+// v = 254 marks an outline pixel and v = 255 a background pixel.
+
+const int DIGIT_TILE_WIDTH = 64;
+const int DIGIT_TILE_HEIGHT = 104;
+const int DIGIT_TILE_CENTER_X = 32;
+const int DIGIT_TILE_CENTER_Y = 52;
+const unsigned char DIGIT_TILE_OUTLINE = 254;
+const unsigned char DIGIT_TILE_BACKGROUND = 255;
+
+const unsigned char DigitTiles[] PROGMEM = {
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0x04, 0x4c, 0x04, 0x50, 0x04, 0x55, 0x04, 0x5a, 0x04, 0x5f, 0x04, 
+0x64, 0x04, 0x68, 0x04, 0x6d, 0x04, 0x72, 0x04, 0x77, 0x04, 0x7b, 0x04, 0x80, 0x04, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3d, 0x09, 0x42, 0x09, 0x47, 0x09, 0x4c, 0x09, 0x50, 0x09, 0x55, 0x09, 0x5a, 0x09, 0x5f, 0x09, 
+0x64, 0x09, 0x68, 0x09, 0x6d, 0x09, 0x72, 0x09, 0x77, 0x09, 0x7b, 0x09, 0x80, 0x09, 0x85, 0x09, 
+0x8a, 0x09, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x34, 0x0e, 0x39, 0x0e, 
+0x3d, 0x0e, 0x42, 0x0e, 0x47, 0x0e, 0x4c, 0x0e, 0x50, 0x0e, 0x55, 0x0e, 0x5a, 0x0e, 0x5f, 0x0e, 
+0x64, 0x0e, 0x68, 0x0e, 0x6d, 0x0e, 0x72, 0x0e, 0x77, 0x0e, 0x7b, 0x0e, 0x80, 0x0e, 0x85, 0x0e, 
+0x8a, 0x0e, 0x8e, 0x0e, 0x93, 0x0e, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2a, 0x13, 0x2f, 0x13, 0x34, 0x13, 0x39, 0x13, 
+0x3d, 0x13, 0x42, 0x13, 0x47, 0x13, 0x4c, 0x13, 0x50, 0x13, 0x55, 0x13, 0x5a, 0x13, 0x5f, 0x13, 
+0x64, 0x13, 0x68, 0x13, 0x6d, 0x13, 0x72, 0x13, 0x77, 0x13, 0x7b, 0x13, 0x80, 0x13, 0x85, 0x13, 
+0x8a, 0x13, 0x8e, 0x13, 0x93, 0x13, 0x98, 0x13, 0x9d, 0x13, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0x17, 0x2a, 0x17, 0x2f, 0x17, 0x34, 0x17, 0x39, 0x17, 
+0x3d, 0x17, 0x42, 0x17, 0x47, 0x17, 0x4c, 0x17, 0x50, 0x17, 0x55, 0x17, 0x5a, 0x17, 0x5f, 0x17, 
+0x64, 0x17, 0x68, 0x17, 0x6d, 0x17, 0x72, 0x17, 0x77, 0x17, 0x7b, 0x17, 0x80, 0x17, 0x85, 0x17, 
+0x8a, 0x17, 0x8e, 0x17, 0x93, 0x17, 0x98, 0x17, 0x9d, 0x17, 0xa1, 0x17, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0x1c, 0x26, 0x1c, 0x2a, 0x1c, 0x2f, 0x1c, 0x34, 0x1c, 0x39, 0x1c, 
+0x3d, 0x1c, 0x42, 0x1c, 0x47, 0x1c, 0x4c, 0x1c, 0x50, 0x1c, 0x55, 0x1c, 0x5a, 0x1c, 0x5f, 0x1c, 
+0x64, 0x1c, 0x68, 0x1c, 0x6d, 0x1c, 0x72, 0x1c, 0x77, 0x1c, 0x7b, 0x1c, 0x80, 0x1c, 0x85, 0x1c, 
+0x8a, 0x1c, 0x8e, 0x1c, 0x93, 0x1c, 0x98, 0x1c, 0x9d, 0x1c, 0xa1, 0x1c, 0xa6, 0x1c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0x21, 0x21, 0x21, 0x26, 0x21, 0x2a, 0x21, 0x2f, 0x21, 0x34, 0x21, 0x39, 0x21, 
+0x3d, 0x21, 0x42, 0x21, 0x47, 0x21, 0x4c, 0x21, 0x50, 0x21, 0x55, 0x21, 0x5a, 0x21, 0x5f, 0x21, 
+0x64, 0x21, 0x68, 0x21, 0x6d, 0x21, 0x72, 0x21, 0x77, 0x21, 0x7b, 0x21, 0x80, 0x21, 0x85, 0x21, 
+0x8a, 0x21, 0x8e, 0x21, 0x93, 0x21, 0x98, 0x21, 0x9d, 0x21, 0xa1, 0x21, 0xa6, 0x21, 0xab, 0x21, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0x26, 0x1c, 0x26, 0x21, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x2f, 0x26, 0x34, 0x26, 0x39, 0x26, 
+0x3d, 0x26, 0x42, 0x26, 0x47, 0x26, 0x4c, 0x26, 0x50, 0x26, 0x55, 0x26, 0x5a, 0x26, 0x5f, 0x26, 
+0x64, 0x26, 0x68, 0x26, 0x6d, 0x26, 0x72, 0x26, 0x77, 0x26, 0x7b, 0x26, 0x80, 0x26, 0x85, 0x26, 
+0x8a, 0x26, 0x8e, 0x26, 0x93, 0x26, 0x98, 0x26, 0x9d, 0x26, 0xa1, 0x26, 0xa6, 0x26, 0xab, 0x26, 
+0xb0, 0x26, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2a, 
+0x17, 0x2a, 0x1c, 0x2a, 0x21, 0x2a, 0x26, 0x2a, 0x2a, 0x2a, 0x2f, 0x2a, 0x34, 0x2a, 0x39, 0x2a, 
+0x3d, 0x2a, 0x42, 0x2a, 0x47, 0x2a, 0x4c, 0x2a, 0x50, 0x2a, 0x55, 0x2a, 0x5a, 0x2a, 0x5f, 0x2a, 
+0x64, 0x2a, 0x68, 0x2a, 0x6d, 0x2a, 0x72, 0x2a, 0x77, 0x2a, 0x7b, 0x2a, 0x80, 0x2a, 0x85, 0x2a, 
+0x8a, 0x2a, 0x8e, 0x2a, 0x93, 0x2a, 0x98, 0x2a, 0x9d, 0x2a, 0xa1, 0x2a, 0xa6, 0x2a, 0xab, 0x2a, 
+0xb0, 0x2a, 0xb4, 0x2a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2f, 
+0x17, 0x2f, 0x1c, 0x2f, 0x21, 0x2f, 0x26, 0x2f, 0x2a, 0x2f, 0x2f, 0x2f, 0x34, 0x2f, 0x39, 0x2f, 
+0x3d, 0x2f, 0x42, 0x2f, 0x47, 0x2f, 0x4c, 0x2f, 0x50, 0x2f, 0x55, 0x2f, 0x5a, 0x2f, 0x5f, 0x2f, 
+0x64, 0x2f, 0x68, 0x2f, 0x6d, 0x2f, 0x72, 0x2f, 0x77, 0x2f, 0x7b, 0x2f, 0x80, 0x2f, 0x85, 0x2f, 
+0x8a, 0x2f, 0x8e, 0x2f, 0x93, 0x2f, 0x98, 0x2f, 0x9d, 0x2f, 0xa1, 0x2f, 0xa6, 0x2f, 0xab, 0x2f, 
+0xb0, 0x2f, 0xb4, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x34, 0x13, 0x34, 
+0x17, 0x34, 0x1c, 0x34, 0x21, 0x34, 0x26, 0x34, 0x2a, 0x34, 0x2f, 0x34, 0x34, 0x34, 0x39, 0x34, 
+0x3d, 0x34, 0x42, 0x34, 0x47, 0x34, 0x4c, 0x34, 0x50, 0x34, 0x55, 0x34, 0x5a, 0x34, 0x5f, 0x34, 
+0x64, 0x34, 0x68, 0x34, 0x6d, 0x34, 0x72, 0x34, 0x77, 0x34, 0x7b, 0x34, 0x80, 0x34, 0x85, 0x34, 
+0x8a, 0x34, 0x8e, 0x34, 0x93, 0x34, 0x98, 0x34, 0x9d, 0x34, 0xa1, 0x34, 0xa6, 0x34, 0xab, 0x34, 
+0xb0, 0x34, 0xb4, 0x34, 0xb9, 0x34, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x39, 0x13, 0x39, 
+0x17, 0x39, 0x1c, 0x39, 0x21, 0x39, 0x26, 0x39, 0x2a, 0x39, 0x2f, 0x39, 0x34, 0x39, 0x39, 0x39, 
+0x3d, 0x39, 0x42, 0x39, 0x47, 0x39, 0x4c, 0x39, 0x50, 0x39, 0x55, 0x39, 0x5a, 0x39, 0x5f, 0x39, 
+0x64, 0x39, 0x68, 0x39, 0x6d, 0x39, 0x72, 0x39, 0x77, 0x39, 0x7b, 0x39, 0x80, 0x39, 0x85, 0x39, 
+0x8a, 0x39, 0x8e, 0x39, 0x93, 0x39, 0x98, 0x39, 0x9d, 0x39, 0xa1, 0x39, 0xa6, 0x39, 0xab, 0x39, 
+0xb0, 0x39, 0xb4, 0x39, 0xb9, 0x39, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x3d, 0x0e, 0x3d, 0x13, 0x3d, 
+0x17, 0x3d, 0x1c, 0x3d, 0x21, 0x3d, 0x26, 0x3d, 0x2a, 0x3d, 0x2f, 0x3d, 0x34, 0x3d, 0x39, 0x3d, 
+0x3d, 0x3d, 0x42, 0x3d, 0x47, 0x3d, 0x4c, 0x3d, 0x50, 0x3d, 0x55, 0x3d, 0x5a, 0x3d, 0x5f, 0x3d, 
+0x64, 0x3d, 0x68, 0x3d, 0x6d, 0x3d, 0x72, 0x3d, 0x77, 0x3d, 0x7b, 0x3d, 0x80, 0x3d, 0x85, 0x3d, 
+0x8a, 0x3d, 0x8e, 0x3d, 0x93, 0x3d, 0x98, 0x3d, 0x9d, 0x3d, 0xa1, 0x3d, 0xa6, 0x3d, 0xab, 0x3d, 
+0xb0, 0x3d, 0xb4, 0x3d, 0xb9, 0x3d, 0xbe, 0x3d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x0e, 0x42, 0x13, 0x42, 
+0x17, 0x42, 0x1c, 0x42, 0x21, 0x42, 0x26, 0x42, 0x2a, 0x42, 0x2f, 0x42, 0x34, 0x42, 0x39, 0x42, 
+0x3d, 0x42, 0x42, 0x42, 0x47, 0x42, 0x4c, 0x42, 0x50, 0x42, 0x55, 0x42, 0x5a, 0x42, 0x5f, 0x42, 
+0x64, 0x42, 0x68, 0x42, 0x6d, 0x42, 0x72, 0x42, 0x77, 0x42, 0x7b, 0x42, 0x80, 0x42, 0x85, 0x42, 
+0x8a, 0x42, 0x8e, 0x42, 0x93, 0x42, 0x98, 0x42, 0x9d, 0x42, 0xa1, 0x42, 0xa6, 0x42, 0xab, 0x42, 
+0xb0, 0x42, 0xb4, 0x42, 0xb9, 0x42, 0xbe, 0x42, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x47, 0x09, 0x47, 0x0e, 0x47, 0x13, 0x47, 
+0x17, 0x47, 0x1c, 0x47, 0x21, 0x47, 0x26, 0x47, 0x2a, 0x47, 0x2f, 0x47, 0x34, 0x47, 0x39, 0x47, 
+0x3d, 0x47, 0x42, 0x47, 0x47, 0x47, 0x4c, 0x47, 0x50, 0x47, 0x55, 0x47, 0x5a, 0x47, 0x5f, 0x47, 
+0x64, 0x47, 0x68, 0x47, 0x6d, 0x47, 0x72, 0x47, 0x77, 0x47, 0x7b, 0x47, 0x80, 0x47, 0x85, 0x47, 
+0x8a, 0x47, 0x8e, 0x47, 0x93, 0x47, 0x98, 0x47, 0x9d, 0x47, 0xa1, 0x47, 0xa6, 0x47, 0xab, 0x47, 
+0xb0, 0x47, 0xb4, 0x47, 0xb9, 0x47, 0xbe, 0x47, 0xc3, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x4c, 0x09, 0x4c, 0x0e, 0x4c, 0x13, 0x4c, 
+0x17, 0x4c, 0x1c, 0x4c, 0x21, 0x4c, 0x26, 0x4c, 0x2a, 0x4c, 0x2f, 0x4c, 0x34, 0x4c, 0x39, 0x4c, 
+0x3d, 0x4c, 0x42, 0x4c, 0x47, 0x4c, 0x4c, 0x4c, 0x50, 0x4c, 0x55, 0x4c, 0x5a, 0x4c, 0x5f, 0x4c, 
+0x64, 0x4c, 0x68, 0x4c, 0x6d, 0x4c, 0x72, 0x4c, 0x77, 0x4c, 0x7b, 0x4c, 0x80, 0x4c, 0x85, 0x4c, 
+0x8a, 0x4c, 0x8e, 0x4c, 0x93, 0x4c, 0x98, 0x4c, 0x9d, 0x4c, 0xa1, 0x4c, 0xa6, 0x4c, 0xab, 0x4c, 
+0xb0, 0x4c, 0xb4, 0x4c, 0xb9, 0x4c, 0xbe, 0x4c, 0xc3, 0x4c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x50, 0x09, 0x50, 0x0e, 0x50, 0x13, 0x50, 
+0x17, 0x50, 0x1c, 0x50, 0x21, 0x50, 0x26, 0x50, 0x2a, 0x50, 0x2f, 0x50, 0x34, 0x50, 0x39, 0x50, 
+0x3d, 0x50, 0x42, 0x50, 0x47, 0x50, 0x4c, 0x50, 0x50, 0x50, 0x55, 0x50, 0x5a, 0x50, 0x5f, 0x50, 
+0x64, 0x50, 0x68, 0x50, 0x6d, 0x50, 0x72, 0x50, 0x77, 0x50, 0x7b, 0x50, 0x80, 0x50, 0x85, 0x50, 
+0x8a, 0x50, 0x8e, 0x50, 0x93, 0x50, 0x98, 0x50, 0x9d, 0x50, 0xa1, 0x50, 0xa6, 0x50, 0xab, 0x50, 
+0xb0, 0x50, 0xb4, 0x50, 0xb9, 0x50, 0xbe, 0x50, 0xc3, 0x50, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x55, 0x09, 0x55, 0x0e, 0x55, 0x13, 0x55, 
+0x17, 0x55, 0x1c, 0x55, 0x21, 0x55, 0x26, 0x55, 0x2a, 0x55, 0x2f, 0x55, 0x34, 0x55, 0x39, 0x55, 
+0x3d, 0x55, 0x42, 0x55, 0x47, 0x55, 0x4c, 0x55, 0x50, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x5f, 0x55, 
+0x64, 0x55, 0x68, 0x55, 0x6d, 0x55, 0x72, 0x55, 0x77, 0x55, 0x7b, 0x55, 0x80, 0x55, 0x85, 0x55, 
+0x8a, 0x55, 0x8e, 0x55, 0x93, 0x55, 0x98, 0x55, 0x9d, 0x55, 0xa1, 0x55, 0xa6, 0x55, 0xab, 0x55, 
+0xb0, 0x55, 0xb4, 0x55, 0xb9, 0x55, 0xbe, 0x55, 0xc3, 0x55, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5a, 0x09, 0x5a, 0x0e, 0x5a, 0x13, 0x5a, 
+0x17, 0x5a, 0x1c, 0x5a, 0x21, 0x5a, 0x26, 0x5a, 0x2a, 0x5a, 0x2f, 0x5a, 0x34, 0x5a, 0x39, 0x5a, 
+0x3d, 0x5a, 0x42, 0x5a, 0x47, 0x5a, 0x4c, 0x5a, 0x50, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5f, 0x5a, 
+0x64, 0x5a, 0x68, 0x5a, 0x6d, 0x5a, 0x72, 0x5a, 0x77, 0x5a, 0x7b, 0x5a, 0x80, 0x5a, 0x85, 0x5a, 
+0x8a, 0x5a, 0x8e, 0x5a, 0x93, 0x5a, 0x98, 0x5a, 0x9d, 0x5a, 0xa1, 0x5a, 0xa6, 0x5a, 0xab, 0x5a, 
+0xb0, 0x5a, 0xb4, 0x5a, 0xb9, 0x5a, 0xbe, 0x5a, 0xc3, 0x5a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5f, 0x09, 0x5f, 0x0e, 0x5f, 0x13, 0x5f, 
+0x17, 0x5f, 0x1c, 0x5f, 0x21, 0x5f, 0x26, 0x5f, 0x2a, 0x5f, 0x2f, 0x5f, 0x34, 0x5f, 0x39, 0x5f, 
+0x3d, 0x5f, 0x42, 0x5f, 0x47, 0x5f, 0x4c, 0x5f, 0x50, 0x5f, 0x55, 0x5f, 0x5a, 0x5f, 0x5f, 0x5f, 
+0x64, 0x5f, 0x68, 0x5f, 0x6d, 0x5f, 0x72, 0x5f, 0x77, 0x5f, 0x7b, 0x5f, 0x80, 0x5f, 0x85, 0x5f, 
+0x8a, 0x5f, 0x8e, 0x5f, 0x93, 0x5f, 0x98, 0x5f, 0x9d, 0x5f, 0xa1, 0x5f, 0xa6, 0x5f, 0xab, 0x5f, 
+0xb0, 0x5f, 0xb4, 0x5f, 0xb9, 0x5f, 0xbe, 0x5f, 0xc3, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x68, 0x09, 0x68, 0x0e, 0x68, 0x13, 0x68, 
+0x17, 0x68, 0x1c, 0x68, 0x21, 0x68, 0x26, 0x68, 0x2a, 0x68, 0x2f, 0x68, 0x34, 0x68, 0x39, 0x68, 
+0x3d, 0x68, 0x42, 0x68, 0x47, 0x68, 0x4c, 0x68, 0x50, 0x68, 0x55, 0x68, 0x5a, 0x68, 0x5f, 0x68, 
+0x64, 0x68, 0x68, 0x68, 0x6d, 0x68, 0x72, 0x68, 0x77, 0x68, 0x7b, 0x68, 0x80, 0x68, 0x85, 0x68, 
+0x8a, 0x68, 0x8e, 0x68, 0x93, 0x68, 0x98, 0x68, 0x9d, 0x68, 0xa1, 0x68, 0xa6, 0x68, 0xab, 0x68, 
+0xb0, 0x68, 0xb4, 0x68, 0xb9, 0x68, 0xbe, 0x68, 0xc3, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x6d, 0x09, 0x6d, 0x0e, 0x6d, 0x13, 0x6d, 
+0x17, 0x6d, 0x1c, 0x6d, 0x21, 0x6d, 0x26, 0x6d, 0x2a, 0x6d, 0x2f, 0x6d, 0x34, 0x6d, 0x39, 0x6d, 
+0x3d, 0x6d, 0x42, 0x6d, 0x47, 0x6d, 0x4c, 0x6d, 0x50, 0x6d, 0x55, 0x6d, 0x5a, 0x6d, 0x5f, 0x6d, 
+0x64, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x72, 0x6d, 0x77, 0x6d, 0x7b, 0x6d, 0x80, 0x6d, 0x85, 0x6d, 
+0x8a, 0x6d, 0x8e, 0x6d, 0x93, 0x6d, 0x98, 0x6d, 0x9d, 0x6d, 0xa1, 0x6d, 0xa6, 0x6d, 0xab, 0x6d, 
+0xb0, 0x6d, 0xb4, 0x6d, 0xb9, 0x6d, 0xbe, 0x6d, 0xc3, 0x6d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x72, 0x09, 0x72, 0x0e, 0x72, 0x13, 0x72, 
+0x17, 0x72, 0x1c, 0x72, 0x21, 0x72, 0x26, 0x72, 0x2a, 0x72, 0x2f, 0x72, 0x34, 0x72, 0x39, 0x72, 
+0x3d, 0x72, 0x42, 0x72, 0x47, 0x72, 0x4c, 0x72, 0x50, 0x72, 0x55, 0x72, 0x5a, 0x72, 0x5f, 0x72, 
+0x64, 0x72, 0x68, 0x72, 0x6d, 0x72, 0x72, 0x72, 0x77, 0x72, 0x7b, 0x72, 0x80, 0x72, 0x85, 0x72, 
+0x8a, 0x72, 0x8e, 0x72, 0x93, 0x72, 0x98, 0x72, 0x9d, 0x72, 0xa1, 0x72, 0xa6, 0x72, 0xab, 0x72, 
+0xb0, 0x72, 0xb4, 0x72, 0xb9, 0x72, 0xbe, 0x72, 0xc3, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x77, 0x09, 0x77, 0x0e, 0x77, 0x13, 0x77, 
+0x17, 0x77, 0x1c, 0x77, 0x21, 0x77, 0x26, 0x77, 0x2a, 0x77, 0x2f, 0x77, 0x34, 0x77, 0x39, 0x77, 
+0x3d, 0x77, 0x42, 0x77, 0x47, 0x77, 0x4c, 0x77, 0x50, 0x77, 0x55, 0x77, 0x5a, 0x77, 0x5f, 0x77, 
+0x64, 0x77, 0x68, 0x77, 0x6d, 0x77, 0x72, 0x77, 0x77, 0x77, 0x7b, 0x77, 0x80, 0x77, 0x85, 0x77, 
+0x8a, 0x77, 0x8e, 0x77, 0x93, 0x77, 0x98, 0x77, 0x9d, 0x77, 0xa1, 0x77, 0xa6, 0x77, 0xab, 0x77, 
+0xb0, 0x77, 0xb4, 0x77, 0xb9, 0x77, 0xbe, 0x77, 0xc3, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x7b, 0x09, 0x7b, 0x0e, 0x7b, 0x13, 0x7b, 
+0x17, 0x7b, 0x1c, 0x7b, 0x21, 0x7b, 0x26, 0x7b, 0x2a, 0x7b, 0x2f, 0x7b, 0x34, 0x7b, 0x39, 0x7b, 
+0x3d, 0x7b, 0x42, 0x7b, 0x47, 0x7b, 0x4c, 0x7b, 0x50, 0x7b, 0x55, 0x7b, 0x5a, 0x7b, 0x5f, 0x7b, 
+0x64, 0x7b, 0x68, 0x7b, 0x6d, 0x7b, 0x72, 0x7b, 0x77, 0x7b, 0x7b, 0x7b, 0x80, 0x7b, 0x85, 0x7b, 
+0x8a, 0x7b, 0x8e, 0x7b, 0x93, 0x7b, 0x98, 0x7b, 0x9d, 0x7b, 0xa1, 0x7b, 0xa6, 0x7b, 0xab, 0x7b, 
+0xb0, 0x7b, 0xb4, 0x7b, 0xb9, 0x7b, 0xbe, 0x7b, 0xc3, 0x7b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x09, 0x80, 0x0e, 0x80, 0x13, 0x80, 
+0x17, 0x80, 0x1c, 0x80, 0x21, 0x80, 0x26, 0x80, 0x2a, 0x80, 0x2f, 0x80, 0x34, 0x80, 0x39, 0x80, 
+0x3d, 0x80, 0x42, 0x80, 0x47, 0x80, 0x4c, 0x80, 0x50, 0x80, 0x55, 0x80, 0x5a, 0x80, 0x5f, 0x80, 
+0x64, 0x80, 0x68, 0x80, 0x6d, 0x80, 0x72, 0x80, 0x77, 0x80, 0x7b, 0x80, 0x80, 0x80, 0x85, 0x80, 
+0x8a, 0x80, 0x8e, 0x80, 0x93, 0x80, 0x98, 0x80, 0x9d, 0x80, 0xa1, 0x80, 0xa6, 0x80, 0xab, 0x80, 
+0xb0, 0x80, 0xb4, 0x80, 0xb9, 0x80, 0xbe, 0x80, 0xc3, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x85, 0x0e, 0x85, 0x13, 0x85, 
+0x17, 0x85, 0x1c, 0x85, 0x21, 0x85, 0x26, 0x85, 0x2a, 0x85, 0x2f, 0x85, 0x34, 0x85, 0x39, 0x85, 
+0x3d, 0x85, 0x42, 0x85, 0x47, 0x85, 0x4c, 0x85, 0x50, 0x85, 0x55, 0x85, 0x5a, 0x85, 0x5f, 0x85, 
+0x64, 0x85, 0x68, 0x85, 0x6d, 0x85, 0x72, 0x85, 0x77, 0x85, 0x7b, 0x85, 0x80, 0x85, 0x85, 0x85, 
+0x8a, 0x85, 0x8e, 0x85, 0x93, 0x85, 0x98, 0x85, 0x9d, 0x85, 0xa1, 0x85, 0xa6, 0x85, 0xab, 0x85, 
+0xb0, 0x85, 0xb4, 0x85, 0xb9, 0x85, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x8a, 0x0e, 0x8a, 0x13, 0x8a, 
+0x17, 0x8a, 0x1c, 0x8a, 0x21, 0x8a, 0x26, 0x8a, 0x2a, 0x8a, 0x2f, 0x8a, 0x34, 0x8a, 0x39, 0x8a, 
+0x3d, 0x8a, 0x42, 0x8a, 0x47, 0x8a, 0x4c, 0x8a, 0x50, 0x8a, 0x55, 0x8a, 0x5a, 0x8a, 0x5f, 0x8a, 
+0x64, 0x8a, 0x68, 0x8a, 0x6d, 0x8a, 0x72, 0x8a, 0x77, 0x8a, 0x7b, 0x8a, 0x80, 0x8a, 0x85, 0x8a, 
+0x8a, 0x8a, 0x8e, 0x8a, 0x93, 0x8a, 0x98, 0x8a, 0x9d, 0x8a, 0xa1, 0x8a, 0xa6, 0x8a, 0xab, 0x8a, 
+0xb0, 0x8a, 0xb4, 0x8a, 0xb9, 0x8a, 0xbe, 0x8a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8e, 0x13, 0x8e, 
+0x17, 0x8e, 0x1c, 0x8e, 0x21, 0x8e, 0x26, 0x8e, 0x2a, 0x8e, 0x2f, 0x8e, 0x34, 0x8e, 0x39, 0x8e, 
+0x3d, 0x8e, 0x42, 0x8e, 0x47, 0x8e, 0x4c, 0x8e, 0x50, 0x8e, 0x55, 0x8e, 0x5a, 0x8e, 0x5f, 0x8e, 
+0x64, 0x8e, 0x68, 0x8e, 0x6d, 0x8e, 0x72, 0x8e, 0x77, 0x8e, 0x7b, 0x8e, 0x80, 0x8e, 0x85, 0x8e, 
+0x8a, 0x8e, 0x8e, 0x8e, 0x93, 0x8e, 0x98, 0x8e, 0x9d, 0x8e, 0xa1, 0x8e, 0xa6, 0x8e, 0xab, 0x8e, 
+0xb0, 0x8e, 0xb4, 0x8e, 0xb9, 0x8e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x93, 0x13, 0x93, 
+0x17, 0x93, 0x1c, 0x93, 0x21, 0x93, 0x26, 0x93, 0x2a, 0x93, 0x2f, 0x93, 0x34, 0x93, 0x39, 0x93, 
+0x3d, 0x93, 0x42, 0x93, 0x47, 0x93, 0x4c, 0x93, 0x50, 0x93, 0x55, 0x93, 0x5a, 0x93, 0x5f, 0x93, 
+0x64, 0x93, 0x68, 0x93, 0x6d, 0x93, 0x72, 0x93, 0x77, 0x93, 0x7b, 0x93, 0x80, 0x93, 0x85, 0x93, 
+0x8a, 0x93, 0x8e, 0x93, 0x93, 0x93, 0x98, 0x93, 0x9d, 0x93, 0xa1, 0x93, 0xa6, 0x93, 0xab, 0x93, 
+0xb0, 0x93, 0xb4, 0x93, 0xb9, 0x93, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x98, 
+0x17, 0x98, 0x1c, 0x98, 0x21, 0x98, 0x26, 0x98, 0x2a, 0x98, 0x2f, 0x98, 0x34, 0x98, 0x39, 0x98, 
+0x3d, 0x98, 0x42, 0x98, 0x47, 0x98, 0x4c, 0x98, 0x50, 0x98, 0x55, 0x98, 0x5a, 0x98, 0x5f, 0x98, 
+0x64, 0x98, 0x68, 0x98, 0x6d, 0x98, 0x72, 0x98, 0x77, 0x98, 0x7b, 0x98, 0x80, 0x98, 0x85, 0x98, 
+0x8a, 0x98, 0x8e, 0x98, 0x93, 0x98, 0x98, 0x98, 0x9d, 0x98, 0xa1, 0x98, 0xa6, 0x98, 0xab, 0x98, 
+0xb0, 0x98, 0xb4, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x9d, 
+0x17, 0x9d, 0x1c, 0x9d, 0x21, 0x9d, 0x26, 0x9d, 0x2a, 0x9d, 0x2f, 0x9d, 0x34, 0x9d, 0x39, 0x9d, 
+0x3d, 0x9d, 0x42, 0x9d, 0x47, 0x9d, 0x4c, 0x9d, 0x50, 0x9d, 0x55, 0x9d, 0x5a, 0x9d, 0x5f, 0x9d, 
+0x64, 0x9d, 0x68, 0x9d, 0x6d, 0x9d, 0x72, 0x9d, 0x77, 0x9d, 0x7b, 0x9d, 0x80, 0x9d, 0x85, 0x9d, 
+0x8a, 0x9d, 0x8e, 0x9d, 0x93, 0x9d, 0x98, 0x9d, 0x9d, 0x9d, 0xa1, 0x9d, 0xa6, 0x9d, 0xab, 0x9d, 
+0xb0, 0x9d, 0xb4, 0x9d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0xa1, 0x1c, 0xa1, 0x21, 0xa1, 0x26, 0xa1, 0x2a, 0xa1, 0x2f, 0xa1, 0x34, 0xa1, 0x39, 0xa1, 
+0x3d, 0xa1, 0x42, 0xa1, 0x47, 0xa1, 0x4c, 0xa1, 0x50, 0xa1, 0x55, 0xa1, 0x5a, 0xa1, 0x5f, 0xa1, 
+0x64, 0xa1, 0x68, 0xa1, 0x6d, 0xa1, 0x72, 0xa1, 0x77, 0xa1, 0x7b, 0xa1, 0x80, 0xa1, 0x85, 0xa1, 
+0x8a, 0xa1, 0x8e, 0xa1, 0x93, 0xa1, 0x98, 0xa1, 0x9d, 0xa1, 0xa1, 0xa1, 0xa6, 0xa1, 0xab, 0xa1, 
+0xb0, 0xa1, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0xa6, 0x21, 0xa6, 0x26, 0xa6, 0x2a, 0xa6, 0x2f, 0xa6, 0x34, 0xa6, 0x39, 0xa6, 
+0x3d, 0xa6, 0x42, 0xa6, 0x47, 0xa6, 0x4c, 0xa6, 0x50, 0xa6, 0x55, 0xa6, 0x5a, 0xa6, 0x5f, 0xa6, 
+0x64, 0xa6, 0x68, 0xa6, 0x6d, 0xa6, 0x72, 0xa6, 0x77, 0xa6, 0x7b, 0xa6, 0x80, 0xa6, 0x85, 0xa6, 
+0x8a, 0xa6, 0x8e, 0xa6, 0x93, 0xa6, 0x98, 0xa6, 0x9d, 0xa6, 0xa1, 0xa6, 0xa6, 0xa6, 0xab, 0xa6, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0xab, 0x26, 0xab, 0x2a, 0xab, 0x2f, 0xab, 0x34, 0xab, 0x39, 0xab, 
+0x3d, 0xab, 0x42, 0xab, 0x47, 0xab, 0x4c, 0xab, 0x50, 0xab, 0x55, 0xab, 0x5a, 0xab, 0x5f, 0xab, 
+0x64, 0xab, 0x68, 0xab, 0x6d, 0xab, 0x72, 0xab, 0x77, 0xab, 0x7b, 0xab, 0x80, 0xab, 0x85, 0xab, 
+0x8a, 0xab, 0x8e, 0xab, 0x93, 0xab, 0x98, 0xab, 0x9d, 0xab, 0xa1, 0xab, 0xa6, 0xab, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0xb0, 0x2a, 0xb0, 0x2f, 0xb0, 0x34, 0xb0, 0x39, 0xb0, 
+0x3d, 0xb0, 0x42, 0xb0, 0x47, 0xb0, 0x4c, 0xb0, 0x50, 0xb0, 0x55, 0xb0, 0x5a, 0xb0, 0x5f, 0xb0, 
+0x64, 0xb0, 0x68, 0xb0, 0x6d, 0xb0, 0x72, 0xb0, 0x77, 0xb0, 0x7b, 0xb0, 0x80, 0xb0, 0x85, 0xb0, 
+0x8a, 0xb0, 0x8e, 0xb0, 0x93, 0xb0, 0x98, 0xb0, 0x9d, 0xb0, 0xa1, 0xb0, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2a, 0xb4, 0x2f, 0xb4, 0x34, 0xb4, 0x39, 0xb4, 
+0x3d, 0xb4, 0x42, 0xb4, 0x47, 0xb4, 0x4c, 0xb4, 0x50, 0xb4, 0x55, 0xb4, 0x5a, 0xb4, 0x5f, 0xb4, 
+0x64, 0xb4, 0x68, 0xb4, 0x6d, 0xb4, 0x72, 0xb4, 0x77, 0xb4, 0x7b, 0xb4, 0x80, 0xb4, 0x85, 0xb4, 
+0x8a, 0xb4, 0x8e, 0xb4, 0x93, 0xb4, 0x98, 0xb4, 0x9d, 0xb4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x34, 0xb9, 0x39, 0xb9, 
+0x3d, 0xb9, 0x42, 0xb9, 0x47, 0xb9, 0x4c, 0xb9, 0x50, 0xb9, 0x55, 0xb9, 0x5a, 0xb9, 0x5f, 0xb9, 
+0x64, 0xb9, 0x68, 0xb9, 0x6d, 0xb9, 0x72, 0xb9, 0x77, 0xb9, 0x7b, 0xb9, 0x80, 0xb9, 0x85, 0xb9, 
+0x8a, 0xb9, 0x8e, 0xb9, 0x93, 0xb9, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3d, 0xbe, 0x42, 0xbe, 0x47, 0xbe, 0x4c, 0xbe, 0x50, 0xbe, 0x55, 0xbe, 0x5a, 0xbe, 0x5f, 0xbe, 
+0x64, 0xbe, 0x68, 0xbe, 0x6d, 0xbe, 0x72, 0xbe, 0x77, 0xbe, 0x7b, 0xbe, 0x80, 0xbe, 0x85, 0xbe, 
+0x8a, 0xbe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0xc3, 0x4c, 0xc3, 0x50, 0xc3, 0x55, 0xc3, 0x5a, 0xc3, 0x5f, 0xc3, 
+0x64, 0xc3, 0x68, 0xc3, 0x6d, 0xc3, 0x72, 0xc3, 0x77, 0xc3, 0x7b, 0xc3, 0x80, 0xc3, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x56, 0x00, 0x5e, 0x00, 0x67, 0x00, 0x70, 0x00, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0x08, 0x43, 0x06, 0x4c, 0x04, 0x55, 0x04, 0x5e, 0x04, 0x67, 0x04, 0x70, 0x04, 0x79, 0x04, 
+0x82, 0x05, 0x8a, 0x08, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2a, 0x12, 0x31, 0x0e, 
+0x39, 0x0d, 0x42, 0x0d, 0x4c, 0x0e, 0x55, 0x0f, 0x5e, 0x0f, 0x67, 0x0f, 0x70, 0x0f, 0x79, 0x0e, 
+0x83, 0x0d, 0x8c, 0x0d, 0x95, 0x0e, 0x9c, 0x11, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0x19, 0x27, 0x17, 0x30, 0x16, 
+0x3a, 0x17, 0x44, 0x1a, 0x4d, 0x1c, 0x56, 0x1e, 0x5f, 0x1f, 0x67, 0x1f, 0x6f, 0x1e, 0x78, 0x1d, 
+0x81, 0x1a, 0x8b, 0x18, 0x95, 0x16, 0x9e, 0x16, 0xa5, 0x19, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1a, 0x1f, 0x1e, 0x1f, 0x27, 0x20, 0x32, 0x22, 
+0x3d, 0x25, 0x4b, 0x32, 0x54, 0x38, 0x5b, 0x3a, 0x60, 0x3b, 0x66, 0x3b, 0x6b, 0x3b, 0x71, 0x38, 
+0x7a, 0x34, 0x88, 0x26, 0x93, 0x22, 0x9e, 0x20, 0xa8, 0x1f, 0xae, 0x22, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x24, 0x1a, 0x23, 0x20, 0x26, 0x2a, 0x2b, 0x35, 0x2f, 
+0x48, 0x3d, 0x50, 0x41, 0x56, 0x43, 0x5c, 0x44, 0x61, 0x45, 0x65, 0x45, 0x6a, 0x44, 0x70, 0x43, 
+0x75, 0x42, 0x7d, 0x3e, 0x8c, 0x33, 0x9b, 0x2c, 0xa7, 0x29, 0xb1, 0x29, 0xb6, 0x2b, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x16, 0x27, 0x1c, 0x2a, 0x25, 0x2e, 0x30, 0x35, 0x43, 0x44, 
+0x4c, 0x48, 0x52, 0x49, 0x57, 0x4b, 0x5c, 0x4b, 0x61, 0x4b, 0x65, 0x4c, 0x6a, 0x4b, 0x6f, 0x4b, 
+0x74, 0x4a, 0x7a, 0x48, 0x82, 0x45, 0x94, 0x3b, 0xa5, 0x34, 0xb1, 0x32, 0xb9, 0x32, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x12, 0x2b, 0x17, 0x2d, 0x20, 0x31, 0x2b, 0x37, 0x40, 0x46, 0x48, 0x4b, 
+0x4e, 0x4e, 0x53, 0x50, 0x58, 0x50, 0x5d, 0x51, 0x61, 0x51, 0x65, 0x51, 0x69, 0x51, 0x6e, 0x50, 
+0x73, 0x50, 0x78, 0x4f, 0x7f, 0x4d, 0x89, 0x4a, 0xa1, 0x3f, 0xaf, 0x3c, 0xba, 0x3b, 0xbf, 0x3d, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x0f, 0x2e, 0x13, 0x2f, 0x1a, 0x33, 0x25, 0x39, 0x3a, 0x46, 0x45, 0x4d, 0x4b, 0x50, 
+0x50, 0x53, 0x54, 0x55, 0x59, 0x55, 0x5d, 0x56, 0x61, 0x56, 0x65, 0x56, 0x69, 0x56, 0x6e, 0x55, 
+0x72, 0x55, 0x77, 0x54, 0x7d, 0x53, 0x85, 0x52, 0x93, 0x4d, 0xad, 0x46, 0xba, 0x44, 0xc2, 0x45, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0f, 0x31, 0x15, 0x35, 0x1f, 0x3a, 0x32, 0x45, 0x41, 0x4e, 0x48, 0x52, 0x4e, 0x55, 
+0x52, 0x57, 0x56, 0x58, 0x59, 0x59, 0x5d, 0x5a, 0x61, 0x5a, 0x65, 0x5a, 0x69, 0x5a, 0x6d, 0x5a, 
+0x72, 0x59, 0x77, 0x59, 0x7c, 0x58, 0x84, 0x57, 0x8f, 0x56, 0xaa, 0x4f, 0xb9, 0x4e, 0xc3, 0x4e, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x0d, 0x33, 0x10, 0x36, 0x19, 0x3b, 0x2d, 0x46, 0x38, 0x4c, 0x45, 0x53, 0x4b, 0x56, 0x50, 0x58, 
+0x54, 0x5a, 0x57, 0x5b, 0x5a, 0x5d, 0x5d, 0x5e, 0x61, 0x5e, 0x65, 0x5e, 0x69, 0x5e, 0x6d, 0x5e, 
+0x71, 0x5e, 0x76, 0x5e, 0x7c, 0x5d, 0x83, 0x5d, 0x8c, 0x5c, 0xa9, 0x58, 0xb8, 0x57, 0xc3, 0x57, 
+0xc7, 0x57, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0d, 0x36, 0x13, 0x3b, 0x27, 0x46, 0x33, 0x4c, 0x3c, 0x51, 0x48, 0x57, 0x4d, 0x59, 0x51, 0x5b, 
+0x55, 0x5d, 0x58, 0x5e, 0x5b, 0x60, 0x5e, 0x61, 0x61, 0x62, 0x65, 0x62, 0x69, 0x62, 0x6d, 0x62, 
+0x71, 0x62, 0x76, 0x62, 0x7b, 0x62, 0x82, 0x62, 0x8c, 0x61, 0xa8, 0x60, 0xb8, 0x60, 0xc3, 0x60, 
+0xc7, 0x60, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x34, 
+0x0f, 0x38, 0x21, 0x43, 0x2d, 0x4a, 0x38, 0x50, 0x40, 0x54, 0x4a, 0x59, 0x4f, 0x5b, 0x53, 0x5d, 
+0x57, 0x5f, 0x5a, 0x60, 0x5d, 0x61, 0x60, 0x62, 0x62, 0x64, 0x65, 0x64, 0x69, 0x65, 0x6d, 0x65, 
+0x71, 0x65, 0x76, 0x65, 0x7b, 0x65, 0x82, 0x65, 0x8c, 0x65, 0xa8, 0x66, 0xb8, 0x66, 0xc3, 0x66, 
+0xc7, 0x66, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x35, 
+0x1c, 0x3f, 0x28, 0x46, 0x33, 0x4d, 0x3c, 0x52, 0x43, 0x56, 0x4c, 0x5a, 0x51, 0x5d, 0x55, 0x5e, 
+0x58, 0x60, 0x5b, 0x61, 0x5e, 0x62, 0x61, 0x64, 0x63, 0x64, 0x66, 0x65, 0x69, 0x66, 0x6d, 0x67, 
+0x71, 0x67, 0x76, 0x67, 0x7c, 0x67, 0x82, 0x67, 0x8c, 0x68, 0xa9, 0x6a, 0xb8, 0x6a, 0xc4, 0x6b, 
+0xc7, 0x6a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x31, 0x19, 0x3a, 
+0x24, 0x42, 0x2e, 0x49, 0x37, 0x4f, 0x3f, 0x54, 0x46, 0x58, 0x4e, 0x5c, 0x53, 0x5e, 0x56, 0x60, 
+0x59, 0x61, 0x5c, 0x62, 0x5f, 0x64, 0x61, 0x65, 0x64, 0x65, 0x67, 0x66, 0x6a, 0x67, 0x6d, 0x68, 
+0x72, 0x68, 0x76, 0x69, 0x7c, 0x69, 0x83, 0x69, 0x8d, 0x6a, 0xaa, 0x6e, 0xb9, 0x6e, 0xc4, 0x6f, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0x2e, 0x17, 0x36, 0x20, 0x3e, 
+0x2a, 0x46, 0x33, 0x4c, 0x3b, 0x52, 0x43, 0x56, 0x49, 0x5a, 0x50, 0x5d, 0x54, 0x5f, 0x58, 0x61, 
+0x5a, 0x62, 0x5d, 0x64, 0x60, 0x65, 0x62, 0x65, 0x65, 0x66, 0x68, 0x67, 0x6b, 0x68, 0x6e, 0x69, 
+0x72, 0x6a, 0x77, 0x6a, 0x7d, 0x6b, 0x84, 0x6c, 0x90, 0x6d, 0xac, 0x71, 0xbb, 0x72, 0xc4, 0x72, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x31, 0x1e, 0x3a, 0x26, 0x42, 
+0x2f, 0x49, 0x38, 0x4f, 0x3f, 0x54, 0x46, 0x58, 0x4b, 0x5c, 0x52, 0x5f, 0x56, 0x61, 0x59, 0x62, 
+0x5c, 0x64, 0x5e, 0x65, 0x61, 0x66, 0x63, 0x66, 0x66, 0x67, 0x69, 0x68, 0x6c, 0x69, 0x6f, 0x6a, 
+0x73, 0x6b, 0x78, 0x6c, 0x7e, 0x6d, 0x86, 0x6e, 0x96, 0x71, 0xae, 0x75, 0xbc, 0x76, 0xc4, 0x76, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x18, 0x2d, 0x1d, 0x35, 0x24, 0x3e, 0x2c, 0x45, 
+0x34, 0x4c, 0x3c, 0x52, 0x42, 0x57, 0x48, 0x5b, 0x4d, 0x5e, 0x54, 0x60, 0x57, 0x62, 0x5a, 0x64, 
+0x5d, 0x65, 0x5f, 0x66, 0x61, 0x67, 0x64, 0x67, 0x67, 0x68, 0x6a, 0x69, 0x6d, 0x69, 0x70, 0x6a, 
+0x75, 0x6b, 0x79, 0x6d, 0x7f, 0x6f, 0x8c, 0x72, 0x98, 0x74, 0xb1, 0x78, 0xbe, 0x79, 0xc5, 0x79, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x1f, 0x31, 0x24, 0x39, 0x2a, 0x42, 0x31, 0x49, 
+0x38, 0x50, 0x3f, 0x55, 0x45, 0x59, 0x4b, 0x5d, 0x4f, 0x60, 0x55, 0x62, 0x58, 0x64, 0x5b, 0x65, 
+0x5d, 0x66, 0x60, 0x67, 0x62, 0x67, 0x65, 0x68, 0x67, 0x69, 0x6a, 0x69, 0x6e, 0x6a, 0x72, 0x6b, 
+0x76, 0x6c, 0x7c, 0x6e, 0x86, 0x71, 0x8f, 0x74, 0x9b, 0x77, 0xb4, 0x7c, 0xc0, 0x7c, 0xc5, 0x7b, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x25, 0x35, 0x2a, 0x3e, 0x30, 0x46, 0x36, 0x4d, 
+0x3d, 0x53, 0x43, 0x58, 0x48, 0x5c, 0x4d, 0x5f, 0x51, 0x62, 0x57, 0x64, 0x59, 0x65, 0x5c, 0x66, 
+0x5e, 0x67, 0x61, 0x68, 0x63, 0x68, 0x65, 0x69, 0x68, 0x6a, 0x6b, 0x6a, 0x6f, 0x6b, 0x73, 0x6c, 
+0x78, 0x6d, 0x81, 0x70, 0x89, 0x72, 0x92, 0x75, 0x9f, 0x79, 0xb7, 0x7f, 0xc1, 0x7f, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x2c, 0x39, 0x30, 0x42, 0x35, 0x4a, 0x3a, 0x51, 
+0x40, 0x56, 0x46, 0x5b, 0x4b, 0x5e, 0x4f, 0x61, 0x53, 0x64, 0x58, 0x65, 0x5a, 0x66, 0x5d, 0x67, 
+0x5f, 0x68, 0x61, 0x69, 0x64, 0x69, 0x66, 0x6a, 0x69, 0x6a, 0x6c, 0x6b, 0x70, 0x6c, 0x74, 0x6d, 
+0x7c, 0x6f, 0x83, 0x71, 0x8c, 0x73, 0x96, 0x76, 0xa3, 0x7a, 0xba, 0x81, 0xc2, 0x81, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x32, 0x3e, 0x35, 0x46, 0x3a, 0x4e, 0x3f, 0x54, 
+0x44, 0x5a, 0x48, 0x5e, 0x4d, 0x61, 0x51, 0x64, 0x54, 0x65, 0x59, 0x66, 0x5b, 0x67, 0x5e, 0x68, 
+0x60, 0x69, 0x62, 0x6a, 0x64, 0x6a, 0x67, 0x6b, 0x6a, 0x6b, 0x6d, 0x6c, 0x71, 0x6d, 0x78, 0x6f, 
+0x7e, 0x70, 0x86, 0x72, 0x8f, 0x74, 0x9a, 0x77, 0xa8, 0x7a, 0xbe, 0x80, 0xc3, 0x81, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 
+0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x38, 0x43, 0x3b, 0x4b, 0x3e, 0x52, 0x43, 0x58, 
+0x47, 0x5d, 0x4b, 0x61, 0x4f, 0x64, 0x52, 0x66, 0x56, 0x67, 0x5a, 0x68, 0x5c, 0x69, 0x5e, 0x69, 
+0x60, 0x6a, 0x62, 0x6b, 0x65, 0x6b, 0x67, 0x6c, 0x6a, 0x6c, 0x6e, 0x6d, 0x74, 0x6f, 0x7a, 0x70, 
+0x81, 0x71, 0x89, 0x73, 0x93, 0x75, 0x9e, 0x77, 0xac, 0x7a, 0xc1, 0x7f, 0xc4, 0x7f, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 
+0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x3e, 0x48, 0x40, 0x50, 0x43, 0x56, 0x46, 0x5c, 
+0x4a, 0x60, 0x4d, 0x64, 0x51, 0x66, 0x54, 0x68, 0x57, 0x69, 0x5b, 0x69, 0x5d, 0x6a, 0x5f, 0x6b, 
+0x61, 0x6b, 0x63, 0x6c, 0x65, 0x6c, 0x68, 0x6c, 0x6b, 0x6d, 0x70, 0x6f, 0x76, 0x70, 0x7c, 0x71, 
+0x83, 0x72, 0x8c, 0x73, 0x96, 0x75, 0xa2, 0x77, 0xb0, 0x7a, 0xc3, 0x7e, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 
+0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x44, 0x4e, 0x45, 0x55, 0x47, 0x5b, 0x4a, 0x60, 
+0x4d, 0x64, 0x50, 0x66, 0x53, 0x68, 0x55, 0x6a, 0x58, 0x6b, 0x5b, 0x6b, 0x5d, 0x6b, 0x5f, 0x6c, 
+0x61, 0x6c, 0x63, 0x6c, 0x66, 0x6d, 0x69, 0x6e, 0x6d, 0x6f, 0x72, 0x70, 0x77, 0x71, 0x7e, 0x72, 
+0x86, 0x73, 0x8f, 0x74, 0x9a, 0x75, 0xa6, 0x77, 0xb4, 0x79, 0xc4, 0x7b, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 
+0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x4a, 0x53, 0x4a, 0x5a, 0x4b, 0x5f, 0x4d, 0x64, 
+0x4f, 0x67, 0x52, 0x69, 0x54, 0x6b, 0x56, 0x6c, 0x59, 0x6d, 0x5c, 0x6c, 0x5e, 0x6c, 0x60, 0x6d, 
+0x62, 0x6d, 0x64, 0x6e, 0x66, 0x6e, 0x6a, 0x70, 0x6e, 0x70, 0x73, 0x71, 0x79, 0x72, 0x80, 0x72, 
+0x88, 0x73, 0x92, 0x74, 0x9d, 0x75, 0xa9, 0x76, 0xb7, 0x78, 0xc5, 0x79, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 
+0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x50, 0x58, 0x4f, 0x5f, 0x4f, 0x64, 0x50, 0x67, 
+0x51, 0x6a, 0x53, 0x6c, 0x55, 0x6d, 0x57, 0x6e, 0x5a, 0x6f, 0x5d, 0x6e, 0x5e, 0x6e, 0x60, 0x6e, 
+0x62, 0x6e, 0x64, 0x6f, 0x67, 0x71, 0x6b, 0x71, 0x6f, 0x71, 0x74, 0x72, 0x7a, 0x72, 0x81, 0x73, 
+0x8a, 0x73, 0x94, 0x74, 0xa0, 0x74, 0xac, 0x75, 0xb9, 0x75, 0xc6, 0x76, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 
+0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 0x56, 0x5e, 0x53, 0x64, 0x52, 0x68, 0x53, 0x6b, 
+0x54, 0x6d, 0x55, 0x6f, 0x57, 0x70, 0x58, 0x70, 0x5a, 0x71, 0x5d, 0x6f, 0x5f, 0x6f, 0x60, 0x6f, 
+0x62, 0x70, 0x64, 0x72, 0x67, 0x72, 0x6b, 0x72, 0x6f, 0x72, 0x75, 0x73, 0x7b, 0x73, 0x83, 0x73, 
+0x8c, 0x73, 0x97, 0x73, 0xa2, 0x73, 0xaf, 0x73, 0xbb, 0x73, 0xc6, 0x72, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 
+0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 0x5b, 0x64, 0x58, 0x69, 0x56, 0x6c, 0x55, 0x6f, 
+0x56, 0x71, 0x56, 0x72, 0x57, 0x72, 0x59, 0x73, 0x5a, 0x73, 0x5d, 0x71, 0x5f, 0x70, 0x60, 0x71, 
+0x62, 0x73, 0x64, 0x73, 0x67, 0x73, 0x6b, 0x73, 0x70, 0x73, 0x76, 0x73, 0x7d, 0x73, 0x85, 0x73, 
+0x8e, 0x72, 0x99, 0x72, 0xa4, 0x71, 0xb0, 0x70, 0xbc, 0x6f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x22, 0x22, 0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 
+0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 0x64, 0x64, 0x60, 0x69, 0x5c, 0x6e, 0x59, 0x71, 0x58, 0x73, 
+0x57, 0x74, 0x58, 0x75, 0x58, 0x75, 0x59, 0x75, 0x5b, 0x75, 0x5d, 0x72, 0x5e, 0x72, 0x5f, 0x74, 
+0x62, 0x74, 0x64, 0x74, 0x67, 0x74, 0x6b, 0x74, 0x70, 0x74, 0x76, 0x74, 0x7d, 0x73, 0x86, 0x72, 
+0x90, 0x71, 0x9a, 0x70, 0xa6, 0x6e, 0xb1, 0x6d, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 
+0x28, 0x28, 0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 
+0x58, 0x58, 0x5e, 0x5e, 0x64, 0x64, 0x69, 0x69, 0x65, 0x6f, 0x60, 0x73, 0x5c, 0x76, 0x5a, 0x77, 
+0x59, 0x78, 0x58, 0x78, 0x59, 0x78, 0x59, 0x78, 0x5a, 0x77, 0x5d, 0x75, 0x5d, 0x76, 0x5f, 0x76, 
+0x61, 0x76, 0x64, 0x76, 0x67, 0x75, 0x6b, 0x75, 0x70, 0x74, 0x76, 0x73, 0x7e, 0x72, 0x86, 0x71, 
+0x90, 0x6f, 0x9b, 0x6d, 0xa6, 0x6b, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x22, 0x28, 0x28, 
+0x2e, 0x2e, 0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 
+0x5e, 0x5e, 0x64, 0x64, 0x69, 0x69, 0x6f, 0x6f, 0x6a, 0x74, 0x64, 0x78, 0x5f, 0x7a, 0x5c, 0x7c, 
+0x5a, 0x7c, 0x59, 0x7c, 0x59, 0x7b, 0x59, 0x7b, 0x59, 0x7b, 0x5b, 0x7a, 0x5c, 0x78, 0x5e, 0x78, 
+0x60, 0x77, 0x63, 0x77, 0x66, 0x76, 0x6a, 0x75, 0x70, 0x74, 0x76, 0x73, 0x7e, 0x71, 0x86, 0x6f, 
+0x90, 0x6c, 0x9a, 0x69, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x2d, 0x23, 0x2d, 0x2e, 0x2e, 
+0x34, 0x34, 0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 
+0x64, 0x64, 0x69, 0x69, 0x6f, 0x6f, 0x75, 0x75, 0x6f, 0x7a, 0x68, 0x7e, 0x62, 0x80, 0x5e, 0x80, 
+0x5b, 0x80, 0x59, 0x80, 0x58, 0x7f, 0x58, 0x7f, 0x56, 0x84, 0x5a, 0x7d, 0x5b, 0x7b, 0x5d, 0x7a, 
+0x5f, 0x79, 0x61, 0x78, 0x65, 0x77, 0x69, 0x75, 0x6e, 0x73, 0x75, 0x71, 0x7d, 0x6f, 0x85, 0x6c, 
+0x8f, 0x68, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x17, 0x39, 0x23, 0x39, 0x2f, 0x39, 
+0x3a, 0x3a, 0x40, 0x40, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 0x64, 0x64, 
+0x69, 0x69, 0x6f, 0x6f, 0x75, 0x75, 0x7b, 0x7b, 0x74, 0x80, 0x6c, 0x83, 0x65, 0x85, 0x60, 0x86, 
+0x5c, 0x85, 0x59, 0x85, 0x57, 0x85, 0x53, 0x8c, 0x54, 0x8a, 0x58, 0x7f, 0x59, 0x7d, 0x5b, 0x7b, 
+0x5d, 0x7a, 0x5f, 0x78, 0x63, 0x77, 0x67, 0x74, 0x6c, 0x72, 0x73, 0x6f, 0x7a, 0x6b, 0x83, 0x67, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x45, 0x17, 0x45, 0x23, 0x45, 0x2f, 0x45, 
+0x3b, 0x45, 0x46, 0x46, 0x4c, 0x4c, 0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 0x64, 0x64, 0x69, 0x69, 
+0x6f, 0x6f, 0x75, 0x75, 0x7b, 0x7b, 0x81, 0x81, 0x79, 0x86, 0x6f, 0x8a, 0x67, 0x8b, 0x61, 0x8c, 
+0x5c, 0x8c, 0x58, 0x8c, 0x52, 0x96, 0x50, 0x93, 0x50, 0x8f, 0x55, 0x82, 0x57, 0x7f, 0x58, 0x7d, 
+0x5a, 0x7b, 0x5d, 0x78, 0x60, 0x76, 0x64, 0x73, 0x6a, 0x70, 0x70, 0x6c, 0x77, 0x67, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x50, 0x17, 0x50, 0x23, 0x50, 0x2f, 0x50, 
+0x3b, 0x50, 0x47, 0x50, 0x52, 0x52, 0x58, 0x58, 0x5e, 0x5e, 0x64, 0x64, 0x69, 0x69, 0x6f, 0x6f, 
+0x75, 0x75, 0x7b, 0x7b, 0x81, 0x81, 0x87, 0x87, 0x7d, 0x8d, 0x73, 0x90, 0x6a, 0x93, 0x62, 0x94, 
+0x5b, 0x95, 0x52, 0xa3, 0x4e, 0x9f, 0x4c, 0x9b, 0x4b, 0x95, 0x52, 0x85, 0x53, 0x81, 0x55, 0x7e, 
+0x56, 0x7b, 0x59, 0x78, 0x5c, 0x74, 0x60, 0x70, 0x65, 0x6c, 0x6c, 0x67, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5c, 0x17, 0x5c, 0x23, 0x5c, 0x2f, 0x5c, 
+0x3b, 0x5c, 0x47, 0x5c, 0x53, 0x5c, 0x5e, 0x5e, 0x64, 0x64, 0x69, 0x69, 0x6f, 0x6f, 0x75, 0x75, 
+0x7b, 0x7b, 0x81, 0x81, 0x87, 0x87, 0x8d, 0x8d, 0x82, 0x93, 0x77, 0x98, 0x6d, 0x9c, 0x63, 0x9f, 
+0x58, 0xb2, 0x4f, 0xae, 0x49, 0xa9, 0x46, 0xa3, 0x45, 0x9c, 0x4d, 0x88, 0x4f, 0x82, 0x50, 0x7e, 
+0x52, 0x7a, 0x54, 0x76, 0x57, 0x72, 0x5b, 0x6d, 0x60, 0x67, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x68, 0x17, 0x68, 0x23, 0x68, 0x2f, 0x68, 
+0x3b, 0x68, 0x47, 0x68, 0x53, 0x68, 0x5f, 0x68, 0x69, 0x69, 0x6f, 0x6f, 0x75, 0x75, 0x7b, 0x7b, 
+0x81, 0x81, 0x87, 0x87, 0x8d, 0x8d, 0x93, 0x93, 0x87, 0x9b, 0x7b, 0xa1, 0x6f, 0xa8, 0x63, 0xbe, 
+0x55, 0xbd, 0x4b, 0xb8, 0x43, 0xb2, 0x3e, 0xaa, 0x3c, 0xa1, 0x47, 0x8b, 0x48, 0x83, 0x4a, 0x7e, 
+0x4b, 0x79, 0x4e, 0x73, 0x51, 0x6e, 0x55, 0x67, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x74, 0x17, 0x74, 0x23, 0x74, 0x2f, 0x74, 
+0x3b, 0x74, 0x47, 0x74, 0x53, 0x74, 0x5f, 0x74, 0x6b, 0x74, 0x75, 0x75, 0x7b, 0x7b, 0x81, 0x81, 
+0x87, 0x87, 0x8d, 0x8d, 0x93, 0x93, 0x99, 0x99, 0x8c, 0xa3, 0x80, 0xae, 0x74, 0xc4, 0x62, 0xc6, 
+0x52, 0xc4, 0x45, 0xbf, 0x3b, 0xb8, 0x35, 0xb0, 0x31, 0xa5, 0x3e, 0x8c, 0x41, 0x83, 0x42, 0x7c, 
+0x44, 0x75, 0x47, 0x6f, 0x4a, 0x68, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x80, 0x17, 0x80, 0x23, 0x80, 0x2f, 0x80, 
+0x3b, 0x80, 0x47, 0x80, 0x53, 0x80, 0x5f, 0x80, 0x6b, 0x80, 0x77, 0x80, 0x81, 0x81, 0x87, 0x87, 
+0x8d, 0x8d, 0x93, 0x93, 0x99, 0x99, 0x9f, 0x9f, 0x92, 0xad, 0x87, 0xc1, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x40, 0xc1, 0x33, 0xba, 0x2a, 0xb1, 0x26, 0xa6, 0x35, 0x8b, 0x38, 0x81, 0x3a, 0x78, 
+0x3c, 0x71, 0x3f, 0x69, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x8c, 0x17, 0x8c, 0x23, 0x8c, 0x2f, 0x8c, 
+0x3b, 0x8c, 0x47, 0x8c, 0x53, 0x8c, 0x5f, 0x8c, 0x6b, 0x8c, 0x77, 0x8c, 0x82, 0x8c, 0x8d, 0x8d, 
+0x93, 0x93, 0x99, 0x99, 0x9f, 0x9f, 0xa5, 0xa5, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x21, 0xad, 0x1a, 0xa1, 0x2a, 0x88, 0x2e, 0x7c, 0x31, 0x73, 
+0x34, 0x6a, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x98, 0x23, 0x98, 0x2f, 0x98, 
+0x3b, 0x98, 0x47, 0x98, 0x53, 0x98, 0x5f, 0x98, 0x6b, 0x98, 0x77, 0x98, 0x82, 0x98, 0x8e, 0x98, 
+0x99, 0x99, 0x9f, 0x9f, 0xa5, 0xa5, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x10, 0x99, 0x1f, 0x83, 0x24, 0x76, 0x28, 0x6c, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xa4, 0x23, 0xa4, 0x2f, 0xa4, 
+0x3b, 0xa4, 0x47, 0xa4, 0x53, 0xa4, 0x5f, 0xa4, 0x6b, 0xa4, 0x77, 0xa4, 0x82, 0xa4, 0x8e, 0xa4, 
+0x9a, 0xa4, 0xa5, 0xa5, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x8d, 0x15, 0x7a, 0x1c, 0x6e, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xb0, 0x2f, 0xb0, 
+0x3b, 0xb0, 0x47, 0xb0, 0x53, 0xb0, 0x5f, 0xb0, 0x6b, 0xb0, 0x77, 0xb0, 0x82, 0xb0, 0x8e, 0xb0, 
+0x9a, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x70, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0xbc, 0x47, 0xbc, 0x53, 0xbc, 0x5f, 0xbc, 0x6b, 0xbc, 0x77, 0xbc, 0x82, 0xbc, 0x8e, 0xbc, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x64, 0x15, 0x64, 0x21, 0x64, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x68, 0x15, 0x68, 0x21, 0x68, 
+0x2d, 0x68, 0x39, 0x68, 0x45, 0x68, 0x50, 0x68, 0x5c, 0x68, 0x68, 0x68, 0x74, 0x68, 0x80, 0x68, 
+0x8c, 0x68, 0x98, 0x68, 0xa4, 0x68, 0xb0, 0x68, 0xbc, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x74, 0x15, 0x74, 0x21, 0x74, 
+0x2d, 0x74, 0x39, 0x74, 0x45, 0x74, 0x50, 0x74, 0x5c, 0x74, 0x68, 0x74, 0x74, 0x74, 0x80, 0x74, 
+0x8c, 0x74, 0x98, 0x74, 0xa4, 0x74, 0xb0, 0x74, 0xbc, 0x74, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x80, 0x15, 0x80, 0x21, 0x80, 
+0x2d, 0x80, 0x39, 0x80, 0x45, 0x80, 0x50, 0x80, 0x5c, 0x80, 0x68, 0x80, 0x74, 0x80, 0x80, 0x80, 
+0x8c, 0x80, 0x98, 0x80, 0xa4, 0x80, 0xb0, 0x80, 0xbc, 0x80, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x09, 0x8c, 0x15, 0x8c, 0x21, 0x8c, 
+0x2d, 0x8c, 0x39, 0x8c, 0x45, 0x8c, 0x50, 0x8c, 0x5c, 0x8c, 0x68, 0x8c, 0x74, 0x8c, 0x80, 0x8c, 
+0x8c, 0x8c, 0x98, 0x8c, 0xa4, 0x8c, 0xb0, 0x8c, 0xbc, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x15, 0x98, 0x21, 0x98, 
+0x2d, 0x98, 0x39, 0x98, 0x45, 0x98, 0x50, 0x98, 0x5c, 0x98, 0x68, 0x98, 0x74, 0x98, 0x80, 0x98, 
+0x8c, 0x98, 0x98, 0x98, 0xa4, 0x98, 0xb0, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x21, 0xa4, 
+0x2d, 0xa4, 0x39, 0xa4, 0x45, 0xa4, 0x50, 0xa4, 0x5c, 0xa4, 0x68, 0xa4, 0x74, 0xa4, 0x80, 0xa4, 
+0x8c, 0xa4, 0x98, 0xa4, 0xa4, 0xa4, 0xb0, 0xa4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x2d, 0xb0, 0x39, 0xb0, 0x45, 0xb0, 0x50, 0xb0, 0x5c, 0xb0, 0x68, 0xb0, 0x74, 0xb0, 0x80, 0xb0, 
+0x8c, 0xb0, 0x98, 0xb0, 0xa4, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x39, 0xbc, 0x45, 0xbc, 0x50, 0xbc, 0x5c, 0xbc, 0x68, 0xbc, 0x74, 0xbc, 0x80, 0xbc, 
+0x8c, 0xbc, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0x05, 0x4c, 0x07, 0x51, 0x08, 0x56, 0x0a, 0x5b, 0x0b, 0x5f, 0x0b, 
+0x64, 0x0b, 0x68, 0x0b, 0x6c, 0x0b, 0x71, 0x0a, 0x76, 0x08, 0x7b, 0x07, 0x80, 0x05, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3e, 0x0c, 0x44, 0x0e, 0x49, 0x10, 0x4e, 0x12, 0x53, 0x14, 0x57, 0x15, 0x5b, 0x16, 0x5f, 0x17, 
+0x64, 0x17, 0x68, 0x17, 0x6c, 0x16, 0x70, 0x15, 0x74, 0x14, 0x79, 0x12, 0x7e, 0x10, 0x83, 0x0e, 
+0x89, 0x0c, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x35, 0x10, 0x3b, 0x13, 
+0x41, 0x16, 0x47, 0x19, 0x4c, 0x1c, 0x50, 0x1e, 0x54, 0x20, 0x58, 0x21, 0x5c, 0x22, 0x60, 0x23, 
+0x64, 0x23, 0x67, 0x23, 0x6b, 0x22, 0x6f, 0x21, 0x73, 0x20, 0x77, 0x1e, 0x7b, 0x1c, 0x80, 0x19, 
+0x86, 0x16, 0x8c, 0x13, 0x92, 0x10, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2b, 0x14, 0x32, 0x17, 0x39, 0x1a, 0x3f, 0x1e, 
+0x44, 0x21, 0x49, 0x24, 0x4e, 0x27, 0x52, 0x29, 0x56, 0x2b, 0x5a, 0x2d, 0x5d, 0x2e, 0x60, 0x2f, 
+0x64, 0x2f, 0x67, 0x2f, 0x6a, 0x2e, 0x6d, 0x2d, 0x71, 0x2b, 0x75, 0x29, 0x79, 0x27, 0x7e, 0x24, 
+0x83, 0x21, 0x88, 0x1e, 0x8e, 0x1a, 0x95, 0x17, 0x9c, 0x14, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x27, 0x19, 0x2f, 0x1d, 0x36, 0x21, 0x3c, 0x24, 0x42, 0x28, 
+0x47, 0x2b, 0x4c, 0x2e, 0x51, 0x31, 0x55, 0x34, 0x58, 0x37, 0x5b, 0x38, 0x5e, 0x3a, 0x61, 0x3b, 
+0x64, 0x3b, 0x66, 0x3b, 0x69, 0x3a, 0x6c, 0x38, 0x6f, 0x37, 0x72, 0x34, 0x76, 0x31, 0x7b, 0x2e, 
+0x80, 0x2b, 0x85, 0x28, 0x8b, 0x24, 0x91, 0x21, 0x98, 0x1d, 0xa0, 0x19, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x23, 0x1f, 0x2b, 0x22, 0x32, 0x26, 0x39, 0x2a, 0x40, 0x2e, 0x46, 0x32, 
+0x4b, 0x35, 0x50, 0x39, 0x54, 0x3c, 0x57, 0x3f, 0x5b, 0x42, 0x5d, 0x44, 0x60, 0x46, 0x62, 0x47, 
+0x64, 0x47, 0x65, 0x47, 0x67, 0x46, 0x6a, 0x44, 0x6c, 0x42, 0x70, 0x3f, 0x73, 0x3c, 0x77, 0x39, 
+0x7c, 0x35, 0x81, 0x32, 0x87, 0x2e, 0x8e, 0x2a, 0x95, 0x26, 0x9c, 0x22, 0xa4, 0x1f, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1f, 0x23, 0x27, 0x27, 0x2f, 0x2b, 0x36, 0x2f, 0x3d, 0x33, 0x44, 0x37, 0x49, 0x3b, 
+0x4f, 0x3f, 0x53, 0x43, 0x57, 0x47, 0x5a, 0x4a, 0x5d, 0x4d, 0x5f, 0x50, 0x61, 0x51, 0x62, 0x52, 
+0x64, 0x53, 0x65, 0x52, 0x66, 0x51, 0x68, 0x50, 0x6a, 0x4d, 0x6d, 0x4a, 0x70, 0x47, 0x74, 0x43, 
+0x78, 0x3f, 0x7e, 0x3b, 0x83, 0x37, 0x8a, 0x33, 0x91, 0x2f, 0x98, 0x2b, 0xa0, 0x27, 0xa8, 0x23, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x19, 0x27, 0x22, 0x2b, 0x2b, 0x2f, 0x33, 0x33, 0x3a, 0x37, 0x41, 0x3b, 0x48, 0x40, 0x4e, 0x44, 
+0x53, 0x48, 0x57, 0x4d, 0x5b, 0x51, 0x5e, 0x55, 0x60, 0x58, 0x62, 0x5b, 0x62, 0x5d, 0x63, 0x5e, 
+0x64, 0x5f, 0x64, 0x5e, 0x65, 0x5d, 0x65, 0x5b, 0x67, 0x58, 0x69, 0x55, 0x6c, 0x51, 0x70, 0x4d, 
+0x74, 0x48, 0x79, 0x44, 0x7f, 0x40, 0x86, 0x3b, 0x8d, 0x37, 0x94, 0x33, 0x9c, 0x2f, 0xa5, 0x2b, 
+0xae, 0x27, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x14, 0x2b, 
+0x1d, 0x2f, 0x26, 0x32, 0x2f, 0x36, 0x37, 0x3a, 0x3f, 0x3f, 0x46, 0x43, 0x4c, 0x48, 0x52, 0x4d, 
+0x57, 0x51, 0x5c, 0x56, 0x5f, 0x5b, 0x62, 0x5f, 0x63, 0x63, 0x64, 0x66, 0x64, 0x69, 0x64, 0x6a, 
+0x64, 0x6b, 0x63, 0x6a, 0x63, 0x69, 0x63, 0x66, 0x64, 0x63, 0x65, 0x5f, 0x68, 0x5b, 0x6b, 0x56, 
+0x70, 0x51, 0x75, 0x4d, 0x7b, 0x48, 0x81, 0x43, 0x88, 0x3f, 0x90, 0x3a, 0x98, 0x36, 0xa1, 0x32, 
+0xaa, 0x2f, 0xb3, 0x2b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x32, 
+0x21, 0x36, 0x2a, 0x39, 0x33, 0x3d, 0x3b, 0x41, 0x43, 0x46, 0x4b, 0x4b, 0x51, 0x50, 0x57, 0x55, 
+0x5c, 0x5a, 0x61, 0x5f, 0x64, 0x64, 0x66, 0x69, 0x67, 0x6e, 0x67, 0x71, 0x67, 0x74, 0x65, 0x76, 
+0x64, 0x77, 0x62, 0x76, 0x60, 0x74, 0x60, 0x71, 0x60, 0x6e, 0x61, 0x69, 0x63, 0x64, 0x66, 0x5f, 
+0x6b, 0x5a, 0x70, 0x55, 0x76, 0x50, 0x7c, 0x4b, 0x84, 0x46, 0x8c, 0x41, 0x94, 0x3d, 0x9d, 0x39, 
+0xa6, 0x36, 0xb0, 0x32, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x35, 0x1a, 0x39, 
+0x24, 0x3c, 0x2e, 0x40, 0x37, 0x44, 0x40, 0x48, 0x48, 0x4c, 0x50, 0x51, 0x57, 0x57, 0x5d, 0x5c, 
+0x62, 0x62, 0x66, 0x67, 0x69, 0x6d, 0x6b, 0x73, 0x6c, 0x78, 0x6b, 0x7c, 0x69, 0x80, 0x67, 0x82, 
+0x64, 0x82, 0x60, 0x82, 0x5e, 0x80, 0x5c, 0x7c, 0x5b, 0x78, 0x5c, 0x73, 0x5e, 0x6d, 0x61, 0x67, 
+0x65, 0x62, 0x6a, 0x5c, 0x70, 0x57, 0x77, 0x51, 0x7f, 0x4c, 0x87, 0x48, 0x90, 0x44, 0x99, 0x40, 
+0xa3, 0x3c, 0xad, 0x39, 0xb7, 0x35, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x3b, 0x1e, 0x3f, 
+0x28, 0x42, 0x32, 0x46, 0x3b, 0x49, 0x44, 0x4e, 0x4d, 0x52, 0x55, 0x57, 0x5c, 0x5d, 0x62, 0x62, 
+0x68, 0x68, 0x6c, 0x6f, 0x6f, 0x75, 0x71, 0x7b, 0x71, 0x81, 0x6f, 0x87, 0x6c, 0x8b, 0x68, 0x8d, 
+0x64, 0x8e, 0x5f, 0x8d, 0x5b, 0x8b, 0x58, 0x87, 0x56, 0x81, 0x56, 0x7b, 0x58, 0x75, 0x5b, 0x6f, 
+0x5f, 0x68, 0x65, 0x62, 0x6b, 0x5d, 0x72, 0x57, 0x7a, 0x52, 0x83, 0x4e, 0x8c, 0x49, 0x95, 0x46, 
+0x9f, 0x42, 0xa9, 0x3f, 0xb4, 0x3b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x3e, 0x16, 0x41, 0x21, 0x44, 
+0x2b, 0x47, 0x35, 0x4b, 0x3f, 0x4f, 0x48, 0x53, 0x51, 0x57, 0x5a, 0x5c, 0x62, 0x62, 0x68, 0x68, 
+0x6e, 0x6e, 0x73, 0x75, 0x76, 0x7c, 0x77, 0x83, 0x77, 0x8a, 0x74, 0x91, 0x70, 0x96, 0x6a, 0x99, 
+0x64, 0x9a, 0x5d, 0x99, 0x57, 0x96, 0x53, 0x91, 0x50, 0x8a, 0x50, 0x83, 0x51, 0x7c, 0x54, 0x75, 
+0x59, 0x6e, 0x5f, 0x68, 0x65, 0x62, 0x6d, 0x5c, 0x76, 0x57, 0x7f, 0x53, 0x88, 0x4f, 0x92, 0x4b, 
+0x9c, 0x47, 0xa6, 0x44, 0xb1, 0x41, 0xbb, 0x3e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x44, 0x19, 0x47, 0x24, 0x49, 
+0x2e, 0x4c, 0x39, 0x50, 0x43, 0x53, 0x4d, 0x57, 0x56, 0x5c, 0x5f, 0x61, 0x67, 0x66, 0x6f, 0x6c, 
+0x75, 0x73, 0x7a, 0x7a, 0x7e, 0x82, 0x7f, 0x8a, 0x7e, 0x92, 0x7b, 0x9a, 0x75, 0xa0, 0x6d, 0xa5, 
+0x64, 0xa6, 0x5a, 0xa5, 0x52, 0xa0, 0x4c, 0x9a, 0x49, 0x92, 0x48, 0x8a, 0x49, 0x82, 0x4d, 0x7a, 
+0x52, 0x73, 0x58, 0x6c, 0x60, 0x66, 0x68, 0x61, 0x71, 0x5c, 0x7a, 0x57, 0x84, 0x53, 0x8e, 0x50, 
+0x99, 0x4c, 0xa3, 0x49, 0xae, 0x47, 0xb9, 0x44, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x05, 0x47, 0x10, 0x49, 0x1c, 0x4c, 0x27, 0x4e, 
+0x31, 0x51, 0x3c, 0x54, 0x47, 0x57, 0x51, 0x5b, 0x5b, 0x5f, 0x64, 0x64, 0x6d, 0x69, 0x75, 0x6f, 
+0x7c, 0x76, 0x82, 0x7e, 0x86, 0x86, 0x88, 0x8f, 0x87, 0x99, 0x83, 0xa2, 0x7b, 0xaa, 0x70, 0xb0, 
+0x64, 0xb2, 0x57, 0xb0, 0x4c, 0xaa, 0x44, 0xa2, 0x40, 0x99, 0x3f, 0x8f, 0x41, 0x86, 0x45, 0x7e, 
+0x4b, 0x76, 0x52, 0x6f, 0x5a, 0x69, 0x63, 0x64, 0x6c, 0x5f, 0x76, 0x5b, 0x80, 0x57, 0x8b, 0x54, 
+0x96, 0x51, 0xa0, 0x4e, 0xab, 0x4c, 0xb7, 0x49, 0xc2, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x07, 0x4c, 0x12, 0x4e, 0x1e, 0x50, 0x29, 0x52, 
+0x34, 0x55, 0x3f, 0x57, 0x4a, 0x5a, 0x55, 0x5e, 0x5f, 0x62, 0x69, 0x66, 0x73, 0x6b, 0x7b, 0x71, 
+0x83, 0x77, 0x8a, 0x7f, 0x8f, 0x88, 0x92, 0x92, 0x92, 0x9d, 0x8d, 0xa9, 0x83, 0xb3, 0x75, 0xbb, 
+0x64, 0xbe, 0x52, 0xbb, 0x44, 0xb3, 0x3a, 0xa9, 0x35, 0x9d, 0x35, 0x92, 0x38, 0x88, 0x3d, 0x7f, 
+0x44, 0x77, 0x4c, 0x71, 0x54, 0x6b, 0x5e, 0x66, 0x68, 0x62, 0x72, 0x5e, 0x7d, 0x5a, 0x88, 0x57, 
+0x93, 0x55, 0x9e, 0x52, 0xa9, 0x50, 0xb5, 0x4e, 0xc0, 0x4c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x08, 0x51, 0x14, 0x53, 0x20, 0x54, 0x2b, 0x56, 
+0x37, 0x58, 0x42, 0x5b, 0x4d, 0x5d, 0x58, 0x60, 0x63, 0x63, 0x6e, 0x67, 0x78, 0x6c, 0x81, 0x71, 
+0x8a, 0x77, 0x92, 0x7e, 0x99, 0x87, 0x9d, 0x92, 0x9e, 0x9e, 0x9a, 0xac, 0x8f, 0xba, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x38, 0xba, 0x2d, 0xac, 0x24, 0x91, 0x27, 0x81, 0x2d, 0x76, 0x35, 0x6e, 
+0x3e, 0x69, 0x48, 0x65, 0x51, 0x62, 0x5b, 0x60, 0x65, 0x5f, 0x6f, 0x5e, 0x7a, 0x5d, 0x85, 0x5b, 
+0x90, 0x58, 0x9c, 0x56, 0xa7, 0x54, 0xb3, 0x53, 0xbf, 0x51, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x56, 0x15, 0x57, 0x21, 0x58, 0x2d, 0x5a, 
+0x38, 0x5b, 0x44, 0x5d, 0x50, 0x5f, 0x5b, 0x62, 0x66, 0x64, 0x71, 0x67, 0x7c, 0x6b, 0x87, 0x6f, 
+0x91, 0x74, 0x9a, 0x7b, 0xa2, 0x83, 0xa9, 0x8d, 0xac, 0x9a, 0xaa, 0xaa, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x8e, 0x12, 0x78, 0x1c, 0x6b, 0x27, 0x63, 0x32, 0x5e, 
+0x3c, 0x5b, 0x46, 0x59, 0x50, 0x58, 0x5a, 0x57, 0x64, 0x57, 0x6f, 0x57, 0x79, 0x57, 0x84, 0x57, 
+0x8f, 0x58, 0x9a, 0x5a, 0xa6, 0x58, 0xb2, 0x57, 0xbd, 0x56, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5b, 0x16, 0x5b, 0x22, 0x5c, 0x2e, 0x5d, 
+0x3a, 0x5e, 0x46, 0x60, 0x51, 0x61, 0x5d, 0x62, 0x69, 0x64, 0x74, 0x67, 0x80, 0x69, 0x8b, 0x6c, 
+0x96, 0x70, 0xa0, 0x75, 0xaa, 0x7b, 0xb3, 0x83, 0xba, 0x8f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x08, 0x5d, 0x19, 0x57, 0x26, 0x53, 0x32, 0x52, 
+0x3d, 0x51, 0x47, 0x51, 0x51, 0x51, 0x5a, 0x51, 0x64, 0x51, 0x6e, 0x52, 0x78, 0x53, 0x83, 0x53, 
+0x8f, 0x54, 0x9a, 0x55, 0xa5, 0x5c, 0xb1, 0x5b, 0xbc, 0x5b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5f, 0x17, 0x5f, 0x23, 0x60, 0x2f, 0x60, 
+0x3b, 0x61, 0x47, 0x62, 0x52, 0x62, 0x5e, 0x63, 0x6a, 0x64, 0x76, 0x65, 0x82, 0x67, 0x8d, 0x68, 
+0x99, 0x6a, 0xa5, 0x6d, 0xb0, 0x70, 0xbb, 0x75, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x06, 0x45, 0x1b, 0x46, 0x2a, 0x48, 0x36, 0x49, 
+0x40, 0x4a, 0x4a, 0x4b, 0x53, 0x4c, 0x5c, 0x4d, 0x65, 0x4e, 0x6e, 0x4f, 0x78, 0x50, 0x82, 0x51, 
+0x8d, 0x52, 0x99, 0x53, 0xa5, 0x55, 0xb0, 0x57, 0xbc, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x64, 0x17, 0x64, 0x23, 0x64, 0x2f, 0x64, 
+0x3b, 0x64, 0x47, 0x64, 0x53, 0x64, 0x5f, 0x64, 0x6b, 0x64, 0x77, 0x64, 0x82, 0x64, 0x8e, 0x64, 
+0x9a, 0x64, 0xa6, 0x64, 0xb2, 0x64, 0xbe, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x59, 0x54, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x36, 0x0e, 0x35, 0x22, 0x3c, 0x30, 0x40, 0x3b, 0x44, 
+0x44, 0x46, 0x4d, 0x49, 0x55, 0x4a, 0x5d, 0x4c, 0x66, 0x4d, 0x6e, 0x4e, 0x77, 0x4f, 0x81, 0x50, 
+0x8c, 0x51, 0x98, 0x53, 0xa4, 0x54, 0xb0, 0x56, 0xbc, 0x58, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x6f, 0x17, 0x6f, 0x23, 0x6f, 0x2f, 0x6f, 
+0x3b, 0x6f, 0x47, 0x6f, 0x53, 0x6f, 0x5f, 0x6f, 0x6b, 0x6f, 0x77, 0x6f, 0x82, 0x6f, 0x8e, 0x6f, 
+0x9a, 0x6f, 0xa6, 0x6f, 0xb2, 0x6f, 0xbe, 0x6f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x15, 0x28, 0x19, 0x2b, 0x2b, 0x37, 0x37, 0x3e, 0x41, 0x42, 
+0x49, 0x45, 0x51, 0x48, 0x58, 0x4a, 0x5f, 0x4c, 0x67, 0x4d, 0x6f, 0x4f, 0x77, 0x50, 0x81, 0x51, 
+0x8b, 0x52, 0x97, 0x53, 0xa3, 0x54, 0xaf, 0x56, 0xbc, 0x58, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x7b, 0x17, 0x7b, 0x23, 0x7b, 0x2f, 0x7b, 
+0x3b, 0x7b, 0x47, 0x7b, 0x53, 0x7b, 0x5f, 0x7b, 0x6b, 0x7b, 0x77, 0x7b, 0x82, 0x7b, 0x8e, 0x7b, 
+0x9a, 0x7b, 0xa6, 0x7b, 0xb2, 0x7b, 0xbd, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x0f, 0x2f, 0x15, 0x2e, 0x24, 0x33, 0x34, 0x3a, 0x3e, 0x3e, 0x47, 0x43, 
+0x4e, 0x46, 0x54, 0x49, 0x5b, 0x4b, 0x61, 0x4d, 0x68, 0x4f, 0x6f, 0x50, 0x77, 0x51, 0x80, 0x52, 
+0x8a, 0x53, 0x95, 0x54, 0xa1, 0x55, 0xaf, 0x57, 0xbc, 0x59, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x87, 0x17, 0x87, 0x23, 0x87, 0x2f, 0x87, 
+0x3b, 0x87, 0x47, 0x87, 0x53, 0x87, 0x5f, 0x87, 0x6b, 0x87, 0x77, 0x87, 0x82, 0x87, 0x8e, 0x87, 
+0x9a, 0x87, 0xa6, 0x87, 0xb1, 0x87, 0xbd, 0x80, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x34, 0x16, 0x35, 0x2a, 0x3d, 0x38, 0x43, 0x42, 0x46, 0x4a, 0x48, 
+0x51, 0x4a, 0x58, 0x4b, 0x5e, 0x4d, 0x63, 0x4f, 0x69, 0x51, 0x70, 0x52, 0x77, 0x53, 0x80, 0x54, 
+0x89, 0x55, 0x94, 0x56, 0xa0, 0x57, 0xae, 0x59, 0xbc, 0x5a, 0xc7, 0x5d, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x93, 0x23, 0x93, 0x2f, 0x93, 
+0x3b, 0x93, 0x47, 0x93, 0x53, 0x93, 0x5f, 0x93, 0x6b, 0x93, 0x77, 0x93, 0x82, 0x93, 0x8e, 0x93, 
+0x9a, 0x93, 0xa6, 0x93, 0xaf, 0x91, 0xbe, 0x8f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x08, 0x3b, 0x0e, 0x3b, 0x1a, 0x3d, 0x2f, 0x45, 0x3c, 0x4a, 0x46, 0x4d, 0x4d, 0x4f, 
+0x54, 0x50, 0x5a, 0x51, 0x5f, 0x52, 0x65, 0x53, 0x6b, 0x53, 0x71, 0x54, 0x78, 0x55, 0x7f, 0x56, 
+0x88, 0x57, 0x93, 0x58, 0x9f, 0x59, 0xad, 0x5b, 0xbc, 0x5d, 0xc7, 0x5f, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x9f, 0x23, 0x9f, 0x2f, 0x9f, 
+0x3b, 0x9f, 0x47, 0x9f, 0x53, 0x9f, 0x5f, 0x9f, 0x6b, 0x9f, 0x77, 0x9f, 0x82, 0x9f, 0x8e, 0x9f, 
+0x9a, 0x9f, 0xa4, 0x9f, 0xad, 0xa1, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x08, 0x41, 0x10, 0x42, 0x1d, 0x45, 0x33, 0x4c, 0x42, 0x51, 0x4b, 0x54, 0x52, 0x56, 
+0x57, 0x57, 0x5c, 0x58, 0x61, 0x59, 0x65, 0x59, 0x6b, 0x58, 0x71, 0x58, 0x77, 0x59, 0x7f, 0x59, 
+0x88, 0x5a, 0x92, 0x5b, 0x9e, 0x5c, 0xad, 0x5d, 0xbd, 0x5f, 0xc7, 0x62, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xab, 0x2f, 0xab, 
+0x3b, 0xab, 0x47, 0xab, 0x53, 0xab, 0x5f, 0xab, 0x6b, 0xab, 0x77, 0xab, 0x82, 0xab, 0x8e, 0xab, 
+0x9a, 0xab, 0xa0, 0xae, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x03, 0x48, 0x08, 0x48, 0x12, 0x49, 0x21, 0x4c, 0x3a, 0x54, 0x47, 0x57, 0x4e, 0x59, 0x54, 0x5a, 
+0x58, 0x5b, 0x5d, 0x5c, 0x61, 0x5c, 0x66, 0x5d, 0x6a, 0x5d, 0x70, 0x5e, 0x77, 0x5d, 0x7e, 0x5e, 
+0x87, 0x5e, 0x92, 0x5f, 0x9e, 0x5f, 0xad, 0x61, 0xc0, 0x63, 0xc7, 0x65, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2f, 0xb7, 
+0x3b, 0xb7, 0x47, 0xb7, 0x53, 0xb7, 0x5f, 0xb7, 0x6b, 0xb7, 0x77, 0xb7, 0x82, 0xb7, 0x8e, 0xb7, 
+0x95, 0xba, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x02, 0x4e, 0x08, 0x4e, 0x14, 0x50, 0x2d, 0x55, 0x3a, 0x58, 0x48, 0x5b, 0x4f, 0x5d, 0x55, 0x5e, 
+0x59, 0x5e, 0x5e, 0x5f, 0x62, 0x60, 0x66, 0x60, 0x6b, 0x61, 0x6f, 0x61, 0x75, 0x62, 0x7e, 0x62, 
+0x87, 0x63, 0x91, 0x64, 0x9e, 0x65, 0xae, 0x66, 0xc4, 0x68, 0xc7, 0x69, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x47, 0xc3, 0x53, 0xc3, 0x5f, 0xc3, 0x6b, 0xc3, 0x77, 0xc3, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x02, 0x54, 0x09, 0x55, 0x20, 0x59, 0x30, 0x5b, 0x3c, 0x5d, 0x48, 0x5f, 0x50, 0x60, 0x55, 0x61, 
+0x5a, 0x61, 0x5e, 0x62, 0x63, 0x63, 0x67, 0x63, 0x6b, 0x64, 0x70, 0x64, 0x75, 0x65, 0x7c, 0x66, 
+0x87, 0x67, 0x92, 0x69, 0x9f, 0x6a, 0xb2, 0x6d, 0xc4, 0x6f, 0xc7, 0x70, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x02, 0x58, 0x0f, 0x5c, 0x23, 0x5f, 0x31, 0x60, 0x3c, 0x62, 0x46, 0x62, 0x50, 0x63, 0x56, 0x64, 
+0x5b, 0x65, 0x5f, 0x65, 0x63, 0x66, 0x67, 0x66, 0x6c, 0x67, 0x70, 0x68, 0x75, 0x68, 0x7c, 0x69, 
+0x88, 0x6c, 0x93, 0x6e, 0xa2, 0x70, 0xba, 0x75, 0xc4, 0x76, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x02, 0x5a, 0x15, 0x5e, 0x24, 0x62, 0x31, 0x65, 0x3c, 0x66, 0x46, 0x67, 0x4d, 0x67, 0x56, 0x67, 
+0x5b, 0x68, 0x5f, 0x68, 0x64, 0x69, 0x68, 0x69, 0x6c, 0x6a, 0x71, 0x6b, 0x76, 0x6c, 0x7d, 0x6d, 
+0x86, 0x6f, 0x97, 0x74, 0xae, 0x79, 0xbc, 0x7c, 0xc3, 0x7c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x07, 0x5b, 0x18, 0x60, 0x26, 0x64, 0x32, 0x67, 0x3d, 0x69, 0x45, 0x6b, 0x4d, 0x6c, 0x54, 0x6c, 
+0x5b, 0x6c, 0x60, 0x6c, 0x64, 0x6c, 0x69, 0x6d, 0x6d, 0x6e, 0x72, 0x6e, 0x78, 0x70, 0x7f, 0x71, 
+0x89, 0x74, 0xa2, 0x7d, 0xb1, 0x80, 0xbd, 0x83, 0xc2, 0x83, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x56, 
+0x0c, 0x5b, 0x1a, 0x60, 0x27, 0x65, 0x33, 0x68, 0x3d, 0x6b, 0x46, 0x6d, 0x4d, 0x6f, 0x54, 0x71, 
+0x5a, 0x71, 0x60, 0x72, 0x65, 0x71, 0x6a, 0x71, 0x6f, 0x72, 0x75, 0x73, 0x7c, 0x76, 0x85, 0x79, 
+0x90, 0x7c, 0xa6, 0x85, 0xb4, 0x88, 0xbd, 0x89, 0xc1, 0x88, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x54, 
+0x10, 0x5b, 0x1d, 0x60, 0x29, 0x65, 0x34, 0x69, 0x3e, 0x6c, 0x47, 0x6f, 0x4e, 0x71, 0x55, 0x73, 
+0x5b, 0x75, 0x60, 0x77, 0x66, 0x77, 0x6c, 0x78, 0x72, 0x79, 0x78, 0x7b, 0x80, 0x7d, 0x88, 0x7f, 
+0x94, 0x83, 0xaa, 0x8d, 0xb6, 0x8f, 0xbd, 0x8f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x52, 
+0x14, 0x59, 0x1f, 0x5f, 0x2b, 0x65, 0x36, 0x69, 0x40, 0x6d, 0x48, 0x70, 0x50, 0x73, 0x57, 0x75, 
+0x5d, 0x78, 0x63, 0x7a, 0x68, 0x7c, 0x6e, 0x7e, 0x74, 0x80, 0x7b, 0x81, 0x83, 0x84, 0x8d, 0x87, 
+0x99, 0x8c, 0xae, 0x95, 0xb7, 0x96, 0xbb, 0x94, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x0f, 0x4e, 
+0x18, 0x56, 0x23, 0x5d, 0x2e, 0x63, 0x38, 0x69, 0x42, 0x6e, 0x4a, 0x71, 0x52, 0x75, 0x59, 0x78, 
+0x60, 0x7a, 0x66, 0x7d, 0x6c, 0x80, 0x72, 0x82, 0x78, 0x86, 0x7f, 0x89, 0x87, 0x8c, 0x91, 0x90, 
+0x9f, 0x95, 0xb0, 0x9d, 0xb6, 0x9c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 
+0x1e, 0x51, 0x27, 0x59, 0x31, 0x61, 0x3b, 0x67, 0x45, 0x6d, 0x4d, 0x72, 0x55, 0x76, 0x5c, 0x7a, 
+0x63, 0x7d, 0x6a, 0x80, 0x70, 0x83, 0x77, 0x87, 0x7d, 0x8b, 0x85, 0x8f, 0x8d, 0x94, 0x97, 0x9a, 
+0xa6, 0xa1, 0xb0, 0xa3, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 
+0x28, 0x46, 0x2e, 0x54, 0x37, 0x5d, 0x40, 0x64, 0x49, 0x6b, 0x51, 0x71, 0x59, 0x76, 0x61, 0x7b, 
+0x68, 0x7f, 0x6f, 0x83, 0x76, 0x87, 0x7d, 0x8b, 0x84, 0x8f, 0x8c, 0x94, 0x95, 0x9a, 0xa0, 0xa0, 
+0xab, 0xa8, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 
+0x2d, 0x48, 0x37, 0x4d, 0x3e, 0x56, 0x46, 0x5f, 0x4f, 0x67, 0x57, 0x6f, 0x5f, 0x75, 0x67, 0x7b, 
+0x6e, 0x80, 0x75, 0x85, 0x7c, 0x8a, 0x84, 0x8f, 0x8c, 0x94, 0x94, 0x99, 0x9d, 0x9f, 0xa9, 0xa7, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 
+0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x56, 0x61, 0x5e, 0x6a, 0x66, 0x72, 0x6e, 0x79, 
+0x75, 0x80, 0x7d, 0x86, 0x84, 0x8c, 0x8c, 0x91, 0x94, 0x97, 0x9d, 0x9d, 0xa6, 0xa3, 0xad, 0xa7, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 
+0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x6f, 0x6c, 0x76, 0x75, 
+0x7e, 0x7d, 0x85, 0x84, 0x8d, 0x8b, 0x95, 0x92, 0x9d, 0x98, 0xa5, 0x9e, 0xae, 0xa4, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 
+0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 
+0x88, 0x76, 0x8f, 0x80, 0x96, 0x88, 0x9e, 0x90, 0xa6, 0x97, 0xad, 0x9d, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 
+0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 
+0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 
+0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 
+0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 
+0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 
+0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 
+0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 
+0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 
+0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 
+0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 
+0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 
+0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 
+0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 
+0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 
+0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 
+0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 
+0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 
+0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 
+0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 
+0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 
+0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 
+0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 
+0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 
+0x24, 0x44, 0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 
+0x70, 0x6a, 0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 
+0xbc, 0x90, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 
+0x28, 0x46, 0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 
+0x75, 0x6c, 0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 
+0x2d, 0x48, 0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 
+0x79, 0x6e, 0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 
+0x32, 0x4b, 0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 
+0x7e, 0x71, 0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3a, 0x1a, 0x3f, 0x24, 0x44, 0x2d, 0x48, 
+0x37, 0x4d, 0x40, 0x52, 0x4a, 0x57, 0x53, 0x5b, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x79, 0x6e, 
+0x83, 0x73, 0x8c, 0x78, 0x96, 0x7d, 0xa0, 0x81, 0xa9, 0x86, 0xb3, 0x8b, 0xbc, 0x90, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x38, 0x15, 0x3c, 0x1f, 0x41, 0x28, 0x46, 0x32, 0x4b, 
+0x3b, 0x50, 0x45, 0x54, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x71, 
+0x88, 0x76, 0x91, 0x7a, 0x9b, 0x7f, 0xa4, 0x84, 0xae, 0x89, 0xb7, 0x8d, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1d, 0x27, 0x25, 0x2e, 0x2c, 0x35, 0x33, 0x3c, 0x3b, 0x42, 
+0x43, 0x48, 0x4c, 0x4e, 0x54, 0x53, 0x5d, 0x58, 0x66, 0x5c, 0x6f, 0x60, 0x78, 0x64, 0x81, 0x67, 
+0x8a, 0x69, 0x94, 0x6c, 0x9e, 0x6e, 0xa9, 0x6f, 0xb5, 0x71, 0xc5, 0x71, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x1d, 0x21, 0x26, 0x27, 0x2e, 0x2e, 0x34, 0x35, 0x3b, 0x3b, 0x43, 0x40, 
+0x4a, 0x46, 0x52, 0x4a, 0x5a, 0x4f, 0x62, 0x53, 0x6a, 0x56, 0x72, 0x59, 0x7a, 0x5c, 0x83, 0x5e, 
+0x8b, 0x60, 0x94, 0x61, 0x9e, 0x62, 0xaa, 0x62, 0xb9, 0x61, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1d, 0x1d, 0x26, 0x24, 0x2f, 0x2a, 0x36, 0x30, 0x3d, 0x37, 0x43, 0x3c, 0x4a, 0x41, 
+0x51, 0x45, 0x58, 0x49, 0x5f, 0x4d, 0x66, 0x50, 0x6d, 0x52, 0x74, 0x55, 0x7b, 0x56, 0x83, 0x58, 
+0x8a, 0x59, 0x93, 0x59, 0x9d, 0x58, 0xa9, 0x57, 0xbe, 0x53, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x1c, 0x1d, 0x23, 0x21, 0x2f, 0x29, 0x38, 0x2f, 0x3f, 0x34, 0x44, 0x3a, 0x4a, 0x3e, 0x50, 0x43, 
+0x56, 0x46, 0x5c, 0x4a, 0x62, 0x4c, 0x68, 0x4f, 0x6f, 0x51, 0x75, 0x52, 0x7b, 0x53, 0x82, 0x54, 
+0x89, 0x54, 0x91, 0x53, 0x9a, 0x52, 0xa8, 0x4e, 0xc0, 0x47, 0xc2, 0x44, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x1f, 
+0x1f, 0x1e, 0x2d, 0x28, 0x37, 0x2f, 0x40, 0x34, 0x46, 0x39, 0x4b, 0x3e, 0x50, 0x42, 0x55, 0x45, 
+0x5b, 0x48, 0x60, 0x4b, 0x65, 0x4d, 0x6a, 0x4f, 0x70, 0x50, 0x75, 0x51, 0x7b, 0x52, 0x80, 0x52, 
+0x87, 0x51, 0x8e, 0x50, 0x97, 0x4d, 0xab, 0x46, 0xba, 0x3e, 0xbe, 0x3b, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x19, 0x20, 0x1e, 0x20, 
+0x29, 0x26, 0x35, 0x2f, 0x3f, 0x35, 0x46, 0x3a, 0x4c, 0x3e, 0x50, 0x42, 0x55, 0x46, 0x59, 0x48, 
+0x5e, 0x4b, 0x63, 0x4d, 0x67, 0x4f, 0x6c, 0x50, 0x70, 0x51, 0x75, 0x52, 0x7a, 0x52, 0x7f, 0x51, 
+0x84, 0x50, 0x8b, 0x4e, 0x95, 0x4a, 0xab, 0x3f, 0xb4, 0x3a, 0xb9, 0x34, 0xb9, 0x30, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x23, 0x1b, 0x22, 0x22, 0x24, 
+0x32, 0x30, 0x3d, 0x37, 0x45, 0x3c, 0x4c, 0x40, 0x51, 0x43, 0x55, 0x47, 0x59, 0x49, 0x5d, 0x4c, 
+0x61, 0x4e, 0x65, 0x4f, 0x69, 0x51, 0x6d, 0x52, 0x71, 0x52, 0x74, 0x53, 0x79, 0x52, 0x7d, 0x52, 
+0x82, 0x51, 0x88, 0x4e, 0x96, 0x47, 0xa5, 0x3e, 0xad, 0x37, 0xb3, 0x31, 0xb4, 0x2a, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x26, 0x18, 0x25, 0x1f, 0x27, 0x2d, 0x2f, 
+0x3a, 0x38, 0x43, 0x3e, 0x4a, 0x42, 0x51, 0x45, 0x55, 0x48, 0x58, 0x4b, 0x5c, 0x4d, 0x5f, 0x4f, 
+0x63, 0x51, 0x66, 0x52, 0x6a, 0x53, 0x6d, 0x54, 0x70, 0x54, 0x74, 0x54, 0x77, 0x54, 0x7b, 0x53, 
+0x80, 0x51, 0x86, 0x4e, 0x96, 0x45, 0x9e, 0x3f, 0xa6, 0x38, 0xac, 0x30, 0xae, 0x27, 0xac, 0x20, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x14, 0x28, 0x1b, 0x2a, 0x24, 0x2d, 0x36, 0x39, 
+0x41, 0x3f, 0x48, 0x44, 0x4f, 0x47, 0x54, 0x4a, 0x58, 0x4c, 0x5b, 0x4e, 0x5e, 0x50, 0x61, 0x52, 
+0x64, 0x53, 0x67, 0x54, 0x6a, 0x55, 0x6d, 0x55, 0x70, 0x56, 0x73, 0x56, 0x76, 0x55, 0x7a, 0x54, 
+0x7e, 0x53, 0x86, 0x4e, 0x90, 0x47, 0x98, 0x42, 0x9e, 0x3a, 0xa4, 0x32, 0xa7, 0x28, 0xa5, 0x1e, 
+0x9f, 0x15, 0x95, 0x0d, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x11, 0x2c, 0x16, 0x2d, 0x1f, 0x30, 0x30, 0x39, 0x3d, 0x41, 
+0x47, 0x47, 0x4f, 0x4c, 0x54, 0x4e, 0x59, 0x50, 0x5c, 0x52, 0x5e, 0x54, 0x61, 0x55, 0x63, 0x56, 
+0x65, 0x57, 0x68, 0x58, 0x6a, 0x59, 0x6c, 0x59, 0x6f, 0x59, 0x71, 0x59, 0x73, 0x59, 0x76, 0x58, 
+0x79, 0x56, 0x80, 0x52, 0x84, 0x4f, 0x88, 0x4b, 0x8c, 0x46, 0x90, 0x3f, 0x92, 0x37, 0x91, 0x2e, 
+0x8e, 0x23, 0x86, 0x19, 0x7a, 0x10, 0x64, 0x09, 0x64, 0x09, 0x68, 0x09, 0x74, 0x09, 0x80, 0x09, 
+0x8c, 0x09, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x0d, 0x31, 0x11, 0x30, 0x1a, 0x32, 0x25, 0x37, 0x38, 0x42, 0x46, 0x4a, 
+0x4d, 0x4e, 0x52, 0x50, 0x57, 0x52, 0x5b, 0x54, 0x5e, 0x55, 0x60, 0x57, 0x62, 0x58, 0x64, 0x59, 
+0x66, 0x59, 0x68, 0x5a, 0x6a, 0x5a, 0x6c, 0x5b, 0x6e, 0x5b, 0x70, 0x5b, 0x72, 0x5a, 0x75, 0x59, 
+0x79, 0x57, 0x7d, 0x55, 0x81, 0x52, 0x84, 0x4f, 0x87, 0x4a, 0x89, 0x44, 0x89, 0x3d, 0x88, 0x35, 
+0x83, 0x2b, 0x7b, 0x22, 0x6f, 0x1a, 0x64, 0x15, 0x64, 0x15, 0x68, 0x15, 0x74, 0x15, 0x80, 0x15, 
+0x8c, 0x15, 0x98, 0x15, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0d, 0x34, 0x13, 0x35, 0x1e, 0x39, 0x30, 0x41, 0x42, 0x4b, 0x4a, 0x4f, 
+0x50, 0x51, 0x54, 0x53, 0x59, 0x55, 0x5c, 0x56, 0x5f, 0x58, 0x61, 0x59, 0x63, 0x5a, 0x65, 0x5b, 
+0x67, 0x5b, 0x69, 0x5c, 0x6b, 0x5c, 0x6c, 0x5c, 0x6e, 0x5c, 0x70, 0x5c, 0x72, 0x5c, 0x74, 0x5b, 
+0x79, 0x59, 0x7c, 0x57, 0x7e, 0x55, 0x81, 0x52, 0x83, 0x4e, 0x84, 0x49, 0x83, 0x42, 0x81, 0x3a, 
+0x7b, 0x32, 0x72, 0x29, 0x64, 0x21, 0x64, 0x21, 0x64, 0x21, 0x68, 0x21, 0x74, 0x21, 0x80, 0x21, 
+0x8c, 0x21, 0x98, 0x21, 0xa4, 0x21, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x08, 0x3b, 0x0d, 0x39, 0x17, 0x3b, 0x24, 0x40, 0x3c, 0x4c, 0x46, 0x50, 0x4c, 0x53, 
+0x52, 0x55, 0x56, 0x56, 0x5a, 0x58, 0x5e, 0x59, 0x60, 0x5a, 0x62, 0x5b, 0x64, 0x5c, 0x66, 0x5c, 
+0x68, 0x5d, 0x69, 0x5d, 0x6b, 0x5e, 0x6d, 0x5e, 0x6e, 0x5e, 0x70, 0x5e, 0x72, 0x5e, 0x75, 0x5d, 
+0x78, 0x5b, 0x7b, 0x5a, 0x7d, 0x58, 0x7f, 0x55, 0x80, 0x52, 0x80, 0x4d, 0x7e, 0x47, 0x7a, 0x40, 
+0x74, 0x38, 0x6a, 0x31, 0x64, 0x2d, 0x64, 0x2d, 0x64, 0x2d, 0x68, 0x2d, 0x74, 0x2d, 0x80, 0x2d, 
+0x8c, 0x2d, 0x98, 0x2d, 0xa4, 0x2d, 0xb0, 0x2d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x06, 0x43, 0x0d, 0x42, 0x1a, 0x44, 0x32, 0x4b, 0x41, 0x51, 0x49, 0x54, 0x4e, 0x56, 
+0x53, 0x57, 0x57, 0x59, 0x5b, 0x5a, 0x5f, 0x5b, 0x61, 0x5c, 0x63, 0x5d, 0x65, 0x5e, 0x67, 0x5e, 
+0x68, 0x5f, 0x6a, 0x5f, 0x6b, 0x60, 0x6d, 0x60, 0x6e, 0x60, 0x70, 0x60, 0x72, 0x60, 0x76, 0x5f, 
+0x78, 0x5e, 0x7a, 0x5d, 0x7b, 0x5b, 0x7d, 0x59, 0x7d, 0x56, 0x7c, 0x52, 0x7a, 0x4c, 0x75, 0x46, 
+0x6d, 0x3f, 0x64, 0x39, 0x64, 0x39, 0x64, 0x39, 0x64, 0x39, 0x68, 0x39, 0x74, 0x39, 0x80, 0x39, 
+0x8c, 0x39, 0x98, 0x39, 0xa4, 0x39, 0xb0, 0x39, 0xbc, 0x39, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x04, 0x4c, 0x0e, 0x4c, 0x1c, 0x4d, 0x38, 0x54, 0x43, 0x56, 0x4b, 0x57, 0x50, 0x59, 
+0x54, 0x5a, 0x59, 0x5b, 0x5c, 0x5c, 0x60, 0x5d, 0x62, 0x5e, 0x64, 0x5f, 0x66, 0x60, 0x67, 0x60, 
+0x69, 0x61, 0x6a, 0x61, 0x6c, 0x62, 0x6d, 0x62, 0x6e, 0x62, 0x70, 0x62, 0x73, 0x62, 0x75, 0x62, 
+0x77, 0x61, 0x79, 0x61, 0x7a, 0x5f, 0x7b, 0x5e, 0x7b, 0x5b, 0x79, 0x57, 0x76, 0x52, 0x6f, 0x4d, 
+0x67, 0x46, 0x64, 0x45, 0x64, 0x45, 0x64, 0x45, 0x64, 0x45, 0x68, 0x45, 0x74, 0x45, 0x80, 0x45, 
+0x8c, 0x45, 0x98, 0x45, 0xa4, 0x45, 0xb0, 0x45, 0xbc, 0x45, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x56, 0x04, 0x55, 0x0f, 0x55, 0x1e, 0x56, 0x3a, 0x5b, 0x44, 0x5c, 0x4b, 0x5c, 0x51, 0x5d, 
+0x56, 0x5d, 0x5a, 0x5e, 0x5d, 0x5f, 0x61, 0x60, 0x63, 0x60, 0x65, 0x61, 0x66, 0x62, 0x68, 0x62, 
+0x69, 0x63, 0x6b, 0x63, 0x6c, 0x64, 0x6d, 0x64, 0x6f, 0x65, 0x70, 0x65, 0x74, 0x65, 0x75, 0x65, 
+0x77, 0x65, 0x78, 0x65, 0x79, 0x64, 0x7a, 0x63, 0x79, 0x61, 0x76, 0x5e, 0x71, 0x5a, 0x6a, 0x55, 
+0x64, 0x50, 0x64, 0x50, 0x64, 0x50, 0x64, 0x50, 0x64, 0x50, 0x68, 0x50, 0x74, 0x50, 0x80, 0x50, 
+0x8c, 0x50, 0x98, 0x50, 0xa4, 0x50, 0xb0, 0x50, 0xbc, 0x50, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x5e, 0x04, 0x5e, 0x0f, 0x5e, 0x1f, 0x5f, 0x3b, 0x60, 0x45, 0x61, 0x4b, 0x61, 0x51, 0x61, 
+0x56, 0x61, 0x5a, 0x61, 0x5e, 0x61, 0x62, 0x62, 0x64, 0x63, 0x65, 0x63, 0x67, 0x64, 0x68, 0x65, 
+0x6a, 0x65, 0x6b, 0x66, 0x6c, 0x66, 0x6d, 0x67, 0x6f, 0x67, 0x71, 0x68, 0x74, 0x69, 0x75, 0x6a, 
+0x77, 0x6a, 0x78, 0x6a, 0x78, 0x6a, 0x78, 0x69, 0x76, 0x68, 0x73, 0x65, 0x6d, 0x62, 0x65, 0x5d, 
+0x64, 0x5c, 0x64, 0x5c, 0x64, 0x5c, 0x64, 0x5c, 0x64, 0x5c, 0x68, 0x5c, 0x74, 0x5c, 0x80, 0x5c, 
+0x8c, 0x5c, 0x98, 0x5c, 0xa4, 0x5c, 0xb0, 0x5c, 0xbc, 0x5c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x67, 0x04, 0x67, 0x0f, 0x67, 0x1f, 0x67, 0x3b, 0x66, 0x45, 0x65, 0x4c, 0x65, 0x51, 0x65, 
+0x56, 0x65, 0x5a, 0x65, 0x5e, 0x65, 0x62, 0x65, 0x65, 0x65, 0x66, 0x66, 0x68, 0x66, 0x69, 0x67, 
+0x6a, 0x68, 0x6b, 0x68, 0x6d, 0x69, 0x6e, 0x6a, 0x70, 0x6b, 0x73, 0x6d, 0x74, 0x6e, 0x76, 0x6f, 
+0x77, 0x6f, 0x78, 0x70, 0x78, 0x71, 0x77, 0x70, 0x74, 0x70, 0x70, 0x6e, 0x69, 0x6b, 0x64, 0x68, 
+0x64, 0x68, 0x64, 0x68, 0x64, 0x68, 0x64, 0x68, 0x64, 0x68, 0x68, 0x68, 0x74, 0x68, 0x80, 0x68, 
+0x8c, 0x68, 0x98, 0x68, 0xa4, 0x68, 0xb0, 0x68, 0xbc, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x70, 0x04, 0x70, 0x0f, 0x70, 0x1e, 0x6f, 0x3b, 0x6b, 0x44, 0x6a, 0x4b, 0x6a, 0x51, 0x69, 
+0x56, 0x69, 0x5a, 0x69, 0x5e, 0x69, 0x62, 0x69, 0x65, 0x69, 0x66, 0x69, 0x68, 0x69, 0x6a, 0x6a, 
+0x6b, 0x6a, 0x6c, 0x6b, 0x6d, 0x6c, 0x6f, 0x6d, 0x71, 0x6f, 0x73, 0x71, 0x75, 0x73, 0x76, 0x74, 
+0x77, 0x76, 0x78, 0x77, 0x77, 0x78, 0x76, 0x79, 0x73, 0x79, 0x6d, 0x78, 0x65, 0x75, 0x64, 0x74, 
+0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x64, 0x74, 0x68, 0x74, 0x74, 0x74, 0x80, 0x74, 
+0x8c, 0x74, 0x98, 0x74, 0xa4, 0x74, 0xb0, 0x74, 0xbc, 0x74, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x04, 0x79, 0x0e, 0x79, 0x1d, 0x78, 0x38, 0x71, 0x43, 0x70, 0x4b, 0x6f, 0x50, 0x6e, 
+0x55, 0x6e, 0x5a, 0x6d, 0x5e, 0x6d, 0x62, 0x6d, 0x65, 0x6d, 0x67, 0x6d, 0x68, 0x6d, 0x6a, 0x6d, 
+0x6c, 0x6e, 0x6d, 0x6e, 0x6e, 0x70, 0x70, 0x71, 0x73, 0x75, 0x75, 0x77, 0x76, 0x79, 0x77, 0x7b, 
+0x78, 0x7d, 0x78, 0x7f, 0x77, 0x81, 0x75, 0x82, 0x71, 0x83, 0x6a, 0x82, 0x64, 0x80, 0x64, 0x80, 
+0x64, 0x80, 0x64, 0x80, 0x64, 0x80, 0x64, 0x80, 0x64, 0x80, 0x68, 0x80, 0x74, 0x80, 0x80, 0x80, 
+0x8c, 0x80, 0x98, 0x80, 0xa4, 0x80, 0xb0, 0x80, 0xbc, 0x80, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x05, 0x82, 0x0d, 0x83, 0x1a, 0x81, 0x34, 0x7a, 0x42, 0x75, 0x4a, 0x74, 0x50, 0x73, 
+0x55, 0x72, 0x59, 0x72, 0x5e, 0x71, 0x62, 0x71, 0x65, 0x71, 0x67, 0x71, 0x68, 0x72, 0x6a, 0x72, 
+0x6c, 0x72, 0x6e, 0x73, 0x70, 0x74, 0x72, 0x77, 0x75, 0x7a, 0x76, 0x7d, 0x77, 0x7f, 0x79, 0x82, 
+0x79, 0x85, 0x79, 0x88, 0x77, 0x8b, 0x74, 0x8d, 0x6f, 0x8e, 0x68, 0x8d, 0x64, 0x8c, 0x64, 0x8c, 
+0x64, 0x8c, 0x64, 0x8c, 0x64, 0x8c, 0x64, 0x8c, 0x64, 0x8c, 0x68, 0x8c, 0x74, 0x8c, 0x80, 0x8c, 
+0x8c, 0x8c, 0x98, 0x8c, 0xa4, 0x8c, 0xb0, 0x8c, 0xbc, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x08, 0x8a, 0x0d, 0x8c, 0x18, 0x8b, 0x26, 0x88, 0x3e, 0x7d, 0x48, 0x7a, 0x4f, 0x78, 
+0x54, 0x77, 0x59, 0x77, 0x5e, 0x76, 0x62, 0x76, 0x65, 0x76, 0x67, 0x76, 0x69, 0x76, 0x6a, 0x77, 
+0x6c, 0x77, 0x6e, 0x78, 0x70, 0x7a, 0x74, 0x7e, 0x76, 0x80, 0x78, 0x84, 0x7a, 0x87, 0x7a, 0x8b, 
+0x7b, 0x8e, 0x7a, 0x92, 0x78, 0x95, 0x74, 0x98, 0x6e, 0x99, 0x64, 0x98, 0x64, 0x98, 0x64, 0x98, 
+0x64, 0x98, 0x64, 0x98, 0x64, 0x98, 0x64, 0x98, 0x64, 0x98, 0x68, 0x98, 0x74, 0x98, 0x80, 0x98, 
+0x8c, 0x98, 0x98, 0x98, 0xa4, 0x98, 0xb0, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x95, 0x16, 0x95, 0x22, 0x93, 0x33, 0x8c, 0x45, 0x82, 0x4d, 0x7f, 
+0x53, 0x7d, 0x58, 0x7c, 0x5d, 0x7c, 0x62, 0x7b, 0x65, 0x7b, 0x67, 0x7c, 0x69, 0x7c, 0x6b, 0x7d, 
+0x6d, 0x7e, 0x6f, 0x7f, 0x73, 0x84, 0x75, 0x87, 0x78, 0x89, 0x7a, 0x8d, 0x7c, 0x90, 0x7d, 0x94, 
+0x7d, 0x99, 0x7b, 0x9d, 0x78, 0xa1, 0x74, 0xa3, 0x6d, 0xa4, 0x64, 0xa4, 0x64, 0xa4, 0x64, 0xa4, 
+0x64, 0xa4, 0x64, 0xa4, 0x64, 0xa4, 0x64, 0xa4, 0x64, 0xa4, 0x68, 0xa4, 0x74, 0xa4, 0x80, 0xa4, 
+0x8c, 0xa4, 0x98, 0xa4, 0xa4, 0xa4, 0xb0, 0xa4, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x11, 0x9c, 0x16, 0x9e, 0x20, 0x9e, 0x2c, 0x9b, 0x3b, 0x94, 0x4a, 0x89, 
+0x52, 0x85, 0x57, 0x84, 0x5d, 0x83, 0x62, 0x82, 0x65, 0x82, 0x67, 0x82, 0x69, 0x83, 0x6c, 0x84, 
+0x6e, 0x86, 0x72, 0x8c, 0x74, 0x8e, 0x77, 0x91, 0x7a, 0x94, 0x7c, 0x98, 0x7e, 0x9c, 0x7f, 0xa0, 
+0x7f, 0xa4, 0x7d, 0xa9, 0x79, 0xac, 0x74, 0xaf, 0x64, 0xb0, 0x64, 0xb0, 0x64, 0xb0, 0x64, 0xb0, 
+0x64, 0xb0, 0x64, 0xb0, 0x64, 0xb0, 0x64, 0xb0, 0x64, 0xb0, 0x68, 0xb0, 0x74, 0xb0, 0x80, 0xb0, 
+0x8c, 0xb0, 0x98, 0xb0, 0xa4, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x19, 0xa5, 0x1f, 0xa8, 0x29, 0xa7, 0x34, 0xa5, 0x3f, 0xa1, 
+0x4d, 0x93, 0x56, 0x8f, 0x5c, 0x8c, 0x61, 0x8c, 0x65, 0x8c, 0x68, 0x8c, 0x6a, 0x8d, 0x6d, 0x90, 
+0x71, 0x96, 0x74, 0x98, 0x77, 0x9b, 0x79, 0x9f, 0x7c, 0xa2, 0x7e, 0xa6, 0x80, 0xaa, 0x81, 0xae, 
+0x80, 0xb2, 0x7f, 0xb6, 0x7b, 0xb8, 0x74, 0xba, 0x64, 0xbc, 0x64, 0xbc, 0x64, 0xbc, 0x64, 0xbc, 
+0x64, 0xbc, 0x64, 0xbc, 0x64, 0xbc, 0x64, 0xbc, 0x64, 0xbc, 0x68, 0xbc, 0x74, 0xbc, 0x80, 0xbc, 
+0x8c, 0xbc, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0xae, 0x29, 0xb1, 0x32, 0xb1, 0x3c, 0xaf, 
+0x46, 0xad, 0x4f, 0xaa, 0x58, 0xa9, 0x60, 0xa8, 0x66, 0xa8, 0x6a, 0xa8, 0x6d, 0xaa, 0x71, 0xac, 
+0x75, 0xae, 0x78, 0xb1, 0x7c, 0xb4, 0x7f, 0xb7, 0x81, 0xba, 0x83, 0xbd, 0x84, 0xbf, 0x84, 0xc1, 
+0x82, 0xc2, 0x7f, 0xc3, 0x7b, 0xc5, 0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 
+0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 0x64, 0xc7, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2b, 0xb6, 0x32, 0xb9, 0x3b, 0xba, 
+0x44, 0xba, 0x4e, 0xb9, 0x57, 0xb8, 0x60, 0xb8, 0x66, 0xb8, 0x6a, 0xb8, 0x6e, 0xb9, 0x72, 0xbb, 
+0x76, 0xbc, 0x79, 0xbe, 0x7c, 0xc0, 0x7f, 0xc1, 0x81, 0xc2, 0x82, 0xc3, 0x82, 0xc3, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3d, 0xbf, 
+0x45, 0xc2, 0x4e, 0xc3, 0x57, 0xc3, 0x60, 0xc3, 0x66, 0xc3, 0x6b, 0xc4, 0x6f, 0xc4, 0x72, 0xc4, 
+0x76, 0xc4, 0x79, 0xc5, 0x7b, 0xc5, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x57, 0xc7, 0x60, 0xc7, 0x66, 0xc7, 0x6a, 0xc7, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x49, 0x04, 0x4d, 0x06, 0x51, 0x08, 
+0x55, 0x09, 0x59, 0x0a, 0x5d, 0x0b, 0x61, 0x0b, 0x64, 0x0b, 0x68, 0x0b, 0x6c, 0x0b, 0x6f, 0x0a, 
+0x73, 0x08, 0x77, 0x07, 0x7c, 0x05, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x3d, 0x08, 0x42, 0x0a, 0x46, 0x0d, 0x4b, 0x0f, 0x4f, 0x11, 0x53, 0x13, 
+0x57, 0x15, 0x5a, 0x16, 0x5e, 0x17, 0x61, 0x17, 0x64, 0x17, 0x67, 0x17, 0x6b, 0x16, 0x6e, 0x15, 
+0x72, 0x14, 0x76, 0x12, 0x7a, 0x11, 0x7e, 0x0e, 0x82, 0x0c, 0x87, 0x09, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x35, 0x0c, 0x3a, 0x0f, 0x40, 0x12, 0x44, 0x15, 0x49, 0x18, 0x4d, 0x1a, 0x51, 0x1d, 0x55, 0x1f, 
+0x58, 0x20, 0x5b, 0x22, 0x5e, 0x23, 0x61, 0x23, 0x64, 0x23, 0x67, 0x23, 0x6a, 0x22, 0x6d, 0x21, 
+0x70, 0x20, 0x74, 0x1e, 0x78, 0x1c, 0x7c, 0x19, 0x80, 0x17, 0x84, 0x14, 0x89, 0x11, 0x8f, 0x0e, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2f, 0x14, 
+0x38, 0x16, 0x3e, 0x19, 0x43, 0x1d, 0x47, 0x20, 0x4c, 0x23, 0x50, 0x26, 0x53, 0x28, 0x57, 0x2a, 
+0x5a, 0x2c, 0x5c, 0x2d, 0x5f, 0x2e, 0x62, 0x2f, 0x64, 0x2f, 0x66, 0x2f, 0x69, 0x2e, 0x6c, 0x2d, 
+0x6f, 0x2b, 0x72, 0x29, 0x75, 0x27, 0x79, 0x24, 0x7d, 0x22, 0x81, 0x1f, 0x86, 0x1b, 0x8b, 0x18, 
+0x91, 0x14, 0x97, 0x11, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0x20, 0x2f, 0x20, 
+0x3b, 0x20, 0x41, 0x23, 0x46, 0x27, 0x4b, 0x2a, 0x4f, 0x2e, 0x52, 0x31, 0x56, 0x33, 0x59, 0x36, 
+0x5b, 0x38, 0x5e, 0x39, 0x60, 0x3a, 0x62, 0x3b, 0x64, 0x3b, 0x66, 0x3b, 0x68, 0x3a, 0x6a, 0x39, 
+0x6d, 0x37, 0x70, 0x35, 0x73, 0x32, 0x76, 0x2f, 0x7a, 0x2c, 0x7e, 0x29, 0x83, 0x26, 0x88, 0x22, 
+0x8d, 0x1e, 0x93, 0x1a, 0x9a, 0x17, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x2c, 0x23, 0x2c, 0x2f, 0x2c, 
+0x3b, 0x2c, 0x45, 0x2d, 0x4a, 0x31, 0x4e, 0x35, 0x52, 0x38, 0x55, 0x3b, 0x58, 0x3e, 0x5b, 0x41, 
+0x5d, 0x43, 0x5f, 0x45, 0x61, 0x46, 0x62, 0x47, 0x64, 0x47, 0x65, 0x47, 0x67, 0x46, 0x69, 0x44, 
+0x6b, 0x42, 0x6d, 0x40, 0x70, 0x3d, 0x73, 0x3a, 0x77, 0x37, 0x7b, 0x33, 0x7f, 0x30, 0x84, 0x2c, 
+0x89, 0x28, 0x8f, 0x24, 0x96, 0x20, 0x9c, 0x1c, 0xa3, 0x18, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x38, 0x17, 0x38, 0x23, 0x38, 0x2f, 0x38, 
+0x3b, 0x38, 0x47, 0x38, 0x4e, 0x3b, 0x52, 0x3f, 0x55, 0x43, 0x59, 0x46, 0x5b, 0x49, 0x5d, 0x4c, 
+0x5f, 0x4f, 0x61, 0x51, 0x62, 0x52, 0x63, 0x53, 0x64, 0x53, 0x65, 0x52, 0x66, 0x51, 0x67, 0x50, 
+0x69, 0x4e, 0x6a, 0x4b, 0x6d, 0x48, 0x70, 0x45, 0x73, 0x41, 0x77, 0x3d, 0x7b, 0x39, 0x80, 0x35, 
+0x85, 0x31, 0x8b, 0x2d, 0x92, 0x29, 0x98, 0x24, 0x9f, 0x20, 0xa7, 0x1c, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x44, 0x17, 0x44, 0x23, 0x44, 0x2f, 0x44, 
+0x3b, 0x44, 0x47, 0x44, 0x52, 0x45, 0x56, 0x49, 0x59, 0x4d, 0x5c, 0x51, 0x5e, 0x54, 0x60, 0x57, 
+0x61, 0x5a, 0x62, 0x5c, 0x63, 0x5e, 0x63, 0x5f, 0x64, 0x5f, 0x64, 0x5e, 0x64, 0x5d, 0x65, 0x5b, 
+0x66, 0x59, 0x68, 0x56, 0x69, 0x53, 0x6c, 0x4f, 0x6f, 0x4b, 0x73, 0x47, 0x77, 0x43, 0x7c, 0x3e, 
+0x81, 0x3a, 0x87, 0x35, 0x8d, 0x31, 0x94, 0x2d, 0x9b, 0x28, 0xa3, 0x24, 0xab, 0x20, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x50, 0x17, 0x50, 0x23, 0x50, 0x2f, 0x50, 
+0x3b, 0x50, 0x47, 0x50, 0x53, 0x50, 0x5a, 0x52, 0x5d, 0x57, 0x60, 0x5b, 0x62, 0x5f, 0x63, 0x62, 
+0x64, 0x65, 0x64, 0x68, 0x64, 0x69, 0x64, 0x6a, 0x63, 0x6b, 0x63, 0x6a, 0x63, 0x69, 0x63, 0x67, 
+0x63, 0x64, 0x64, 0x61, 0x66, 0x5d, 0x68, 0x59, 0x6b, 0x55, 0x6e, 0x51, 0x72, 0x4c, 0x77, 0x47, 
+0x7c, 0x42, 0x82, 0x3e, 0x89, 0x39, 0x90, 0x34, 0x97, 0x30, 0x9f, 0x2c, 0xa7, 0x28, 0xaf, 0x24, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5c, 0x17, 0x5c, 0x23, 0x5c, 0x2f, 0x5c, 
+0x3b, 0x5c, 0x47, 0x5c, 0x53, 0x5c, 0x5f, 0x5c, 0x62, 0x60, 0x64, 0x65, 0x66, 0x69, 0x67, 0x6d, 
+0x67, 0x71, 0x66, 0x73, 0x66, 0x75, 0x64, 0x76, 0x63, 0x77, 0x62, 0x76, 0x61, 0x74, 0x60, 0x72, 
+0x60, 0x6f, 0x61, 0x6c, 0x62, 0x68, 0x64, 0x63, 0x66, 0x5f, 0x69, 0x5a, 0x6d, 0x55, 0x72, 0x50, 
+0x78, 0x4b, 0x7e, 0x46, 0x84, 0x41, 0x8b, 0x3c, 0x93, 0x37, 0x9a, 0x33, 0xa3, 0x2f, 0xab, 0x2b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x68, 0x17, 0x68, 0x23, 0x68, 0x2f, 0x68, 
+0x3b, 0x68, 0x47, 0x68, 0x53, 0x68, 0x5f, 0x68, 0x67, 0x6a, 0x69, 0x6f, 0x6a, 0x74, 0x6a, 0x78, 
+0x6a, 0x7c, 0x69, 0x7f, 0x67, 0x81, 0x65, 0x82, 0x63, 0x82, 0x61, 0x82, 0x5f, 0x80, 0x5e, 0x7e, 
+0x5d, 0x7a, 0x5d, 0x76, 0x5d, 0x72, 0x5f, 0x6d, 0x61, 0x68, 0x64, 0x62, 0x68, 0x5d, 0x6d, 0x57, 
+0x72, 0x52, 0x78, 0x4d, 0x7f, 0x48, 0x86, 0x43, 0x8e, 0x3e, 0x96, 0x3a, 0x9e, 0x35, 0xa7, 0x31, 
+0xb0, 0x2d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x74, 0x17, 0x74, 0x23, 0x74, 0x2f, 0x74, 
+0x3b, 0x74, 0x47, 0x74, 0x53, 0x74, 0x5f, 0x74, 0x6b, 0x74, 0x6e, 0x78, 0x6f, 0x7d, 0x6f, 0x82, 
+0x6e, 0x87, 0x6c, 0x8a, 0x69, 0x8d, 0x66, 0x8e, 0x63, 0x8e, 0x60, 0x8e, 0x5d, 0x8c, 0x5a, 0x89, 
+0x59, 0x85, 0x58, 0x80, 0x58, 0x7b, 0x59, 0x76, 0x5c, 0x70, 0x5f, 0x6a, 0x63, 0x65, 0x67, 0x5f, 
+0x6d, 0x59, 0x73, 0x54, 0x7a, 0x4f, 0x81, 0x49, 0x89, 0x45, 0x92, 0x40, 0x9a, 0x3c, 0xa3, 0x38, 
+0xad, 0x34, 0xb6, 0x30, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x7f, 0x17, 0x7f, 0x23, 0x7f, 0x2f, 0x7f, 
+0x3b, 0x7f, 0x47, 0x7f, 0x53, 0x7f, 0x5f, 0x7f, 0x6b, 0x7f, 0x74, 0x81, 0x74, 0x87, 0x74, 0x8c, 
+0x72, 0x91, 0x6f, 0x95, 0x6b, 0x98, 0x67, 0x9a, 0x63, 0x9a, 0x5e, 0x99, 0x5a, 0x97, 0x57, 0x94, 
+0x54, 0x8f, 0x53, 0x8a, 0x53, 0x85, 0x54, 0x7f, 0x56, 0x78, 0x59, 0x72, 0x5d, 0x6c, 0x62, 0x66, 
+0x67, 0x60, 0x6e, 0x5a, 0x75, 0x55, 0x7c, 0x4f, 0x85, 0x4b, 0x8d, 0x46, 0x96, 0x42, 0x9f, 0x3e, 
+0xa9, 0x3a, 0xb3, 0x36, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x8b, 0x17, 0x8b, 0x23, 0x8b, 0x2f, 0x8b, 
+0x3b, 0x8b, 0x47, 0x8b, 0x53, 0x8b, 0x5f, 0x8b, 0x6b, 0x8b, 0x77, 0x8b, 0x7a, 0x90, 0x79, 0x96, 
+0x77, 0x9c, 0x73, 0xa0, 0x6e, 0xa4, 0x68, 0xa6, 0x62, 0xa6, 0x5c, 0xa5, 0x57, 0xa2, 0x53, 0x9e, 
+0x4f, 0x99, 0x4d, 0x94, 0x4c, 0x8d, 0x4d, 0x86, 0x4f, 0x80, 0x52, 0x79, 0x56, 0x72, 0x5b, 0x6c, 
+0x61, 0x65, 0x68, 0x60, 0x70, 0x5a, 0x77, 0x55, 0x80, 0x50, 0x89, 0x4b, 0x92, 0x47, 0x9b, 0x43, 
+0xa5, 0x3f, 0xaf, 0x3c, 0xb9, 0x38, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x97, 0x23, 0x97, 0x2f, 0x97, 
+0x3b, 0x97, 0x47, 0x97, 0x53, 0x97, 0x5f, 0x97, 0x6b, 0x97, 0x77, 0x97, 0x81, 0x98, 0x80, 0x9f, 
+0x7c, 0xa5, 0x77, 0xab, 0x71, 0xaf, 0x6a, 0xb1, 0x62, 0xb2, 0x5a, 0xb1, 0x54, 0xae, 0x4e, 0xa9, 
+0x49, 0xa3, 0x47, 0x9c, 0x45, 0x95, 0x46, 0x8d, 0x48, 0x86, 0x4b, 0x7f, 0x50, 0x77, 0x55, 0x71, 
+0x5b, 0x6a, 0x62, 0x64, 0x6a, 0x5f, 0x72, 0x5a, 0x7b, 0x55, 0x84, 0x50, 0x8e, 0x4c, 0x97, 0x48, 
+0xa1, 0x44, 0xac, 0x41, 0xb6, 0x3e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xa3, 0x23, 0xa3, 0x2f, 0xa3, 
+0x3b, 0xa3, 0x47, 0xa3, 0x53, 0xa3, 0x5f, 0xa3, 0x6b, 0xa3, 0x77, 0xa3, 0x82, 0xa3, 0x87, 0xa7, 
+0x83, 0xaf, 0x7c, 0xb5, 0x74, 0xba, 0x6b, 0xbd, 0x62, 0xbe, 0x58, 0xbc, 0x4f, 0xb8, 0x48, 0xb3, 
+0x42, 0xac, 0x3f, 0xa4, 0x3e, 0x9c, 0x3e, 0x93, 0x40, 0x8b, 0x44, 0x83, 0x48, 0x7c, 0x4e, 0x75, 
+0x55, 0x6e, 0x5d, 0x68, 0x65, 0x63, 0x6d, 0x5e, 0x76, 0x59, 0x80, 0x54, 0x8a, 0x50, 0x94, 0x4c, 
+0x9e, 0x49, 0xa8, 0x46, 0xb3, 0x43, 0xbe, 0x40, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xaf, 0x2f, 0xaf, 
+0x3b, 0xaf, 0x47, 0xaf, 0x53, 0xaf, 0x5f, 0xaf, 0x6b, 0xaf, 0x77, 0xaf, 0x82, 0xaf, 0x8e, 0xaf, 
+0x8a, 0xb7, 0x83, 0xbf, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x4a, 0xc3, 0x41, 0xbc, 
+0x3a, 0xb4, 0x36, 0xab, 0x35, 0xa1, 0x35, 0x98, 0x38, 0x8f, 0x3c, 0x87, 0x41, 0x7f, 0x47, 0x78, 
+0x4f, 0x71, 0x57, 0x6b, 0x5f, 0x66, 0x68, 0x61, 0x72, 0x5c, 0x7c, 0x58, 0x86, 0x54, 0x90, 0x50, 
+0x9b, 0x4d, 0xa5, 0x4a, 0xb0, 0x47, 0xbb, 0x45, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0xbb, 0x47, 0xbb, 0x53, 0xbb, 0x5f, 0xbb, 0x6b, 0xbb, 0x77, 0xbb, 0x82, 0xbb, 0x8e, 0xbb, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x00, 0xfe, 0x2c, 0xb0, 0x2b, 0xa5, 0x2c, 0x9b, 0x2f, 0x92, 0x34, 0x89, 0x3a, 0x81, 0x41, 0x7a, 
+0x48, 0x73, 0x51, 0x6e, 0x5a, 0x68, 0x64, 0x63, 0x6e, 0x5f, 0x78, 0x5b, 0x82, 0x57, 0x8d, 0x54, 
+0x98, 0x51, 0xa3, 0x4e, 0xae, 0x4b, 0xb9, 0x49, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x5f, 0xc7, 0x6b, 0xc7, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x20, 0xa7, 0x22, 0x9c, 0x26, 0x92, 0x2b, 0x89, 0x32, 0x82, 0x3a, 0x7b, 
+0x42, 0x74, 0x4c, 0x6f, 0x55, 0x6a, 0x5f, 0x65, 0x6a, 0x61, 0x74, 0x5e, 0x7f, 0x5a, 0x8a, 0x57, 
+0x95, 0x54, 0xa0, 0x52, 0xab, 0x4f, 0xb6, 0x4d, 0xc2, 0x4b, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x9b, 0x1c, 0x91, 0x23, 0x88, 0x2b, 0x80, 0x33, 0x7a, 
+0x3d, 0x74, 0x47, 0x6f, 0x51, 0x6a, 0x5b, 0x66, 0x66, 0x63, 0x71, 0x5f, 0x7c, 0x5d, 0x87, 0x5a, 
+0x92, 0x57, 0x9e, 0x55, 0xa9, 0x53, 0xb5, 0x51, 0xc0, 0x50, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x8d, 0x1b, 0x85, 0x24, 0x7e, 0x2e, 0x78, 
+0x38, 0x73, 0x42, 0x6e, 0x4d, 0x6a, 0x58, 0x67, 0x63, 0x64, 0x6e, 0x61, 0x79, 0x5e, 0x85, 0x5c, 
+0x90, 0x5a, 0x9c, 0x58, 0xa7, 0x57, 0xb3, 0x55, 0xbf, 0x54, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x86, 0x14, 0x7f, 0x1e, 0x79, 0x29, 0x74, 
+0x33, 0x70, 0x3e, 0x6d, 0x49, 0x69, 0x55, 0x67, 0x60, 0x64, 0x6c, 0x62, 0x77, 0x60, 0x83, 0x5e, 
+0x8e, 0x5d, 0x9a, 0x5b, 0xa6, 0x5a, 0xb2, 0x59, 0xbd, 0x58, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x7d, 0x0f, 0x78, 0x19, 0x73, 0x25, 0x70, 
+0x30, 0x6d, 0x3b, 0x6a, 0x47, 0x68, 0x53, 0x66, 0x5e, 0x64, 0x6a, 0x63, 0x76, 0x61, 0x81, 0x60, 
+0x8d, 0x5f, 0x99, 0x5e, 0xa5, 0x5d, 0xb1, 0x5c, 0xbc, 0x5b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x6f, 0x16, 0x6d, 0x22, 0x6b, 
+0x2e, 0x69, 0x39, 0x67, 0x45, 0x66, 0x51, 0x65, 0x5d, 0x64, 0x69, 0x63, 0x75, 0x62, 0x80, 0x62, 
+0x8c, 0x61, 0x98, 0x61, 0xa4, 0x60, 0xb0, 0x60, 0xbc, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x65, 0x15, 0x65, 0x21, 0x65, 
+0x2d, 0x64, 0x39, 0x64, 0x45, 0x64, 0x50, 0x64, 0x5c, 0x64, 0x68, 0x63, 0x74, 0x63, 0x80, 0x63, 
+0x8c, 0x63, 0x98, 0x63, 0xa4, 0x63, 0xb0, 0x63, 0xbc, 0x63, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x48, 0x16, 0x5d, 0x21, 0x5f, 
+0x2d, 0x60, 0x39, 0x61, 0x45, 0x62, 0x51, 0x63, 0x5d, 0x63, 0x68, 0x64, 0x74, 0x64, 0x80, 0x65, 
+0x8c, 0x65, 0x98, 0x65, 0xa4, 0x66, 0xb0, 0x66, 0xbc, 0x66, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x27, 0x1c, 0x35, 0x24, 0x41, 0x2b, 0x4b, 
+0x33, 0x54, 0x3a, 0x5e, 0x46, 0x60, 0x52, 0x61, 0x5e, 0x63, 0x69, 0x64, 0x75, 0x65, 0x81, 0x66, 
+0x8d, 0x67, 0x99, 0x68, 0xa4, 0x69, 0xb0, 0x69, 0xbc, 0x6a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x24, 0x1f, 0x2b, 0x2c, 0x31, 0x37, 0x36, 0x40, 
+0x3d, 0x49, 0x44, 0x51, 0x4b, 0x5a, 0x54, 0x61, 0x5f, 0x63, 0x6b, 0x65, 0x76, 0x66, 0x82, 0x68, 
+0x8e, 0x69, 0x9a, 0x6b, 0xa5, 0x6c, 0xb1, 0x6d, 0xbd, 0x6e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x32, 0x0d, 0x2f, 0x10, 0x34, 0x1f, 0x38, 0x2a, 0x3d, 0x33, 0x42, 0x3b, 
+0x47, 0x42, 0x4d, 0x4a, 0x54, 0x51, 0x5b, 0x59, 0x63, 0x60, 0x6d, 0x66, 0x78, 0x68, 0x84, 0x6a, 
+0x8f, 0x6c, 0x9b, 0x6d, 0xa7, 0x6f, 0xb2, 0x70, 0xbe, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x41, 0x06, 0x3e, 0x08, 0x3b, 0x0c, 0x3d, 0x17, 0x41, 0x23, 0x44, 0x2c, 0x47, 0x33, 0x4b, 0x3a, 
+0x50, 0x40, 0x55, 0x46, 0x5b, 0x4d, 0x62, 0x53, 0x6a, 0x5a, 0x73, 0x60, 0x7c, 0x67, 0x86, 0x6c, 
+0x91, 0x6e, 0x9d, 0x70, 0xa8, 0x72, 0xb4, 0x74, 0xbf, 0x76, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x4b, 0x03, 0x51, 0x02, 0x4d, 0x03, 0x4a, 0x05, 
+0x48, 0x08, 0x46, 0x0c, 0x46, 0x16, 0x49, 0x22, 0x4b, 0x2a, 0x4d, 0x31, 0x50, 0x37, 0x53, 0x3c, 
+0x57, 0x41, 0x5c, 0x46, 0x62, 0x4b, 0x68, 0x50, 0x70, 0x56, 0x78, 0x5c, 0x82, 0x62, 0x8b, 0x68, 
+0x94, 0x71, 0x9f, 0x74, 0xaa, 0x76, 0xb6, 0x78, 0xc1, 0x7a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x31, 0x0d, 0x39, 0x0a, 0x41, 0x08, 0x4a, 0x08, 0x53, 0x08, 0x51, 0x0a, 0x50, 0x0d, 
+0x4f, 0x11, 0x50, 0x1c, 0x51, 0x26, 0x51, 0x2d, 0x53, 0x32, 0x54, 0x37, 0x57, 0x3b, 0x5a, 0x40, 
+0x5d, 0x44, 0x62, 0x48, 0x67, 0x4c, 0x6d, 0x50, 0x75, 0x54, 0x7d, 0x59, 0x86, 0x5e, 0x90, 0x63, 
+0x9a, 0x69, 0xa4, 0x6e, 0xad, 0x7a, 0xb8, 0x7c, 0xc3, 0x7e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x27, 0x14, 0x2f, 0x11, 0x38, 0x11, 0x41, 0x12, 0x4b, 0x13, 0x54, 0x15, 0x55, 0x17, 0x56, 0x1e, 
+0x57, 0x27, 0x57, 0x2d, 0x57, 0x32, 0x57, 0x36, 0x58, 0x3a, 0x5a, 0x3d, 0x5c, 0x41, 0x5f, 0x44, 
+0x62, 0x47, 0x66, 0x4a, 0x6b, 0x4d, 0x71, 0x51, 0x78, 0x54, 0x80, 0x58, 0x89, 0x5c, 0x93, 0x60, 
+0x9e, 0x65, 0xa8, 0x6a, 0xb3, 0x6f, 0xba, 0x81, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1e, 0x1c, 
+0x25, 0x1a, 0x2f, 0x1b, 0x39, 0x1d, 0x44, 0x20, 0x4f, 0x28, 0x57, 0x2c, 0x5b, 0x32, 0x5b, 0x35, 
+0x5c, 0x37, 0x5c, 0x38, 0x5b, 0x3b, 0x5c, 0x3e, 0x5d, 0x41, 0x5e, 0x44, 0x60, 0x46, 0x62, 0x49, 
+0x66, 0x4b, 0x69, 0x4d, 0x6e, 0x50, 0x74, 0x52, 0x7a, 0x55, 0x82, 0x58, 0x8b, 0x5b, 0x95, 0x5f, 
+0xa0, 0x63, 0xab, 0x67, 0xb7, 0x6b, 0xc2, 0x70, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x15, 0x26, 0x1c, 0x24, 
+0x26, 0x24, 0x31, 0x27, 0x40, 0x2f, 0x4d, 0x39, 0x54, 0x3d, 0x5a, 0x3f, 0x5d, 0x40, 0x5e, 0x42, 
+0x5f, 0x44, 0x5f, 0x45, 0x5f, 0x47, 0x5f, 0x48, 0x60, 0x48, 0x61, 0x49, 0x63, 0x4b, 0x65, 0x4d, 
+0x68, 0x4f, 0x6c, 0x51, 0x70, 0x53, 0x76, 0x55, 0x7c, 0x57, 0x83, 0x59, 0x8c, 0x5b, 0x96, 0x5e, 
+0xa1, 0x61, 0xae, 0x65, 0xba, 0x69, 0xc7, 0x6d, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0e, 0x30, 0x13, 0x2d, 0x1d, 0x2d, 
+0x29, 0x30, 0x3a, 0x39, 0x49, 0x42, 0x50, 0x45, 0x56, 0x47, 0x5b, 0x48, 0x5f, 0x48, 0x60, 0x49, 
+0x61, 0x4a, 0x61, 0x4c, 0x61, 0x4d, 0x61, 0x4e, 0x62, 0x4f, 0x63, 0x51, 0x65, 0x51, 0x67, 0x51, 
+0x6a, 0x53, 0x6e, 0x54, 0x72, 0x55, 0x77, 0x57, 0x7d, 0x59, 0x84, 0x5a, 0x8d, 0x5c, 0x97, 0x5e, 
+0xa2, 0x61, 0xaf, 0x64, 0xbe, 0x67, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x37, 0x13, 0x36, 0x1f, 0x38, 
+0x31, 0x3f, 0x43, 0x48, 0x4c, 0x4b, 0x52, 0x4c, 0x57, 0x4d, 0x5c, 0x4e, 0x60, 0x4e, 0x61, 0x4f, 
+0x62, 0x50, 0x62, 0x51, 0x62, 0x52, 0x63, 0x53, 0x64, 0x54, 0x65, 0x55, 0x66, 0x56, 0x68, 0x57, 
+0x6b, 0x57, 0x6f, 0x57, 0x73, 0x58, 0x78, 0x59, 0x7d, 0x5b, 0x84, 0x5c, 0x8d, 0x5d, 0x97, 0x5f, 
+0xa3, 0x61, 0xb1, 0x63, 0xc3, 0x65, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x41, 0x0a, 0x3f, 0x14, 0x40, 0x22, 0x42, 
+0x3c, 0x4c, 0x46, 0x4f, 0x4d, 0x51, 0x53, 0x52, 0x58, 0x53, 0x5c, 0x53, 0x61, 0x53, 0x62, 0x54, 
+0x63, 0x54, 0x63, 0x55, 0x63, 0x56, 0x64, 0x57, 0x65, 0x57, 0x66, 0x58, 0x67, 0x59, 0x69, 0x5a, 
+0x6c, 0x5a, 0x6f, 0x5b, 0x73, 0x5b, 0x78, 0x5c, 0x7e, 0x5c, 0x84, 0x5d, 0x8d, 0x5e, 0x97, 0x5f, 
+0xa4, 0x61, 0xb5, 0x62, 0xc6, 0x65, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x49, 0x0a, 0x48, 0x16, 0x49, 0x2d, 0x4f, 
+0x3f, 0x54, 0x48, 0x55, 0x4e, 0x56, 0x54, 0x57, 0x58, 0x57, 0x5d, 0x57, 0x61, 0x58, 0x63, 0x58, 
+0x63, 0x58, 0x64, 0x59, 0x64, 0x59, 0x65, 0x5a, 0x66, 0x5b, 0x67, 0x5b, 0x68, 0x5c, 0x6a, 0x5c, 
+0x6c, 0x5d, 0x6f, 0x5e, 0x72, 0x5e, 0x77, 0x5e, 0x7e, 0x5e, 0x84, 0x5f, 0x8d, 0x60, 0x97, 0x60, 
+0xa5, 0x61, 0xbf, 0x62, 0xc6, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x52, 0x0a, 0x51, 0x18, 0x52, 0x34, 0x57, 
+0x41, 0x59, 0x49, 0x5a, 0x4f, 0x5b, 0x54, 0x5b, 0x58, 0x5b, 0x5d, 0x5c, 0x61, 0x5c, 0x63, 0x5c, 
+0x64, 0x5c, 0x64, 0x5d, 0x65, 0x5d, 0x65, 0x5d, 0x66, 0x5e, 0x67, 0x5e, 0x69, 0x5f, 0x6b, 0x5f, 
+0x6d, 0x5f, 0x6f, 0x60, 0x72, 0x60, 0x76, 0x60, 0x7b, 0x61, 0x84, 0x61, 0x8d, 0x61, 0x98, 0x61, 
+0xaa, 0x62, 0xbf, 0x63, 0xc6, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x5b, 0x0b, 0x5a, 0x1a, 0x5b, 0x37, 0x5e, 
+0x42, 0x5f, 0x49, 0x5f, 0x4f, 0x5f, 0x54, 0x5f, 0x59, 0x60, 0x5d, 0x60, 0x61, 0x60, 0x64, 0x60, 
+0x64, 0x60, 0x64, 0x60, 0x65, 0x60, 0x66, 0x60, 0x67, 0x61, 0x68, 0x61, 0x69, 0x61, 0x6b, 0x61, 
+0x6d, 0x61, 0x70, 0x62, 0x72, 0x62, 0x76, 0x62, 0x7a, 0x62, 0x81, 0x62, 0x8d, 0x62, 0x9b, 0x62, 
+0xb2, 0x63, 0xbf, 0x63, 0xc6, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x64, 0x0b, 0x64, 0x1a, 0x64, 0x37, 0x64, 
+0x42, 0x64, 0x4a, 0x64, 0x4f, 0x64, 0x54, 0x64, 0x59, 0x64, 0x5d, 0x64, 0x61, 0x64, 0x64, 0x64, 
+0x64, 0x64, 0x64, 0x64, 0x65, 0x64, 0x66, 0x64, 0x67, 0x64, 0x68, 0x64, 0x69, 0x64, 0x6b, 0x64, 
+0x6d, 0x64, 0x70, 0x64, 0x72, 0x64, 0x76, 0x64, 0x7a, 0x64, 0x80, 0x64, 0x89, 0x64, 0xa3, 0x64, 
+0xb2, 0x64, 0xbf, 0x64, 0xc6, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x6c, 0x0b, 0x6d, 0x1a, 0x6c, 0x37, 0x69, 
+0x42, 0x68, 0x49, 0x68, 0x4f, 0x68, 0x54, 0x68, 0x59, 0x67, 0x5d, 0x67, 0x61, 0x67, 0x64, 0x67, 
+0x64, 0x67, 0x64, 0x67, 0x65, 0x67, 0x66, 0x67, 0x67, 0x66, 0x68, 0x66, 0x69, 0x66, 0x6b, 0x66, 
+0x6d, 0x66, 0x70, 0x65, 0x72, 0x65, 0x76, 0x65, 0x7a, 0x65, 0x81, 0x65, 0x8d, 0x65, 0x9b, 0x65, 
+0xb2, 0x64, 0xbf, 0x64, 0xc6, 0x63, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x75, 0x0a, 0x76, 0x18, 0x75, 0x34, 0x70, 
+0x41, 0x6e, 0x49, 0x6d, 0x4f, 0x6c, 0x54, 0x6c, 0x58, 0x6c, 0x5d, 0x6b, 0x61, 0x6b, 0x63, 0x6b, 
+0x64, 0x6b, 0x64, 0x6a, 0x65, 0x6a, 0x65, 0x6a, 0x66, 0x69, 0x67, 0x69, 0x69, 0x68, 0x6b, 0x68, 
+0x6d, 0x68, 0x6f, 0x67, 0x72, 0x67, 0x76, 0x67, 0x7b, 0x66, 0x84, 0x66, 0x8d, 0x66, 0x98, 0x66, 
+0xaa, 0x65, 0xbf, 0x64, 0xc6, 0x63, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x7e, 0x0a, 0x7f, 0x16, 0x7e, 0x2d, 0x78, 
+0x3f, 0x73, 0x48, 0x72, 0x4e, 0x71, 0x54, 0x70, 0x58, 0x70, 0x5d, 0x70, 0x61, 0x6f, 0x63, 0x6f, 
+0x63, 0x6f, 0x64, 0x6e, 0x64, 0x6e, 0x65, 0x6d, 0x66, 0x6c, 0x67, 0x6c, 0x68, 0x6b, 0x6a, 0x6b, 
+0x6c, 0x6a, 0x6f, 0x69, 0x72, 0x69, 0x77, 0x69, 0x7e, 0x69, 0x84, 0x68, 0x8d, 0x67, 0x97, 0x67, 
+0xa5, 0x66, 0xbf, 0x65, 0xc6, 0x63, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x86, 0x0a, 0x88, 0x14, 0x87, 0x22, 0x85, 
+0x3c, 0x7b, 0x46, 0x78, 0x4d, 0x76, 0x53, 0x75, 0x58, 0x74, 0x5c, 0x74, 0x61, 0x74, 0x62, 0x73, 
+0x63, 0x73, 0x63, 0x72, 0x63, 0x71, 0x64, 0x70, 0x65, 0x70, 0x66, 0x6f, 0x67, 0x6e, 0x69, 0x6d, 
+0x6c, 0x6d, 0x6f, 0x6c, 0x73, 0x6c, 0x78, 0x6b, 0x7e, 0x6b, 0x84, 0x6a, 0x8d, 0x69, 0x97, 0x68, 
+0xa4, 0x66, 0xb5, 0x65, 0xc6, 0x62, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x90, 0x13, 0x91, 0x1f, 0x8f, 
+0x31, 0x88, 0x43, 0x7f, 0x4c, 0x7c, 0x52, 0x7b, 0x57, 0x7a, 0x5c, 0x79, 0x60, 0x79, 0x61, 0x78, 
+0x62, 0x77, 0x62, 0x76, 0x62, 0x75, 0x63, 0x74, 0x64, 0x73, 0x65, 0x72, 0x66, 0x71, 0x68, 0x70, 
+0x6b, 0x70, 0x6f, 0x70, 0x73, 0x6f, 0x78, 0x6e, 0x7d, 0x6c, 0x84, 0x6b, 0x8d, 0x6a, 0x97, 0x68, 
+0xa3, 0x66, 0xb1, 0x64, 0xc3, 0x62, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0e, 0x97, 0x13, 0x9a, 0x1d, 0x9a, 
+0x29, 0x97, 0x3a, 0x8e, 0x49, 0x85, 0x50, 0x82, 0x56, 0x80, 0x5b, 0x7f, 0x5f, 0x7f, 0x60, 0x7e, 
+0x61, 0x7d, 0x61, 0x7b, 0x61, 0x7a, 0x61, 0x79, 0x62, 0x78, 0x63, 0x76, 0x65, 0x76, 0x67, 0x76, 
+0x6a, 0x74, 0x6e, 0x73, 0x72, 0x72, 0x77, 0x70, 0x7d, 0x6e, 0x84, 0x6d, 0x8d, 0x6b, 0x97, 0x69, 
+0xa2, 0x66, 0xaf, 0x63, 0xbe, 0x60, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x15, 0xa1, 0x1c, 0xa3, 
+0x26, 0xa3, 0x31, 0xa0, 0x40, 0x98, 0x4d, 0x8e, 0x54, 0x8a, 0x5a, 0x88, 0x5d, 0x87, 0x5e, 0x85, 
+0x5f, 0x83, 0x5f, 0x82, 0x5f, 0x80, 0x5f, 0x7f, 0x60, 0x7f, 0x61, 0x7e, 0x63, 0x7c, 0x65, 0x7a, 
+0x68, 0x78, 0x6c, 0x76, 0x70, 0x74, 0x76, 0x72, 0x7c, 0x70, 0x83, 0x6e, 0x8c, 0x6c, 0x96, 0x69, 
+0xa1, 0x66, 0xae, 0x62, 0xba, 0x5e, 0xc7, 0x5a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1e, 0xab, 
+0x25, 0xad, 0x2f, 0xac, 0x39, 0xaa, 0x44, 0xa7, 0x4f, 0x9f, 0x57, 0x9b, 0x5b, 0x95, 0x5b, 0x92, 
+0x5c, 0x90, 0x5c, 0x8f, 0x5b, 0x8c, 0x5c, 0x89, 0x5d, 0x86, 0x5e, 0x83, 0x60, 0x81, 0x62, 0x7e, 
+0x66, 0x7c, 0x69, 0x7a, 0x6e, 0x77, 0x74, 0x75, 0x7a, 0x72, 0x82, 0x6f, 0x8b, 0x6c, 0x95, 0x68, 
+0xa0, 0x64, 0xab, 0x60, 0xb7, 0x5c, 0xc2, 0x57, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x27, 0xb3, 0x2f, 0xb6, 0x38, 0xb6, 0x41, 0xb5, 0x4b, 0xb4, 0x54, 0xb2, 0x55, 0xb0, 0x56, 0xa9, 
+0x57, 0xa0, 0x57, 0x9a, 0x57, 0x95, 0x57, 0x91, 0x58, 0x8d, 0x5a, 0x8a, 0x5c, 0x86, 0x5f, 0x83, 
+0x62, 0x80, 0x66, 0x7d, 0x6b, 0x7a, 0x71, 0x76, 0x78, 0x73, 0x80, 0x6f, 0x89, 0x6b, 0x93, 0x67, 
+0x9e, 0x62, 0xa8, 0x5d, 0xb3, 0x58, 0xba, 0x46, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x31, 0xba, 0x39, 0xbd, 0x41, 0xbf, 0x4a, 0xbf, 0x53, 0xbf, 0x51, 0xbd, 0x50, 0xba, 
+0x4f, 0xb6, 0x50, 0xab, 0x51, 0xa1, 0x51, 0x9a, 0x53, 0x95, 0x54, 0x90, 0x57, 0x8c, 0x5a, 0x87, 
+0x5d, 0x83, 0x62, 0x7f, 0x67, 0x7b, 0x6d, 0x77, 0x75, 0x73, 0x7d, 0x6e, 0x86, 0x69, 0x90, 0x64, 
+0x9a, 0x5e, 0xa4, 0x59, 0xad, 0x4d, 0xb8, 0x4b, 0xc3, 0x49, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x4b, 0xc4, 0x51, 0xc5, 0x4d, 0xc4, 0x4a, 0xc2, 
+0x48, 0xbf, 0x46, 0xbb, 0x46, 0xb1, 0x49, 0xa5, 0x4b, 0x9d, 0x4d, 0x96, 0x50, 0x90, 0x53, 0x8b, 
+0x57, 0x86, 0x5c, 0x81, 0x62, 0x7c, 0x68, 0x77, 0x70, 0x71, 0x78, 0x6b, 0x82, 0x65, 0x8b, 0x5f, 
+0x94, 0x56, 0x9f, 0x53, 0xaa, 0x51, 0xb6, 0x4f, 0xc1, 0x4d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x41, 0xc1, 0x3e, 0xbf, 0x3b, 0xbb, 0x3d, 0xb0, 0x41, 0xa4, 0x44, 0x9b, 0x47, 0x94, 0x4b, 0x8d, 
+0x50, 0x87, 0x55, 0x81, 0x5b, 0x7a, 0x62, 0x74, 0x6a, 0x6d, 0x73, 0x67, 0x7c, 0x60, 0x86, 0x5b, 
+0x91, 0x59, 0x9d, 0x57, 0xa8, 0x55, 0xb4, 0x53, 0xbf, 0x51, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x32, 0xba, 0x2f, 0xb7, 0x34, 0xa8, 0x38, 0x9d, 0x3d, 0x94, 0x41, 0x8c, 
+0x47, 0x85, 0x4d, 0x7d, 0x54, 0x76, 0x5b, 0x6e, 0x63, 0x67, 0x6d, 0x61, 0x78, 0x5f, 0x84, 0x5d, 
+0x8f, 0x5b, 0x9b, 0x5a, 0xa7, 0x58, 0xb2, 0x57, 0xbe, 0x55, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x24, 0xa8, 0x2b, 0x9b, 0x31, 0x90, 0x36, 0x87, 
+0x3d, 0x7e, 0x44, 0x76, 0x4b, 0x6d, 0x54, 0x66, 0x5f, 0x64, 0x6b, 0x62, 0x76, 0x61, 0x82, 0x5f, 
+0x8e, 0x5e, 0x9a, 0x5c, 0xa5, 0x5b, 0xb1, 0x5a, 0xbd, 0x59, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0xa0, 0x1c, 0x92, 0x24, 0x86, 0x2b, 0x7c, 
+0x33, 0x73, 0x3a, 0x69, 0x46, 0x67, 0x52, 0x66, 0x5e, 0x64, 0x69, 0x63, 0x75, 0x62, 0x81, 0x61, 
+0x8d, 0x60, 0x99, 0x5f, 0xa4, 0x5e, 0xb0, 0x5e, 0xbc, 0x5d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x7f, 0x16, 0x6a, 0x21, 0x68, 
+0x2d, 0x67, 0x39, 0x66, 0x45, 0x65, 0x51, 0x64, 0x5d, 0x64, 0x68, 0x63, 0x74, 0x63, 0x80, 0x62, 
+0x8c, 0x62, 0x98, 0x62, 0xa4, 0x61, 0xb0, 0x61, 0xbc, 0x61, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x62, 0x15, 0x62, 0x21, 0x62, 
+0x2d, 0x63, 0x39, 0x63, 0x45, 0x63, 0x50, 0x63, 0x5c, 0x63, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x58, 0x16, 0x5a, 0x22, 0x5c, 
+0x2e, 0x5e, 0x39, 0x60, 0x45, 0x61, 0x51, 0x62, 0x5d, 0x63, 0x69, 0x64, 0x75, 0x65, 0x80, 0x65, 
+0x8c, 0x66, 0x98, 0x66, 0xa4, 0x67, 0xb0, 0x67, 0xbc, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x4a, 0x0f, 0x4f, 0x19, 0x54, 0x25, 0x57, 
+0x30, 0x5a, 0x3b, 0x5d, 0x47, 0x5f, 0x53, 0x61, 0x5e, 0x63, 0x6a, 0x64, 0x76, 0x66, 0x81, 0x67, 
+0x8d, 0x68, 0x99, 0x69, 0xa5, 0x6a, 0xb1, 0x6b, 0xbc, 0x6c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x41, 0x14, 0x48, 0x1e, 0x4e, 0x29, 0x53, 
+0x33, 0x57, 0x3e, 0x5a, 0x49, 0x5e, 0x55, 0x60, 0x60, 0x63, 0x6c, 0x65, 0x77, 0x67, 0x83, 0x69, 
+0x8e, 0x6a, 0x9a, 0x6c, 0xa6, 0x6d, 0xb2, 0x6e, 0xbd, 0x6f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x3a, 0x1b, 0x42, 0x24, 0x49, 0x2e, 0x4f, 
+0x38, 0x54, 0x42, 0x59, 0x4d, 0x5d, 0x58, 0x60, 0x63, 0x63, 0x6e, 0x66, 0x79, 0x69, 0x85, 0x6b, 
+0x90, 0x6d, 0x9c, 0x6f, 0xa7, 0x70, 0xb3, 0x72, 0xbf, 0x73, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x2c, 0x1c, 0x36, 0x23, 0x3f, 0x2b, 0x47, 0x33, 0x4d, 
+0x3d, 0x53, 0x47, 0x58, 0x51, 0x5d, 0x5b, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7c, 0x6a, 0x87, 0x6d, 
+0x92, 0x70, 0x9e, 0x72, 0xa9, 0x74, 0xb5, 0x76, 0xc0, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x5f, 0x00, 0x6b, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x20, 0x20, 0x22, 0x2b, 0x26, 0x35, 0x2b, 0x3e, 0x32, 0x45, 0x3a, 0x4c, 
+0x42, 0x53, 0x4c, 0x58, 0x55, 0x5d, 0x5f, 0x62, 0x6a, 0x66, 0x74, 0x69, 0x7f, 0x6d, 0x8a, 0x70, 
+0x95, 0x73, 0xa0, 0x75, 0xab, 0x78, 0xb6, 0x7a, 0xc2, 0x7c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0x0c, 0x47, 0x0c, 0x53, 0x0c, 0x5f, 0x0c, 0x6b, 0x0c, 0x77, 0x0c, 0x82, 0x0c, 0x8e, 0x0c, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x00, 0xfe, 0x2c, 0x17, 0x2b, 0x22, 0x2c, 0x2c, 0x2f, 0x35, 0x34, 0x3e, 0x3a, 0x46, 0x41, 0x4d, 
+0x48, 0x54, 0x51, 0x59, 0x5a, 0x5f, 0x64, 0x64, 0x6e, 0x68, 0x78, 0x6c, 0x82, 0x70, 0x8d, 0x73, 
+0x98, 0x76, 0xa3, 0x79, 0xae, 0x7c, 0xb9, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0x18, 0x2f, 0x18, 
+0x3b, 0x18, 0x47, 0x18, 0x53, 0x18, 0x5f, 0x18, 0x6b, 0x18, 0x77, 0x18, 0x82, 0x18, 0x8e, 0x18, 
+0x8a, 0x10, 0x83, 0x08, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x4a, 0x04, 0x41, 0x0b, 
+0x3a, 0x13, 0x36, 0x1c, 0x35, 0x26, 0x35, 0x2f, 0x38, 0x38, 0x3c, 0x40, 0x41, 0x48, 0x47, 0x4f, 
+0x4f, 0x56, 0x57, 0x5c, 0x5f, 0x61, 0x68, 0x66, 0x72, 0x6b, 0x7c, 0x6f, 0x86, 0x73, 0x90, 0x77, 
+0x9b, 0x7a, 0xa5, 0x7d, 0xb0, 0x80, 0xbb, 0x82, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x24, 0x23, 0x24, 0x2f, 0x24, 
+0x3b, 0x24, 0x47, 0x24, 0x53, 0x24, 0x5f, 0x24, 0x6b, 0x24, 0x77, 0x24, 0x82, 0x24, 0x87, 0x20, 
+0x83, 0x18, 0x7c, 0x12, 0x74, 0x0d, 0x6b, 0x0a, 0x62, 0x09, 0x58, 0x0b, 0x4f, 0x0f, 0x48, 0x14, 
+0x42, 0x1b, 0x3f, 0x23, 0x3e, 0x2b, 0x3e, 0x34, 0x40, 0x3c, 0x44, 0x44, 0x48, 0x4b, 0x4e, 0x52, 
+0x55, 0x59, 0x5d, 0x5f, 0x65, 0x64, 0x6d, 0x69, 0x76, 0x6e, 0x80, 0x73, 0x8a, 0x77, 0x94, 0x7b, 
+0x9e, 0x7e, 0xa8, 0x81, 0xb3, 0x84, 0xbe, 0x87, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x30, 0x23, 0x30, 0x2f, 0x30, 
+0x3b, 0x30, 0x47, 0x30, 0x53, 0x30, 0x5f, 0x30, 0x6b, 0x30, 0x77, 0x30, 0x81, 0x2f, 0x80, 0x28, 
+0x7c, 0x22, 0x77, 0x1c, 0x71, 0x18, 0x6a, 0x16, 0x62, 0x15, 0x5a, 0x16, 0x54, 0x19, 0x4e, 0x1e, 
+0x49, 0x24, 0x47, 0x2b, 0x45, 0x32, 0x46, 0x3a, 0x48, 0x41, 0x4b, 0x48, 0x50, 0x50, 0x55, 0x56, 
+0x5b, 0x5d, 0x62, 0x63, 0x6a, 0x68, 0x72, 0x6d, 0x7b, 0x72, 0x84, 0x77, 0x8e, 0x7b, 0x97, 0x7f, 
+0xa1, 0x83, 0xac, 0x86, 0xb6, 0x89, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x3c, 0x17, 0x3c, 0x23, 0x3c, 0x2f, 0x3c, 
+0x3b, 0x3c, 0x47, 0x3c, 0x53, 0x3c, 0x5f, 0x3c, 0x6b, 0x3c, 0x77, 0x3c, 0x7a, 0x37, 0x79, 0x31, 
+0x77, 0x2b, 0x73, 0x27, 0x6e, 0x23, 0x68, 0x21, 0x62, 0x21, 0x5c, 0x22, 0x57, 0x25, 0x53, 0x29, 
+0x4f, 0x2e, 0x4d, 0x33, 0x4c, 0x3a, 0x4d, 0x41, 0x4f, 0x47, 0x52, 0x4e, 0x56, 0x55, 0x5b, 0x5b, 
+0x61, 0x62, 0x68, 0x67, 0x70, 0x6d, 0x77, 0x72, 0x80, 0x77, 0x89, 0x7c, 0x92, 0x80, 0x9b, 0x84, 
+0xa5, 0x88, 0xaf, 0x8b, 0xb9, 0x8f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x48, 0x17, 0x48, 0x23, 0x48, 0x2f, 0x48, 
+0x3b, 0x48, 0x47, 0x48, 0x53, 0x48, 0x5f, 0x48, 0x6b, 0x48, 0x74, 0x46, 0x74, 0x40, 0x74, 0x3b, 
+0x72, 0x36, 0x6f, 0x32, 0x6b, 0x2f, 0x67, 0x2d, 0x63, 0x2d, 0x5e, 0x2e, 0x5a, 0x30, 0x57, 0x33, 
+0x54, 0x38, 0x53, 0x3d, 0x53, 0x42, 0x54, 0x48, 0x56, 0x4f, 0x59, 0x55, 0x5d, 0x5b, 0x62, 0x61, 
+0x67, 0x67, 0x6e, 0x6d, 0x75, 0x72, 0x7c, 0x78, 0x85, 0x7c, 0x8d, 0x81, 0x96, 0x85, 0x9f, 0x89, 
+0xa9, 0x8d, 0xb3, 0x91, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x53, 0x17, 0x53, 0x23, 0x53, 0x2f, 0x53, 
+0x3b, 0x53, 0x47, 0x53, 0x53, 0x53, 0x5f, 0x53, 0x6b, 0x53, 0x6e, 0x4f, 0x6f, 0x4a, 0x6f, 0x45, 
+0x6e, 0x40, 0x6c, 0x3d, 0x69, 0x3a, 0x66, 0x39, 0x63, 0x39, 0x60, 0x39, 0x5d, 0x3b, 0x5a, 0x3e, 
+0x59, 0x42, 0x58, 0x47, 0x58, 0x4c, 0x59, 0x51, 0x5c, 0x57, 0x5f, 0x5d, 0x63, 0x62, 0x67, 0x68, 
+0x6d, 0x6e, 0x73, 0x73, 0x7a, 0x78, 0x81, 0x7e, 0x89, 0x82, 0x92, 0x87, 0x9a, 0x8b, 0xa3, 0x8f, 
+0xad, 0x93, 0xb6, 0x97, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5f, 0x17, 0x5f, 0x23, 0x5f, 0x2f, 0x5f, 
+0x3b, 0x5f, 0x47, 0x5f, 0x53, 0x5f, 0x5f, 0x5f, 0x67, 0x5d, 0x69, 0x58, 0x6a, 0x53, 0x6a, 0x4f, 
+0x6a, 0x4b, 0x69, 0x48, 0x67, 0x46, 0x65, 0x45, 0x63, 0x45, 0x61, 0x45, 0x5f, 0x47, 0x5e, 0x49, 
+0x5d, 0x4d, 0x5d, 0x51, 0x5d, 0x55, 0x5f, 0x5a, 0x61, 0x5f, 0x64, 0x65, 0x68, 0x6a, 0x6d, 0x70, 
+0x72, 0x75, 0x78, 0x7a, 0x7f, 0x7f, 0x86, 0x84, 0x8e, 0x89, 0x96, 0x8d, 0x9e, 0x92, 0xa7, 0x96, 
+0xb0, 0x9a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x6b, 0x17, 0x6b, 0x23, 0x6b, 0x2f, 0x6b, 
+0x3b, 0x6b, 0x47, 0x6b, 0x53, 0x6b, 0x5f, 0x6b, 0x62, 0x67, 0x64, 0x62, 0x66, 0x5e, 0x67, 0x5a, 
+0x67, 0x56, 0x66, 0x54, 0x66, 0x52, 0x64, 0x51, 0x63, 0x50, 0x62, 0x51, 0x61, 0x53, 0x60, 0x55, 
+0x60, 0x58, 0x61, 0x5b, 0x62, 0x5f, 0x64, 0x64, 0x66, 0x68, 0x69, 0x6d, 0x6d, 0x72, 0x72, 0x77, 
+0x78, 0x7c, 0x7e, 0x81, 0x84, 0x86, 0x8b, 0x8b, 0x93, 0x90, 0x9a, 0x94, 0xa3, 0x98, 0xab, 0x9c, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x77, 0x17, 0x77, 0x23, 0x77, 0x2f, 0x77, 
+0x3b, 0x77, 0x47, 0x77, 0x53, 0x77, 0x5a, 0x75, 0x5d, 0x70, 0x60, 0x6c, 0x62, 0x68, 0x63, 0x65, 
+0x64, 0x62, 0x64, 0x5f, 0x64, 0x5e, 0x64, 0x5d, 0x63, 0x5c, 0x63, 0x5d, 0x63, 0x5e, 0x63, 0x60, 
+0x63, 0x63, 0x64, 0x66, 0x66, 0x6a, 0x68, 0x6e, 0x6b, 0x72, 0x6e, 0x76, 0x72, 0x7b, 0x77, 0x80, 
+0x7c, 0x85, 0x82, 0x89, 0x89, 0x8e, 0x90, 0x93, 0x97, 0x97, 0x9f, 0x9b, 0xa7, 0x9f, 0xaf, 0xa3, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x83, 0x17, 0x83, 0x23, 0x83, 0x2f, 0x83, 
+0x3b, 0x83, 0x47, 0x83, 0x52, 0x82, 0x56, 0x7e, 0x59, 0x7a, 0x5c, 0x76, 0x5e, 0x73, 0x60, 0x70, 
+0x61, 0x6d, 0x62, 0x6b, 0x63, 0x69, 0x63, 0x68, 0x64, 0x68, 0x64, 0x69, 0x64, 0x6a, 0x65, 0x6c, 
+0x66, 0x6e, 0x68, 0x71, 0x69, 0x74, 0x6c, 0x78, 0x6f, 0x7c, 0x73, 0x80, 0x77, 0x84, 0x7c, 0x89, 
+0x81, 0x8d, 0x87, 0x92, 0x8d, 0x96, 0x94, 0x9a, 0x9b, 0x9f, 0xa3, 0xa3, 0xab, 0xa7, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x8f, 0x17, 0x8f, 0x23, 0x8f, 0x2f, 0x8f, 
+0x3b, 0x8f, 0x47, 0x8f, 0x4e, 0x8c, 0x52, 0x88, 0x55, 0x84, 0x59, 0x81, 0x5b, 0x7e, 0x5d, 0x7b, 
+0x5f, 0x78, 0x61, 0x76, 0x62, 0x75, 0x63, 0x74, 0x64, 0x74, 0x65, 0x75, 0x66, 0x76, 0x67, 0x77, 
+0x69, 0x79, 0x6a, 0x7c, 0x6d, 0x7f, 0x70, 0x82, 0x73, 0x86, 0x77, 0x8a, 0x7b, 0x8e, 0x80, 0x92, 
+0x85, 0x96, 0x8b, 0x9a, 0x92, 0x9e, 0x98, 0xa3, 0x9f, 0xa7, 0xa7, 0xab, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x9b, 0x23, 0x9b, 0x2f, 0x9b, 
+0x3b, 0x9b, 0x45, 0x9a, 0x4a, 0x96, 0x4e, 0x92, 0x52, 0x8f, 0x55, 0x8c, 0x58, 0x89, 0x5b, 0x86, 
+0x5d, 0x84, 0x5f, 0x82, 0x61, 0x81, 0x62, 0x80, 0x64, 0x80, 0x65, 0x80, 0x67, 0x81, 0x69, 0x83, 
+0x6b, 0x85, 0x6d, 0x87, 0x70, 0x8a, 0x73, 0x8d, 0x77, 0x90, 0x7b, 0x94, 0x7f, 0x97, 0x84, 0x9b, 
+0x89, 0x9f, 0x8f, 0xa3, 0x96, 0xa7, 0x9c, 0xab, 0xa3, 0xaf, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xa7, 0x2f, 0xa7, 
+0x3b, 0xa7, 0x41, 0xa4, 0x46, 0xa0, 0x4b, 0x9d, 0x4f, 0x99, 0x52, 0x96, 0x56, 0x94, 0x59, 0x91, 
+0x5b, 0x8f, 0x5e, 0x8e, 0x60, 0x8d, 0x62, 0x8c, 0x64, 0x8c, 0x66, 0x8c, 0x68, 0x8d, 0x6a, 0x8e, 
+0x6d, 0x90, 0x70, 0x92, 0x73, 0x95, 0x76, 0x98, 0x7a, 0x9b, 0x7e, 0x9e, 0x83, 0xa1, 0x88, 0xa5, 
+0x8d, 0xa9, 0x93, 0xad, 0x9a, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2f, 0xb3, 
+0x38, 0xb1, 0x3e, 0xae, 0x43, 0xaa, 0x47, 0xa7, 0x4c, 0xa4, 0x50, 0xa1, 0x53, 0x9f, 0x57, 0x9d, 
+0x5a, 0x9b, 0x5c, 0x9a, 0x5f, 0x99, 0x62, 0x98, 0x64, 0x98, 0x66, 0x98, 0x69, 0x99, 0x6c, 0x9a, 
+0x6f, 0x9c, 0x72, 0x9e, 0x75, 0xa0, 0x79, 0xa3, 0x7d, 0xa5, 0x81, 0xa8, 0x86, 0xac, 0x8b, 0xaf, 
+0x91, 0xb3, 0x97, 0xb6, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x35, 0xbb, 0x3a, 0xb8, 0x40, 0xb5, 0x44, 0xb2, 0x49, 0xaf, 0x4d, 0xad, 0x51, 0xaa, 0x55, 0xa8, 
+0x58, 0xa7, 0x5b, 0xa5, 0x5e, 0xa4, 0x61, 0xa4, 0x64, 0xa4, 0x67, 0xa4, 0x6a, 0xa5, 0x6d, 0xa6, 
+0x70, 0xa7, 0x74, 0xa9, 0x78, 0xab, 0x7c, 0xae, 0x80, 0xb0, 0x84, 0xb3, 0x89, 0xb6, 0x8f, 0xb9, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x3d, 0xbf, 0x42, 0xbd, 0x46, 0xba, 0x4b, 0xb8, 0x4f, 0xb6, 0x53, 0xb4, 
+0x57, 0xb2, 0x5a, 0xb1, 0x5e, 0xb0, 0x61, 0xb0, 0x64, 0xb0, 0x67, 0xb0, 0x6b, 0xb1, 0x6e, 0xb2, 
+0x72, 0xb3, 0x76, 0xb5, 0x7a, 0xb6, 0x7e, 0xb9, 0x82, 0xbb, 0x87, 0xbe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x49, 0xc3, 0x4d, 0xc1, 0x51, 0xbf, 
+0x55, 0xbe, 0x59, 0xbd, 0x5d, 0xbc, 0x61, 0xbc, 0x64, 0xbc, 0x68, 0xbc, 0x6c, 0xbc, 0x6f, 0xbd, 
+0x73, 0xbf, 0x77, 0xc0, 0x7c, 0xc2, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x64, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x40, 0x0b, 0x4c, 0x0b, 0x58, 0x0b, 
+0x64, 0x0b, 0x6f, 0x0b, 0x7b, 0x0b, 0x87, 0x0b, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x28, 0x17, 0x34, 0x17, 0x40, 0x17, 0x4c, 0x17, 0x58, 0x17, 
+0x64, 0x17, 0x6f, 0x17, 0x7b, 0x17, 0x87, 0x17, 0x93, 0x17, 0x9f, 0x17, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x1c, 0x23, 0x28, 0x23, 0x34, 0x23, 0x40, 0x23, 0x4c, 0x23, 0x58, 0x23, 
+0x64, 0x23, 0x6f, 0x23, 0x7b, 0x23, 0x87, 0x23, 0x93, 0x23, 0x9f, 0x23, 0xab, 0x23, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x10, 0x2f, 0x1c, 0x2f, 0x28, 0x2f, 0x34, 0x2f, 0x40, 0x2f, 0x4c, 0x2f, 0x58, 0x2f, 
+0x64, 0x2f, 0x6f, 0x2f, 0x7b, 0x2f, 0x87, 0x2f, 0x93, 0x2f, 0x9f, 0x2f, 0xab, 0x2f, 0xb7, 0x2f, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x10, 0x3b, 0x1c, 0x3b, 0x28, 0x3b, 0x34, 0x3b, 0x40, 0x3b, 0x4c, 0x3b, 0x58, 0x3b, 
+0x64, 0x3b, 0x6f, 0x3b, 0x7b, 0x3b, 0x87, 0x3b, 0x93, 0x3b, 0x9f, 0x3b, 0xab, 0x3b, 0xb7, 0x3b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x04, 0x47, 0x10, 0x47, 0x1c, 0x47, 0x28, 0x47, 0x34, 0x47, 0x40, 0x47, 0x4c, 0x47, 0x58, 0x47, 
+0x64, 0x47, 0x6f, 0x47, 0x7b, 0x47, 0x87, 0x47, 0x93, 0x47, 0x9f, 0x47, 0xab, 0x47, 0xb7, 0x47, 
+0xc3, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x08, 0x48, 0x12, 0x4b, 0x1d, 0x4e, 0x28, 0x52, 0x34, 0x53, 0x40, 0x53, 0x4c, 0x53, 0x58, 0x53, 
+0x64, 0x53, 0x6f, 0x53, 0x7b, 0x53, 0x87, 0x53, 0x93, 0x53, 0x9f, 0x53, 0xab, 0x53, 0xb7, 0x53, 
+0xc3, 0x53, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0b, 0x49, 0x16, 0x4c, 0x21, 0x4f, 0x2c, 0x53, 0x37, 0x56, 0x41, 0x59, 0x4c, 0x5d, 0x58, 0x5f, 
+0x64, 0x5f, 0x6f, 0x5f, 0x7b, 0x5f, 0x87, 0x5f, 0x93, 0x5f, 0x9f, 0x5f, 0xab, 0x5f, 0xb7, 0x5f, 
+0xc3, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0e, 0x4a, 0x19, 0x4d, 0x24, 0x50, 0x2f, 0x54, 0x3a, 0x57, 0x45, 0x5a, 0x50, 0x5e, 0x5b, 0x61, 
+0x65, 0x64, 0x70, 0x67, 0x7b, 0x6b, 0x87, 0x6b, 0x93, 0x6b, 0x9f, 0x6b, 0xab, 0x6b, 0xb7, 0x6b, 
+0xc3, 0x6b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x48, 
+0x11, 0x4b, 0x1c, 0x4e, 0x27, 0x51, 0x32, 0x55, 0x3d, 0x58, 0x48, 0x5b, 0x53, 0x5f, 0x5e, 0x62, 
+0x69, 0x65, 0x74, 0x68, 0x7f, 0x6c, 0x8a, 0x6f, 0x94, 0x72, 0x9f, 0x75, 0xab, 0x77, 0xb7, 0x77, 
+0xc3, 0x77, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x49, 
+0x15, 0x4c, 0x20, 0x4f, 0x2a, 0x52, 0x35, 0x56, 0x40, 0x59, 0x4b, 0x5c, 0x56, 0x60, 0x61, 0x63, 
+0x6c, 0x66, 0x77, 0x69, 0x82, 0x6d, 0x8d, 0x70, 0x98, 0x73, 0xa3, 0x76, 0xae, 0x7a, 0xb8, 0x7d, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x4a, 
+0x18, 0x4d, 0x23, 0x50, 0x2e, 0x53, 0x39, 0x57, 0x44, 0x5a, 0x4f, 0x5d, 0x59, 0x60, 0x64, 0x64, 
+0x6f, 0x67, 0x7a, 0x6a, 0x85, 0x6e, 0x90, 0x71, 0x9b, 0x74, 0xa6, 0x77, 0xb1, 0x7b, 0xbc, 0x7e, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x05, 0x47, 0x10, 0x4b, 
+0x1b, 0x4e, 0x26, 0x51, 0x31, 0x54, 0x3c, 0x58, 0x47, 0x5b, 0x52, 0x5e, 0x5d, 0x61, 0x68, 0x65, 
+0x73, 0x68, 0x7d, 0x6b, 0x88, 0x6f, 0x93, 0x72, 0x9e, 0x75, 0xa9, 0x78, 0xb4, 0x7c, 0xbf, 0x7f, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x48, 0x14, 0x4c, 
+0x1e, 0x4f, 0x29, 0x52, 0x34, 0x55, 0x3f, 0x59, 0x4a, 0x5c, 0x55, 0x5f, 0x60, 0x62, 0x6b, 0x66, 
+0x76, 0x69, 0x81, 0x6c, 0x8c, 0x70, 0x97, 0x73, 0xa2, 0x76, 0xac, 0x79, 0xb7, 0x7d, 0xc2, 0x80, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x49, 0x17, 0x4c, 
+0x22, 0x50, 0x2d, 0x53, 0x38, 0x56, 0x43, 0x5a, 0x4d, 0x5d, 0x58, 0x60, 0x63, 0x63, 0x6e, 0x67, 
+0x79, 0x6a, 0x84, 0x6d, 0x8f, 0x71, 0x9a, 0x74, 0xa5, 0x77, 0xb0, 0x7a, 0xbb, 0x7e, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x47, 0x0f, 0x4a, 0x1a, 0x4d, 
+0x25, 0x51, 0x30, 0x54, 0x3b, 0x57, 0x46, 0x5b, 0x51, 0x5e, 0x5c, 0x61, 0x67, 0x64, 0x71, 0x68, 
+0x7c, 0x6b, 0x87, 0x6e, 0x92, 0x72, 0x9d, 0x75, 0xa8, 0x78, 0xb3, 0x7b, 0xbe, 0x7f, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x08, 0x48, 0x12, 0x4b, 0x1d, 0x4e, 
+0x28, 0x52, 0x33, 0x55, 0x3e, 0x58, 0x49, 0x5c, 0x54, 0x5f, 0x5f, 0x62, 0x6a, 0x65, 0x75, 0x69, 
+0x80, 0x6c, 0x8b, 0x6f, 0x96, 0x73, 0xa0, 0x76, 0xab, 0x79, 0xb6, 0x7c, 0xc1, 0x80, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x49, 0x16, 0x4c, 0x21, 0x4f, 
+0x2c, 0x53, 0x37, 0x56, 0x41, 0x59, 0x4c, 0x5d, 0x57, 0x60, 0x62, 0x63, 0x6d, 0x66, 0x78, 0x6a, 
+0x83, 0x6d, 0x8e, 0x70, 0x99, 0x73, 0xa4, 0x77, 0xaf, 0x7a, 0xba, 0x7d, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x4a, 0x19, 0x4d, 0x24, 0x50, 
+0x2f, 0x54, 0x3a, 0x57, 0x45, 0x5a, 0x50, 0x5e, 0x5b, 0x61, 0x65, 0x64, 0x70, 0x67, 0x7b, 0x6b, 
+0x86, 0x6e, 0x91, 0x71, 0x9c, 0x74, 0xa7, 0x78, 0xb2, 0x7b, 0xbd, 0x7e, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x48, 0x11, 0x4b, 0x1c, 0x4e, 0x27, 0x51, 
+0x32, 0x55, 0x3d, 0x58, 0x48, 0x5b, 0x53, 0x5f, 0x5e, 0x62, 0x69, 0x65, 0x74, 0x68, 0x7f, 0x6c, 
+0x8a, 0x6f, 0x94, 0x72, 0x9f, 0x75, 0xaa, 0x79, 0xb5, 0x7c, 0xc0, 0x7f, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x49, 0x15, 0x4c, 0x20, 0x4f, 0x2a, 0x52, 
+0x35, 0x56, 0x40, 0x59, 0x4b, 0x5c, 0x56, 0x60, 0x61, 0x63, 0x6c, 0x66, 0x77, 0x69, 0x82, 0x6d, 
+0x8d, 0x70, 0x98, 0x73, 0xa3, 0x76, 0xae, 0x7a, 0xb8, 0x7d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x4a, 0x18, 0x4d, 0x23, 0x50, 0x2e, 0x53, 
+0x39, 0x57, 0x44, 0x5a, 0x4f, 0x5d, 0x59, 0x60, 0x64, 0x64, 0x6f, 0x67, 0x7a, 0x6a, 0x85, 0x6e, 
+0x90, 0x71, 0x9b, 0x74, 0xa6, 0x77, 0xb1, 0x7b, 0xbc, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x05, 0x47, 0x10, 0x4b, 0x1b, 0x4e, 0x26, 0x51, 0x31, 0x54, 
+0x3c, 0x58, 0x47, 0x5b, 0x52, 0x5e, 0x5d, 0x61, 0x68, 0x65, 0x73, 0x68, 0x7d, 0x6b, 0x88, 0x6f, 
+0x93, 0x72, 0x9e, 0x75, 0xa9, 0x78, 0xb4, 0x7c, 0xbf, 0x7f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x48, 0x14, 0x4c, 0x1e, 0x4f, 0x29, 0x52, 0x34, 0x55, 
+0x3f, 0x59, 0x4a, 0x5c, 0x55, 0x5f, 0x60, 0x62, 0x6b, 0x66, 0x76, 0x69, 0x81, 0x6c, 0x8c, 0x70, 
+0x97, 0x73, 0xa2, 0x76, 0xac, 0x79, 0xb7, 0x7d, 0xc2, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x49, 0x17, 0x4c, 0x22, 0x50, 0x2d, 0x53, 0x38, 0x56, 
+0x43, 0x5a, 0x4d, 0x5d, 0x58, 0x60, 0x63, 0x63, 0x6e, 0x67, 0x79, 0x6a, 0x84, 0x6d, 0x8f, 0x71, 
+0x9a, 0x74, 0xa5, 0x77, 0xb0, 0x7a, 0xbb, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x04, 0x47, 0x0f, 0x4a, 0x1a, 0x4d, 0x25, 0x51, 0x30, 0x54, 0x3b, 0x57, 
+0x46, 0x5b, 0x51, 0x5e, 0x5c, 0x61, 0x67, 0x64, 0x71, 0x68, 0x7c, 0x6b, 0x87, 0x6e, 0x92, 0x72, 
+0x9d, 0x75, 0xa8, 0x78, 0xb3, 0x7b, 0xbe, 0x7f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x08, 0x48, 0x12, 0x4b, 0x1d, 0x4e, 0x28, 0x52, 0x33, 0x55, 0x3e, 0x58, 
+0x49, 0x5c, 0x54, 0x5f, 0x5f, 0x62, 0x6a, 0x65, 0x75, 0x69, 0x80, 0x6c, 0x8b, 0x6f, 0x96, 0x73, 
+0xa0, 0x76, 0xab, 0x79, 0xb6, 0x7c, 0xc1, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0b, 0x49, 0x16, 0x4c, 0x21, 0x4f, 0x2c, 0x53, 0x37, 0x56, 0x41, 0x59, 
+0x4c, 0x5d, 0x57, 0x60, 0x62, 0x63, 0x6d, 0x66, 0x78, 0x6a, 0x83, 0x6d, 0x8e, 0x70, 0x99, 0x73, 
+0xa4, 0x77, 0xaf, 0x7a, 0xba, 0x7d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x4a, 0x19, 0x4d, 0x24, 0x50, 0x2f, 0x54, 0x3a, 0x57, 0x45, 0x5a, 
+0x50, 0x5e, 0x5b, 0x61, 0x65, 0x64, 0x70, 0x67, 0x7b, 0x6b, 0x86, 0x6e, 0x91, 0x71, 0x9c, 0x74, 
+0xa7, 0x78, 0xb2, 0x7b, 0xbb, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x06, 0x48, 0x11, 0x4b, 0x1c, 0x4e, 0x27, 0x51, 0x32, 0x55, 0x3d, 0x58, 0x48, 0x5b, 
+0x53, 0x5f, 0x5e, 0x62, 0x69, 0x65, 0x74, 0x68, 0x7f, 0x6c, 0x8a, 0x6f, 0x94, 0x72, 0x9f, 0x75, 
+0xa9, 0x77, 0xb0, 0x71, 0xbe, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0a, 0x49, 0x15, 0x4c, 0x20, 0x4f, 0x2a, 0x52, 0x35, 0x56, 0x40, 0x59, 0x4b, 0x5c, 
+0x56, 0x60, 0x61, 0x63, 0x6c, 0x66, 0x77, 0x69, 0x82, 0x6d, 0x8d, 0x70, 0x98, 0x73, 0xa3, 0x76, 
+0xa7, 0x71, 0xae, 0x6a, 0xc6, 0x5d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0d, 0x4a, 0x18, 0x4d, 0x23, 0x50, 0x2e, 0x53, 0x39, 0x57, 0x44, 0x5a, 0x4f, 0x5d, 
+0x59, 0x60, 0x64, 0x64, 0x6f, 0x67, 0x7a, 0x6a, 0x85, 0x6e, 0x90, 0x71, 0x9b, 0x74, 0xa0, 0x72, 
+0xa3, 0x6c, 0xaa, 0x63, 0xc4, 0x52, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x05, 0x47, 0x10, 0x4b, 0x1b, 0x4e, 0x26, 0x51, 0x31, 0x54, 0x3c, 0x58, 0x47, 0x5b, 0x52, 0x5e, 
+0x5d, 0x61, 0x68, 0x65, 0x73, 0x68, 0x7d, 0x6b, 0x88, 0x6f, 0x93, 0x72, 0x9b, 0x73, 0x9c, 0x6e, 
+0x9e, 0x68, 0xa7, 0x5e, 0xbf, 0x48, 0xba, 0x31, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x12, 0x33, 0x1c, 0x38, 0x26, 0x3d, 0x30, 0x42, 0x39, 0x48, 0x43, 0x4d, 0x4c, 0x51, 0x56, 0x55, 
+0x60, 0x58, 0x6a, 0x5b, 0x74, 0x5d, 0x7f, 0x5f, 0x89, 0x60, 0x93, 0x60, 0x91, 0x59, 0x8e, 0x50, 
+0x8b, 0x43, 0x8c, 0x27, 0x8f, 0x10, 0x8f, 0x0b, 0x90, 0x0a, 0x91, 0x0b, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x87, 0x06, 0x52, 0x04, 0x5d, 0x04, 0x68, 0x04, 0x74, 0x04, 0x7f, 0x04, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x18, 0x31, 0x23, 0x36, 0x2d, 0x3b, 0x37, 0x3f, 0x40, 0x44, 0x49, 0x48, 0x52, 0x4c, 0x5a, 0x4f, 
+0x63, 0x52, 0x6c, 0x54, 0x75, 0x56, 0x7e, 0x57, 0x88, 0x57, 0x8b, 0x54, 0x87, 0x4e, 0x83, 0x45, 
+0x7d, 0x39, 0x7b, 0x16, 0x79, 0x0d, 0x7a, 0x09, 0x7d, 0x07, 0x80, 0x06, 0x82, 0x06, 0x83, 0x06, 
+0x81, 0x08, 0x7c, 0x0f, 0x77, 0x0f, 0x54, 0x10, 0x5e, 0x11, 0x68, 0x11, 0x73, 0x11, 0x7e, 0x10, 
+0x89, 0x10, 0x94, 0x0f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2b, 
+0x20, 0x31, 0x2b, 0x36, 0x35, 0x3b, 0x3f, 0x3f, 0x47, 0x43, 0x4e, 0x47, 0x56, 0x4a, 0x5e, 0x4d, 
+0x66, 0x4f, 0x6e, 0x50, 0x75, 0x51, 0x7d, 0x52, 0x86, 0x52, 0x83, 0x4d, 0x7f, 0x48, 0x79, 0x41, 
+0x72, 0x35, 0x6b, 0x1a, 0x69, 0x13, 0x6a, 0x0f, 0x6e, 0x0c, 0x71, 0x0b, 0x73, 0x0b, 0x72, 0x15, 
+0x71, 0x1a, 0x6f, 0x1a, 0x4d, 0x1c, 0x56, 0x1d, 0x5e, 0x1e, 0x67, 0x1e, 0x72, 0x1e, 0x7c, 0x1d, 
+0x87, 0x1c, 0x92, 0x1a, 0x9e, 0x19, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x11, 0x2b, 0x1a, 0x2d, 
+0x27, 0x33, 0x32, 0x38, 0x3c, 0x3c, 0x45, 0x40, 0x4c, 0x44, 0x53, 0x47, 0x5a, 0x4a, 0x61, 0x4c, 
+0x67, 0x4e, 0x6e, 0x4f, 0x75, 0x4f, 0x7c, 0x4f, 0x80, 0x4e, 0x7d, 0x4a, 0x78, 0x46, 0x72, 0x41, 
+0x6a, 0x35, 0x61, 0x23, 0x5e, 0x1e, 0x5f, 0x1a, 0x61, 0x18, 0x65, 0x16, 0x67, 0x1f, 0x67, 0x26, 
+0x67, 0x26, 0x66, 0x25, 0x50, 0x28, 0x57, 0x2a, 0x5f, 0x2a, 0x67, 0x2a, 0x70, 0x2a, 0x7a, 0x29, 
+0x84, 0x28, 0x8f, 0x26, 0x9a, 0x24, 0xa7, 0x21, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2a, 0x22, 0x31, 
+0x2f, 0x37, 0x39, 0x3b, 0x42, 0x3f, 0x4b, 0x43, 0x51, 0x46, 0x57, 0x49, 0x5d, 0x4b, 0x63, 0x4c, 
+0x69, 0x4e, 0x6f, 0x4e, 0x74, 0x4f, 0x7a, 0x4e, 0x7b, 0x4d, 0x78, 0x4a, 0x73, 0x47, 0x6d, 0x42, 
+0x61, 0x32, 0x5b, 0x2d, 0x58, 0x29, 0x57, 0x27, 0x59, 0x25, 0x5c, 0x24, 0x5f, 0x31, 0x60, 0x32, 
+0x61, 0x31, 0x60, 0x30, 0x52, 0x33, 0x59, 0x35, 0x5f, 0x35, 0x67, 0x35, 0x6f, 0x35, 0x78, 0x34, 
+0x81, 0x33, 0x8b, 0x31, 0x97, 0x2f, 0xa3, 0x2c, 0xb3, 0x28, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x2c, 0x17, 0x2c, 0x2a, 0x36, 
+0x36, 0x3b, 0x3f, 0x3f, 0x48, 0x43, 0x4f, 0x46, 0x55, 0x48, 0x5a, 0x4b, 0x5f, 0x4d, 0x64, 0x4e, 
+0x6a, 0x4f, 0x6f, 0x4f, 0x74, 0x4f, 0x79, 0x4f, 0x77, 0x4d, 0x74, 0x4b, 0x70, 0x48, 0x6b, 0x45, 
+0x5f, 0x39, 0x58, 0x37, 0x54, 0x35, 0x53, 0x33, 0x55, 0x32, 0x58, 0x39, 0x5b, 0x3c, 0x5c, 0x3c, 
+0x5c, 0x3b, 0x4f, 0x3b, 0x55, 0x3d, 0x5a, 0x3e, 0x60, 0x3f, 0x66, 0x3f, 0x6e, 0x3f, 0x76, 0x3e, 
+0x7e, 0x3d, 0x88, 0x3b, 0x93, 0x39, 0x9f, 0x36, 0xad, 0x33, 0xba, 0x31, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0x2e, 0x13, 0x2e, 0x22, 0x34, 0x31, 0x3b, 
+0x3c, 0x40, 0x45, 0x44, 0x4c, 0x47, 0x53, 0x49, 0x58, 0x4b, 0x5d, 0x4d, 0x61, 0x4f, 0x66, 0x50, 
+0x6a, 0x50, 0x6e, 0x51, 0x73, 0x51, 0x77, 0x50, 0x74, 0x4e, 0x71, 0x4c, 0x6e, 0x4a, 0x68, 0x46, 
+0x5f, 0x3e, 0x59, 0x3d, 0x54, 0x3c, 0x52, 0x3c, 0x52, 0x3d, 0x56, 0x44, 0x58, 0x45, 0x59, 0x45, 
+0x59, 0x44, 0x52, 0x44, 0x57, 0x45, 0x5c, 0x46, 0x61, 0x47, 0x66, 0x47, 0x6d, 0x47, 0x74, 0x46, 
+0x7c, 0x45, 0x85, 0x43, 0x8f, 0x41, 0x9b, 0x3f, 0xa9, 0x3c, 0xbb, 0x37, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x30, 0x17, 0x31, 0x2a, 0x3a, 0x37, 0x40, 
+0x41, 0x44, 0x49, 0x48, 0x50, 0x4a, 0x56, 0x4c, 0x5b, 0x4e, 0x5f, 0x50, 0x63, 0x51, 0x67, 0x52, 
+0x6a, 0x52, 0x6e, 0x52, 0x72, 0x52, 0x74, 0x51, 0x72, 0x50, 0x6f, 0x4e, 0x6c, 0x4c, 0x65, 0x45, 
+0x5f, 0x43, 0x5a, 0x42, 0x56, 0x42, 0x54, 0x42, 0x53, 0x43, 0x56, 0x49, 0x57, 0x4a, 0x58, 0x4b, 
+0x58, 0x4b, 0x54, 0x4b, 0x58, 0x4c, 0x5d, 0x4d, 0x61, 0x4e, 0x66, 0x4e, 0x6c, 0x4d, 0x73, 0x4d, 
+0x7a, 0x4c, 0x82, 0x4b, 0x8c, 0x49, 0x97, 0x47, 0xa5, 0x44, 0xbb, 0x3f, 0xc1, 0x40, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x33, 0x12, 0x33, 0x1c, 0x36, 0x31, 0x40, 0x3d, 0x45, 
+0x45, 0x49, 0x4d, 0x4b, 0x53, 0x4e, 0x59, 0x4f, 0x5d, 0x51, 0x60, 0x52, 0x64, 0x53, 0x67, 0x54, 
+0x6b, 0x54, 0x6e, 0x54, 0x71, 0x54, 0x72, 0x53, 0x70, 0x52, 0x6d, 0x51, 0x6b, 0x4e, 0x65, 0x49, 
+0x60, 0x47, 0x5b, 0x47, 0x58, 0x46, 0x55, 0x47, 0x55, 0x49, 0x57, 0x4d, 0x57, 0x4e, 0x58, 0x4e, 
+0x58, 0x4f, 0x57, 0x4e, 0x5a, 0x50, 0x5e, 0x52, 0x61, 0x53, 0x66, 0x53, 0x6c, 0x53, 0x72, 0x53, 
+0x78, 0x52, 0x80, 0x51, 0x89, 0x50, 0x94, 0x4e, 0xa1, 0x4c, 0xba, 0x46, 0xc2, 0x47, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x36, 0x16, 0x38, 0x27, 0x3f, 0x37, 0x46, 0x41, 0x4a, 
+0x4b, 0x4f, 0x52, 0x51, 0x57, 0x53, 0x5c, 0x54, 0x5f, 0x56, 0x62, 0x56, 0x65, 0x57, 0x67, 0x58, 
+0x6a, 0x58, 0x6c, 0x58, 0x6f, 0x58, 0x6f, 0x57, 0x6d, 0x56, 0x6c, 0x55, 0x6a, 0x53, 0x67, 0x50, 
+0x64, 0x4f, 0x61, 0x4f, 0x5e, 0x4e, 0x5c, 0x4f, 0x5b, 0x51, 0x5b, 0x52, 0x5b, 0x52, 0x5a, 0x53, 
+0x58, 0x52, 0x5a, 0x54, 0x5d, 0x55, 0x60, 0x56, 0x63, 0x57, 0x66, 0x57, 0x6b, 0x58, 0x70, 0x58, 
+0x75, 0x58, 0x7e, 0x56, 0x87, 0x55, 0x91, 0x54, 0x9f, 0x52, 0xb8, 0x4e, 0xc2, 0x4e, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x09, 0x3a, 0x0f, 0x3a, 0x1a, 0x3d, 0x2f, 0x45, 0x3d, 0x4b, 0x48, 0x50, 
+0x4f, 0x53, 0x54, 0x54, 0x59, 0x56, 0x5d, 0x57, 0x60, 0x58, 0x63, 0x58, 0x65, 0x59, 0x68, 0x59, 
+0x6a, 0x5a, 0x6c, 0x5a, 0x6e, 0x59, 0x6d, 0x59, 0x6c, 0x58, 0x6b, 0x57, 0x69, 0x55, 0x66, 0x53, 
+0x63, 0x52, 0x61, 0x52, 0x5f, 0x52, 0x5d, 0x52, 0x5c, 0x54, 0x5c, 0x54, 0x5b, 0x55, 0x5b, 0x55, 
+0x5a, 0x55, 0x5c, 0x56, 0x5e, 0x57, 0x61, 0x58, 0x63, 0x59, 0x66, 0x59, 0x6b, 0x59, 0x6f, 0x5a, 
+0x74, 0x5a, 0x7a, 0x5a, 0x84, 0x59, 0x8f, 0x58, 0x9d, 0x57, 0xb6, 0x55, 0xc2, 0x54, 0xc6, 0x55, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x09, 0x3d, 0x12, 0x3f, 0x1f, 0x43, 0x36, 0x4c, 0x44, 0x51, 0x4b, 0x54, 
+0x51, 0x55, 0x56, 0x57, 0x5a, 0x58, 0x5e, 0x59, 0x61, 0x5a, 0x63, 0x5a, 0x66, 0x5b, 0x68, 0x5b, 
+0x6a, 0x5b, 0x6c, 0x5b, 0x6d, 0x5b, 0x6c, 0x5a, 0x6b, 0x5a, 0x6a, 0x59, 0x68, 0x56, 0x65, 0x56, 
+0x63, 0x55, 0x61, 0x54, 0x5f, 0x54, 0x5d, 0x54, 0x5d, 0x56, 0x5c, 0x56, 0x5c, 0x56, 0x5b, 0x56, 
+0x5b, 0x57, 0x5d, 0x58, 0x5f, 0x59, 0x62, 0x5a, 0x64, 0x5a, 0x67, 0x5b, 0x6b, 0x5b, 0x6f, 0x5b, 
+0x74, 0x5b, 0x7a, 0x5c, 0x81, 0x5b, 0x8d, 0x5a, 0x9d, 0x59, 0xb5, 0x58, 0xc1, 0x58, 0xc7, 0x5a, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x06, 0x42, 0x0a, 0x42, 0x16, 0x44, 0x27, 0x49, 0x3e, 0x52, 0x47, 0x55, 0x4d, 0x56, 
+0x52, 0x58, 0x57, 0x59, 0x5b, 0x5a, 0x5f, 0x5b, 0x62, 0x5b, 0x64, 0x5c, 0x66, 0x5c, 0x68, 0x5d, 
+0x6a, 0x5d, 0x6c, 0x5d, 0x6d, 0x5d, 0x6c, 0x5c, 0x6a, 0x5b, 0x69, 0x5a, 0x67, 0x59, 0x65, 0x58, 
+0x62, 0x57, 0x60, 0x57, 0x5e, 0x57, 0x5d, 0x57, 0x5d, 0x58, 0x5c, 0x58, 0x5c, 0x58, 0x5a, 0x58, 
+0x5c, 0x59, 0x5e, 0x5a, 0x60, 0x5b, 0x62, 0x5c, 0x64, 0x5c, 0x67, 0x5c, 0x6b, 0x5d, 0x6f, 0x5d, 
+0x74, 0x5d, 0x79, 0x5d, 0x80, 0x5d, 0x89, 0x5d, 0x9d, 0x5b, 0xb4, 0x5a, 0xc1, 0x5b, 0xc7, 0x5c, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x05, 0x46, 0x0c, 0x47, 0x19, 0x49, 0x33, 0x51, 0x41, 0x55, 0x49, 0x57, 0x4f, 0x59, 
+0x54, 0x5a, 0x58, 0x5b, 0x5c, 0x5c, 0x60, 0x5d, 0x63, 0x5d, 0x65, 0x5e, 0x67, 0x5e, 0x68, 0x5e, 
+0x6a, 0x5f, 0x6c, 0x5f, 0x6c, 0x5e, 0x6b, 0x5e, 0x6a, 0x5d, 0x68, 0x5c, 0x66, 0x5b, 0x64, 0x5a, 
+0x62, 0x5a, 0x60, 0x59, 0x5e, 0x59, 0x5d, 0x5a, 0x5d, 0x5a, 0x5c, 0x5a, 0x5c, 0x5a, 0x5b, 0x5a, 
+0x5d, 0x5b, 0x5f, 0x5c, 0x61, 0x5d, 0x63, 0x5d, 0x65, 0x5e, 0x68, 0x5e, 0x6c, 0x5e, 0x70, 0x5f, 
+0x74, 0x5f, 0x79, 0x5f, 0x80, 0x5f, 0x88, 0x5f, 0x9c, 0x5e, 0xb3, 0x5d, 0xc1, 0x5e, 0xc7, 0x5f, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x04, 0x4e, 0x0e, 0x4e, 0x1d, 0x4f, 0x38, 0x56, 0x43, 0x59, 0x4a, 0x5a, 0x50, 0x5b, 
+0x55, 0x5c, 0x59, 0x5d, 0x5d, 0x5e, 0x61, 0x5e, 0x63, 0x5f, 0x65, 0x60, 0x67, 0x60, 0x69, 0x60, 
+0x6a, 0x60, 0x6c, 0x61, 0x6b, 0x60, 0x6a, 0x60, 0x69, 0x5f, 0x67, 0x5e, 0x65, 0x5d, 0x63, 0x5d, 
+0x61, 0x5c, 0x5f, 0x5c, 0x5e, 0x5c, 0x5d, 0x5c, 0x5d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 
+0x5e, 0x5d, 0x60, 0x5e, 0x61, 0x5f, 0x63, 0x5f, 0x65, 0x5f, 0x68, 0x60, 0x6c, 0x60, 0x70, 0x60, 
+0x74, 0x61, 0x7a, 0x61, 0x80, 0x61, 0x88, 0x61, 0x9b, 0x61, 0xb3, 0x61, 0xc0, 0x61, 0xc7, 0x62, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x57, 0x04, 0x57, 0x0f, 0x57, 0x1e, 0x58, 0x3b, 0x5c, 0x44, 0x5d, 0x4b, 0x5d, 0x51, 0x5e, 
+0x55, 0x5e, 0x5a, 0x5f, 0x5d, 0x60, 0x61, 0x60, 0x64, 0x61, 0x66, 0x61, 0x67, 0x62, 0x69, 0x62, 
+0x6a, 0x62, 0x6c, 0x63, 0x6b, 0x62, 0x6a, 0x62, 0x68, 0x62, 0x66, 0x61, 0x64, 0x60, 0x62, 0x60, 
+0x60, 0x5f, 0x5f, 0x5f, 0x5d, 0x5e, 0x5d, 0x5f, 0x5c, 0x5f, 0x5c, 0x5e, 0x5b, 0x5e, 0x5d, 0x5f, 
+0x5f, 0x5f, 0x60, 0x60, 0x62, 0x60, 0x64, 0x61, 0x66, 0x61, 0x68, 0x62, 0x6c, 0x62, 0x70, 0x62, 
+0x75, 0x62, 0x7a, 0x63, 0x80, 0x63, 0x89, 0x63, 0x9a, 0x64, 0xb3, 0x65, 0xc1, 0x65, 0xc7, 0x66, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x60, 0x04, 0x60, 0x0f, 0x60, 0x1f, 0x60, 0x3b, 0x61, 0x45, 0x62, 0x4c, 0x62, 0x51, 0x62, 
+0x56, 0x62, 0x5a, 0x62, 0x5e, 0x62, 0x62, 0x62, 0x64, 0x63, 0x66, 0x63, 0x68, 0x64, 0x69, 0x64, 
+0x6b, 0x65, 0x6b, 0x65, 0x6a, 0x65, 0x69, 0x64, 0x68, 0x64, 0x66, 0x63, 0x63, 0x63, 0x61, 0x62, 
+0x60, 0x62, 0x5e, 0x61, 0x5d, 0x61, 0x5d, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5e, 0x61, 
+0x5f, 0x62, 0x61, 0x62, 0x62, 0x62, 0x64, 0x63, 0x66, 0x63, 0x68, 0x64, 0x6c, 0x64, 0x70, 0x64, 
+0x75, 0x65, 0x7a, 0x65, 0x80, 0x65, 0x8a, 0x66, 0x9b, 0x67, 0xb4, 0x69, 0xc1, 0x6a, 0xc7, 0x6a, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x69, 0x04, 0x69, 0x0f, 0x69, 0x1f, 0x68, 0x3b, 0x67, 0x45, 0x66, 0x4b, 0x66, 0x51, 0x66, 
+0x56, 0x66, 0x5a, 0x66, 0x5e, 0x66, 0x62, 0x66, 0x65, 0x66, 0x66, 0x66, 0x68, 0x66, 0x6a, 0x67, 
+0x6b, 0x67, 0x6b, 0x67, 0x6a, 0x67, 0x69, 0x67, 0x67, 0x67, 0x65, 0x66, 0x63, 0x66, 0x61, 0x65, 
+0x5f, 0x65, 0x5d, 0x64, 0x5d, 0x64, 0x5c, 0x63, 0x5c, 0x63, 0x5c, 0x63, 0x5c, 0x63, 0x5e, 0x63, 
+0x5f, 0x64, 0x61, 0x64, 0x63, 0x64, 0x65, 0x65, 0x66, 0x65, 0x69, 0x66, 0x6d, 0x66, 0x71, 0x67, 
+0x75, 0x67, 0x7a, 0x68, 0x81, 0x68, 0x8e, 0x6a, 0x9c, 0x6b, 0xb5, 0x6e, 0xc2, 0x6f, 0xc7, 0x6f, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x71, 0x04, 0x72, 0x0f, 0x72, 0x1e, 0x71, 0x3a, 0x6c, 0x44, 0x6b, 0x4b, 0x6b, 0x51, 0x6a, 
+0x56, 0x6a, 0x5a, 0x6a, 0x5e, 0x6a, 0x62, 0x6a, 0x65, 0x6a, 0x66, 0x6a, 0x68, 0x6a, 0x6a, 0x6a, 
+0x6c, 0x6a, 0x6b, 0x6a, 0x6a, 0x6a, 0x68, 0x6a, 0x66, 0x6a, 0x64, 0x69, 0x62, 0x69, 0x60, 0x68, 
+0x5e, 0x67, 0x5d, 0x67, 0x5c, 0x66, 0x5c, 0x66, 0x5c, 0x65, 0x5b, 0x65, 0x5c, 0x65, 0x5e, 0x65, 
+0x60, 0x66, 0x61, 0x66, 0x63, 0x66, 0x65, 0x67, 0x67, 0x68, 0x69, 0x68, 0x6d, 0x69, 0x71, 0x69, 
+0x76, 0x6a, 0x7b, 0x6b, 0x82, 0x6c, 0x90, 0x6f, 0x9e, 0x71, 0xb7, 0x75, 0xc2, 0x75, 0xc6, 0x75, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x04, 0x7b, 0x0e, 0x7b, 0x1c, 0x7a, 0x38, 0x73, 0x43, 0x71, 0x4b, 0x70, 0x50, 0x6f, 
+0x55, 0x6e, 0x5a, 0x6e, 0x5e, 0x6e, 0x62, 0x6e, 0x65, 0x6e, 0x67, 0x6e, 0x68, 0x6e, 0x6a, 0x6e, 
+0x6b, 0x6e, 0x6a, 0x6e, 0x69, 0x6d, 0x68, 0x6d, 0x66, 0x6d, 0x63, 0x6c, 0x61, 0x6b, 0x5f, 0x6b, 
+0x5d, 0x6a, 0x5c, 0x69, 0x5c, 0x68, 0x5b, 0x68, 0x5b, 0x67, 0x5b, 0x67, 0x5c, 0x67, 0x5e, 0x67, 
+0x60, 0x68, 0x62, 0x68, 0x64, 0x68, 0x66, 0x69, 0x68, 0x6a, 0x6a, 0x6a, 0x6e, 0x6b, 0x72, 0x6c, 
+0x77, 0x6d, 0x7c, 0x6e, 0x84, 0x70, 0x92, 0x74, 0xa1, 0x77, 0xb8, 0x7c, 0xc2, 0x7d, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x06, 0x84, 0x0d, 0x85, 0x1a, 0x83, 0x32, 0x7c, 0x41, 0x77, 0x49, 0x75, 0x50, 0x74, 
+0x55, 0x73, 0x59, 0x73, 0x5e, 0x72, 0x62, 0x72, 0x65, 0x72, 0x67, 0x72, 0x68, 0x72, 0x6a, 0x73, 
+0x6b, 0x73, 0x6a, 0x72, 0x68, 0x71, 0x66, 0x72, 0x64, 0x71, 0x62, 0x70, 0x60, 0x6f, 0x5e, 0x6e, 
+0x5c, 0x6d, 0x5b, 0x6b, 0x5b, 0x6a, 0x5b, 0x6a, 0x5b, 0x69, 0x5b, 0x69, 0x5d, 0x69, 0x5e, 0x69, 
+0x60, 0x69, 0x62, 0x6a, 0x64, 0x6a, 0x66, 0x6b, 0x68, 0x6c, 0x6b, 0x6c, 0x6f, 0x6d, 0x73, 0x6e, 
+0x78, 0x70, 0x7e, 0x71, 0x87, 0x74, 0x96, 0x79, 0xa7, 0x7f, 0xba, 0x84, 0xc1, 0x84, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x08, 0x8c, 0x0d, 0x8e, 0x17, 0x8d, 0x25, 0x8a, 0x3d, 0x7f, 0x48, 0x7b, 0x4e, 0x79, 
+0x54, 0x78, 0x59, 0x78, 0x5d, 0x77, 0x62, 0x77, 0x65, 0x77, 0x67, 0x77, 0x69, 0x77, 0x6b, 0x78, 
+0x6a, 0x77, 0x69, 0x77, 0x67, 0x76, 0x65, 0x77, 0x63, 0x76, 0x60, 0x74, 0x5e, 0x73, 0x5c, 0x71, 
+0x5b, 0x70, 0x5b, 0x6d, 0x5b, 0x6c, 0x5a, 0x6c, 0x5a, 0x6b, 0x5b, 0x6b, 0x5d, 0x6b, 0x5e, 0x6b, 
+0x61, 0x6b, 0x63, 0x6b, 0x65, 0x6c, 0x67, 0x6d, 0x69, 0x6d, 0x6c, 0x6e, 0x70, 0x70, 0x74, 0x71, 
+0x7a, 0x72, 0x80, 0x75, 0x8d, 0x7a, 0x9b, 0x7f, 0xb1, 0x87, 0xbb, 0x8a, 0xc0, 0x89, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x96, 0x16, 0x97, 0x22, 0x95, 0x2f, 0x92, 0x44, 0x84, 0x4d, 0x81, 
+0x53, 0x7f, 0x58, 0x7e, 0x5d, 0x7d, 0x62, 0x7d, 0x65, 0x7d, 0x67, 0x7d, 0x69, 0x7d, 0x6b, 0x7e, 
+0x69, 0x7d, 0x67, 0x7c, 0x65, 0x7e, 0x62, 0x7c, 0x60, 0x7a, 0x5e, 0x78, 0x5c, 0x76, 0x5a, 0x74, 
+0x59, 0x73, 0x5a, 0x6f, 0x5a, 0x6e, 0x5a, 0x6d, 0x58, 0x6d, 0x5a, 0x6d, 0x5d, 0x6c, 0x5f, 0x6c, 
+0x61, 0x6d, 0x63, 0x6d, 0x66, 0x6e, 0x68, 0x6e, 0x6a, 0x6f, 0x6d, 0x71, 0x71, 0x72, 0x76, 0x73, 
+0x7c, 0x75, 0x83, 0x78, 0x93, 0x80, 0xa8, 0x89, 0xb4, 0x8d, 0xbc, 0x8e, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x12, 0x9d, 0x17, 0xa0, 0x20, 0xa0, 0x2b, 0x9e, 0x37, 0x9a, 0x49, 0x8b, 
+0x51, 0x87, 0x57, 0x85, 0x5d, 0x84, 0x62, 0x84, 0x65, 0x84, 0x67, 0x84, 0x6a, 0x85, 0x69, 0x84, 
+0x67, 0x84, 0x64, 0x86, 0x62, 0x84, 0x5f, 0x82, 0x5c, 0x80, 0x5a, 0x7d, 0x58, 0x7a, 0x57, 0x78, 
+0x56, 0x76, 0x58, 0x72, 0x59, 0x70, 0x59, 0x6f, 0x58, 0x6f, 0x5a, 0x6e, 0x5c, 0x6e, 0x5f, 0x6e, 
+0x61, 0x6e, 0x64, 0x6f, 0x66, 0x6f, 0x69, 0x70, 0x6b, 0x72, 0x6e, 0x73, 0x73, 0x74, 0x78, 0x76, 
+0x7f, 0x79, 0x88, 0x7d, 0xa0, 0x8a, 0xad, 0x8f, 0xb7, 0x92, 0xbc, 0x92, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x19, 0xa7, 0x20, 0xa9, 0x29, 0xa9, 0x33, 0xa7, 0x3e, 0xa4, 
+0x4b, 0x9a, 0x55, 0x92, 0x5b, 0x8f, 0x61, 0x8e, 0x65, 0x8e, 0x68, 0x8f, 0x6b, 0x90, 0x67, 0x93, 
+0x63, 0x92, 0x60, 0x90, 0x5d, 0x8d, 0x5a, 0x8a, 0x57, 0x86, 0x55, 0x82, 0x53, 0x7f, 0x53, 0x7c, 
+0x54, 0x78, 0x56, 0x74, 0x57, 0x72, 0x58, 0x71, 0x57, 0x70, 0x5a, 0x70, 0x5c, 0x70, 0x5f, 0x70, 
+0x62, 0x70, 0x65, 0x71, 0x67, 0x72, 0x6a, 0x73, 0x6d, 0x74, 0x70, 0x76, 0x76, 0x78, 0x7c, 0x7a, 
+0x85, 0x7f, 0x93, 0x87, 0xa6, 0x90, 0xb1, 0x94, 0xb8, 0x95, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x22, 0xaf, 0x29, 0xb2, 0x32, 0xb3, 0x3b, 0xb2, 
+0x45, 0xb0, 0x4f, 0xae, 0x58, 0xac, 0x60, 0xab, 0x66, 0xab, 0x6a, 0xac, 0x6e, 0xad, 0x60, 0xa9, 
+0x5a, 0xa7, 0x54, 0xa4, 0x4f, 0x9f, 0x4a, 0x9a, 0x48, 0x95, 0x46, 0x8f, 0x47, 0x8a, 0x48, 0x86, 
+0x4e, 0x7d, 0x51, 0x79, 0x53, 0x77, 0x51, 0x75, 0x54, 0x74, 0x58, 0x74, 0x5b, 0x73, 0x5f, 0x73, 
+0x62, 0x74, 0x66, 0x75, 0x69, 0x76, 0x6d, 0x77, 0x70, 0x79, 0x75, 0x7b, 0x7b, 0x7e, 0x83, 0x81, 
+0x8c, 0x86, 0x9e, 0x90, 0xab, 0x96, 0xb4, 0x98, 0xb9, 0x98, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x33, 0xba, 0x3b, 0xbc, 
+0x44, 0xbc, 0x4d, 0xbc, 0x57, 0xbb, 0x60, 0xbb, 0x66, 0xbb, 0x6a, 0xbb, 0x6f, 0xbc, 0x58, 0xb9, 
+0x51, 0xb6, 0x4a, 0xb2, 0x44, 0xad, 0x41, 0xa8, 0x3f, 0xa1, 0x3f, 0x9b, 0x41, 0x95, 0x44, 0x8f, 
+0x4d, 0x83, 0x50, 0x7f, 0x4b, 0x79, 0x4f, 0x77, 0x53, 0x76, 0x57, 0x75, 0x5b, 0x75, 0x5f, 0x76, 
+0x63, 0x76, 0x67, 0x77, 0x6b, 0x78, 0x6f, 0x7a, 0x73, 0x7c, 0x78, 0x7f, 0x7f, 0x82, 0x87, 0x86, 
+0x92, 0x8b, 0xa6, 0x97, 0xb0, 0x9a, 0xb6, 0x9b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3d, 0xc0, 
+0x45, 0xc2, 0x4e, 0xc4, 0x57, 0xc4, 0x60, 0xc5, 0x66, 0xc5, 0x6a, 0xc5, 0x58, 0xc4, 0x50, 0xc3, 
+0x48, 0xc1, 0x42, 0xbe, 0x3d, 0xba, 0x3a, 0xb5, 0x39, 0xaf, 0x3a, 0xa9, 0x3d, 0xa2, 0x41, 0x9b, 
+0x4c, 0x8a, 0x4f, 0x85, 0x48, 0x7a, 0x4d, 0x79, 0x52, 0x78, 0x56, 0x77, 0x5b, 0x77, 0x60, 0x77, 
+0x64, 0x78, 0x69, 0x79, 0x6e, 0x7b, 0x72, 0x7d, 0x77, 0x80, 0x7c, 0x83, 0x84, 0x86, 0x8d, 0x8b, 
+0x9a, 0x92, 0xac, 0x9c, 0xb3, 0x9d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x3c, 0xbf, 0x39, 0xbd, 0x38, 0xba, 0x39, 0xb6, 0x3b, 0xaf, 0x43, 0xa2, 
+0x4b, 0x92, 0x3e, 0x7e, 0x45, 0x7b, 0x4b, 0x7a, 0x50, 0x79, 0x56, 0x78, 0x5b, 0x78, 0x60, 0x79, 
+0x66, 0x7a, 0x6b, 0x7c, 0x70, 0x7e, 0x76, 0x80, 0x7b, 0x83, 0x81, 0x87, 0x8a, 0x8b, 0x94, 0x90, 
+0xa2, 0x98, 0xb0, 0x9f, 0xb4, 0x9e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3b, 0xbf, 0x3b, 0xbd, 0x3c, 0xb9, 0x45, 0xa7, 
+0x31, 0x82, 0x3a, 0x7e, 0x42, 0x7c, 0x48, 0x7a, 0x4f, 0x79, 0x55, 0x79, 0x5b, 0x79, 0x61, 0x7a, 
+0x68, 0x7b, 0x6e, 0x7d, 0x74, 0x80, 0x7a, 0x83, 0x80, 0x86, 0x87, 0x8a, 0x91, 0x8f, 0x9c, 0x94, 
+0xad, 0x9f, 0xb3, 0x9f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x3e, 0xc0, 0x3f, 0xbe, 0x1f, 0x86, 
+0x2c, 0x80, 0x36, 0x7c, 0x3e, 0x7a, 0x46, 0x79, 0x4d, 0x78, 0x54, 0x78, 0x5c, 0x79, 0x63, 0x7a, 
+0x6a, 0x7c, 0x71, 0x7e, 0x78, 0x81, 0x7f, 0x84, 0x86, 0x88, 0x8e, 0x8d, 0x98, 0x92, 0xa4, 0x98, 
+0xb2, 0xa0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x07, 0x88, 0x1a, 0x80, 
+0x27, 0x7b, 0x31, 0x78, 0x3b, 0x77, 0x43, 0x76, 0x4c, 0x76, 0x54, 0x76, 0x5c, 0x77, 0x65, 0x78, 
+0x6d, 0x7b, 0x75, 0x7d, 0x7d, 0x81, 0x85, 0x85, 0x8d, 0x89, 0x96, 0x8e, 0xa0, 0x94, 0xac, 0x9a, 
+0xb5, 0x9d, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x05, 0x7c, 0x16, 0x77, 
+0x23, 0x73, 0x2d, 0x71, 0x38, 0x70, 0x41, 0x70, 0x4b, 0x70, 0x54, 0x71, 0x5e, 0x73, 0x67, 0x75, 
+0x71, 0x77, 0x7a, 0x7a, 0x83, 0x7e, 0x8c, 0x83, 0x95, 0x88, 0x9e, 0x8d, 0xa8, 0x93, 0xb3, 0x99, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x05, 0x6d, 0x14, 0x6a, 
+0x20, 0x68, 0x2b, 0x67, 0x36, 0x67, 0x40, 0x67, 0x4b, 0x68, 0x55, 0x69, 0x60, 0x6b, 0x6a, 0x6e, 
+0x75, 0x71, 0x7f, 0x75, 0x89, 0x79, 0x93, 0x7e, 0x9c, 0x84, 0xa6, 0x8a, 0xb0, 0x8f, 0xba, 0x95, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x4d, 0x14, 0x50, 
+0x1f, 0x52, 0x2a, 0x55, 0x36, 0x58, 0x41, 0x5b, 0x4c, 0x5e, 0x57, 0x60, 0x62, 0x63, 0x6e, 0x66, 
+0x79, 0x69, 0x84, 0x6c, 0x8f, 0x6e, 0x9a, 0x71, 0xa6, 0x74, 0xb1, 0x77, 0xbc, 0x7a, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x4e, 0x17, 0x50, 
+0x22, 0x53, 0x2d, 0x56, 0x38, 0x59, 0x44, 0x5c, 0x4f, 0x5e, 0x5a, 0x61, 0x65, 0x64, 0x70, 0x67, 
+0x7c, 0x6a, 0x87, 0x6c, 0x92, 0x6f, 0x9d, 0x72, 0xa8, 0x75, 0xb4, 0x78, 0xbf, 0x7a, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x4b, 0x0e, 0x4e, 0x1a, 0x51, 
+0x25, 0x54, 0x30, 0x57, 0x3b, 0x59, 0x46, 0x5c, 0x52, 0x5f, 0x5d, 0x62, 0x68, 0x65, 0x73, 0x67, 
+0x7e, 0x6a, 0x8a, 0x6d, 0x95, 0x70, 0xa0, 0x73, 0xab, 0x75, 0xb6, 0x78, 0xc2, 0x7b, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x06, 0x4c, 0x11, 0x4f, 0x1c, 0x52, 
+0x28, 0x55, 0x33, 0x57, 0x3e, 0x5a, 0x49, 0x5d, 0x54, 0x60, 0x60, 0x63, 0x6b, 0x65, 0x76, 0x68, 
+0x81, 0x6b, 0x8c, 0x6e, 0x98, 0x71, 0xa3, 0x73, 0xae, 0x76, 0xb9, 0x79, 0xc4, 0x7c, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x4d, 0x14, 0x50, 0x1f, 0x52, 
+0x2a, 0x55, 0x36, 0x58, 0x41, 0x5b, 0x4c, 0x5e, 0x57, 0x60, 0x62, 0x63, 0x6e, 0x66, 0x79, 0x69, 
+0x84, 0x6c, 0x8f, 0x6e, 0x9a, 0x71, 0xa6, 0x74, 0xb1, 0x77, 0xbc, 0x7a, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x4e, 0x17, 0x50, 0x22, 0x53, 
+0x2d, 0x56, 0x38, 0x59, 0x44, 0x5c, 0x4f, 0x5e, 0x5a, 0x61, 0x65, 0x64, 0x70, 0x67, 0x7c, 0x6a, 
+0x87, 0x6c, 0x92, 0x6f, 0x9d, 0x72, 0xa8, 0x75, 0xb4, 0x78, 0xbf, 0x7a, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x50, 0x0e, 0x50, 0x1a, 0x51, 0x25, 0x54, 
+0x30, 0x57, 0x3b, 0x59, 0x46, 0x5c, 0x52, 0x5f, 0x5d, 0x62, 0x68, 0x65, 0x73, 0x67, 0x7e, 0x6a, 
+0x8a, 0x6d, 0x95, 0x70, 0xa0, 0x73, 0xab, 0x75, 0xb6, 0x78, 0xc2, 0x7b, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x5c, 0x0e, 0x5c, 0x1a, 0x5c, 0x26, 0x5c, 
+0x32, 0x5c, 0x3d, 0x5c, 0x49, 0x5d, 0x54, 0x60, 0x60, 0x63, 0x6b, 0x65, 0x76, 0x68, 0x81, 0x6b, 
+0x8c, 0x6e, 0x98, 0x71, 0xa3, 0x73, 0xae, 0x76, 0xb9, 0x79, 0xc4, 0x7c, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x68, 0x0e, 0x68, 0x1a, 0x68, 0x26, 0x68, 
+0x32, 0x68, 0x3d, 0x68, 0x49, 0x68, 0x55, 0x68, 0x61, 0x68, 0x6d, 0x68, 0x79, 0x69, 0x84, 0x6c, 
+0x8f, 0x6e, 0x9a, 0x71, 0xa6, 0x74, 0xb1, 0x77, 0xbc, 0x7a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x74, 0x0e, 0x74, 0x1a, 0x74, 0x26, 0x74, 
+0x32, 0x74, 0x3d, 0x74, 0x49, 0x74, 0x55, 0x74, 0x61, 0x74, 0x6d, 0x74, 0x79, 0x74, 0x85, 0x74, 
+0x91, 0x74, 0x9d, 0x74, 0xa8, 0x75, 0xb4, 0x78, 0xbf, 0x7a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x80, 0x1a, 0x80, 0x26, 0x80, 
+0x32, 0x80, 0x3d, 0x80, 0x49, 0x80, 0x55, 0x80, 0x61, 0x80, 0x6d, 0x80, 0x79, 0x80, 0x85, 0x80, 
+0x91, 0x80, 0x9d, 0x80, 0xa9, 0x80, 0xb4, 0x80, 0xc0, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8c, 0x1a, 0x8c, 0x26, 0x8c, 
+0x32, 0x8c, 0x3d, 0x8c, 0x49, 0x8c, 0x55, 0x8c, 0x61, 0x8c, 0x6d, 0x8c, 0x79, 0x8c, 0x85, 0x8c, 
+0x91, 0x8c, 0x9d, 0x8c, 0xa9, 0x8c, 0xb4, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0x98, 0x26, 0x98, 
+0x32, 0x98, 0x3d, 0x98, 0x49, 0x98, 0x55, 0x98, 0x61, 0x98, 0x6d, 0x98, 0x79, 0x98, 0x85, 0x98, 
+0x91, 0x98, 0x9d, 0x98, 0xa9, 0x98, 0xb4, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0xa4, 0x26, 0xa4, 
+0x32, 0xa4, 0x3d, 0xa4, 0x49, 0xa4, 0x55, 0xa4, 0x61, 0xa4, 0x6d, 0xa4, 0x79, 0xa4, 0x85, 0xa4, 
+0x91, 0xa4, 0x9d, 0xa4, 0xa9, 0xa4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0xb0, 
+0x32, 0xb0, 0x3d, 0xb0, 0x49, 0xb0, 0x55, 0xb0, 0x61, 0xb0, 0x6d, 0xb0, 0x79, 0xb0, 0x85, 0xb0, 
+0x91, 0xb0, 0x9d, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x00, 0xfe, 0x3d, 0xbc, 0x49, 0xbc, 0x55, 0xbc, 0x61, 0xbc, 0x6d, 0xbc, 0x79, 0xbc, 0x85, 0xbc, 
+0x91, 0xbc, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x57, 0x00, 0x60, 0x00, 0x66, 0x00, 0x6a, 0x00, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3d, 0x08, 
+0x45, 0x05, 0x4e, 0x04, 0x57, 0x04, 0x60, 0x04, 0x66, 0x04, 0x6b, 0x03, 0x6f, 0x03, 0x72, 0x03, 
+0x76, 0x03, 0x79, 0x02, 0x7b, 0x02, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2b, 0x11, 0x32, 0x0e, 0x3b, 0x0d, 
+0x44, 0x0d, 0x4e, 0x0e, 0x57, 0x0f, 0x60, 0x0f, 0x66, 0x0f, 0x6a, 0x0f, 0x6e, 0x0e, 0x72, 0x0c, 
+0x76, 0x0b, 0x79, 0x09, 0x7c, 0x07, 0x7f, 0x06, 0x81, 0x05, 0x82, 0x04, 0x82, 0x04, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x19, 0x29, 0x16, 0x32, 0x16, 0x3c, 0x18, 
+0x46, 0x1a, 0x4f, 0x1d, 0x58, 0x1e, 0x60, 0x1f, 0x66, 0x1f, 0x6a, 0x1f, 0x6d, 0x1d, 0x71, 0x1b, 
+0x75, 0x19, 0x78, 0x16, 0x7c, 0x13, 0x7f, 0x10, 0x81, 0x0d, 0x83, 0x0a, 0x84, 0x08, 0x84, 0x06, 
+0x82, 0x05, 0x7f, 0x04, 0x7b, 0x02, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 
+0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x19, 0x22, 0x1f, 0x1f, 0x29, 0x20, 0x34, 0x22, 0x3f, 0x26, 
+0x4d, 0x34, 0x56, 0x38, 0x5c, 0x3b, 0x61, 0x3b, 0x65, 0x3b, 0x68, 0x3b, 0x6a, 0x3a, 0x6d, 0x37, 
+0x71, 0x31, 0x74, 0x2f, 0x77, 0x2c, 0x79, 0x28, 0x7c, 0x25, 0x7e, 0x21, 0x80, 0x1d, 0x81, 0x19, 
+0x80, 0x15, 0x7f, 0x11, 0x7b, 0x0f, 0x75, 0x0d, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 
+0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x68, 0x0b, 0x74, 0x0b, 0x80, 0x0b, 
+0x8c, 0x0b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x11, 0x2b, 0x16, 0x29, 0x20, 0x29, 0x2c, 0x2c, 0x3b, 0x33, 0x4a, 0x3e, 
+0x52, 0x42, 0x57, 0x43, 0x5d, 0x44, 0x62, 0x45, 0x65, 0x45, 0x67, 0x45, 0x69, 0x44, 0x6c, 0x43, 
+0x6e, 0x41, 0x72, 0x3b, 0x74, 0x39, 0x77, 0x36, 0x7a, 0x33, 0x7c, 0x2f, 0x7e, 0x2b, 0x7f, 0x27, 
+0x7f, 0x23, 0x7e, 0x1f, 0x7a, 0x1b, 0x75, 0x19, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 
+0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x68, 0x17, 0x74, 0x17, 0x80, 0x17, 
+0x8c, 0x17, 0x98, 0x17, 0xa4, 0x17, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x32, 0x16, 0x32, 0x22, 0x34, 0x33, 0x3b, 0x45, 0x45, 0x4d, 0x48, 
+0x53, 0x4a, 0x58, 0x4b, 0x5d, 0x4b, 0x62, 0x4c, 0x65, 0x4c, 0x67, 0x4b, 0x69, 0x4b, 0x6b, 0x4a, 
+0x6d, 0x49, 0x6f, 0x48, 0x73, 0x43, 0x75, 0x40, 0x78, 0x3e, 0x7a, 0x3a, 0x7c, 0x37, 0x7d, 0x33, 
+0x7e, 0x2f, 0x7d, 0x2b, 0x7a, 0x28, 0x74, 0x25, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 
+0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x68, 0x23, 0x74, 0x23, 0x80, 0x23, 
+0x8c, 0x23, 0x98, 0x23, 0xa4, 0x23, 0xb0, 0x23, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x08, 0x3d, 0x0d, 0x3b, 0x18, 0x3c, 0x26, 0x3f, 0x3e, 0x4a, 0x48, 0x4d, 0x4f, 0x4f, 
+0x54, 0x50, 0x59, 0x50, 0x5e, 0x51, 0x62, 0x51, 0x65, 0x51, 0x67, 0x51, 0x69, 0x51, 0x6a, 0x50, 
+0x6c, 0x50, 0x6e, 0x4f, 0x70, 0x4d, 0x74, 0x49, 0x76, 0x47, 0x79, 0x44, 0x7b, 0x41, 0x7c, 0x3e, 
+0x7d, 0x3b, 0x7c, 0x37, 0x79, 0x34, 0x74, 0x31, 0x6c, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 
+0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x68, 0x2f, 0x74, 0x2f, 0x80, 0x2f, 
+0x8c, 0x2f, 0x98, 0x2f, 0xa4, 0x2f, 0xb0, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x05, 0x45, 0x0d, 0x44, 0x1a, 0x46, 0x34, 0x4d, 0x42, 0x52, 0x4a, 0x53, 0x50, 0x54, 
+0x55, 0x55, 0x59, 0x55, 0x5e, 0x56, 0x62, 0x56, 0x65, 0x56, 0x67, 0x56, 0x68, 0x55, 0x6a, 0x55, 
+0x6c, 0x55, 0x6e, 0x54, 0x70, 0x53, 0x72, 0x51, 0x76, 0x4e, 0x78, 0x4c, 0x7a, 0x4a, 0x7b, 0x48, 
+0x7c, 0x45, 0x7b, 0x42, 0x79, 0x3f, 0x74, 0x3d, 0x6c, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 
+0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x68, 0x3b, 0x74, 0x3b, 0x80, 0x3b, 
+0x8c, 0x3b, 0x98, 0x3b, 0xa4, 0x3b, 0xb0, 0x3b, 0xbc, 0x3b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x04, 0x4e, 0x0e, 0x4e, 0x1d, 0x4f, 0x38, 0x56, 0x43, 0x57, 0x4b, 0x58, 0x50, 0x59, 
+0x55, 0x59, 0x5a, 0x5a, 0x5e, 0x5a, 0x62, 0x5a, 0x65, 0x5a, 0x67, 0x5a, 0x68, 0x5a, 0x6a, 0x5a, 
+0x6c, 0x59, 0x6d, 0x59, 0x6f, 0x59, 0x71, 0x58, 0x75, 0x55, 0x77, 0x54, 0x79, 0x52, 0x7a, 0x51, 
+0x7b, 0x4f, 0x7b, 0x4d, 0x79, 0x4a, 0x74, 0x49, 0x6c, 0x47, 0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 
+0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 0x68, 0x47, 0x74, 0x47, 0x80, 0x47, 
+0x8c, 0x47, 0x98, 0x47, 0xa4, 0x47, 0xb0, 0x47, 0xbc, 0x47, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x57, 0x04, 0x57, 0x0f, 0x57, 0x1e, 0x58, 0x3b, 0x5c, 0x44, 0x5d, 0x4b, 0x5d, 0x51, 0x5e, 
+0x56, 0x5e, 0x5a, 0x5e, 0x5e, 0x5e, 0x62, 0x5e, 0x65, 0x5e, 0x66, 0x5e, 0x68, 0x5e, 0x6a, 0x5e, 
+0x6c, 0x5e, 0x6d, 0x5e, 0x6f, 0x5d, 0x71, 0x5d, 0x74, 0x5b, 0x76, 0x5b, 0x78, 0x5a, 0x7a, 0x59, 
+0x7b, 0x58, 0x7a, 0x56, 0x78, 0x55, 0x74, 0x54, 0x6c, 0x53, 0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 
+0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 0x68, 0x53, 0x74, 0x53, 0x80, 0x53, 
+0x8c, 0x53, 0x98, 0x53, 0xa4, 0x53, 0xb0, 0x53, 0xbc, 0x53, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x60, 0x04, 0x60, 0x0f, 0x60, 0x1f, 0x60, 0x3b, 0x61, 0x45, 0x62, 0x4c, 0x62, 0x51, 0x62, 
+0x56, 0x62, 0x5a, 0x62, 0x5e, 0x62, 0x62, 0x62, 0x65, 0x62, 0x66, 0x62, 0x68, 0x62, 0x6a, 0x62, 
+0x6b, 0x62, 0x6d, 0x62, 0x6f, 0x62, 0x70, 0x62, 0x74, 0x61, 0x76, 0x61, 0x78, 0x61, 0x7a, 0x60, 
+0x7a, 0x60, 0x7a, 0x60, 0x78, 0x5f, 0x74, 0x5f, 0x6c, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 
+0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x68, 0x5f, 0x74, 0x5f, 0x80, 0x5f, 
+0x8c, 0x5f, 0x98, 0x5f, 0xa4, 0x5f, 0xb0, 0x5f, 0xbc, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x66, 0x04, 0x66, 0x0f, 0x66, 0x1f, 0x66, 0x3b, 0x65, 0x45, 0x65, 0x4c, 0x65, 0x51, 0x65, 
+0x56, 0x65, 0x5a, 0x65, 0x5e, 0x65, 0x62, 0x65, 0x65, 0x65, 0x66, 0x65, 0x68, 0x65, 0x6a, 0x65, 
+0x6b, 0x65, 0x6d, 0x65, 0x6f, 0x65, 0x70, 0x65, 0x74, 0x66, 0x76, 0x66, 0x78, 0x66, 0x7a, 0x67, 
+0x7b, 0x67, 0x7a, 0x68, 0x78, 0x69, 0x74, 0x6a, 0x6c, 0x6a, 0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 
+0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 0x68, 0x6b, 0x74, 0x6b, 0x80, 0x6b, 
+0x8c, 0x6b, 0x98, 0x6b, 0xa4, 0x6b, 0xb0, 0x6b, 0xbc, 0x6b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0x6a, 0x03, 0x6b, 0x0f, 0x6a, 0x1e, 0x6a, 0x3b, 0x68, 0x45, 0x67, 0x4b, 0x67, 0x51, 0x67, 
+0x56, 0x67, 0x5a, 0x67, 0x5e, 0x66, 0x62, 0x66, 0x65, 0x66, 0x67, 0x67, 0x68, 0x67, 0x6a, 0x67, 
+0x6c, 0x67, 0x6d, 0x67, 0x6f, 0x68, 0x71, 0x68, 0x75, 0x6a, 0x77, 0x6a, 0x79, 0x6b, 0x7a, 0x6d, 
+0x7b, 0x6e, 0x7b, 0x70, 0x79, 0x72, 0x75, 0x74, 0x6d, 0x75, 0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 
+0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 0x68, 0x77, 0x74, 0x77, 0x80, 0x77, 
+0x8c, 0x77, 0x98, 0x77, 0xa4, 0x77, 0xb0, 0x77, 0xbc, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x03, 0x6f, 0x0e, 0x6e, 0x1d, 0x6e, 0x3a, 0x6a, 0x44, 0x69, 0x4b, 0x69, 0x51, 0x69, 
+0x55, 0x68, 0x5a, 0x68, 0x5e, 0x68, 0x62, 0x68, 0x65, 0x68, 0x67, 0x68, 0x69, 0x69, 0x6a, 0x69, 
+0x6c, 0x69, 0x6e, 0x6a, 0x6f, 0x6a, 0x71, 0x6b, 0x75, 0x6d, 0x78, 0x6f, 0x7a, 0x70, 0x7b, 0x72, 
+0x7c, 0x75, 0x7c, 0x77, 0x7a, 0x7a, 0x76, 0x7d, 0x6e, 0x80, 0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 
+0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 0x68, 0x82, 0x74, 0x82, 0x80, 0x82, 
+0x8c, 0x82, 0x98, 0x82, 0xa4, 0x82, 0xb0, 0x82, 0xbc, 0x82, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x03, 0x72, 0x0c, 0x72, 0x1b, 0x71, 0x37, 0x6d, 0x43, 0x6c, 0x4a, 0x6b, 0x50, 0x6a, 
+0x55, 0x6a, 0x5a, 0x6a, 0x5e, 0x6a, 0x62, 0x6a, 0x65, 0x6a, 0x67, 0x6a, 0x69, 0x6a, 0x6b, 0x6b, 
+0x6d, 0x6b, 0x6e, 0x6c, 0x70, 0x6d, 0x72, 0x6e, 0x77, 0x71, 0x79, 0x73, 0x7b, 0x75, 0x7d, 0x78, 
+0x7e, 0x7b, 0x7e, 0x7f, 0x7c, 0x83, 0x78, 0x87, 0x70, 0x8b, 0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 
+0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 0x68, 0x8e, 0x74, 0x8e, 0x80, 0x8e, 
+0x8c, 0x8e, 0x98, 0x8e, 0xa4, 0x8e, 0xb0, 0x8e, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x03, 0x76, 0x0b, 0x76, 0x19, 0x75, 0x31, 0x71, 0x41, 0x6e, 0x49, 0x6d, 0x50, 0x6c, 
+0x55, 0x6c, 0x59, 0x6c, 0x5e, 0x6c, 0x62, 0x6b, 0x65, 0x6b, 0x67, 0x6c, 0x69, 0x6c, 0x6b, 0x6d, 
+0x6d, 0x6d, 0x6f, 0x6e, 0x71, 0x6f, 0x73, 0x71, 0x78, 0x75, 0x7b, 0x77, 0x7d, 0x7a, 0x7f, 0x7e, 
+0x81, 0x82, 0x81, 0x87, 0x7f, 0x8c, 0x7b, 0x91, 0x73, 0x96, 0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 
+0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 0x68, 0x9a, 0x74, 0x9a, 0x80, 0x9a, 
+0x8c, 0x9a, 0x98, 0x9a, 0xa4, 0x9a, 0xb0, 0x9a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x02, 0x79, 0x09, 0x79, 0x16, 0x78, 0x2f, 0x74, 0x3b, 0x72, 0x48, 0x6f, 0x4f, 0x6e, 
+0x54, 0x6e, 0x59, 0x6d, 0x5e, 0x6d, 0x62, 0x6d, 0x65, 0x6d, 0x67, 0x6d, 0x6a, 0x6e, 0x6c, 0x6e, 
+0x6e, 0x6f, 0x70, 0x70, 0x72, 0x72, 0x75, 0x74, 0x7a, 0x78, 0x7d, 0x7b, 0x80, 0x7f, 0x82, 0x84, 
+0x84, 0x89, 0x84, 0x8e, 0x83, 0x95, 0x7f, 0x9b, 0x77, 0xa1, 0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 
+0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 0x68, 0xa6, 0x74, 0xa6, 0x80, 0xa6, 
+0x8c, 0xa6, 0x98, 0xa6, 0xa4, 0xa6, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x02, 0x7b, 0x07, 0x7c, 0x13, 0x7c, 0x2c, 0x77, 0x39, 0x74, 0x43, 0x73, 0x4d, 0x70, 
+0x53, 0x70, 0x59, 0x6f, 0x5d, 0x6f, 0x62, 0x6f, 0x65, 0x6f, 0x68, 0x6f, 0x6a, 0x6f, 0x6d, 0x70, 
+0x6f, 0x71, 0x72, 0x72, 0x74, 0x74, 0x77, 0x76, 0x7d, 0x7c, 0x80, 0x80, 0x84, 0x85, 0x87, 0x8a, 
+0x89, 0x90, 0x89, 0x97, 0x88, 0x9e, 0x83, 0xa5, 0x7b, 0xab, 0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 
+0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 0x68, 0xb2, 0x74, 0xb2, 0x80, 0xb2, 
+0x8c, 0xb2, 0x98, 0xb2, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x06, 0x7f, 0x10, 0x7f, 0x28, 0x79, 0x36, 0x77, 0x40, 0x75, 0x49, 0x74, 
+0x51, 0x72, 0x58, 0x71, 0x5d, 0x71, 0x62, 0x70, 0x65, 0x70, 0x68, 0x71, 0x6b, 0x71, 0x6e, 0x72, 
+0x71, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7a, 0x7a, 0x81, 0x81, 0x86, 0x86, 0x8a, 0x8c, 0x8d, 0x92, 
+0x90, 0x9a, 0x90, 0xa1, 0x8e, 0xa9, 0x89, 0xb1, 0x81, 0xb7, 0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 
+0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 0x68, 0xbe, 0x74, 0xbe, 0x80, 0xbe, 
+0x8c, 0xbe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x05, 0x81, 0x0d, 0x81, 0x25, 0x7c, 0x33, 0x7a, 0x3e, 0x78, 0x47, 0x76, 
+0x4e, 0x76, 0x55, 0x75, 0x5b, 0x74, 0x61, 0x74, 0x66, 0x74, 0x6a, 0x75, 0x6d, 0x75, 0x71, 0x77, 
+0x75, 0x78, 0x78, 0x7a, 0x7c, 0x7d, 0x81, 0x81, 0x8d, 0x8d, 0x93, 0x94, 0x99, 0x9c, 0x9d, 0xa4, 
+0x9e, 0xab, 0x9d, 0xb2, 0x98, 0xb8, 0x91, 0xbc, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x04, 0x82, 0x0a, 0x83, 0x21, 0x7e, 0x2f, 0x7c, 0x3a, 0x7a, 0x44, 0x79, 
+0x4c, 0x78, 0x54, 0x77, 0x5b, 0x76, 0x61, 0x76, 0x66, 0x76, 0x6a, 0x77, 0x6f, 0x78, 0x73, 0x79, 
+0x77, 0x7b, 0x7b, 0x7d, 0x80, 0x80, 0x86, 0x86, 0x94, 0x93, 0x9b, 0x9b, 0xa0, 0xa2, 0xa3, 0xa9, 
+0xa3, 0xaf, 0xa0, 0xb3, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x04, 0x82, 0x08, 0x84, 0x1d, 0x80, 0x2b, 0x7e, 0x37, 0x7c, 0x41, 0x7b, 
+0x4a, 0x7a, 0x52, 0x79, 0x5a, 0x78, 0x61, 0x78, 0x66, 0x78, 0x6b, 0x79, 0x70, 0x7a, 0x75, 0x7b, 
+0x7a, 0x7d, 0x7f, 0x80, 0x85, 0x84, 0x8c, 0x8a, 0x9c, 0x99, 0xa2, 0xa0, 0xa6, 0xa6, 0xa7, 0xab, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x06, 0x84, 0x19, 0x81, 0x27, 0x7f, 0x33, 0x7d, 0x3e, 0x7c, 
+0x48, 0x7b, 0x51, 0x7a, 0x59, 0x7a, 0x60, 0x7a, 0x67, 0x7a, 0x6d, 0x7a, 0x72, 0x7b, 0x78, 0x7d, 
+0x7e, 0x7f, 0x84, 0x82, 0x8a, 0x87, 0x92, 0x8d, 0xa4, 0x9d, 0xa9, 0xa3, 0xab, 0xa7, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x05, 0x82, 0x15, 0x80, 0x23, 0x7f, 0x2f, 0x7e, 0x3b, 0x7d, 
+0x45, 0x7c, 0x4f, 0x7b, 0x58, 0x7b, 0x60, 0x7a, 0x67, 0x7b, 0x6e, 0x7b, 0x75, 0x7c, 0x7b, 0x7e, 
+0x82, 0x81, 0x89, 0x84, 0x90, 0x89, 0x9a, 0x90, 0xab, 0x9e, 0xaf, 0xa3, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x7f, 0x11, 0x7f, 0x1f, 0x7e, 0x2b, 0x7d, 0x37, 0x7c, 
+0x42, 0x7b, 0x4d, 0x7b, 0x56, 0x7a, 0x60, 0x7a, 0x68, 0x7a, 0x70, 0x7b, 0x77, 0x7c, 0x7f, 0x7e, 
+0x87, 0x81, 0x8e, 0x84, 0x97, 0x89, 0xa1, 0x90, 0xb2, 0x9d, 0xb3, 0xa0, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x7b, 0x0f, 0x7b, 0x1b, 0x7a, 0x28, 0x7a, 0x34, 0x79, 
+0x3f, 0x79, 0x4a, 0x79, 0x55, 0x78, 0x5f, 0x78, 0x69, 0x78, 0x72, 0x79, 0x7a, 0x7a, 0x83, 0x7c, 
+0x8c, 0x7f, 0x95, 0x83, 0x9e, 0x88, 0xa9, 0x8e, 0xb8, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x75, 0x19, 0x75, 0x25, 0x74, 0x31, 0x74, 
+0x3d, 0x74, 0x49, 0x74, 0x54, 0x74, 0x5f, 0x74, 0x6a, 0x74, 0x74, 0x75, 0x7d, 0x76, 0x87, 0x78, 
+0x91, 0x7b, 0x9b, 0x7f, 0xa5, 0x83, 0xb1, 0x89, 0xbc, 0x91, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x64, 0x17, 0x64, 0x23, 0x64, 0x2f, 0x6c, 
+0x3b, 0x6c, 0x47, 0x6c, 0x53, 0x6c, 0x5f, 0x6c, 0x6a, 0x6c, 0x75, 0x6d, 0x80, 0x6e, 0x8a, 0x6c, 
+0x94, 0x6b, 0x9f, 0x6b, 0xaa, 0x6b, 0xb8, 0x6b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x64, 0x17, 0x64, 0x23, 0x64, 0x2f, 0x64, 
+0x3b, 0x64, 0x47, 0x64, 0x53, 0x64, 0x5e, 0x61, 0x69, 0x5e, 0x74, 0x5b, 0x7e, 0x58, 0x88, 0x54, 
+0x92, 0x50, 0x9d, 0x4c, 0xa7, 0x47, 0xb3, 0x40, 0xbe, 0x3a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x64, 0x17, 0x64, 0x23, 0x64, 0x2f, 0x64, 
+0x3a, 0x5d, 0x46, 0x5c, 0x51, 0x5a, 0x5c, 0x58, 0x66, 0x56, 0x70, 0x53, 0x7a, 0x50, 0x83, 0x4d, 
+0x8c, 0x4a, 0x96, 0x46, 0xa0, 0x40, 0xac, 0x3a, 0xba, 0x31, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x64, 0x17, 0x58, 0x23, 0x57, 0x2f, 0x56, 
+0x3b, 0x56, 0x46, 0x55, 0x51, 0x53, 0x5b, 0x52, 0x64, 0x50, 0x6d, 0x4f, 0x76, 0x4c, 0x7e, 0x4a, 
+0x87, 0x46, 0x8f, 0x43, 0x99, 0x3e, 0xa4, 0x37, 0xb5, 0x2c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x51, 0x19, 0x51, 0x25, 0x51, 0x31, 0x51, 
+0x3c, 0x51, 0x47, 0x50, 0x51, 0x50, 0x5a, 0x4f, 0x63, 0x4e, 0x6b, 0x4c, 0x72, 0x4b, 0x7a, 0x48, 
+0x81, 0x46, 0x89, 0x42, 0x91, 0x3d, 0x9c, 0x37, 0xae, 0x29, 0xb2, 0x27, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x4a, 0x0f, 0x4b, 0x1c, 0x4c, 0x28, 0x4d, 0x34, 0x4e, 
+0x3e, 0x4e, 0x48, 0x4e, 0x52, 0x4e, 0x5a, 0x4e, 0x62, 0x4d, 0x69, 0x4c, 0x70, 0x4b, 0x76, 0x49, 
+0x7d, 0x46, 0x83, 0x43, 0x8b, 0x3f, 0x94, 0x38, 0xa7, 0x2a, 0xad, 0x25, 0xb0, 0x23, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x46, 0x12, 0x48, 0x1f, 0x4a, 0x2c, 0x4b, 0x37, 0x4c, 
+0x41, 0x4d, 0x4a, 0x4e, 0x53, 0x4e, 0x5a, 0x4e, 0x61, 0x4d, 0x67, 0x4d, 0x6d, 0x4c, 0x73, 0x4a, 
+0x79, 0x48, 0x7f, 0x45, 0x85, 0x42, 0x8d, 0x3c, 0x9f, 0x2d, 0xa7, 0x27, 0xac, 0x22, 0xad, 0x20, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x06, 0x42, 0x16, 0x46, 0x24, 0x48, 0x30, 0x4a, 0x3a, 0x4c, 
+0x44, 0x4d, 0x4c, 0x4e, 0x54, 0x4f, 0x5a, 0x4f, 0x61, 0x4f, 0x66, 0x4e, 0x6c, 0x4d, 0x71, 0x4c, 
+0x76, 0x4a, 0x7b, 0x48, 0x80, 0x45, 0x87, 0x40, 0x97, 0x32, 0xa0, 0x2b, 0xa6, 0x25, 0xaa, 0x20, 
+0xab, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x08, 0x40, 0x1b, 0x45, 0x28, 0x48, 0x34, 0x4b, 0x3e, 0x4d, 
+0x46, 0x4e, 0x4e, 0x4f, 0x55, 0x50, 0x5b, 0x50, 0x61, 0x50, 0x66, 0x50, 0x6a, 0x4f, 0x6f, 0x4e, 
+0x73, 0x4d, 0x77, 0x4b, 0x7c, 0x48, 0x82, 0x44, 0x90, 0x38, 0x98, 0x31, 0xa0, 0x29, 0xa5, 0x23, 
+0xa8, 0x1e, 0xa9, 0x1b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x06, 0x40, 0x0b, 0x3f, 0x20, 0x46, 0x2d, 0x49, 0x38, 0x4c, 0x41, 0x4e, 
+0x49, 0x50, 0x50, 0x51, 0x56, 0x52, 0x5c, 0x52, 0x61, 0x52, 0x65, 0x52, 0x69, 0x52, 0x6d, 0x51, 
+0x70, 0x51, 0x73, 0x50, 0x77, 0x4e, 0x7b, 0x4b, 0x84, 0x43, 0x8b, 0x3d, 0x92, 0x37, 0x99, 0x2e, 
+0xa1, 0x25, 0xa6, 0x1d, 0xa6, 0x19, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x07, 0x40, 0x0e, 0x3f, 0x25, 0x47, 0x31, 0x4b, 0x3c, 0x4e, 0x44, 0x50, 
+0x4b, 0x51, 0x52, 0x53, 0x57, 0x53, 0x5c, 0x54, 0x61, 0x55, 0x65, 0x56, 0x68, 0x56, 0x6b, 0x55, 
+0x6e, 0x54, 0x71, 0x53, 0x74, 0x52, 0x77, 0x4f, 0x7f, 0x49, 0x84, 0x45, 0x89, 0x3f, 0x8f, 0x39, 
+0x94, 0x32, 0x99, 0x2a, 0x9d, 0x22, 0x9f, 0x1a, 0x9f, 0x13, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x08, 0x41, 0x12, 0x41, 0x2a, 0x49, 0x36, 0x4d, 0x3f, 0x4f, 0x47, 0x52, 
+0x4e, 0x53, 0x53, 0x54, 0x59, 0x57, 0x5e, 0x57, 0x61, 0x58, 0x64, 0x58, 0x67, 0x58, 0x6a, 0x57, 
+0x6d, 0x56, 0x6f, 0x56, 0x72, 0x54, 0x75, 0x52, 0x7b, 0x4d, 0x80, 0x4a, 0x84, 0x45, 0x89, 0x40, 
+0x8e, 0x3a, 0x92, 0x33, 0x95, 0x2b, 0x97, 0x24, 0x97, 0x1c, 0x86, 0x0e, 0x8b, 0x0b, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x05, 0x44, 0x0a, 0x43, 0x16, 0x44, 0x2e, 0x4b, 0x3a, 0x4f, 0x42, 0x51, 0x4a, 0x53, 
+0x52, 0x56, 0x56, 0x58, 0x5b, 0x59, 0x5e, 0x59, 0x61, 0x59, 0x64, 0x59, 0x67, 0x59, 0x6a, 0x59, 
+0x6c, 0x58, 0x6e, 0x58, 0x71, 0x57, 0x74, 0x55, 0x79, 0x51, 0x7d, 0x4e, 0x81, 0x4a, 0x85, 0x46, 
+0x89, 0x41, 0x8c, 0x3a, 0x8f, 0x33, 0x91, 0x2c, 0x90, 0x25, 0x83, 0x18, 0x88, 0x15, 0x8d, 0x12, 
+0x93, 0x0f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x05, 0x46, 0x0d, 0x46, 0x1a, 0x48, 0x31, 0x4e, 0x3d, 0x51, 0x48, 0x55, 0x4f, 0x57, 
+0x54, 0x58, 0x58, 0x59, 0x5b, 0x5a, 0x5f, 0x5a, 0x62, 0x5b, 0x64, 0x5b, 0x67, 0x5b, 0x69, 0x5b, 
+0x6c, 0x5a, 0x6e, 0x5a, 0x70, 0x59, 0x72, 0x58, 0x77, 0x55, 0x7a, 0x52, 0x7e, 0x4f, 0x81, 0x4c, 
+0x85, 0x47, 0x88, 0x42, 0x8a, 0x3b, 0x8b, 0x34, 0x8a, 0x2d, 0x80, 0x23, 0x85, 0x1f, 0x8a, 0x1c, 
+0x90, 0x18, 0x95, 0x15, 0x9c, 0x11, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x06, 0x49, 0x0f, 0x49, 0x1e, 0x4b, 0x35, 0x51, 0x44, 0x55, 0x4b, 0x57, 0x51, 0x58, 
+0x55, 0x5a, 0x59, 0x5b, 0x5c, 0x5b, 0x5f, 0x5c, 0x62, 0x5c, 0x65, 0x5c, 0x67, 0x5c, 0x69, 0x5c, 
+0x6b, 0x5c, 0x6d, 0x5c, 0x6f, 0x5b, 0x71, 0x5b, 0x76, 0x58, 0x79, 0x56, 0x7c, 0x54, 0x7f, 0x51, 
+0x82, 0x4d, 0x84, 0x49, 0x86, 0x43, 0x86, 0x3d, 0x85, 0x36, 0x7d, 0x2d, 0x81, 0x2a, 0x86, 0x26, 
+0x8c, 0x22, 0x92, 0x1e, 0x98, 0x1a, 0x9f, 0x16, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x02, 0x4d, 0x07, 0x4c, 0x12, 0x4d, 0x21, 0x4f, 0x3c, 0x56, 0x46, 0x58, 0x4d, 0x59, 0x52, 0x5a, 
+0x56, 0x5b, 0x59, 0x5c, 0x5d, 0x5d, 0x60, 0x5d, 0x62, 0x5e, 0x65, 0x5e, 0x67, 0x5e, 0x69, 0x5e, 
+0x6b, 0x5e, 0x6d, 0x5e, 0x6f, 0x5e, 0x71, 0x5d, 0x75, 0x5c, 0x78, 0x5b, 0x7a, 0x59, 0x7d, 0x57, 
+0x7f, 0x54, 0x81, 0x50, 0x82, 0x4b, 0x82, 0x45, 0x80, 0x3f, 0x79, 0x37, 0x7e, 0x33, 0x82, 0x30, 
+0x88, 0x2b, 0x8e, 0x27, 0x94, 0x23, 0x9b, 0x1f, 0xa2, 0x1b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x02, 0x50, 0x08, 0x4f, 0x14, 0x51, 0x29, 0x54, 0x3f, 0x58, 0x47, 0x5a, 0x4e, 0x5b, 0x53, 0x5b, 
+0x57, 0x5c, 0x5a, 0x5d, 0x5d, 0x5e, 0x60, 0x5f, 0x63, 0x5f, 0x65, 0x5f, 0x67, 0x60, 0x69, 0x60, 
+0x6b, 0x60, 0x6d, 0x61, 0x6f, 0x61, 0x70, 0x60, 0x74, 0x60, 0x77, 0x5f, 0x79, 0x5e, 0x7b, 0x5c, 
+0x7d, 0x5a, 0x7e, 0x57, 0x7e, 0x53, 0x7d, 0x4d, 0x7b, 0x48, 0x75, 0x41, 0x79, 0x3d, 0x7e, 0x39, 
+0x84, 0x35, 0x8a, 0x30, 0x90, 0x2c, 0x97, 0x28, 0x9e, 0x24, 0xa5, 0x1f, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x02, 0x53, 0x09, 0x53, 0x17, 0x54, 0x2e, 0x58, 0x40, 0x5b, 0x48, 0x5c, 0x4e, 0x5d, 0x54, 0x5d, 
+0x58, 0x5d, 0x5b, 0x5e, 0x5e, 0x5f, 0x61, 0x60, 0x63, 0x61, 0x66, 0x61, 0x68, 0x62, 0x6a, 0x62, 
+0x6b, 0x63, 0x6d, 0x63, 0x6f, 0x63, 0x70, 0x63, 0x74, 0x63, 0x76, 0x63, 0x78, 0x63, 0x7a, 0x62, 
+0x7b, 0x60, 0x7c, 0x5e, 0x7b, 0x5a, 0x7a, 0x56, 0x76, 0x51, 0x71, 0x4b, 0x75, 0x46, 0x7a, 0x42, 
+0x7f, 0x3d, 0x85, 0x39, 0x8b, 0x34, 0x92, 0x30, 0x9a, 0x2b, 0xa1, 0x27, 0xa9, 0x23, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x01, 0x5c, 0x09, 0x5c, 0x18, 0x5d, 0x30, 0x5e, 0x41, 0x60, 0x49, 0x60, 0x4f, 0x61, 0x54, 0x61, 
+0x58, 0x61, 0x5c, 0x62, 0x5f, 0x62, 0x62, 0x63, 0x64, 0x64, 0x66, 0x65, 0x68, 0x65, 0x6a, 0x66, 
+0x6c, 0x66, 0x6d, 0x67, 0x6f, 0x68, 0x71, 0x68, 0x74, 0x69, 0x76, 0x6a, 0x78, 0x6a, 0x79, 0x69, 
+0x7a, 0x68, 0x7a, 0x66, 0x79, 0x63, 0x76, 0x5f, 0x71, 0x5a, 0x6c, 0x54, 0x70, 0x4f, 0x75, 0x4b, 
+0x7b, 0x46, 0x80, 0x41, 0x87, 0x3c, 0x8e, 0x38, 0x95, 0x33, 0x9d, 0x2f, 0xa5, 0x2b, 0xae, 0x26, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x01, 0x64, 0x09, 0x64, 0x1e, 0x64, 0x31, 0x65, 0x41, 0x64, 0x49, 0x65, 0x4f, 0x65, 0x54, 0x65, 
+0x58, 0x65, 0x5d, 0x65, 0x60, 0x66, 0x62, 0x66, 0x65, 0x67, 0x67, 0x68, 0x69, 0x69, 0x6b, 0x6a, 
+0x6c, 0x6a, 0x6e, 0x6b, 0x6f, 0x6c, 0x71, 0x6d, 0x75, 0x6f, 0x76, 0x70, 0x77, 0x71, 0x78, 0x71, 
+0x78, 0x70, 0x78, 0x6f, 0x75, 0x6d, 0x71, 0x69, 0x6b, 0x63, 0x67, 0x5d, 0x6b, 0x58, 0x70, 0x53, 
+0x76, 0x4e, 0x7c, 0x49, 0x82, 0x44, 0x89, 0x3f, 0x91, 0x3a, 0x99, 0x36, 0xa1, 0x31, 0xaa, 0x2d, 
+0xb3, 0x2a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x01, 0x6c, 0x09, 0x6d, 0x1e, 0x6c, 0x30, 0x6b, 0x40, 0x69, 0x49, 0x69, 0x4f, 0x69, 0x54, 0x69, 
+0x58, 0x69, 0x5d, 0x69, 0x61, 0x69, 0x63, 0x6a, 0x66, 0x6b, 0x68, 0x6c, 0x6a, 0x6d, 0x6b, 0x6e, 
+0x6d, 0x6f, 0x6f, 0x70, 0x70, 0x71, 0x72, 0x73, 0x75, 0x76, 0x76, 0x77, 0x77, 0x78, 0x77, 0x79, 
+0x77, 0x79, 0x75, 0x78, 0x72, 0x76, 0x6c, 0x72, 0x65, 0x6c, 0x62, 0x66, 0x66, 0x60, 0x6b, 0x5b, 
+0x70, 0x55, 0x76, 0x50, 0x7d, 0x4b, 0x84, 0x46, 0x8c, 0x41, 0x94, 0x3c, 0x9d, 0x38, 0xa6, 0x34, 
+0xaf, 0x30, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x02, 0x75, 0x08, 0x76, 0x1c, 0x74, 0x2e, 0x71, 0x3b, 0x70, 0x48, 0x6e, 0x4e, 0x6d, 0x54, 0x6d, 
+0x58, 0x6d, 0x5d, 0x6c, 0x61, 0x6d, 0x64, 0x6d, 0x67, 0x6e, 0x69, 0x6f, 0x6b, 0x70, 0x6c, 0x72, 
+0x6e, 0x73, 0x70, 0x75, 0x71, 0x77, 0x75, 0x7b, 0x76, 0x7d, 0x77, 0x7f, 0x77, 0x81, 0x77, 0x82, 
+0x75, 0x82, 0x72, 0x81, 0x6d, 0x7f, 0x67, 0x7b, 0x5e, 0x74, 0x5c, 0x6e, 0x60, 0x68, 0x65, 0x62, 
+0x6b, 0x5c, 0x71, 0x56, 0x78, 0x51, 0x7f, 0x4c, 0x87, 0x47, 0x90, 0x43, 0x99, 0x3e, 0xa2, 0x3a, 
+0xab, 0x36, 0xb5, 0x32, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x03, 0x7d, 0x08, 0x7f, 0x14, 0x7e, 0x2c, 0x79, 0x39, 0x77, 0x46, 0x73, 0x4d, 0x72, 0x53, 0x71, 
+0x58, 0x71, 0x5d, 0x71, 0x61, 0x71, 0x65, 0x71, 0x68, 0x71, 0x6a, 0x73, 0x6c, 0x74, 0x6e, 0x76, 
+0x6f, 0x78, 0x71, 0x7b, 0x73, 0x7e, 0x76, 0x83, 0x77, 0x86, 0x77, 0x88, 0x77, 0x8a, 0x76, 0x8c, 
+0x73, 0x8c, 0x6f, 0x8b, 0x68, 0x89, 0x60, 0x84, 0x56, 0x7c, 0x56, 0x75, 0x5a, 0x6e, 0x5f, 0x68, 
+0x65, 0x62, 0x6c, 0x5c, 0x73, 0x57, 0x7a, 0x52, 0x83, 0x4d, 0x8b, 0x48, 0x94, 0x44, 0x9e, 0x40, 
+0xa7, 0x3c, 0xb1, 0x38, 0xbb, 0x35, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x08, 0x87, 0x11, 0x88, 0x28, 0x82, 0x36, 0x7e, 0x41, 0x7c, 0x4c, 0x78, 0x52, 0x76, 
+0x58, 0x76, 0x5c, 0x75, 0x61, 0x75, 0x65, 0x75, 0x69, 0x76, 0x6c, 0x77, 0x6e, 0x79, 0x6f, 0x7b, 
+0x71, 0x7e, 0x74, 0x83, 0x77, 0x89, 0x78, 0x8c, 0x78, 0x90, 0x78, 0x93, 0x77, 0x95, 0x74, 0x97, 
+0x70, 0x97, 0x6a, 0x96, 0x62, 0x92, 0x57, 0x8c, 0x4c, 0x82, 0x4f, 0x7b, 0x54, 0x74, 0x59, 0x6e, 
+0x5f, 0x67, 0x66, 0x62, 0x6d, 0x5c, 0x75, 0x57, 0x7e, 0x52, 0x87, 0x4d, 0x90, 0x49, 0x9a, 0x45, 
+0xa4, 0x41, 0xae, 0x3e, 0xb8, 0x3a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x0a, 0x8f, 0x11, 0x91, 0x22, 0x8d, 0x32, 0x87, 0x3e, 0x84, 0x47, 0x82, 0x50, 0x7e, 
+0x57, 0x7c, 0x5c, 0x7b, 0x61, 0x7b, 0x65, 0x7b, 0x6a, 0x7b, 0x6f, 0x7c, 0x71, 0x7e, 0x73, 0x82, 
+0x76, 0x89, 0x78, 0x8f, 0x7a, 0x94, 0x7a, 0x98, 0x7a, 0x9c, 0x79, 0xa0, 0x76, 0xa2, 0x72, 0xa4, 
+0x6c, 0xa4, 0x64, 0xa1, 0x59, 0x9c, 0x4d, 0x93, 0x45, 0x88, 0x48, 0x81, 0x4d, 0x79, 0x52, 0x73, 
+0x59, 0x6c, 0x60, 0x66, 0x68, 0x60, 0x70, 0x5b, 0x79, 0x56, 0x82, 0x52, 0x8c, 0x4e, 0x96, 0x4a, 
+0xa0, 0x46, 0xaa, 0x43, 0xb5, 0x40, 0xbf, 0x3d, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x11, 0x9a, 0x1a, 0x9b, 0x2d, 0x93, 0x3a, 0x8e, 0x45, 0x8b, 0x4d, 0x89, 
+0x54, 0x87, 0x5b, 0x85, 0x61, 0x83, 0x66, 0x82, 0x6b, 0x83, 0x71, 0x84, 0x77, 0x8a, 0x79, 0x8e, 
+0x7b, 0x94, 0x7d, 0x9b, 0x7e, 0xa2, 0x7e, 0xa8, 0x7d, 0xad, 0x7a, 0xb1, 0x76, 0xb2, 0x6f, 0xb3, 
+0x67, 0xb1, 0x5c, 0xac, 0x4f, 0xa4, 0x3b, 0x96, 0x3d, 0x8d, 0x40, 0x85, 0x45, 0x7d, 0x4c, 0x76, 
+0x53, 0x70, 0x5a, 0x6a, 0x63, 0x64, 0x6b, 0x5f, 0x75, 0x5a, 0x7e, 0x56, 0x88, 0x52, 0x92, 0x4e, 
+0x9d, 0x4b, 0xa7, 0x47, 0xb2, 0x44, 0xbd, 0x42, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x14, 0xa1, 0x1a, 0xa4, 0x24, 0xa5, 0x35, 0x9c, 0x41, 0x97, 0x4b, 0x94, 
+0x53, 0x92, 0x5a, 0x90, 0x60, 0x8f, 0x67, 0x8f, 0x6d, 0x90, 0x74, 0x91, 0x7c, 0x94, 0x81, 0x99, 
+0x83, 0xa3, 0x86, 0xb1, 0x85, 0xb8, 0x83, 0xbc, 0x80, 0xc0, 0x7b, 0xc3, 0x74, 0xc5, 0x6b, 0xc5, 
+0x5f, 0xbf, 0x51, 0xb7, 0x43, 0xab, 0x32, 0x9a, 0x34, 0x90, 0x38, 0x88, 0x3e, 0x80, 0x45, 0x79, 
+0x4c, 0x72, 0x54, 0x6c, 0x5d, 0x67, 0x67, 0x62, 0x70, 0x5d, 0x7a, 0x59, 0x84, 0x55, 0x8f, 0x52, 
+0x99, 0x4f, 0xa4, 0x4c, 0xaf, 0x49, 0xba, 0x46, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1d, 0xab, 0x24, 0xae, 0x2d, 0xaf, 0x3c, 0xa7, 0x47, 0xa2, 
+0x50, 0x9f, 0x59, 0x9d, 0x60, 0x9c, 0x67, 0x9c, 0x6f, 0x9d, 0x77, 0x9f, 0x80, 0xa3, 0x8d, 0xad, 
+0x8e, 0xb4, 0x8b, 0xbb, 0x87, 0xbf, 0x83, 0xc2, 0x7e, 0xc4, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x44, 0xc0, 0x27, 0xa6, 0x28, 0x9c, 0x2b, 0x92, 0x30, 0x89, 0x37, 0x81, 0x3e, 0x7a, 
+0x46, 0x74, 0x4f, 0x6e, 0x58, 0x69, 0x62, 0x64, 0x6c, 0x60, 0x76, 0x5c, 0x81, 0x59, 0x8c, 0x55, 
+0x96, 0x52, 0xa1, 0x50, 0xad, 0x4d, 0xb8, 0x4b, 0xc3, 0x49, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2e, 0xb7, 0x37, 0xb9, 0x41, 0xb9, 
+0x4d, 0xb3, 0x57, 0xaf, 0x60, 0xae, 0x68, 0xae, 0x71, 0xb0, 0x7c, 0xb8, 0x86, 0xb8, 0x8f, 0xb8, 
+0x95, 0xb9, 0x8f, 0xbd, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x1b, 0xa7, 0x1d, 0x9c, 0x22, 0x92, 0x28, 0x89, 0x2f, 0x81, 0x37, 0x7a, 
+0x40, 0x74, 0x4a, 0x6f, 0x53, 0x6a, 0x5e, 0x66, 0x68, 0x62, 0x73, 0x5e, 0x7e, 0x5b, 0x89, 0x58, 
+0x94, 0x56, 0x9f, 0x53, 0xaa, 0x51, 0xb6, 0x4f, 0xc1, 0x4d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3a, 0xbe, 0x42, 0xc1, 
+0x4c, 0xc2, 0x56, 0xc3, 0x60, 0xc3, 0x69, 0xc3, 0x73, 0xc2, 0x7d, 0xc2, 0x86, 0xc0, 0x8e, 0xbe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x99, 0x19, 0x8f, 0x20, 0x87, 0x28, 0x80, 0x31, 0x79, 
+0x3b, 0x74, 0x45, 0x6f, 0x4f, 0x6a, 0x5a, 0x67, 0x65, 0x63, 0x70, 0x60, 0x7b, 0x5d, 0x86, 0x5b, 
+0x91, 0x59, 0x9d, 0x57, 0xa8, 0x55, 0xb4, 0x53, 0xbf, 0x51, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x57, 0xc7, 0x60, 0xc7, 0x6a, 0xc7, 0x73, 0xc6, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x8a, 0x18, 0x83, 0x22, 0x7c, 0x2b, 0x77, 
+0x36, 0x72, 0x40, 0x6e, 0x4b, 0x6a, 0x56, 0x67, 0x62, 0x64, 0x6d, 0x61, 0x78, 0x5f, 0x84, 0x5d, 
+0x8f, 0x5b, 0x9b, 0x5a, 0xa7, 0x58, 0xb2, 0x57, 0xbe, 0x55, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x83, 0x12, 0x7c, 0x1c, 0x77, 0x27, 0x73, 
+0x32, 0x6f, 0x3d, 0x6c, 0x48, 0x69, 0x54, 0x66, 0x5f, 0x64, 0x6b, 0x62, 0x76, 0x61, 0x82, 0x5f, 
+0x8e, 0x5e, 0x9a, 0x5c, 0xa5, 0x5b, 0xb1, 0x5a, 0xbd, 0x59, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x74, 0x18, 0x71, 0x23, 0x6e, 
+0x2f, 0x6b, 0x3a, 0x69, 0x46, 0x67, 0x52, 0x66, 0x5e, 0x64, 0x69, 0x63, 0x75, 0x62, 0x81, 0x61, 
+0x8d, 0x60, 0x99, 0x5f, 0xa4, 0x5e, 0xb0, 0x5e, 0xbc, 0x5d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x6b, 0x16, 0x6a, 0x21, 0x68, 
+0x2d, 0x67, 0x39, 0x66, 0x45, 0x65, 0x51, 0x64, 0x5d, 0x64, 0x68, 0x63, 0x74, 0x63, 0x80, 0x62, 
+0x8c, 0x62, 0x98, 0x62, 0xa4, 0x61, 0xb0, 0x61, 0xbc, 0x61, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x62, 0x15, 0x62, 0x21, 0x62, 
+0x2d, 0x63, 0x39, 0x63, 0x45, 0x63, 0x50, 0x63, 0x5c, 0x63, 0x68, 0x64, 0x74, 0x64, 0x80, 0x64, 
+0x8c, 0x64, 0x98, 0x64, 0xa4, 0x64, 0xb0, 0x64, 0xbc, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x58, 0x16, 0x5a, 0x22, 0x5c, 
+0x2e, 0x5e, 0x39, 0x60, 0x45, 0x61, 0x51, 0x62, 0x5d, 0x63, 0x69, 0x64, 0x75, 0x65, 0x80, 0x65, 
+0x8c, 0x66, 0x98, 0x66, 0xa4, 0x67, 0xb0, 0x67, 0xbc, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x4a, 0x0f, 0x4f, 0x19, 0x54, 0x25, 0x57, 
+0x30, 0x5a, 0x3b, 0x5d, 0x47, 0x5f, 0x53, 0x61, 0x5e, 0x63, 0x6a, 0x64, 0x76, 0x66, 0x81, 0x67, 
+0x8d, 0x68, 0x99, 0x69, 0xa5, 0x6a, 0xb1, 0x6b, 0xbc, 0x6c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x41, 0x14, 0x48, 0x1e, 0x4e, 0x29, 0x53, 
+0x33, 0x57, 0x3e, 0x5a, 0x49, 0x5e, 0x55, 0x60, 0x60, 0x63, 0x6c, 0x65, 0x77, 0x67, 0x83, 0x69, 
+0x8e, 0x6a, 0x9a, 0x6c, 0xa6, 0x6d, 0xb2, 0x6e, 0xbd, 0x6f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x3a, 0x1b, 0x42, 0x24, 0x49, 0x2e, 0x4f, 
+0x38, 0x54, 0x42, 0x59, 0x4d, 0x5d, 0x58, 0x60, 0x63, 0x63, 0x6e, 0x66, 0x79, 0x69, 0x85, 0x6b, 
+0x90, 0x6d, 0x9c, 0x6f, 0xa7, 0x70, 0xb3, 0x72, 0xbf, 0x73, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x2c, 0x1c, 0x36, 0x23, 0x3f, 0x2b, 0x47, 0x33, 0x4d, 
+0x3d, 0x53, 0x47, 0x58, 0x51, 0x5d, 0x5b, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7c, 0x6a, 0x87, 0x6d, 
+0x92, 0x70, 0x9e, 0x72, 0xa9, 0x74, 0xb5, 0x76, 0xc0, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x3e, 0x09, 
+0x4a, 0x09, 0x56, 0x09, 0x62, 0x09, 0x6d, 0x09, 0x79, 0x09, 0x85, 0x09, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x20, 0x20, 0x22, 0x2b, 0x26, 0x35, 0x2b, 0x3e, 0x32, 0x45, 0x3a, 0x4c, 
+0x42, 0x53, 0x4c, 0x58, 0x55, 0x5d, 0x5f, 0x62, 0x6a, 0x66, 0x74, 0x69, 0x7f, 0x6d, 0x8a, 0x70, 
+0x95, 0x73, 0xa0, 0x75, 0xab, 0x78, 0xb6, 0x7a, 0xc2, 0x7c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0x15, 0x32, 0x15, 0x3e, 0x15, 
+0x4a, 0x15, 0x56, 0x15, 0x62, 0x15, 0x6d, 0x15, 0x79, 0x15, 0x85, 0x15, 0x91, 0x15, 0x99, 0x13, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x00, 0xfe, 0x2c, 0x17, 0x2b, 0x22, 0x2c, 0x2c, 0x2f, 0x35, 0x34, 0x3e, 0x3a, 0x46, 0x41, 0x4d, 
+0x48, 0x54, 0x51, 0x59, 0x5a, 0x5f, 0x64, 0x64, 0x6e, 0x68, 0x78, 0x6c, 0x82, 0x70, 0x8d, 0x73, 
+0x98, 0x76, 0xa3, 0x79, 0xae, 0x7c, 0xb9, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1a, 0x21, 0x26, 0x21, 0x32, 0x21, 0x3e, 0x21, 
+0x4a, 0x21, 0x56, 0x21, 0x62, 0x21, 0x6d, 0x21, 0x79, 0x21, 0x85, 0x21, 0x91, 0x21, 0x8f, 0x19, 
+0x8a, 0x10, 0x83, 0x08, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x4a, 0x04, 0x41, 0x0b, 
+0x3a, 0x13, 0x36, 0x1c, 0x35, 0x26, 0x35, 0x2f, 0x38, 0x38, 0x3c, 0x40, 0x41, 0x48, 0x47, 0x4f, 
+0x4f, 0x56, 0x57, 0x5c, 0x5f, 0x61, 0x68, 0x66, 0x72, 0x6b, 0x7c, 0x6f, 0x86, 0x73, 0x90, 0x77, 
+0x9b, 0x7a, 0xa5, 0x7d, 0xb0, 0x80, 0xbb, 0x82, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0x2d, 0x26, 0x2d, 0x32, 0x2d, 0x3e, 0x2d, 
+0x4a, 0x2d, 0x56, 0x2d, 0x62, 0x2d, 0x6d, 0x2d, 0x79, 0x2d, 0x85, 0x2d, 0x89, 0x28, 0x87, 0x20, 
+0x83, 0x18, 0x7c, 0x12, 0x74, 0x0d, 0x6b, 0x0a, 0x62, 0x09, 0x58, 0x0b, 0x4f, 0x0f, 0x48, 0x14, 
+0x42, 0x1b, 0x3f, 0x23, 0x3e, 0x2b, 0x3e, 0x34, 0x40, 0x3c, 0x44, 0x44, 0x48, 0x4b, 0x4e, 0x52, 
+0x55, 0x59, 0x5d, 0x5f, 0x65, 0x64, 0x6d, 0x69, 0x76, 0x6e, 0x80, 0x73, 0x8a, 0x77, 0x94, 0x7b, 
+0x9e, 0x7e, 0xa8, 0x81, 0xb3, 0x84, 0xbe, 0x87, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x39, 0x1a, 0x39, 0x26, 0x39, 0x32, 0x39, 0x3e, 0x39, 
+0x4a, 0x39, 0x56, 0x39, 0x62, 0x39, 0x6d, 0x39, 0x79, 0x39, 0x81, 0x37, 0x81, 0x2f, 0x80, 0x28, 
+0x7c, 0x22, 0x77, 0x1c, 0x71, 0x18, 0x6a, 0x16, 0x62, 0x15, 0x5a, 0x16, 0x54, 0x19, 0x4e, 0x1e, 
+0x49, 0x24, 0x47, 0x2b, 0x45, 0x32, 0x46, 0x3a, 0x48, 0x41, 0x4b, 0x48, 0x50, 0x50, 0x55, 0x56, 
+0x5b, 0x5d, 0x62, 0x63, 0x6a, 0x68, 0x72, 0x6d, 0x7b, 0x72, 0x84, 0x77, 0x8e, 0x7b, 0x97, 0x7f, 
+0xa1, 0x83, 0xac, 0x86, 0xb6, 0x89, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x45, 0x1a, 0x45, 0x26, 0x45, 0x32, 0x45, 0x3e, 0x45, 
+0x4a, 0x45, 0x56, 0x45, 0x62, 0x45, 0x6d, 0x45, 0x79, 0x45, 0x7a, 0x3e, 0x7a, 0x37, 0x79, 0x31, 
+0x77, 0x2b, 0x73, 0x27, 0x6e, 0x23, 0x68, 0x21, 0x62, 0x21, 0x5c, 0x22, 0x57, 0x25, 0x53, 0x29, 
+0x4f, 0x2e, 0x4d, 0x33, 0x4c, 0x3a, 0x4d, 0x41, 0x4f, 0x47, 0x52, 0x4e, 0x56, 0x55, 0x5b, 0x5b, 
+0x61, 0x62, 0x68, 0x67, 0x70, 0x6d, 0x77, 0x72, 0x80, 0x77, 0x89, 0x7c, 0x92, 0x80, 0x9b, 0x84, 
+0xa5, 0x88, 0xaf, 0x8b, 0xb9, 0x8f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x02, 0x51, 0x0e, 0x51, 0x1a, 0x51, 0x26, 0x51, 0x32, 0x51, 0x3e, 0x51, 
+0x4a, 0x51, 0x56, 0x51, 0x62, 0x51, 0x6d, 0x51, 0x72, 0x4c, 0x74, 0x46, 0x74, 0x40, 0x74, 0x3b, 
+0x72, 0x36, 0x6f, 0x32, 0x6b, 0x2f, 0x67, 0x2d, 0x63, 0x2d, 0x5e, 0x2e, 0x5a, 0x30, 0x57, 0x33, 
+0x54, 0x38, 0x53, 0x3d, 0x53, 0x42, 0x54, 0x48, 0x56, 0x4f, 0x59, 0x55, 0x5d, 0x5b, 0x62, 0x61, 
+0x67, 0x67, 0x6e, 0x6d, 0x75, 0x72, 0x7c, 0x78, 0x85, 0x7c, 0x8d, 0x81, 0x96, 0x85, 0x9f, 0x89, 
+0xa9, 0x8d, 0xb3, 0x91, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x02, 0x5d, 0x0e, 0x5d, 0x1a, 0x5d, 0x26, 0x5d, 0x32, 0x5d, 0x3e, 0x5d, 
+0x4a, 0x5d, 0x56, 0x5d, 0x62, 0x5d, 0x6a, 0x5a, 0x6c, 0x54, 0x6e, 0x4f, 0x6f, 0x4a, 0x6f, 0x45, 
+0x6e, 0x40, 0x6c, 0x3d, 0x69, 0x3a, 0x66, 0x39, 0x63, 0x39, 0x60, 0x39, 0x5d, 0x3b, 0x5a, 0x3e, 
+0x59, 0x42, 0x58, 0x47, 0x58, 0x4c, 0x59, 0x51, 0x5c, 0x57, 0x5f, 0x5d, 0x63, 0x62, 0x67, 0x68, 
+0x6d, 0x6e, 0x73, 0x73, 0x7a, 0x78, 0x81, 0x7e, 0x89, 0x82, 0x92, 0x87, 0x9a, 0x8b, 0xa3, 0x8f, 
+0xad, 0x93, 0xb6, 0x97, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x02, 0x69, 0x0e, 0x69, 0x1a, 0x69, 0x26, 0x69, 0x32, 0x69, 0x3e, 0x69, 
+0x4a, 0x69, 0x56, 0x69, 0x60, 0x68, 0x64, 0x63, 0x67, 0x5d, 0x69, 0x58, 0x6a, 0x53, 0x6a, 0x4f, 
+0x6a, 0x4b, 0x69, 0x48, 0x67, 0x46, 0x65, 0x45, 0x63, 0x45, 0x61, 0x45, 0x5f, 0x47, 0x5e, 0x49, 
+0x5d, 0x4d, 0x5d, 0x51, 0x5d, 0x55, 0x5f, 0x5a, 0x61, 0x5f, 0x64, 0x65, 0x68, 0x6a, 0x6d, 0x70, 
+0x72, 0x75, 0x78, 0x7a, 0x7f, 0x7f, 0x86, 0x84, 0x8e, 0x89, 0x96, 0x8d, 0x9e, 0x92, 0xa7, 0x96, 
+0xb0, 0x9a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x02, 0x75, 0x0e, 0x75, 0x1a, 0x75, 0x26, 0x75, 0x32, 0x75, 0x3e, 0x75, 
+0x4a, 0x75, 0x56, 0x75, 0x5b, 0x70, 0x5f, 0x6b, 0x62, 0x67, 0x64, 0x62, 0x66, 0x5e, 0x67, 0x5a, 
+0x67, 0x56, 0x66, 0x54, 0x66, 0x52, 0x64, 0x51, 0x63, 0x50, 0x62, 0x51, 0x61, 0x53, 0x60, 0x55, 
+0x60, 0x58, 0x61, 0x5b, 0x62, 0x5f, 0x64, 0x64, 0x66, 0x68, 0x69, 0x6d, 0x6d, 0x72, 0x72, 0x77, 
+0x78, 0x7c, 0x7e, 0x81, 0x84, 0x86, 0x8b, 0x8b, 0x93, 0x90, 0x9a, 0x94, 0xa3, 0x98, 0xab, 0x9c, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x81, 0x1a, 0x81, 0x26, 0x81, 0x32, 0x81, 0x3e, 0x81, 
+0x4a, 0x81, 0x52, 0x7e, 0x56, 0x79, 0x5a, 0x75, 0x5d, 0x70, 0x60, 0x6c, 0x62, 0x68, 0x63, 0x65, 
+0x64, 0x62, 0x64, 0x5f, 0x64, 0x5e, 0x64, 0x5d, 0x63, 0x5c, 0x63, 0x5d, 0x63, 0x5e, 0x63, 0x60, 
+0x63, 0x63, 0x64, 0x66, 0x66, 0x6a, 0x68, 0x6e, 0x6b, 0x72, 0x6e, 0x76, 0x72, 0x7b, 0x77, 0x80, 
+0x7c, 0x85, 0x82, 0x89, 0x89, 0x8e, 0x90, 0x93, 0x97, 0x97, 0x9f, 0x9b, 0xa7, 0x9f, 0xaf, 0xa3, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8c, 0x1a, 0x8c, 0x26, 0x8c, 0x32, 0x8c, 0x3e, 0x8c, 
+0x48, 0x8b, 0x4d, 0x87, 0x52, 0x82, 0x56, 0x7e, 0x59, 0x7a, 0x5c, 0x76, 0x5e, 0x73, 0x60, 0x70, 
+0x61, 0x6d, 0x62, 0x6b, 0x63, 0x69, 0x63, 0x68, 0x64, 0x68, 0x64, 0x69, 0x64, 0x6a, 0x65, 0x6c, 
+0x66, 0x6e, 0x68, 0x71, 0x69, 0x74, 0x6c, 0x78, 0x6f, 0x7c, 0x73, 0x80, 0x77, 0x84, 0x7c, 0x89, 
+0x81, 0x8d, 0x87, 0x92, 0x8d, 0x96, 0x94, 0x9a, 0x9b, 0x9f, 0xa3, 0xa3, 0xab, 0xa7, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0x98, 0x26, 0x98, 0x32, 0x98, 0x3e, 0x98, 
+0x44, 0x94, 0x49, 0x90, 0x4e, 0x8c, 0x52, 0x88, 0x55, 0x84, 0x59, 0x81, 0x5b, 0x7e, 0x5d, 0x7b, 
+0x5f, 0x78, 0x61, 0x76, 0x62, 0x75, 0x63, 0x74, 0x64, 0x74, 0x65, 0x75, 0x66, 0x76, 0x67, 0x77, 
+0x69, 0x79, 0x6a, 0x7c, 0x6d, 0x7f, 0x70, 0x82, 0x73, 0x86, 0x77, 0x8a, 0x7b, 0x8e, 0x80, 0x92, 
+0x85, 0x96, 0x8b, 0x9a, 0x92, 0x9e, 0x98, 0xa3, 0x9f, 0xa7, 0xa7, 0xab, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0xa4, 0x26, 0xa4, 0x32, 0xa4, 0x3a, 0xa2, 
+0x40, 0x9e, 0x45, 0x9a, 0x4a, 0x96, 0x4e, 0x92, 0x52, 0x8f, 0x55, 0x8c, 0x58, 0x89, 0x5b, 0x86, 
+0x5d, 0x84, 0x5f, 0x82, 0x61, 0x81, 0x62, 0x80, 0x64, 0x80, 0x65, 0x80, 0x67, 0x81, 0x69, 0x83, 
+0x6b, 0x85, 0x6d, 0x87, 0x70, 0x8a, 0x73, 0x8d, 0x77, 0x90, 0x7b, 0x94, 0x7f, 0x97, 0x84, 0x9b, 
+0x89, 0x9f, 0x8f, 0xa3, 0x96, 0xa7, 0x9c, 0xab, 0xa3, 0xaf, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0xb0, 0x30, 0xaf, 0x36, 0xab, 
+0x3c, 0xa7, 0x41, 0xa4, 0x46, 0xa0, 0x4b, 0x9d, 0x4f, 0x99, 0x52, 0x96, 0x56, 0x94, 0x59, 0x91, 
+0x5b, 0x8f, 0x5e, 0x8e, 0x60, 0x8d, 0x62, 0x8c, 0x64, 0x8c, 0x66, 0x8c, 0x68, 0x8d, 0x6a, 0x8e, 
+0x6d, 0x90, 0x70, 0x92, 0x73, 0x95, 0x76, 0x98, 0x7a, 0x9b, 0x7e, 0x9e, 0x83, 0xa1, 0x88, 0xa5, 
+0x8d, 0xa9, 0x93, 0xad, 0x9a, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x32, 0xb5, 
+0x38, 0xb1, 0x3e, 0xae, 0x43, 0xaa, 0x47, 0xa7, 0x4c, 0xa4, 0x50, 0xa1, 0x53, 0x9f, 0x57, 0x9d, 
+0x5a, 0x9b, 0x5c, 0x9a, 0x5f, 0x99, 0x62, 0x98, 0x64, 0x98, 0x66, 0x98, 0x69, 0x99, 0x6c, 0x9a, 
+0x6f, 0x9c, 0x72, 0x9e, 0x75, 0xa0, 0x79, 0xa3, 0x7d, 0xa5, 0x81, 0xa8, 0x86, 0xac, 0x8b, 0xaf, 
+0x91, 0xb3, 0x97, 0xb6, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x35, 0xbb, 0x3a, 0xb8, 0x40, 0xb5, 0x44, 0xb2, 0x49, 0xaf, 0x4d, 0xad, 0x51, 0xaa, 0x55, 0xa8, 
+0x58, 0xa7, 0x5b, 0xa5, 0x5e, 0xa4, 0x61, 0xa4, 0x64, 0xa4, 0x67, 0xa4, 0x6a, 0xa5, 0x6d, 0xa6, 
+0x70, 0xa7, 0x74, 0xa9, 0x78, 0xab, 0x7c, 0xae, 0x80, 0xb0, 0x84, 0xb3, 0x89, 0xb6, 0x8f, 0xb9, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x3d, 0xbf, 0x42, 0xbd, 0x46, 0xba, 0x4b, 0xb8, 0x4f, 0xb6, 0x53, 0xb4, 
+0x57, 0xb2, 0x5a, 0xb1, 0x5e, 0xb0, 0x61, 0xb0, 0x64, 0xb0, 0x67, 0xb0, 0x6b, 0xb1, 0x6e, 0xb2, 
+0x72, 0xb3, 0x76, 0xb5, 0x7a, 0xb6, 0x7e, 0xb9, 0x82, 0xbb, 0x87, 0xbe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x49, 0xc3, 0x4d, 0xc1, 0x51, 0xbf, 
+0x55, 0xbe, 0x59, 0xbd, 0x5d, 0xbc, 0x61, 0xbc, 0x64, 0xbc, 0x68, 0xbc, 0x6c, 0xbc, 0x6f, 0xbd, 
+0x73, 0xbf, 0x77, 0xc0, 0x7c, 0xc2, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x39, 0x0b, 0x45, 0x0b, 0x50, 0x0b, 0x5c, 0x0b, 0x68, 0x0b, 0x74, 0x0b, 0x80, 0x0b, 
+0x8c, 0x0b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x2d, 0x17, 0x39, 0x17, 0x45, 0x17, 0x50, 0x17, 0x5c, 0x17, 0x68, 0x17, 0x74, 0x17, 0x80, 0x17, 
+0x8c, 0x17, 0x98, 0x17, 0xa4, 0x17, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x21, 0x23, 
+0x2d, 0x23, 0x39, 0x23, 0x45, 0x23, 0x50, 0x23, 0x5c, 0x23, 0x68, 0x23, 0x74, 0x23, 0x80, 0x23, 
+0x8c, 0x23, 0x98, 0x23, 0xa4, 0x23, 0xb0, 0x23, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x15, 0x2f, 0x21, 0x2f, 
+0x2d, 0x2f, 0x39, 0x2f, 0x45, 0x2f, 0x50, 0x2f, 0x5c, 0x2f, 0x68, 0x2f, 0x74, 0x2f, 0x80, 0x2f, 
+0x8c, 0x2f, 0x98, 0x2f, 0xa4, 0x2f, 0xb0, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x39, 0x15, 0x3b, 0x21, 0x3b, 
+0x2d, 0x3b, 0x39, 0x3b, 0x45, 0x3b, 0x50, 0x3b, 0x5c, 0x3b, 0x68, 0x3b, 0x74, 0x3b, 0x80, 0x3b, 
+0x8c, 0x3b, 0x98, 0x3b, 0xa4, 0x3b, 0xb0, 0x3b, 0xbc, 0x3b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x3b, 0x18, 0x40, 0x22, 0x44, 
+0x2d, 0x47, 0x39, 0x47, 0x45, 0x47, 0x50, 0x47, 0x5c, 0x47, 0x68, 0x47, 0x74, 0x47, 0x80, 0x47, 
+0x8c, 0x47, 0x98, 0x47, 0xa4, 0x47, 0xb0, 0x47, 0xbc, 0x47, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x39, 0x13, 0x3d, 0x1d, 0x42, 0x27, 0x46, 
+0x30, 0x4b, 0x3a, 0x50, 0x45, 0x53, 0x50, 0x53, 0x5c, 0x53, 0x68, 0x53, 0x74, 0x53, 0x80, 0x53, 
+0x8c, 0x53, 0x98, 0x53, 0xa4, 0x53, 0xb0, 0x53, 0xbc, 0x53, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3b, 0x18, 0x3f, 0x22, 0x44, 0x2b, 0x49, 
+0x35, 0x4d, 0x3f, 0x52, 0x48, 0x57, 0x52, 0x5b, 0x5c, 0x5f, 0x68, 0x5f, 0x74, 0x5f, 0x80, 0x5f, 
+0x8c, 0x5f, 0x98, 0x5f, 0xa4, 0x5f, 0xb0, 0x5f, 0xbc, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x09, 0x38, 0x13, 0x3d, 0x1d, 0x42, 0x26, 0x46, 0x30, 0x4b, 
+0x3a, 0x50, 0x43, 0x54, 0x4d, 0x59, 0x57, 0x5d, 0x60, 0x62, 0x6a, 0x67, 0x74, 0x6b, 0x80, 0x6b, 
+0x8c, 0x6b, 0x98, 0x6b, 0xa4, 0x6b, 0xb0, 0x6b, 0xbc, 0x6b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3b, 0x18, 0x3f, 0x21, 0x44, 0x2b, 0x48, 0x35, 0x4d, 
+0x3e, 0x52, 0x48, 0x56, 0x52, 0x5b, 0x5b, 0x60, 0x65, 0x64, 0x6f, 0x69, 0x78, 0x6e, 0x82, 0x72, 
+0x8c, 0x77, 0x98, 0x77, 0xa4, 0x77, 0xb0, 0x77, 0xbc, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x3d, 0x1c, 0x41, 0x26, 0x46, 0x30, 0x4b, 0x39, 0x4f, 
+0x43, 0x54, 0x4d, 0x59, 0x56, 0x5d, 0x60, 0x62, 0x6a, 0x66, 0x73, 0x6b, 0x7d, 0x70, 0x87, 0x74, 
+0x90, 0x79, 0x9a, 0x7e, 0xa4, 0x82, 0xb0, 0x82, 0xbc, 0x82, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3a, 0x17, 0x3f, 0x21, 0x44, 0x2b, 0x48, 0x34, 0x4d, 0x3e, 0x52, 
+0x48, 0x56, 0x51, 0x5b, 0x5b, 0x5f, 0x65, 0x64, 0x6e, 0x69, 0x78, 0x6d, 0x82, 0x72, 0x8b, 0x77, 
+0x95, 0x7b, 0x9f, 0x80, 0xa8, 0x85, 0xb2, 0x89, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x12, 0x3d, 0x1c, 0x41, 0x26, 0x46, 0x2f, 0x4a, 0x39, 0x4f, 0x43, 0x54, 
+0x4c, 0x58, 0x56, 0x5d, 0x60, 0x62, 0x69, 0x66, 0x73, 0x6b, 0x7d, 0x70, 0x86, 0x74, 0x90, 0x79, 
+0x9a, 0x7d, 0xa3, 0x82, 0xad, 0x87, 0xb7, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0d, 0x3a, 0x17, 0x3f, 0x20, 0x43, 0x2a, 0x48, 0x34, 0x4d, 0x3e, 0x51, 0x47, 0x56, 
+0x51, 0x5b, 0x5b, 0x5f, 0x64, 0x64, 0x6e, 0x69, 0x78, 0x6d, 0x81, 0x72, 0x8b, 0x76, 0x95, 0x7b, 
+0x9e, 0x80, 0xa8, 0x84, 0xb2, 0x89, 0xbb, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x12, 0x3c, 0x1b, 0x41, 0x25, 0x46, 0x2f, 0x4a, 0x38, 0x4f, 0x42, 0x54, 0x4c, 0x58, 
+0x56, 0x5d, 0x5f, 0x61, 0x69, 0x66, 0x73, 0x6b, 0x7c, 0x6f, 0x86, 0x74, 0x90, 0x79, 0x99, 0x7d, 
+0xa3, 0x82, 0xad, 0x87, 0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0d, 0x3a, 0x16, 0x3f, 0x20, 0x43, 0x2a, 0x48, 0x33, 0x4c, 0x3d, 0x51, 0x47, 0x56, 0x51, 0x5a, 
+0x5a, 0x5f, 0x64, 0x64, 0x6e, 0x68, 0x77, 0x6d, 0x81, 0x72, 0x8b, 0x76, 0x94, 0x7b, 0x9e, 0x7f, 
+0xa8, 0x84, 0xb1, 0x89, 0xbb, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x11, 0x3c, 0x1b, 0x41, 0x25, 0x45, 0x2e, 0x4a, 0x38, 0x4f, 0x42, 0x53, 0x4b, 0x58, 0x55, 0x5d, 
+0x5f, 0x61, 0x69, 0x66, 0x72, 0x6b, 0x7c, 0x6f, 0x86, 0x74, 0x8f, 0x78, 0x99, 0x7d, 0xa3, 0x82, 
+0xac, 0x86, 0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x3a, 
+0x16, 0x3e, 0x20, 0x43, 0x29, 0x48, 0x33, 0x4c, 0x3d, 0x51, 0x46, 0x56, 0x50, 0x5a, 0x5a, 0x5f, 
+0x63, 0x63, 0x6d, 0x68, 0x77, 0x6d, 0x81, 0x71, 0x8a, 0x76, 0x94, 0x7b, 0x9e, 0x7f, 0xa7, 0x84, 
+0xb1, 0x89, 0xbb, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3c, 
+0x1b, 0x41, 0x24, 0x45, 0x2e, 0x4a, 0x38, 0x4f, 0x41, 0x53, 0x4b, 0x58, 0x55, 0x5c, 0x5e, 0x61, 
+0x68, 0x66, 0x72, 0x6a, 0x7b, 0x6f, 0x85, 0x74, 0x8f, 0x78, 0x99, 0x7d, 0xa2, 0x82, 0xac, 0x86, 
+0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x3a, 0x16, 0x3e, 
+0x1f, 0x43, 0x29, 0x47, 0x33, 0x4c, 0x3c, 0x51, 0x46, 0x55, 0x50, 0x5a, 0x59, 0x5f, 0x63, 0x63, 
+0x6d, 0x68, 0x76, 0x6d, 0x80, 0x71, 0x8a, 0x76, 0x93, 0x7a, 0x9d, 0x7f, 0xa7, 0x84, 0xb1, 0x88, 
+0xba, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3c, 0x1a, 0x40, 
+0x24, 0x45, 0x2e, 0x4a, 0x37, 0x4e, 0x41, 0x53, 0x4b, 0x58, 0x54, 0x5c, 0x5e, 0x61, 0x68, 0x66, 
+0x71, 0x6a, 0x7b, 0x6f, 0x85, 0x73, 0x8e, 0x78, 0x98, 0x7d, 0xa2, 0x81, 0xab, 0x86, 0xb5, 0x8b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x15, 0x3e, 0x1f, 0x43, 
+0x29, 0x47, 0x32, 0x4c, 0x3c, 0x51, 0x46, 0x55, 0x4f, 0x5a, 0x59, 0x5e, 0x63, 0x63, 0x6c, 0x68, 
+0x76, 0x6c, 0x80, 0x71, 0x89, 0x76, 0x93, 0x7a, 0x9d, 0x7f, 0xa6, 0x84, 0xb0, 0x88, 0xba, 0x8d, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x3c, 0x1a, 0x40, 0x23, 0x45, 
+0x2d, 0x49, 0x37, 0x4e, 0x41, 0x53, 0x4a, 0x57, 0x54, 0x5c, 0x5e, 0x61, 0x67, 0x65, 0x71, 0x6a, 
+0x7b, 0x6f, 0x84, 0x73, 0x8e, 0x78, 0x98, 0x7c, 0xa1, 0x81, 0xab, 0x86, 0xb5, 0x8a, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x15, 0x3e, 0x1e, 0x42, 0x28, 0x47, 
+0x32, 0x4c, 0x3b, 0x50, 0x45, 0x55, 0x4f, 0x5a, 0x59, 0x5e, 0x62, 0x63, 0x6c, 0x68, 0x76, 0x6c, 
+0x7f, 0x71, 0x89, 0x75, 0x93, 0x7a, 0x9c, 0x7f, 0xa6, 0x83, 0xb0, 0x88, 0xb9, 0x8d, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x3b, 0x19, 0x40, 0x23, 0x45, 0x2d, 0x49, 
+0x36, 0x4e, 0x40, 0x53, 0x4a, 0x57, 0x53, 0x5c, 0x5d, 0x60, 0x67, 0x65, 0x71, 0x6a, 0x7a, 0x6e, 
+0x84, 0x73, 0x8e, 0x78, 0x97, 0x7c, 0xa1, 0x81, 0xab, 0x86, 0xb4, 0x8a, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x14, 0x3e, 0x1e, 0x42, 0x28, 0x47, 0x31, 0x4c, 
+0x3b, 0x50, 0x45, 0x55, 0x4e, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6b, 0x67, 0x75, 0x6c, 0x7f, 0x71, 
+0x89, 0x75, 0x92, 0x7a, 0x9c, 0x7f, 0xa6, 0x83, 0xaf, 0x88, 0xb9, 0x8c, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x3b, 0x19, 0x40, 0x23, 0x44, 0x2c, 0x49, 0x36, 0x4e, 
+0x40, 0x52, 0x49, 0x57, 0x53, 0x5c, 0x5d, 0x60, 0x66, 0x65, 0x70, 0x6a, 0x7a, 0x6e, 0x84, 0x73, 
+0x8d, 0x77, 0x97, 0x7c, 0xa1, 0x81, 0xaa, 0x85, 0xb4, 0x8a, 0xbe, 0x8f, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x0a, 0x39, 0x14, 0x3d, 0x1e, 0x42, 0x27, 0x47, 0x31, 0x4b, 0x3b, 0x50, 
+0x44, 0x55, 0x4e, 0x59, 0x58, 0x5e, 0x61, 0x62, 0x6b, 0x67, 0x75, 0x6c, 0x7e, 0x70, 0x88, 0x75, 
+0x92, 0x7a, 0x9c, 0x7e, 0xa5, 0x83, 0xaf, 0x88, 0xb9, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0f, 0x3b, 0x19, 0x40, 0x22, 0x44, 0x2c, 0x49, 0x36, 0x4e, 0x3f, 0x52, 
+0x49, 0x57, 0x53, 0x5b, 0x5c, 0x60, 0x66, 0x65, 0x70, 0x69, 0x79, 0x6e, 0x83, 0x73, 0x8d, 0x77, 
+0x96, 0x7c, 0xa0, 0x81, 0xaa, 0x85, 0xb4, 0x8a, 0xbd, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x0a, 0x39, 0x14, 0x3d, 0x1d, 0x42, 0x27, 0x46, 0x31, 0x4b, 0x3a, 0x50, 0x44, 0x54, 
+0x4e, 0x59, 0x57, 0x5e, 0x61, 0x62, 0x6b, 0x67, 0x74, 0x6c, 0x7e, 0x70, 0x88, 0x75, 0x91, 0x79, 
+0x9b, 0x7e, 0xa5, 0x83, 0xae, 0x87, 0xb8, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0e, 0x3b, 0x18, 0x3f, 0x22, 0x44, 0x2c, 0x49, 0x35, 0x4d, 0x3f, 0x52, 0x49, 0x57, 
+0x52, 0x5b, 0x5c, 0x60, 0x66, 0x65, 0x6f, 0x69, 0x79, 0x6e, 0x83, 0x72, 0x8c, 0x77, 0x96, 0x7c, 
+0xa0, 0x80, 0xa9, 0x85, 0xb3, 0x8a, 0xbd, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x09, 0x38, 0x13, 0x3d, 0x1d, 0x42, 0x26, 0x46, 0x30, 0x4b, 0x3a, 0x50, 0x44, 0x54, 0x4d, 0x59, 
+0x57, 0x5d, 0x61, 0x62, 0x6a, 0x67, 0x74, 0x6b, 0x7e, 0x70, 0x87, 0x75, 0x91, 0x79, 0x9b, 0x7e, 
+0xa4, 0x83, 0xae, 0x87, 0xb8, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0e, 0x3b, 0x18, 0x3f, 0x21, 0x44, 0x2b, 0x48, 0x35, 0x4d, 0x3e, 0x52, 0x48, 0x56, 0x52, 0x5b, 
+0x5c, 0x60, 0x65, 0x64, 0x6f, 0x69, 0x79, 0x6e, 0x82, 0x72, 0x8c, 0x77, 0x96, 0x7c, 0x9f, 0x80, 
+0xa9, 0x85, 0xb3, 0x89, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x13, 0x3d, 0x1f, 0x38, 0x28, 0x3c, 0x32, 0x3f, 0x3b, 0x42, 0x45, 0x45, 0x4e, 0x49, 0x57, 0x4c, 
+0x60, 0x50, 0x6a, 0x54, 0x74, 0x58, 0x7e, 0x5d, 0x88, 0x62, 0x92, 0x67, 0x9c, 0x6c, 0xa7, 0x72, 
+0xae, 0x87, 0xb7, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x14, 0x2e, 
+0x1e, 0x30, 0x27, 0x33, 0x30, 0x35, 0x39, 0x38, 0x42, 0x3b, 0x4a, 0x3d, 0x53, 0x40, 0x5c, 0x43, 
+0x65, 0x45, 0x6d, 0x48, 0x77, 0x4b, 0x80, 0x4e, 0x8a, 0x52, 0x95, 0x55, 0xa0, 0x59, 0xac, 0x5e, 
+0xb8, 0x63, 0xc5, 0x68, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x29, 0x1c, 0x2b, 
+0x25, 0x2d, 0x2e, 0x30, 0x37, 0x32, 0x3f, 0x35, 0x48, 0x37, 0x50, 0x39, 0x58, 0x3b, 0x60, 0x3d, 
+0x68, 0x3f, 0x70, 0x41, 0x78, 0x43, 0x81, 0x44, 0x8b, 0x46, 0x95, 0x49, 0xa1, 0x4b, 0xad, 0x4e, 
+0xbb, 0x51, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1a, 0x27, 0x23, 0x2a, 
+0x2c, 0x2d, 0x35, 0x2f, 0x3d, 0x31, 0x45, 0x34, 0x4d, 0x36, 0x54, 0x37, 0x5b, 0x39, 0x62, 0x3a, 
+0x6a, 0x3c, 0x71, 0x3d, 0x79, 0x3e, 0x81, 0x3f, 0x8a, 0x40, 0x94, 0x40, 0x9f, 0x41, 0xac, 0x42, 
+0xbb, 0x43, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x16, 0x24, 0x21, 0x28, 0x2a, 0x2b, 
+0x33, 0x2e, 0x3b, 0x30, 0x43, 0x32, 0x4a, 0x34, 0x51, 0x36, 0x57, 0x37, 0x5e, 0x38, 0x65, 0x39, 
+0x6b, 0x3a, 0x72, 0x3b, 0x79, 0x3b, 0x81, 0x3c, 0x89, 0x3c, 0x93, 0x3b, 0x9d, 0x3b, 0xaa, 0x3a, 
+0xbc, 0x38, 0xc0, 0x3d, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x16, 0x25, 0x1e, 0x26, 0x28, 0x2a, 0x31, 0x2d, 
+0x39, 0x30, 0x40, 0x32, 0x47, 0x34, 0x4e, 0x36, 0x54, 0x37, 0x5a, 0x38, 0x60, 0x39, 0x66, 0x3a, 
+0x6c, 0x3a, 0x72, 0x3a, 0x79, 0x3a, 0x80, 0x3a, 0x88, 0x3a, 0x91, 0x39, 0x9c, 0x37, 0xaa, 0x34, 
+0xb8, 0x32, 0xbd, 0x36, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x15, 0x26, 0x18, 0x24, 0x25, 0x29, 0x2e, 0x2d, 0x36, 0x30, 
+0x3e, 0x32, 0x45, 0x34, 0x4b, 0x36, 0x51, 0x38, 0x57, 0x39, 0x5c, 0x3a, 0x62, 0x3a, 0x67, 0x3b, 
+0x6d, 0x3b, 0x72, 0x3b, 0x79, 0x3b, 0x7f, 0x3a, 0x87, 0x39, 0x8f, 0x37, 0x9a, 0x34, 0xac, 0x2d, 
+0xb5, 0x2e, 0xba, 0x32, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x26, 0x20, 0x29, 0x2b, 0x2d, 0x34, 0x30, 0x3b, 0x33, 
+0x42, 0x35, 0x49, 0x37, 0x4e, 0x39, 0x54, 0x3a, 0x59, 0x3b, 0x5e, 0x3c, 0x63, 0x3c, 0x68, 0x3c, 
+0x6d, 0x3c, 0x72, 0x3c, 0x78, 0x3b, 0x7e, 0x3a, 0x85, 0x39, 0x8e, 0x36, 0x9a, 0x32, 0xa9, 0x2c, 
+0xb2, 0x2c, 0xb7, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x15, 0x27, 0x1a, 0x26, 0x27, 0x2d, 0x31, 0x31, 0x39, 0x34, 0x40, 0x36, 
+0x46, 0x38, 0x4c, 0x3a, 0x51, 0x3b, 0x56, 0x3c, 0x5b, 0x3d, 0x5f, 0x3e, 0x64, 0x3e, 0x69, 0x3e, 
+0x6d, 0x3e, 0x72, 0x3d, 0x78, 0x3c, 0x7e, 0x3b, 0x84, 0x39, 0x8d, 0x36, 0x9d, 0x2d, 0xa7, 0x2c, 
+0xaf, 0x2b, 0xb5, 0x2d, 0xb9, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x13, 0x29, 0x17, 0x28, 0x22, 0x2c, 0x2d, 0x32, 0x36, 0x35, 0x3d, 0x38, 0x43, 0x3a, 
+0x49, 0x3b, 0x4e, 0x3d, 0x55, 0x41, 0x59, 0x44, 0x5d, 0x45, 0x61, 0x46, 0x64, 0x46, 0x68, 0x46, 
+0x6c, 0x46, 0x6f, 0x46, 0x73, 0x45, 0x78, 0x44, 0x7e, 0x41, 0x87, 0x3d, 0x95, 0x33, 0xa4, 0x2c, 
+0xad, 0x2b, 0xb3, 0x2c, 0xb8, 0x2e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x0f, 0x2e, 0x14, 0x2b, 0x1b, 0x2a, 0x29, 0x32, 0x33, 0x36, 0x3a, 0x39, 0x41, 0x3b, 0x47, 0x3d, 
+0x4f, 0x44, 0x54, 0x46, 0x58, 0x47, 0x5b, 0x48, 0x5f, 0x48, 0x62, 0x49, 0x65, 0x49, 0x68, 0x49, 
+0x6b, 0x48, 0x6f, 0x48, 0x73, 0x47, 0x77, 0x46, 0x7c, 0x44, 0x85, 0x3e, 0x8d, 0x3a, 0x97, 0x37, 
+0xa2, 0x33, 0xb1, 0x2c, 0xb6, 0x2d, 0xb9, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0e, 0x32, 0x14, 0x30, 0x21, 0x33, 0x2e, 0x37, 0x37, 0x3a, 0x3e, 0x3c, 0x48, 0x44, 0x4e, 0x46, 
+0x52, 0x48, 0x56, 0x49, 0x59, 0x4a, 0x5c, 0x4a, 0x5f, 0x4a, 0x62, 0x4b, 0x65, 0x4a, 0x68, 0x4a, 
+0x6b, 0x4a, 0x6f, 0x49, 0x72, 0x48, 0x76, 0x47, 0x7c, 0x45, 0x84, 0x40, 0x8b, 0x3d, 0x92, 0x3a, 
+0x9b, 0x37, 0xa5, 0x34, 0xae, 0x31, 0xb8, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x09, 0x3a, 
+0x0e, 0x37, 0x15, 0x36, 0x25, 0x3b, 0x31, 0x3e, 0x3e, 0x43, 0x47, 0x46, 0x4c, 0x48, 0x50, 0x49, 
+0x54, 0x4a, 0x57, 0x4b, 0x5a, 0x4c, 0x5d, 0x4c, 0x60, 0x4c, 0x63, 0x4c, 0x65, 0x4c, 0x68, 0x4c, 
+0x6b, 0x4b, 0x6e, 0x4a, 0x72, 0x49, 0x76, 0x48, 0x7d, 0x43, 0x83, 0x41, 0x89, 0x3f, 0x90, 0x3c, 
+0x98, 0x3a, 0xa0, 0x37, 0xa8, 0x35, 0xb0, 0x33, 0xb8, 0x32, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x08, 0x3e, 
+0x0e, 0x3c, 0x17, 0x3c, 0x28, 0x41, 0x39, 0x47, 0x42, 0x4a, 0x48, 0x4b, 0x4d, 0x4c, 0x52, 0x4c, 
+0x55, 0x4c, 0x58, 0x4d, 0x5b, 0x4d, 0x5e, 0x4d, 0x60, 0x4d, 0x63, 0x4d, 0x66, 0x4d, 0x68, 0x4d, 
+0x6b, 0x4c, 0x6e, 0x4b, 0x72, 0x4a, 0x76, 0x48, 0x7c, 0x44, 0x82, 0x42, 0x88, 0x40, 0x8f, 0x3e, 
+0x96, 0x3c, 0x9d, 0x3a, 0xa4, 0x38, 0xac, 0x36, 0xb2, 0x35, 0xb8, 0x35, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x45, 0x08, 0x42, 
+0x0f, 0x41, 0x19, 0x41, 0x33, 0x4a, 0x3d, 0x4d, 0x44, 0x4e, 0x49, 0x4f, 0x4e, 0x4f, 0x52, 0x4f, 
+0x55, 0x4f, 0x58, 0x4f, 0x5c, 0x4f, 0x5e, 0x4f, 0x61, 0x4f, 0x63, 0x4e, 0x66, 0x4e, 0x68, 0x4e, 
+0x6b, 0x4d, 0x6e, 0x4c, 0x72, 0x4b, 0x77, 0x47, 0x7c, 0x45, 0x82, 0x43, 0x87, 0x41, 0x8e, 0x3f, 
+0x94, 0x3d, 0x9b, 0x3b, 0xa2, 0x3a, 0xa8, 0x38, 0xae, 0x38, 0xa1, 0x1c, 0xa6, 0x1c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x49, 0x08, 0x47, 
+0x10, 0x46, 0x25, 0x4a, 0x36, 0x4f, 0x3f, 0x50, 0x45, 0x51, 0x4a, 0x51, 0x4e, 0x52, 0x52, 0x52, 
+0x55, 0x51, 0x58, 0x51, 0x5b, 0x51, 0x5e, 0x50, 0x61, 0x50, 0x63, 0x50, 0x66, 0x4f, 0x69, 0x4f, 
+0x6b, 0x4e, 0x6e, 0x4d, 0x72, 0x4b, 0x77, 0x48, 0x7c, 0x46, 0x81, 0x45, 0x87, 0x43, 0x8d, 0x41, 
+0x93, 0x3f, 0x9a, 0x3d, 0xa0, 0x3c, 0xa6, 0x3a, 0xab, 0x3a, 0xa1, 0x21, 0xa6, 0x21, 0xab, 0x21, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x03, 0x4d, 0x08, 0x4b, 
+0x1a, 0x4d, 0x29, 0x4f, 0x37, 0x52, 0x3f, 0x53, 0x45, 0x54, 0x4a, 0x54, 0x4e, 0x54, 0x51, 0x54, 
+0x55, 0x53, 0x58, 0x53, 0x5b, 0x53, 0x5e, 0x52, 0x60, 0x52, 0x63, 0x51, 0x66, 0x50, 0x69, 0x50, 
+0x6b, 0x4f, 0x6e, 0x4e, 0x73, 0x4b, 0x77, 0x49, 0x7c, 0x48, 0x81, 0x46, 0x86, 0x44, 0x8c, 0x42, 
+0x92, 0x40, 0x98, 0x3f, 0x9e, 0x3d, 0xa4, 0x3d, 0x9d, 0x26, 0xa1, 0x26, 0xa6, 0x26, 0xab, 0x26, 
+0xb0, 0x26, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0x53, 0x03, 0x51, 0x0f, 0x51, 
+0x1f, 0x52, 0x2b, 0x53, 0x36, 0x54, 0x3f, 0x56, 0x45, 0x56, 0x4a, 0x56, 0x4e, 0x56, 0x51, 0x56, 
+0x54, 0x55, 0x57, 0x55, 0x5a, 0x55, 0x5d, 0x54, 0x60, 0x54, 0x63, 0x53, 0x65, 0x52, 0x68, 0x51, 
+0x6b, 0x50, 0x6f, 0x4f, 0x73, 0x4c, 0x77, 0x4a, 0x7c, 0x49, 0x81, 0x47, 0x86, 0x45, 0x8c, 0x44, 
+0x92, 0x42, 0x97, 0x41, 0x9d, 0x3f, 0xa2, 0x3f, 0x9d, 0x2a, 0xa1, 0x2a, 0xa6, 0x2a, 0xab, 0x2a, 
+0xb0, 0x2a, 0xb4, 0x2a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0x57, 0x03, 0x55, 0x15, 0x56, 
+0x21, 0x56, 0x2c, 0x56, 0x34, 0x56, 0x3f, 0x58, 0x45, 0x58, 0x49, 0x58, 0x4d, 0x58, 0x51, 0x57, 
+0x54, 0x57, 0x57, 0x57, 0x5a, 0x56, 0x5d, 0x56, 0x5f, 0x55, 0x62, 0x55, 0x65, 0x54, 0x68, 0x53, 
+0x6b, 0x52, 0x6f, 0x4f, 0x73, 0x4d, 0x77, 0x4c, 0x7c, 0x4a, 0x81, 0x48, 0x86, 0x47, 0x8b, 0x45, 
+0x91, 0x44, 0x96, 0x42, 0x9c, 0x41, 0xa0, 0x41, 0x9d, 0x2f, 0xa1, 0x2f, 0xa6, 0x2f, 0xab, 0x2f, 
+0xb0, 0x2f, 0xb4, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x5a, 0x0a, 0x59, 0x17, 0x59, 
+0x22, 0x59, 0x2c, 0x59, 0x34, 0x59, 0x3b, 0x59, 0x44, 0x5a, 0x48, 0x5a, 0x4d, 0x59, 0x50, 0x59, 
+0x53, 0x59, 0x56, 0x58, 0x59, 0x58, 0x5c, 0x57, 0x5f, 0x57, 0x61, 0x56, 0x64, 0x55, 0x67, 0x54, 
+0x6a, 0x53, 0x6e, 0x51, 0x72, 0x4f, 0x77, 0x4d, 0x7c, 0x4c, 0x80, 0x4a, 0x86, 0x48, 0x8b, 0x47, 
+0x90, 0x45, 0x96, 0x44, 0x9a, 0x43, 0x98, 0x34, 0x9d, 0x34, 0xa1, 0x34, 0xa6, 0x34, 0xab, 0x34, 
+0xb0, 0x34, 0xb4, 0x34, 0xb9, 0x34, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0x5e, 0x0d, 0x5d, 0x18, 0x5d, 
+0x22, 0x5c, 0x2b, 0x5c, 0x33, 0x5b, 0x3a, 0x5b, 0x41, 0x5b, 0x47, 0x5b, 0x4c, 0x5b, 0x4f, 0x5b, 
+0x53, 0x5a, 0x56, 0x5a, 0x59, 0x59, 0x5b, 0x59, 0x5e, 0x58, 0x61, 0x58, 0x64, 0x57, 0x67, 0x56, 
+0x6a, 0x53, 0x6e, 0x52, 0x72, 0x51, 0x76, 0x4f, 0x7b, 0x4e, 0x80, 0x4c, 0x85, 0x4a, 0x8b, 0x49, 
+0x90, 0x47, 0x95, 0x46, 0x99, 0x46, 0x98, 0x39, 0x9d, 0x39, 0xa1, 0x39, 0xa6, 0x39, 0xab, 0x39, 
+0xb0, 0x39, 0xb4, 0x39, 0xb9, 0x39, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x05, 0x61, 0x0f, 0x60, 0x18, 0x60, 
+0x22, 0x5f, 0x2a, 0x5e, 0x32, 0x5e, 0x38, 0x5d, 0x3e, 0x5d, 0x43, 0x5c, 0x4a, 0x5d, 0x4e, 0x5c, 
+0x51, 0x5c, 0x55, 0x5b, 0x58, 0x5b, 0x5b, 0x5a, 0x5d, 0x5a, 0x60, 0x59, 0x63, 0x58, 0x66, 0x56, 
+0x6a, 0x55, 0x6e, 0x54, 0x72, 0x53, 0x76, 0x51, 0x7b, 0x50, 0x80, 0x4e, 0x85, 0x4c, 0x8a, 0x4b, 
+0x8f, 0x4a, 0x94, 0x49, 0x93, 0x3d, 0x98, 0x3d, 0x9d, 0x3d, 0xa1, 0x3d, 0xa6, 0x3d, 0xab, 0x3d, 
+0xb0, 0x3d, 0xb4, 0x3d, 0xb9, 0x3d, 0xbe, 0x3d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x66, 0x07, 0x65, 0x0f, 0x64, 0x18, 0x63, 
+0x21, 0x62, 0x29, 0x61, 0x30, 0x60, 0x37, 0x60, 0x3c, 0x5f, 0x42, 0x5e, 0x46, 0x5e, 0x4b, 0x5d, 
+0x4f, 0x5d, 0x53, 0x5d, 0x56, 0x5c, 0x59, 0x5b, 0x5c, 0x5a, 0x5f, 0x5a, 0x62, 0x59, 0x66, 0x58, 
+0x69, 0x57, 0x6d, 0x56, 0x71, 0x54, 0x76, 0x53, 0x7a, 0x52, 0x7f, 0x50, 0x84, 0x4f, 0x89, 0x4d, 
+0x8e, 0x4c, 0x93, 0x4b, 0x93, 0x42, 0x98, 0x42, 0x9d, 0x42, 0xa1, 0x42, 0xa6, 0x42, 0xab, 0x42, 
+0xb0, 0x42, 0xb4, 0x42, 0xb9, 0x42, 0xbe, 0x42, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0x69, 0x08, 0x68, 0x10, 0x67, 0x18, 0x66, 
+0x20, 0x64, 0x27, 0x64, 0x2e, 0x63, 0x35, 0x62, 0x3b, 0x61, 0x40, 0x61, 0x45, 0x60, 0x49, 0x5f, 
+0x4d, 0x5f, 0x51, 0x5e, 0x54, 0x5d, 0x58, 0x5d, 0x5b, 0x5c, 0x5e, 0x5b, 0x62, 0x5a, 0x65, 0x59, 
+0x69, 0x58, 0x6d, 0x57, 0x71, 0x56, 0x75, 0x55, 0x7a, 0x54, 0x7f, 0x52, 0x84, 0x51, 0x88, 0x50, 
+0x8d, 0x4f, 0x8e, 0x47, 0x93, 0x47, 0x98, 0x47, 0x9d, 0x47, 0xa1, 0x47, 0xa6, 0x47, 0xab, 0x47, 
+0xb0, 0x47, 0xb4, 0x47, 0xb9, 0x47, 0xbe, 0x47, 0xc3, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x02, 0x6c, 0x09, 0x6b, 0x10, 0x6a, 0x17, 0x68, 
+0x1f, 0x67, 0x26, 0x66, 0x2c, 0x65, 0x33, 0x64, 0x39, 0x63, 0x3e, 0x63, 0x43, 0x62, 0x47, 0x61, 
+0x4b, 0x61, 0x4f, 0x60, 0x53, 0x5f, 0x56, 0x5f, 0x5a, 0x5e, 0x5d, 0x5d, 0x61, 0x5c, 0x64, 0x5b, 
+0x68, 0x5a, 0x6c, 0x59, 0x70, 0x58, 0x75, 0x57, 0x79, 0x56, 0x7e, 0x55, 0x83, 0x54, 0x88, 0x53, 
+0x8a, 0x4c, 0x8e, 0x4c, 0x93, 0x4c, 0x98, 0x4c, 0x9d, 0x4c, 0xa1, 0x4c, 0xa6, 0x4c, 0xab, 0x4c, 
+0xb0, 0x4c, 0xb4, 0x4c, 0xb9, 0x4c, 0xbe, 0x4c, 0xc3, 0x4c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x50, 0x0a, 0x6e, 0x10, 0x6c, 0x17, 0x6b, 
+0x1e, 0x6a, 0x24, 0x69, 0x2b, 0x68, 0x31, 0x67, 0x36, 0x66, 0x3c, 0x65, 0x41, 0x64, 0x45, 0x63, 
+0x4a, 0x63, 0x4e, 0x62, 0x51, 0x61, 0x55, 0x60, 0x59, 0x60, 0x5c, 0x5f, 0x60, 0x5e, 0x64, 0x5d, 
+0x68, 0x5c, 0x6c, 0x5b, 0x70, 0x5a, 0x74, 0x59, 0x79, 0x58, 0x7e, 0x57, 0x82, 0x56, 0x87, 0x55, 
+0x8a, 0x50, 0x8e, 0x50, 0x93, 0x50, 0x98, 0x50, 0x9d, 0x50, 0xa1, 0x50, 0xa6, 0x50, 0xab, 0x50, 
+0xb0, 0x50, 0xb4, 0x50, 0xb9, 0x50, 0xbe, 0x50, 0xc3, 0x50, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x55, 0x09, 0x55, 0x11, 0x6f, 0x17, 0x6e, 
+0x1d, 0x6d, 0x23, 0x6c, 0x29, 0x6b, 0x2f, 0x6a, 0x34, 0x69, 0x3a, 0x68, 0x3f, 0x67, 0x43, 0x66, 
+0x48, 0x65, 0x4c, 0x64, 0x50, 0x63, 0x54, 0x63, 0x57, 0x62, 0x5b, 0x61, 0x5f, 0x60, 0x63, 0x5f, 
+0x67, 0x5e, 0x6b, 0x5e, 0x6f, 0x5d, 0x74, 0x5c, 0x78, 0x5b, 0x7d, 0x5a, 0x82, 0x59, 0x85, 0x55, 
+0x8a, 0x55, 0x8e, 0x55, 0x93, 0x55, 0x98, 0x55, 0x9d, 0x55, 0xa1, 0x55, 0xa6, 0x55, 0xab, 0x55, 
+0xb0, 0x55, 0xb4, 0x55, 0xb9, 0x55, 0xbe, 0x55, 0xc3, 0x55, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5a, 0x09, 0x5a, 0x0e, 0x5a, 0x16, 0x71, 
+0x1c, 0x70, 0x22, 0x6e, 0x27, 0x6d, 0x2d, 0x6c, 0x32, 0x6b, 0x38, 0x6a, 0x3d, 0x69, 0x41, 0x68, 
+0x46, 0x67, 0x4a, 0x67, 0x4e, 0x66, 0x52, 0x65, 0x56, 0x64, 0x5a, 0x63, 0x5e, 0x62, 0x62, 0x62, 
+0x66, 0x61, 0x6a, 0x60, 0x6f, 0x5f, 0x73, 0x5e, 0x78, 0x5d, 0x7c, 0x5c, 0x80, 0x5a, 0x85, 0x5a, 
+0x8a, 0x5a, 0x8e, 0x5a, 0x93, 0x5a, 0x98, 0x5a, 0x9d, 0x5a, 0xa1, 0x5a, 0xa6, 0x5a, 0xab, 0x5a, 
+0xb0, 0x5a, 0xb4, 0x5a, 0xb9, 0x5a, 0xbe, 0x5a, 0xc3, 0x5a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5f, 0x09, 0x5f, 0x0e, 0x5f, 0x13, 0x5f, 
+0x1c, 0x72, 0x21, 0x71, 0x26, 0x70, 0x2b, 0x6f, 0x31, 0x6e, 0x36, 0x6d, 0x3b, 0x6c, 0x3f, 0x6b, 
+0x44, 0x6a, 0x48, 0x69, 0x4c, 0x68, 0x51, 0x67, 0x55, 0x67, 0x59, 0x66, 0x5d, 0x65, 0x61, 0x64, 
+0x65, 0x63, 0x6a, 0x62, 0x6e, 0x61, 0x73, 0x61, 0x77, 0x5f, 0x7b, 0x5f, 0x80, 0x5f, 0x85, 0x5f, 
+0x8a, 0x5f, 0x8e, 0x5f, 0x93, 0x5f, 0x98, 0x5f, 0x9d, 0x5f, 0xa1, 0x5f, 0xa6, 0x5f, 0xab, 0x5f, 
+0xb0, 0x5f, 0xb4, 0x5f, 0xb9, 0x5f, 0xbe, 0x5f, 0xc3, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x25, 0x73, 0x2a, 0x72, 0x2f, 0x71, 0x34, 0x70, 0x39, 0x6f, 0x3e, 0x6e, 
+0x42, 0x6d, 0x47, 0x6c, 0x4b, 0x6b, 0x4f, 0x6a, 0x53, 0x69, 0x58, 0x68, 0x5c, 0x68, 0x60, 0x67, 
+0x64, 0x66, 0x69, 0x65, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x68, 0x09, 0x68, 0x0e, 0x68, 0x13, 0x68, 
+0x17, 0x68, 0x1c, 0x68, 0x21, 0x68, 0x26, 0x68, 0x2e, 0x73, 0x33, 0x72, 0x38, 0x71, 0x3c, 0x71, 
+0x41, 0x70, 0x45, 0x6f, 0x4a, 0x6e, 0x4e, 0x6d, 0x52, 0x6c, 0x57, 0x6b, 0x5b, 0x6a, 0x5f, 0x69, 
+0x64, 0x68, 0x68, 0x68, 0x6d, 0x68, 0x72, 0x68, 0x77, 0x68, 0x7b, 0x68, 0x80, 0x68, 0x85, 0x68, 
+0x8a, 0x68, 0x8e, 0x68, 0x93, 0x68, 0x98, 0x68, 0x9d, 0x68, 0xa1, 0x68, 0xa6, 0x68, 0xab, 0x68, 
+0xb0, 0x68, 0xb4, 0x68, 0xb9, 0x68, 0xbe, 0x68, 0xc3, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x6d, 0x09, 0x6d, 0x0e, 0x6d, 0x13, 0x6d, 
+0x17, 0x6d, 0x1c, 0x6d, 0x21, 0x6d, 0x26, 0x6d, 0x2a, 0x6d, 0x2f, 0x6d, 0x34, 0x6d, 0x3b, 0x73, 
+0x40, 0x72, 0x44, 0x71, 0x48, 0x70, 0x4d, 0x70, 0x51, 0x6f, 0x55, 0x6d, 0x5a, 0x6d, 0x5f, 0x6d, 
+0x64, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x72, 0x6d, 0x77, 0x6d, 0x7b, 0x6d, 0x80, 0x6d, 0x85, 0x6d, 
+0x8a, 0x6d, 0x8e, 0x6d, 0x93, 0x6d, 0x98, 0x6d, 0x9d, 0x6d, 0xa1, 0x6d, 0xa6, 0x6d, 0xab, 0x6d, 
+0xb0, 0x6d, 0xb4, 0x6d, 0xb9, 0x6d, 0xbe, 0x6d, 0xc3, 0x6d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x72, 0x09, 0x72, 0x0e, 0x72, 0x13, 0x72, 
+0x17, 0x72, 0x1c, 0x72, 0x21, 0x72, 0x26, 0x72, 0x2a, 0x72, 0x2f, 0x72, 0x34, 0x72, 0x39, 0x72, 
+0x3d, 0x72, 0x42, 0x72, 0x47, 0x72, 0x4c, 0x72, 0x50, 0x72, 0x55, 0x72, 0x5a, 0x72, 0x5f, 0x72, 
+0x64, 0x72, 0x68, 0x72, 0x6d, 0x72, 0x72, 0x72, 0x77, 0x72, 0x7b, 0x72, 0x80, 0x72, 0x85, 0x72, 
+0x8a, 0x72, 0x8e, 0x72, 0x93, 0x72, 0x98, 0x72, 0x9d, 0x72, 0xa1, 0x72, 0xa6, 0x72, 0xab, 0x72, 
+0xb0, 0x72, 0xb4, 0x72, 0xb9, 0x72, 0xbe, 0x72, 0xc3, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x77, 0x09, 0x77, 0x0e, 0x77, 0x13, 0x77, 
+0x17, 0x77, 0x1c, 0x77, 0x21, 0x77, 0x26, 0x77, 0x2a, 0x77, 0x2f, 0x77, 0x34, 0x77, 0x39, 0x77, 
+0x3d, 0x77, 0x42, 0x77, 0x47, 0x77, 0x4c, 0x77, 0x50, 0x77, 0x55, 0x77, 0x5a, 0x77, 0x5f, 0x77, 
+0x64, 0x77, 0x68, 0x77, 0x6d, 0x77, 0x72, 0x77, 0x77, 0x77, 0x7b, 0x77, 0x80, 0x77, 0x85, 0x77, 
+0x8a, 0x77, 0x8e, 0x77, 0x93, 0x77, 0x98, 0x77, 0x9d, 0x77, 0xa1, 0x77, 0xa6, 0x77, 0xab, 0x77, 
+0xb0, 0x77, 0xb4, 0x77, 0xb9, 0x77, 0xbe, 0x77, 0xc3, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x7b, 0x09, 0x7b, 0x0e, 0x7b, 0x13, 0x7b, 
+0x17, 0x7b, 0x1c, 0x7b, 0x21, 0x7b, 0x26, 0x7b, 0x2a, 0x7b, 0x2f, 0x7b, 0x34, 0x7b, 0x39, 0x7b, 
+0x3d, 0x7b, 0x42, 0x7b, 0x47, 0x7b, 0x4c, 0x7b, 0x50, 0x7b, 0x55, 0x7b, 0x5a, 0x7b, 0x5f, 0x7b, 
+0x64, 0x7b, 0x68, 0x7b, 0x6d, 0x7b, 0x72, 0x7b, 0x77, 0x7b, 0x7b, 0x7b, 0x80, 0x7b, 0x85, 0x7b, 
+0x8a, 0x7b, 0x8e, 0x7b, 0x93, 0x7b, 0x98, 0x7b, 0x9d, 0x7b, 0xa1, 0x7b, 0xa6, 0x7b, 0xab, 0x7b, 
+0xb0, 0x7b, 0xb4, 0x7b, 0xb9, 0x7b, 0xbe, 0x7b, 0xc3, 0x7b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x09, 0x80, 0x0e, 0x80, 0x13, 0x80, 
+0x17, 0x80, 0x1c, 0x80, 0x21, 0x80, 0x26, 0x80, 0x2a, 0x80, 0x2f, 0x80, 0x34, 0x80, 0x39, 0x80, 
+0x3d, 0x80, 0x42, 0x80, 0x47, 0x80, 0x4c, 0x80, 0x50, 0x80, 0x55, 0x80, 0x5a, 0x80, 0x5f, 0x80, 
+0x64, 0x80, 0x68, 0x80, 0x6d, 0x80, 0x72, 0x80, 0x77, 0x80, 0x7b, 0x80, 0x80, 0x80, 0x85, 0x80, 
+0x8a, 0x80, 0x8e, 0x80, 0x93, 0x80, 0x98, 0x80, 0x9d, 0x80, 0xa1, 0x80, 0xa6, 0x80, 0xab, 0x80, 
+0xb0, 0x80, 0xb4, 0x80, 0xb9, 0x80, 0xbe, 0x80, 0xc3, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x85, 0x0e, 0x85, 0x13, 0x85, 
+0x17, 0x85, 0x1c, 0x85, 0x21, 0x85, 0x26, 0x85, 0x2a, 0x85, 0x2f, 0x85, 0x34, 0x85, 0x39, 0x85, 
+0x3d, 0x85, 0x42, 0x85, 0x47, 0x85, 0x4c, 0x85, 0x50, 0x85, 0x55, 0x85, 0x5a, 0x85, 0x5f, 0x85, 
+0x64, 0x85, 0x68, 0x85, 0x6d, 0x85, 0x72, 0x85, 0x77, 0x85, 0x7b, 0x85, 0x80, 0x85, 0x85, 0x85, 
+0x8a, 0x85, 0x8e, 0x85, 0x93, 0x85, 0x98, 0x85, 0x9d, 0x85, 0xa1, 0x85, 0xa6, 0x85, 0xab, 0x85, 
+0xb0, 0x85, 0xb4, 0x85, 0xb9, 0x85, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x8a, 0x0e, 0x8a, 0x13, 0x8a, 
+0x17, 0x8a, 0x1c, 0x8a, 0x21, 0x8a, 0x26, 0x8a, 0x2a, 0x8a, 0x2f, 0x8a, 0x34, 0x8a, 0x39, 0x8a, 
+0x3d, 0x8a, 0x42, 0x8a, 0x47, 0x8a, 0x4c, 0x8a, 0x50, 0x8a, 0x55, 0x8a, 0x5a, 0x8a, 0x5f, 0x8a, 
+0x64, 0x8a, 0x68, 0x8a, 0x6d, 0x8a, 0x72, 0x8a, 0x77, 0x8a, 0x7b, 0x8a, 0x80, 0x8a, 0x85, 0x8a, 
+0x8a, 0x8a, 0x8e, 0x8a, 0x93, 0x8a, 0x98, 0x8a, 0x9d, 0x8a, 0xa1, 0x8a, 0xa6, 0x8a, 0xab, 0x8a, 
+0xb0, 0x8a, 0xb4, 0x8a, 0xb9, 0x8a, 0xbe, 0x8a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8e, 0x13, 0x8e, 
+0x17, 0x8e, 0x1c, 0x8e, 0x21, 0x8e, 0x26, 0x8e, 0x2a, 0x8e, 0x2f, 0x8e, 0x34, 0x8e, 0x39, 0x8e, 
+0x3d, 0x8e, 0x42, 0x8e, 0x47, 0x8e, 0x4c, 0x8e, 0x50, 0x8e, 0x55, 0x8e, 0x5a, 0x8e, 0x5f, 0x8e, 
+0x64, 0x8e, 0x68, 0x8e, 0x6d, 0x8e, 0x72, 0x8e, 0x77, 0x8e, 0x7b, 0x8e, 0x80, 0x8e, 0x85, 0x8e, 
+0x8a, 0x8e, 0x8e, 0x8e, 0x93, 0x8e, 0x98, 0x8e, 0x9d, 0x8e, 0xa1, 0x8e, 0xa6, 0x8e, 0xab, 0x8e, 
+0xb0, 0x8e, 0xb4, 0x8e, 0xb9, 0x8e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x93, 0x13, 0x93, 
+0x17, 0x93, 0x1c, 0x93, 0x21, 0x93, 0x26, 0x93, 0x2a, 0x93, 0x2f, 0x93, 0x34, 0x93, 0x39, 0x93, 
+0x3d, 0x93, 0x42, 0x93, 0x47, 0x93, 0x4c, 0x93, 0x50, 0x93, 0x55, 0x93, 0x5a, 0x93, 0x5f, 0x93, 
+0x64, 0x93, 0x68, 0x93, 0x6d, 0x93, 0x72, 0x93, 0x77, 0x93, 0x7b, 0x93, 0x80, 0x93, 0x85, 0x93, 
+0x8a, 0x93, 0x8e, 0x93, 0x93, 0x93, 0x98, 0x93, 0x9d, 0x93, 0xa1, 0x93, 0xa6, 0x93, 0xab, 0x93, 
+0xb0, 0x93, 0xb4, 0x93, 0xb9, 0x93, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x98, 
+0x17, 0x98, 0x1c, 0x98, 0x21, 0x98, 0x26, 0x98, 0x2a, 0x98, 0x2f, 0x98, 0x34, 0x98, 0x39, 0x98, 
+0x3d, 0x98, 0x42, 0x98, 0x47, 0x98, 0x4c, 0x98, 0x50, 0x98, 0x55, 0x98, 0x5a, 0x98, 0x5f, 0x98, 
+0x64, 0x98, 0x68, 0x98, 0x6d, 0x98, 0x72, 0x98, 0x77, 0x98, 0x7b, 0x98, 0x80, 0x98, 0x85, 0x98, 
+0x8a, 0x98, 0x8e, 0x98, 0x93, 0x98, 0x98, 0x98, 0x9d, 0x98, 0xa1, 0x98, 0xa6, 0x98, 0xab, 0x98, 
+0xb0, 0x98, 0xb4, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x9d, 
+0x17, 0x9d, 0x1c, 0x9d, 0x21, 0x9d, 0x26, 0x9d, 0x2a, 0x9d, 0x2f, 0x9d, 0x34, 0x9d, 0x39, 0x9d, 
+0x3d, 0x9d, 0x42, 0x9d, 0x47, 0x9d, 0x4c, 0x9d, 0x50, 0x9d, 0x55, 0x9d, 0x5a, 0x9d, 0x5f, 0x9d, 
+0x64, 0x9d, 0x68, 0x9d, 0x6d, 0x9d, 0x72, 0x9d, 0x77, 0x9d, 0x7b, 0x9d, 0x80, 0x9d, 0x85, 0x9d, 
+0x8a, 0x9d, 0x8e, 0x9d, 0x93, 0x9d, 0x98, 0x9d, 0x9d, 0x9d, 0xa1, 0x9d, 0xa6, 0x9d, 0xab, 0x9d, 
+0xb0, 0x9d, 0xb4, 0x9d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0xa1, 0x1c, 0xa1, 0x21, 0xa1, 0x26, 0xa1, 0x2a, 0xa1, 0x2f, 0xa1, 0x34, 0xa1, 0x39, 0xa1, 
+0x3d, 0xa1, 0x42, 0xa1, 0x47, 0xa1, 0x4c, 0xa1, 0x50, 0xa1, 0x55, 0xa1, 0x5a, 0xa1, 0x5f, 0xa1, 
+0x64, 0xa1, 0x68, 0xa1, 0x6d, 0xa1, 0x72, 0xa1, 0x77, 0xa1, 0x7b, 0xa1, 0x80, 0xa1, 0x85, 0xa1, 
+0x8a, 0xa1, 0x8e, 0xa1, 0x93, 0xa1, 0x98, 0xa1, 0x9d, 0xa1, 0xa1, 0xa1, 0xa6, 0xa1, 0xab, 0xa1, 
+0xb0, 0xa1, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0xa6, 0x21, 0xa6, 0x26, 0xa6, 0x2a, 0xa6, 0x2f, 0xa6, 0x34, 0xa6, 0x39, 0xa6, 
+0x3d, 0xa6, 0x42, 0xa6, 0x47, 0xa6, 0x4c, 0xa6, 0x50, 0xa6, 0x55, 0xa6, 0x5a, 0xa6, 0x5f, 0xa6, 
+0x64, 0xa6, 0x68, 0xa6, 0x6d, 0xa6, 0x72, 0xa6, 0x77, 0xa6, 0x7b, 0xa6, 0x80, 0xa6, 0x85, 0xa6, 
+0x8a, 0xa6, 0x8e, 0xa6, 0x93, 0xa6, 0x98, 0xa6, 0x9d, 0xa6, 0xa1, 0xa6, 0xa6, 0xa6, 0xab, 0xa6, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0xab, 0x26, 0xab, 0x2a, 0xab, 0x2f, 0xab, 0x34, 0xab, 0x39, 0xab, 
+0x3d, 0xab, 0x42, 0xab, 0x47, 0xab, 0x4c, 0xab, 0x50, 0xab, 0x55, 0xab, 0x5a, 0xab, 0x5f, 0xab, 
+0x64, 0xab, 0x68, 0xab, 0x6d, 0xab, 0x72, 0xab, 0x77, 0xab, 0x7b, 0xab, 0x80, 0xab, 0x85, 0xab, 
+0x8a, 0xab, 0x8e, 0xab, 0x93, 0xab, 0x98, 0xab, 0x9d, 0xab, 0xa1, 0xab, 0xa6, 0xab, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0xb0, 0x2a, 0xb0, 0x2f, 0xb0, 0x34, 0xb0, 0x39, 0xb0, 
+0x3d, 0xb0, 0x42, 0xb0, 0x47, 0xb0, 0x4c, 0xb0, 0x50, 0xb0, 0x55, 0xb0, 0x5a, 0xb0, 0x5f, 0xb0, 
+0x64, 0xb0, 0x68, 0xb0, 0x6d, 0xb0, 0x72, 0xb0, 0x77, 0xb0, 0x7b, 0xb0, 0x80, 0xb0, 0x85, 0xb0, 
+0x8a, 0xb0, 0x8e, 0xb0, 0x93, 0xb0, 0x98, 0xb0, 0x9d, 0xb0, 0xa1, 0xb0, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2a, 0xb4, 0x2f, 0xb4, 0x34, 0xb4, 0x39, 0xb4, 
+0x3d, 0xb4, 0x42, 0xb4, 0x47, 0xb4, 0x4c, 0xb4, 0x50, 0xb4, 0x55, 0xb4, 0x5a, 0xb4, 0x5f, 0xb4, 
+0x64, 0xb4, 0x68, 0xb4, 0x6d, 0xb4, 0x72, 0xb4, 0x77, 0xb4, 0x7b, 0xb4, 0x80, 0xb4, 0x85, 0xb4, 
+0x8a, 0xb4, 0x8e, 0xb4, 0x93, 0xb4, 0x98, 0xb4, 0x9d, 0xb4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x34, 0xb9, 0x39, 0xb9, 
+0x3d, 0xb9, 0x42, 0xb9, 0x47, 0xb9, 0x4c, 0xb9, 0x50, 0xb9, 0x55, 0xb9, 0x5a, 0xb9, 0x5f, 0xb9, 
+0x64, 0xb9, 0x68, 0xb9, 0x6d, 0xb9, 0x72, 0xb9, 0x77, 0xb9, 0x7b, 0xb9, 0x80, 0xb9, 0x85, 0xb9, 
+0x8a, 0xb9, 0x8e, 0xb9, 0x93, 0xb9, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3d, 0xbe, 0x42, 0xbe, 0x47, 0xbe, 0x4c, 0xbe, 0x50, 0xbe, 0x55, 0xbe, 0x5a, 0xbe, 0x5f, 0xbe, 
+0x64, 0xbe, 0x68, 0xbe, 0x6d, 0xbe, 0x72, 0xbe, 0x77, 0xbe, 0x7b, 0xbe, 0x80, 0xbe, 0x85, 0xbe, 
+0x8a, 0xbe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0xc3, 0x4c, 0xc3, 0x50, 0xc3, 0x55, 0xc3, 0x5a, 0xc3, 0x5f, 0xc3, 
+0x64, 0xc3, 0x68, 0xc3, 0x6d, 0xc3, 0x72, 0xc3, 0x77, 0xc3, 0x7b, 0xc3, 0x80, 0xc3, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x5d, 0x00, 0x61, 0x00, 0x67, 0x00, 0x70, 0x00, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x4c, 0x02, 0x4e, 0x02, 
+0x51, 0x03, 0x55, 0x03, 0x58, 0x03, 0x5c, 0x03, 0x61, 0x04, 0x67, 0x04, 0x70, 0x04, 0x79, 0x04, 
+0x82, 0x05, 0x8a, 0x08, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x45, 0x04, 0x45, 0x04, 0x46, 0x05, 0x48, 0x06, 0x4b, 0x07, 0x4e, 0x09, 
+0x51, 0x0b, 0x55, 0x0c, 0x59, 0x0e, 0x5d, 0x0f, 0x61, 0x0f, 0x67, 0x0f, 0x70, 0x0f, 0x79, 0x0e, 
+0x83, 0x0d, 0x8c, 0x0d, 0x95, 0x0e, 0x9c, 0x11, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 
+0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x64, 0x00, 0x4c, 0x02, 0x48, 0x04, 
+0x45, 0x05, 0x43, 0x06, 0x43, 0x08, 0x44, 0x0a, 0x46, 0x0d, 0x48, 0x10, 0x4b, 0x13, 0x4f, 0x16, 
+0x52, 0x19, 0x56, 0x1b, 0x5a, 0x1d, 0x5d, 0x1f, 0x61, 0x1f, 0x67, 0x1f, 0x6f, 0x1e, 0x78, 0x1d, 
+0x81, 0x1a, 0x8b, 0x18, 0x95, 0x16, 0x9e, 0x16, 0xa5, 0x19, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0x0b, 0x47, 0x0b, 0x53, 0x0b, 0x5f, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 
+0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x64, 0x0b, 0x52, 0x0d, 0x4c, 0x0f, 0x48, 0x11, 
+0x47, 0x15, 0x46, 0x19, 0x47, 0x1d, 0x49, 0x21, 0x4b, 0x25, 0x4e, 0x28, 0x50, 0x2c, 0x53, 0x2f, 
+0x56, 0x31, 0x5a, 0x37, 0x5d, 0x3a, 0x5f, 0x3b, 0x62, 0x3b, 0x66, 0x3b, 0x6b, 0x3b, 0x71, 0x38, 
+0x7a, 0x34, 0x88, 0x26, 0x93, 0x22, 0x9e, 0x20, 0xa8, 0x1f, 0xae, 0x22, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0x17, 0x2f, 0x17, 
+0x3b, 0x17, 0x47, 0x17, 0x53, 0x17, 0x5f, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 
+0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x64, 0x17, 0x52, 0x19, 0x4d, 0x1b, 0x49, 0x1f, 
+0x48, 0x23, 0x48, 0x27, 0x49, 0x2b, 0x4b, 0x2f, 0x4d, 0x33, 0x50, 0x36, 0x53, 0x39, 0x55, 0x3b, 
+0x59, 0x41, 0x5b, 0x43, 0x5e, 0x44, 0x60, 0x45, 0x62, 0x45, 0x65, 0x45, 0x6a, 0x44, 0x70, 0x43, 
+0x75, 0x42, 0x7d, 0x3e, 0x8c, 0x33, 0x9b, 0x2c, 0xa7, 0x29, 0xb1, 0x29, 0xb6, 0x2b, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x23, 0x23, 0x23, 0x2f, 0x23, 
+0x3b, 0x23, 0x47, 0x23, 0x53, 0x23, 0x5f, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 
+0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x64, 0x23, 0x53, 0x25, 0x4d, 0x28, 0x4a, 0x2b, 
+0x49, 0x2f, 0x4a, 0x33, 0x4b, 0x37, 0x4d, 0x3a, 0x4f, 0x3e, 0x52, 0x40, 0x54, 0x43, 0x58, 0x48, 
+0x5a, 0x49, 0x5c, 0x4a, 0x5e, 0x4b, 0x60, 0x4b, 0x62, 0x4c, 0x65, 0x4c, 0x6a, 0x4b, 0x6f, 0x4b, 
+0x74, 0x4a, 0x7a, 0x48, 0x82, 0x45, 0x94, 0x3b, 0xa5, 0x34, 0xb1, 0x32, 0xb9, 0x32, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x2f, 0x23, 0x2f, 0x2f, 0x2f, 
+0x3b, 0x2f, 0x47, 0x2f, 0x53, 0x2f, 0x5f, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 
+0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x64, 0x2f, 0x5b, 0x2f, 0x53, 0x30, 0x4e, 0x33, 0x4c, 0x36, 
+0x4b, 0x3a, 0x4b, 0x3e, 0x4c, 0x41, 0x4e, 0x44, 0x51, 0x47, 0x53, 0x49, 0x57, 0x4d, 0x59, 0x4f, 
+0x5b, 0x50, 0x5d, 0x50, 0x5e, 0x51, 0x60, 0x51, 0x62, 0x51, 0x65, 0x51, 0x69, 0x51, 0x6e, 0x50, 
+0x73, 0x50, 0x78, 0x4f, 0x7f, 0x4d, 0x89, 0x4a, 0xa1, 0x3f, 0xaf, 0x3c, 0xba, 0x3b, 0xbf, 0x3d, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x3b, 0x17, 0x3b, 0x23, 0x3b, 0x2f, 0x3b, 
+0x3b, 0x3b, 0x47, 0x3b, 0x53, 0x3b, 0x5f, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 
+0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x64, 0x3b, 0x5a, 0x3a, 0x53, 0x3b, 0x4f, 0x3d, 0x4d, 0x40, 
+0x4c, 0x43, 0x4d, 0x46, 0x4e, 0x49, 0x50, 0x4c, 0x51, 0x4e, 0x55, 0x51, 0x57, 0x53, 0x59, 0x54, 
+0x5b, 0x55, 0x5d, 0x55, 0x5f, 0x55, 0x60, 0x56, 0x62, 0x56, 0x65, 0x56, 0x69, 0x56, 0x6e, 0x55, 
+0x72, 0x55, 0x77, 0x54, 0x7d, 0x53, 0x85, 0x52, 0x93, 0x4d, 0xad, 0x46, 0xba, 0x44, 0xc2, 0x45, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x47, 0x17, 0x47, 0x23, 0x47, 0x2f, 0x47, 
+0x3b, 0x47, 0x47, 0x47, 0x53, 0x47, 0x5f, 0x47, 0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 
+0x64, 0x47, 0x64, 0x47, 0x64, 0x47, 0x61, 0x46, 0x59, 0x45, 0x53, 0x46, 0x4f, 0x47, 0x4e, 0x49, 
+0x4e, 0x4b, 0x4e, 0x4e, 0x50, 0x50, 0x51, 0x52, 0x53, 0x54, 0x56, 0x57, 0x58, 0x58, 0x5a, 0x59, 
+0x5b, 0x59, 0x5d, 0x5a, 0x5f, 0x5a, 0x60, 0x5a, 0x62, 0x5a, 0x65, 0x5a, 0x69, 0x5a, 0x6d, 0x5a, 
+0x72, 0x59, 0x77, 0x59, 0x7c, 0x58, 0x84, 0x57, 0x8f, 0x56, 0xaa, 0x4f, 0xb9, 0x4e, 0xc3, 0x4e, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x53, 0x17, 0x53, 0x23, 0x53, 0x2f, 0x53, 
+0x3b, 0x53, 0x47, 0x53, 0x53, 0x53, 0x5f, 0x53, 0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 
+0x64, 0x53, 0x64, 0x53, 0x64, 0x53, 0x5f, 0x52, 0x57, 0x50, 0x52, 0x50, 0x4f, 0x50, 0x4e, 0x51, 
+0x4e, 0x53, 0x4f, 0x54, 0x51, 0x56, 0x52, 0x57, 0x54, 0x58, 0x57, 0x5b, 0x59, 0x5c, 0x5a, 0x5d, 
+0x5c, 0x5d, 0x5d, 0x5e, 0x5f, 0x5e, 0x61, 0x5e, 0x62, 0x5e, 0x65, 0x5e, 0x69, 0x5e, 0x6d, 0x5e, 
+0x71, 0x5e, 0x76, 0x5e, 0x7c, 0x5d, 0x83, 0x5d, 0x8c, 0x5c, 0xa9, 0x58, 0xb8, 0x57, 0xc3, 0x57, 
+0xc7, 0x57, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5f, 0x17, 0x5f, 0x23, 0x5f, 0x2f, 0x5f, 
+0x3b, 0x5f, 0x47, 0x5f, 0x53, 0x5f, 0x5f, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 
+0x64, 0x5f, 0x64, 0x5f, 0x64, 0x5f, 0x5c, 0x5c, 0x55, 0x5a, 0x51, 0x59, 0x4f, 0x59, 0x4e, 0x59, 
+0x4f, 0x59, 0x50, 0x5a, 0x51, 0x5b, 0x53, 0x5c, 0x56, 0x5d, 0x58, 0x5e, 0x5a, 0x5f, 0x5b, 0x5f, 
+0x5c, 0x60, 0x5e, 0x60, 0x5f, 0x61, 0x61, 0x62, 0x62, 0x62, 0x65, 0x62, 0x69, 0x62, 0x6d, 0x62, 
+0x71, 0x62, 0x76, 0x62, 0x7b, 0x62, 0x82, 0x62, 0x8c, 0x61, 0xa8, 0x60, 0xb8, 0x60, 0xc3, 0x60, 
+0xc7, 0x60, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x6b, 0x17, 0x6b, 0x23, 0x6b, 0x2f, 0x6b, 
+0x3b, 0x6b, 0x47, 0x6b, 0x53, 0x6b, 0x5f, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 0x64, 0x6b, 
+0x64, 0x6b, 0x64, 0x6b, 0x61, 0x6a, 0x59, 0x66, 0x53, 0x63, 0x4f, 0x61, 0x4e, 0x60, 0x4e, 0x5f, 
+0x4f, 0x5f, 0x50, 0x5f, 0x52, 0x5f, 0x53, 0x60, 0x57, 0x61, 0x58, 0x61, 0x5a, 0x61, 0x5b, 0x62, 
+0x5d, 0x62, 0x5e, 0x63, 0x60, 0x63, 0x61, 0x64, 0x63, 0x64, 0x65, 0x65, 0x69, 0x66, 0x6d, 0x66, 
+0x71, 0x66, 0x76, 0x66, 0x7c, 0x66, 0x82, 0x66, 0x8c, 0x67, 0xa8, 0x68, 0xb8, 0x69, 0xc3, 0x69, 
+0xc7, 0x69, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x77, 0x17, 0x77, 0x23, 0x77, 0x2f, 0x77, 
+0x3b, 0x77, 0x47, 0x77, 0x53, 0x77, 0x5f, 0x77, 0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 0x64, 0x77, 
+0x64, 0x77, 0x64, 0x77, 0x5d, 0x73, 0x55, 0x6f, 0x50, 0x6b, 0x4d, 0x68, 0x4d, 0x66, 0x4d, 0x65, 
+0x4e, 0x64, 0x50, 0x64, 0x52, 0x63, 0x53, 0x63, 0x57, 0x64, 0x59, 0x64, 0x5a, 0x64, 0x5c, 0x64, 
+0x5d, 0x65, 0x5f, 0x65, 0x60, 0x65, 0x62, 0x66, 0x64, 0x66, 0x66, 0x67, 0x6a, 0x68, 0x6e, 0x69, 
+0x72, 0x69, 0x76, 0x6a, 0x7c, 0x6b, 0x83, 0x6b, 0x8d, 0x6c, 0xa9, 0x71, 0xb8, 0x72, 0xc3, 0x72, 
+0xc7, 0x71, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x82, 0x17, 0x82, 0x23, 0x82, 0x2f, 0x82, 
+0x3b, 0x82, 0x47, 0x82, 0x53, 0x82, 0x5f, 0x82, 0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 0x64, 0x82, 
+0x64, 0x82, 0x64, 0x82, 0x58, 0x7c, 0x51, 0x77, 0x4d, 0x72, 0x4b, 0x6f, 0x4b, 0x6c, 0x4c, 0x6a, 
+0x4d, 0x69, 0x4f, 0x68, 0x51, 0x67, 0x55, 0x66, 0x57, 0x66, 0x59, 0x66, 0x5a, 0x66, 0x5c, 0x66, 
+0x5d, 0x67, 0x5f, 0x67, 0x61, 0x67, 0x62, 0x68, 0x64, 0x68, 0x67, 0x69, 0x6b, 0x6a, 0x6e, 0x6b, 
+0x73, 0x6c, 0x77, 0x6d, 0x7d, 0x6e, 0x84, 0x70, 0x8f, 0x73, 0xab, 0x7a, 0xb9, 0x7b, 0xc3, 0x7b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x8e, 0x17, 0x8e, 0x23, 0x8e, 0x2f, 0x8e, 
+0x3b, 0x8e, 0x47, 0x8e, 0x53, 0x8e, 0x5f, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 0x64, 0x8e, 
+0x64, 0x8e, 0x5c, 0x8b, 0x53, 0x84, 0x4d, 0x7e, 0x4a, 0x79, 0x49, 0x74, 0x49, 0x71, 0x4b, 0x6e, 
+0x4d, 0x6c, 0x4f, 0x6b, 0x51, 0x6a, 0x55, 0x69, 0x57, 0x68, 0x59, 0x68, 0x5a, 0x68, 0x5c, 0x68, 
+0x5e, 0x68, 0x5f, 0x69, 0x61, 0x69, 0x63, 0x6a, 0x65, 0x6a, 0x68, 0x6b, 0x6b, 0x6c, 0x6f, 0x6d, 
+0x74, 0x6e, 0x79, 0x70, 0x7f, 0x71, 0x87, 0x74, 0x96, 0x79, 0xae, 0x81, 0xba, 0x84, 0xc1, 0x84, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x9a, 0x23, 0x9a, 0x2f, 0x9a, 
+0x3b, 0x9a, 0x47, 0x9a, 0x53, 0x9a, 0x5f, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 0x64, 0x9a, 
+0x64, 0x9a, 0x56, 0x93, 0x4e, 0x8c, 0x49, 0x85, 0x46, 0x7e, 0x46, 0x79, 0x47, 0x75, 0x49, 0x72, 
+0x4b, 0x70, 0x4e, 0x6e, 0x51, 0x6c, 0x55, 0x6b, 0x57, 0x6a, 0x59, 0x6a, 0x5a, 0x6a, 0x5c, 0x6a, 
+0x5e, 0x6a, 0x60, 0x6a, 0x62, 0x6b, 0x64, 0x6c, 0x66, 0x6c, 0x69, 0x6d, 0x6c, 0x6e, 0x71, 0x6f, 
+0x75, 0x71, 0x7a, 0x72, 0x81, 0x75, 0x8b, 0x78, 0xa4, 0x83, 0xb2, 0x87, 0xbc, 0x89, 0xc0, 0x89, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xa6, 0x2f, 0xa6, 
+0x3b, 0xa6, 0x47, 0xa6, 0x53, 0xa6, 0x5f, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 0x64, 0xa6, 
+0x5a, 0xa2, 0x4f, 0x9b, 0x48, 0x93, 0x44, 0x8b, 0x42, 0x84, 0x43, 0x7e, 0x45, 0x79, 0x47, 0x76, 
+0x4a, 0x73, 0x4d, 0x71, 0x52, 0x6e, 0x54, 0x6d, 0x56, 0x6c, 0x58, 0x6c, 0x5a, 0x6c, 0x5c, 0x6c, 
+0x5e, 0x6c, 0x60, 0x6c, 0x62, 0x6d, 0x65, 0x6d, 0x67, 0x6e, 0x6a, 0x6f, 0x6e, 0x71, 0x72, 0x72, 
+0x77, 0x73, 0x7d, 0x76, 0x85, 0x79, 0x95, 0x80, 0xa9, 0x89, 0xb5, 0x8d, 0xbd, 0x8e, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2f, 0xb2, 
+0x3b, 0xb2, 0x47, 0xb2, 0x53, 0xb2, 0x5f, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 0x64, 0xb2, 
+0x52, 0xab, 0x47, 0xa3, 0x41, 0x9a, 0x3d, 0x91, 0x3d, 0x89, 0x3e, 0x83, 0x41, 0x7d, 0x44, 0x79, 
+0x48, 0x76, 0x4b, 0x73, 0x51, 0x70, 0x54, 0x6e, 0x56, 0x6e, 0x58, 0x6d, 0x5a, 0x6d, 0x5c, 0x6d, 
+0x5f, 0x6d, 0x61, 0x6e, 0x63, 0x6f, 0x66, 0x6f, 0x68, 0x70, 0x6b, 0x72, 0x6f, 0x73, 0x74, 0x75, 
+0x79, 0x77, 0x80, 0x7a, 0x8d, 0x80, 0x9d, 0x88, 0xae, 0x8f, 0xb8, 0x92, 0xbc, 0x91, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0xbe, 0x47, 0xbe, 0x53, 0xbe, 0x5f, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 0x64, 0xbe, 
+0x48, 0xb5, 0x3e, 0xad, 0x37, 0xa3, 0x35, 0x99, 0x35, 0x90, 0x38, 0x88, 0x3c, 0x82, 0x40, 0x7d, 
+0x44, 0x79, 0x4b, 0x74, 0x50, 0x72, 0x52, 0x70, 0x55, 0x70, 0x57, 0x6f, 0x5a, 0x6f, 0x5c, 0x6f, 
+0x5f, 0x6f, 0x62, 0x70, 0x64, 0x71, 0x67, 0x72, 0x69, 0x73, 0x6d, 0x74, 0x72, 0x76, 0x77, 0x78, 
+0x7e, 0x7c, 0x88, 0x81, 0x93, 0x86, 0xa7, 0x91, 0xb2, 0x94, 0xb9, 0x95, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x30, 0xb9, 0x27, 0xb1, 0x22, 0xa9, 0x22, 0x9f, 0x25, 0x96, 0x2b, 0x8e, 0x32, 0x87, 
+0x39, 0x81, 0x45, 0x79, 0x4b, 0x76, 0x4e, 0x74, 0x52, 0x73, 0x55, 0x73, 0x58, 0x72, 0x5c, 0x73, 
+0x5f, 0x73, 0x62, 0x74, 0x66, 0x75, 0x69, 0x76, 0x6c, 0x78, 0x70, 0x7a, 0x76, 0x7c, 0x7d, 0x7f, 
+0x84, 0x82, 0x8e, 0x87, 0x9b, 0x8e, 0xad, 0x97, 0xb5, 0x99, 0xb9, 0x98, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x1c, 0xa9, 0x1b, 0xa1, 0x1d, 0x99, 0x23, 0x91, 0x2b, 0x8a, 
+0x33, 0x84, 0x43, 0x7a, 0x48, 0x77, 0x4d, 0x76, 0x51, 0x75, 0x55, 0x74, 0x58, 0x74, 0x5c, 0x75, 
+0x60, 0x75, 0x64, 0x76, 0x67, 0x78, 0x6b, 0x79, 0x6f, 0x7b, 0x74, 0x7e, 0x7a, 0x80, 0x81, 0x83, 
+0x89, 0x87, 0x94, 0x8d, 0xa8, 0x99, 0xb1, 0x9b, 0xb6, 0x9b, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x15, 0xa0, 0x16, 0x9a, 0x1c, 0x93, 0x24, 0x8c, 
+0x36, 0x81, 0x40, 0x7b, 0x46, 0x79, 0x4b, 0x77, 0x4f, 0x76, 0x54, 0x76, 0x58, 0x76, 0x5c, 0x76, 
+0x61, 0x77, 0x65, 0x79, 0x6a, 0x7a, 0x6e, 0x7c, 0x72, 0x7f, 0x77, 0x82, 0x7e, 0x85, 0x86, 0x88, 
+0x90, 0x8d, 0x9c, 0x94, 0xad, 0x9e, 0xb3, 0x9e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x98, 0x15, 0x93, 0x1d, 0x8d, 
+0x33, 0x80, 0x3c, 0x7c, 0x43, 0x79, 0x49, 0x78, 0x4e, 0x77, 0x53, 0x77, 0x58, 0x77, 0x5d, 0x78, 
+0x62, 0x79, 0x67, 0x7b, 0x6c, 0x7d, 0x71, 0x7f, 0x76, 0x82, 0x7c, 0x86, 0x84, 0x89, 0x8c, 0x8e, 
+0x97, 0x93, 0xa5, 0x9b, 0xb1, 0xa0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x93, 0x0f, 0x8f, 0x1d, 0x87, 
+0x2f, 0x7e, 0x39, 0x7b, 0x40, 0x79, 0x47, 0x78, 0x4d, 0x77, 0x53, 0x77, 0x59, 0x78, 0x5e, 0x79, 
+0x64, 0x7b, 0x6a, 0x7d, 0x70, 0x7f, 0x76, 0x82, 0x7b, 0x86, 0x82, 0x8a, 0x8a, 0x8e, 0x94, 0x93, 
+0x9f, 0x99, 0xae, 0xa2, 0xb2, 0xa1, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x88, 0x1d, 0x80, 
+0x2b, 0x7b, 0x35, 0x78, 0x3d, 0x77, 0x45, 0x76, 0x4c, 0x76, 0x53, 0x77, 0x59, 0x78, 0x60, 0x79, 
+0x67, 0x7b, 0x6e, 0x7e, 0x74, 0x81, 0x7b, 0x84, 0x81, 0x89, 0x88, 0x8d, 0x91, 0x92, 0x9b, 0x97, 
+0xa7, 0x9d, 0xb1, 0xa2, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x7f, 0x1a, 0x78, 
+0x27, 0x75, 0x32, 0x73, 0x3b, 0x72, 0x43, 0x72, 0x4b, 0x73, 0x53, 0x74, 0x5b, 0x76, 0x63, 0x78, 
+0x6a, 0x7b, 0x72, 0x7e, 0x79, 0x81, 0x81, 0x86, 0x88, 0x8a, 0x90, 0x8f, 0x99, 0x95, 0xa3, 0x9a, 
+0xaf, 0xa1, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x07, 0x71, 0x18, 0x6e, 
+0x24, 0x6c, 0x2f, 0x6b, 0x39, 0x6c, 0x42, 0x6c, 0x4b, 0x6e, 0x54, 0x6f, 0x5d, 0x72, 0x66, 0x74, 
+0x6e, 0x78, 0x77, 0x7c, 0x80, 0x80, 0x88, 0x85, 0x90, 0x8a, 0x98, 0x90, 0xa2, 0x95, 0xab, 0x9b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0a, 0x61, 0x17, 0x60, 
+0x23, 0x60, 0x2e, 0x61, 0x38, 0x62, 0x42, 0x63, 0x4c, 0x65, 0x56, 0x68, 0x60, 0x6b, 0x6a, 0x6e, 
+0x73, 0x72, 0x7d, 0x77, 0x86, 0x7c, 0x8f, 0x82, 0x98, 0x88, 0xa0, 0x8e, 0xaa, 0x94, 0xb3, 0x9a, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x44, 0x1a, 0x48, 
+0x25, 0x4c, 0x2f, 0x50, 0x3a, 0x54, 0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 0x6e, 0x67, 
+0x78, 0x6b, 0x83, 0x6f, 0x8d, 0x73, 0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x14, 0x46, 0x1e, 0x4a, 
+0x29, 0x4d, 0x33, 0x51, 0x3e, 0x55, 0x48, 0x59, 0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 0x72, 0x69, 
+0x7c, 0x6d, 0x87, 0x71, 0x91, 0x75, 0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x43, 0x18, 0x47, 0x22, 0x4b, 
+0x2d, 0x4f, 0x37, 0x53, 0x42, 0x57, 0x4c, 0x5b, 0x56, 0x5f, 0x61, 0x63, 0x6b, 0x66, 0x76, 0x6a, 
+0x80, 0x6e, 0x8b, 0x72, 0x95, 0x76, 0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x41, 0x11, 0x45, 0x1c, 0x49, 0x26, 0x4d, 
+0x31, 0x50, 0x3b, 0x54, 0x45, 0x58, 0x50, 0x5c, 0x5a, 0x60, 0x65, 0x64, 0x6f, 0x68, 0x7a, 0x6c, 
+0x84, 0x70, 0x8f, 0x74, 0x99, 0x78, 0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x42, 0x15, 0x46, 0x20, 0x4a, 0x2a, 0x4e, 
+0x35, 0x52, 0x3f, 0x56, 0x49, 0x5a, 0x54, 0x5e, 0x5e, 0x62, 0x69, 0x65, 0x73, 0x69, 0x7e, 0x6d, 
+0x88, 0x71, 0x92, 0x75, 0x9d, 0x79, 0xa7, 0x7d, 0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x44, 0x19, 0x48, 0x24, 0x4c, 0x2e, 0x4f, 
+0x38, 0x53, 0x43, 0x57, 0x4d, 0x5b, 0x58, 0x5f, 0x62, 0x63, 0x6d, 0x67, 0x77, 0x6b, 0x82, 0x6f, 
+0x8c, 0x73, 0x96, 0x77, 0xa1, 0x7a, 0xab, 0x7e, 0xb6, 0x82, 0xc0, 0x86, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x41, 0x13, 0x45, 0x1d, 0x49, 0x27, 0x4d, 0x32, 0x51, 
+0x3c, 0x55, 0x47, 0x59, 0x51, 0x5d, 0x5c, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7b, 0x6c, 0x85, 0x70, 
+0x90, 0x74, 0x9a, 0x78, 0xa5, 0x7c, 0xaf, 0x80, 0xba, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x43, 0x17, 0x47, 0x21, 0x4b, 0x2b, 0x4e, 0x36, 0x52, 
+0x40, 0x56, 0x4b, 0x5a, 0x55, 0x5e, 0x60, 0x62, 0x6a, 0x66, 0x74, 0x6a, 0x7f, 0x6e, 0x89, 0x72, 
+0x94, 0x76, 0x9e, 0x7a, 0xa9, 0x7d, 0xb3, 0x81, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x44, 0x1a, 0x48, 0x25, 0x4c, 0x2f, 0x50, 0x3a, 0x54, 
+0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 0x6e, 0x67, 0x78, 0x6b, 0x83, 0x6f, 0x8d, 0x73, 
+0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x14, 0x46, 0x1e, 0x4a, 0x29, 0x4d, 0x33, 0x51, 0x3e, 0x55, 
+0x48, 0x59, 0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 0x72, 0x69, 0x7c, 0x6d, 0x87, 0x71, 0x91, 0x75, 
+0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0d, 0x43, 0x18, 0x47, 0x22, 0x4b, 0x2d, 0x4f, 0x37, 0x53, 0x42, 0x57, 
+0x4c, 0x5b, 0x56, 0x5f, 0x61, 0x63, 0x6b, 0x66, 0x76, 0x6a, 0x80, 0x6e, 0x8b, 0x72, 0x95, 0x76, 
+0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x07, 0x41, 0x11, 0x45, 0x1c, 0x49, 0x26, 0x4d, 0x31, 0x50, 0x3b, 0x54, 0x45, 0x58, 
+0x50, 0x5c, 0x5a, 0x60, 0x65, 0x64, 0x6f, 0x68, 0x7a, 0x6c, 0x84, 0x70, 0x8f, 0x74, 0x99, 0x78, 
+0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0b, 0x42, 0x15, 0x46, 0x20, 0x4a, 0x2a, 0x4e, 0x35, 0x52, 0x3f, 0x56, 0x49, 0x5a, 
+0x54, 0x5e, 0x5e, 0x62, 0x69, 0x65, 0x73, 0x69, 0x7e, 0x6d, 0x88, 0x71, 0x92, 0x75, 0x9d, 0x79, 
+0xa7, 0x7d, 0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0f, 0x44, 0x19, 0x48, 0x24, 0x4c, 0x2e, 0x4f, 0x38, 0x53, 0x43, 0x57, 0x4d, 0x5b, 
+0x58, 0x5f, 0x62, 0x63, 0x6d, 0x67, 0x77, 0x6b, 0x82, 0x6f, 0x8c, 0x73, 0x96, 0x77, 0xa1, 0x7a, 
+0xab, 0x7e, 0xb6, 0x82, 0xc0, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x08, 0x41, 0x13, 0x45, 0x1d, 0x49, 0x27, 0x4d, 0x32, 0x51, 0x3c, 0x55, 0x47, 0x59, 0x51, 0x5d, 
+0x5c, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7b, 0x6c, 0x85, 0x70, 0x90, 0x74, 0x9a, 0x78, 0xa5, 0x7c, 
+0xaf, 0x80, 0xba, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0c, 0x43, 0x17, 0x47, 0x21, 0x4b, 0x2b, 0x4e, 0x36, 0x52, 0x40, 0x56, 0x4b, 0x5a, 0x55, 0x5e, 
+0x60, 0x62, 0x6a, 0x66, 0x74, 0x6a, 0x7f, 0x6e, 0x89, 0x72, 0x94, 0x76, 0x9e, 0x7a, 0xa9, 0x7d, 
+0xb3, 0x81, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x10, 0x44, 0x1a, 0x48, 0x25, 0x4c, 0x2f, 0x50, 0x3a, 0x54, 0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 
+0x64, 0x64, 0x6e, 0x67, 0x78, 0x6b, 0x83, 0x6f, 0x8d, 0x73, 0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 
+0xb7, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 
+0x14, 0x46, 0x1e, 0x4a, 0x29, 0x4d, 0x33, 0x51, 0x3e, 0x55, 0x48, 0x59, 0x53, 0x5d, 0x5d, 0x61, 
+0x67, 0x65, 0x72, 0x69, 0x7c, 0x6d, 0x87, 0x71, 0x91, 0x75, 0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 
+0xbb, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x43, 
+0x18, 0x47, 0x22, 0x4b, 0x2d, 0x4f, 0x37, 0x53, 0x42, 0x57, 0x4c, 0x5b, 0x56, 0x5f, 0x61, 0x63, 
+0x6b, 0x66, 0x76, 0x6a, 0x80, 0x6e, 0x8b, 0x72, 0x95, 0x76, 0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 
+0xbf, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x41, 0x11, 0x45, 
+0x1c, 0x49, 0x26, 0x4d, 0x31, 0x50, 0x3b, 0x54, 0x45, 0x58, 0x50, 0x5c, 0x5a, 0x60, 0x65, 0x64, 
+0x6f, 0x68, 0x7a, 0x6c, 0x84, 0x70, 0x8f, 0x74, 0x99, 0x78, 0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x42, 0x15, 0x46, 
+0x20, 0x4a, 0x2a, 0x4e, 0x35, 0x52, 0x3f, 0x56, 0x49, 0x5a, 0x54, 0x5e, 0x5e, 0x62, 0x69, 0x65, 
+0x73, 0x69, 0x7e, 0x6d, 0x88, 0x71, 0x92, 0x75, 0x9d, 0x79, 0xa7, 0x7d, 0xb2, 0x81, 0xbc, 0x85, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x44, 0x19, 0x48, 
+0x24, 0x4c, 0x2e, 0x4f, 0x38, 0x53, 0x43, 0x57, 0x4d, 0x5b, 0x58, 0x5f, 0x62, 0x63, 0x6d, 0x67, 
+0x77, 0x6b, 0x82, 0x6f, 0x8c, 0x73, 0x96, 0x77, 0xa1, 0x7a, 0xab, 0x7e, 0xb6, 0x82, 0xc0, 0x86, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x41, 0x13, 0x45, 0x1d, 0x49, 
+0x27, 0x4d, 0x32, 0x51, 0x3c, 0x55, 0x47, 0x59, 0x51, 0x5d, 0x5c, 0x61, 0x66, 0x64, 0x71, 0x68, 
+0x7b, 0x6c, 0x85, 0x70, 0x90, 0x74, 0x9a, 0x78, 0xa5, 0x7c, 0xaf, 0x80, 0xba, 0x84, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x43, 0x17, 0x47, 0x21, 0x4b, 
+0x2b, 0x4e, 0x36, 0x52, 0x40, 0x56, 0x4b, 0x5a, 0x55, 0x5e, 0x60, 0x62, 0x6a, 0x66, 0x74, 0x6a, 
+0x7f, 0x6e, 0x89, 0x72, 0x94, 0x76, 0x9e, 0x7a, 0xa9, 0x7d, 0xb3, 0x81, 0xbe, 0x85, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x44, 0x1a, 0x48, 0x25, 0x4c, 
+0x2f, 0x50, 0x3a, 0x54, 0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 0x6e, 0x67, 0x78, 0x6b, 
+0x83, 0x6f, 0x8d, 0x73, 0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x14, 0x46, 0x1e, 0x4a, 0x29, 0x4d, 
+0x33, 0x51, 0x3e, 0x55, 0x48, 0x59, 0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 0x72, 0x69, 0x7c, 0x6d, 
+0x87, 0x71, 0x91, 0x75, 0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x43, 0x18, 0x47, 0x22, 0x4b, 0x2d, 0x4f, 
+0x37, 0x53, 0x42, 0x57, 0x4c, 0x5b, 0x56, 0x5f, 0x61, 0x63, 0x6b, 0x66, 0x76, 0x6a, 0x80, 0x6e, 
+0x8b, 0x72, 0x95, 0x76, 0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x41, 0x11, 0x45, 0x1c, 0x49, 0x26, 0x4d, 0x31, 0x50, 
+0x3b, 0x54, 0x45, 0x58, 0x50, 0x5c, 0x5a, 0x60, 0x65, 0x64, 0x6f, 0x68, 0x7a, 0x6c, 0x84, 0x70, 
+0x8f, 0x74, 0x99, 0x78, 0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x42, 0x15, 0x46, 0x20, 0x4a, 0x2a, 0x4e, 0x35, 0x52, 
+0x3f, 0x56, 0x49, 0x5a, 0x54, 0x5e, 0x5e, 0x62, 0x69, 0x65, 0x73, 0x69, 0x7e, 0x6d, 0x88, 0x71, 
+0x92, 0x75, 0x9d, 0x79, 0xa7, 0x7d, 0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x44, 0x19, 0x48, 0x24, 0x4c, 0x2e, 0x4f, 0x38, 0x53, 
+0x43, 0x57, 0x4d, 0x5b, 0x58, 0x5f, 0x62, 0x63, 0x6d, 0x67, 0x77, 0x6b, 0x82, 0x6f, 0x8c, 0x73, 
+0x96, 0x77, 0xa1, 0x7a, 0xab, 0x7e, 0xb6, 0x82, 0xc0, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x08, 0x41, 0x13, 0x45, 0x1d, 0x49, 0x27, 0x4d, 0x32, 0x51, 0x3c, 0x55, 
+0x47, 0x59, 0x51, 0x5d, 0x5c, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7b, 0x6c, 0x85, 0x70, 0x90, 0x74, 
+0x9a, 0x78, 0xa5, 0x7c, 0xaf, 0x80, 0xba, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0c, 0x43, 0x17, 0x47, 0x21, 0x4b, 0x2b, 0x4e, 0x36, 0x52, 0x40, 0x56, 
+0x4b, 0x5a, 0x55, 0x5e, 0x60, 0x62, 0x6a, 0x66, 0x74, 0x6a, 0x7f, 0x6e, 0x89, 0x72, 0x94, 0x76, 
+0x9e, 0x7a, 0xa9, 0x7d, 0xb3, 0x81, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x10, 0x44, 0x1a, 0x48, 0x25, 0x4c, 0x2f, 0x50, 0x3a, 0x54, 0x44, 0x58, 
+0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 0x6e, 0x67, 0x78, 0x6b, 0x83, 0x6f, 0x8d, 0x73, 0x98, 0x77, 
+0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x09, 0x42, 0x14, 0x46, 0x1e, 0x4a, 0x29, 0x4d, 0x33, 0x51, 0x3e, 0x55, 0x48, 0x59, 
+0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 0x72, 0x69, 0x7c, 0x6d, 0x87, 0x71, 0x91, 0x75, 0x9c, 0x79, 
+0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0d, 0x43, 0x18, 0x47, 0x22, 0x4b, 0x2d, 0x4f, 0x37, 0x53, 0x42, 0x57, 0x4c, 0x5b, 
+0x56, 0x5f, 0x61, 0x63, 0x6b, 0x66, 0x76, 0x6a, 0x80, 0x6e, 0x8b, 0x72, 0x95, 0x76, 0xa0, 0x7a, 
+0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x07, 0x41, 0x11, 0x45, 0x1c, 0x49, 0x26, 0x4d, 0x31, 0x50, 0x3b, 0x54, 0x45, 0x58, 0x50, 0x5c, 
+0x5a, 0x60, 0x65, 0x64, 0x6f, 0x68, 0x7a, 0x6c, 0x84, 0x70, 0x8f, 0x74, 0x99, 0x78, 0xa3, 0x7b, 
+0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0b, 0x42, 0x15, 0x46, 0x20, 0x4a, 0x2a, 0x4e, 0x35, 0x52, 0x3f, 0x56, 0x49, 0x5a, 0x54, 0x5e, 
+0x5e, 0x62, 0x69, 0x65, 0x73, 0x69, 0x7e, 0x6d, 0x88, 0x71, 0x92, 0x75, 0x9d, 0x79, 0xa7, 0x7d, 
+0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0f, 0x44, 0x19, 0x48, 0x24, 0x4c, 0x2e, 0x4f, 0x38, 0x53, 0x43, 0x57, 0x4d, 0x5b, 0x58, 0x5f, 
+0x62, 0x63, 0x6d, 0x67, 0x77, 0x6b, 0x82, 0x6f, 0x8c, 0x73, 0x96, 0x77, 0xa1, 0x7a, 0xab, 0x7e, 
+0xb6, 0x82, 0xc0, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x41, 
+0x13, 0x45, 0x1d, 0x49, 0x27, 0x4d, 0x32, 0x51, 0x3c, 0x55, 0x47, 0x59, 0x51, 0x5d, 0x5c, 0x61, 
+0x66, 0x64, 0x71, 0x68, 0x7b, 0x6c, 0x85, 0x70, 0x90, 0x74, 0x9a, 0x78, 0xa5, 0x7c, 0xaf, 0x80, 
+0xba, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x43, 
+0x17, 0x47, 0x21, 0x4b, 0x2b, 0x4e, 0x36, 0x52, 0x40, 0x56, 0x4b, 0x5a, 0x55, 0x5e, 0x60, 0x62, 
+0x6a, 0x66, 0x74, 0x6a, 0x7f, 0x6e, 0x89, 0x72, 0x94, 0x76, 0x9e, 0x7a, 0xa9, 0x7d, 0xb3, 0x81, 
+0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x44, 
+0x1a, 0x48, 0x25, 0x4c, 0x2f, 0x50, 0x3a, 0x54, 0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 
+0x6e, 0x67, 0x78, 0x6b, 0x83, 0x6f, 0x8d, 0x73, 0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x14, 0x46, 
+0x1e, 0x4a, 0x29, 0x4d, 0x33, 0x51, 0x3e, 0x55, 0x48, 0x59, 0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 
+0x72, 0x69, 0x7c, 0x6d, 0x87, 0x71, 0x91, 0x75, 0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x43, 0x18, 0x47, 
+0x22, 0x4b, 0x2d, 0x4f, 0x37, 0x53, 0x42, 0x57, 0x4c, 0x5b, 0x56, 0x5f, 0x61, 0x63, 0x6b, 0x66, 
+0x76, 0x6a, 0x80, 0x6e, 0x8b, 0x72, 0x95, 0x76, 0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x41, 0x11, 0x45, 0x1c, 0x49, 
+0x26, 0x4d, 0x31, 0x50, 0x3b, 0x54, 0x45, 0x58, 0x50, 0x5c, 0x5a, 0x60, 0x65, 0x64, 0x6f, 0x68, 
+0x7a, 0x6c, 0x84, 0x70, 0x8f, 0x74, 0x99, 0x78, 0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x42, 0x15, 0x46, 0x20, 0x4a, 
+0x2a, 0x4e, 0x35, 0x52, 0x3f, 0x56, 0x49, 0x5a, 0x54, 0x5e, 0x5e, 0x62, 0x69, 0x65, 0x73, 0x69, 
+0x7e, 0x6d, 0x88, 0x71, 0x92, 0x75, 0x9d, 0x79, 0xa7, 0x7d, 0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x44, 0x19, 0x48, 0x24, 0x4c, 
+0x2e, 0x4f, 0x38, 0x53, 0x43, 0x57, 0x4d, 0x5b, 0x58, 0x5f, 0x62, 0x63, 0x6d, 0x67, 0x77, 0x6b, 
+0x82, 0x6f, 0x8c, 0x73, 0x96, 0x77, 0xa1, 0x7a, 0xab, 0x7e, 0xb6, 0x82, 0xc0, 0x86, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x41, 0x13, 0x45, 0x1d, 0x49, 0x27, 0x4d, 
+0x32, 0x51, 0x3c, 0x55, 0x47, 0x59, 0x51, 0x5d, 0x5c, 0x61, 0x66, 0x64, 0x71, 0x68, 0x7b, 0x6c, 
+0x85, 0x70, 0x90, 0x74, 0x9a, 0x78, 0xa5, 0x7c, 0xaf, 0x80, 0xba, 0x84, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x45, 0x17, 0x47, 0x21, 0x4b, 0x2b, 0x4e, 
+0x36, 0x52, 0x40, 0x56, 0x4b, 0x5a, 0x55, 0x5e, 0x60, 0x62, 0x6a, 0x66, 0x74, 0x6a, 0x7f, 0x6e, 
+0x89, 0x72, 0x94, 0x76, 0x9e, 0x7a, 0xa9, 0x7d, 0xb3, 0x81, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x50, 0x17, 0x50, 0x23, 0x50, 0x2f, 0x50, 
+0x3a, 0x54, 0x44, 0x58, 0x4f, 0x5c, 0x59, 0x60, 0x64, 0x64, 0x6e, 0x67, 0x78, 0x6b, 0x83, 0x6f, 
+0x8d, 0x73, 0x98, 0x77, 0xa2, 0x7b, 0xad, 0x7f, 0xb7, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5c, 0x17, 0x5c, 0x23, 0x5c, 0x2f, 0x5c, 
+0x3b, 0x5c, 0x47, 0x5c, 0x53, 0x5d, 0x5d, 0x61, 0x67, 0x65, 0x72, 0x69, 0x7c, 0x6d, 0x87, 0x71, 
+0x91, 0x75, 0x9c, 0x79, 0xa6, 0x7c, 0xb0, 0x80, 0xbb, 0x84, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x68, 0x17, 0x68, 0x23, 0x68, 0x2f, 0x68, 
+0x3b, 0x68, 0x47, 0x68, 0x53, 0x68, 0x5f, 0x68, 0x6b, 0x68, 0x76, 0x6a, 0x80, 0x6e, 0x8b, 0x72, 
+0x95, 0x76, 0xa0, 0x7a, 0xaa, 0x7e, 0xb4, 0x82, 0xbf, 0x86, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x74, 0x17, 0x74, 0x23, 0x74, 0x2f, 0x74, 
+0x3b, 0x74, 0x47, 0x74, 0x53, 0x74, 0x5f, 0x74, 0x6b, 0x74, 0x77, 0x74, 0x82, 0x74, 0x8e, 0x74, 
+0x99, 0x78, 0xa3, 0x7b, 0xae, 0x7f, 0xb8, 0x83, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x80, 0x17, 0x80, 0x23, 0x80, 0x2f, 0x80, 
+0x3b, 0x80, 0x47, 0x80, 0x53, 0x80, 0x5f, 0x80, 0x6b, 0x80, 0x77, 0x80, 0x82, 0x80, 0x8e, 0x80, 
+0x9a, 0x80, 0xa6, 0x80, 0xb2, 0x81, 0xbc, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x8c, 0x17, 0x8c, 0x23, 0x8c, 0x2f, 0x8c, 
+0x3b, 0x8c, 0x47, 0x8c, 0x53, 0x8c, 0x5f, 0x8c, 0x6b, 0x8c, 0x77, 0x8c, 0x82, 0x8c, 0x8e, 0x8c, 
+0x9a, 0x8c, 0xa6, 0x8c, 0xb2, 0x8c, 0xbe, 0x8c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x98, 0x23, 0x98, 0x2f, 0x98, 
+0x3b, 0x98, 0x47, 0x98, 0x53, 0x98, 0x5f, 0x98, 0x6b, 0x98, 0x77, 0x98, 0x82, 0x98, 0x8e, 0x98, 
+0x9a, 0x98, 0xa6, 0x98, 0xb2, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xa4, 0x23, 0xa4, 0x2f, 0xa4, 
+0x3b, 0xa4, 0x47, 0xa4, 0x53, 0xa4, 0x5f, 0xa4, 0x6b, 0xa4, 0x77, 0xa4, 0x82, 0xa4, 0x8e, 0xa4, 
+0x9a, 0xa4, 0xa6, 0xa4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xb0, 0x2f, 0xb0, 
+0x3b, 0xb0, 0x47, 0xb0, 0x53, 0xb0, 0x5f, 0xb0, 0x6b, 0xb0, 0x77, 0xb0, 0x82, 0xb0, 0x8e, 0xb0, 
+0x9a, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0xbc, 0x47, 0xbc, 0x53, 0xbc, 0x5f, 0xbc, 0x6b, 0xbc, 0x77, 0xbc, 0x82, 0xbc, 0x8e, 0xbc, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x46, 0x05, 0x4c, 0x05, 0x52, 0x05, 0x58, 0x05, 0x5e, 0x05, 
+0x64, 0x05, 0x69, 0x05, 0x6f, 0x05, 0x75, 0x05, 0x7b, 0x05, 0x81, 0x05, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x00, 0xfe, 0x3a, 0x0b, 0x40, 0x0b, 0x46, 0x0b, 0x4c, 0x0b, 0x52, 0x0b, 0x58, 0x0b, 0x5e, 0x0b, 
+0x64, 0x0b, 0x69, 0x0b, 0x6f, 0x0b, 0x75, 0x0b, 0x7b, 0x0b, 0x81, 0x0b, 0x87, 0x0b, 0x8d, 0x0b, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2e, 0x11, 
+0x34, 0x11, 0x3a, 0x11, 0x40, 0x11, 0x46, 0x11, 0x4c, 0x11, 0x52, 0x11, 0x58, 0x11, 0x5e, 0x11, 
+0x64, 0x11, 0x69, 0x11, 0x6f, 0x11, 0x75, 0x11, 0x7b, 0x11, 0x81, 0x11, 0x87, 0x11, 0x8d, 0x11, 
+0x93, 0x11, 0x99, 0x11, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x28, 0x17, 0x2e, 0x17, 
+0x34, 0x17, 0x3a, 0x17, 0x40, 0x17, 0x46, 0x17, 0x4c, 0x17, 0x52, 0x17, 0x58, 0x17, 0x5e, 0x17, 
+0x64, 0x17, 0x69, 0x17, 0x6f, 0x17, 0x75, 0x17, 0x7b, 0x17, 0x81, 0x17, 0x87, 0x17, 0x8d, 0x17, 
+0x93, 0x17, 0x99, 0x17, 0x9f, 0x17, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x22, 0x1d, 0x28, 0x1d, 0x2e, 0x1d, 
+0x34, 0x1d, 0x3a, 0x1d, 0x40, 0x1d, 0x46, 0x1d, 0x4c, 0x1d, 0x52, 0x1d, 0x58, 0x1d, 0x5e, 0x1d, 
+0x64, 0x1d, 0x69, 0x1d, 0x6f, 0x1d, 0x75, 0x1d, 0x7b, 0x1d, 0x81, 0x1d, 0x87, 0x1d, 0x8d, 0x1d, 
+0x93, 0x1d, 0x99, 0x1d, 0x9f, 0x1d, 0xa5, 0x1d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x1c, 0x23, 0x22, 0x23, 0x28, 0x23, 0x2e, 0x23, 
+0x34, 0x23, 0x3a, 0x23, 0x40, 0x23, 0x46, 0x23, 0x4c, 0x23, 0x52, 0x23, 0x58, 0x23, 0x5e, 0x23, 
+0x64, 0x23, 0x69, 0x23, 0x6f, 0x23, 0x75, 0x23, 0x7b, 0x23, 0x81, 0x23, 0x87, 0x23, 0x8d, 0x23, 
+0x93, 0x23, 0x99, 0x23, 0x9f, 0x23, 0xa5, 0x23, 0xab, 0x23, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x16, 0x29, 0x1c, 0x29, 0x22, 0x29, 0x28, 0x29, 0x2e, 0x29, 
+0x34, 0x29, 0x3a, 0x29, 0x40, 0x29, 0x46, 0x29, 0x4c, 0x29, 0x52, 0x29, 0x58, 0x29, 0x5e, 0x29, 
+0x64, 0x29, 0x69, 0x29, 0x6f, 0x29, 0x75, 0x29, 0x7b, 0x29, 0x81, 0x29, 0x87, 0x29, 0x8d, 0x29, 
+0x93, 0x29, 0x99, 0x29, 0x9f, 0x29, 0xa5, 0x29, 0xab, 0x29, 0xb1, 0x29, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x10, 0x2f, 0x16, 0x2f, 0x1c, 0x2f, 0x22, 0x2f, 0x28, 0x2f, 0x2e, 0x2f, 
+0x34, 0x2f, 0x3a, 0x2f, 0x40, 0x2f, 0x46, 0x2f, 0x4c, 0x2f, 0x52, 0x2f, 0x58, 0x2f, 0x5e, 0x2f, 
+0x64, 0x2f, 0x69, 0x2f, 0x6f, 0x2f, 0x75, 0x2f, 0x7b, 0x2f, 0x81, 0x2f, 0x87, 0x2f, 0x8d, 0x2f, 
+0x93, 0x2f, 0x99, 0x2f, 0x9f, 0x2f, 0xa5, 0x2f, 0xab, 0x2f, 0xb1, 0x2f, 0xb7, 0x2f, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x10, 0x35, 0x16, 0x35, 0x1c, 0x35, 0x22, 0x35, 0x28, 0x35, 0x2e, 0x35, 
+0x34, 0x35, 0x3a, 0x35, 0x40, 0x35, 0x46, 0x35, 0x4c, 0x35, 0x52, 0x35, 0x58, 0x35, 0x5e, 0x35, 
+0x64, 0x35, 0x69, 0x35, 0x6f, 0x35, 0x75, 0x35, 0x7b, 0x35, 0x81, 0x35, 0x87, 0x35, 0x8d, 0x35, 
+0x93, 0x35, 0x99, 0x35, 0x9f, 0x35, 0xa5, 0x35, 0xab, 0x35, 0xb1, 0x35, 0xb7, 0x35, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0a, 0x3b, 0x10, 0x3b, 0x16, 0x3b, 0x1c, 0x3b, 0x22, 0x3b, 0x28, 0x3b, 0x2e, 0x3b, 
+0x34, 0x3b, 0x3a, 0x3b, 0x40, 0x3b, 0x46, 0x3b, 0x4c, 0x3b, 0x52, 0x3b, 0x58, 0x3b, 0x5e, 0x3b, 
+0x64, 0x3b, 0x69, 0x3b, 0x6f, 0x3b, 0x75, 0x3b, 0x7b, 0x3b, 0x81, 0x3b, 0x87, 0x3b, 0x8d, 0x3b, 
+0x93, 0x3b, 0x99, 0x3b, 0x9f, 0x3b, 0xa5, 0x3b, 0xab, 0x3b, 0xb1, 0x3b, 0xb7, 0x3b, 0xbd, 0x3b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0a, 0x41, 0x10, 0x41, 0x16, 0x41, 0x1c, 0x41, 0x22, 0x41, 0x28, 0x41, 0x2e, 0x41, 
+0x34, 0x41, 0x3a, 0x41, 0x40, 0x41, 0x46, 0x41, 0x4c, 0x41, 0x52, 0x41, 0x58, 0x41, 0x5e, 0x41, 
+0x64, 0x41, 0x69, 0x41, 0x6f, 0x41, 0x75, 0x41, 0x7b, 0x41, 0x81, 0x41, 0x87, 0x41, 0x8d, 0x41, 
+0x93, 0x41, 0x99, 0x41, 0x9f, 0x41, 0xa5, 0x41, 0xab, 0x41, 0xb1, 0x41, 0xb7, 0x41, 0xbd, 0x41, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x04, 0x47, 0x0a, 0x47, 0x10, 0x47, 0x16, 0x47, 0x1c, 0x47, 0x22, 0x47, 0x28, 0x47, 0x2e, 0x47, 
+0x34, 0x47, 0x3a, 0x47, 0x40, 0x47, 0x46, 0x47, 0x4c, 0x47, 0x52, 0x47, 0x58, 0x47, 0x5e, 0x47, 
+0x64, 0x47, 0x69, 0x47, 0x6f, 0x47, 0x75, 0x47, 0x7b, 0x47, 0x81, 0x47, 0x87, 0x47, 0x8d, 0x47, 
+0x93, 0x47, 0x99, 0x47, 0x9f, 0x47, 0xa5, 0x47, 0xab, 0x47, 0xb1, 0x47, 0xb7, 0x47, 0xbd, 0x47, 
+0xc3, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x4d, 0x0a, 0x4d, 0x10, 0x4d, 0x16, 0x4d, 0x1c, 0x4d, 0x22, 0x4d, 0x28, 0x4d, 0x2e, 0x4d, 
+0x34, 0x4d, 0x3a, 0x4d, 0x40, 0x4d, 0x46, 0x4d, 0x4c, 0x4d, 0x52, 0x4d, 0x58, 0x4d, 0x5e, 0x4d, 
+0x64, 0x4d, 0x69, 0x4d, 0x6f, 0x4d, 0x75, 0x4d, 0x7b, 0x4d, 0x81, 0x4d, 0x87, 0x4d, 0x8d, 0x4d, 
+0x93, 0x4d, 0x99, 0x4d, 0x9f, 0x4d, 0xa5, 0x4d, 0xab, 0x4d, 0xb1, 0x4d, 0xb7, 0x4d, 0xbd, 0x4d, 
+0xc3, 0x4d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x53, 0x0a, 0x53, 0x10, 0x53, 0x16, 0x53, 0x1c, 0x53, 0x22, 0x53, 0x28, 0x53, 0x2e, 0x53, 
+0x34, 0x53, 0x3a, 0x53, 0x40, 0x53, 0x46, 0x53, 0x4c, 0x53, 0x52, 0x53, 0x58, 0x53, 0x5e, 0x53, 
+0x64, 0x53, 0x69, 0x53, 0x6f, 0x53, 0x75, 0x53, 0x7b, 0x53, 0x81, 0x53, 0x87, 0x53, 0x8d, 0x53, 
+0x93, 0x53, 0x99, 0x53, 0x9f, 0x53, 0xa5, 0x53, 0xab, 0x53, 0xb1, 0x53, 0xb7, 0x53, 0xbd, 0x53, 
+0xc3, 0x53, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x59, 0x0a, 0x59, 0x10, 0x59, 0x16, 0x59, 0x1c, 0x59, 0x22, 0x59, 0x28, 0x59, 0x2e, 0x59, 
+0x34, 0x59, 0x3a, 0x59, 0x40, 0x59, 0x46, 0x59, 0x4c, 0x59, 0x52, 0x59, 0x58, 0x59, 0x5e, 0x59, 
+0x64, 0x59, 0x69, 0x59, 0x6f, 0x59, 0x75, 0x59, 0x7b, 0x59, 0x81, 0x59, 0x87, 0x59, 0x8d, 0x59, 
+0x93, 0x59, 0x99, 0x59, 0x9f, 0x59, 0xa5, 0x59, 0xab, 0x59, 0xb1, 0x59, 0xb7, 0x59, 0xbd, 0x59, 
+0xc3, 0x59, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x5f, 0x0a, 0x5f, 0x10, 0x5f, 0x16, 0x5f, 0x1c, 0x5f, 0x22, 0x5f, 0x28, 0x5f, 0x2e, 0x5f, 
+0x34, 0x5f, 0x3a, 0x5f, 0x40, 0x5f, 0x46, 0x5f, 0x4c, 0x5f, 0x52, 0x5f, 0x58, 0x5f, 0x5e, 0x5f, 
+0x64, 0x5f, 0x69, 0x5f, 0x6f, 0x5f, 0x75, 0x5f, 0x7b, 0x5f, 0x81, 0x5f, 0x87, 0x5f, 0x8d, 0x5f, 
+0x93, 0x5f, 0x99, 0x5f, 0x9f, 0x5f, 0xa5, 0x5f, 0xab, 0x5f, 0xb1, 0x5f, 0xb7, 0x5f, 0xbd, 0x5f, 
+0xc3, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x65, 0x0a, 0x65, 0x10, 0x65, 0x16, 0x65, 0x1c, 0x65, 0x22, 0x65, 0x28, 0x65, 0x2e, 0x65, 
+0x34, 0x65, 0x3a, 0x65, 0x40, 0x65, 0x46, 0x65, 0x4c, 0x65, 0x52, 0x65, 0x58, 0x65, 0x5e, 0x65, 
+0x64, 0x65, 0x69, 0x65, 0x6f, 0x65, 0x75, 0x65, 0x7b, 0x65, 0x81, 0x65, 0x87, 0x65, 0x8d, 0x65, 
+0x93, 0x65, 0x99, 0x65, 0x9f, 0x65, 0xa5, 0x65, 0xab, 0x65, 0xb1, 0x65, 0xb7, 0x65, 0xbd, 0x65, 
+0xc3, 0x65, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x6b, 0x0a, 0x6b, 0x10, 0x6b, 0x16, 0x6b, 0x1c, 0x6b, 0x22, 0x6b, 0x28, 0x6b, 0x2e, 0x6b, 
+0x34, 0x6b, 0x3a, 0x6b, 0x40, 0x6b, 0x46, 0x6b, 0x4c, 0x6b, 0x52, 0x6b, 0x58, 0x6b, 0x5e, 0x6b, 
+0x64, 0x6b, 0x69, 0x6b, 0x6f, 0x6b, 0x75, 0x6b, 0x7b, 0x6b, 0x81, 0x6b, 0x87, 0x6b, 0x8d, 0x6b, 
+0x93, 0x6b, 0x99, 0x6b, 0x9f, 0x6b, 0xa5, 0x6b, 0xab, 0x6b, 0xb1, 0x6b, 0xb7, 0x6b, 0xbd, 0x6b, 
+0xc3, 0x6b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x71, 0x0a, 0x71, 0x10, 0x71, 0x16, 0x71, 0x1c, 0x71, 0x22, 0x71, 0x28, 0x71, 0x2e, 0x71, 
+0x34, 0x71, 0x3a, 0x71, 0x40, 0x71, 0x46, 0x71, 0x4c, 0x71, 0x52, 0x71, 0x58, 0x71, 0x5e, 0x71, 
+0x64, 0x71, 0x69, 0x71, 0x6f, 0x71, 0x75, 0x71, 0x7b, 0x71, 0x81, 0x71, 0x87, 0x71, 0x8d, 0x71, 
+0x93, 0x71, 0x99, 0x71, 0x9f, 0x71, 0xa5, 0x71, 0xab, 0x71, 0xb1, 0x71, 0xb7, 0x71, 0xbd, 0x71, 
+0xc3, 0x71, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x04, 0x77, 0x0a, 0x77, 0x10, 0x77, 0x16, 0x77, 0x1c, 0x77, 0x22, 0x77, 0x28, 0x77, 0x2e, 0x77, 
+0x34, 0x77, 0x3a, 0x77, 0x40, 0x77, 0x46, 0x77, 0x4c, 0x77, 0x52, 0x77, 0x58, 0x77, 0x5e, 0x77, 
+0x64, 0x77, 0x69, 0x77, 0x6f, 0x77, 0x75, 0x77, 0x7b, 0x77, 0x81, 0x77, 0x87, 0x77, 0x8d, 0x77, 
+0x93, 0x77, 0x99, 0x77, 0x9f, 0x77, 0xa5, 0x77, 0xab, 0x77, 0xb1, 0x77, 0xb7, 0x77, 0xbd, 0x77, 
+0xc3, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x04, 0x7c, 0x0a, 0x7c, 0x10, 0x7c, 0x16, 0x7c, 0x1c, 0x7c, 0x22, 0x7c, 0x28, 0x7c, 0x2e, 0x7c, 
+0x34, 0x7c, 0x3a, 0x7c, 0x40, 0x7c, 0x45, 0x77, 0x4b, 0x77, 0x51, 0x77, 0x57, 0x77, 0x5d, 0x77, 
+0x64, 0x77, 0x6a, 0x77, 0x70, 0x77, 0x76, 0x77, 0x7c, 0x77, 0x82, 0x77, 0x87, 0x7c, 0x8d, 0x7c, 
+0x93, 0x7c, 0x99, 0x7c, 0x9f, 0x7c, 0xa5, 0x7c, 0xab, 0x7c, 0xb1, 0x7c, 0xb7, 0x7c, 0xbd, 0x7c, 
+0xc3, 0x7c, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0a, 0x82, 0x10, 0x82, 0x16, 0x82, 0x1c, 0x82, 0x22, 0x82, 0x28, 0x82, 0x2c, 0x75, 
+0x32, 0x75, 0x39, 0x75, 0x3f, 0x74, 0x45, 0x74, 0x4b, 0x74, 0x51, 0x74, 0x57, 0x74, 0x5d, 0x74, 
+0x64, 0x74, 0x6a, 0x74, 0x70, 0x74, 0x76, 0x74, 0x7c, 0x74, 0x82, 0x74, 0x88, 0x74, 0x8e, 0x75, 
+0x95, 0x75, 0x9b, 0x75, 0x9f, 0x82, 0xa5, 0x82, 0xab, 0x82, 0xb1, 0x82, 0xb7, 0x82, 0xbd, 0x82, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0a, 0x88, 0x10, 0x88, 0x16, 0x88, 0x17, 0x72, 0x1e, 0x72, 0x24, 0x72, 0x2b, 0x72, 
+0x32, 0x72, 0x38, 0x71, 0x3f, 0x71, 0x45, 0x71, 0x4b, 0x71, 0x51, 0x71, 0x58, 0x71, 0x5e, 0x71, 
+0x64, 0x71, 0x69, 0x71, 0x6f, 0x71, 0x76, 0x71, 0x7c, 0x71, 0x82, 0x71, 0x88, 0x71, 0x8f, 0x71, 
+0x95, 0x72, 0x9c, 0x72, 0xa3, 0x72, 0xa9, 0x72, 0xb0, 0x72, 0xb1, 0x88, 0xb7, 0x88, 0xbd, 0x88, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x0a, 0x8e, 0x08, 0x6f, 0x0f, 0x6f, 0x15, 0x6f, 0x1d, 0x6f, 0x24, 0x6f, 0x2b, 0x6f, 
+0x32, 0x6e, 0x38, 0x6e, 0x3f, 0x6e, 0x45, 0x6e, 0x4c, 0x6e, 0x52, 0x6e, 0x58, 0x6e, 0x5e, 0x6e, 
+0x64, 0x6e, 0x69, 0x6e, 0x6f, 0x6e, 0x75, 0x6e, 0x7b, 0x6e, 0x82, 0x6e, 0x88, 0x6e, 0x8f, 0x6e, 
+0x95, 0x6e, 0x9c, 0x6f, 0xa3, 0x6f, 0xaa, 0x6f, 0xb2, 0x6f, 0xb8, 0x6f, 0xbf, 0x6f, 0xbd, 0x8e, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x05, 0x6c, 0x0c, 0x6c, 0x14, 0x6c, 0x1b, 0x6c, 0x23, 0x6b, 0x2b, 0x6b, 
+0x32, 0x6b, 0x39, 0x6b, 0x40, 0x6b, 0x46, 0x6b, 0x4c, 0x6b, 0x52, 0x6b, 0x58, 0x6b, 0x5e, 0x6b, 
+0x64, 0x6b, 0x69, 0x6b, 0x6f, 0x6b, 0x75, 0x6b, 0x7b, 0x6b, 0x81, 0x6b, 0x87, 0x6b, 0x8e, 0x6b, 
+0x95, 0x6b, 0x9c, 0x6b, 0xa4, 0x6b, 0xac, 0x6c, 0xb3, 0x6c, 0xbb, 0x6c, 0xc2, 0x6c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x00, 0x69, 0x09, 0x69, 0x12, 0x68, 0x1b, 0x68, 0x23, 0x68, 0x2b, 0x68, 
+0x32, 0x68, 0x3a, 0x68, 0x40, 0x68, 0x47, 0x68, 0x4d, 0x68, 0x53, 0x68, 0x58, 0x68, 0x5e, 0x67, 
+0x64, 0x67, 0x69, 0x67, 0x6f, 0x68, 0x74, 0x68, 0x7a, 0x68, 0x80, 0x68, 0x87, 0x68, 0x8d, 0x68, 
+0x95, 0x68, 0x9c, 0x68, 0xa4, 0x68, 0xac, 0x68, 0xb5, 0x68, 0xbe, 0x69, 0xc7, 0x69, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0x65, 0x05, 0x65, 0x10, 0x65, 0x19, 0x65, 0x23, 0x65, 0x2b, 0x65, 
+0x33, 0x65, 0x3a, 0x65, 0x41, 0x65, 0x47, 0x65, 0x4e, 0x65, 0x53, 0x65, 0x59, 0x65, 0x5e, 0x65, 
+0x64, 0x65, 0x69, 0x65, 0x6e, 0x65, 0x74, 0x65, 0x79, 0x65, 0x80, 0x65, 0x86, 0x65, 0x8d, 0x65, 
+0x94, 0x65, 0x9c, 0x65, 0xa4, 0x65, 0xae, 0x65, 0xb7, 0x65, 0xc2, 0x65, 0xc7, 0x65, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0x61, 0x01, 0x61, 0x0c, 0x61, 0x18, 0x61, 0x22, 0x62, 0x2b, 0x62, 
+0x33, 0x62, 0x3b, 0x62, 0x42, 0x62, 0x48, 0x62, 0x4e, 0x62, 0x54, 0x62, 0x59, 0x62, 0x5e, 0x62, 
+0x64, 0x62, 0x69, 0x62, 0x6e, 0x62, 0x73, 0x62, 0x79, 0x62, 0x7f, 0x62, 0x85, 0x62, 0x8c, 0x62, 
+0x94, 0x62, 0x9c, 0x62, 0xa5, 0x62, 0xaf, 0x61, 0xbb, 0x61, 0xc6, 0x61, 0xc7, 0x61, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0x5e, 0x01, 0x5d, 0x04, 0x5d, 0x13, 0x5e, 0x20, 0x5e, 0x2b, 0x5e, 
+0x34, 0x5f, 0x3b, 0x5f, 0x42, 0x5f, 0x49, 0x5f, 0x4f, 0x5f, 0x54, 0x5f, 0x59, 0x5f, 0x5e, 0x5f, 
+0x64, 0x5f, 0x69, 0x5f, 0x6e, 0x5f, 0x73, 0x5f, 0x78, 0x5f, 0x7e, 0x5f, 0x85, 0x5f, 0x8c, 0x5f, 
+0x93, 0x5f, 0x9c, 0x5e, 0xa7, 0x5e, 0xb4, 0x5e, 0xc3, 0x5d, 0xc6, 0x5d, 0xc7, 0x5e, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0x5a, 0x01, 0x59, 0x04, 0x59, 0x0a, 0x59, 0x1b, 0x5a, 0x29, 0x5b, 
+0x33, 0x5b, 0x3b, 0x5c, 0x42, 0x5c, 0x49, 0x5c, 0x51, 0x5d, 0x57, 0x5e, 0x5b, 0x5e, 0x5f, 0x5e, 
+0x64, 0x5e, 0x68, 0x5e, 0x6c, 0x5e, 0x70, 0x5e, 0x76, 0x5d, 0x7e, 0x5c, 0x85, 0x5c, 0x8c, 0x5c, 
+0x94, 0x5b, 0x9e, 0x5b, 0xac, 0x5a, 0xbd, 0x59, 0xc3, 0x59, 0xc6, 0x59, 0xc7, 0x5a, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0x56, 0x02, 0x56, 0x05, 0x55, 0x0b, 0x55, 0x12, 0x55, 0x1b, 0x55, 
+0x32, 0x58, 0x40, 0x5a, 0x48, 0x5b, 0x4e, 0x5c, 0x53, 0x5c, 0x58, 0x5c, 0x5c, 0x5c, 0x60, 0x5c, 
+0x64, 0x5c, 0x67, 0x5c, 0x6b, 0x5c, 0x6f, 0x5c, 0x74, 0x5c, 0x79, 0x5c, 0x7f, 0x5b, 0x87, 0x5a, 
+0x95, 0x58, 0xac, 0x55, 0xb5, 0x55, 0xbc, 0x55, 0xc2, 0x55, 0xc5, 0x56, 0xc7, 0x56, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x01, 0x53, 0x02, 0x52, 0x06, 0x51, 0x0b, 0x51, 0x18, 0x52, 0x29, 0x54, 
+0x34, 0x56, 0x3f, 0x57, 0x48, 0x59, 0x4e, 0x5a, 0x53, 0x5a, 0x58, 0x5a, 0x5c, 0x5a, 0x60, 0x5b, 
+0x64, 0x5b, 0x67, 0x5b, 0x6b, 0x5a, 0x6f, 0x5a, 0x74, 0x5a, 0x79, 0x5a, 0x7f, 0x59, 0x88, 0x57, 
+0x93, 0x56, 0x9e, 0x54, 0xaf, 0x52, 0xbc, 0x51, 0xc1, 0x51, 0xc5, 0x52, 0xc6, 0x53, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x02, 0x4f, 0x03, 0x4e, 0x07, 0x4d, 0x18, 0x50, 0x24, 0x51, 0x2e, 0x53, 
+0x37, 0x53, 0x3e, 0x54, 0x45, 0x55, 0x4b, 0x55, 0x52, 0x57, 0x57, 0x58, 0x5b, 0x58, 0x60, 0x58, 
+0x64, 0x58, 0x67, 0x58, 0x6c, 0x58, 0x70, 0x58, 0x75, 0x57, 0x7c, 0x55, 0x82, 0x55, 0x89, 0x54, 
+0x90, 0x53, 0x99, 0x53, 0xa3, 0x51, 0xaf, 0x50, 0xc0, 0x4d, 0xc4, 0x4e, 0xc5, 0x4f, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x03, 0x4c, 0x07, 0x4b, 0x14, 0x4d, 0x1e, 0x4e, 0x28, 0x4f, 0x30, 0x50, 
+0x38, 0x51, 0x3f, 0x52, 0x45, 0x52, 0x4b, 0x53, 0x50, 0x53, 0x55, 0x54, 0x5a, 0x54, 0x5f, 0x54, 
+0x64, 0x54, 0x68, 0x54, 0x6d, 0x54, 0x72, 0x54, 0x77, 0x53, 0x7c, 0x53, 0x82, 0x52, 0x88, 0x52, 
+0x8f, 0x51, 0x97, 0x50, 0x9f, 0x4f, 0xa9, 0x4e, 0xb3, 0x4d, 0xc0, 0x4b, 0xc4, 0x4c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x03, 0x4a, 0x07, 0x4a, 0x10, 0x4a, 0x19, 0x4b, 0x22, 0x4c, 0x2a, 0x4d, 0x31, 0x4e, 
+0x39, 0x4f, 0x3f, 0x4f, 0x45, 0x50, 0x4b, 0x50, 0x50, 0x51, 0x55, 0x51, 0x5a, 0x51, 0x5f, 0x51, 
+0x64, 0x51, 0x68, 0x51, 0x6d, 0x51, 0x72, 0x51, 0x77, 0x51, 0x7c, 0x50, 0x82, 0x50, 0x88, 0x4f, 
+0x8e, 0x4f, 0x96, 0x4e, 0x9d, 0x4d, 0xa5, 0x4c, 0xae, 0x4b, 0xb7, 0x4a, 0xc0, 0x4a, 0xc4, 0x4a, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x06, 0x48, 0x0d, 0x48, 0x14, 0x49, 0x1c, 0x49, 0x24, 0x4a, 0x2b, 0x4b, 0x32, 0x4b, 
+0x39, 0x4c, 0x3f, 0x4d, 0x45, 0x4d, 0x4b, 0x4e, 0x50, 0x4e, 0x55, 0x4e, 0x5a, 0x4f, 0x5f, 0x4f, 
+0x64, 0x4f, 0x68, 0x4f, 0x6d, 0x4f, 0x72, 0x4e, 0x77, 0x4e, 0x7c, 0x4e, 0x82, 0x4d, 0x88, 0x4d, 
+0x8e, 0x4c, 0x95, 0x4b, 0x9c, 0x4b, 0xa3, 0x4a, 0xab, 0x49, 0xb3, 0x49, 0xba, 0x48, 0xc1, 0x48, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x05, 0x46, 0x0b, 0x46, 0x11, 0x47, 0x18, 0x47, 0x1f, 0x47, 0x26, 0x48, 0x2c, 0x48, 0x33, 0x49, 
+0x39, 0x49, 0x3f, 0x4a, 0x45, 0x4a, 0x4b, 0x4b, 0x50, 0x4b, 0x55, 0x4c, 0x5a, 0x4c, 0x5f, 0x4c, 
+0x64, 0x4c, 0x68, 0x4c, 0x6d, 0x4c, 0x72, 0x4c, 0x77, 0x4b, 0x7c, 0x4b, 0x82, 0x4a, 0x88, 0x4a, 
+0x8e, 0x49, 0x94, 0x49, 0x9b, 0x48, 0xa1, 0x48, 0xa8, 0x47, 0xaf, 0x47, 0xb6, 0x47, 0xbc, 0x46, 
+0xc2, 0x46, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0x28, 0x1c, 0x28, 0x15, 0x45, 0x1b, 0x45, 0x21, 0x45, 0x27, 0x46, 0x2d, 0x46, 0x33, 0x46, 
+0x39, 0x47, 0x3f, 0x47, 0x45, 0x48, 0x4a, 0x48, 0x50, 0x49, 0x55, 0x49, 0x5a, 0x49, 0x5f, 0x49, 
+0x64, 0x49, 0x68, 0x49, 0x6d, 0x49, 0x72, 0x49, 0x77, 0x49, 0x7d, 0x48, 0x82, 0x48, 0x88, 0x47, 
+0x8e, 0x47, 0x94, 0x46, 0x9a, 0x46, 0xa0, 0x46, 0xa6, 0x45, 0xac, 0x45, 0xb2, 0x45, 0xab, 0x28, 
+0xb0, 0x28, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2d, 
+0x17, 0x2d, 0x1c, 0x2d, 0x21, 0x2d, 0x1e, 0x44, 0x23, 0x44, 0x29, 0x44, 0x2f, 0x44, 0x34, 0x44, 
+0x3a, 0x45, 0x40, 0x45, 0x45, 0x45, 0x4a, 0x46, 0x50, 0x46, 0x55, 0x46, 0x5a, 0x46, 0x5f, 0x46, 
+0x64, 0x46, 0x68, 0x46, 0x6d, 0x46, 0x72, 0x46, 0x77, 0x46, 0x7d, 0x46, 0x82, 0x45, 0x87, 0x45, 
+0x8d, 0x45, 0x93, 0x44, 0x98, 0x44, 0x9e, 0x44, 0xa4, 0x44, 0xa9, 0x44, 0xa6, 0x2d, 0xab, 0x2d, 
+0xb0, 0x2d, 0xb4, 0x2d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x32, 0x13, 0x32, 
+0x17, 0x32, 0x1c, 0x32, 0x21, 0x32, 0x26, 0x32, 0x2a, 0x32, 0x2b, 0x42, 0x30, 0x42, 0x35, 0x42, 
+0x3b, 0x42, 0x40, 0x43, 0x45, 0x43, 0x4a, 0x43, 0x50, 0x43, 0x55, 0x43, 0x5a, 0x44, 0x5f, 0x44, 
+0x64, 0x44, 0x68, 0x44, 0x6d, 0x44, 0x72, 0x43, 0x77, 0x43, 0x7d, 0x43, 0x82, 0x43, 0x87, 0x43, 
+0x8c, 0x42, 0x92, 0x42, 0x97, 0x42, 0x9c, 0x42, 0x9d, 0x32, 0xa1, 0x32, 0xa6, 0x32, 0xab, 0x32, 
+0xb0, 0x32, 0xb4, 0x32, 0xb9, 0x32, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x37, 0x13, 0x37, 
+0x17, 0x37, 0x1c, 0x37, 0x21, 0x37, 0x26, 0x37, 0x2a, 0x37, 0x2f, 0x37, 0x34, 0x37, 0x39, 0x37, 
+0x3c, 0x41, 0x41, 0x41, 0x46, 0x41, 0x4b, 0x41, 0x50, 0x41, 0x55, 0x41, 0x5a, 0x41, 0x5f, 0x41, 
+0x64, 0x41, 0x68, 0x41, 0x6d, 0x41, 0x72, 0x41, 0x77, 0x41, 0x7c, 0x41, 0x81, 0x41, 0x86, 0x41, 
+0x8b, 0x41, 0x8e, 0x37, 0x93, 0x37, 0x98, 0x37, 0x9d, 0x37, 0xa1, 0x37, 0xa6, 0x37, 0xab, 0x37, 
+0xb0, 0x37, 0xb4, 0x37, 0xb9, 0x37, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x09, 0x3b, 0x0e, 0x3b, 0x13, 0x3b, 
+0x17, 0x3b, 0x1c, 0x3b, 0x21, 0x3b, 0x26, 0x3b, 0x2a, 0x3b, 0x2f, 0x3b, 0x34, 0x3b, 0x39, 0x3b, 
+0x3d, 0x3b, 0x42, 0x3b, 0x47, 0x3b, 0x4b, 0x3f, 0x50, 0x3f, 0x55, 0x3f, 0x5a, 0x3f, 0x5f, 0x3f, 
+0x64, 0x3f, 0x68, 0x3f, 0x6d, 0x3f, 0x72, 0x3f, 0x77, 0x3f, 0x7c, 0x3f, 0x80, 0x3b, 0x85, 0x3b, 
+0x8a, 0x3b, 0x8e, 0x3b, 0x93, 0x3b, 0x98, 0x3b, 0x9d, 0x3b, 0xa1, 0x3b, 0xa6, 0x3b, 0xab, 0x3b, 
+0xb0, 0x3b, 0xb4, 0x3b, 0xb9, 0x3b, 0xbe, 0x3b, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x40, 0x0e, 0x40, 0x13, 0x40, 
+0x17, 0x40, 0x1c, 0x40, 0x21, 0x40, 0x26, 0x40, 0x2a, 0x40, 0x2f, 0x40, 0x34, 0x40, 0x39, 0x40, 
+0x3d, 0x40, 0x42, 0x40, 0x47, 0x40, 0x4c, 0x40, 0x50, 0x40, 0x55, 0x40, 0x5a, 0x40, 0x5f, 0x40, 
+0x64, 0x40, 0x68, 0x40, 0x6d, 0x40, 0x72, 0x40, 0x77, 0x40, 0x7b, 0x40, 0x80, 0x40, 0x85, 0x40, 
+0x8a, 0x40, 0x8e, 0x40, 0x93, 0x40, 0x98, 0x40, 0x9d, 0x40, 0xa1, 0x40, 0xa6, 0x40, 0xab, 0x40, 
+0xb0, 0x40, 0xb4, 0x40, 0xb9, 0x40, 0xbe, 0x40, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x45, 0x09, 0x45, 0x0e, 0x45, 0x13, 0x45, 
+0x17, 0x45, 0x1c, 0x45, 0x21, 0x45, 0x26, 0x45, 0x2a, 0x45, 0x2f, 0x45, 0x34, 0x45, 0x39, 0x45, 
+0x3d, 0x45, 0x42, 0x45, 0x47, 0x45, 0x4c, 0x45, 0x50, 0x45, 0x55, 0x45, 0x5a, 0x45, 0x5f, 0x45, 
+0x64, 0x45, 0x68, 0x45, 0x6d, 0x45, 0x72, 0x45, 0x77, 0x45, 0x7b, 0x45, 0x80, 0x45, 0x85, 0x45, 
+0x8a, 0x45, 0x8e, 0x45, 0x93, 0x45, 0x98, 0x45, 0x9d, 0x45, 0xa1, 0x45, 0xa6, 0x45, 0xab, 0x45, 
+0xb0, 0x45, 0xb4, 0x45, 0xb9, 0x45, 0xbe, 0x45, 0xc3, 0x45, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x4a, 0x09, 0x4a, 0x0e, 0x4a, 0x13, 0x4a, 
+0x17, 0x4a, 0x1c, 0x4a, 0x21, 0x4a, 0x26, 0x4a, 0x2a, 0x4a, 0x2f, 0x4a, 0x34, 0x4a, 0x39, 0x4a, 
+0x3d, 0x4a, 0x42, 0x4a, 0x47, 0x4a, 0x4c, 0x4a, 0x50, 0x4a, 0x55, 0x4a, 0x5a, 0x4a, 0x5f, 0x4a, 
+0x64, 0x4a, 0x68, 0x4a, 0x6d, 0x4a, 0x72, 0x4a, 0x77, 0x4a, 0x7b, 0x4a, 0x80, 0x4a, 0x85, 0x4a, 
+0x8a, 0x4a, 0x8e, 0x4a, 0x93, 0x4a, 0x98, 0x4a, 0x9d, 0x4a, 0xa1, 0x4a, 0xa6, 0x4a, 0xab, 0x4a, 
+0xb0, 0x4a, 0xb4, 0x4a, 0xb9, 0x4a, 0xbe, 0x4a, 0xc3, 0x4a, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x4f, 0x09, 0x4f, 0x0e, 0x4f, 0x13, 0x4f, 
+0x17, 0x4f, 0x1c, 0x4f, 0x21, 0x4f, 0x26, 0x4f, 0x2a, 0x4f, 0x2f, 0x4f, 0x34, 0x4f, 0x39, 0x4f, 
+0x3d, 0x4f, 0x42, 0x4f, 0x47, 0x4f, 0x4c, 0x4f, 0x50, 0x4f, 0x55, 0x4f, 0x5a, 0x4f, 0x5f, 0x4f, 
+0x64, 0x4f, 0x68, 0x4f, 0x6d, 0x4f, 0x72, 0x4f, 0x77, 0x4f, 0x7b, 0x4f, 0x80, 0x4f, 0x85, 0x4f, 
+0x8a, 0x4f, 0x8e, 0x4f, 0x93, 0x4f, 0x98, 0x4f, 0x9d, 0x4f, 0xa1, 0x4f, 0xa6, 0x4f, 0xab, 0x4f, 
+0xb0, 0x4f, 0xb4, 0x4f, 0xb9, 0x4f, 0xbe, 0x4f, 0xc3, 0x4f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x53, 0x09, 0x53, 0x0e, 0x53, 0x13, 0x53, 
+0x17, 0x53, 0x1c, 0x53, 0x21, 0x53, 0x26, 0x53, 0x2a, 0x53, 0x2f, 0x53, 0x34, 0x53, 0x39, 0x53, 
+0x3d, 0x53, 0x42, 0x53, 0x47, 0x53, 0x4c, 0x53, 0x50, 0x53, 0x55, 0x53, 0x5a, 0x53, 0x5f, 0x53, 
+0x64, 0x53, 0x68, 0x53, 0x6d, 0x53, 0x72, 0x53, 0x77, 0x53, 0x7b, 0x53, 0x80, 0x53, 0x85, 0x53, 
+0x8a, 0x53, 0x8e, 0x53, 0x93, 0x53, 0x98, 0x53, 0x9d, 0x53, 0xa1, 0x53, 0xa6, 0x53, 0xab, 0x53, 
+0xb0, 0x53, 0xb4, 0x53, 0xb9, 0x53, 0xbe, 0x53, 0xc3, 0x53, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x58, 0x09, 0x58, 0x0e, 0x58, 0x13, 0x58, 
+0x17, 0x58, 0x1c, 0x58, 0x21, 0x58, 0x26, 0x58, 0x2a, 0x58, 0x2f, 0x58, 0x34, 0x58, 0x39, 0x58, 
+0x3d, 0x58, 0x42, 0x58, 0x47, 0x58, 0x4c, 0x58, 0x50, 0x58, 0x55, 0x58, 0x5a, 0x58, 0x5f, 0x58, 
+0x64, 0x58, 0x68, 0x58, 0x6d, 0x58, 0x72, 0x58, 0x77, 0x58, 0x7b, 0x58, 0x80, 0x58, 0x85, 0x58, 
+0x8a, 0x58, 0x8e, 0x58, 0x93, 0x58, 0x98, 0x58, 0x9d, 0x58, 0xa1, 0x58, 0xa6, 0x58, 0xab, 0x58, 
+0xb0, 0x58, 0xb4, 0x58, 0xb9, 0x58, 0xbe, 0x58, 0xc3, 0x58, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5d, 0x09, 0x5d, 0x0e, 0x5d, 0x13, 0x5d, 
+0x17, 0x5d, 0x1c, 0x5d, 0x21, 0x5d, 0x26, 0x5d, 0x2a, 0x5d, 0x2f, 0x5d, 0x34, 0x5d, 0x39, 0x5d, 
+0x3d, 0x5d, 0x42, 0x5d, 0x47, 0x5d, 0x4c, 0x5d, 0x50, 0x5d, 0x55, 0x5d, 0x5a, 0x5d, 0x5f, 0x5d, 
+0x64, 0x5d, 0x68, 0x5d, 0x6d, 0x5d, 0x72, 0x5d, 0x77, 0x5d, 0x7b, 0x5d, 0x80, 0x5d, 0x85, 0x5d, 
+0x8a, 0x5d, 0x8e, 0x5d, 0x93, 0x5d, 0x98, 0x5d, 0x9d, 0x5d, 0xa1, 0x5d, 0xa6, 0x5d, 0xab, 0x5d, 
+0xb0, 0x5d, 0xb4, 0x5d, 0xb9, 0x5d, 0xbe, 0x5d, 0xc3, 0x5d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x62, 0x09, 0x62, 0x0e, 0x62, 0x13, 0x62, 
+0x17, 0x62, 0x1c, 0x62, 0x21, 0x62, 0x26, 0x62, 0x2a, 0x62, 0x2f, 0x62, 0x34, 0x62, 0x39, 0x62, 
+0x3d, 0x62, 0x42, 0x62, 0x47, 0x62, 0x4c, 0x62, 0x50, 0x62, 0x55, 0x62, 0x5a, 0x62, 0x5f, 0x62, 
+0x64, 0x62, 0x68, 0x62, 0x6d, 0x62, 0x72, 0x62, 0x77, 0x62, 0x7b, 0x62, 0x80, 0x62, 0x85, 0x62, 
+0x8a, 0x62, 0x8e, 0x62, 0x93, 0x62, 0x98, 0x62, 0x9d, 0x62, 0xa1, 0x62, 0xa6, 0x62, 0xab, 0x62, 
+0xb0, 0x62, 0xb4, 0x62, 0xb9, 0x62, 0xbe, 0x62, 0xc3, 0x62, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x64, 0x5f, 0x64, 
+0x64, 0x64, 0x68, 0x64, 0x6d, 0x64, 0x72, 0x64, 0x77, 0x64, 0x7b, 0x64, 0x80, 0x64, 0x85, 0x64, 
+0x8a, 0x64, 0x8e, 0x64, 0x93, 0x64, 0x98, 0x64, 0x9d, 0x64, 0xa1, 0x64, 0xa6, 0x64, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x68, 0x09, 0x68, 0x0e, 0x68, 0x13, 0x68, 
+0x17, 0x68, 0x1c, 0x68, 0x21, 0x68, 0x26, 0x68, 0x2a, 0x68, 0x2f, 0x68, 0x34, 0x68, 0x39, 0x68, 
+0x3d, 0x68, 0x42, 0x68, 0x47, 0x68, 0x4c, 0x68, 0x50, 0x68, 0x55, 0x68, 0x5a, 0x68, 0x5f, 0x68, 
+0x64, 0x68, 0x68, 0x68, 0x6d, 0x68, 0x72, 0x68, 0x77, 0x68, 0x7b, 0x68, 0x80, 0x68, 0x85, 0x68, 
+0x8a, 0x68, 0x8e, 0x68, 0x93, 0x68, 0x98, 0x68, 0x9d, 0x68, 0xa1, 0x68, 0xa6, 0x68, 0xab, 0x68, 
+0xb0, 0x68, 0xb4, 0x68, 0xb9, 0x68, 0xbe, 0x68, 0xc3, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x6d, 0x09, 0x6d, 0x0e, 0x6d, 0x13, 0x6d, 
+0x17, 0x6d, 0x1c, 0x6d, 0x21, 0x6d, 0x26, 0x6d, 0x2a, 0x6d, 0x2f, 0x6d, 0x34, 0x6d, 0x39, 0x6d, 
+0x3d, 0x6d, 0x42, 0x6d, 0x47, 0x6d, 0x4c, 0x6d, 0x50, 0x6d, 0x55, 0x6d, 0x5a, 0x6d, 0x5f, 0x6d, 
+0x64, 0x6d, 0x68, 0x6d, 0x6d, 0x6d, 0x72, 0x6d, 0x77, 0x6d, 0x7b, 0x6d, 0x80, 0x6d, 0x85, 0x6d, 
+0x8a, 0x6d, 0x8e, 0x6d, 0x93, 0x6d, 0x98, 0x6d, 0x9d, 0x6d, 0xa1, 0x6d, 0xa6, 0x6d, 0xab, 0x6d, 
+0xb0, 0x6d, 0xb4, 0x6d, 0xb9, 0x6d, 0xbe, 0x6d, 0xc3, 0x6d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x72, 0x09, 0x72, 0x0e, 0x72, 0x13, 0x72, 
+0x17, 0x72, 0x1c, 0x72, 0x21, 0x72, 0x26, 0x72, 0x2a, 0x72, 0x2f, 0x72, 0x34, 0x72, 0x39, 0x72, 
+0x3d, 0x72, 0x42, 0x72, 0x47, 0x72, 0x4c, 0x72, 0x50, 0x72, 0x55, 0x72, 0x5a, 0x72, 0x5f, 0x72, 
+0x64, 0x72, 0x68, 0x72, 0x6d, 0x72, 0x72, 0x72, 0x77, 0x72, 0x7b, 0x72, 0x80, 0x72, 0x85, 0x72, 
+0x8a, 0x72, 0x8e, 0x72, 0x93, 0x72, 0x98, 0x72, 0x9d, 0x72, 0xa1, 0x72, 0xa6, 0x72, 0xab, 0x72, 
+0xb0, 0x72, 0xb4, 0x72, 0xb9, 0x72, 0xbe, 0x72, 0xc3, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x77, 0x09, 0x77, 0x0e, 0x77, 0x13, 0x77, 
+0x17, 0x77, 0x1c, 0x77, 0x21, 0x77, 0x26, 0x77, 0x2a, 0x77, 0x2f, 0x77, 0x34, 0x77, 0x39, 0x77, 
+0x3d, 0x77, 0x42, 0x77, 0x47, 0x77, 0x4c, 0x77, 0x50, 0x77, 0x55, 0x77, 0x5a, 0x77, 0x5f, 0x77, 
+0x64, 0x77, 0x68, 0x77, 0x6d, 0x77, 0x72, 0x77, 0x77, 0x77, 0x7b, 0x77, 0x80, 0x77, 0x85, 0x77, 
+0x8a, 0x77, 0x8e, 0x77, 0x93, 0x77, 0x98, 0x77, 0x9d, 0x77, 0xa1, 0x77, 0xa6, 0x77, 0xab, 0x77, 
+0xb0, 0x77, 0xb4, 0x77, 0xb9, 0x77, 0xbe, 0x77, 0xc3, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x7b, 0x09, 0x7b, 0x0e, 0x7b, 0x13, 0x7b, 
+0x17, 0x7b, 0x1c, 0x7b, 0x21, 0x7b, 0x26, 0x7b, 0x2a, 0x7b, 0x2f, 0x7b, 0x34, 0x7b, 0x39, 0x7b, 
+0x3d, 0x7b, 0x42, 0x7b, 0x47, 0x7b, 0x4c, 0x7b, 0x50, 0x7b, 0x55, 0x7b, 0x5a, 0x7b, 0x5f, 0x7b, 
+0x64, 0x7b, 0x68, 0x7b, 0x6d, 0x7b, 0x72, 0x7b, 0x77, 0x7b, 0x7b, 0x7b, 0x80, 0x7b, 0x85, 0x7b, 
+0x8a, 0x7b, 0x8e, 0x7b, 0x93, 0x7b, 0x98, 0x7b, 0x9d, 0x7b, 0xa1, 0x7b, 0xa6, 0x7b, 0xab, 0x7b, 
+0xb0, 0x7b, 0xb4, 0x7b, 0xb9, 0x7b, 0xbe, 0x7b, 0xc3, 0x7b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x09, 0x80, 0x0e, 0x80, 0x13, 0x80, 
+0x17, 0x80, 0x1c, 0x80, 0x21, 0x80, 0x26, 0x80, 0x2a, 0x80, 0x2f, 0x80, 0x34, 0x80, 0x39, 0x80, 
+0x3d, 0x80, 0x42, 0x80, 0x47, 0x80, 0x4c, 0x80, 0x50, 0x80, 0x55, 0x80, 0x5a, 0x80, 0x5f, 0x80, 
+0x64, 0x80, 0x68, 0x80, 0x6d, 0x80, 0x72, 0x80, 0x77, 0x80, 0x7b, 0x80, 0x80, 0x80, 0x85, 0x80, 
+0x8a, 0x80, 0x8e, 0x80, 0x93, 0x80, 0x98, 0x80, 0x9d, 0x80, 0xa1, 0x80, 0xa6, 0x80, 0xab, 0x80, 
+0xb0, 0x80, 0xb4, 0x80, 0xb9, 0x80, 0xbe, 0x80, 0xc3, 0x80, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x85, 0x0e, 0x85, 0x13, 0x85, 
+0x17, 0x85, 0x1c, 0x85, 0x21, 0x85, 0x26, 0x85, 0x2a, 0x85, 0x2f, 0x85, 0x34, 0x85, 0x39, 0x85, 
+0x3d, 0x85, 0x42, 0x85, 0x47, 0x85, 0x4c, 0x85, 0x50, 0x85, 0x55, 0x85, 0x5a, 0x85, 0x5f, 0x85, 
+0x64, 0x85, 0x68, 0x85, 0x6d, 0x85, 0x72, 0x85, 0x77, 0x85, 0x7b, 0x85, 0x80, 0x85, 0x85, 0x85, 
+0x8a, 0x85, 0x8e, 0x85, 0x93, 0x85, 0x98, 0x85, 0x9d, 0x85, 0xa1, 0x85, 0xa6, 0x85, 0xab, 0x85, 
+0xb0, 0x85, 0xb4, 0x85, 0xb9, 0x85, 0xbe, 0x85, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x8a, 0x0e, 0x8a, 0x13, 0x8a, 
+0x17, 0x8a, 0x1c, 0x8a, 0x21, 0x8a, 0x26, 0x8a, 0x2a, 0x8a, 0x2f, 0x8a, 0x34, 0x8a, 0x39, 0x8a, 
+0x3d, 0x8a, 0x42, 0x8a, 0x47, 0x8a, 0x4c, 0x8a, 0x50, 0x8a, 0x55, 0x8a, 0x5a, 0x8a, 0x5f, 0x8a, 
+0x64, 0x8a, 0x68, 0x8a, 0x6d, 0x8a, 0x72, 0x8a, 0x77, 0x8a, 0x7b, 0x8a, 0x80, 0x8a, 0x85, 0x8a, 
+0x8a, 0x8a, 0x8e, 0x8a, 0x93, 0x8a, 0x98, 0x8a, 0x9d, 0x8a, 0xa1, 0x8a, 0xa6, 0x8a, 0xab, 0x8a, 
+0xb0, 0x8a, 0xb4, 0x8a, 0xb9, 0x8a, 0xbe, 0x8a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8e, 0x13, 0x8e, 
+0x17, 0x8e, 0x1c, 0x8e, 0x21, 0x8e, 0x26, 0x8e, 0x2a, 0x8e, 0x2f, 0x8e, 0x34, 0x8e, 0x39, 0x8e, 
+0x3d, 0x8e, 0x42, 0x8e, 0x47, 0x8e, 0x4c, 0x8e, 0x50, 0x8e, 0x55, 0x8e, 0x5a, 0x8e, 0x5f, 0x8e, 
+0x64, 0x8e, 0x68, 0x8e, 0x6d, 0x8e, 0x72, 0x8e, 0x77, 0x8e, 0x7b, 0x8e, 0x80, 0x8e, 0x85, 0x8e, 
+0x8a, 0x8e, 0x8e, 0x8e, 0x93, 0x8e, 0x98, 0x8e, 0x9d, 0x8e, 0xa1, 0x8e, 0xa6, 0x8e, 0xab, 0x8e, 
+0xb0, 0x8e, 0xb4, 0x8e, 0xb9, 0x8e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x93, 0x13, 0x93, 
+0x17, 0x93, 0x1c, 0x93, 0x21, 0x93, 0x26, 0x93, 0x2a, 0x93, 0x2f, 0x93, 0x34, 0x93, 0x39, 0x93, 
+0x3d, 0x93, 0x42, 0x93, 0x47, 0x93, 0x4c, 0x93, 0x50, 0x93, 0x55, 0x93, 0x5a, 0x93, 0x5f, 0x93, 
+0x64, 0x93, 0x68, 0x93, 0x6d, 0x93, 0x72, 0x93, 0x77, 0x93, 0x7b, 0x93, 0x80, 0x93, 0x85, 0x93, 
+0x8a, 0x93, 0x8e, 0x93, 0x93, 0x93, 0x98, 0x93, 0x9d, 0x93, 0xa1, 0x93, 0xa6, 0x93, 0xab, 0x93, 
+0xb0, 0x93, 0xb4, 0x93, 0xb9, 0x93, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x98, 
+0x17, 0x98, 0x1c, 0x98, 0x21, 0x98, 0x26, 0x98, 0x2a, 0x98, 0x2f, 0x98, 0x34, 0x98, 0x39, 0x98, 
+0x3d, 0x98, 0x42, 0x98, 0x47, 0x98, 0x4c, 0x98, 0x50, 0x98, 0x55, 0x98, 0x5a, 0x98, 0x5f, 0x98, 
+0x64, 0x98, 0x68, 0x98, 0x6d, 0x98, 0x72, 0x98, 0x77, 0x98, 0x7b, 0x98, 0x80, 0x98, 0x85, 0x98, 
+0x8a, 0x98, 0x8e, 0x98, 0x93, 0x98, 0x98, 0x98, 0x9d, 0x98, 0xa1, 0x98, 0xa6, 0x98, 0xab, 0x98, 
+0xb0, 0x98, 0xb4, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x9d, 
+0x17, 0x9d, 0x1c, 0x9d, 0x21, 0x9d, 0x26, 0x9d, 0x2a, 0x9d, 0x2f, 0x9d, 0x34, 0x9d, 0x39, 0x9d, 
+0x3d, 0x9d, 0x42, 0x9d, 0x47, 0x9d, 0x4c, 0x9d, 0x50, 0x9d, 0x55, 0x9d, 0x5a, 0x9d, 0x5f, 0x9d, 
+0x64, 0x9d, 0x68, 0x9d, 0x6d, 0x9d, 0x72, 0x9d, 0x77, 0x9d, 0x7b, 0x9d, 0x80, 0x9d, 0x85, 0x9d, 
+0x8a, 0x9d, 0x8e, 0x9d, 0x93, 0x9d, 0x98, 0x9d, 0x9d, 0x9d, 0xa1, 0x9d, 0xa6, 0x9d, 0xab, 0x9d, 
+0xb0, 0x9d, 0xb4, 0x9d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0xa1, 0x1c, 0xa1, 0x21, 0xa1, 0x26, 0xa1, 0x2a, 0xa1, 0x2f, 0xa1, 0x34, 0xa1, 0x39, 0xa1, 
+0x3d, 0xa1, 0x42, 0xa1, 0x47, 0xa1, 0x4c, 0xa1, 0x50, 0xa1, 0x55, 0xa1, 0x5a, 0xa1, 0x5f, 0xa1, 
+0x64, 0xa1, 0x68, 0xa1, 0x6d, 0xa1, 0x72, 0xa1, 0x77, 0xa1, 0x7b, 0xa1, 0x80, 0xa1, 0x85, 0xa1, 
+0x8a, 0xa1, 0x8e, 0xa1, 0x93, 0xa1, 0x98, 0xa1, 0x9d, 0xa1, 0xa1, 0xa1, 0xa6, 0xa1, 0xab, 0xa1, 
+0xb0, 0xa1, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0xa6, 0x21, 0xa6, 0x26, 0xa6, 0x2a, 0xa6, 0x2f, 0xa6, 0x34, 0xa6, 0x39, 0xa6, 
+0x3d, 0xa6, 0x42, 0xa6, 0x47, 0xa6, 0x4c, 0xa6, 0x50, 0xa6, 0x55, 0xa6, 0x5a, 0xa6, 0x5f, 0xa6, 
+0x64, 0xa6, 0x68, 0xa6, 0x6d, 0xa6, 0x72, 0xa6, 0x77, 0xa6, 0x7b, 0xa6, 0x80, 0xa6, 0x85, 0xa6, 
+0x8a, 0xa6, 0x8e, 0xa6, 0x93, 0xa6, 0x98, 0xa6, 0x9d, 0xa6, 0xa1, 0xa6, 0xa6, 0xa6, 0xab, 0xa6, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0xab, 0x26, 0xab, 0x2a, 0xab, 0x2f, 0xab, 0x34, 0xab, 0x39, 0xab, 
+0x3d, 0xab, 0x42, 0xab, 0x47, 0xab, 0x4c, 0xab, 0x50, 0xab, 0x55, 0xab, 0x5a, 0xab, 0x5f, 0xab, 
+0x64, 0xab, 0x68, 0xab, 0x6d, 0xab, 0x72, 0xab, 0x77, 0xab, 0x7b, 0xab, 0x80, 0xab, 0x85, 0xab, 
+0x8a, 0xab, 0x8e, 0xab, 0x93, 0xab, 0x98, 0xab, 0x9d, 0xab, 0xa1, 0xab, 0xa6, 0xab, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0xb0, 0x2a, 0xb0, 0x2f, 0xb0, 0x34, 0xb0, 0x39, 0xb0, 
+0x3d, 0xb0, 0x42, 0xb0, 0x47, 0xb0, 0x4c, 0xb0, 0x50, 0xb0, 0x55, 0xb0, 0x5a, 0xb0, 0x5f, 0xb0, 
+0x64, 0xb0, 0x68, 0xb0, 0x6d, 0xb0, 0x72, 0xb0, 0x77, 0xb0, 0x7b, 0xb0, 0x80, 0xb0, 0x85, 0xb0, 
+0x8a, 0xb0, 0x8e, 0xb0, 0x93, 0xb0, 0x98, 0xb0, 0x9d, 0xb0, 0xa1, 0xb0, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2a, 0xb4, 0x2f, 0xb4, 0x34, 0xb4, 0x39, 0xb4, 
+0x3d, 0xb4, 0x42, 0xb4, 0x47, 0xb4, 0x4c, 0xb4, 0x50, 0xb4, 0x55, 0xb4, 0x5a, 0xb4, 0x5f, 0xb4, 
+0x64, 0xb4, 0x68, 0xb4, 0x6d, 0xb4, 0x72, 0xb4, 0x77, 0xb4, 0x7b, 0xb4, 0x80, 0xb4, 0x85, 0xb4, 
+0x8a, 0xb4, 0x8e, 0xb4, 0x93, 0xb4, 0x98, 0xb4, 0x9d, 0xb4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x34, 0xb9, 0x39, 0xb9, 
+0x3d, 0xb9, 0x42, 0xb9, 0x47, 0xb9, 0x4c, 0xb9, 0x50, 0xb9, 0x55, 0xb9, 0x5a, 0xb9, 0x5f, 0xb9, 
+0x64, 0xb9, 0x68, 0xb9, 0x6d, 0xb9, 0x72, 0xb9, 0x77, 0xb9, 0x7b, 0xb9, 0x80, 0xb9, 0x85, 0xb9, 
+0x8a, 0xb9, 0x8e, 0xb9, 0x93, 0xb9, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3d, 0xbe, 0x42, 0xbe, 0x47, 0xbe, 0x4c, 0xbe, 0x50, 0xbe, 0x55, 0xbe, 0x5a, 0xbe, 0x5f, 0xbe, 
+0x64, 0xbe, 0x68, 0xbe, 0x6d, 0xbe, 0x72, 0xbe, 0x77, 0xbe, 0x7b, 0xbe, 0x80, 0xbe, 0x85, 0xbe, 
+0x8a, 0xbe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0xc3, 0x4c, 0xc3, 0x50, 0xc3, 0x55, 0xc3, 0x5a, 0xc3, 0x5f, 0xc3, 
+0x64, 0xc3, 0x68, 0xc3, 0x6d, 0xc3, 0x72, 0xc3, 0x77, 0xc3, 0x7b, 0xc3, 0x80, 0xc3, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x47, 0x04, 0x4c, 0x04, 0x50, 0x04, 0x55, 0x04, 0x5a, 0x04, 0x5f, 0x04, 
+0x64, 0x04, 0x68, 0x04, 0x6d, 0x04, 0x72, 0x04, 0x77, 0x04, 0x7b, 0x04, 0x80, 0x04, 0x00, 0xfe, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 
+0x3d, 0x09, 0x42, 0x09, 0x47, 0x09, 0x4c, 0x09, 0x50, 0x09, 0x55, 0x09, 0x5a, 0x09, 0x5f, 0x09, 
+0x64, 0x09, 0x68, 0x09, 0x6d, 0x09, 0x72, 0x09, 0x77, 0x09, 0x7b, 0x09, 0x80, 0x09, 0x85, 0x09, 
+0x8a, 0x09, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x00, 0xfe, 0x34, 0x0e, 0x39, 0x0e, 
+0x3d, 0x0e, 0x42, 0x0e, 0x47, 0x0e, 0x4c, 0x0e, 0x50, 0x0e, 0x55, 0x0e, 0x5a, 0x0e, 0x5f, 0x0e, 
+0x64, 0x0e, 0x68, 0x0e, 0x6d, 0x0e, 0x72, 0x0e, 0x77, 0x0e, 0x7b, 0x0e, 0x80, 0x0e, 0x85, 0x0e, 
+0x8a, 0x0e, 0x8e, 0x0e, 0x93, 0x0e, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x2a, 0x13, 0x2f, 0x13, 0x34, 0x13, 0x39, 0x13, 
+0x3d, 0x13, 0x42, 0x13, 0x47, 0x13, 0x4c, 0x13, 0x50, 0x13, 0x55, 0x13, 0x5a, 0x13, 0x5f, 0x13, 
+0x64, 0x13, 0x68, 0x13, 0x6d, 0x13, 0x72, 0x13, 0x77, 0x13, 0x7b, 0x13, 0x80, 0x13, 0x85, 0x13, 
+0x8a, 0x13, 0x8e, 0x13, 0x93, 0x13, 0x98, 0x13, 0x9d, 0x13, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x26, 0x17, 0x2a, 0x17, 0x2f, 0x17, 0x34, 0x17, 0x39, 0x17, 
+0x3d, 0x17, 0x42, 0x17, 0x47, 0x17, 0x4c, 0x17, 0x50, 0x17, 0x55, 0x17, 0x5a, 0x17, 0x5f, 0x17, 
+0x64, 0x17, 0x68, 0x17, 0x6d, 0x17, 0x72, 0x17, 0x77, 0x17, 0x7b, 0x17, 0x80, 0x17, 0x85, 0x17, 
+0x8a, 0x17, 0x8e, 0x17, 0x93, 0x17, 0x98, 0x17, 0x9d, 0x17, 0xa1, 0x17, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0x1c, 0x26, 0x1c, 0x2a, 0x1c, 0x2f, 0x1c, 0x34, 0x1c, 0x39, 0x1c, 
+0x3d, 0x1c, 0x42, 0x1c, 0x47, 0x1c, 0x4c, 0x1c, 0x50, 0x1c, 0x55, 0x1c, 0x5a, 0x1c, 0x5f, 0x1c, 
+0x64, 0x1c, 0x68, 0x1c, 0x6d, 0x1c, 0x72, 0x1c, 0x77, 0x1c, 0x7b, 0x1c, 0x80, 0x1c, 0x85, 0x1c, 
+0x8a, 0x1c, 0x8e, 0x1c, 0x93, 0x1c, 0x98, 0x1c, 0x9d, 0x1c, 0xa1, 0x1c, 0xa6, 0x1c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0x21, 0x21, 0x21, 0x26, 0x21, 0x2a, 0x21, 0x2f, 0x21, 0x34, 0x21, 0x39, 0x21, 
+0x3d, 0x21, 0x42, 0x21, 0x47, 0x21, 0x4c, 0x21, 0x50, 0x21, 0x55, 0x21, 0x5a, 0x21, 0x5f, 0x21, 
+0x64, 0x21, 0x68, 0x21, 0x6d, 0x21, 0x72, 0x21, 0x77, 0x21, 0x7b, 0x21, 0x80, 0x21, 0x85, 0x21, 
+0x8a, 0x21, 0x8e, 0x21, 0x93, 0x21, 0x98, 0x21, 0x9d, 0x21, 0xa1, 0x21, 0xa6, 0x21, 0xab, 0x21, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0x26, 0x1c, 0x26, 0x21, 0x26, 0x26, 0x26, 0x2a, 0x26, 0x2f, 0x26, 0x34, 0x26, 0x39, 0x26, 
+0x3d, 0x26, 0x42, 0x26, 0x47, 0x26, 0x4c, 0x26, 0x50, 0x26, 0x55, 0x26, 0x5a, 0x26, 0x5f, 0x26, 
+0x64, 0x26, 0x68, 0x26, 0x6d, 0x26, 0x72, 0x26, 0x77, 0x26, 0x7b, 0x26, 0x80, 0x26, 0x85, 0x26, 
+0x8a, 0x26, 0x8e, 0x26, 0x93, 0x26, 0x98, 0x26, 0x9d, 0x26, 0xa1, 0x26, 0xa6, 0x26, 0xab, 0x26, 
+0xb0, 0x26, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2a, 
+0x17, 0x2a, 0x1c, 0x2a, 0x21, 0x2a, 0x26, 0x2a, 0x2a, 0x2a, 0x2f, 0x2a, 0x34, 0x2a, 0x39, 0x2a, 
+0x3d, 0x2a, 0x42, 0x2a, 0x47, 0x2a, 0x4c, 0x2a, 0x50, 0x2a, 0x55, 0x2a, 0x5a, 0x2a, 0x5f, 0x2a, 
+0x64, 0x2a, 0x68, 0x2a, 0x6d, 0x2a, 0x72, 0x2a, 0x77, 0x2a, 0x7b, 0x2a, 0x80, 0x2a, 0x85, 0x2a, 
+0x8a, 0x2a, 0x8e, 0x2a, 0x93, 0x2a, 0x98, 0x2a, 0x9d, 0x2a, 0xa1, 0x2a, 0xa6, 0x2a, 0xab, 0x2a, 
+0xb0, 0x2a, 0xb4, 0x2a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x2f, 
+0x17, 0x2f, 0x1c, 0x2f, 0x21, 0x2f, 0x26, 0x2f, 0x2a, 0x2f, 0x2f, 0x2f, 0x34, 0x2f, 0x39, 0x2f, 
+0x3d, 0x2f, 0x42, 0x2f, 0x47, 0x2f, 0x4c, 0x2f, 0x50, 0x2f, 0x55, 0x2f, 0x5a, 0x2f, 0x5f, 0x2f, 
+0x64, 0x2f, 0x68, 0x2f, 0x6d, 0x2f, 0x72, 0x2f, 0x77, 0x2f, 0x7b, 0x2f, 0x80, 0x2f, 0x85, 0x2f, 
+0x8a, 0x2f, 0x8e, 0x2f, 0x93, 0x2f, 0x98, 0x2f, 0x9d, 0x2f, 0xa1, 0x2f, 0xa6, 0x2f, 0xab, 0x2f, 
+0xb0, 0x2f, 0xb4, 0x2f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x34, 0x13, 0x34, 
+0x17, 0x34, 0x1c, 0x34, 0x21, 0x34, 0x26, 0x34, 0x2a, 0x34, 0x2f, 0x34, 0x34, 0x34, 0x39, 0x34, 
+0x3d, 0x34, 0x42, 0x34, 0x47, 0x34, 0x4c, 0x34, 0x50, 0x34, 0x55, 0x34, 0x5a, 0x34, 0x5f, 0x34, 
+0x64, 0x34, 0x68, 0x34, 0x6d, 0x34, 0x72, 0x34, 0x77, 0x34, 0x7b, 0x34, 0x80, 0x34, 0x85, 0x34, 
+0x8a, 0x34, 0x8e, 0x34, 0x93, 0x34, 0x98, 0x34, 0x9d, 0x34, 0xa1, 0x34, 0xa6, 0x34, 0xab, 0x34, 
+0xb0, 0x34, 0xb4, 0x34, 0xb9, 0x34, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x39, 0x13, 0x39, 
+0x17, 0x39, 0x1c, 0x39, 0x21, 0x39, 0x26, 0x39, 0x2a, 0x39, 0x2f, 0x39, 0x34, 0x39, 0x39, 0x39, 
+0x3d, 0x39, 0x42, 0x39, 0x47, 0x39, 0x4c, 0x39, 0x50, 0x39, 0x55, 0x39, 0x5a, 0x39, 0x5f, 0x39, 
+0x64, 0x39, 0x68, 0x39, 0x6d, 0x39, 0x72, 0x39, 0x77, 0x39, 0x7b, 0x39, 0x80, 0x39, 0x85, 0x39, 
+0x8a, 0x39, 0x8e, 0x39, 0x93, 0x39, 0x98, 0x39, 0x9d, 0x39, 0xa1, 0x39, 0xa6, 0x39, 0xab, 0x39, 
+0xb0, 0x39, 0xb4, 0x39, 0xb9, 0x39, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x3d, 0x0e, 0x3d, 0x13, 0x3d, 
+0x17, 0x3d, 0x1c, 0x3d, 0x21, 0x3d, 0x26, 0x3d, 0x2a, 0x3d, 0x2f, 0x3d, 0x34, 0x3d, 0x39, 0x3d, 
+0x3d, 0x3d, 0x42, 0x3d, 0x47, 0x3d, 0x4c, 0x3d, 0x50, 0x3d, 0x55, 0x3d, 0x5a, 0x3d, 0x5f, 0x3d, 
+0x64, 0x3d, 0x68, 0x3d, 0x6d, 0x3d, 0x72, 0x3d, 0x77, 0x3d, 0x7b, 0x3d, 0x80, 0x3d, 0x85, 0x3d, 
+0x8a, 0x3d, 0x8e, 0x3d, 0x93, 0x3d, 0x98, 0x3d, 0x9d, 0x3d, 0xa1, 0x3d, 0xa6, 0x3d, 0xab, 0x3d, 
+0xb0, 0x3d, 0xb4, 0x3d, 0xb9, 0x3d, 0xbe, 0x3d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x42, 0x0e, 0x42, 0x13, 0x42, 
+0x17, 0x42, 0x1c, 0x42, 0x21, 0x42, 0x26, 0x42, 0x2a, 0x42, 0x2f, 0x42, 0x34, 0x42, 0x39, 0x42, 
+0x3d, 0x42, 0x42, 0x42, 0x47, 0x42, 0x4c, 0x42, 0x50, 0x42, 0x55, 0x42, 0x5a, 0x42, 0x5f, 0x42, 
+0x64, 0x42, 0x68, 0x42, 0x6d, 0x42, 0x72, 0x42, 0x77, 0x42, 0x7b, 0x42, 0x80, 0x42, 0x85, 0x42, 
+0x8a, 0x42, 0x8e, 0x42, 0x93, 0x42, 0x98, 0x42, 0x9d, 0x42, 0xa1, 0x42, 0xa6, 0x42, 0xab, 0x42, 
+0xb0, 0x42, 0xb4, 0x42, 0xb9, 0x42, 0xbe, 0x42, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x47, 0x09, 0x47, 0x0e, 0x47, 0x13, 0x47, 
+0x17, 0x47, 0x1c, 0x47, 0x21, 0x47, 0x26, 0x47, 0x2a, 0x47, 0x2f, 0x47, 0x34, 0x47, 0x39, 0x47, 
+0x3d, 0x47, 0x42, 0x47, 0x47, 0x47, 0x4c, 0x47, 0x50, 0x47, 0x55, 0x47, 0x5a, 0x47, 0x5f, 0x47, 
+0x64, 0x47, 0x68, 0x47, 0x6d, 0x47, 0x72, 0x47, 0x77, 0x47, 0x7b, 0x47, 0x80, 0x47, 0x85, 0x47, 
+0x8a, 0x47, 0x8e, 0x47, 0x93, 0x47, 0x98, 0x47, 0x9d, 0x47, 0xa1, 0x47, 0xa6, 0x47, 0xab, 0x47, 
+0xb0, 0x47, 0xb4, 0x47, 0xb9, 0x47, 0xbe, 0x47, 0xc3, 0x47, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x4c, 0x09, 0x4c, 0x0e, 0x4c, 0x13, 0x4c, 
+0x17, 0x4c, 0x1c, 0x4c, 0x21, 0x4c, 0x26, 0x4c, 0x2a, 0x4c, 0x2f, 0x4c, 0x34, 0x4c, 0x39, 0x4c, 
+0x3d, 0x4c, 0x42, 0x4c, 0x47, 0x4c, 0x4c, 0x4c, 0x50, 0x4c, 0x55, 0x4c, 0x5a, 0x4c, 0x5f, 0x4c, 
+0x64, 0x4c, 0x68, 0x4c, 0x6d, 0x4c, 0x72, 0x4c, 0x77, 0x4c, 0x7b, 0x4c, 0x80, 0x4c, 0x85, 0x4c, 
+0x8a, 0x4c, 0x8e, 0x4c, 0x93, 0x4c, 0x98, 0x4c, 0x9d, 0x4c, 0xa1, 0x4c, 0xa6, 0x4c, 0xab, 0x4c, 
+0xb0, 0x4c, 0xb4, 0x4c, 0xb9, 0x4c, 0xbe, 0x4c, 0xc3, 0x4c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x50, 0x09, 0x50, 0x0e, 0x50, 0x13, 0x50, 
+0x17, 0x50, 0x1c, 0x50, 0x21, 0x50, 0x26, 0x50, 0x2a, 0x50, 0x2f, 0x50, 0x34, 0x50, 0x39, 0x50, 
+0x3d, 0x50, 0x42, 0x50, 0x47, 0x50, 0x4c, 0x50, 0x50, 0x50, 0x55, 0x50, 0x5a, 0x50, 0x5f, 0x50, 
+0x64, 0x50, 0x68, 0x50, 0x6d, 0x50, 0x72, 0x50, 0x77, 0x50, 0x7b, 0x50, 0x80, 0x50, 0x85, 0x50, 
+0x8a, 0x50, 0x8e, 0x50, 0x93, 0x50, 0x98, 0x50, 0x9d, 0x50, 0xa1, 0x50, 0xa6, 0x50, 0xab, 0x50, 
+0xb0, 0x50, 0xb4, 0x50, 0xb9, 0x50, 0xbe, 0x50, 0xc3, 0x50, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x55, 0x09, 0x55, 0x0e, 0x55, 0x13, 0x55, 
+0x17, 0x55, 0x1c, 0x55, 0x21, 0x55, 0x26, 0x55, 0x2a, 0x55, 0x2f, 0x55, 0x34, 0x55, 0x39, 0x55, 
+0x3d, 0x55, 0x42, 0x55, 0x47, 0x55, 0x4c, 0x55, 0x50, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x5f, 0x55, 
+0x64, 0x55, 0x68, 0x55, 0x6d, 0x55, 0x72, 0x55, 0x77, 0x55, 0x7b, 0x55, 0x80, 0x55, 0x85, 0x55, 
+0x8a, 0x55, 0x8e, 0x55, 0x93, 0x55, 0x98, 0x55, 0x9d, 0x55, 0xa1, 0x55, 0xa6, 0x55, 0xab, 0x55, 
+0xb0, 0x55, 0xb4, 0x55, 0xb9, 0x55, 0xbe, 0x55, 0xc3, 0x55, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5a, 0x09, 0x5a, 0x0e, 0x5a, 0x13, 0x5a, 
+0x17, 0x5a, 0x1c, 0x5a, 0x21, 0x5a, 0x26, 0x5a, 0x2a, 0x5a, 0x2f, 0x5a, 0x34, 0x5a, 0x39, 0x5a, 
+0x3d, 0x5a, 0x42, 0x5a, 0x47, 0x5a, 0x4c, 0x5a, 0x50, 0x5a, 0x55, 0x5a, 0x5a, 0x5a, 0x5f, 0x5a, 
+0x64, 0x5a, 0x68, 0x5a, 0x6d, 0x5a, 0x72, 0x5a, 0x76, 0x58, 0x7a, 0x57, 0x7f, 0x57, 0x83, 0x56, 
+0x87, 0x55, 0x8c, 0x54, 0x93, 0x5a, 0x98, 0x5a, 0x9d, 0x5a, 0xa1, 0x5a, 0xa6, 0x5a, 0xab, 0x5a, 
+0xb0, 0x5a, 0xb4, 0x5a, 0xb9, 0x5a, 0xbe, 0x5a, 0xc3, 0x5a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x5f, 0x09, 0x5f, 0x0e, 0x5f, 0x13, 0x5f, 
+0x17, 0x5f, 0x1c, 0x5f, 0x21, 0x5f, 0x26, 0x5f, 0x2a, 0x5f, 0x2f, 0x5f, 0x34, 0x5f, 0x39, 0x5f, 
+0x3d, 0x5f, 0x42, 0x5f, 0x47, 0x5f, 0x4c, 0x5f, 0x50, 0x5f, 0x55, 0x5f, 0x5a, 0x5f, 0x5f, 0x5f, 
+0x63, 0x5f, 0x68, 0x5e, 0x6c, 0x5d, 0x70, 0x5c, 0x75, 0x5b, 0x79, 0x5a, 0x7d, 0x59, 0x82, 0x58, 
+0x86, 0x57, 0x8b, 0x56, 0x8f, 0x56, 0x94, 0x55, 0x99, 0x54, 0xa1, 0x5f, 0xa6, 0x5f, 0xab, 0x5f, 
+0xb0, 0x5f, 0xb4, 0x5f, 0xb9, 0x5f, 0xbe, 0x5f, 0xc3, 0x5f, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x64, 0x09, 0x64, 0x0e, 0x64, 0x13, 0x64, 
+0x17, 0x64, 0x1c, 0x64, 0x21, 0x64, 0x26, 0x64, 0x2a, 0x64, 0x2f, 0x64, 0x34, 0x64, 0x39, 0x64, 
+0x3d, 0x64, 0x42, 0x64, 0x47, 0x64, 0x4c, 0x64, 0x50, 0x64, 0x55, 0x64, 0x5a, 0x63, 0x5e, 0x62, 
+0x63, 0x61, 0x67, 0x60, 0x6b, 0x5f, 0x6f, 0x5f, 0x74, 0x5e, 0x78, 0x5d, 0x7c, 0x5c, 0x80, 0x5b, 
+0x85, 0x5a, 0x89, 0x59, 0x8e, 0x58, 0x93, 0x57, 0x98, 0x56, 0x9d, 0x55, 0xa2, 0x54, 0xab, 0x64, 
+0xb0, 0x64, 0xb4, 0x64, 0xb9, 0x64, 0xbe, 0x64, 0xc3, 0x64, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x68, 0x09, 0x68, 0x0e, 0x68, 0x13, 0x68, 
+0x17, 0x68, 0x1c, 0x68, 0x21, 0x68, 0x26, 0x68, 0x2a, 0x68, 0x2f, 0x68, 0x34, 0x68, 0x39, 0x68, 
+0x3d, 0x68, 0x42, 0x68, 0x47, 0x68, 0x4c, 0x68, 0x50, 0x68, 0x54, 0x66, 0x59, 0x66, 0x5d, 0x65, 
+0x62, 0x64, 0x66, 0x63, 0x6a, 0x62, 0x6e, 0x61, 0x72, 0x60, 0x76, 0x60, 0x7b, 0x5f, 0x7f, 0x5e, 
+0x83, 0x5d, 0x88, 0x5c, 0x8c, 0x5b, 0x91, 0x5a, 0x96, 0x59, 0x9c, 0x58, 0xa1, 0x57, 0xa6, 0x56, 
+0xab, 0x55, 0xb4, 0x68, 0xb9, 0x68, 0xbe, 0x68, 0xc3, 0x68, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x6d, 0x09, 0x6d, 0x0e, 0x6d, 0x13, 0x6d, 
+0x17, 0x6d, 0x1c, 0x6d, 0x21, 0x6d, 0x26, 0x6d, 0x2a, 0x6d, 0x2f, 0x6d, 0x34, 0x6d, 0x39, 0x6d, 
+0x3d, 0x6d, 0x42, 0x6d, 0x47, 0x6d, 0x4b, 0x6b, 0x4f, 0x6a, 0x54, 0x69, 0x58, 0x68, 0x5d, 0x67, 
+0x61, 0x66, 0x65, 0x65, 0x69, 0x65, 0x6d, 0x64, 0x71, 0x63, 0x75, 0x62, 0x79, 0x61, 0x7d, 0x60, 
+0x81, 0x60, 0x86, 0x5f, 0x8a, 0x5e, 0x8f, 0x5d, 0x95, 0x5c, 0x9a, 0x5b, 0xa0, 0x5a, 0xa5, 0x59, 
+0xab, 0x57, 0xb1, 0x56, 0xb9, 0x6d, 0xbe, 0x6d, 0xc3, 0x6d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x72, 0x09, 0x72, 0x0e, 0x72, 0x13, 0x72, 
+0x17, 0x72, 0x1c, 0x72, 0x21, 0x72, 0x26, 0x72, 0x2a, 0x72, 0x2f, 0x72, 0x34, 0x72, 0x39, 0x72, 
+0x3d, 0x72, 0x42, 0x72, 0x45, 0x6e, 0x4a, 0x6d, 0x4f, 0x6c, 0x53, 0x6b, 0x58, 0x6a, 0x5c, 0x69, 
+0x60, 0x69, 0x64, 0x68, 0x68, 0x67, 0x6c, 0x66, 0x70, 0x65, 0x73, 0x64, 0x77, 0x64, 0x7b, 0x63, 
+0x7f, 0x62, 0x84, 0x61, 0x88, 0x60, 0x8d, 0x5f, 0x93, 0x5e, 0x98, 0x5d, 0x9e, 0x5c, 0xa4, 0x5b, 
+0xaa, 0x5a, 0xb0, 0x59, 0xb6, 0x58, 0xbe, 0x72, 0xc3, 0x72, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x77, 0x09, 0x77, 0x0e, 0x77, 0x13, 0x77, 
+0x17, 0x77, 0x1c, 0x77, 0x21, 0x77, 0x26, 0x77, 0x2a, 0x77, 0x2f, 0x77, 0x34, 0x77, 0x39, 0x77, 
+0x3d, 0x77, 0x40, 0x72, 0x45, 0x71, 0x49, 0x70, 0x4e, 0x6f, 0x53, 0x6e, 0x57, 0x6d, 0x5b, 0x6c, 
+0x5f, 0x6b, 0x63, 0x6a, 0x67, 0x69, 0x6b, 0x68, 0x6e, 0x67, 0x72, 0x67, 0x76, 0x66, 0x79, 0x65, 
+0x7d, 0x64, 0x82, 0x64, 0x86, 0x63, 0x8b, 0x62, 0x91, 0x61, 0x96, 0x60, 0x9c, 0x5f, 0xa3, 0x5e, 
+0xa9, 0x5d, 0xb0, 0x5c, 0xb7, 0x5b, 0xbd, 0x59, 0xc3, 0x77, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x04, 0x7b, 0x09, 0x7b, 0x0e, 0x7b, 0x13, 0x7b, 
+0x17, 0x7b, 0x1c, 0x7b, 0x21, 0x7b, 0x26, 0x7b, 0x2a, 0x7b, 0x2f, 0x7b, 0x34, 0x7b, 0x39, 0x7b, 
+0x3d, 0x7b, 0x3f, 0x74, 0x44, 0x73, 0x49, 0x72, 0x4e, 0x71, 0x52, 0x70, 0x57, 0x6f, 0x5b, 0x6e, 
+0x5f, 0x6d, 0x63, 0x6c, 0x66, 0x6b, 0x6a, 0x6a, 0x6d, 0x69, 0x71, 0x68, 0x74, 0x68, 0x78, 0x67, 
+0x7c, 0x66, 0x80, 0x66, 0x84, 0x65, 0x89, 0x64, 0x8e, 0x64, 0x94, 0x63, 0x9b, 0x62, 0xa1, 0x61, 
+0xa8, 0x60, 0xb0, 0x5f, 0xb7, 0x5d, 0xbe, 0x5c, 0xc5, 0x5b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x80, 0x09, 0x80, 0x0e, 0x80, 0x13, 0x80, 
+0x17, 0x80, 0x1c, 0x80, 0x21, 0x80, 0x26, 0x80, 0x2a, 0x80, 0x2f, 0x80, 0x34, 0x80, 0x39, 0x80, 
+0x3a, 0x78, 0x3f, 0x77, 0x43, 0x76, 0x48, 0x75, 0x4d, 0x73, 0x52, 0x72, 0x56, 0x71, 0x5a, 0x70, 
+0x5e, 0x6f, 0x62, 0x6e, 0x65, 0x6d, 0x69, 0x6c, 0x6c, 0x6b, 0x6f, 0x6a, 0x73, 0x6a, 0x76, 0x69, 
+0x7a, 0x68, 0x7e, 0x68, 0x82, 0x67, 0x87, 0x66, 0x8c, 0x66, 0x92, 0x65, 0x99, 0x64, 0xa0, 0x63, 
+0xa7, 0x63, 0xaf, 0x61, 0xb7, 0x60, 0xbf, 0x5f, 0xc6, 0x5e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x85, 0x0e, 0x85, 0x13, 0x85, 
+0x17, 0x85, 0x1c, 0x85, 0x21, 0x85, 0x26, 0x85, 0x2a, 0x85, 0x2f, 0x85, 0x34, 0x85, 0x34, 0x7c, 
+0x39, 0x7b, 0x3e, 0x7a, 0x43, 0x78, 0x48, 0x77, 0x4d, 0x75, 0x51, 0x74, 0x56, 0x73, 0x5a, 0x71, 
+0x5e, 0x70, 0x61, 0x6f, 0x65, 0x6e, 0x68, 0x6d, 0x6b, 0x6d, 0x6e, 0x6c, 0x71, 0x6b, 0x74, 0x6a, 
+0x78, 0x6a, 0x7c, 0x6a, 0x81, 0x69, 0x85, 0x69, 0x8b, 0x68, 0x90, 0x67, 0x97, 0x67, 0x9e, 0x66, 
+0xa6, 0x65, 0xaf, 0x64, 0xb8, 0x63, 0xc0, 0x62, 0xc7, 0x61, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x09, 0x8a, 0x0e, 0x8a, 0x13, 0x8a, 
+0x17, 0x8a, 0x1c, 0x8a, 0x21, 0x8a, 0x26, 0x8a, 0x2a, 0x8a, 0x2f, 0x8a, 0x34, 0x8a, 0x33, 0x7e, 
+0x38, 0x7d, 0x3d, 0x7c, 0x42, 0x7b, 0x47, 0x79, 0x4c, 0x77, 0x51, 0x76, 0x55, 0x74, 0x59, 0x73, 
+0x5d, 0x72, 0x61, 0x71, 0x64, 0x6f, 0x67, 0x6e, 0x6a, 0x6d, 0x6c, 0x6d, 0x6f, 0x6c, 0x72, 0x6c, 
+0x76, 0x6b, 0x79, 0x6b, 0x7d, 0x6a, 0x84, 0x6b, 0x89, 0x6a, 0x8f, 0x6a, 0x95, 0x69, 0x9d, 0x69, 
+0xa5, 0x68, 0xaf, 0x67, 0xb8, 0x67, 0xc2, 0x66, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x8e, 0x13, 0x8e, 
+0x17, 0x8e, 0x1c, 0x8e, 0x21, 0x8e, 0x26, 0x8e, 0x2a, 0x8e, 0x2f, 0x8e, 0x2e, 0x81, 0x32, 0x81, 
+0x37, 0x80, 0x3c, 0x7e, 0x42, 0x7d, 0x47, 0x7b, 0x4c, 0x79, 0x51, 0x78, 0x55, 0x76, 0x59, 0x75, 
+0x5d, 0x74, 0x60, 0x71, 0x63, 0x70, 0x66, 0x6f, 0x69, 0x6f, 0x6c, 0x6e, 0x6e, 0x6e, 0x71, 0x6d, 
+0x74, 0x6d, 0x78, 0x6c, 0x7b, 0x6c, 0x80, 0x6c, 0x86, 0x6c, 0x8d, 0x6c, 0x94, 0x6c, 0x9c, 0x6b, 
+0xa5, 0x6b, 0xaf, 0x6a, 0xba, 0x6a, 0xc7, 0x69, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x93, 0x13, 0x93, 
+0x17, 0x93, 0x1c, 0x93, 0x21, 0x93, 0x26, 0x93, 0x2a, 0x93, 0x2f, 0x93, 0x2d, 0x84, 0x31, 0x83, 
+0x37, 0x82, 0x3c, 0x80, 0x41, 0x7f, 0x47, 0x7d, 0x4b, 0x7b, 0x50, 0x7a, 0x55, 0x78, 0x59, 0x76, 
+0x5d, 0x74, 0x60, 0x73, 0x63, 0x72, 0x66, 0x71, 0x68, 0x70, 0x6b, 0x70, 0x6e, 0x6f, 0x71, 0x6f, 
+0x74, 0x6e, 0x77, 0x6e, 0x7a, 0x6e, 0x7f, 0x6d, 0x83, 0x6d, 0x8c, 0x6e, 0x93, 0x6e, 0x9b, 0x6e, 
+0xa5, 0x6e, 0xb0, 0x6e, 0xbd, 0x6e, 0xc7, 0x6d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x98, 
+0x17, 0x98, 0x1c, 0x98, 0x21, 0x98, 0x26, 0x98, 0x2a, 0x98, 0x27, 0x86, 0x2b, 0x86, 0x31, 0x85, 
+0x36, 0x83, 0x3c, 0x82, 0x41, 0x80, 0x46, 0x7f, 0x4b, 0x7d, 0x50, 0x7b, 0x54, 0x7a, 0x58, 0x78, 
+0x5c, 0x75, 0x5f, 0x74, 0x62, 0x73, 0x65, 0x72, 0x68, 0x72, 0x6a, 0x71, 0x6d, 0x71, 0x70, 0x70, 
+0x73, 0x70, 0x76, 0x70, 0x7a, 0x6f, 0x7e, 0x6f, 0x82, 0x6f, 0x88, 0x6f, 0x93, 0x71, 0x9b, 0x71, 
+0xa6, 0x71, 0xb2, 0x71, 0xc4, 0x72, 0xc6, 0x70, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x9d, 
+0x17, 0x9d, 0x1c, 0x9d, 0x21, 0x9d, 0x26, 0x9d, 0x2a, 0x9d, 0x25, 0x88, 0x2a, 0x88, 0x30, 0x86, 
+0x35, 0x85, 0x3b, 0x83, 0x41, 0x82, 0x46, 0x80, 0x4b, 0x7e, 0x50, 0x7d, 0x54, 0x7b, 0x58, 0x78, 
+0x5c, 0x77, 0x5f, 0x76, 0x62, 0x75, 0x64, 0x74, 0x67, 0x73, 0x6a, 0x73, 0x6d, 0x72, 0x70, 0x72, 
+0x73, 0x72, 0x76, 0x71, 0x79, 0x71, 0x7d, 0x71, 0x82, 0x71, 0x88, 0x71, 0x91, 0x73, 0x9c, 0x74, 
+0xa8, 0x75, 0xb8, 0x76, 0xc4, 0x76, 0xc6, 0x74, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x17, 0xa1, 0x1c, 0xa1, 0x21, 0xa1, 0x26, 0xa1, 0x2a, 0xa1, 0x23, 0x8a, 0x29, 0x8a, 0x2f, 0x88, 
+0x35, 0x87, 0x3b, 0x85, 0x41, 0x83, 0x46, 0x81, 0x4b, 0x7f, 0x50, 0x7e, 0x54, 0x7c, 0x59, 0x79, 
+0x5c, 0x78, 0x5e, 0x77, 0x61, 0x77, 0x64, 0x76, 0x67, 0x75, 0x69, 0x75, 0x6c, 0x74, 0x6f, 0x74, 
+0x72, 0x74, 0x76, 0x73, 0x79, 0x73, 0x7d, 0x73, 0x82, 0x73, 0x88, 0x74, 0x90, 0x75, 0x9e, 0x78, 
+0xad, 0x7a, 0xbf, 0x7c, 0xc4, 0x7a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x1c, 0xa6, 0x21, 0xa6, 0x26, 0xa6, 0x1c, 0x8d, 0x21, 0x8d, 0x27, 0x8b, 0x2d, 0x8a, 
+0x34, 0x88, 0x3a, 0x86, 0x40, 0x84, 0x46, 0x82, 0x4b, 0x81, 0x50, 0x7f, 0x55, 0x7c, 0x59, 0x7a, 
+0x5c, 0x79, 0x5e, 0x78, 0x61, 0x78, 0x64, 0x77, 0x66, 0x77, 0x69, 0x77, 0x6c, 0x76, 0x6f, 0x76, 
+0x72, 0x76, 0x75, 0x75, 0x79, 0x75, 0x7d, 0x76, 0x82, 0x76, 0x88, 0x77, 0x91, 0x78, 0xa2, 0x7d, 
+0xb7, 0x81, 0xbf, 0x80, 0xc3, 0x7e, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x21, 0xab, 0x26, 0xab, 0x19, 0x8f, 0x1f, 0x8f, 0x25, 0x8d, 0x2c, 0x8c, 
+0x33, 0x8a, 0x39, 0x88, 0x40, 0x86, 0x45, 0x84, 0x4b, 0x82, 0x50, 0x80, 0x55, 0x7c, 0x59, 0x7b, 
+0x5c, 0x7a, 0x5f, 0x79, 0x61, 0x79, 0x64, 0x79, 0x66, 0x78, 0x69, 0x78, 0x6b, 0x78, 0x6f, 0x78, 
+0x72, 0x78, 0x75, 0x78, 0x79, 0x78, 0x7e, 0x78, 0x83, 0x79, 0x8a, 0x7a, 0x94, 0x7d, 0xae, 0x86, 
+0xb8, 0x86, 0xbf, 0x85, 0xc3, 0x82, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x92, 0x15, 0x92, 0x1b, 0x91, 0x23, 0x8f, 0x2a, 0x8d, 
+0x31, 0x8b, 0x38, 0x89, 0x3f, 0x87, 0x45, 0x85, 0x4b, 0x83, 0x51, 0x7f, 0x55, 0x7d, 0x59, 0x7c, 
+0x5c, 0x7b, 0x5f, 0x7a, 0x61, 0x7a, 0x64, 0x7a, 0x67, 0x7a, 0x69, 0x7a, 0x6c, 0x7a, 0x6f, 0x7a, 
+0x72, 0x7b, 0x75, 0x7b, 0x7a, 0x7b, 0x7f, 0x7c, 0x85, 0x7d, 0x8e, 0x80, 0x9f, 0x86, 0xb0, 0x8b, 
+0xb9, 0x8b, 0xbf, 0x89, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x95, 0x17, 0x94, 0x1f, 0x92, 0x27, 0x90, 
+0x2f, 0x8d, 0x37, 0x8b, 0x3e, 0x88, 0x44, 0x86, 0x4a, 0x84, 0x51, 0x7f, 0x55, 0x7e, 0x59, 0x7d, 
+0x5c, 0x7c, 0x5f, 0x7b, 0x62, 0x7b, 0x64, 0x7b, 0x67, 0x7b, 0x6a, 0x7b, 0x6d, 0x7b, 0x70, 0x7c, 
+0x73, 0x7d, 0x77, 0x7e, 0x7b, 0x7f, 0x80, 0x81, 0x89, 0x84, 0x96, 0x89, 0xa2, 0x8c, 0xb2, 0x91, 
+0xb9, 0x90, 0xbe, 0x8d, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x98, 0x19, 0x96, 0x22, 0x93, 
+0x2c, 0x90, 0x35, 0x8d, 0x3c, 0x8a, 0x43, 0x87, 0x4b, 0x82, 0x51, 0x80, 0x55, 0x7f, 0x58, 0x7e, 
+0x5c, 0x7d, 0x5f, 0x7d, 0x62, 0x7d, 0x65, 0x7c, 0x68, 0x7d, 0x6b, 0x7d, 0x6e, 0x7d, 0x71, 0x7e, 
+0x75, 0x7f, 0x79, 0x81, 0x7f, 0x83, 0x89, 0x8b, 0x90, 0x8d, 0x99, 0x90, 0xa6, 0x94, 0xb3, 0x97, 
+0xb9, 0x95, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0e, 0x97, 0x11, 0x9a, 0x16, 0x9b, 
+0x25, 0x94, 0x30, 0x90, 0x3a, 0x8d, 0x42, 0x89, 0x4b, 0x83, 0x50, 0x81, 0x54, 0x80, 0x58, 0x7f, 
+0x5c, 0x7f, 0x5f, 0x7e, 0x62, 0x7e, 0x65, 0x7e, 0x68, 0x7f, 0x6c, 0x7f, 0x6f, 0x80, 0x73, 0x81, 
+0x78, 0x83, 0x80, 0x8a, 0x86, 0x8c, 0x8d, 0x8e, 0x94, 0x91, 0x9e, 0x95, 0xac, 0x9d, 0xb3, 0x9c, 
+0xb8, 0x99, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x99, 0x14, 0x9b, 
+0x1a, 0x9c, 0x23, 0x9b, 0x32, 0x94, 0x40, 0x8a, 0x49, 0x86, 0x4f, 0x83, 0x54, 0x82, 0x58, 0x81, 
+0x5b, 0x81, 0x5f, 0x81, 0x63, 0x81, 0x66, 0x81, 0x6a, 0x82, 0x6e, 0x83, 0x72, 0x86, 0x79, 0x8a, 
+0x7e, 0x8c, 0x84, 0x8d, 0x8a, 0x8f, 0x91, 0x92, 0x9a, 0x95, 0xa5, 0x9b, 0xb0, 0x9f, 0xb4, 0x9e, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0e, 0x97, 0x12, 0x9a, 
+0x18, 0x9c, 0x20, 0x9b, 0x2a, 0x9a, 0x3a, 0x91, 0x43, 0x8e, 0x49, 0x8c, 0x4f, 0x8b, 0x55, 0x8a, 
+0x5a, 0x89, 0x5e, 0x89, 0x63, 0x89, 0x68, 0x89, 0x6c, 0x8a, 0x71, 0x8b, 0x76, 0x8c, 0x7b, 0x8d, 
+0x81, 0x8f, 0x87, 0x91, 0x8e, 0x93, 0x96, 0x96, 0xa0, 0x9a, 0xad, 0xa1, 0xb2, 0xa0, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x98, 
+0x15, 0x9b, 0x1e, 0x9b, 0x2d, 0x95, 0x39, 0x91, 0x42, 0x8e, 0x49, 0x8d, 0x4f, 0x8c, 0x55, 0x8b, 
+0x5a, 0x8b, 0x5f, 0x8b, 0x64, 0x8b, 0x69, 0x8b, 0x6e, 0x8c, 0x73, 0x8d, 0x79, 0x8e, 0x7e, 0x90, 
+0x85, 0x92, 0x8c, 0x94, 0x93, 0x97, 0x9c, 0x9a, 0xa7, 0x9e, 0xb0, 0xa1, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0d, 0x95, 
+0x12, 0x99, 0x1b, 0x9a, 0x2d, 0x93, 0x38, 0x90, 0x40, 0x8e, 0x48, 0x8d, 0x4e, 0x8c, 0x55, 0x8c, 
+0x5a, 0x8c, 0x60, 0x8c, 0x65, 0x8d, 0x6b, 0x8d, 0x70, 0x8e, 0x76, 0x8f, 0x7c, 0x91, 0x82, 0x93, 
+0x89, 0x95, 0x91, 0x97, 0x99, 0x9a, 0xa2, 0x9e, 0xaf, 0xa3, 0xb2, 0xa1, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x91, 
+0x0f, 0x95, 0x1d, 0x93, 0x2b, 0x90, 0x36, 0x8e, 0x3f, 0x8d, 0x47, 0x8d, 0x4e, 0x8d, 0x55, 0x8d, 
+0x5b, 0x8d, 0x61, 0x8d, 0x67, 0x8e, 0x6d, 0x8f, 0x73, 0x90, 0x79, 0x91, 0x80, 0x93, 0x87, 0x95, 
+0x8e, 0x97, 0x96, 0x9a, 0x9f, 0x9d, 0xa9, 0xa1, 0xb1, 0xa2, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x8a, 
+0x0b, 0x8f, 0x1d, 0x8d, 0x2a, 0x8c, 0x34, 0x8c, 0x3e, 0x8b, 0x46, 0x8b, 0x4e, 0x8c, 0x55, 0x8c, 
+0x5c, 0x8d, 0x62, 0x8e, 0x69, 0x8f, 0x70, 0x90, 0x76, 0x91, 0x7d, 0x93, 0x84, 0x95, 0x8c, 0x97, 
+0x94, 0x99, 0x9d, 0x9c, 0xa6, 0x9f, 0xb1, 0xa3, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0c, 0x84, 0x1b, 0x85, 0x28, 0x86, 0x33, 0x87, 0x3d, 0x87, 0x46, 0x88, 0x4e, 0x89, 0x56, 0x8a, 
+0x5d, 0x8b, 0x65, 0x8d, 0x6c, 0x8e, 0x73, 0x90, 0x7a, 0x91, 0x82, 0x93, 0x8a, 0x96, 0x92, 0x98, 
+0x9b, 0x9a, 0xa4, 0x9d, 0xad, 0xa0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0c, 0x76, 0x1a, 0x79, 0x26, 0x7c, 0x32, 0x7e, 0x3c, 0x81, 0x46, 0x83, 0x4f, 0x84, 0x57, 0x86, 
+0x5f, 0x88, 0x67, 0x8a, 0x6f, 0x8c, 0x77, 0x8e, 0x7f, 0x90, 0x88, 0x92, 0x90, 0x95, 0x99, 0x97, 
+0xa2, 0x9a, 0xab, 0x9c, 0xb4, 0x9e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x02, 0x5f, 
+0x0f, 0x64, 0x1b, 0x69, 0x27, 0x6e, 0x32, 0x72, 0x3d, 0x75, 0x47, 0x79, 0x50, 0x7c, 0x5a, 0x7f, 
+0x62, 0x82, 0x6b, 0x84, 0x74, 0x87, 0x7d, 0x8a, 0x85, 0x8c, 0x8e, 0x8f, 0x97, 0x92, 0xa0, 0x94, 
+0xa9, 0x97, 0xb3, 0x99, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x3b, 
+0x19, 0x40, 0x20, 0x55, 0x2b, 0x5b, 0x35, 0x60, 0x3f, 0x65, 0x49, 0x6a, 0x53, 0x6f, 0x5d, 0x73, 
+0x67, 0x77, 0x70, 0x7b, 0x79, 0x7e, 0x82, 0x82, 0x8c, 0x85, 0x95, 0x88, 0x9f, 0x8b, 0xa8, 0x8f, 
+0xb4, 0x8a, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x14, 0x3e, 
+0x1e, 0x42, 0x28, 0x47, 0x31, 0x4b, 0x3b, 0x50, 0x45, 0x55, 0x4e, 0x59, 0x58, 0x5e, 0x62, 0x63, 
+0x6b, 0x67, 0x75, 0x6c, 0x7f, 0x71, 0x89, 0x75, 0x92, 0x7a, 0x9c, 0x7f, 0xa6, 0x83, 0xaf, 0x88, 
+0xb9, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x3b, 0x19, 0x40, 
+0x23, 0x44, 0x2c, 0x49, 0x36, 0x4e, 0x40, 0x52, 0x49, 0x57, 0x53, 0x5c, 0x5d, 0x60, 0x66, 0x65, 
+0x70, 0x6a, 0x7a, 0x6e, 0x83, 0x73, 0x8d, 0x77, 0x97, 0x7c, 0xa1, 0x81, 0xaa, 0x85, 0xb4, 0x8a, 
+0xbe, 0x8f, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x39, 0x14, 0x3d, 0x1e, 0x42, 
+0x27, 0x47, 0x31, 0x4b, 0x3b, 0x50, 0x44, 0x55, 0x4e, 0x59, 0x58, 0x5e, 0x61, 0x62, 0x6b, 0x67, 
+0x75, 0x6c, 0x7e, 0x70, 0x88, 0x75, 0x92, 0x7a, 0x9b, 0x7e, 0xa5, 0x83, 0xaf, 0x88, 0xb9, 0x8c, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0f, 0x3b, 0x19, 0x40, 0x22, 0x44, 
+0x2c, 0x49, 0x36, 0x4e, 0x3f, 0x52, 0x49, 0x57, 0x53, 0x5b, 0x5c, 0x60, 0x66, 0x65, 0x70, 0x69, 
+0x79, 0x6e, 0x83, 0x73, 0x8d, 0x77, 0x96, 0x7c, 0xa0, 0x81, 0xaa, 0x85, 0xb3, 0x8a, 0xbd, 0x8e, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0a, 0x39, 0x13, 0x3d, 0x1d, 0x42, 0x27, 0x46, 
+0x31, 0x4b, 0x3a, 0x50, 0x44, 0x54, 0x4e, 0x59, 0x57, 0x5e, 0x61, 0x62, 0x6b, 0x67, 0x74, 0x6c, 
+0x7e, 0x70, 0x88, 0x75, 0x91, 0x79, 0x9b, 0x7e, 0xa5, 0x83, 0xae, 0x87, 0xb8, 0x8c, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3b, 0x18, 0x3f, 0x22, 0x44, 0x2b, 0x49, 
+0x35, 0x4d, 0x3f, 0x52, 0x49, 0x57, 0x52, 0x5b, 0x5c, 0x60, 0x66, 0x65, 0x6f, 0x69, 0x79, 0x6e, 
+0x83, 0x72, 0x8c, 0x77, 0x96, 0x7c, 0xa0, 0x80, 0xa9, 0x85, 0xb3, 0x8a, 0xbd, 0x8e, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x09, 0x38, 0x13, 0x3d, 0x1d, 0x42, 0x26, 0x46, 0x30, 0x4b, 
+0x3a, 0x50, 0x43, 0x54, 0x4d, 0x59, 0x57, 0x5d, 0x61, 0x62, 0x6a, 0x67, 0x74, 0x6b, 0x7e, 0x70, 
+0x87, 0x75, 0x91, 0x79, 0x9b, 0x7e, 0xa4, 0x83, 0xae, 0x87, 0xb8, 0x8c, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3b, 0x18, 0x3f, 0x21, 0x44, 0x2b, 0x48, 0x35, 0x4d, 
+0x3e, 0x52, 0x48, 0x56, 0x52, 0x5b, 0x5c, 0x60, 0x65, 0x64, 0x6f, 0x69, 0x79, 0x6e, 0x82, 0x72, 
+0x8c, 0x77, 0x96, 0x7b, 0x9f, 0x80, 0xa9, 0x85, 0xb3, 0x89, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x13, 0x3d, 0x1c, 0x41, 0x26, 0x46, 0x30, 0x4b, 0x39, 0x4f, 
+0x43, 0x54, 0x4d, 0x59, 0x56, 0x5d, 0x60, 0x62, 0x6a, 0x67, 0x74, 0x6b, 0x7d, 0x70, 0x87, 0x74, 
+0x91, 0x79, 0x9a, 0x7e, 0xa4, 0x82, 0xae, 0x87, 0xb7, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x0e, 0x3a, 0x17, 0x3f, 0x21, 0x44, 0x2b, 0x48, 0x34, 0x4d, 0x3e, 0x52, 
+0x48, 0x56, 0x51, 0x5b, 0x5b, 0x5f, 0x65, 0x64, 0x6e, 0x69, 0x78, 0x6d, 0x82, 0x72, 0x8c, 0x77, 
+0x95, 0x7b, 0x9f, 0x80, 0xa9, 0x85, 0xb2, 0x89, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xfe, 0x12, 0x3d, 0x1c, 0x41, 0x26, 0x46, 0x2f, 0x4b, 0x39, 0x4f, 0x43, 0x54, 
+0x4c, 0x58, 0x56, 0x5d, 0x60, 0x62, 0x69, 0x66, 0x73, 0x6b, 0x7d, 0x70, 0x86, 0x74, 0x90, 0x79, 
+0x9a, 0x7e, 0xa4, 0x82, 0xad, 0x87, 0xb7, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x0d, 0x3a, 0x17, 0x3f, 0x21, 0x43, 0x2a, 0x48, 0x34, 0x4d, 0x3e, 0x51, 0x47, 0x56, 
+0x51, 0x5b, 0x5b, 0x5f, 0x64, 0x64, 0x6e, 0x69, 0x78, 0x6d, 0x81, 0x72, 0x8b, 0x76, 0x95, 0x7b, 
+0x9e, 0x80, 0xa8, 0x84, 0xb2, 0x89, 0xbc, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x12, 0x3c, 0x1c, 0x41, 0x25, 0x46, 0x2f, 0x4a, 0x39, 0x4f, 0x42, 0x54, 0x4c, 0x58, 
+0x56, 0x5d, 0x5f, 0x61, 0x69, 0x66, 0x73, 0x6b, 0x7c, 0x6f, 0x86, 0x74, 0x90, 0x79, 0x99, 0x7d, 
+0xa3, 0x82, 0xad, 0x87, 0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x0d, 0x3a, 0x16, 0x3f, 0x20, 0x43, 0x2a, 0x48, 0x34, 0x4d, 0x3d, 0x51, 0x47, 0x56, 0x51, 0x5a, 
+0x5a, 0x5f, 0x64, 0x64, 0x6e, 0x68, 0x77, 0x6d, 0x81, 0x72, 0x8b, 0x76, 0x94, 0x7b, 0x9e, 0x80, 
+0xa8, 0x84, 0xb1, 0x89, 0xbb, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x11, 0x3c, 0x1b, 0x41, 0x25, 0x45, 0x2e, 0x4a, 0x38, 0x4f, 0x42, 0x53, 0x4c, 0x58, 0x55, 0x5d, 
+0x5f, 0x61, 0x69, 0x66, 0x72, 0x6b, 0x7c, 0x6f, 0x86, 0x74, 0x8f, 0x78, 0x99, 0x7d, 0xa3, 0x82, 
+0xac, 0x86, 0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x3a, 
+0x16, 0x3e, 0x20, 0x43, 0x29, 0x48, 0x33, 0x4c, 0x3d, 0x51, 0x46, 0x56, 0x50, 0x5a, 0x5a, 0x5f, 
+0x64, 0x64, 0x6d, 0x68, 0x77, 0x6d, 0x81, 0x71, 0x8a, 0x76, 0x94, 0x7b, 0x9e, 0x7f, 0xa7, 0x84, 
+0xb1, 0x89, 0xbb, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3c, 
+0x1b, 0x41, 0x24, 0x45, 0x2e, 0x4a, 0x38, 0x4f, 0x41, 0x53, 0x4b, 0x58, 0x55, 0x5c, 0x5e, 0x61, 
+0x68, 0x66, 0x72, 0x6a, 0x7c, 0x6f, 0x85, 0x74, 0x8f, 0x78, 0x99, 0x7d, 0xa2, 0x82, 0xac, 0x86, 
+0xb6, 0x8b, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0c, 0x3a, 0x16, 0x3e, 
+0x1f, 0x43, 0x29, 0x48, 0x33, 0x4c, 0x3c, 0x51, 0x46, 0x55, 0x50, 0x5a, 0x59, 0x5f, 0x63, 0x63, 
+0x6d, 0x68, 0x76, 0x6d, 0x80, 0x71, 0x8a, 0x76, 0x94, 0x7b, 0x9d, 0x7f, 0xa7, 0x84, 0xb1, 0x88, 
+0xba, 0x8d, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x11, 0x3c, 0x1a, 0x40, 
+0x24, 0x45, 0x2e, 0x4a, 0x37, 0x4e, 0x41, 0x53, 0x4b, 0x58, 0x54, 0x5c, 0x5e, 0x61, 0x68, 0x66, 
+0x71, 0x6a, 0x7b, 0x6f, 0x85, 0x73, 0x8f, 0x78, 0x98, 0x7d, 0xa2, 0x81, 0xac, 0x86, 0xb5, 0x8b, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x39, 0x15, 0x3e, 0x1f, 0x43, 
+0x29, 0x47, 0x32, 0x4c, 0x3c, 0x51, 0x46, 0x55, 0x4f, 0x5a, 0x59, 0x5e, 0x63, 0x63, 0x6c, 0x68, 
+0x76, 0x6c, 0x80, 0x71, 0x89, 0x76, 0x93, 0x7a, 0x9d, 0x7f, 0xa7, 0x84, 0xb0, 0x88, 0xba, 0x8d, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x10, 0x3c, 0x1a, 0x40, 0x24, 0x45, 
+0x2d, 0x4a, 0x37, 0x4e, 0x41, 0x53, 0x4a, 0x57, 0x54, 0x5c, 0x5e, 0x61, 0x67, 0x65, 0x71, 0x6a, 
+0x7b, 0x6f, 0x84, 0x73, 0x8e, 0x78, 0x98, 0x7d, 0xa1, 0x81, 0xab, 0x86, 0xb5, 0x8a, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x39, 0x15, 0x3e, 0x1f, 0x42, 0x28, 0x47, 
+0x32, 0x4c, 0x3c, 0x50, 0x45, 0x55, 0x4f, 0x5a, 0x59, 0x5e, 0x62, 0x63, 0x6c, 0x68, 0x76, 0x6c, 
+0x7f, 0x71, 0x89, 0x75, 0x93, 0x7a, 0x9c, 0x7f, 0xa6, 0x83, 0xb0, 0x88, 0xb9, 0x8d, 0x00, 0xfe, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x45, 0x17, 0x45, 0x23, 0x45, 0x2d, 0x49, 
+0x37, 0x4e, 0x40, 0x53, 0x4a, 0x57, 0x54, 0x5c, 0x5d, 0x61, 0x67, 0x65, 0x71, 0x6a, 0x7a, 0x6e, 
+0x84, 0x73, 0x8e, 0x78, 0x97, 0x7c, 0xa1, 0x81, 0xab, 0x86, 0xb4, 0x8a, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x50, 0x17, 0x50, 0x23, 0x50, 0x2f, 0x50, 
+0x3b, 0x50, 0x45, 0x55, 0x4f, 0x59, 0x58, 0x5e, 0x62, 0x63, 0x6c, 0x67, 0x75, 0x6c, 0x7f, 0x71, 
+0x89, 0x75, 0x92, 0x7a, 0x9c, 0x7f, 0xa6, 0x83, 0xaf, 0x88, 0xb9, 0x8c, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x5c, 0x17, 0x5c, 0x23, 0x5c, 0x2f, 0x5c, 
+0x3b, 0x5c, 0x47, 0x5c, 0x53, 0x5c, 0x5d, 0x60, 0x67, 0x65, 0x70, 0x6a, 0x7a, 0x6e, 0x84, 0x73, 
+0x8d, 0x77, 0x97, 0x7c, 0xa1, 0x81, 0xaa, 0x85, 0xb4, 0x8a, 0xbe, 0x8f, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x68, 0x17, 0x68, 0x23, 0x68, 0x2f, 0x68, 
+0x3b, 0x68, 0x47, 0x68, 0x53, 0x68, 0x5f, 0x68, 0x6b, 0x68, 0x75, 0x6c, 0x7f, 0x70, 0x88, 0x75, 
+0x92, 0x7a, 0x9c, 0x7e, 0xa5, 0x83, 0xaf, 0x88, 0xb9, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x74, 0x17, 0x74, 0x23, 0x74, 0x2f, 0x74, 
+0x3b, 0x74, 0x47, 0x74, 0x53, 0x74, 0x5f, 0x74, 0x6b, 0x74, 0x77, 0x74, 0x82, 0x74, 0x8d, 0x77, 
+0x97, 0x7c, 0xa0, 0x81, 0xaa, 0x85, 0xb4, 0x8a, 0xbd, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x80, 0x17, 0x80, 0x23, 0x80, 0x2f, 0x80, 
+0x3b, 0x80, 0x47, 0x80, 0x53, 0x80, 0x5f, 0x80, 0x6b, 0x80, 0x77, 0x80, 0x82, 0x80, 0x8e, 0x80, 
+0x9a, 0x80, 0xa5, 0x83, 0xaf, 0x87, 0xb8, 0x8c, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x0b, 0x8c, 0x17, 0x8c, 0x23, 0x8c, 0x2f, 0x8c, 
+0x3b, 0x8c, 0x47, 0x8c, 0x53, 0x8c, 0x5f, 0x8c, 0x6b, 0x8c, 0x77, 0x8c, 0x82, 0x8c, 0x8e, 0x8c, 
+0x9a, 0x8c, 0xa6, 0x8c, 0xb2, 0x8c, 0xbd, 0x8e, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x17, 0x98, 0x23, 0x98, 0x2f, 0x98, 
+0x3b, 0x98, 0x47, 0x98, 0x53, 0x98, 0x5f, 0x98, 0x6b, 0x98, 0x77, 0x98, 0x82, 0x98, 0x8e, 0x98, 
+0x9a, 0x98, 0xa6, 0x98, 0xb2, 0x98, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xa4, 0x23, 0xa4, 0x2f, 0xa4, 
+0x3b, 0xa4, 0x47, 0xa4, 0x53, 0xa4, 0x5f, 0xa4, 0x6b, 0xa4, 0x77, 0xa4, 0x82, 0xa4, 0x8e, 0xa4, 
+0x9a, 0xa4, 0xa6, 0xa4, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 0x23, 0xb0, 0x2f, 0xb0, 
+0x3b, 0xb0, 0x47, 0xb0, 0x53, 0xb0, 0x5f, 0xb0, 0x6b, 0xb0, 0x77, 0xb0, 0x82, 0xb0, 0x8e, 0xb0, 
+0x9a, 0xb0, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfe, 
+0x3b, 0xbc, 0x47, 0xbc, 0x53, 0xbc, 0x5f, 0xbc, 0x6b, 0xbc, 0x77, 0xbc, 0x82, 0xbc, 0x8e, 0xbc, 
+0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 
+};
@@ -0,0 +1,1669 @@
+// Generated by native/tiles (pio run -e tiles -t exec), do not edit.
+// Signed distance fields of the digits, colon and slash; see MetaBallAtlas.h.
+
+const float GlyphAtlasRadius[] = {
+21.00f, 10.86f, 10.72f, 10.85f, 10.76f, 10.59f, 21.00f, 10.68f, 21.00f, 21.00f, 6.00f, 6.00f, 
+};
+
+// 12 glyphs of 33 x 53 samples, one every 2 pixels.
+const unsigned char GlyphAtlas2[] PROGMEM = {
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 0xc5, 0xc2, 
+0xc1, 0xc0, 0xc1, 0xc2, 0xc5, 0xc9, 0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 
+0xb2, 0xb1, 0xb0, 0xb1, 0xb2, 0xb5, 0xb9, 0xbe, 0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xed, 0xe2, 0xd8, 0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 
+0xa6, 0xa3, 0xa1, 0xa0, 0xa1, 0xa3, 0xa6, 0xaa, 0xaf, 0xb6, 0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 
+0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 0xb8, 0xaf, 0xa8, 0xa1, 
+0x9b, 0x96, 0x93, 0x91, 0x90, 0x91, 0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 0xb8, 0xc2, 0xcc, 0xd7, 
+0xe2, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa2, 0x99, 
+0x92, 0x8c, 0x87, 0x83, 0x81, 0x80, 0x81, 0x83, 0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 0xb5, 0xc0, 
+0xcb, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xf4, 0xe7, 0xda, 0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 
+0x8c, 0x84, 0x7d, 0x77, 0x73, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 
+0xb5, 0xc1, 0xcd, 0xda, 0xe7, 0xf4, 0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 0xb6, 0xaa, 0x9e, 0x93, 
+0x88, 0x7e, 0x76, 0x6e, 0x68, 0x64, 0x61, 0x60, 0x61, 0x64, 0x68, 0x6e, 0x76, 0x7e, 0x88, 0x93, 
+0x9e, 0xaa, 0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 0xa0, 0x93, 
+0x87, 0x7c, 0x72, 0x68, 0x60, 0x59, 0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 0x60, 0x68, 0x72, 0x7c, 
+0x87, 0x93, 0xa0, 0xad, 0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 
+0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 0x5b, 0x66, 
+0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 0xc1, 0xcf, 0xde, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 
+0x8f, 0x81, 0x73, 0x66, 0x5a, 0x4f, 0x45, 0x3c, 0x36, 0x31, 0x30, 0x31, 0x36, 0x3c, 0x45, 0x4f, 
+0x5a, 0x66, 0x73, 0x81, 0x8f, 0x9d, 0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 
+0x96, 0x87, 0x79, 0x6b, 0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 0x22, 0x20, 0x22, 0x27, 0x2f, 0x38, 
+0x44, 0x50, 0x5d, 0x6b, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 0xce, 0xbf, 0xaf, 
+0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 0x10, 0x12, 0x18, 0x22, 
+0x2d, 0x3a, 0x47, 0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xcb, 0xbc, 
+0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 0x03, 0x0b, 
+0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xc9, 
+0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 
+0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x09, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 
+0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 
+0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 
+0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 
+0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 
+0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 
+0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 
+0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 
+0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 
+0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 
+0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 
+0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 
+0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 
+0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 
+0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 
+0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 
+0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 
+0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 
+0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 
+0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 
+0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 
+0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 
+0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 
+0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 
+0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 
+0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 
+0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 
+0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 
+0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 
+0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 
+0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 
+0x28, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 
+0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 
+0x3b, 0x2c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 
+0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 
+0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 0x03, 0x0b, 0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 
+0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 0x73, 
+0x64, 0x55, 0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 0x10, 0x12, 0x18, 0x22, 0x2d, 0x3a, 0x47, 0x55, 
+0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 
+0x79, 0x6b, 0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 0x22, 0x20, 0x22, 0x27, 0x2f, 0x38, 0x44, 0x50, 
+0x5d, 0x6b, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 
+0x8f, 0x81, 0x73, 0x66, 0x5a, 0x4f, 0x45, 0x3c, 0x36, 0x31, 0x30, 0x31, 0x36, 0x3c, 0x45, 0x4f, 
+0x5a, 0x66, 0x73, 0x81, 0x8f, 0x9d, 0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 
+0xa4, 0x97, 0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 
+0x5b, 0x66, 0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 0xc1, 0xcf, 0xde, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 
+0xba, 0xad, 0xa0, 0x93, 0x87, 0x7c, 0x72, 0x68, 0x60, 0x59, 0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 
+0x60, 0x68, 0x72, 0x7c, 0x87, 0x93, 0xa0, 0xad, 0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xec, 0xde, 
+0xd1, 0xc3, 0xb6, 0xaa, 0x9e, 0x93, 0x88, 0x7e, 0x76, 0x6e, 0x68, 0x64, 0x61, 0x60, 0x61, 0x64, 
+0x68, 0x6e, 0x76, 0x7e, 0x88, 0x93, 0x9e, 0xaa, 0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xf4, 
+0xe7, 0xda, 0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 0x8c, 0x84, 0x7d, 0x77, 0x73, 0x71, 0x70, 0x71, 
+0x73, 0x77, 0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 0xb5, 0xc1, 0xcd, 0xda, 0xe7, 0xf4, 0xff, 0xff, 
+0xfd, 0xf0, 0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa2, 0x99, 0x92, 0x8c, 0x87, 0x83, 0x81, 0x80, 
+0x81, 0x83, 0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 0xb5, 0xc0, 0xcb, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 
+0xff, 0xff, 0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 0xb8, 0xaf, 0xa8, 0xa1, 0x9b, 0x96, 0x93, 0x91, 
+0x90, 0x91, 0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 0xb8, 0xc2, 0xcc, 0xd7, 0xe2, 0xee, 0xfa, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xed, 0xe2, 0xd8, 0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 0xa6, 0xa3, 
+0xa1, 0xa0, 0xa1, 0xa3, 0xa6, 0xaa, 0xaf, 0xb6, 0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 0xf9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 
+0xb2, 0xb1, 0xb0, 0xb1, 0xb2, 0xb5, 0xb9, 0xbe, 0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 
+0xc5, 0xc2, 0xc1, 0xc0, 0xc1, 0xc2, 0xc5, 0xc9, 0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xe1, 0xd6, 0xcc, 0xc3, 0xbb, 0xb4, 0xaf, 0xac, 0xaa, 0xaa, 0xad, 0xb1, 
+0xb7, 0xbe, 0xc7, 0xd0, 0xdb, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xd6, 0xcb, 0xc0, 0xb6, 0xad, 0xa6, 0xa0, 0x9c, 0x9a, 0x9b, 0x9d, 
+0xa2, 0xa8, 0xb0, 0xba, 0xc4, 0xcf, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xcc, 0xc0, 0xb4, 0xa9, 0xa0, 0x97, 0x91, 0x8c, 0x8a, 0x8b, 
+0x8e, 0x93, 0x9a, 0xa3, 0xae, 0xb9, 0xc5, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xc1, 0xb5, 0xa9, 0x9e, 0x93, 0x89, 0x82, 0x7d, 0x7a, 
+0x7b, 0x7e, 0x85, 0x8d, 0x97, 0xa2, 0xae, 0xbb, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xb8, 0xab, 0x9f, 0x93, 0x87, 0x7c, 0x73, 0x6d, 
+0x6a, 0x6b, 0x6f, 0x77, 0x80, 0x8c, 0x98, 0xa5, 0xb3, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xaf, 0xa2, 0x95, 0x88, 0x7c, 0x70, 0x66, 
+0x5e, 0x5a, 0x5b, 0x61, 0x6a, 0x75, 0x82, 0x8f, 0x9e, 0xac, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xa6, 0x99, 0x8c, 0x7f, 0x72, 0x66, 
+0x5a, 0x50, 0x4a, 0x4c, 0x53, 0x5f, 0x6c, 0x7a, 0x89, 0x98, 0xa7, 0xb6, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0x9e, 0x91, 0x84, 0x77, 0x69, 
+0x5c, 0x4f, 0x43, 0x3b, 0x3d, 0x48, 0x56, 0x65, 0x74, 0x84, 0x94, 0xa3, 0xb3, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x95, 0x89, 0x7c, 0x6f, 
+0x62, 0x55, 0x47, 0x3a, 0x2d, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92, 0xa2, 0xb2, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x8d, 0x81, 0x74, 
+0x67, 0x5b, 0x4e, 0x41, 0x33, 0x2c, 0x35, 0x43, 0x53, 0x63, 0x73, 0x82, 0x92, 0xa2, 0xb2, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x84, 0x78, 
+0x6c, 0x5f, 0x53, 0x46, 0x39, 0x33, 0x31, 0x3a, 0x48, 0x56, 0x65, 0x75, 0x84, 0x94, 0xa4, 0xb3, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7a, 
+0x6e, 0x62, 0x56, 0x4a, 0x3e, 0x39, 0x3a, 0x36, 0x3e, 0x4c, 0x5a, 0x69, 0x78, 0x87, 0x96, 0xa6, 
+0xb5, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x58, 0x4d, 0x41, 0x3e, 0x41, 0x3f, 0x3a, 0x41, 0x50, 0x5f, 0x6d, 0x7b, 0x8a, 0x99, 
+0xa9, 0xb8, 0xff, 0xff, 0xf8, 0xec, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x41, 0x46, 0x47, 0x44, 0x3d, 0x44, 0x53, 0x62, 0x71, 0x7f, 0x8e, 
+0x9d, 0xac, 0xbb, 0xff, 0xff, 0xed, 0xe1, 0xd6, 0xca, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4a, 0x4e, 0x4d, 0x48, 0x3f, 0x46, 0x55, 0x65, 0x74, 0x82, 
+0x91, 0xa0, 0xaf, 0xbe, 0xff, 0xff, 0xe4, 0xd7, 0xcb, 0xbf, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4d, 0x53, 0x55, 0x52, 0x4b, 0x41, 0x47, 0x57, 0x66, 0x76, 
+0x85, 0x94, 0xa3, 0xb2, 0xc1, 0xff, 0xff, 0xdc, 0xce, 0xc1, 0xb4, 0xa8, 0x9d, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4e, 0x56, 0x5b, 0x5b, 0x56, 0x4e, 0x41, 0x48, 0x58, 0x68, 
+0x77, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xff, 0xff, 0xd5, 0xc6, 0xb8, 0xaa, 0x9e, 0x92, 0x86, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4e, 0x58, 0x5f, 0x62, 0x60, 0x5a, 0x50, 0x42, 0x48, 0x58, 
+0x68, 0x78, 0x88, 0x97, 0xa7, 0xb6, 0xc6, 0xff, 0xff, 0xcf, 0xc0, 0xb1, 0xa2, 0x94, 0x87, 0x7b, 
+0x70, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4e, 0x59, 0x62, 0x67, 0x68, 0x65, 0x5d, 0x51, 0x42, 0x48, 
+0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc7, 0xff, 0xff, 0xcb, 0xbb, 0xac, 0x9c, 0x8d, 0x7f, 
+0x71, 0x64, 0x59, 0x4e, 0x42, 0x42, 0x4e, 0x59, 0x64, 0x6c, 0x6f, 0x6e, 0x69, 0x5f, 0x52, 0x42, 
+0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x89, 
+0x79, 0x6a, 0x5b, 0x4e, 0x42, 0x42, 0x4e, 0x59, 0x64, 0x6e, 0x74, 0x76, 0x73, 0x6c, 0x61, 0x52, 
+0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 
+0x88, 0x78, 0x68, 0x58, 0x48, 0x42, 0x4e, 0x59, 0x64, 0x70, 0x78, 0x7c, 0x7c, 0x77, 0x6e, 0x61, 
+0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 0xb9, 0xaa, 
+0x9a, 0x8a, 0x7b, 0x6c, 0x5e, 0x53, 0x51, 0x59, 0x64, 0x70, 0x7a, 0x81, 0x83, 0x81, 0x7b, 0x70, 
+0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xcc, 0xbd, 
+0xae, 0x9f, 0x90, 0x82, 0x75, 0x69, 0x62, 0x60, 0x66, 0x70, 0x7b, 0x84, 0x89, 0x89, 0x85, 0x7d, 
+0x71, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xd1, 
+0xc2, 0xb4, 0xa5, 0x98, 0x8b, 0x80, 0x77, 0x71, 0x70, 0x74, 0x7c, 0x86, 0x8d, 0x90, 0x8f, 0x89, 
+0x80, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 
+0xd7, 0xc9, 0xbb, 0xae, 0xa2, 0x96, 0x8d, 0x85, 0x81, 0x80, 0x83, 0x89, 0x92, 0x95, 0x97, 0x94, 
+0x8c, 0x81, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 
+0xff, 0xdf, 0xd1, 0xc4, 0xb8, 0xad, 0xa3, 0x9b, 0x94, 0x91, 0x90, 0x93, 0x98, 0x9f, 0x9d, 0x9d, 
+0x98, 0x8f, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 
+0xff, 0xff, 0xe8, 0xdb, 0xcf, 0xc4, 0xb9, 0xb0, 0xa9, 0xa4, 0xa1, 0xa0, 0xa2, 0xa7, 0xad, 0xa5, 
+0xa2, 0x9b, 0x90, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 
+0xc8, 0xff, 0xff, 0xf1, 0xe5, 0xda, 0xd0, 0xc6, 0xbe, 0xb8, 0xb3, 0xb1, 0xb0, 0xb2, 0xb6, 0xbc, 
+0xac, 0xa7, 0x9e, 0x91, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xfc, 0xf1, 0xe6, 0xdd, 0xd4, 0xcd, 0xc7, 0xc3, 0xc0, 0xc0, 0xc2, 0xc5, 
+0xca, 0xb3, 0xab, 0xa0, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 
+0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 
+0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 
+0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 
+0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 
+0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 
+0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 
+0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 
+0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 0x72, 
+0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 0x82, 
+0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x92, 
+0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 
+0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 
+0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x43, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 
+0xb3, 0xa3, 0x94, 0x84, 0x75, 0x66, 0x59, 0x51, 0x53, 0x5e, 0x6c, 0x7b, 0x8a, 0x9a, 0xaa, 0xb9, 
+0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xc6, 0xb7, 0xa8, 0x99, 0x8a, 0x7c, 0x70, 0x66, 0x60, 0x62, 0x69, 0x75, 0x82, 0x90, 0x9f, 0xae, 
+0xbd, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xcb, 0xbc, 0xae, 0xa0, 0x93, 0x86, 0x7c, 0x74, 0x70, 0x71, 0x77, 0x80, 0x8b, 0x98, 0xa5, 
+0xb4, 0xc2, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xd2, 0xc4, 0xb6, 0xa9, 0x9d, 0x92, 0x89, 0x83, 0x80, 0x81, 0x85, 0x8d, 0x96, 0xa2, 
+0xae, 0xbb, 0xc9, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xda, 0xcc, 0xc0, 0xb4, 0xa9, 0x9f, 0x98, 0x93, 0x90, 0x91, 0x94, 0x9b, 0xa3, 
+0xad, 0xb8, 0xc4, 0xd1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xe3, 0xd6, 0xca, 0xbf, 0xb6, 0xad, 0xa7, 0xa2, 0xa0, 0xa1, 0xa4, 0xa9, 
+0xb0, 0xb9, 0xc4, 0xcf, 0xdb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe1, 0xd6, 0xcc, 0xc3, 0xbc, 0xb6, 0xb2, 0xb0, 0xb1, 0xb3, 
+0xb8, 0xbe, 0xc6, 0xd0, 0xda, 0xe5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe2, 0xd9, 0xd1, 0xca, 0xc5, 0xc2, 0xc0, 0xc0, 
+0xc3, 0xc7, 0xcd, 0xd4, 0xdd, 0xe6, 0xf1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 0xc5, 0xc2, 0xc1, 0xc0, 0xc1, 0xc2, 0xc5, 0xc9, 
+0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf9, 0xef, 0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 0xb2, 0xb1, 0xb0, 0xb1, 0xb2, 0xb5, 
+0xb9, 0xbe, 0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf9, 0xed, 0xe2, 0xd8, 0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 0xa6, 0xa3, 0xa1, 0xa0, 0xa1, 0xa3, 
+0xa6, 0xaa, 0xaf, 0xb6, 0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 0xb8, 0xaf, 0xa8, 0xa1, 0x9b, 0x96, 0x93, 0x91, 0x90, 0x91, 
+0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 0xb8, 0xc2, 0xcc, 0xd7, 0xe2, 0xee, 0xfa, 0xff, 0xff, 0xff, 
+0xfd, 0xf0, 0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa2, 0x99, 0x92, 0x8c, 0x87, 0x83, 0x81, 0x80, 
+0x81, 0x83, 0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 0xb5, 0xc0, 0xcb, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 
+0xff, 0xf4, 0xe7, 0xda, 0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 0x8c, 0x84, 0x7d, 0x77, 0x73, 0x71, 
+0x70, 0x71, 0x73, 0x77, 0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 0xb5, 0xc1, 0xcd, 0xda, 0xe7, 0xf4, 
+0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 0xb6, 0xaa, 0x9e, 0x93, 0x88, 0x7e, 0x76, 0x6e, 0x68, 0x64, 
+0x61, 0x60, 0x61, 0x64, 0x68, 0x6e, 0x76, 0x7e, 0x88, 0x93, 0x9e, 0xaa, 0xb6, 0xc3, 0xd1, 0xde, 
+0xec, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 0xa0, 0x93, 0x87, 0x7c, 0x72, 0x68, 0x60, 0x59, 
+0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 0x60, 0x68, 0x72, 0x7c, 0x87, 0x93, 0xa0, 0xad, 0xba, 0xc8, 
+0xd6, 0xe4, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 
+0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 0x5b, 0x66, 0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 
+0xc1, 0xcf, 0xde, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 0x8f, 0x81, 0x73, 0x66, 0x5a, 0x4f, 
+0x45, 0x3d, 0x44, 0x48, 0x4a, 0x48, 0x44, 0x3d, 0x45, 0x4f, 0x5a, 0x66, 0x73, 0x81, 0x8f, 0x9d, 
+0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x79, 0x6b, 0x5d, 0x50, 
+0x44, 0x41, 0x4b, 0x53, 0x58, 0x5a, 0x58, 0x53, 0x4b, 0x41, 0x44, 0x50, 0x5d, 0x6b, 0x79, 0x87, 
+0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 
+0x47, 0x40, 0x4d, 0x58, 0x61, 0x67, 0x6a, 0x67, 0x61, 0x58, 0x4d, 0x40, 0x47, 0x55, 0x64, 0x73, 
+0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 
+0x4f, 0x40, 0x48, 0x56, 0x63, 0x6e, 0x77, 0x7a, 0x77, 0x6e, 0x63, 0x56, 0x48, 0x40, 0x4f, 0x5e, 
+0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 
+0x5a, 0x4b, 0x3f, 0x4e, 0x5d, 0x6c, 0x7a, 0x84, 0x88, 0x83, 0x79, 0x6c, 0x5d, 0x4e, 0x3f, 0x4b, 
+0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 
+0x68, 0x58, 0x48, 0x41, 0x51, 0x61, 0x71, 0x80, 0x8c, 0x92, 0x88, 0x7c, 0x6e, 0x60, 0x51, 0x41, 
+0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 
+0x79, 0x69, 0x59, 0x4b, 0x46, 0x53, 0x62, 0x72, 0x81, 0x8b, 0x91, 0x84, 0x78, 0x6b, 0x5e, 0x51, 
+0x41, 0x48, 0x58, 0x68, 0x77, 0x87, 0x97, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xca, 0xba, 0xab, 0x9b, 
+0x8c, 0x7d, 0x6e, 0x61, 0x57, 0x55, 0x5d, 0x69, 0x77, 0x82, 0x8a, 0x8a, 0x7d, 0x70, 0x64, 0x58, 
+0x4c, 0x3e, 0x4a, 0x59, 0x68, 0x77, 0x87, 0x96, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xce, 0xbe, 0xaf, 
+0xa0, 0x92, 0x84, 0x78, 0x6d, 0x66, 0x65, 0x6a, 0x73, 0x7d, 0x85, 0x89, 0x84, 0x77, 0x6a, 0x5e, 
+0x54, 0x49, 0x43, 0x4c, 0x5b, 0x69, 0x78, 0x87, 0x96, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xd3, 0xc4, 
+0xb6, 0xa8, 0x9b, 0x8e, 0x84, 0x7b, 0x76, 0x75, 0x79, 0x7f, 0x85, 0x88, 0x89, 0x80, 0x72, 0x65, 
+0x5a, 0x51, 0x4c, 0x4c, 0x52, 0x5d, 0x6b, 0x79, 0x88, 0x98, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xda, 
+0xcb, 0xbe, 0xb1, 0xa5, 0x9a, 0x91, 0x8a, 0x86, 0x85, 0x87, 0x89, 0x8b, 0x8b, 0x88, 0x7d, 0x6e, 
+0x61, 0x55, 0x4e, 0x4c, 0x50, 0x57, 0x62, 0x6e, 0x7c, 0x8b, 0x99, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 
+0xe1, 0xd4, 0xc7, 0xbc, 0xb1, 0xa7, 0x9f, 0x99, 0x95, 0x93, 0x92, 0x92, 0x90, 0x8d, 0x87, 0x7a, 
+0x6b, 0x5e, 0x50, 0x46, 0x49, 0x51, 0x5b, 0x66, 0x73, 0x80, 0x8e, 0x9d, 0xbb, 0xc9, 0xd8, 0xff, 
+0xff, 0xeb, 0xde, 0xd2, 0xc7, 0xbd, 0xb4, 0xad, 0xa7, 0xa2, 0x9e, 0x9b, 0x98, 0x93, 0x8d, 0x84, 
+0x76, 0x67, 0x5a, 0x4c, 0x3e, 0x48, 0x54, 0x60, 0x6c, 0x79, 0x86, 0x93, 0xa1, 0xc3, 0xd0, 0xde, 
+0xff, 0xff, 0xf4, 0xe9, 0xdd, 0xd3, 0xc9, 0xc1, 0xb9, 0xb2, 0xac, 0xa7, 0xa1, 0x9b, 0x94, 0x8a, 
+0x7e, 0x70, 0x62, 0x54, 0x45, 0x43, 0x50, 0x5c, 0x67, 0x73, 0x80, 0x8c, 0x9a, 0xa7, 0xcc, 0xd9, 
+0xe6, 0xff, 0xff, 0xfe, 0xf2, 0xe7, 0xdd, 0xd3, 0xca, 0xc2, 0xba, 0xb3, 0xac, 0xa4, 0x9c, 0x92, 
+0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x65, 0x71, 0x7c, 0x88, 0x94, 0xa1, 0xae, 0xd6, 
+0xe2, 0xef, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xe5, 0xdb, 0xd2, 0xc9, 0xc0, 0xb7, 0xae, 0xa4, 0x99, 
+0x8d, 0x7f, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x79, 0x85, 0x91, 0x9d, 0xaa, 0xb6, 
+0xe2, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xeb, 0xe1, 0xd6, 0xcc, 0xc2, 0xb8, 0xad, 0xa1, 
+0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x66, 0x74, 0x82, 0x8e, 0x9b, 0xa7, 0xb3, 
+0xbf, 0xee, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xd4, 0xc6, 0xb8, 0xaa, 
+0x9b, 0x8d, 0x7f, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x7c, 0x8a, 0x98, 0xa7, 0xb5, 
+0xc3, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xea, 0xdc, 0xcd, 0xbf, 0xb1, 
+0xa2, 0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x83, 0x91, 0xa0, 0xae, 
+0xbc, 0xca, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xd4, 0xc6, 0xb8, 
+0xaa, 0x9b, 0x8d, 0x7f, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x7c, 0x8a, 0x98, 0xa7, 
+0xb5, 0xc3, 0xd2, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xea, 0xdc, 0xcd, 0xbf, 
+0xb1, 0xa2, 0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x83, 0x91, 0xa0, 
+0xae, 0xbc, 0xca, 0xd9, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xd4, 0xc6, 
+0xb8, 0xaa, 0x9b, 0x8d, 0x7f, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x7c, 0x8a, 0x98, 
+0xa7, 0xb5, 0xc3, 0xd2, 0xe0, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xea, 0xdc, 0xcd, 
+0xbf, 0xb1, 0xa2, 0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x83, 0x91, 
+0xa0, 0xae, 0xbc, 0xca, 0xd9, 0xe7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe3, 0xd4, 
+0xc6, 0xb8, 0xaa, 0x9b, 0x8d, 0x7f, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x7c, 0x8a, 
+0x98, 0xa7, 0xb5, 0xc3, 0xd2, 0xe0, 0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xea, 0xdc, 
+0xcd, 0xbf, 0xb1, 0xa2, 0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x83, 
+0x91, 0xa0, 0xae, 0xbc, 0xca, 0xd9, 0xe7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd1, 
+0xc4, 0xb8, 0xac, 0xa0, 0x94, 0x88, 0x7c, 0x70, 0x62, 0x54, 0x45, 0x43, 0x51, 0x5f, 0x6d, 0x7a, 
+0x85, 0x90, 0x99, 0xa1, 0xa8, 0xb0, 0xb8, 0xc0, 0xca, 0xd4, 0xe1, 0xec, 0xf8, 0xff, 0xff, 0xd6, 
+0xc8, 0xbb, 0xaf, 0xa2, 0x96, 0x8a, 0x7f, 0x74, 0x68, 0x5b, 0x4d, 0x3e, 0x4a, 0x58, 0x65, 0x71, 
+0x7c, 0x86, 0x8e, 0x96, 0x9c, 0xa1, 0xa7, 0xae, 0xb7, 0xc0, 0xca, 0xd6, 0xe1, 0xed, 0xff, 0xff, 
+0xcd, 0xc0, 0xb2, 0xa5, 0x99, 0x8c, 0x81, 0x75, 0x6a, 0x5f, 0x53, 0x45, 0x43, 0x50, 0x5d, 0x68, 
+0x72, 0x7b, 0x83, 0x8a, 0x8f, 0x94, 0x97, 0x9c, 0xa3, 0xab, 0xb4, 0xbf, 0xcb, 0xd7, 0xe4, 0xff, 
+0xff, 0xc6, 0xb8, 0xaa, 0x9c, 0x8f, 0x83, 0x77, 0x6b, 0x61, 0x56, 0x4a, 0x3e, 0x48, 0x54, 0x5e, 
+0x68, 0x70, 0x77, 0x7d, 0x82, 0x86, 0x88, 0x8a, 0x8e, 0x95, 0x9e, 0xa8, 0xb4, 0xc1, 0xce, 0xdc, 
+0xff, 0xff, 0xbf, 0xb0, 0xa2, 0x94, 0x86, 0x79, 0x6d, 0x61, 0x57, 0x4d, 0x42, 0x3f, 0x4a, 0x54, 
+0x5d, 0x65, 0x6b, 0x70, 0x74, 0x77, 0x79, 0x7a, 0x7b, 0x7f, 0x87, 0x92, 0x9e, 0xaa, 0xb8, 0xc6, 
+0xd5, 0xff, 0xff, 0xb9, 0xaa, 0x9b, 0x8c, 0x7e, 0x70, 0x63, 0x57, 0x4c, 0x43, 0x39, 0x41, 0x4a, 
+0x52, 0x59, 0x5e, 0x63, 0x66, 0x68, 0x6a, 0x6a, 0x6a, 0x6b, 0x71, 0x7b, 0x87, 0x94, 0xa2, 0xb1, 
+0xc0, 0xcf, 0xff, 0xff, 0xb5, 0xa5, 0x96, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x42, 0x38, 0x37, 0x3f, 
+0x46, 0x4c, 0x51, 0x55, 0x58, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x64, 0x71, 0x7f, 0x8d, 0x9c, 
+0xac, 0xbb, 0xcb, 0xff, 0xff, 0xb3, 0xa3, 0x93, 0x83, 0x73, 0x63, 0x54, 0x45, 0x37, 0x2e, 0x34, 
+0x3a, 0x40, 0x44, 0x47, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x5b, 0x6a, 0x79, 0x89, 
+0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x32, 0x2b, 
+0x32, 0x37, 0x3b, 0x3e, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48, 0x58, 0x68, 0x78, 
+0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xb3, 0xa3, 0x94, 0x84, 0x74, 0x65, 0x56, 0x48, 0x3d, 
+0x3a, 0x3e, 0x44, 0x48, 0x4c, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x5e, 0x6c, 
+0x7b, 0x8a, 0x9a, 0xaa, 0xb9, 0xc9, 0xff, 0xff, 0xb6, 0xa7, 0x98, 0x89, 0x7a, 0x6c, 0x5f, 0x53, 
+0x4c, 0x4a, 0x4d, 0x51, 0x56, 0x5a, 0x5d, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x69, 
+0x75, 0x82, 0x90, 0x9f, 0xae, 0xbd, 0xcc, 0xff, 0xff, 0xbb, 0xac, 0x9e, 0x8f, 0x82, 0x75, 0x6a, 
+0x61, 0x5b, 0x5a, 0x5c, 0x60, 0x64, 0x68, 0x6b, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 
+0x77, 0x80, 0x8b, 0x98, 0xa5, 0xb4, 0xc2, 0xd1, 0xff, 0xff, 0xc1, 0xb3, 0xa5, 0x98, 0x8c, 0x80, 
+0x77, 0x6f, 0x6b, 0x6a, 0x6c, 0x6e, 0x72, 0x76, 0x7a, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 
+0x81, 0x85, 0x8d, 0x96, 0xa2, 0xae, 0xbb, 0xc9, 0xd7, 0xff, 0xff, 0xc9, 0xbb, 0xae, 0xa2, 0x97, 
+0x8d, 0x85, 0x7e, 0x7b, 0x7a, 0x7b, 0x7e, 0x81, 0x85, 0x88, 0x8b, 0x8e, 0x8f, 0x90, 0x90, 0x90, 
+0x90, 0x91, 0x94, 0x9b, 0xa3, 0xad, 0xb8, 0xc4, 0xd1, 0xdf, 0xff, 0xff, 0xd2, 0xc5, 0xb9, 0xae, 
+0xa3, 0x9a, 0x93, 0x8e, 0x8b, 0x8a, 0x8b, 0x8d, 0x90, 0x93, 0x97, 0x9a, 0x9d, 0x9f, 0xa0, 0xa0, 
+0xa0, 0xa0, 0xa1, 0xa4, 0xa9, 0xb0, 0xb9, 0xc4, 0xcf, 0xdb, 0xe8, 0xff, 0xff, 0xdb, 0xcf, 0xc4, 
+0xba, 0xb0, 0xa8, 0xa2, 0x9d, 0x9b, 0x9a, 0x9b, 0x9d, 0x9f, 0xa2, 0xa6, 0xa9, 0xac, 0xae, 0xaf, 
+0xb0, 0xb0, 0xb0, 0xb1, 0xb3, 0xb8, 0xbe, 0xc6, 0xd0, 0xda, 0xe5, 0xf1, 0xff, 0xff, 0xe6, 0xdb, 
+0xd0, 0xc7, 0xbe, 0xb7, 0xb1, 0xad, 0xaa, 0xaa, 0xab, 0xac, 0xaf, 0xb2, 0xb5, 0xb8, 0xbb, 0xbd, 
+0xbf, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc7, 0xcd, 0xd4, 0xdd, 0xe6, 0xf1, 0xfc, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfe, 0xf5, 0xec, 0xe4, 0xdd, 0xd6, 0xd0, 0xcb, 0xc7, 0xc4, 0xc2, 0xc0, 0xc0, 0xc1, 
+0xc2, 0xc5, 0xc8, 0xcc, 0xd1, 0xd7, 0xde, 0xe5, 0xed, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfd, 0xf2, 0xe8, 0xde, 0xd6, 0xce, 0xc7, 0xc1, 0xbc, 0xb8, 0xb4, 0xb2, 0xb0, 0xb0, 
+0xb1, 0xb2, 0xb5, 0xb8, 0xbd, 0xc2, 0xc9, 0xd0, 0xd7, 0xe0, 0xe9, 0xf2, 0xfc, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf3, 0xe7, 0xdc, 0xd1, 0xc8, 0xc0, 0xb9, 0xb2, 0xad, 0xa8, 0xa5, 0xa2, 0xa0, 
+0xa0, 0xa1, 0xa2, 0xa5, 0xa9, 0xae, 0xb4, 0xba, 0xc2, 0xca, 0xd2, 0xdc, 0xe6, 0xf0, 0xfb, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xe9, 0xdc, 0xd0, 0xc5, 0xbb, 0xb2, 0xaa, 0xa4, 0x9e, 0x99, 0x95, 0x92, 
+0x90, 0x90, 0x91, 0x93, 0x96, 0x9a, 0x9f, 0xa5, 0xac, 0xb4, 0xbc, 0xc5, 0xcf, 0xda, 0xe5, 0xf0, 
+0xfc, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xd3, 0xc6, 0xba, 0xae, 0xa5, 0x9c, 0x95, 0x8f, 0x89, 0x85, 
+0x82, 0x81, 0x80, 0x81, 0x83, 0x86, 0x8a, 0x90, 0x96, 0x9e, 0xa6, 0xaf, 0xb9, 0xc3, 0xce, 0xd9, 
+0xe5, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xd8, 0xca, 0xbc, 0xaf, 0xa3, 0x98, 0x8e, 0x87, 0x80, 0x7a, 
+0x76, 0x72, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7b, 0x81, 0x88, 0x90, 0x99, 0xa2, 0xac, 0xb7, 0xc3, 
+0xce, 0xdb, 0xe7, 0xf4, 0xff, 0xff, 0xff, 0xd2, 0xc3, 0xb4, 0xa6, 0x99, 0x8c, 0x81, 0x79, 0x71, 
+0x6b, 0x66, 0x63, 0x61, 0x60, 0x61, 0x63, 0x67, 0x6c, 0x73, 0x7a, 0x83, 0x8c, 0x96, 0xa1, 0xac, 
+0xb8, 0xc4, 0xd1, 0xde, 0xeb, 0xf8, 0xff, 0xff, 0xcd, 0xbd, 0xae, 0x9f, 0x91, 0x83, 0x76, 0x6b, 
+0x63, 0x5c, 0x57, 0x53, 0x51, 0x50, 0x51, 0x54, 0x58, 0x5d, 0x64, 0x6c, 0x75, 0x7f, 0x8a, 0x95, 
+0xa1, 0xae, 0xba, 0xc7, 0xd5, 0xe2, 0xf0, 0xff, 0xff, 0xca, 0xba, 0xaa, 0x9a, 0x8b, 0x7c, 0x6d, 
+0x5f, 0x55, 0x4d, 0x48, 0x43, 0x41, 0x40, 0x41, 0x44, 0x49, 0x4f, 0x56, 0x5f, 0x69, 0x73, 0x7f, 
+0x8b, 0x97, 0xa4, 0xb1, 0xbf, 0xcc, 0xda, 0xe9, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 
+0x68, 0x58, 0x49, 0x3f, 0x41, 0x46, 0x49, 0x4a, 0x48, 0x45, 0x40, 0x41, 0x49, 0x52, 0x5d, 0x68, 
+0x74, 0x81, 0x8e, 0x9b, 0xa9, 0xb7, 0xc5, 0xd3, 0xe2, 0xff, 0xff, 0xc8, 0xb8, 0xa9, 0x99, 0x89, 
+0x79, 0x69, 0x5a, 0x4c, 0x49, 0x50, 0x55, 0x59, 0x5a, 0x58, 0x54, 0x4f, 0x47, 0x3e, 0x46, 0x52, 
+0x5e, 0x6a, 0x77, 0x85, 0x93, 0xa1, 0xaf, 0xbe, 0xcd, 0xdc, 0xff, 0xff, 0xcb, 0xbb, 0xab, 0x9c, 
+0x8d, 0x7e, 0x70, 0x63, 0x5a, 0x58, 0x5e, 0x65, 0x68, 0x6a, 0x68, 0x64, 0x5d, 0x54, 0x4a, 0x3f, 
+0x47, 0x54, 0x61, 0x6f, 0x7d, 0x8c, 0x9a, 0xa9, 0xb8, 0xc7, 0xd6, 0xff, 0xff, 0xce, 0xbf, 0xb0, 
+0xa2, 0x93, 0x86, 0x7a, 0x70, 0x69, 0x68, 0x6c, 0x74, 0x78, 0x7a, 0x78, 0x72, 0x6a, 0x61, 0x55, 
+0x49, 0x3e, 0x4b, 0x5a, 0x68, 0x77, 0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd2, 0xff, 0xff, 0xd4, 0xc5, 
+0xb7, 0xa9, 0x9c, 0x90, 0x86, 0x7e, 0x79, 0x78, 0x7b, 0x82, 0x88, 0x8a, 0x87, 0x81, 0x77, 0x6c, 
+0x5f, 0x52, 0x44, 0x44, 0x53, 0x62, 0x71, 0x80, 0x90, 0x9f, 0xaf, 0xbe, 0xce, 0xff, 0xff, 0xdb, 
+0xcd, 0xc0, 0xb3, 0xa7, 0x9c, 0x93, 0x8c, 0x88, 0x88, 0x8a, 0x90, 0x97, 0x9a, 0x96, 0x8e, 0x82, 
+0x76, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5d, 0x6d, 0x7c, 0x8c, 0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 
+0xe3, 0xd6, 0xc9, 0xbd, 0xb3, 0xa9, 0xa1, 0x9c, 0x98, 0x98, 0x9a, 0x9f, 0xa6, 0xaa, 0xa4, 0x99, 
+0x8b, 0x7d, 0x6e, 0x5e, 0x4f, 0x3f, 0x4a, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 
+0xff, 0xec, 0xe0, 0xd4, 0xc9, 0xbf, 0xb7, 0xb0, 0xab, 0xa8, 0xa8, 0xaa, 0xae, 0xb4, 0xb9, 0xaf, 
+0xa0, 0x91, 0x81, 0x71, 0x61, 0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 
+0xff, 0xff, 0xf6, 0xea, 0xdf, 0xd5, 0xcb, 0xc3, 0xbc, 0xb6, 0xb2, 0xaf, 0xad, 0xad, 0xac, 0xa9, 
+0xa1, 0x98, 0x8d, 0x80, 0x71, 0x61, 0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 
+0xc8, 0xff, 0xff, 0xff, 0xf4, 0xe9, 0xde, 0xd5, 0xcc, 0xc5, 0xbe, 0xb8, 0xb4, 0xab, 0xa3, 0x9d, 
+0x99, 0x95, 0x8e, 0x85, 0x7b, 0x6e, 0x5f, 0x4f, 0x40, 0x4a, 0x5a, 0x69, 0x79, 0x89, 0x99, 0xa9, 
+0xb9, 0xc9, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0xe6, 0xdc, 0xd3, 0xca, 0xbf, 0xb3, 0xa7, 0x9d, 0x95, 
+0x8e, 0x89, 0x86, 0x81, 0x7b, 0x72, 0x68, 0x5a, 0x4b, 0x3e, 0x4d, 0x5c, 0x6c, 0x7c, 0x8b, 0x9b, 
+0xab, 0xbb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xeb, 0xdf, 0xd1, 0xc3, 0xb5, 0xa8, 0x9c, 0x91, 
+0x87, 0x7f, 0x7a, 0x76, 0x73, 0x6e, 0x68, 0x5f, 0x53, 0x45, 0x43, 0x52, 0x61, 0x70, 0x7f, 0x8f, 
+0x9e, 0xae, 0xbd, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe7, 0xd8, 0xca, 0xbb, 0xad, 0x9f, 0x92, 
+0x85, 0x7a, 0x71, 0x6a, 0x67, 0x64, 0x61, 0x5b, 0x54, 0x4a, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x84, 
+0x92, 0xa1, 0xb0, 0xbf, 0xce, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe3, 0xd3, 0xc4, 0xb5, 0xa6, 0x97, 
+0x89, 0x7b, 0x6f, 0x64, 0x5b, 0x57, 0x55, 0x52, 0x4e, 0x48, 0x40, 0x44, 0x51, 0x5e, 0x6b, 0x79, 
+0x87, 0x95, 0xa4, 0xb2, 0xc1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xd0, 0xc0, 0xb0, 0xa1, 
+0x91, 0x82, 0x74, 0x65, 0x58, 0x4d, 0x47, 0x46, 0x44, 0x41, 0x3c, 0x40, 0x4b, 0x56, 0x63, 0x6f, 
+0x7c, 0x8a, 0x97, 0xa5, 0xb4, 0xc2, 0xd0, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xdd, 0xcd, 0xbd, 0xae, 
+0x9e, 0x8e, 0x7e, 0x6e, 0x5f, 0x50, 0x42, 0x38, 0x36, 0x35, 0x34, 0x3c, 0x45, 0x4f, 0x5a, 0x66, 
+0x72, 0x7e, 0x8c, 0x99, 0xa7, 0xb5, 0xc3, 0xd1, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xdd, 0xcd, 0xbd, 
+0xad, 0x9d, 0x8d, 0x7d, 0x6d, 0x5d, 0x4d, 0x3d, 0x2d, 0x2b, 0x30, 0x36, 0x3e, 0x46, 0x50, 0x5b, 
+0x67, 0x73, 0x7f, 0x8c, 0x99, 0xa7, 0xb5, 0xc3, 0xd1, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xdd, 0xcd, 
+0xbd, 0xae, 0x9e, 0x8e, 0x7e, 0x6e, 0x5f, 0x50, 0x42, 0x38, 0x36, 0x35, 0x34, 0x3c, 0x45, 0x4f, 
+0x5a, 0x66, 0x72, 0x7e, 0x8c, 0x99, 0xa7, 0xb5, 0xc3, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 
+0xd0, 0xc0, 0xb0, 0xa1, 0x91, 0x82, 0x74, 0x65, 0x58, 0x4d, 0x47, 0x46, 0x44, 0x41, 0x3c, 0x40, 
+0x4b, 0x56, 0x63, 0x6f, 0x7c, 0x8a, 0x97, 0xa5, 0xb4, 0xc2, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xf2, 
+0xe3, 0xd3, 0xc4, 0xb5, 0xa6, 0x97, 0x89, 0x7b, 0x6f, 0x64, 0x5b, 0x57, 0x55, 0x52, 0x4e, 0x48, 
+0x40, 0x44, 0x51, 0x5e, 0x6b, 0x79, 0x87, 0x95, 0xa4, 0xb2, 0xc1, 0xcf, 0xff, 0xff, 0xff, 0xff, 
+0xf7, 0xe7, 0xd8, 0xca, 0xbb, 0xad, 0x9f, 0x92, 0x85, 0x7a, 0x71, 0x6a, 0x67, 0x64, 0x61, 0x5b, 
+0x54, 0x4a, 0x3e, 0x4a, 0x58, 0x66, 0x75, 0x84, 0x92, 0xa1, 0xb0, 0xbf, 0xce, 0xff, 0xff, 0xff, 
+0xff, 0xf6, 0xeb, 0xdf, 0xd1, 0xc3, 0xb5, 0xa8, 0x9c, 0x91, 0x87, 0x7f, 0x7a, 0x76, 0x73, 0x6e, 
+0x68, 0x5f, 0x53, 0x45, 0x43, 0x52, 0x61, 0x70, 0x7f, 0x8f, 0x9e, 0xae, 0xbd, 0xcc, 0xff, 0xff, 
+0xff, 0xfb, 0xf0, 0xe6, 0xdc, 0xd3, 0xca, 0xbf, 0xb3, 0xa7, 0x9d, 0x95, 0x8e, 0x89, 0x86, 0x81, 
+0x7b, 0x72, 0x68, 0x5a, 0x4b, 0x3e, 0x4d, 0x5c, 0x6c, 0x7c, 0x8b, 0x9b, 0xab, 0xbb, 0xcb, 0xff, 
+0xff, 0xff, 0xf4, 0xe9, 0xde, 0xd5, 0xcc, 0xc5, 0xbe, 0xb8, 0xb4, 0xab, 0xa3, 0x9d, 0x99, 0x95, 
+0x8e, 0x85, 0x7b, 0x6e, 0x5f, 0x4f, 0x40, 0x4a, 0x5a, 0x69, 0x79, 0x89, 0x99, 0xa9, 0xb9, 0xc9, 
+0xff, 0xff, 0xf6, 0xea, 0xdf, 0xd5, 0xcb, 0xc3, 0xbc, 0xb6, 0xb2, 0xaf, 0xad, 0xad, 0xac, 0xa9, 
+0xa1, 0x98, 0x8d, 0x80, 0x71, 0x61, 0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 
+0xc8, 0xff, 0xff, 0xec, 0xe0, 0xd4, 0xc9, 0xbf, 0xb7, 0xb0, 0xab, 0xa8, 0xa8, 0xaa, 0xae, 0xb4, 
+0xb9, 0xaf, 0xa0, 0x91, 0x81, 0x71, 0x61, 0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xe3, 0xd6, 0xc9, 0xbd, 0xb3, 0xa9, 0xa1, 0x9c, 0x98, 0x98, 0x9a, 0x9f, 
+0xa6, 0xaa, 0xa4, 0x99, 0x8b, 0x7d, 0x6e, 0x5e, 0x4f, 0x3f, 0x4a, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 
+0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xdb, 0xcd, 0xc0, 0xb3, 0xa7, 0x9c, 0x93, 0x8c, 0x88, 0x88, 0x8a, 
+0x90, 0x97, 0x9a, 0x96, 0x8e, 0x82, 0x76, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5d, 0x6d, 0x7c, 0x8c, 
+0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 0xd4, 0xc5, 0xb7, 0xa9, 0x9c, 0x90, 0x86, 0x7e, 0x79, 0x78, 
+0x7b, 0x82, 0x88, 0x8a, 0x87, 0x81, 0x77, 0x6c, 0x5f, 0x52, 0x44, 0x44, 0x53, 0x62, 0x71, 0x80, 
+0x90, 0x9f, 0xaf, 0xbe, 0xce, 0xff, 0xff, 0xce, 0xbf, 0xb0, 0xa2, 0x93, 0x86, 0x7a, 0x70, 0x69, 
+0x68, 0x6c, 0x74, 0x78, 0x7a, 0x78, 0x72, 0x6a, 0x61, 0x55, 0x49, 0x3e, 0x4b, 0x5a, 0x68, 0x77, 
+0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd2, 0xff, 0xff, 0xcb, 0xbb, 0xab, 0x9c, 0x8d, 0x7e, 0x70, 0x63, 
+0x5a, 0x58, 0x5e, 0x65, 0x68, 0x6a, 0x68, 0x64, 0x5d, 0x54, 0x4a, 0x3f, 0x47, 0x54, 0x61, 0x6f, 
+0x7d, 0x8c, 0x9a, 0xa9, 0xb8, 0xc7, 0xd6, 0xff, 0xff, 0xc8, 0xb8, 0xa9, 0x99, 0x89, 0x79, 0x69, 
+0x5a, 0x4c, 0x49, 0x50, 0x55, 0x59, 0x5a, 0x58, 0x54, 0x4f, 0x47, 0x3e, 0x46, 0x52, 0x5e, 0x6a, 
+0x77, 0x85, 0x93, 0xa1, 0xaf, 0xbe, 0xcd, 0xdc, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 
+0x68, 0x58, 0x49, 0x3f, 0x41, 0x46, 0x49, 0x4a, 0x48, 0x45, 0x40, 0x41, 0x49, 0x52, 0x5d, 0x68, 
+0x74, 0x81, 0x8e, 0x9b, 0xa9, 0xb7, 0xc5, 0xd3, 0xe2, 0xff, 0xff, 0xca, 0xba, 0xaa, 0x9a, 0x8b, 
+0x7c, 0x6d, 0x5f, 0x55, 0x4d, 0x48, 0x43, 0x41, 0x40, 0x41, 0x44, 0x49, 0x4f, 0x56, 0x5f, 0x69, 
+0x73, 0x7f, 0x8b, 0x97, 0xa4, 0xb1, 0xbf, 0xcc, 0xda, 0xe9, 0xff, 0xff, 0xcd, 0xbd, 0xae, 0x9f, 
+0x91, 0x83, 0x76, 0x6b, 0x63, 0x5c, 0x57, 0x53, 0x51, 0x50, 0x51, 0x54, 0x58, 0x5d, 0x64, 0x6c, 
+0x75, 0x7f, 0x8a, 0x95, 0xa1, 0xae, 0xba, 0xc7, 0xd5, 0xe2, 0xf0, 0xff, 0xff, 0xd2, 0xc3, 0xb4, 
+0xa6, 0x99, 0x8c, 0x81, 0x79, 0x71, 0x6b, 0x66, 0x63, 0x61, 0x60, 0x61, 0x63, 0x67, 0x6c, 0x73, 
+0x7a, 0x83, 0x8c, 0x96, 0xa1, 0xac, 0xb8, 0xc4, 0xd1, 0xde, 0xeb, 0xf8, 0xff, 0xff, 0xd8, 0xca, 
+0xbc, 0xaf, 0xa3, 0x98, 0x8e, 0x87, 0x80, 0x7a, 0x76, 0x72, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7b, 
+0x81, 0x88, 0x90, 0x99, 0xa2, 0xac, 0xb7, 0xc3, 0xce, 0xdb, 0xe7, 0xf4, 0xff, 0xff, 0xff, 0xe0, 
+0xd3, 0xc6, 0xba, 0xae, 0xa5, 0x9c, 0x95, 0x8f, 0x89, 0x85, 0x82, 0x81, 0x80, 0x81, 0x83, 0x86, 
+0x8a, 0x90, 0x96, 0x9e, 0xa6, 0xaf, 0xb9, 0xc3, 0xce, 0xd9, 0xe5, 0xf1, 0xfe, 0xff, 0xff, 0xff, 
+0xe9, 0xdc, 0xd0, 0xc5, 0xbb, 0xb2, 0xaa, 0xa4, 0x9e, 0x99, 0x95, 0x92, 0x90, 0x90, 0x91, 0x93, 
+0x96, 0x9a, 0x9f, 0xa5, 0xac, 0xb4, 0xbc, 0xc5, 0xcf, 0xda, 0xe5, 0xf0, 0xfc, 0xff, 0xff, 0xff, 
+0xff, 0xf3, 0xe7, 0xdc, 0xd1, 0xc8, 0xc0, 0xb9, 0xb2, 0xad, 0xa8, 0xa5, 0xa2, 0xa0, 0xa0, 0xa1, 
+0xa2, 0xa5, 0xa9, 0xae, 0xb4, 0xba, 0xc2, 0xca, 0xd2, 0xdc, 0xe6, 0xf0, 0xfb, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfd, 0xf2, 0xe8, 0xde, 0xd6, 0xce, 0xc7, 0xc1, 0xbc, 0xb8, 0xb4, 0xb2, 0xb0, 0xb0, 
+0xb1, 0xb2, 0xb5, 0xb8, 0xbd, 0xc2, 0xc9, 0xd0, 0xd7, 0xe0, 0xe9, 0xf2, 0xfc, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xec, 0xe4, 0xdd, 0xd6, 0xd0, 0xcb, 0xc7, 0xc4, 0xc2, 0xc0, 
+0xc0, 0xc1, 0xc2, 0xc5, 0xc8, 0xcc, 0xd1, 0xd7, 0xde, 0xe5, 0xed, 0xf6, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe9, 0xdf, 
+0xd6, 0xcf, 0xc9, 0xc4, 0xc1, 0xc0, 0xc1, 0xc4, 0xc9, 0xcf, 0xd6, 0xdf, 0xe9, 0xf4, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe9, 0xdd, 
+0xd3, 0xc9, 0xc1, 0xba, 0xb4, 0xb1, 0xb0, 0xb1, 0xb4, 0xba, 0xc1, 0xc9, 0xd3, 0xdd, 0xe9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xec, 0xdf, 
+0xd2, 0xc7, 0xbc, 0xb3, 0xab, 0xa5, 0xa1, 0xa0, 0xa1, 0xa5, 0xab, 0xb3, 0xbc, 0xc7, 0xd2, 0xdf, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe3, 
+0xd5, 0xc8, 0xbc, 0xb0, 0xa6, 0x9d, 0x96, 0x92, 0x90, 0x92, 0x96, 0x9d, 0xa6, 0xb0, 0xbc, 0xc8, 
+0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xea, 
+0xdc, 0xcd, 0xbf, 0xb2, 0xa5, 0x9a, 0x8f, 0x87, 0x82, 0x80, 0x82, 0x87, 0x8f, 0x9a, 0xa5, 0xb2, 
+0xbf, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 
+0xe5, 0xd6, 0xc7, 0xb8, 0xaa, 0x9c, 0x8f, 0x83, 0x79, 0x72, 0x70, 0x72, 0x79, 0x83, 0x8f, 0x9c, 
+0xaa, 0xb8, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xef, 0xe0, 0xd1, 0xc2, 0xb2, 0xa3, 0x94, 0x86, 0x78, 0x6c, 0x63, 0x60, 0x63, 0x6c, 0x78, 0x86, 
+0x94, 0xa3, 0xb2, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfa, 0xeb, 0xdc, 0xcc, 0xbd, 0xae, 0x9e, 0x8f, 0x80, 0x70, 0x62, 0x56, 0x50, 0x56, 0x62, 0x70, 
+0x80, 0x8f, 0x9f, 0xae, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf6, 0xe6, 0xd7, 0xc8, 0xb8, 0xa9, 0x9a, 0x8a, 0x7b, 0x6c, 0x5c, 0x4d, 0x40, 0x4d, 0x5d, 
+0x6d, 0x7d, 0x8d, 0x9d, 0xad, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf1, 0xe2, 0xd2, 0xc3, 0xb4, 0xa4, 0x95, 0x86, 0x76, 0x67, 0x58, 0x48, 0x40, 0x50, 
+0x5f, 0x6e, 0x7e, 0x8e, 0x9e, 0xae, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfc, 0xec, 0xdd, 0xce, 0xbe, 0xaf, 0xa0, 0x90, 0x81, 0x72, 0x62, 0x53, 0x44, 0x45, 
+0x54, 0x64, 0x73, 0x82, 0x92, 0xa1, 0xb0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf7, 0xe8, 0xd9, 0xc9, 0xba, 0xab, 0x9b, 0x8c, 0x7d, 0x6d, 0x5e, 0x4f, 0x3f, 
+0x4a, 0x59, 0x68, 0x78, 0x87, 0x96, 0xa6, 0xb5, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf3, 0xe3, 0xd4, 0xc5, 0xb5, 0xa6, 0x97, 0x87, 0x78, 0x69, 0x59, 0x4a, 
+0x3f, 0x4e, 0x5e, 0x6d, 0x7c, 0x8c, 0x9b, 0xaa, 0xba, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xdf, 0xcf, 0xc0, 0xb1, 0xa1, 0x92, 0x83, 0x73, 0x64, 0x55, 
+0x45, 0x44, 0x53, 0x62, 0x72, 0x81, 0x90, 0x9f, 0xaf, 0xbe, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe9, 0xda, 0xcb, 0xbb, 0xac, 0x9d, 0x8d, 0x7e, 0x6f, 0x5f, 
+0x50, 0x41, 0x48, 0x57, 0x67, 0x76, 0x85, 0x95, 0xa4, 0xb3, 0xc3, 0xd2, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe5, 0xd5, 0xc6, 0xb7, 0xa7, 0x98, 0x89, 0x79, 0x6a, 
+0x5b, 0x4c, 0x3d, 0x4d, 0x5c, 0x6b, 0x7b, 0x8a, 0x99, 0xa9, 0xb8, 0xc7, 0xd7, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe0, 0xd1, 0xc2, 0xb2, 0xa3, 0x94, 0x84, 0x75, 
+0x66, 0x56, 0x47, 0x42, 0x51, 0x61, 0x70, 0x7f, 0x8f, 0x9e, 0xad, 0xbd, 0xcc, 0xdb, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xeb, 0xdc, 0xcc, 0xbd, 0xae, 0x9e, 0x8f, 0x80, 
+0x70, 0x61, 0x52, 0x42, 0x47, 0x56, 0x65, 0x75, 0x83, 0x90, 0x99, 0xa2, 0xa9, 0xb0, 0xb7, 0xc4, 
+0xca, 0xd1, 0xda, 0xe4, 0xee, 0xfa, 0xff, 0xff, 0xf6, 0xe6, 0xd7, 0xc8, 0xb8, 0xa9, 0x9a, 0x8a, 
+0x7b, 0x6c, 0x5c, 0x4d, 0x3e, 0x4b, 0x5b, 0x6a, 0x79, 0x86, 0x8f, 0x97, 0x9c, 0xa2, 0xa7, 0xac, 
+0xb5, 0xbb, 0xc4, 0xcd, 0xd8, 0xe3, 0xef, 0xff, 0xff, 0xf1, 0xe2, 0xd2, 0xc3, 0xb4, 0xa4, 0x95, 
+0x86, 0x76, 0x67, 0x58, 0x48, 0x40, 0x50, 0x5f, 0x6e, 0x7c, 0x86, 0x8d, 0x91, 0x95, 0x98, 0x9b, 
+0xa0, 0xa6, 0xae, 0xb7, 0xc1, 0xcd, 0xd9, 0xe6, 0xff, 0xff, 0xec, 0xdd, 0xce, 0xbe, 0xaf, 0xa0, 
+0x90, 0x81, 0x72, 0x62, 0x53, 0x44, 0x45, 0x54, 0x64, 0x73, 0x7e, 0x85, 0x89, 0x8a, 0x8b, 0x8c, 
+0x8d, 0x91, 0x98, 0xa0, 0xab, 0xb6, 0xc3, 0xd0, 0xdd, 0xff, 0xff, 0xdb, 0xcd, 0xbf, 0xb2, 0xa4, 
+0x97, 0x89, 0x7c, 0x6d, 0x5e, 0x4f, 0x3f, 0x4a, 0x59, 0x68, 0x75, 0x7c, 0x7f, 0x7f, 0x7d, 0x7b, 
+0x7a, 0x7b, 0x80, 0x88, 0x91, 0x9c, 0xa8, 0xb4, 0xc1, 0xcf, 0xff, 0xff, 0xd4, 0xc6, 0xb8, 0xab, 
+0x9d, 0x90, 0x83, 0x76, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5e, 0x6b, 0x75, 0x79, 0x79, 0x77, 0x72, 
+0x6d, 0x6b, 0x6c, 0x72, 0x7b, 0x86, 0x92, 0x9e, 0xac, 0xb9, 0xc8, 0xff, 0xff, 0xcd, 0xbf, 0xb1, 
+0xa3, 0x96, 0x89, 0x7c, 0x6f, 0x62, 0x54, 0x45, 0x44, 0x53, 0x60, 0x6c, 0x73, 0x75, 0x73, 0x6e, 
+0x67, 0x60, 0x5c, 0x5d, 0x65, 0x6f, 0x7c, 0x89, 0x96, 0xa4, 0xb3, 0xc1, 0xff, 0xff, 0xc6, 0xb8, 
+0xaa, 0x9c, 0x8e, 0x81, 0x74, 0x68, 0x5b, 0x4e, 0x41, 0x47, 0x55, 0x61, 0x6a, 0x6f, 0x70, 0x6d, 
+0x67, 0x5e, 0x54, 0x4c, 0x4f, 0x59, 0x66, 0x74, 0x82, 0x90, 0x9f, 0xae, 0xbd, 0xff, 0xff, 0xc0, 
+0xb2, 0xa3, 0x95, 0x87, 0x79, 0x6c, 0x60, 0x54, 0x48, 0x3c, 0x49, 0x54, 0x5e, 0x66, 0x6a, 0x6a, 
+0x66, 0x60, 0x57, 0x4c, 0x40, 0x45, 0x53, 0x61, 0x6f, 0x7d, 0x8c, 0x9b, 0xaa, 0xb9, 0xff, 0xff, 
+0xbb, 0xac, 0x9d, 0x8e, 0x80, 0x72, 0x64, 0x57, 0x4c, 0x41, 0x3d, 0x48, 0x52, 0x5a, 0x60, 0x63, 
+0x62, 0x5e, 0x58, 0x4f, 0x45, 0x3a, 0x44, 0x51, 0x5e, 0x6c, 0x7a, 0x89, 0x98, 0xa7, 0xb7, 0xff, 
+0xff, 0xb6, 0xa7, 0x98, 0x88, 0x79, 0x6b, 0x5c, 0x4f, 0x43, 0x39, 0x3b, 0x45, 0x4d, 0x53, 0x58, 
+0x5a, 0x58, 0x54, 0x4e, 0x46, 0x3d, 0x37, 0x42, 0x4e, 0x5b, 0x6a, 0x79, 0x88, 0x97, 0xa7, 0xb6, 
+0xff, 0xff, 0xb3, 0xa3, 0x94, 0x84, 0x74, 0x65, 0x56, 0x47, 0x3a, 0x30, 0x38, 0x3f, 0x45, 0x4a, 
+0x4d, 0x4e, 0x4c, 0x48, 0x43, 0x3c, 0x34, 0x33, 0x3d, 0x4a, 0x59, 0x68, 0x78, 0x87, 0x97, 0xa7, 
+0xb6, 0xff, 0xff, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x32, 0x2a, 0x31, 0x37, 0x3b, 
+0x3e, 0x40, 0x40, 0x3e, 0x3b, 0x37, 0x32, 0x2b, 0x2e, 0x39, 0x49, 0x59, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb7, 0xff, 0xff, 0xb3, 0xa3, 0x93, 0x83, 0x73, 0x63, 0x54, 0x45, 0x38, 0x34, 0x39, 0x3f, 
+0x43, 0x47, 0x49, 0x48, 0x46, 0x41, 0x3c, 0x35, 0x2d, 0x35, 0x3e, 0x4c, 0x5b, 0x6b, 0x7a, 0x8a, 
+0x9a, 0xaa, 0xb9, 0xff, 0xff, 0xb5, 0xa5, 0x96, 0x86, 0x77, 0x69, 0x5b, 0x4e, 0x46, 0x44, 0x47, 
+0x4c, 0x50, 0x54, 0x56, 0x54, 0x50, 0x4a, 0x43, 0x3b, 0x35, 0x3e, 0x47, 0x53, 0x61, 0x6f, 0x7e, 
+0x8e, 0x9d, 0xad, 0xbc, 0xff, 0xff, 0xb9, 0xaa, 0x9b, 0x8c, 0x7e, 0x71, 0x65, 0x5b, 0x55, 0x54, 
+0x56, 0x5a, 0x5e, 0x61, 0x61, 0x5e, 0x58, 0x51, 0x48, 0x3e, 0x3d, 0x47, 0x51, 0x5c, 0x68, 0x76, 
+0x84, 0x93, 0xa2, 0xb1, 0xc0, 0xff, 0xff, 0xbf, 0xb0, 0xa2, 0x94, 0x88, 0x7c, 0x71, 0x69, 0x65, 
+0x64, 0x65, 0x68, 0x6b, 0x6b, 0x69, 0x65, 0x5e, 0x55, 0x4b, 0x3f, 0x44, 0x4f, 0x5a, 0x65, 0x71, 
+0x7d, 0x8b, 0x99, 0xa8, 0xb6, 0xc5, 0xff, 0xff, 0xc6, 0xb8, 0xab, 0x9e, 0x92, 0x88, 0x7f, 0x78, 
+0x74, 0x74, 0x75, 0x76, 0x76, 0x75, 0x71, 0x6a, 0x62, 0x57, 0x4b, 0x3d, 0x4a, 0x56, 0x62, 0x6d, 
+0x79, 0x85, 0x92, 0xa0, 0xae, 0xbc, 0xcb, 0xff, 0xff, 0xce, 0xc1, 0xb5, 0xa9, 0x9e, 0x95, 0x8d, 
+0x88, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7c, 0x76, 0x6e, 0x63, 0x57, 0x49, 0x40, 0x4f, 0x5d, 0x69, 
+0x75, 0x81, 0x8d, 0x9a, 0xa7, 0xb5, 0xc3, 0xd1, 0xff, 0xff, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa3, 
+0x9c, 0x97, 0x94, 0x92, 0x8f, 0x8c, 0x88, 0x81, 0x79, 0x6f, 0x63, 0x55, 0x45, 0x44, 0x53, 0x62, 
+0x6f, 0x7c, 0x89, 0x95, 0xa2, 0xaf, 0xbc, 0xca, 0xd8, 0xff, 0xff, 0xe2, 0xd6, 0xcb, 0xc1, 0xb9, 
+0xb1, 0xab, 0xa7, 0xa4, 0x9e, 0x99, 0x94, 0x8d, 0x85, 0x7b, 0x6f, 0x60, 0x51, 0x41, 0x48, 0x57, 
+0x67, 0x75, 0x83, 0x90, 0x9d, 0xa9, 0xb7, 0xc4, 0xd1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xba, 0xaa, 0x9b, 0x8b, 0x7c, 0x6c, 0x5d, 0x4d, 0x3e, 0x4c, 
+0x5b, 0x6b, 0x7a, 0x8a, 0x99, 0xa9, 0xb8, 0xc8, 0xd7, 0xe7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb6, 0xa6, 0x97, 0x87, 0x78, 0x68, 0x59, 0x49, 0x40, 
+0x4f, 0x5f, 0x6e, 0x7e, 0x8e, 0x9d, 0xad, 0xbc, 0xcc, 0xdb, 0xeb, 0xfa, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xb2, 0xa2, 0x93, 0x83, 0x74, 0x64, 0x55, 0x45, 
+0x44, 0x53, 0x63, 0x72, 0x82, 0x91, 0xa1, 0xb0, 0xc0, 0xcf, 0xdf, 0xef, 0xfe, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xaf, 0x9f, 0x8f, 0x80, 0x70, 0x61, 0x51, 
+0x41, 0x48, 0x57, 0x67, 0x76, 0x86, 0x95, 0xa5, 0xb4, 0xc4, 0xd3, 0xe3, 0xf2, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xae, 0x9e, 0x8e, 0x7e, 0x6f, 0x5f, 
+0x4f, 0x40, 0x4c, 0x5b, 0x6b, 0x7a, 0x8a, 0x99, 0xa9, 0xb8, 0xc8, 0xd7, 0xe7, 0xf6, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb0, 0xa0, 0x91, 0x81, 0x72, 
+0x63, 0x57, 0x50, 0x55, 0x61, 0x6f, 0x7e, 0x8e, 0x9d, 0xad, 0xbc, 0xcc, 0xdb, 0xeb, 0xfa, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 
+0x7a, 0x6d, 0x64, 0x60, 0x63, 0x6b, 0x77, 0x84, 0x93, 0xa2, 0xb1, 0xc0, 0xcf, 0xdf, 0xef, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xb9, 0xab, 0x9d, 
+0x90, 0x84, 0x7a, 0x73, 0x70, 0x72, 0x78, 0x82, 0x8e, 0x9a, 0xa8, 0xb6, 0xc5, 0xd4, 0xe3, 0xf3, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc1, 0xb3, 
+0xa7, 0x9b, 0x90, 0x88, 0x82, 0x80, 0x82, 0x87, 0x8e, 0x99, 0xa4, 0xb1, 0xbe, 0xcc, 0xda, 0xe9, 
+0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xca, 
+0xbd, 0xb1, 0xa7, 0x9e, 0x97, 0x92, 0x90, 0x91, 0x95, 0x9c, 0xa5, 0xaf, 0xbb, 0xc7, 0xd4, 0xe2, 
+0xf0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
+0xd4, 0xc8, 0xbd, 0xb4, 0xac, 0xa6, 0xa2, 0xa0, 0xa1, 0xa5, 0xaa, 0xb2, 0xbb, 0xc6, 0xd1, 0xdd, 
+0xea, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xea, 0xdf, 0xd4, 0xca, 0xc1, 0xba, 0xb5, 0xb1, 0xb0, 0xb1, 0xb4, 0xb9, 0xc0, 0xc8, 0xd2, 0xdc, 
+0xe8, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf5, 0xea, 0xe0, 0xd7, 0xcf, 0xc9, 0xc4, 0xc1, 0xc0, 0xc1, 0xc3, 0xc8, 0xce, 0xd6, 0xde, 
+0xe8, 0xf3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xdb, 0xd0, 0xc7, 0xbe, 
+0xb7, 0xb1, 0xad, 0xaa, 0xaa, 0xab, 0xac, 0xaf, 0xb2, 0xb5, 0xb8, 0xbb, 0xbd, 0xc0, 0xc0, 0xc0, 
+0xc0, 0xc0, 0xc3, 0xc7, 0xcd, 0xd4, 0xdd, 0xe6, 0xf1, 0xfc, 0xff, 0xff, 0xdb, 0xcf, 0xc4, 0xba, 
+0xb0, 0xa8, 0xa2, 0x9d, 0x9b, 0x9a, 0x9b, 0x9d, 0x9f, 0xa2, 0xa6, 0xa9, 0xac, 0xae, 0xb0, 0xb0, 
+0xb0, 0xb0, 0xb1, 0xb3, 0xb8, 0xbe, 0xc6, 0xd0, 0xda, 0xe5, 0xf1, 0xff, 0xff, 0xd2, 0xc5, 0xb9, 
+0xae, 0xa3, 0x9a, 0x93, 0x8e, 0x8b, 0x8a, 0x8b, 0x8d, 0x90, 0x93, 0x97, 0x9a, 0x9d, 0x9f, 0xa0, 
+0xa0, 0xa0, 0xa0, 0xa1, 0xa4, 0xa9, 0xb0, 0xb9, 0xc4, 0xcf, 0xdb, 0xe8, 0xff, 0xff, 0xc9, 0xbb, 
+0xae, 0xa2, 0x97, 0x8d, 0x85, 0x7e, 0x7b, 0x7a, 0x7b, 0x7e, 0x81, 0x85, 0x88, 0x8b, 0x8e, 0x8f, 
+0x90, 0x90, 0x90, 0x90, 0x91, 0x94, 0x9b, 0xa3, 0xad, 0xb8, 0xc4, 0xd1, 0xdf, 0xff, 0xff, 0xc1, 
+0xb3, 0xa5, 0x98, 0x8c, 0x80, 0x77, 0x6f, 0x6b, 0x6a, 0x6c, 0x6e, 0x72, 0x76, 0x7a, 0x7d, 0x7f, 
+0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x85, 0x8d, 0x96, 0xa2, 0xae, 0xbb, 0xc9, 0xd7, 0xff, 0xff, 
+0xbb, 0xac, 0x9e, 0x8f, 0x82, 0x75, 0x6a, 0x61, 0x5b, 0x5a, 0x5c, 0x60, 0x64, 0x68, 0x6b, 0x6e, 
+0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x71, 0x77, 0x80, 0x8b, 0x98, 0xa5, 0xb4, 0xc2, 0xd1, 0xff, 
+0xff, 0xb6, 0xa7, 0x98, 0x89, 0x7a, 0x6c, 0x5f, 0x53, 0x4c, 0x4a, 0x4d, 0x51, 0x56, 0x5a, 0x5d, 
+0x5f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x69, 0x75, 0x82, 0x90, 0x9f, 0xae, 0xbd, 0xcc, 
+0xff, 0xff, 0xb3, 0xa3, 0x94, 0x84, 0x74, 0x65, 0x56, 0x48, 0x3d, 0x3a, 0x3e, 0x44, 0x49, 0x4c, 
+0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x53, 0x5e, 0x6c, 0x7b, 0x8a, 0x9a, 0xaa, 0xb9, 
+0xc9, 0xff, 0xff, 0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x52, 0x42, 0x32, 0x2b, 0x32, 0x38, 0x3c, 
+0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xb2, 0xa2, 0x92, 0x82, 0x73, 0x63, 0x53, 0x43, 0x35, 0x2f, 0x37, 0x3e, 
+0x43, 0x47, 0x49, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4e, 0x5b, 0x6a, 0x79, 0x89, 0x99, 
+0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xb3, 0xa4, 0x94, 0x84, 0x75, 0x65, 0x56, 0x48, 0x3b, 0x36, 0x3f, 
+0x47, 0x4e, 0x53, 0x57, 0x59, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5c, 0x64, 0x71, 0x7f, 0x8d, 
+0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 0xb5, 0xa6, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4d, 0x40, 0x3b, 
+0x46, 0x4f, 0x57, 0x5e, 0x63, 0x67, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x71, 0x7b, 0x87, 
+0x94, 0xa2, 0xb1, 0xc0, 0xcf, 0xff, 0xff, 0xb8, 0xa9, 0x99, 0x8a, 0x7b, 0x6d, 0x5f, 0x51, 0x44, 
+0x3f, 0x4b, 0x56, 0x5f, 0x67, 0x6e, 0x73, 0x77, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7f, 0x87, 
+0x92, 0x9e, 0xaa, 0xb8, 0xc6, 0xd5, 0xff, 0xff, 0xbb, 0xac, 0x9d, 0x8e, 0x7f, 0x71, 0x63, 0x55, 
+0x47, 0x41, 0x4f, 0x5b, 0x66, 0x6f, 0x77, 0x7e, 0x83, 0x87, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8e, 
+0x95, 0x9e, 0xa8, 0xb4, 0xc1, 0xce, 0xdc, 0xff, 0xff, 0xbe, 0xaf, 0xa0, 0x91, 0x83, 0x74, 0x66, 
+0x57, 0x48, 0x42, 0x51, 0x5f, 0x6b, 0x76, 0x7f, 0x87, 0x8e, 0x93, 0x9a, 0x9a, 0x9a, 0x9a, 0x9a, 
+0x9e, 0xa3, 0xab, 0xb4, 0xbf, 0xcb, 0xd7, 0xe4, 0xff, 0xff, 0xc1, 0xb2, 0xa3, 0x94, 0x85, 0x76, 
+0x67, 0x58, 0x48, 0x42, 0x52, 0x61, 0x6f, 0x7b, 0x86, 0x8f, 0x97, 0x9e, 0xaa, 0xaa, 0xaa, 0xaa, 
+0xaa, 0xad, 0xb2, 0xb9, 0xc1, 0xcb, 0xd6, 0xe1, 0xed, 0xff, 0xff, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 
+0x78, 0x68, 0x58, 0x48, 0x42, 0x52, 0x62, 0x71, 0x7f, 0x8b, 0x96, 0x9f, 0xa7, 0xba, 0xba, 0xba, 
+0xba, 0xba, 0xbd, 0xc1, 0xc7, 0xcf, 0xd7, 0xe1, 0xec, 0xf8, 0xff, 0xff, 0xc6, 0xb7, 0xa7, 0x98, 
+0x88, 0x78, 0x68, 0x58, 0x48, 0x42, 0x52, 0x62, 0x71, 0x7f, 0x8c, 0x98, 0xa3, 0xad, 0xc9, 0xce, 
+0xd4, 0xdb, 0xe2, 0xeb, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xb5, 0xa6, 
+0x97, 0x88, 0x78, 0x68, 0x58, 0x48, 0x42, 0x52, 0x61, 0x6f, 0x7c, 0x87, 0x92, 0x9c, 0xa5, 0xba, 
+0xbf, 0xc6, 0xcd, 0xd5, 0xdd, 0xe6, 0xf0, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xb2, 
+0xa3, 0x95, 0x86, 0x77, 0x68, 0x58, 0x48, 0x42, 0x51, 0x60, 0x6c, 0x77, 0x81, 0x8a, 0x93, 0x9c, 
+0xab, 0xb1, 0xb7, 0xbf, 0xc7, 0xd0, 0xd9, 0xe3, 0xee, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 
+0xaf, 0xa0, 0x92, 0x83, 0x75, 0x66, 0x57, 0x48, 0x42, 0x50, 0x5c, 0x67, 0x71, 0x7a, 0x82, 0x89, 
+0x91, 0x9c, 0xa2, 0xa9, 0xb1, 0xba, 0xc3, 0xcd, 0xd7, 0xe2, 0xee, 0xf9, 0xff, 0xff, 0xff, 0xff, 
+0xba, 0xab, 0x9c, 0x8e, 0x80, 0x72, 0x64, 0x55, 0x47, 0x41, 0x4d, 0x58, 0x61, 0x69, 0x70, 0x77, 
+0x7e, 0x85, 0x8d, 0x94, 0x9b, 0xa3, 0xac, 0xb6, 0xc1, 0xcc, 0xd7, 0xe3, 0xef, 0xfc, 0xff, 0xff, 
+0xff, 0xb6, 0xa7, 0x98, 0x8a, 0x7c, 0x6e, 0x60, 0x52, 0x45, 0x3e, 0x49, 0x52, 0x59, 0x60, 0x66, 
+0x6c, 0x72, 0x78, 0x7e, 0x85, 0x8d, 0x96, 0xa0, 0xaa, 0xb5, 0xc0, 0xcc, 0xd9, 0xe5, 0xf2, 0xff, 
+0xff, 0xff, 0xb3, 0xa4, 0x95, 0x86, 0x77, 0x69, 0x5c, 0x4e, 0x41, 0x3b, 0x43, 0x4b, 0x50, 0x55, 
+0x5a, 0x5f, 0x64, 0x69, 0x70, 0x77, 0x80, 0x89, 0x94, 0x9e, 0xaa, 0xb6, 0xc2, 0xcf, 0xdc, 0xe9, 
+0xf7, 0xff, 0xff, 0xb0, 0xa1, 0x91, 0x82, 0x73, 0x64, 0x56, 0x49, 0x3c, 0x36, 0x3d, 0x42, 0x46, 
+0x49, 0x4d, 0x50, 0x55, 0x5a, 0x62, 0x6a, 0x73, 0x7d, 0x88, 0x93, 0x9f, 0xac, 0xb8, 0xc6, 0xd3, 
+0xe1, 0xef, 0xff, 0xff, 0xae, 0x9e, 0x8e, 0x7f, 0x6f, 0x60, 0x51, 0x43, 0x37, 0x30, 0x35, 0x38, 
+0x3a, 0x3c, 0x3e, 0x41, 0x46, 0x4c, 0x54, 0x5c, 0x66, 0x71, 0x7d, 0x89, 0x95, 0xa2, 0xaf, 0xbd, 
+0xcb, 0xd9, 0xe7, 0xff, 0xff, 0xad, 0x9d, 0x8d, 0x7e, 0x6e, 0x5e, 0x4f, 0x40, 0x34, 0x2f, 0x37, 
+0x3f, 0x45, 0x4a, 0x4b, 0x48, 0x43, 0x3e, 0x46, 0x50, 0x5a, 0x66, 0x72, 0x7f, 0x8c, 0x99, 0xa7, 
+0xb5, 0xc3, 0xd2, 0xe1, 0xff, 0xff, 0xae, 0x9f, 0x8f, 0x7f, 0x70, 0x61, 0x52, 0x44, 0x3a, 0x3d, 
+0x44, 0x4c, 0x52, 0x57, 0x59, 0x57, 0x51, 0x4a, 0x40, 0x44, 0x4f, 0x5c, 0x68, 0x76, 0x83, 0x91, 
+0xa0, 0xae, 0xbd, 0xcc, 0xdb, 0xff, 0xff, 0xb1, 0xa2, 0x93, 0x84, 0x75, 0x67, 0x5a, 0x4f, 0x49, 
+0x4c, 0x52, 0x5a, 0x60, 0x65, 0x67, 0x66, 0x60, 0x57, 0x4c, 0x41, 0x45, 0x52, 0x60, 0x6e, 0x7c, 
+0x8a, 0x99, 0xa8, 0xb7, 0xc6, 0xd5, 0xff, 0xff, 0xb6, 0xa7, 0x99, 0x8b, 0x7d, 0x70, 0x65, 0x5d, 
+0x59, 0x5b, 0x61, 0x68, 0x6e, 0x73, 0x75, 0x73, 0x6d, 0x63, 0x57, 0x4b, 0x3e, 0x4a, 0x58, 0x67, 
+0x75, 0x84, 0x94, 0xa3, 0xb2, 0xc1, 0xd1, 0xff, 0xff, 0xbc, 0xae, 0xa0, 0x93, 0x87, 0x7c, 0x73, 
+0x6c, 0x69, 0x6a, 0x6f, 0x76, 0x7d, 0x82, 0x83, 0x81, 0x79, 0x6e, 0x61, 0x53, 0x45, 0x43, 0x52, 
+0x61, 0x70, 0x7f, 0x8f, 0x9e, 0xae, 0xbe, 0xcd, 0xff, 0xff, 0xc4, 0xb7, 0xaa, 0x9e, 0x92, 0x89, 
+0x81, 0x7c, 0x79, 0x7a, 0x7e, 0x84, 0x8c, 0x90, 0x91, 0x8d, 0x84, 0x77, 0x69, 0x5a, 0x4b, 0x3e, 
+0x4d, 0x5c, 0x6c, 0x7c, 0x8b, 0x9b, 0xab, 0xbb, 0xcb, 0xff, 0xff, 0xcd, 0xc0, 0xb4, 0xa9, 0x9f, 
+0x97, 0x90, 0x8b, 0x89, 0x8a, 0x8d, 0x92, 0x9a, 0x9f, 0x9f, 0x98, 0x8d, 0x7e, 0x6f, 0x5f, 0x4f, 
+0x40, 0x4a, 0x5a, 0x69, 0x79, 0x89, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xd7, 0xcb, 0xc0, 0xb5, 
+0xac, 0xa5, 0x9f, 0x9b, 0x99, 0x9a, 0x9c, 0xa1, 0xa8, 0xae, 0xa9, 0x9f, 0x91, 0x81, 0x71, 0x61, 
+0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xe1, 0xd4, 0xc9, 
+0xbe, 0xb5, 0xad, 0xa7, 0xa3, 0xa1, 0xa2, 0xa6, 0xac, 0xb3, 0xb9, 0xaf, 0xa0, 0x91, 0x81, 0x71, 
+0x61, 0x51, 0x41, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xd7, 0xca, 
+0xbe, 0xb2, 0xa8, 0x9f, 0x98, 0x93, 0x91, 0x93, 0x97, 0x9d, 0xa6, 0xaa, 0xa4, 0x99, 0x8b, 0x7d, 
+0x6e, 0x5e, 0x4f, 0x3f, 0x4a, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xcf, 
+0xc1, 0xb4, 0xa7, 0x9b, 0x91, 0x89, 0x83, 0x81, 0x83, 0x88, 0x90, 0x97, 0x9a, 0x96, 0x8e, 0x82, 
+0x76, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5d, 0x6d, 0x7c, 0x8c, 0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 
+0xc8, 0xba, 0xab, 0x9e, 0x91, 0x85, 0x7b, 0x74, 0x71, 0x73, 0x7a, 0x82, 0x88, 0x8a, 0x87, 0x81, 
+0x77, 0x6c, 0x5f, 0x52, 0x44, 0x44, 0x53, 0x62, 0x71, 0x80, 0x90, 0x9f, 0xaf, 0xbe, 0xce, 0xff, 
+0xff, 0xc3, 0xb4, 0xa5, 0x96, 0x88, 0x7a, 0x6e, 0x65, 0x61, 0x64, 0x6c, 0x74, 0x78, 0x7a, 0x78, 
+0x72, 0x6a, 0x61, 0x55, 0x49, 0x3e, 0x4b, 0x5a, 0x68, 0x77, 0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd2, 
+0xff, 0xff, 0xc0, 0xb0, 0xa0, 0x91, 0x81, 0x72, 0x64, 0x58, 0x51, 0x56, 0x5e, 0x65, 0x68, 0x6a, 
+0x68, 0x64, 0x5d, 0x54, 0x4a, 0x3f, 0x47, 0x54, 0x61, 0x6f, 0x7d, 0x8c, 0x9a, 0xa9, 0xb8, 0xc7, 
+0xd6, 0xff, 0xff, 0xbe, 0xae, 0x9e, 0x8e, 0x7e, 0x6e, 0x5e, 0x4f, 0x41, 0x49, 0x50, 0x55, 0x59, 
+0x5a, 0x58, 0x54, 0x4f, 0x47, 0x3e, 0x46, 0x52, 0x5e, 0x6a, 0x77, 0x85, 0x93, 0xa1, 0xaf, 0xbe, 
+0xcd, 0xdc, 0xff, 0xff, 0xbf, 0xaf, 0x9f, 0x8f, 0x7f, 0x6f, 0x60, 0x52, 0x47, 0x3f, 0x41, 0x46, 
+0x49, 0x4a, 0x48, 0x45, 0x40, 0x41, 0x49, 0x52, 0x5d, 0x68, 0x74, 0x81, 0x8e, 0x9b, 0xa9, 0xb7, 
+0xc5, 0xd3, 0xe2, 0xff, 0xff, 0xc1, 0xb1, 0xa2, 0x93, 0x84, 0x75, 0x68, 0x5d, 0x55, 0x4d, 0x48, 
+0x43, 0x41, 0x40, 0x41, 0x44, 0x49, 0x4f, 0x56, 0x5f, 0x69, 0x73, 0x7f, 0x8b, 0x97, 0xa4, 0xb1, 
+0xbf, 0xcc, 0xda, 0xe9, 0xff, 0xff, 0xc5, 0xb6, 0xa7, 0x99, 0x8b, 0x7f, 0x74, 0x6b, 0x63, 0x5c, 
+0x57, 0x53, 0x51, 0x50, 0x51, 0x54, 0x58, 0x5d, 0x64, 0x6c, 0x75, 0x7f, 0x8a, 0x95, 0xa1, 0xae, 
+0xba, 0xc7, 0xd5, 0xe2, 0xf0, 0xff, 0xff, 0xcb, 0xbd, 0xaf, 0xa2, 0x95, 0x8a, 0x81, 0x79, 0x71, 
+0x6b, 0x66, 0x63, 0x61, 0x60, 0x61, 0x63, 0x67, 0x6c, 0x73, 0x7a, 0x83, 0x8c, 0x96, 0xa1, 0xac, 
+0xb8, 0xc4, 0xd1, 0xde, 0xeb, 0xf8, 0xff, 0xff, 0xd3, 0xc5, 0xb8, 0xac, 0xa1, 0x97, 0x8e, 0x87, 
+0x80, 0x7a, 0x76, 0x72, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7b, 0x81, 0x88, 0x90, 0x99, 0xa2, 0xac, 
+0xb7, 0xc3, 0xce, 0xdb, 0xe7, 0xf4, 0xff, 0xff, 0xff, 0xdb, 0xce, 0xc2, 0xb7, 0xad, 0xa4, 0x9c, 
+0x95, 0x8f, 0x89, 0x85, 0x82, 0x81, 0x80, 0x81, 0x83, 0x86, 0x8a, 0x90, 0x96, 0x9e, 0xa6, 0xaf, 
+0xb9, 0xc3, 0xce, 0xd9, 0xe5, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xe5, 0xd9, 0xce, 0xc4, 0xba, 0xb2, 
+0xaa, 0xa4, 0x9e, 0x99, 0x95, 0x92, 0x90, 0x90, 0x91, 0x93, 0x96, 0x9a, 0x9f, 0xa5, 0xac, 0xb4, 
+0xbc, 0xc5, 0xcf, 0xda, 0xe5, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe4, 0xda, 0xd1, 0xc8, 
+0xc0, 0xb9, 0xb2, 0xad, 0xa8, 0xa5, 0xa2, 0xa0, 0xa0, 0xa1, 0xa2, 0xa5, 0xa9, 0xae, 0xb4, 0xba, 
+0xc2, 0xca, 0xd2, 0xdc, 0xe6, 0xf0, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf1, 0xe7, 0xde, 
+0xd6, 0xce, 0xc7, 0xc1, 0xbc, 0xb8, 0xb4, 0xb2, 0xb0, 0xb0, 0xb1, 0xb2, 0xb5, 0xb8, 0xbd, 0xc2, 
+0xc9, 0xd0, 0xd7, 0xe0, 0xe9, 0xf2, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf4, 
+0xec, 0xe4, 0xdd, 0xd6, 0xd0, 0xcb, 0xc7, 0xc4, 0xc2, 0xc0, 0xc0, 0xc1, 0xc2, 0xc5, 0xc8, 0xcc, 
+0xd1, 0xd7, 0xde, 0xe5, 0xed, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xec, 0xe2, 
+0xd9, 0xd1, 0xca, 0xc5, 0xc2, 0xc0, 0xc0, 0xc3, 0xc7, 0xcd, 0xd4, 0xdd, 0xe6, 0xf1, 0xfc, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xed, 0xe1, 
+0xd6, 0xcc, 0xc3, 0xbc, 0xb6, 0xb2, 0xb0, 0xb1, 0xb3, 0xb8, 0xbe, 0xc6, 0xd0, 0xda, 0xe5, 0xf1, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf0, 0xe3, 
+0xd6, 0xca, 0xbf, 0xb6, 0xad, 0xa7, 0xa2, 0xa0, 0xa1, 0xa4, 0xa9, 0xb0, 0xb9, 0xc4, 0xcf, 0xdb, 
+0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe7, 
+0xda, 0xcc, 0xc0, 0xb4, 0xa9, 0x9f, 0x98, 0x93, 0x90, 0x91, 0x94, 0x9b, 0xa3, 0xad, 0xb8, 0xc4, 
+0xd1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 
+0xe0, 0xd2, 0xc4, 0xb6, 0xa9, 0x9d, 0x92, 0x89, 0x83, 0x80, 0x81, 0x85, 0x8d, 0x96, 0xa2, 0xae, 
+0xbb, 0xc9, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 
+0xe8, 0xd9, 0xcb, 0xbc, 0xae, 0xa0, 0x93, 0x86, 0x7c, 0x74, 0x70, 0x71, 0x77, 0x80, 0x8b, 0x98, 
+0xa5, 0xb4, 0xc2, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+0xef, 0xe1, 0xd2, 0xc4, 0xb5, 0xa7, 0x98, 0x8a, 0x7c, 0x70, 0x66, 0x60, 0x62, 0x69, 0x75, 0x82, 
+0x90, 0x9f, 0xae, 0xbd, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf7, 0xe8, 0xda, 0xcb, 0xbd, 0xae, 0xa0, 0x92, 0x83, 0x75, 0x66, 0x59, 0x51, 0x53, 0x5e, 0x6c, 
+0x7b, 0x8a, 0x9a, 0xaa, 0xb9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfe, 0xf0, 0xe1, 0xd3, 0xc4, 0xb6, 0xa8, 0x99, 0x8b, 0x7c, 0x6e, 0x5f, 0x51, 0x43, 0x48, 0x58, 
+0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf7, 0xe9, 0xda, 0xcc, 0xbd, 0xaf, 0xa1, 0x92, 0x84, 0x75, 0x67, 0x58, 0x4a, 0x3e, 0x4c, 
+0x5b, 0x6a, 0x79, 0x89, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf0, 0xe2, 0xd3, 0xc5, 0xb7, 0xa8, 0x9a, 0x8b, 0x7d, 0x6e, 0x60, 0x52, 0x43, 0x45, 
+0x53, 0x62, 0x70, 0x7f, 0x8d, 0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf8, 0xe9, 0xdb, 0xcd, 0xbe, 0xb0, 0xa1, 0x93, 0x84, 0x76, 0x68, 0x59, 0x4b, 0x3d, 
+0x4c, 0x5a, 0x69, 0x77, 0x86, 0x94, 0xa2, 0xb1, 0xc0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf1, 0xe2, 0xd4, 0xc6, 0xb7, 0xa9, 0x9a, 0x8c, 0x7d, 0x6f, 0x61, 0x52, 0x44, 
+0x44, 0x53, 0x61, 0x70, 0x7e, 0x8c, 0x9b, 0xa9, 0xb8, 0xc6, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf8, 0xea, 0xdc, 0xcd, 0xbf, 0xb0, 0xa2, 0x93, 0x85, 0x77, 0x68, 0x5a, 0x4b, 
+0x3d, 0x4b, 0x5a, 0x68, 0x76, 0x85, 0x93, 0xa2, 0xb0, 0xbf, 0xcd, 0xdc, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf2, 0xe3, 0xd5, 0xc6, 0xb8, 0xa9, 0x9b, 0x8d, 0x7e, 0x70, 0x61, 0x53, 
+0x44, 0x44, 0x52, 0x61, 0x6f, 0x7d, 0x8c, 0x9a, 0xa9, 0xb7, 0xc6, 0xd4, 0xe2, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xeb, 0xdc, 0xce, 0xbf, 0xb1, 0xa2, 0x94, 0x86, 0x77, 0x69, 0x5a, 
+0x4c, 0x3d, 0x4b, 0x59, 0x67, 0x76, 0x84, 0x93, 0xa1, 0xb0, 0xbe, 0xcc, 0xdb, 0xe9, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xd5, 0xc7, 0xb8, 0xaa, 0x9c, 0x8d, 0x7f, 0x70, 0x62, 
+0x53, 0x45, 0x43, 0x51, 0x60, 0x6e, 0x7d, 0x8b, 0x9a, 0xa8, 0xb7, 0xc5, 0xd3, 0xe2, 0xf0, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xeb, 0xdd, 0xce, 0xc0, 0xb2, 0xa3, 0x95, 0x86, 0x78, 0x69, 
+0x5b, 0x4c, 0x3e, 0x4a, 0x58, 0x67, 0x75, 0x84, 0x92, 0xa1, 0xaf, 0xbd, 0xcc, 0xda, 0xe9, 0xf7, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe4, 0xd6, 0xc7, 0xb9, 0xab, 0x9c, 0x8e, 0x7f, 0x71, 
+0x62, 0x54, 0x46, 0x42, 0x51, 0x5f, 0x6e, 0x7c, 0x8b, 0x99, 0xa7, 0xb6, 0xc4, 0xd3, 0xe1, 0xf0, 
+0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xdd, 0xcf, 0xc1, 0xb2, 0xa4, 0x95, 0x87, 0x78, 
+0x6a, 0x5c, 0x4d, 0x3f, 0x49, 0x58, 0x66, 0x75, 0x83, 0x92, 0xa0, 0xae, 0xbd, 0xcb, 0xda, 0xe8, 
+0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xd7, 0xc8, 0xba, 0xab, 0x9d, 0x8e, 0x80, 
+0x71, 0x63, 0x55, 0x46, 0x42, 0x50, 0x5f, 0x6d, 0x7c, 0x8a, 0x98, 0xa7, 0xb5, 0xc4, 0xd2, 0xe1, 
+0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xc7, 0xbb, 0xae, 0xa1, 0x94, 0x87, 
+0x79, 0x6b, 0x5c, 0x4e, 0x3f, 0x49, 0x57, 0x66, 0x74, 0x82, 0x90, 0x9d, 0xaa, 0xb7, 0xc4, 0xd1, 
+0xde, 0xeb, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcb, 0xbf, 0xb2, 0xa5, 0x98, 0x8c, 
+0x7f, 0x71, 0x64, 0x55, 0x47, 0x41, 0x50, 0x5e, 0x6c, 0x79, 0x86, 0x92, 0x9f, 0xab, 0xb8, 0xc4, 
+0xd1, 0xdd, 0xea, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xed, 0xc2, 0xb6, 0xa9, 0x9c, 0x90, 
+0x83, 0x76, 0x69, 0x5c, 0x4e, 0x40, 0x48, 0x56, 0x63, 0x6f, 0x7b, 0x87, 0x93, 0x9e, 0xaa, 0xb6, 
+0xc2, 0xcf, 0xdb, 0xe8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xee, 0xe2, 0xb9, 0xad, 0xa0, 0x93, 
+0x87, 0x7a, 0x6e, 0x61, 0x54, 0x47, 0x40, 0x4e, 0x5a, 0x65, 0x70, 0x7b, 0x86, 0x91, 0x9c, 0xa7, 
+0xb3, 0xbf, 0xcb, 0xd7, 0xe4, 0xf1, 0xfe, 0xff, 0xff, 0xfd, 0xf0, 0xe3, 0xd7, 0xb1, 0xa4, 0x97, 
+0x8a, 0x7d, 0x71, 0x65, 0x58, 0x4c, 0x3f, 0x45, 0x50, 0x5a, 0x64, 0x6e, 0x78, 0x82, 0x8c, 0x97, 
+0xa2, 0xad, 0xb9, 0xc5, 0xd2, 0xde, 0xeb, 0xf9, 0xff, 0xff, 0xf4, 0xe7, 0xda, 0xcd, 0xa9, 0x9c, 
+0x8e, 0x81, 0x74, 0x68, 0x5c, 0x4f, 0x43, 0x3c, 0x46, 0x4f, 0x58, 0x60, 0x69, 0x72, 0x7b, 0x85, 
+0x90, 0x9b, 0xa6, 0xb2, 0xbe, 0xcb, 0xd8, 0xe5, 0xf3, 0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 0xa3, 
+0x95, 0x87, 0x79, 0x6c, 0x5f, 0x52, 0x46, 0x3a, 0x3d, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x6a, 0x73, 
+0x7c, 0x87, 0x92, 0x9d, 0xa9, 0xb6, 0xc3, 0xd0, 0xde, 0xec, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 
+0x9d, 0x8f, 0x81, 0x73, 0x65, 0x58, 0x4b, 0x3e, 0x34, 0x3b, 0x40, 0x45, 0x4b, 0x50, 0x57, 0x5f, 
+0x68, 0x71, 0x7c, 0x87, 0x93, 0xa0, 0xad, 0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xde, 0xcf, 0xc1, 
+0xb2, 0x98, 0x8a, 0x7c, 0x6e, 0x60, 0x53, 0x47, 0x3c, 0x36, 0x36, 0x39, 0x3c, 0x3f, 0x44, 0x4a, 
+0x52, 0x5b, 0x66, 0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 0xc1, 0xcf, 0xde, 0xff, 0xff, 0xd8, 0xc9, 
+0xba, 0xab, 0x94, 0x86, 0x78, 0x6a, 0x5c, 0x50, 0x44, 0x3a, 0x34, 0x30, 0x2f, 0x2f, 0x31, 0x36, 
+0x3c, 0x45, 0x4f, 0x5a, 0x66, 0x73, 0x81, 0x8f, 0x9d, 0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xd3, 
+0xc3, 0xb4, 0xa5, 0x91, 0x82, 0x74, 0x66, 0x58, 0x4b, 0x40, 0x35, 0x2d, 0x26, 0x22, 0x20, 0x22, 
+0x27, 0x2f, 0x38, 0x44, 0x50, 0x5d, 0x6b, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 
+0xce, 0xbf, 0xaf, 0xa0, 0x8e, 0x7f, 0x70, 0x62, 0x54, 0x46, 0x39, 0x2d, 0x22, 0x18, 0x12, 0x10, 
+0x12, 0x18, 0x22, 0x2d, 0x3a, 0x47, 0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 
+0xff, 0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7c, 0x6d, 0x5e, 0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 
+0x00, 0x03, 0x0b, 0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 
+0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0e, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 
+0xc9, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x09, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 
+0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 
+0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 
+0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 
+0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 0x4f, 0x40, 
+0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 0x03, 0x0b, 0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 0x6d, 0x7d, 
+0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 
+0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 0x10, 0x12, 0x18, 0x22, 0x2d, 0x3a, 0x47, 0x55, 0x64, 0x73, 
+0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x79, 0x6b, 
+0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 0x22, 0x20, 0x22, 0x27, 0x2f, 0x38, 0x44, 0x50, 0x5d, 0x6b, 
+0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 0x8f, 0x81, 
+0x73, 0x66, 0x5a, 0x4f, 0x45, 0x3c, 0x36, 0x31, 0x30, 0x31, 0x36, 0x3c, 0x45, 0x4f, 0x5a, 0x66, 
+0x73, 0x81, 0x8f, 0x9d, 0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 
+0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 0x5b, 0x66, 
+0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 0xc1, 0xcf, 0xde, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 
+0xa0, 0x93, 0x87, 0x7c, 0x72, 0x68, 0x60, 0x59, 0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 0x60, 0x68, 
+0x72, 0x7c, 0x87, 0x93, 0xa0, 0xad, 0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 
+0xb6, 0xaa, 0x9e, 0x93, 0x88, 0x7e, 0x76, 0x6e, 0x68, 0x64, 0x61, 0x60, 0x61, 0x64, 0x68, 0x6e, 
+0x76, 0x7e, 0x88, 0x93, 0x9e, 0xaa, 0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xf4, 0xe7, 0xda, 
+0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 0x8c, 0x84, 0x7d, 0x77, 0x73, 0x71, 0x70, 0x71, 0x73, 0x77, 
+0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 0xb5, 0xc1, 0xcd, 0xda, 0xe7, 0xf4, 0xff, 0xff, 0xfd, 0xf0, 
+0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa2, 0x99, 0x92, 0x8c, 0x87, 0x83, 0x81, 0x80, 0x81, 0x83, 
+0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 0xb5, 0xc0, 0xcb, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xff, 
+0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 0xb8, 0xaf, 0xa8, 0xa1, 0x9b, 0x96, 0x93, 0x91, 0x90, 0x91, 
+0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 0xb8, 0xc2, 0xcc, 0xd7, 0xe2, 0xee, 0xfa, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf9, 0xed, 0xe2, 0xd8, 0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 0xa6, 0xa3, 0xa1, 0xa0, 
+0xa1, 0xa3, 0xa6, 0xaa, 0xaf, 0xb6, 0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 0xf9, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 0xb2, 0xb1, 
+0xb0, 0xb1, 0xb2, 0xb5, 0xb9, 0xbe, 0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 0xc5, 0xc2, 
+0xc1, 0xc0, 0xc1, 0xc2, 0xc5, 0xc9, 0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xe6, 0xdd, 0xd4, 0xcd, 0xc7, 0xc3, 0xc0, 0xc0, 0xc0, 
+0xc0, 0xbf, 0xbd, 0xbb, 0xb8, 0xb5, 0xb2, 0xaf, 0xac, 0xab, 0xaa, 0xaa, 0xad, 0xb1, 0xb7, 0xbe, 
+0xc7, 0xd0, 0xdb, 0xe6, 0xff, 0xff, 0xf1, 0xe5, 0xda, 0xd0, 0xc6, 0xbe, 0xb8, 0xb3, 0xb1, 0xb0, 
+0xb0, 0xb0, 0xaf, 0xae, 0xac, 0xa9, 0xa6, 0xa2, 0x9f, 0x9d, 0x9b, 0x9a, 0x9b, 0x9d, 0xa2, 0xa8, 
+0xb0, 0xba, 0xc4, 0xcf, 0xdb, 0xff, 0xff, 0xe8, 0xdb, 0xcf, 0xc4, 0xb9, 0xb0, 0xa9, 0xa4, 0xa1, 
+0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9d, 0x9a, 0x97, 0x93, 0x90, 0x8d, 0x8b, 0x8a, 0x8b, 0x8e, 0x93, 
+0x9a, 0xa3, 0xae, 0xb9, 0xc5, 0xd2, 0xff, 0xff, 0xdf, 0xd1, 0xc4, 0xb8, 0xad, 0xa3, 0x9b, 0x94, 
+0x91, 0x90, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8b, 0x88, 0x85, 0x81, 0x7e, 0x7b, 0x7a, 0x7b, 0x7e, 
+0x85, 0x8d, 0x97, 0xa2, 0xae, 0xbb, 0xc9, 0xff, 0xff, 0xd7, 0xc9, 0xbb, 0xae, 0xa2, 0x96, 0x8d, 
+0x85, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7a, 0x76, 0x72, 0x6e, 0x6c, 0x6a, 0x6b, 
+0x6f, 0x77, 0x80, 0x8c, 0x98, 0xa5, 0xb3, 0xc1, 0xff, 0xff, 0xd1, 0xc2, 0xb4, 0xa5, 0x98, 0x8b, 
+0x80, 0x77, 0x71, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6e, 0x6b, 0x68, 0x64, 0x60, 0x5c, 0x5a, 
+0x5b, 0x61, 0x6a, 0x75, 0x82, 0x8f, 0x9e, 0xac, 0xbb, 0xff, 0xff, 0xcc, 0xbd, 0xae, 0x9f, 0x90, 
+0x82, 0x75, 0x69, 0x62, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x5d, 0x5a, 0x56, 0x51, 0x4d, 
+0x4a, 0x4c, 0x53, 0x5f, 0x6c, 0x7a, 0x89, 0x98, 0xa7, 0xb6, 0xff, 0xff, 0xc9, 0xb9, 0xaa, 0x9a, 
+0x8a, 0x7b, 0x6c, 0x5e, 0x53, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x4c, 0x49, 0x44, 
+0x3e, 0x3a, 0x3d, 0x48, 0x56, 0x65, 0x74, 0x84, 0x94, 0xa3, 0xb3, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 
+0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3e, 0x3b, 
+0x37, 0x32, 0x2b, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92, 0xa2, 0xb2, 0xff, 0xff, 0xc9, 0xb9, 
+0xa9, 0x99, 0x89, 0x79, 0x6a, 0x5b, 0x4e, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x4a, 0x49, 0x48, 0x45, 
+0x41, 0x3b, 0x35, 0x2d, 0x37, 0x45, 0x54, 0x63, 0x73, 0x83, 0x93, 0xa3, 0xb3, 0xff, 0xff, 0xcb, 
+0xbb, 0xac, 0x9c, 0x8d, 0x7f, 0x71, 0x64, 0x5c, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x59, 0x57, 0x53, 
+0x4f, 0x49, 0x41, 0x39, 0x36, 0x40, 0x4c, 0x5a, 0x68, 0x77, 0x86, 0x96, 0xa5, 0xb5, 0xff, 0xff, 
+0xcf, 0xc0, 0xb1, 0xa2, 0x94, 0x87, 0x7b, 0x71, 0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x68, 0x65, 0x61, 
+0x5c, 0x56, 0x4e, 0x45, 0x3a, 0x40, 0x4a, 0x55, 0x62, 0x6f, 0x7e, 0x8c, 0x9b, 0xaa, 0xb9, 0xff, 
+0xff, 0xd5, 0xc6, 0xb8, 0xaa, 0x9e, 0x92, 0x87, 0x7f, 0x7b, 0x7a, 0x7a, 0x79, 0x77, 0x74, 0x6f, 
+0x69, 0x62, 0x5a, 0x50, 0x45, 0x3c, 0x48, 0x53, 0x5e, 0x6b, 0x77, 0x85, 0x93, 0xa1, 0xb0, 0xbf, 
+0xff, 0xff, 0xdc, 0xce, 0xc1, 0xb4, 0xa8, 0x9e, 0x95, 0x8e, 0x8a, 0x89, 0x88, 0x86, 0x82, 0x7d, 
+0x76, 0x6f, 0x66, 0x5c, 0x50, 0x43, 0x43, 0x50, 0x5c, 0x67, 0x73, 0x80, 0x8d, 0x9a, 0xa8, 0xb7, 
+0xc5, 0xff, 0xff, 0xe4, 0xd7, 0xcb, 0xbf, 0xb4, 0xab, 0xa3, 0x9d, 0x9a, 0x97, 0x94, 0x90, 0x8a, 
+0x83, 0x7b, 0x71, 0x67, 0x5b, 0x4d, 0x3f, 0x4a, 0x57, 0x64, 0x70, 0x7c, 0x88, 0x95, 0xa2, 0xb0, 
+0xbe, 0xcc, 0xff, 0xff, 0xed, 0xe1, 0xd6, 0xcb, 0xc1, 0xb9, 0xb1, 0xab, 0xa6, 0xa2, 0x9d, 0x97, 
+0x90, 0x87, 0x7d, 0x71, 0x65, 0x57, 0x48, 0x41, 0x50, 0x5e, 0x6b, 0x78, 0x84, 0x91, 0x9e, 0xab, 
+0xb8, 0xc5, 0xd3, 0xff, 0xff, 0xf8, 0xec, 0xe1, 0xd7, 0xce, 0xc5, 0xbd, 0xb7, 0xb1, 0xab, 0xa4, 
+0x9c, 0x93, 0x88, 0x7c, 0x6f, 0x60, 0x51, 0x42, 0x46, 0x55, 0x64, 0x72, 0x80, 0x8c, 0x99, 0xa6, 
+0xb3, 0xc0, 0xcd, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe2, 0xd3, 0xc4, 
+0xb5, 0xa6, 0x97, 0x88, 0x79, 0x6a, 0x5b, 0x4c, 0x3d, 0x4c, 0x5b, 0x6a, 0x79, 0x88, 0x97, 0xa6, 
+0xb5, 0xc4, 0xd3, 0xe2, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xeb, 0xdc, 0xcd, 
+0xbe, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 0x46, 0x42, 0x51, 0x60, 0x6f, 0x7e, 0x8d, 0x9c, 
+0xab, 0xba, 0xc9, 0xd8, 0xe7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe5, 0xd6, 
+0xc7, 0xb8, 0xa9, 0x9a, 0x8b, 0x7c, 0x6d, 0x5f, 0x50, 0x41, 0x48, 0x57, 0x66, 0x75, 0x84, 0x93, 
+0xa2, 0xb1, 0xc0, 0xcf, 0xde, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xe0, 
+0xd1, 0xc2, 0xb3, 0xa4, 0x95, 0x86, 0x77, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5d, 0x6c, 0x7b, 0x8a, 
+0x99, 0xa8, 0xb7, 0xc6, 0xd4, 0xe3, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe9, 
+0xda, 0xcb, 0xbc, 0xad, 0x9e, 0x8f, 0x80, 0x71, 0x62, 0x53, 0x44, 0x44, 0x53, 0x62, 0x71, 0x80, 
+0x8f, 0x9e, 0xad, 0xbc, 0xcb, 0xda, 0xe9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 
+0xe3, 0xd4, 0xc6, 0xb7, 0xa8, 0x99, 0x8a, 0x7b, 0x6c, 0x5d, 0x4e, 0x3f, 0x4a, 0x59, 0x68, 0x77, 
+0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd1, 0xe0, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 
+0xed, 0xde, 0xcf, 0xc0, 0xb1, 0xa2, 0x93, 0x84, 0x75, 0x66, 0x57, 0x48, 0x41, 0x50, 0x5f, 0x6d, 
+0x7c, 0x8b, 0x9a, 0xa9, 0xb8, 0xc7, 0xd6, 0xe5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf6, 0xe7, 0xd8, 0xc9, 0xba, 0xab, 0x9c, 0x8d, 0x7e, 0x6f, 0x60, 0x51, 0x42, 0x46, 0x55, 0x64, 
+0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbe, 0xcd, 0xdc, 0xeb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf1, 0xe2, 0xd3, 0xc4, 0xb5, 0xa6, 0x97, 0x88, 0x79, 0x6a, 0x5b, 0x4c, 0x3d, 0x4c, 0x5b, 
+0x6a, 0x79, 0x88, 0x97, 0xa6, 0xb5, 0xc4, 0xd3, 0xe2, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xfa, 0xeb, 0xdc, 0xcd, 0xbe, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 0x46, 0x42, 0x51, 
+0x60, 0x6f, 0x7e, 0x8d, 0x9c, 0xab, 0xba, 0xc9, 0xd8, 0xe7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf4, 0xe5, 0xd6, 0xc7, 0xb8, 0xa9, 0x9a, 0x8b, 0x7c, 0x6d, 0x5f, 0x50, 0x41, 0x48, 
+0x57, 0x66, 0x75, 0x84, 0x93, 0xa2, 0xb1, 0xc0, 0xcf, 0xde, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfe, 0xef, 0xe0, 0xd1, 0xc2, 0xb3, 0xa4, 0x95, 0x86, 0x77, 0x68, 0x59, 0x4a, 0x3f, 
+0x4e, 0x5d, 0x6c, 0x7b, 0x8a, 0x99, 0xa8, 0xb7, 0xc6, 0xd4, 0xe3, 0xf2, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf8, 0xe9, 0xda, 0xcb, 0xbc, 0xad, 0x9e, 0x8f, 0x80, 0x71, 0x62, 0x53, 0x44, 
+0x44, 0x53, 0x62, 0x71, 0x80, 0x8f, 0x9e, 0xad, 0xbc, 0xcb, 0xda, 0xe9, 0xf8, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf2, 0xe3, 0xd4, 0xc6, 0xb7, 0xa8, 0x99, 0x8a, 0x7b, 0x6c, 0x5d, 0x4e, 
+0x3f, 0x4a, 0x59, 0x68, 0x77, 0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd1, 0xe0, 0xef, 0xfe, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xfc, 0xed, 0xde, 0xcf, 0xc0, 0xb1, 0xa2, 0x93, 0x84, 0x75, 0x66, 0x57, 
+0x48, 0x41, 0x50, 0x5f, 0x6d, 0x7c, 0x8b, 0x9a, 0xa9, 0xb8, 0xc7, 0xd6, 0xe5, 0xf4, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xd8, 0xc9, 0xba, 0xab, 0x9c, 0x8d, 0x7e, 0x6f, 0x60, 
+0x51, 0x42, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbe, 0xcd, 0xdc, 0xeb, 0xfa, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe2, 0xd3, 0xc4, 0xb5, 0xa6, 0x97, 0x88, 0x79, 0x6a, 
+0x5b, 0x4c, 0x3d, 0x4c, 0x5b, 0x6a, 0x79, 0x88, 0x97, 0xa6, 0xb5, 0xc4, 0xd3, 0xe2, 0xf1, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xdc, 0xcd, 0xbe, 0xaf, 0xa0, 0x91, 0x82, 0x73, 
+0x64, 0x55, 0x46, 0x42, 0x51, 0x60, 0x6f, 0x7e, 0x8d, 0x9c, 0xab, 0xba, 0xc9, 0xd8, 0xe7, 0xf6, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xd6, 0xc7, 0xb8, 0xa9, 0x9a, 0x8b, 0x7c, 
+0x6d, 0x5f, 0x50, 0x41, 0x48, 0x57, 0x66, 0x75, 0x84, 0x93, 0xa2, 0xb1, 0xc0, 0xcf, 0xde, 0xed, 
+0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xd1, 0xc2, 0xb3, 0xa4, 0x95, 0x86, 
+0x77, 0x68, 0x59, 0x4a, 0x3f, 0x4e, 0x5d, 0x6c, 0x7b, 0x8a, 0x99, 0xa8, 0xb7, 0xc6, 0xd4, 0xe3, 
+0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xcb, 0xbc, 0xad, 0x9e, 0x8f, 
+0x80, 0x71, 0x62, 0x53, 0x44, 0x44, 0x53, 0x62, 0x71, 0x80, 0x8f, 0x9e, 0xad, 0xbc, 0xcb, 0xda, 
+0xe9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xc6, 0xb7, 0xa8, 0x99, 
+0x8a, 0x7b, 0x6c, 0x5d, 0x4e, 0x3f, 0x4a, 0x59, 0x68, 0x77, 0x86, 0x95, 0xa4, 0xb3, 0xc2, 0xd1, 
+0xe0, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc0, 0xb1, 0xa2, 
+0x93, 0x84, 0x75, 0x66, 0x57, 0x48, 0x41, 0x50, 0x5f, 0x6d, 0x7c, 0x8b, 0x9a, 0xa9, 0xb8, 0xc7, 
+0xd6, 0xe5, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xbb, 0xac, 
+0x9c, 0x8d, 0x7e, 0x6f, 0x60, 0x51, 0x42, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbe, 
+0xcd, 0xdc, 0xeb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xb9, 
+0xa9, 0x99, 0x89, 0x79, 0x6a, 0x5b, 0x4c, 0x3d, 0x4c, 0x5b, 0x6a, 0x79, 0x88, 0x97, 0xa6, 0xb5, 
+0xc4, 0xd3, 0xe2, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 
+0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x43, 0x51, 0x60, 0x6f, 0x7e, 0x8d, 0x9c, 0xab, 
+0xba, 0xc9, 0xd8, 0xe7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xc9, 0xb9, 0xaa, 0x9a, 0x8a, 0x7b, 0x6c, 0x5e, 0x53, 0x51, 0x59, 0x66, 0x75, 0x84, 0x93, 0xa2, 
+0xb1, 0xc0, 0xcf, 0xde, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xcc, 0xbd, 0xae, 0x9f, 0x90, 0x82, 0x75, 0x69, 0x62, 0x60, 0x66, 0x70, 0x7c, 0x8a, 0x99, 
+0xa8, 0xb7, 0xc6, 0xd4, 0xe3, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xd1, 0xc2, 0xb4, 0xa5, 0x98, 0x8b, 0x80, 0x77, 0x71, 0x70, 0x74, 0x7c, 0x86, 0x93, 
+0xa0, 0xae, 0xbc, 0xcb, 0xda, 0xe9, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xd7, 0xc9, 0xbb, 0xae, 0xa2, 0x96, 0x8d, 0x85, 0x81, 0x80, 0x83, 0x89, 0x92, 
+0x9d, 0xa9, 0xb6, 0xc4, 0xd2, 0xe0, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xdf, 0xd1, 0xc4, 0xb8, 0xad, 0xa3, 0x9b, 0x94, 0x91, 0x90, 0x93, 0x98, 
+0x9f, 0xa9, 0xb4, 0xc0, 0xcc, 0xda, 0xe7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xdb, 0xcf, 0xc4, 0xb9, 0xb0, 0xa9, 0xa4, 0xa1, 0xa0, 0xa2, 
+0xa7, 0xad, 0xb6, 0xbf, 0xca, 0xd6, 0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe5, 0xda, 0xd0, 0xc6, 0xbe, 0xb8, 0xb3, 0xb1, 0xb0, 
+0xb2, 0xb6, 0xbc, 0xc3, 0xcc, 0xd6, 0xe1, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf1, 0xe6, 0xdd, 0xd4, 0xcd, 0xc7, 0xc3, 0xc0, 
+0xc0, 0xc2, 0xc5, 0xca, 0xd1, 0xd9, 0xe2, 0xec, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
+0xef, 0xe6, 0xdd, 0xd6, 0xd0, 0xca, 0xc6, 0xc3, 0xc1, 0xc0, 0xc1, 0xc3, 0xc6, 0xca, 0xd0, 0xd6, 
+0xdd, 0xe6, 0xef, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 
+0xec, 0xe2, 0xd8, 0xd0, 0xc8, 0xc1, 0xbb, 0xb6, 0xb3, 0xb1, 0xb0, 0xb1, 0xb3, 0xb6, 0xbb, 0xc1, 
+0xc8, 0xd0, 0xd8, 0xe2, 0xec, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
+0xec, 0xe0, 0xd6, 0xcc, 0xc2, 0xba, 0xb2, 0xac, 0xa7, 0xa3, 0xa1, 0xa0, 0xa1, 0xa3, 0xa7, 0xac, 
+0xb2, 0xba, 0xc2, 0xcc, 0xd6, 0xe0, 0xec, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xed, 0xe1, 0xd5, 0xca, 0xbf, 0xb5, 0xac, 0xa4, 0x9d, 0x97, 0x93, 0x91, 0x90, 0x91, 0x93, 0x97, 
+0x9d, 0xa4, 0xac, 0xb5, 0xbf, 0xca, 0xd5, 0xe1, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xe4, 0xd7, 0xcb, 0xbf, 0xb3, 0xa9, 0x9f, 0x96, 0x8e, 0x88, 0x84, 0x81, 0x80, 0x81, 0x84, 
+0x88, 0x8e, 0x96, 0x9f, 0xa9, 0xb3, 0xbf, 0xcb, 0xd7, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xdb, 0xce, 0xc1, 0xb4, 0xa8, 0x9d, 0x92, 0x88, 0x80, 0x79, 0x74, 0x71, 0x70, 0x71, 
+0x74, 0x79, 0x80, 0x88, 0x92, 0x9d, 0xa8, 0xb4, 0xc1, 0xce, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xd3, 0xc5, 0xb8, 0xaa, 0x9e, 0x91, 0x86, 0x7c, 0x72, 0x6b, 0x65, 0x61, 0x60, 
+0x61, 0x65, 0x6b, 0x72, 0x7c, 0x86, 0x91, 0x9e, 0xaa, 0xb8, 0xc5, 0xd3, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xcc, 0xbe, 0xaf, 0xa2, 0x94, 0x87, 0x7b, 0x6f, 0x65, 0x5c, 0x56, 0x51, 
+0x50, 0x51, 0x56, 0x5c, 0x65, 0x6f, 0x7b, 0x87, 0x94, 0xa2, 0xaf, 0xbe, 0xcc, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xb7, 0xa8, 0x9a, 0x8c, 0x7e, 0x71, 0x64, 0x59, 0x4f, 0x47, 
+0x42, 0x40, 0x42, 0x47, 0x4f, 0x59, 0x64, 0x71, 0x7e, 0x8c, 0x9a, 0xa8, 0xb7, 0xc6, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xb2, 0xa3, 0x94, 0x85, 0x76, 0x68, 0x5a, 0x4e, 0x42, 
+0x39, 0x32, 0x30, 0x32, 0x39, 0x42, 0x4e, 0x5a, 0x68, 0x76, 0x85, 0x94, 0xa3, 0xb2, 0xc1, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xae, 0x9e, 0x8f, 0x7f, 0x70, 0x61, 0x52, 0x44, 
+0x37, 0x2c, 0x23, 0x20, 0x23, 0x2c, 0x37, 0x44, 0x52, 0x61, 0x70, 0x7f, 0x8f, 0x9e, 0xae, 0xbd, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xab, 0x9b, 0x8b, 0x7c, 0x6c, 0x5c, 0x4d, 
+0x3d, 0x2f, 0x21, 0x15, 0x10, 0x15, 0x21, 0x2f, 0x3d, 0x4d, 0x5c, 0x6c, 0x7c, 0x8b, 0x9b, 0xab, 
+0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xaa, 0x9a, 0x8a, 0x7a, 0x6a, 0x5a, 
+0x4a, 0x3a, 0x2a, 0x1a, 0x0b, 0x00, 0x0b, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a, 0x6a, 0x7a, 0x8a, 0x9a, 
+0xaa, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xaa, 0x9a, 0x8a, 0x7a, 0x6a, 
+0x5a, 0x4a, 0x3a, 0x2b, 0x1b, 0x0c, 0x03, 0x0c, 0x1b, 0x2b, 0x3a, 0x4a, 0x5a, 0x6a, 0x7a, 0x8a, 
+0x9a, 0xaa, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xab, 0x9c, 0x8c, 0x7c, 
+0x6c, 0x5d, 0x4e, 0x3f, 0x30, 0x23, 0x18, 0x13, 0x18, 0x23, 0x30, 0x3f, 0x4e, 0x5d, 0x6c, 0x7c, 
+0x8c, 0x9c, 0xab, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xae, 0x9f, 0x8f, 
+0x80, 0x71, 0x62, 0x54, 0x46, 0x39, 0x2e, 0x26, 0x23, 0x26, 0x2e, 0x39, 0x46, 0x54, 0x62, 0x71, 
+0x80, 0x8f, 0x9f, 0xae, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xb0, 0xa2, 
+0x93, 0x85, 0x77, 0x6a, 0x5c, 0x50, 0x45, 0x3b, 0x35, 0x33, 0x35, 0x3b, 0x45, 0x50, 0x5c, 0x6a, 
+0x77, 0x85, 0x93, 0xa2, 0xb0, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xbf, 0xb1, 
+0xa4, 0x97, 0x8a, 0x7d, 0x71, 0x65, 0x5b, 0x51, 0x4a, 0x45, 0x43, 0x45, 0x4a, 0x51, 0x5b, 0x65, 
+0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb1, 0xbf, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xeb, 0xbf, 
+0xb2, 0xa5, 0x99, 0x8c, 0x81, 0x76, 0x6c, 0x63, 0x5b, 0x55, 0x52, 0x50, 0x52, 0x55, 0x5b, 0x63, 
+0x6c, 0x76, 0x81, 0x8c, 0x99, 0xa5, 0xb2, 0xbf, 0xeb, 0xf7, 0xff, 0xff, 0xff, 0xfa, 0xed, 0xe0, 
+0xbe, 0xb1, 0xa5, 0x99, 0x8d, 0x82, 0x78, 0x6f, 0x67, 0x61, 0x5c, 0x59, 0x58, 0x59, 0x5c, 0x61, 
+0x67, 0x6f, 0x78, 0x82, 0x8d, 0x99, 0xa5, 0xb1, 0xbe, 0xe0, 0xed, 0xfa, 0xff, 0xff, 0xf2, 0xe4, 
+0xd7, 0xbc, 0xb0, 0xa3, 0x97, 0x8c, 0x81, 0x78, 0x6f, 0x67, 0x61, 0x5d, 0x5a, 0x59, 0x5a, 0x5d, 
+0x61, 0x67, 0x6f, 0x78, 0x81, 0x8c, 0x97, 0xa3, 0xb0, 0xbc, 0xd7, 0xe4, 0xf2, 0xff, 0xff, 0xea, 
+0xdc, 0xce, 0xb9, 0xac, 0xa0, 0x94, 0x88, 0x7e, 0x74, 0x6b, 0x63, 0x5d, 0x58, 0x56, 0x55, 0x56, 
+0x58, 0x5d, 0x63, 0x6b, 0x74, 0x7e, 0x88, 0x94, 0xa0, 0xac, 0xb9, 0xce, 0xdc, 0xea, 0xff, 0xff, 
+0xe2, 0xd4, 0xc6, 0xb5, 0xa8, 0x9b, 0x8e, 0x82, 0x77, 0x6c, 0x63, 0x5b, 0x54, 0x4f, 0x4c, 0x4a, 
+0x4c, 0x4f, 0x54, 0x5b, 0x63, 0x6c, 0x77, 0x82, 0x8e, 0x9b, 0xa8, 0xb5, 0xc6, 0xd4, 0xe2, 0xff, 
+0xff, 0xdc, 0xcd, 0xbe, 0xb0, 0xa2, 0x94, 0x87, 0x7a, 0x6e, 0x62, 0x57, 0x4e, 0x46, 0x40, 0x3c, 
+0x3b, 0x3c, 0x40, 0x46, 0x4e, 0x57, 0x62, 0x6e, 0x7a, 0x87, 0x94, 0xa2, 0xb0, 0xbe, 0xcd, 0xdc, 
+0xff, 0xff, 0xd6, 0xc7, 0xb8, 0xa9, 0x9b, 0x8c, 0x7e, 0x71, 0x64, 0x57, 0x4b, 0x41, 0x38, 0x31, 
+0x2d, 0x2b, 0x2d, 0x31, 0x38, 0x41, 0x4b, 0x57, 0x64, 0x71, 0x7e, 0x8c, 0x9b, 0xa9, 0xb8, 0xc7, 
+0xd6, 0xff, 0xff, 0xd1, 0xc2, 0xb3, 0xa3, 0x94, 0x86, 0x77, 0x69, 0x5b, 0x4d, 0x40, 0x35, 0x2b, 
+0x22, 0x1d, 0x1b, 0x1d, 0x22, 0x2b, 0x35, 0x40, 0x4d, 0x5b, 0x69, 0x77, 0x86, 0x94, 0xa3, 0xb3, 
+0xc2, 0xd1, 0xff, 0xff, 0xcd, 0xbe, 0xae, 0x9f, 0x8f, 0x80, 0x71, 0x62, 0x53, 0x45, 0x37, 0x2a, 
+0x1e, 0x14, 0x0e, 0x0b, 0x0e, 0x14, 0x1e, 0x2a, 0x37, 0x45, 0x53, 0x62, 0x71, 0x80, 0x8f, 0x9f, 
+0xae, 0xbe, 0xcd, 0xff, 0xff, 0xcb, 0xbb, 0xab, 0x9b, 0x8b, 0x7c, 0x6c, 0x5d, 0x4d, 0x3e, 0x2f, 
+0x21, 0x14, 0x08, 0x00, 0x00, 0x00, 0x08, 0x14, 0x21, 0x2f, 0x3e, 0x4d, 0x5d, 0x6c, 0x7c, 0x8b, 
+0x9b, 0xab, 0xbb, 0xcb, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x89, 0x79, 0x69, 0x59, 0x4a, 0x3a, 
+0x2a, 0x1b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1b, 0x2a, 0x3a, 0x4a, 0x59, 0x69, 0x79, 
+0x89, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 
+0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 
+0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 
+0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 
+0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 
+0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 0x48, 
+0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 
+0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 0x38, 
+0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 
+0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x28, 
+0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 
+0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 
+0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 
+0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 
+0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 
+0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 
+0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 
+0x03, 0x0b, 0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 
+0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 
+0x10, 0x12, 0x18, 0x22, 0x2d, 0x3a, 0x47, 0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 
+0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x79, 0x6b, 0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 
+0x22, 0x20, 0x22, 0x27, 0x2f, 0x38, 0x44, 0x50, 0x5d, 0x6b, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 
+0xd3, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 0x8f, 0x81, 0x73, 0x66, 0x5a, 0x4f, 0x45, 0x3c, 
+0x36, 0x31, 0x30, 0x31, 0x36, 0x3c, 0x45, 0x4f, 0x5a, 0x66, 0x73, 0x81, 0x8f, 0x9d, 0xab, 0xba, 
+0xc9, 0xd8, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 
+0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 0x5b, 0x66, 0x71, 0x7d, 0x8a, 0x97, 0xa4, 0xb2, 
+0xc1, 0xcf, 0xde, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 0xa0, 0x93, 0x87, 0x7c, 0x72, 0x68, 
+0x60, 0x59, 0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 0x60, 0x68, 0x72, 0x7c, 0x87, 0x93, 0xa0, 0xad, 
+0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 0xb6, 0xaa, 0x9e, 0x93, 0x88, 0x7e, 
+0x76, 0x6e, 0x68, 0x64, 0x61, 0x60, 0x61, 0x64, 0x68, 0x6e, 0x76, 0x7e, 0x88, 0x93, 0x9e, 0xaa, 
+0xb6, 0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xf4, 0xe7, 0xda, 0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 
+0x8c, 0x84, 0x7d, 0x77, 0x73, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 
+0xb5, 0xc1, 0xcd, 0xda, 0xe7, 0xf4, 0xff, 0xff, 0xfd, 0xf0, 0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 
+0xa2, 0x99, 0x92, 0x8c, 0x87, 0x83, 0x81, 0x80, 0x81, 0x83, 0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 
+0xb5, 0xc0, 0xcb, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 
+0xb8, 0xaf, 0xa8, 0xa1, 0x9b, 0x96, 0x93, 0x91, 0x90, 0x91, 0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 
+0xb8, 0xc2, 0xcc, 0xd7, 0xe2, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xed, 0xe2, 0xd8, 
+0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 0xa6, 0xa3, 0xa1, 0xa0, 0xa1, 0xa3, 0xa6, 0xaa, 0xaf, 0xb6, 
+0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xef, 
+0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 0xb2, 0xb1, 0xb0, 0xb1, 0xb2, 0xb5, 0xb9, 0xbe, 
+0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 0xc5, 0xc2, 0xc1, 0xc0, 0xc1, 0xc2, 0xc5, 0xc9, 
+0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xfb, 0xf2, 0xe9, 0xe1, 0xda, 0xd3, 0xcd, 0xc9, 0xc5, 0xc2, 0xc1, 0xc0, 0xc1, 
+0xc2, 0xc5, 0xc9, 0xcd, 0xd3, 0xda, 0xe1, 0xe9, 0xf2, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf9, 0xef, 0xe5, 0xdc, 0xd3, 0xcb, 0xc4, 0xbe, 0xb9, 0xb5, 0xb2, 0xb1, 0xb0, 
+0xb1, 0xb2, 0xb5, 0xb9, 0xbe, 0xc4, 0xcb, 0xd3, 0xdc, 0xe5, 0xef, 0xf9, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf9, 0xed, 0xe2, 0xd8, 0xce, 0xc5, 0xbd, 0xb6, 0xaf, 0xaa, 0xa6, 0xa3, 0xa1, 
+0xa0, 0xa1, 0xa3, 0xa6, 0xaa, 0xaf, 0xb6, 0xbd, 0xc5, 0xce, 0xd8, 0xe2, 0xed, 0xf9, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xfa, 0xee, 0xe2, 0xd7, 0xcc, 0xc2, 0xb8, 0xaf, 0xa8, 0xa1, 0x9b, 0x96, 0x93, 
+0x91, 0x90, 0x91, 0x93, 0x96, 0x9b, 0xa1, 0xa8, 0xaf, 0xb8, 0xc2, 0xcc, 0xd7, 0xe2, 0xee, 0xfa, 
+0xff, 0xff, 0xff, 0xfd, 0xf0, 0xe3, 0xd7, 0xcb, 0xc0, 0xb5, 0xab, 0xa2, 0x99, 0x92, 0x8c, 0x87, 
+0x83, 0x81, 0x80, 0x81, 0x83, 0x87, 0x8c, 0x92, 0x99, 0xa2, 0xab, 0xb5, 0xc0, 0xcb, 0xd7, 0xe3, 
+0xf0, 0xfd, 0xff, 0xff, 0xf4, 0xe7, 0xda, 0xcd, 0xc1, 0xb5, 0xa9, 0x9f, 0x95, 0x8c, 0x84, 0x7d, 
+0x77, 0x73, 0x71, 0x70, 0x71, 0x73, 0x77, 0x7d, 0x84, 0x8c, 0x95, 0x9f, 0xa9, 0xb5, 0xc1, 0xcd, 
+0xda, 0xe7, 0xf4, 0xff, 0xff, 0xec, 0xde, 0xd1, 0xc3, 0xb6, 0xaa, 0x9e, 0x93, 0x88, 0x7e, 0x76, 
+0x6e, 0x68, 0x64, 0x61, 0x60, 0x61, 0x64, 0x68, 0x6e, 0x76, 0x7e, 0x88, 0x93, 0x9e, 0xaa, 0xb6, 
+0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 0xa0, 0x93, 0x87, 0x7c, 0x72, 
+0x68, 0x60, 0x59, 0x54, 0x51, 0x50, 0x51, 0x54, 0x59, 0x60, 0x68, 0x72, 0x7c, 0x87, 0x93, 0xa0, 
+0xad, 0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 0x8a, 0x7d, 0x71, 
+0x66, 0x5b, 0x52, 0x4b, 0x45, 0x41, 0x40, 0x41, 0x45, 0x4b, 0x52, 0x5b, 0x66, 0x71, 0x7d, 0x8a, 
+0x97, 0xa4, 0xb2, 0xc1, 0xcf, 0xde, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 0x8f, 0x81, 0x73, 
+0x66, 0x5a, 0x4f, 0x45, 0x3c, 0x36, 0x31, 0x30, 0x31, 0x36, 0x3c, 0x45, 0x4f, 0x5a, 0x66, 0x73, 
+0x81, 0x8f, 0x9d, 0xab, 0xba, 0xc9, 0xd8, 0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x79, 
+0x6b, 0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 0x22, 0x20, 0x22, 0x27, 0x2f, 0x38, 0x44, 0x50, 0x5d, 
+0x6b, 0x79, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd3, 0xff, 0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 
+0x73, 0x64, 0x55, 0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 0x10, 0x12, 0x18, 0x22, 0x2d, 0x3a, 0x47, 
+0x55, 0x64, 0x73, 0x82, 0x91, 0xa0, 0xaf, 0xbf, 0xce, 0xff, 0xff, 0xcb, 0xbc, 0xac, 0x9c, 0x8c, 
+0x7d, 0x6d, 0x5e, 0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 0x03, 0x0b, 0x16, 0x23, 0x31, 
+0x40, 0x4f, 0x5e, 0x6d, 0x7d, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 
+0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 
+0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 
+0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
+0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc8, 0xb8, 
+0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x48, 0x38, 0x28, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x09, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xc9, 
+0xb9, 0xa9, 0x99, 0x8a, 0x7a, 0x6a, 0x5a, 0x4b, 0x3b, 0x2c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0e, 0x1c, 0x2c, 0x3b, 0x4b, 0x5a, 0x6a, 0x7a, 0x8a, 0x99, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 
+0xcb, 0xbc, 0xac, 0x9c, 0x8c, 0x7d, 0x6d, 0x5e, 0x4f, 0x40, 0x31, 0x23, 0x16, 0x0b, 0x03, 0x00, 
+0x03, 0x0b, 0x16, 0x23, 0x31, 0x40, 0x4f, 0x5e, 0x6d, 0x7c, 0x8c, 0x9c, 0xac, 0xbc, 0xcb, 0xff, 
+0xff, 0xce, 0xbf, 0xaf, 0xa0, 0x91, 0x82, 0x73, 0x64, 0x55, 0x47, 0x3a, 0x2d, 0x22, 0x18, 0x12, 
+0x10, 0x12, 0x18, 0x22, 0x2d, 0x39, 0x46, 0x54, 0x62, 0x70, 0x7f, 0x8e, 0xa0, 0xaf, 0xbf, 0xce, 
+0xff, 0xff, 0xd3, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x79, 0x6b, 0x5d, 0x50, 0x44, 0x38, 0x2f, 0x27, 
+0x22, 0x20, 0x22, 0x26, 0x2d, 0x35, 0x40, 0x4b, 0x58, 0x66, 0x74, 0x82, 0x91, 0xa5, 0xb4, 0xc3, 
+0xd3, 0xff, 0xff, 0xd8, 0xc9, 0xba, 0xab, 0x9d, 0x8f, 0x81, 0x73, 0x66, 0x5a, 0x4f, 0x45, 0x3c, 
+0x36, 0x31, 0x2f, 0x2f, 0x30, 0x34, 0x3a, 0x44, 0x50, 0x5c, 0x6a, 0x78, 0x86, 0x94, 0xab, 0xba, 
+0xc9, 0xd8, 0xff, 0xff, 0xde, 0xcf, 0xc1, 0xb2, 0xa4, 0x97, 0x8a, 0x7d, 0x71, 0x66, 0x5b, 0x52, 
+0x4a, 0x44, 0x3f, 0x3c, 0x39, 0x36, 0x36, 0x3c, 0x47, 0x53, 0x60, 0x6e, 0x7c, 0x8a, 0x98, 0xb2, 
+0xc1, 0xcf, 0xde, 0xff, 0xff, 0xe4, 0xd6, 0xc8, 0xba, 0xad, 0xa0, 0x93, 0x87, 0x7c, 0x71, 0x68, 
+0x5f, 0x57, 0x50, 0x4b, 0x45, 0x40, 0x3b, 0x34, 0x3e, 0x4b, 0x58, 0x65, 0x73, 0x81, 0x8f, 0x9d, 
+0xba, 0xc8, 0xd6, 0xe4, 0xff, 0xff, 0xec, 0xde, 0xd0, 0xc3, 0xb6, 0xa9, 0x9d, 0x92, 0x87, 0x7c, 
+0x73, 0x6a, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3d, 0x3a, 0x46, 0x52, 0x5f, 0x6c, 0x79, 0x87, 0x95, 
+0xa3, 0xc3, 0xd1, 0xde, 0xec, 0xff, 0xff, 0xf3, 0xe5, 0xd8, 0xcb, 0xbe, 0xb2, 0xa6, 0x9b, 0x90, 
+0x85, 0x7b, 0x72, 0x69, 0x60, 0x58, 0x4f, 0x46, 0x3c, 0x43, 0x4f, 0x5c, 0x68, 0x74, 0x81, 0x8e, 
+0x9c, 0xa9, 0xcd, 0xda, 0xe7, 0xf4, 0xff, 0xff, 0xf9, 0xeb, 0xde, 0xd2, 0xc5, 0xb9, 0xad, 0xa2, 
+0x97, 0x8c, 0x82, 0x78, 0x6e, 0x64, 0x5a, 0x50, 0x45, 0x3f, 0x4c, 0x58, 0x65, 0x71, 0x7d, 0x8a, 
+0x97, 0xa4, 0xb1, 0xd7, 0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xfe, 0xf1, 0xe4, 0xd7, 0xcb, 0xbf, 0xb3, 
+0xa7, 0x9c, 0x91, 0x86, 0x7b, 0x70, 0x65, 0x5a, 0x4e, 0x40, 0x47, 0x54, 0x61, 0x6e, 0x7a, 0x87, 
+0x93, 0xa0, 0xad, 0xb9, 0xe2, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe8, 0xdb, 0xcf, 0xc2, 
+0xb6, 0xaa, 0x9e, 0x93, 0x87, 0x7b, 0x6f, 0x63, 0x56, 0x48, 0x40, 0x4e, 0x5c, 0x69, 0x76, 0x83, 
+0x90, 0x9c, 0xa9, 0xb6, 0xc2, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xea, 0xdd, 0xd1, 
+0xc4, 0xb8, 0xab, 0x9f, 0x92, 0x86, 0x79, 0x6c, 0x5e, 0x50, 0x41, 0x47, 0x55, 0x64, 0x71, 0x7f, 
+0x8c, 0x98, 0xa5, 0xb2, 0xbf, 0xcb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xeb, 0xde, 
+0xd1, 0xc4, 0xb7, 0xaa, 0x9d, 0x90, 0x82, 0x74, 0x66, 0x57, 0x49, 0x3f, 0x4e, 0x5c, 0x6b, 0x79, 
+0x87, 0x94, 0xa1, 0xae, 0xbb, 0xc7, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 
+0xe1, 0xd2, 0xc4, 0xb5, 0xa7, 0x98, 0x8a, 0x7c, 0x6d, 0x5f, 0x50, 0x42, 0x46, 0x55, 0x63, 0x71, 
+0x80, 0x8e, 0x9d, 0xab, 0xba, 0xc8, 0xd7, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 
+0xe8, 0xda, 0xcb, 0xbd, 0xae, 0xa0, 0x92, 0x83, 0x75, 0x66, 0x58, 0x49, 0x3f, 0x4d, 0x5c, 0x6a, 
+0x78, 0x87, 0x95, 0xa4, 0xb2, 0xc1, 0xcf, 0xdd, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 
+0xf0, 0xe1, 0xd3, 0xc4, 0xb6, 0xa7, 0x99, 0x8b, 0x7c, 0x6e, 0x5f, 0x51, 0x42, 0x46, 0x54, 0x62, 
+0x71, 0x7f, 0x8e, 0x9c, 0xab, 0xb9, 0xc7, 0xd6, 0xe4, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf7, 0xe9, 0xda, 0xcc, 0xbd, 0xaf, 0xa1, 0x92, 0x84, 0x75, 0x67, 0x58, 0x4a, 0x3e, 0x4c, 0x5b, 
+0x69, 0x78, 0x86, 0x95, 0xa3, 0xb2, 0xc0, 0xce, 0xdd, 0xeb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf0, 0xe2, 0xd3, 0xc5, 0xb7, 0xa8, 0x9a, 0x8b, 0x7d, 0x6e, 0x60, 0x51, 0x43, 0x45, 0x53, 
+0x62, 0x70, 0x7f, 0x8d, 0x9c, 0xaa, 0xb8, 0xc7, 0xd5, 0xe4, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xe9, 0xdb, 0xcc, 0xbe, 0xb0, 0xa1, 0x93, 0x84, 0x76, 0x67, 0x59, 0x4b, 0x3d, 0x4c, 
+0x5a, 0x69, 0x77, 0x86, 0x94, 0xa2, 0xb1, 0xbf, 0xce, 0xdc, 0xeb, 0xf9, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xe2, 0xd4, 0xc6, 0xb7, 0xa9, 0x9a, 0x8c, 0x7d, 0x6f, 0x61, 0x52, 0x44, 0x44, 
+0x53, 0x61, 0x70, 0x7e, 0x8d, 0x9b, 0xa9, 0xb8, 0xc6, 0xd5, 0xe3, 0xf2, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xdc, 0xcd, 0xbf, 0xb0, 0xa2, 0x93, 0x85, 0x76, 0x68, 0x5a, 0x4b, 0x3d, 
+0x4b, 0x5a, 0x68, 0x77, 0x85, 0x93, 0xa2, 0xb0, 0xbf, 0xcd, 0xdc, 0xea, 0xf8, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xc6, 0xb8, 0xa9, 0x9b, 0x8c, 0x7e, 0x70, 0x61, 0x53, 0x44, 
+0x44, 0x52, 0x61, 0x6f, 0x7d, 0x8c, 0x9a, 0xa9, 0xb7, 0xc6, 0xd4, 0xe2, 0xf1, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc0, 0xb1, 0xa2, 0x94, 0x86, 0x77, 0x69, 0x5a, 0x4c, 
+0x3d, 0x4b, 0x59, 0x68, 0x76, 0x84, 0x93, 0xa1, 0xb0, 0xbe, 0xcd, 0xdb, 0xe9, 0xf8, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xbb, 0xac, 0x9c, 0x8d, 0x7f, 0x70, 0x62, 0x53, 
+0x45, 0x43, 0x52, 0x60, 0x6e, 0x7d, 0x8b, 0x9a, 0xa8, 0xb7, 0xc5, 0xd3, 0xe2, 0xf0, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x99, 0x89, 0x79, 0x6a, 0x5b, 
+0x4c, 0x3e, 0x4a, 0x58, 0x67, 0x75, 0x84, 0x92, 0xa1, 0xaf, 0xbd, 0xcc, 0xda, 0xe9, 0xf7, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 
+0x58, 0x48, 0x43, 0x51, 0x5f, 0x6e, 0x7c, 0x8b, 0x99, 0xa8, 0xb6, 0xc4, 0xd3, 0xe1, 0xf0, 0xfe, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xb9, 0xaa, 0x9a, 0x8a, 0x7b, 
+0x6c, 0x5e, 0x53, 0x51, 0x59, 0x66, 0x75, 0x83, 0x92, 0xa0, 0xae, 0xbd, 0xcb, 0xda, 0xe8, 0xf7, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xbd, 0xae, 0x9f, 0x90, 
+0x82, 0x75, 0x69, 0x62, 0x60, 0x66, 0x70, 0x7c, 0x8a, 0x98, 0xa7, 0xb5, 0xc4, 0xd2, 0xe1, 0xef, 
+0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc2, 0xb4, 0xa5, 
+0x98, 0x8b, 0x80, 0x77, 0x71, 0x70, 0x74, 0x7c, 0x86, 0x93, 0xa0, 0xae, 0xbc, 0xcb, 0xd9, 0xe8, 
+0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xc9, 0xbb, 
+0xae, 0xa2, 0x96, 0x8d, 0x85, 0x81, 0x80, 0x83, 0x89, 0x92, 0x9d, 0xa9, 0xb6, 0xc4, 0xd2, 0xe0, 
+0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd1, 
+0xc4, 0xb8, 0xad, 0xa3, 0x9b, 0x94, 0x91, 0x90, 0x93, 0x98, 0x9f, 0xa9, 0xb4, 0xc0, 0xcc, 0xda, 
+0xe7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 
+0xdb, 0xcf, 0xc4, 0xb9, 0xb0, 0xa9, 0xa4, 0xa1, 0xa0, 0xa2, 0xa7, 0xad, 0xb6, 0xbf, 0xca, 0xd6, 
+0xe3, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf1, 0xe5, 0xda, 0xd0, 0xc6, 0xbe, 0xb8, 0xb3, 0xb1, 0xb0, 0xb2, 0xb6, 0xbc, 0xc3, 0xcc, 0xd6, 
+0xe1, 0xed, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xfc, 0xf1, 0xe6, 0xdd, 0xd4, 0xcd, 0xc7, 0xc3, 0xc0, 0xc0, 0xc2, 0xc5, 0xca, 0xd1, 0xd9, 
+0xe2, 0xec, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xea, 0xe0, 0xd8, 0xd1, 0xcc, 0xc9, 
+0xc8, 0xc9, 0xcc, 0xd1, 0xd8, 0xe0, 0xea, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xde, 0xd3, 0xca, 0xc3, 0xbd, 
+0xb9, 0xb8, 0xb9, 0xbd, 0xc3, 0xca, 0xd3, 0xde, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xd2, 0xc7, 0xbd, 0xb4, 
+0xae, 0xa9, 0xa8, 0xa9, 0xae, 0xb4, 0xbd, 0xc7, 0xd2, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xc8, 0xbc, 0xb0, 
+0xa7, 0x9f, 0x9a, 0x98, 0x9a, 0x9f, 0xa7, 0xb0, 0xbc, 0xc8, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xbf, 0xb2, 
+0xa5, 0x9a, 0x90, 0x8a, 0x88, 0x8a, 0x90, 0x9a, 0xa5, 0xb2, 0xbf, 0xcd, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xb8, 
+0xa9, 0x9b, 0x8e, 0x83, 0x7b, 0x78, 0x7b, 0x83, 0x8e, 0x9b, 0xa9, 0xb8, 0xc7, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 
+0xb3, 0xa4, 0x94, 0x86, 0x78, 0x6d, 0x68, 0x6d, 0x78, 0x86, 0x94, 0xa4, 0xb3, 0xc3, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xc0, 0xb0, 0xa0, 0x90, 0x81, 0x71, 0x62, 0x58, 0x62, 0x71, 0x81, 0x90, 0xa0, 0xb0, 0xc0, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xc0, 0xb0, 0xa0, 0x90, 0x81, 0x71, 0x62, 0x58, 0x62, 0x71, 0x81, 0x90, 0xa0, 0xb0, 0xc0, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xbe, 0xb0, 0xa1, 0x93, 0x85, 0x78, 0x6d, 0x68, 0x6d, 0x78, 0x85, 0x93, 0xa1, 0xb0, 
+0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xbf, 0xb1, 0xa3, 0x97, 0x8b, 0x81, 0x79, 0x76, 0x79, 0x81, 0x8b, 0x97, 0xa3, 
+0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xbf, 0xb2, 0xa5, 0x99, 0x8f, 0x87, 0x81, 0x7f, 0x81, 0x87, 0x8f, 0x99, 
+0xa5, 0xb2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb2, 0xa6, 0x9a, 0x91, 0x89, 0x84, 0x82, 0x84, 0x89, 0x91, 
+0x9a, 0xa6, 0xb2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb2, 0xa5, 0x99, 0x8f, 0x87, 0x81, 0x7f, 0x81, 0x87, 
+0x8f, 0x99, 0xa5, 0xb2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb1, 0xa3, 0x97, 0x8b, 0x81, 0x79, 0x76, 0x79, 
+0x81, 0x8b, 0x97, 0xa3, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xb0, 0xa1, 0x93, 0x85, 0x78, 0x6d, 0x68, 
+0x6d, 0x78, 0x85, 0x93, 0xa1, 0xb0, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb0, 0xa0, 0x90, 0x81, 0x71, 0x62, 
+0x58, 0x62, 0x71, 0x81, 0x90, 0xa0, 0xb0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb0, 0xa0, 0x90, 0x81, 0x71, 
+0x62, 0x58, 0x62, 0x71, 0x81, 0x90, 0xa0, 0xb0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xb3, 0xa4, 0x94, 0x86, 
+0x78, 0x6d, 0x68, 0x6d, 0x78, 0x86, 0x94, 0xa4, 0xb3, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xb8, 0xa9, 0x9b, 
+0x8e, 0x83, 0x7b, 0x78, 0x7b, 0x83, 0x8e, 0x9b, 0xa9, 0xb8, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xbf, 0xb2, 
+0xa5, 0x9a, 0x90, 0x8a, 0x88, 0x8a, 0x90, 0x9a, 0xa5, 0xb2, 0xbf, 0xcd, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xc8, 
+0xbc, 0xb0, 0xa7, 0x9f, 0x9a, 0x98, 0x9a, 0x9f, 0xa7, 0xb0, 0xbc, 0xc8, 0xd5, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 
+0xd2, 0xc7, 0xbd, 0xb4, 0xae, 0xa9, 0xa8, 0xa9, 0xae, 0xb4, 0xbd, 0xc7, 0xd2, 0xde, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xe9, 0xde, 0xd3, 0xca, 0xc3, 0xbd, 0xb9, 0xb8, 0xb9, 0xbd, 0xc3, 0xca, 0xd3, 0xde, 0xe9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf4, 0xea, 0xe0, 0xd8, 0xd1, 0xcc, 0xc9, 0xc8, 0xc9, 0xcc, 0xd1, 0xd8, 0xe0, 0xea, 0xf4, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf4, 0xe9, 0xde, 0xd5, 0xcd, 0xc7, 0xc3, 0xc0, 0xc0, 0xc3, 0xc7, 0xcd, 0xd5, 
+0xde, 0xe9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf6, 0xea, 0xde, 0xd2, 0xc8, 0xbf, 0xb8, 0xb3, 0xb0, 0xb0, 0xb3, 0xb8, 0xbf, 
+0xc8, 0xd2, 0xde, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xfc, 0xee, 0xe0, 0xd3, 0xc7, 0xbc, 0xb2, 0xa9, 0xa4, 0xa0, 0xa0, 0xa4, 0xa9, 
+0xb2, 0xbc, 0xc7, 0xd3, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf5, 0xe6, 0xd8, 0xca, 0xbd, 0xb0, 0xa5, 0x9b, 0x94, 0x90, 0x90, 0x94, 
+0x9b, 0xa5, 0xb0, 0xbd, 0xca, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe0, 0xd1, 0xc3, 0xb4, 0xa7, 0x9a, 0x8e, 0x86, 0x81, 0x81, 
+0x86, 0x8e, 0x9a, 0xa7, 0xb4, 0xc3, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xdc, 0xcc, 0xbd, 0xae, 0x9f, 0x90, 0x83, 0x78, 0x71, 
+0x71, 0x78, 0x83, 0x90, 0x9f, 0xae, 0xbd, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe9, 0xd9, 0xc9, 0xb9, 0xa9, 0x9a, 0x8a, 0x7b, 0x6d, 
+0x62, 0x62, 0x6d, 0x7b, 0x8a, 0x9a, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xd7, 0xc7, 0xb7, 0xa7, 0x97, 0x87, 0x78, 
+0x68, 0x58, 0x58, 0x68, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe4, 0xd5, 0xc5, 0xb5, 0xa5, 0x95, 0x85, 
+0x75, 0x66, 0x56, 0x5a, 0x6a, 0x7a, 0x8a, 0x9a, 0xa9, 0xb9, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe2, 0xd2, 0xc2, 0xb3, 0xa3, 0x93, 
+0x83, 0x73, 0x63, 0x54, 0x5c, 0x6c, 0x7c, 0x8c, 0x9c, 0xac, 0xbb, 0xcb, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xe0, 0xd0, 0xc0, 0xb0, 0xa1, 
+0x91, 0x81, 0x71, 0x61, 0x51, 0x5f, 0x6e, 0x7e, 0x8e, 0x9e, 0xae, 0xbe, 0xcd, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xee, 0xde, 0xce, 0xbe, 0xae, 
+0x9e, 0x8f, 0x7f, 0x6f, 0x5f, 0x51, 0x61, 0x71, 0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xeb, 0xdc, 0xcc, 0xbc, 
+0xac, 0x9c, 0x8c, 0x7c, 0x6d, 0x5d, 0x53, 0x63, 0x73, 0x83, 0x92, 0xa2, 0xb2, 0xc2, 0xd2, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe9, 0xd9, 0xca, 
+0xba, 0xaa, 0x9a, 0x8a, 0x7a, 0x6a, 0x5b, 0x55, 0x65, 0x75, 0x85, 0x95, 0xa5, 0xb4, 0xc4, 0xd4, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe7, 0xd7, 
+0xc7, 0xb7, 0xa8, 0x98, 0x88, 0x78, 0x68, 0x58, 0x57, 0x67, 0x77, 0x87, 0x97, 0xa7, 0xb7, 0xc6, 
+0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xe5, 
+0xd5, 0xc5, 0xb5, 0xa5, 0x96, 0x86, 0x76, 0x66, 0x56, 0x5a, 0x6a, 0x79, 0x89, 0x99, 0xa9, 0xb9, 
+0xc9, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 
+0xe3, 0xd3, 0xc3, 0xb3, 0xa3, 0x93, 0x84, 0x74, 0x64, 0x54, 0x5c, 0x6c, 0x7c, 0x8b, 0x9b, 0xab, 
+0xbb, 0xcb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf0, 0xe0, 0xd1, 0xc1, 0xb1, 0xa1, 0x91, 0x81, 0x71, 0x62, 0x52, 0x5e, 0x6e, 0x7e, 0x8e, 0x9d, 
+0xad, 0xbd, 0xcd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfe, 0xee, 0xde, 0xce, 0xbe, 0xaf, 0x9f, 0x8f, 0x7f, 0x6f, 0x5f, 0x50, 0x60, 0x70, 0x80, 0x90, 
+0xa0, 0xb0, 0xbf, 0xcf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xfc, 0xec, 0xdc, 0xcc, 0xbc, 0xac, 0x9d, 0x8d, 0x7d, 0x6d, 0x5d, 0x53, 0x62, 0x72, 0x82, 
+0x92, 0xa2, 0xb2, 0xc2, 0xd1, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf9, 0xea, 0xda, 0xca, 0xba, 0xaa, 0x9a, 0x8b, 0x7b, 0x6b, 0x5b, 0x55, 0x65, 0x75, 
+0x84, 0x94, 0xa4, 0xb4, 0xc4, 0xd4, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf7, 0xe7, 0xd8, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x69, 0x59, 0x57, 0x67, 
+0x77, 0x87, 0x96, 0xa6, 0xb6, 0xc6, 0xd6, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xf5, 0xe5, 0xd5, 0xc6, 0xb6, 0xa6, 0x96, 0x86, 0x76, 0x66, 0x57, 0x59, 
+0x69, 0x79, 0x89, 0x99, 0xa8, 0xb8, 0xc8, 0xd8, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe3, 0xd3, 0xc3, 0xb3, 0xa4, 0x94, 0x84, 0x74, 0x64, 0x54, 
+0x5b, 0x6b, 0x7b, 0x8b, 0x9b, 0xab, 0xbb, 0xca, 0xda, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xe1, 0xd1, 0xc1, 0xb1, 0xa1, 0x92, 0x82, 0x72, 0x62, 
+0x52, 0x5e, 0x6d, 0x7d, 0x8d, 0x9d, 0xad, 0xbd, 0xcd, 0xdc, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xdf, 0xcf, 0xbf, 0xaf, 0x9f, 0x8f, 0x80, 0x70, 
+0x60, 0x50, 0x60, 0x70, 0x80, 0x8f, 0x9f, 0xaf, 0xbf, 0xcf, 0xdf, 0xee, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xdc, 0xcd, 0xbd, 0xad, 0x9d, 0x8d, 0x7d, 
+0x6d, 0x5e, 0x52, 0x62, 0x72, 0x82, 0x92, 0xa1, 0xb1, 0xc1, 0xd1, 0xe1, 0xf1, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xda, 0xca, 0xbb, 0xab, 0x9b, 0x8b, 
+0x7b, 0x6b, 0x5b, 0x54, 0x64, 0x74, 0x84, 0x94, 0xa4, 0xb3, 0xc3, 0xd3, 0xe3, 0xf3, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xd8, 0xc8, 0xb8, 0xa8, 0x99, 
+0x89, 0x79, 0x69, 0x59, 0x57, 0x66, 0x76, 0x86, 0x96, 0xa6, 0xb6, 0xc6, 0xd5, 0xe5, 0xf5, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xd6, 0xc6, 0xb6, 0xa6, 
+0x96, 0x87, 0x77, 0x67, 0x57, 0x59, 0x69, 0x78, 0x88, 0x98, 0xa8, 0xb8, 0xc8, 0xd8, 0xe7, 0xf7, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xd4, 0xc4, 0xb4, 
+0xa4, 0x94, 0x84, 0x75, 0x65, 0x55, 0x5b, 0x6b, 0x7b, 0x8b, 0x9a, 0xaa, 0xba, 0xca, 0xda, 0xea, 
+0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xd1, 0xc2, 
+0xb2, 0xa2, 0x92, 0x82, 0x72, 0x62, 0x53, 0x5d, 0x6d, 0x7d, 0x8d, 0x9d, 0xac, 0xbc, 0xcc, 0xdc, 
+0xec, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcf, 
+0xbf, 0xb0, 0xa0, 0x90, 0x80, 0x70, 0x60, 0x50, 0x5f, 0x6f, 0x7f, 0x8f, 0x9f, 0xaf, 0xbe, 0xce, 
+0xde, 0xee, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 
+0xcd, 0xbd, 0xad, 0x9d, 0x8e, 0x7e, 0x6e, 0x5e, 0x52, 0x62, 0x71, 0x81, 0x91, 0xa1, 0xb1, 0xc1, 
+0xd1, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xdb, 0xcb, 0xbb, 0xab, 0x9b, 0x8b, 0x7c, 0x6c, 0x5c, 0x54, 0x64, 0x74, 0x84, 0x93, 0xa3, 0xb3, 
+0xc3, 0xd3, 0xe3, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xd8, 0xc9, 0xb9, 0xa9, 0x99, 0x89, 0x79, 0x6a, 0x5a, 0x56, 0x66, 0x76, 0x86, 0x96, 0xa5, 
+0xb5, 0xc5, 0xd5, 0xe5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xd6, 0xc6, 0xb7, 0xa7, 0x97, 0x87, 0x77, 0x67, 0x57, 0x58, 0x68, 0x78, 0x88, 0x98, 
+0xa8, 0xb7, 0xc7, 0xd7, 0xe7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xd4, 0xc4, 0xb4, 0xa5, 0x95, 0x85, 0x75, 0x65, 0x55, 0x5b, 0x6a, 0x7a, 0x8a, 
+0x9a, 0xaa, 0xba, 0xca, 0xd9, 0xe9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xd2, 0xc2, 0xb2, 0xa2, 0x92, 0x83, 0x73, 0x63, 0x53, 0x5d, 0x6d, 0x7c, 
+0x8c, 0x9c, 0xac, 0xbc, 0xcc, 0xdc, 0xeb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xc0, 0xb0, 0xa0, 0x90, 0x80, 0x71, 0x61, 0x51, 0x5f, 0x6f, 
+0x7f, 0x8f, 0x9e, 0xae, 0xbe, 0xce, 0xde, 0xee, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xbe, 0xae, 0x9e, 0x8e, 0x7e, 0x6e, 0x5f, 0x51, 0x61, 
+0x71, 0x81, 0x91, 0xa1, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xbb, 0xac, 0x9c, 0x8c, 0x7c, 0x6c, 0x5c, 0x54, 
+0x63, 0x73, 0x83, 0x93, 0xa3, 0xb3, 0xc2, 0xd2, 0xe2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x9a, 0x8a, 0x7a, 0x6a, 0x5a, 
+0x56, 0x66, 0x75, 0x85, 0x95, 0xa5, 0xb5, 0xc5, 0xd5, 0xe4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xb8, 0xa8, 0x98, 0x88, 0x78, 0x68, 
+0x58, 0x58, 0x68, 0x78, 0x87, 0x97, 0xa7, 0xb7, 0xc7, 0xd7, 0xe7, 0xf6, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xb9, 0xa9, 0x9a, 0x8a, 0x7b, 
+0x6d, 0x62, 0x62, 0x6d, 0x7b, 0x8a, 0x9a, 0xa9, 0xb9, 0xc9, 0xd9, 0xe9, 0xf9, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xbd, 0xae, 0x9f, 0x90, 
+0x83, 0x78, 0x71, 0x71, 0x78, 0x83, 0x90, 0x9f, 0xae, 0xbd, 0xcc, 0xdc, 0xeb, 0xfb, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc3, 0xb4, 0xa7, 
+0x9a, 0x8e, 0x86, 0x81, 0x81, 0x86, 0x8e, 0x9a, 0xa7, 0xb4, 0xc3, 0xd1, 0xe0, 0xef, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xca, 0xbd, 
+0xb0, 0xa5, 0x9b, 0x94, 0x90, 0x90, 0x94, 0x9b, 0xa5, 0xb0, 0xbd, 0xca, 0xd8, 0xe6, 0xf5, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xd3, 
+0xc7, 0xbc, 0xb2, 0xa9, 0xa4, 0xa0, 0xa0, 0xa4, 0xa9, 0xb2, 0xbc, 0xc7, 0xd3, 0xe0, 0xee, 0xfc, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 
+0xde, 0xd2, 0xc8, 0xbf, 0xb8, 0xb3, 0xb0, 0xb0, 0xb3, 0xb8, 0xbf, 0xc8, 0xd2, 0xde, 0xea, 0xf6, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xf4, 0xe9, 0xde, 0xd5, 0xcd, 0xc7, 0xc3, 0xc0, 0xc0, 0xc3, 0xc7, 0xcd, 0xd5, 0xde, 0xe9, 0xf4, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, };
+
+// 12 glyphs of 17 x 27 samples, one every 4 pixels.
+const unsigned char GlyphAtlas4[] PROGMEM = {
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 0xc4, 0xb9, 0xb2, 0xb0, 0xb2, 0xb9, 0xc4, 0xd3, 0xe5, 0xf9, 
+0xff, 0xff, 0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 0x9b, 0x93, 0x90, 0x93, 0x9b, 0xa8, 0xb8, 0xcc, 
+0xe2, 0xfa, 0xff, 0xff, 0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 0x73, 0x70, 0x73, 0x7d, 0x8c, 0x9f, 
+0xb5, 0xcd, 0xe7, 0xff, 0xff, 0xd6, 0xba, 0xa0, 0x87, 0x72, 0x60, 0x54, 0x50, 0x54, 0x60, 0x72, 
+0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 0xc9, 0xab, 0x8f, 0x73, 0x5a, 0x45, 0x36, 0x30, 0x36, 0x45, 
+0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 0x64, 0x47, 0x2d, 0x18, 0x10, 0x18, 
+0x2d, 0x47, 0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xb9, 0x99, 0x7a, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 
+0x00, 0x1c, 0x3b, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 
+0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 
+0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 
+0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 
+0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 
+0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 
+0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 
+0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 
+0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 
+0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 
+0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 
+0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 
+0x98, 0xb8, 0xff, 0xff, 0xb9, 0x99, 0x7a, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x5a, 
+0x7a, 0x99, 0xb9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 0x64, 0x47, 0x2d, 0x18, 0x10, 0x18, 0x2d, 0x47, 
+0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xc9, 0xab, 0x8f, 0x73, 0x5a, 0x45, 0x36, 0x30, 0x36, 0x45, 
+0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xd6, 0xba, 0xa0, 0x87, 0x72, 0x60, 0x54, 0x50, 0x54, 
+0x60, 0x72, 0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 0x73, 0x70, 
+0x73, 0x7d, 0x8c, 0x9f, 0xb5, 0xcd, 0xe7, 0xff, 0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 0x9b, 0x93, 
+0x90, 0x93, 0x9b, 0xa8, 0xb8, 0xcc, 0xe2, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 0xc4, 0xb9, 
+0xb2, 0xb0, 0xb2, 0xb9, 0xc4, 0xd3, 0xe5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xd6, 0xc0, 0xad, 0xa0, 0x9a, 0x9d, 0xa8, 0xba, 0xcf, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xec, 0xc1, 0xa9, 0x93, 0x82, 0x7a, 0x7e, 0x8d, 0xa2, 0xbb, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xec, 0xd6, 0xaf, 0x95, 0x7c, 0x66, 0x5a, 0x61, 0x75, 0x8f, 0xac, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xec, 0xd6, 0xbf, 0x9e, 0x84, 0x69, 0x4f, 0x3b, 0x48, 0x65, 0x84, 0xa3, 0xff, 
+0xff, 0xff, 0xff, 0xec, 0xd6, 0xbf, 0xa8, 0x8d, 0x74, 0x5b, 0x41, 0x2c, 0x43, 0x63, 0x82, 0xa2, 
+0xff, 0xff, 0xff, 0xec, 0xd6, 0xbf, 0xa8, 0x92, 0x7a, 0x62, 0x4a, 0x39, 0x36, 0x4c, 0x69, 0x87, 
+0xa6, 0xff, 0xff, 0xec, 0xd6, 0xbf, 0xa8, 0x92, 0x7b, 0x64, 0x4e, 0x41, 0x47, 0x3d, 0x53, 0x71, 
+0x8e, 0xac, 0xff, 0xff, 0xd7, 0xbf, 0xa8, 0x92, 0x7b, 0x64, 0x4e, 0x42, 0x53, 0x52, 0x41, 0x57, 
+0x76, 0x94, 0xb2, 0xff, 0xff, 0xc6, 0xaa, 0x92, 0x7b, 0x64, 0x4e, 0x42, 0x58, 0x62, 0x5a, 0x42, 
+0x58, 0x78, 0x97, 0xb6, 0xff, 0xff, 0xbb, 0x9c, 0x7f, 0x64, 0x4e, 0x42, 0x59, 0x6c, 0x6e, 0x5f, 
+0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x42, 0x59, 0x70, 0x7c, 0x77, 
+0x61, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xbd, 0x9f, 0x82, 0x69, 0x60, 0x70, 0x84, 0x89, 
+0x7d, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xc9, 0xae, 0x96, 0x85, 0x80, 0x89, 0x95, 
+0x94, 0x81, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xdb, 0xc4, 0xb0, 0xa4, 0xa0, 0xa7, 
+0xa5, 0x9b, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xf1, 0xdd, 0xcd, 0xc3, 0xc0, 
+0xc5, 0xb3, 0xa0, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xa2, 0x82, 0x62, 0x42, 0x58, 0x78, 0x98, 0xb8, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xa3, 0x84, 0x66, 0x51, 0x5e, 0x7b, 0x9a, 
+0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xae, 0x93, 0x7c, 0x70, 0x77, 0x8b, 
+0xa5, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xc0, 0xa9, 0x98, 0x90, 0x94, 
+0xa3, 0xb8, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xd6, 0xc3, 0xb6, 0xb0, 
+0xb3, 0xbe, 0xd0, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 0xc4, 0xb9, 0xb2, 0xb0, 
+0xb2, 0xb9, 0xc4, 0xd3, 0xe5, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 0x9b, 0x93, 
+0x90, 0x93, 0x9b, 0xa8, 0xb8, 0xcc, 0xe2, 0xfa, 0xff, 0xff, 0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 
+0x73, 0x70, 0x73, 0x7d, 0x8c, 0x9f, 0xb5, 0xcd, 0xe7, 0xff, 0xff, 0xd6, 0xba, 0xa0, 0x87, 0x72, 
+0x60, 0x54, 0x50, 0x54, 0x60, 0x72, 0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 0xc9, 0xab, 0x8f, 0x73, 
+0x5a, 0x45, 0x44, 0x4a, 0x44, 0x45, 0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 
+0x64, 0x47, 0x4d, 0x61, 0x6a, 0x61, 0x4d, 0x47, 0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xb9, 0x99, 
+0x7a, 0x5a, 0x3f, 0x5d, 0x7a, 0x88, 0x79, 0x5d, 0x3f, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xb8, 
+0x98, 0x79, 0x59, 0x46, 0x62, 0x81, 0x91, 0x78, 0x5e, 0x41, 0x58, 0x77, 0x97, 0xb8, 0xff, 0xff, 
+0xbe, 0xa0, 0x84, 0x6d, 0x65, 0x73, 0x85, 0x84, 0x6a, 0x54, 0x43, 0x5b, 0x78, 0x96, 0xbc, 0xff, 
+0xff, 0xcb, 0xb1, 0x9a, 0x8a, 0x85, 0x89, 0x8b, 0x7d, 0x61, 0x4e, 0x50, 0x62, 0x7c, 0x99, 0xc3, 
+0xff, 0xff, 0xde, 0xc7, 0xb4, 0xa7, 0x9e, 0x98, 0x8d, 0x76, 0x5a, 0x3e, 0x54, 0x6c, 0x86, 0xa1, 
+0xd0, 0xff, 0xff, 0xf2, 0xdd, 0xca, 0xba, 0xac, 0x9c, 0x86, 0x69, 0x4d, 0x4a, 0x65, 0x7c, 0x94, 
+0xae, 0xe2, 0xff, 0xff, 0xff, 0xeb, 0xd6, 0xc2, 0xad, 0x94, 0x77, 0x5b, 0x3e, 0x58, 0x74, 0x8e, 
+0xa7, 0xbf, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xdc, 0xbf, 0xa2, 0x86, 0x69, 0x4d, 0x4a, 0x66, 0x83, 
+0xa0, 0xbc, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xea, 0xcd, 0xb1, 0x94, 0x77, 0x5b, 0x3e, 0x58, 0x75, 
+0x91, 0xae, 0xca, 0xe7, 0xff, 0xff, 0xff, 0xf8, 0xdc, 0xbf, 0xa2, 0x86, 0x69, 0x4d, 0x4a, 0x66, 
+0x83, 0xa0, 0xbc, 0xd9, 0xf5, 0xff, 0xff, 0xff, 0xea, 0xcd, 0xb1, 0x94, 0x77, 0x5b, 0x3e, 0x58, 
+0x75, 0x91, 0xae, 0xca, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xaf, 0x96, 0x7f, 0x68, 0x4d, 0x4a, 
+0x65, 0x7c, 0x8e, 0x9c, 0xa7, 0xb7, 0xca, 0xe1, 0xff, 0xff, 0xb8, 0x9c, 0x83, 0x6b, 0x56, 0x3e, 
+0x54, 0x68, 0x77, 0x82, 0x88, 0x8e, 0x9e, 0xb4, 0xce, 0xff, 0xff, 0xaa, 0x8c, 0x70, 0x57, 0x43, 
+0x41, 0x52, 0x5e, 0x66, 0x6a, 0x6a, 0x71, 0x87, 0xa2, 0xc0, 0xff, 0xff, 0xa3, 0x83, 0x63, 0x45, 
+0x2e, 0x3a, 0x44, 0x49, 0x4a, 0x4a, 0x4a, 0x5b, 0x79, 0x99, 0xb9, 0xff, 0xff, 0xa3, 0x84, 0x65, 
+0x48, 0x3a, 0x44, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x7b, 0x9a, 0xb9, 0xff, 0xff, 0xac, 0x8f, 
+0x75, 0x61, 0x5a, 0x60, 0x68, 0x6e, 0x70, 0x70, 0x70, 0x77, 0x8b, 0xa5, 0xc2, 0xff, 0xff, 0xbb, 
+0xa2, 0x8d, 0x7e, 0x7a, 0x7e, 0x85, 0x8b, 0x8f, 0x90, 0x90, 0x94, 0xa3, 0xb8, 0xd1, 0xff, 0xff, 
+0xcf, 0xba, 0xa8, 0x9d, 0x9a, 0x9d, 0xa2, 0xa9, 0xae, 0xb0, 0xb0, 0xb3, 0xbe, 0xd0, 0xe5, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf2, 0xde, 0xce, 0xc1, 0xb8, 0xb2, 0xb0, 0xb2, 0xb8, 0xc2, 0xd0, 0xe0, 0xf2, 
+0xff, 0xff, 0xff, 0xff, 0xdc, 0xc5, 0xb2, 0xa4, 0x99, 0x92, 0x90, 0x93, 0x9a, 0xa5, 0xb4, 0xc5, 
+0xda, 0xf0, 0xff, 0xff, 0xff, 0xca, 0xaf, 0x98, 0x87, 0x7a, 0x72, 0x70, 0x73, 0x7b, 0x88, 0x99, 
+0xac, 0xc3, 0xdb, 0xf4, 0xff, 0xff, 0xbd, 0x9f, 0x83, 0x6b, 0x5c, 0x53, 0x50, 0x54, 0x5d, 0x6c, 
+0x7f, 0x95, 0xae, 0xc7, 0xe2, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x3f, 0x46, 0x4a, 0x45, 0x41, 
+0x52, 0x68, 0x81, 0x9b, 0xb7, 0xd3, 0xff, 0xff, 0xbb, 0x9c, 0x7e, 0x63, 0x58, 0x65, 0x6a, 0x64, 
+0x54, 0x3f, 0x54, 0x6f, 0x8c, 0xa9, 0xc7, 0xff, 0xff, 0xc5, 0xa9, 0x90, 0x7e, 0x78, 0x82, 0x8a, 
+0x81, 0x6c, 0x52, 0x44, 0x62, 0x80, 0x9f, 0xbe, 0xff, 0xff, 0xd6, 0xbd, 0xa9, 0x9c, 0x98, 0x9f, 
+0xaa, 0x99, 0x7d, 0x5e, 0x3f, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xea, 0xd5, 0xc3, 0xb6, 0xaf, 
+0xad, 0xa9, 0x98, 0x80, 0x61, 0x41, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xfb, 0xe6, 0xd3, 0xbf, 
+0xa7, 0x95, 0x89, 0x81, 0x72, 0x5a, 0x3e, 0x5c, 0x7c, 0x9b, 0xbb, 0xff, 0xff, 0xff, 0xe7, 0xca, 
+0xad, 0x92, 0x7a, 0x6a, 0x64, 0x5b, 0x4a, 0x4a, 0x66, 0x84, 0xa1, 0xbf, 0xff, 0xff, 0xff, 0xdf, 
+0xc0, 0xa1, 0x82, 0x65, 0x4d, 0x46, 0x41, 0x40, 0x56, 0x6f, 0x8a, 0xa5, 0xc2, 0xff, 0xff, 0xfd, 
+0xdd, 0xbd, 0x9d, 0x7d, 0x5d, 0x3d, 0x2b, 0x36, 0x46, 0x5b, 0x73, 0x8c, 0xa7, 0xc3, 0xff, 0xff, 
+0xff, 0xdf, 0xc0, 0xa1, 0x82, 0x65, 0x4d, 0x46, 0x41, 0x40, 0x56, 0x6f, 0x8a, 0xa5, 0xc2, 0xff, 
+0xff, 0xff, 0xe7, 0xca, 0xad, 0x92, 0x7a, 0x6a, 0x64, 0x5b, 0x4a, 0x4a, 0x66, 0x84, 0xa1, 0xbf, 
+0xff, 0xff, 0xfb, 0xe6, 0xd3, 0xbf, 0xa7, 0x95, 0x89, 0x81, 0x72, 0x5a, 0x3e, 0x5c, 0x7c, 0x9b, 
+0xbb, 0xff, 0xff, 0xea, 0xd5, 0xc3, 0xb6, 0xaf, 0xad, 0xa9, 0x98, 0x80, 0x61, 0x41, 0x58, 0x78, 
+0x98, 0xb8, 0xff, 0xff, 0xd6, 0xbd, 0xa9, 0x9c, 0x98, 0x9f, 0xaa, 0x99, 0x7d, 0x5e, 0x3f, 0x5a, 
+0x7a, 0x99, 0xb9, 0xff, 0xff, 0xc5, 0xa9, 0x90, 0x7e, 0x78, 0x82, 0x8a, 0x81, 0x6c, 0x52, 0x44, 
+0x62, 0x80, 0x9f, 0xbe, 0xff, 0xff, 0xbb, 0x9c, 0x7e, 0x63, 0x58, 0x65, 0x6a, 0x64, 0x54, 0x3f, 
+0x54, 0x6f, 0x8c, 0xa9, 0xc7, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x3f, 0x46, 0x4a, 0x45, 0x41, 
+0x52, 0x68, 0x81, 0x9b, 0xb7, 0xd3, 0xff, 0xff, 0xbd, 0x9f, 0x83, 0x6b, 0x5c, 0x53, 0x50, 0x54, 
+0x5d, 0x6c, 0x7f, 0x95, 0xae, 0xc7, 0xe2, 0xff, 0xff, 0xca, 0xaf, 0x98, 0x87, 0x7a, 0x72, 0x70, 
+0x73, 0x7b, 0x88, 0x99, 0xac, 0xc3, 0xdb, 0xf4, 0xff, 0xff, 0xdc, 0xc5, 0xb2, 0xa4, 0x99, 0x92, 
+0x90, 0x93, 0x9a, 0xa5, 0xb4, 0xc5, 0xda, 0xf0, 0xff, 0xff, 0xff, 0xf2, 0xde, 0xce, 0xc1, 0xb8, 
+0xb2, 0xb0, 0xb2, 0xb8, 0xc2, 0xd0, 0xe0, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xe9, 0xd3, 0xc1, 0xb4, 0xb0, 0xb4, 0xc1, 0xd3, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf1, 0xd5, 0xbc, 0xa6, 0x96, 0x90, 0x96, 0xa6, 0xbc, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xe5, 0xc7, 0xaa, 0x8f, 0x79, 0x70, 0x79, 0x8f, 0xaa, 0xc7, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xfa, 0xdc, 0xbd, 0x9e, 0x80, 0x62, 0x50, 0x62, 0x80, 0x9f, 0xbe, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xf1, 0xd2, 0xb4, 0x95, 0x76, 0x58, 0x40, 0x5f, 0x7e, 0x9e, 0xbd, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xe8, 0xc9, 0xab, 0x8c, 0x6d, 0x4f, 0x4a, 0x68, 0x87, 0xa6, 0xc4, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xc0, 0xa1, 0x83, 0x64, 0x45, 0x53, 0x72, 0x90, 0xaf, 0xcd, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd5, 0xb7, 0x98, 0x79, 0x5b, 0x3d, 0x5c, 0x7b, 0x99, 0xb8, 
+0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xcc, 0xae, 0x8f, 0x70, 0x52, 0x47, 0x65, 0x83, 0x99, 
+0xa9, 0xb7, 0xca, 0xda, 0xee, 0xff, 0xff, 0xe2, 0xc3, 0xa4, 0x86, 0x67, 0x48, 0x50, 0x6e, 0x86, 
+0x91, 0x98, 0xa0, 0xae, 0xc1, 0xd9, 0xff, 0xff, 0xcd, 0xb2, 0x97, 0x7c, 0x5e, 0x3f, 0x59, 0x75, 
+0x7f, 0x7d, 0x7a, 0x80, 0x91, 0xa8, 0xc1, 0xff, 0xff, 0xbf, 0xa3, 0x89, 0x6f, 0x54, 0x44, 0x60, 
+0x73, 0x73, 0x67, 0x5c, 0x65, 0x7c, 0x96, 0xb3, 0xff, 0xff, 0xb2, 0x95, 0x79, 0x60, 0x48, 0x49, 
+0x5e, 0x6a, 0x66, 0x57, 0x40, 0x53, 0x6f, 0x8c, 0xaa, 0xff, 0xff, 0xa7, 0x88, 0x6b, 0x4f, 0x39, 
+0x45, 0x53, 0x5a, 0x54, 0x46, 0x37, 0x4e, 0x6a, 0x88, 0xa7, 0xff, 0xff, 0xa2, 0x82, 0x62, 0x42, 
+0x2a, 0x37, 0x3e, 0x40, 0x3b, 0x32, 0x2e, 0x49, 0x68, 0x88, 0xa8, 0xff, 0xff, 0xa5, 0x86, 0x69, 
+0x4e, 0x44, 0x4c, 0x54, 0x54, 0x4a, 0x3b, 0x3e, 0x53, 0x6f, 0x8e, 0xad, 0xff, 0xff, 0xb0, 0x94, 
+0x7c, 0x69, 0x64, 0x68, 0x6b, 0x65, 0x55, 0x3f, 0x4f, 0x65, 0x7d, 0x99, 0xb6, 0xff, 0xff, 0xc1, 
+0xa9, 0x95, 0x88, 0x84, 0x82, 0x7c, 0x6e, 0x57, 0x40, 0x5d, 0x75, 0x8d, 0xa7, 0xc3, 0xff, 0xff, 
+0xd6, 0xc1, 0xb1, 0xa7, 0x9e, 0x94, 0x85, 0x6f, 0x51, 0x48, 0x67, 0x83, 0x9d, 0xb7, 0xd1, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xa6, 0x87, 0x68, 0x49, 0x4f, 0x6e, 0x8e, 0xad, 0xcc, 0xeb, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9f, 0x80, 0x61, 0x41, 0x57, 0x76, 0x95, 0xb4, 0xd3, 
+0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa0, 0x81, 0x63, 0x50, 0x61, 0x7e, 0x9d, 0xbc, 
+0xdb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xab, 0x90, 0x7a, 0x70, 0x78, 0x8e, 0xa8, 
+0xc5, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xbd, 0xa7, 0x97, 0x90, 0x95, 0xa5, 
+0xbb, 0xd4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xd4, 0xc1, 0xb5, 0xb0, 0xb4, 
+0xc0, 0xd2, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xba, 0xa8, 0x9d, 0x9a, 0x9d, 0xa2, 
+0xa9, 0xae, 0xb0, 0xb0, 0xb3, 0xbe, 0xd0, 0xe5, 0xff, 0xff, 0xbb, 0xa2, 0x8d, 0x7e, 0x7a, 0x7e, 
+0x85, 0x8b, 0x8f, 0x90, 0x90, 0x94, 0xa3, 0xb8, 0xd1, 0xff, 0xff, 0xac, 0x8f, 0x75, 0x61, 0x5a, 
+0x60, 0x68, 0x6e, 0x70, 0x70, 0x70, 0x77, 0x8b, 0xa5, 0xc2, 0xff, 0xff, 0xa3, 0x84, 0x65, 0x48, 
+0x3a, 0x44, 0x4c, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x7b, 0x9a, 0xb9, 0xff, 0xff, 0xa2, 0x82, 0x63, 
+0x43, 0x2f, 0x3e, 0x47, 0x4a, 0x4a, 0x4a, 0x4a, 0x5b, 0x79, 0x99, 0xb9, 0xff, 0xff, 0xa6, 0x87, 
+0x69, 0x4d, 0x3b, 0x4f, 0x5e, 0x67, 0x6a, 0x6a, 0x6a, 0x71, 0x87, 0xa2, 0xc0, 0xff, 0xff, 0xac, 
+0x8e, 0x71, 0x55, 0x41, 0x5b, 0x6f, 0x7e, 0x87, 0x8a, 0x8a, 0x8e, 0x9e, 0xb4, 0xce, 0xff, 0xff, 
+0xb2, 0x94, 0x76, 0x58, 0x42, 0x61, 0x7b, 0x8f, 0x9e, 0xaa, 0xaa, 0xad, 0xb9, 0xcb, 0xe1, 0xff, 
+0xff, 0xb7, 0x98, 0x78, 0x58, 0x42, 0x62, 0x7f, 0x98, 0xad, 0xce, 0xdb, 0xeb, 0xfc, 0xff, 0xff, 
+0xff, 0xff, 0xb2, 0x95, 0x77, 0x58, 0x42, 0x60, 0x77, 0x8a, 0x9c, 0xb1, 0xbf, 0xd0, 0xe3, 0xf9, 
+0xff, 0xff, 0xff, 0xab, 0x8e, 0x72, 0x55, 0x41, 0x58, 0x69, 0x77, 0x85, 0x94, 0xa3, 0xb6, 0xcc, 
+0xe3, 0xfc, 0xff, 0xff, 0xa4, 0x86, 0x69, 0x4e, 0x3b, 0x4b, 0x55, 0x5f, 0x69, 0x77, 0x89, 0x9e, 
+0xb6, 0xcf, 0xe9, 0xff, 0xff, 0x9e, 0x7f, 0x60, 0x43, 0x30, 0x38, 0x3c, 0x41, 0x4c, 0x5c, 0x71, 
+0x89, 0xa2, 0xbd, 0xd9, 0xff, 0xff, 0x9f, 0x7f, 0x61, 0x44, 0x3d, 0x4c, 0x57, 0x57, 0x4a, 0x44, 
+0x5c, 0x76, 0x91, 0xae, 0xcc, 0xff, 0xff, 0xa7, 0x8b, 0x70, 0x5d, 0x5b, 0x68, 0x73, 0x73, 0x63, 
+0x4b, 0x4a, 0x67, 0x84, 0xa3, 0xc1, 0xff, 0xff, 0xb7, 0x9e, 0x89, 0x7c, 0x7a, 0x84, 0x90, 0x8d, 
+0x77, 0x5a, 0x3e, 0x5c, 0x7c, 0x9b, 0xbb, 0xff, 0xff, 0xcb, 0xb5, 0xa5, 0x9b, 0x9a, 0xa1, 0xae, 
+0x9f, 0x81, 0x61, 0x41, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xca, 0xb2, 0x9f, 0x93, 0x93, 0x9d, 
+0xaa, 0x99, 0x7d, 0x5e, 0x3f, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xba, 0x9e, 0x85, 0x74, 0x73, 
+0x82, 0x8a, 0x81, 0x6c, 0x52, 0x44, 0x62, 0x80, 0x9f, 0xbe, 0xff, 0xff, 0xb0, 0x91, 0x72, 0x58, 
+0x56, 0x65, 0x6a, 0x64, 0x54, 0x3f, 0x54, 0x6f, 0x8c, 0xa9, 0xc7, 0xff, 0xff, 0xaf, 0x8f, 0x6f, 
+0x52, 0x3f, 0x46, 0x4a, 0x45, 0x41, 0x52, 0x68, 0x81, 0x9b, 0xb7, 0xd3, 0xff, 0xff, 0xb6, 0x99, 
+0x7f, 0x6b, 0x5c, 0x53, 0x50, 0x54, 0x5d, 0x6c, 0x7f, 0x95, 0xae, 0xc7, 0xe2, 0xff, 0xff, 0xc5, 
+0xac, 0x97, 0x87, 0x7a, 0x72, 0x70, 0x73, 0x7b, 0x88, 0x99, 0xac, 0xc3, 0xdb, 0xf4, 0xff, 0xff, 
+0xd9, 0xc4, 0xb2, 0xa4, 0x99, 0x92, 0x90, 0x93, 0x9a, 0xa5, 0xb4, 0xc5, 0xda, 0xf0, 0xff, 0xff, 
+0xff, 0xf1, 0xde, 0xce, 0xc1, 0xb8, 0xb2, 0xb0, 0xb2, 0xb8, 0xc2, 0xd0, 0xe0, 0xf2, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xd6, 0xc3, 0xb6, 0xb0, 0xb3, 
+0xbe, 0xd0, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xda, 0xc0, 0xa9, 0x98, 0x90, 
+0x94, 0xa3, 0xb8, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xcb, 0xae, 0x93, 0x7c, 
+0x70, 0x77, 0x8b, 0xa5, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xda, 0xbd, 0xa0, 0x83, 
+0x66, 0x51, 0x5e, 0x7b, 0x9a, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xcc, 0xaf, 0x92, 
+0x75, 0x58, 0x3e, 0x5b, 0x79, 0x99, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdb, 0xbe, 0xa1, 
+0x84, 0x68, 0x4b, 0x4c, 0x69, 0x86, 0xa2, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xcd, 0xb0, 
+0x93, 0x77, 0x5a, 0x3d, 0x5a, 0x76, 0x93, 0xb0, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xdc, 0xbf, 
+0xa2, 0x86, 0x69, 0x4c, 0x4b, 0x67, 0x84, 0xa1, 0xbe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xce, 
+0xb2, 0x95, 0x78, 0x5b, 0x3e, 0x58, 0x75, 0x92, 0xaf, 0xcc, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xdd, 
+0xc1, 0xa4, 0x87, 0x6a, 0x4d, 0x49, 0x66, 0x83, 0xa0, 0xbd, 0xda, 0xf7, 0xff, 0xff, 0xff, 0xff, 
+0xc7, 0xae, 0x94, 0x79, 0x5c, 0x3f, 0x57, 0x74, 0x90, 0xaa, 0xc4, 0xde, 0xf8, 0xff, 0xff, 0xff, 
+0xed, 0xb6, 0x9c, 0x83, 0x69, 0x4e, 0x48, 0x63, 0x7b, 0x93, 0xaa, 0xc2, 0xdb, 0xf5, 0xff, 0xff, 
+0xf0, 0xd7, 0xa4, 0x8a, 0x71, 0x58, 0x3f, 0x50, 0x64, 0x78, 0x8c, 0xa2, 0xb9, 0xd2, 0xeb, 0xff, 
+0xff, 0xde, 0xc3, 0x95, 0x79, 0x5f, 0x46, 0x3d, 0x4c, 0x5a, 0x6a, 0x7c, 0x92, 0xa9, 0xc3, 0xde, 
+0xff, 0xff, 0xcf, 0xb2, 0x8a, 0x6e, 0x53, 0x3c, 0x36, 0x3c, 0x44, 0x52, 0x66, 0x7d, 0x97, 0xb2, 
+0xcf, 0xff, 0xff, 0xc3, 0xa5, 0x82, 0x66, 0x4b, 0x35, 0x26, 0x20, 0x27, 0x38, 0x50, 0x6b, 0x87, 
+0xa5, 0xc3, 0xff, 0xff, 0xbc, 0x9c, 0x7c, 0x5e, 0x40, 0x23, 0x0b, 0x00, 0x0b, 0x23, 0x40, 0x5e, 
+0x7d, 0x9c, 0xbc, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 
+0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb9, 0x99, 0x7a, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+0x3b, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 0x64, 0x47, 0x2d, 0x18, 0x10, 0x18, 
+0x2d, 0x47, 0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xc9, 0xab, 0x8f, 0x73, 0x5a, 0x45, 0x36, 0x30, 
+0x36, 0x45, 0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xd6, 0xba, 0xa0, 0x87, 0x72, 0x60, 0x54, 
+0x50, 0x54, 0x60, 0x72, 0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 
+0x73, 0x70, 0x73, 0x7d, 0x8c, 0x9f, 0xb5, 0xcd, 0xe7, 0xff, 0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 
+0x9b, 0x93, 0x90, 0x93, 0x9b, 0xa8, 0xb8, 0xcc, 0xe2, 0xfa, 0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 
+0xc4, 0xb9, 0xb2, 0xb0, 0xb2, 0xb9, 0xc4, 0xd3, 0xe5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 
+0xd0, 0xbe, 0xb3, 0xb0, 0xb0, 0xae, 0xa9, 0xa2, 0x9d, 0x9a, 0x9d, 0xa8, 0xba, 0xcf, 0xff, 0xff, 
+0xd1, 0xb8, 0xa3, 0x94, 0x90, 0x90, 0x8f, 0x8b, 0x85, 0x7e, 0x7a, 0x7e, 0x8d, 0xa2, 0xbb, 0xff, 
+0xff, 0xc2, 0xa5, 0x8b, 0x77, 0x70, 0x70, 0x70, 0x6e, 0x68, 0x60, 0x5a, 0x61, 0x75, 0x8f, 0xac, 
+0xff, 0xff, 0xb9, 0x9a, 0x7b, 0x5e, 0x50, 0x50, 0x50, 0x50, 0x4c, 0x44, 0x3a, 0x48, 0x65, 0x84, 
+0xa3, 0xff, 0xff, 0xb9, 0x99, 0x79, 0x5b, 0x4a, 0x4a, 0x4a, 0x49, 0x45, 0x3b, 0x2d, 0x45, 0x63, 
+0x83, 0xa3, 0xff, 0xff, 0xc0, 0xa2, 0x87, 0x71, 0x6a, 0x6a, 0x68, 0x61, 0x56, 0x45, 0x40, 0x55, 
+0x6f, 0x8c, 0xaa, 0xff, 0xff, 0xce, 0xb4, 0x9e, 0x8e, 0x89, 0x86, 0x7d, 0x6f, 0x5c, 0x43, 0x50, 
+0x67, 0x80, 0x9a, 0xb7, 0xff, 0xff, 0xe1, 0xcb, 0xb9, 0xab, 0xa2, 0x97, 0x87, 0x71, 0x57, 0x41, 
+0x5e, 0x78, 0x91, 0xab, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xc4, 0xa6, 0x88, 0x6a, 0x4c, 
+0x4c, 0x6a, 0x88, 0xa6, 0xc4, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd6, 0xb8, 0x9a, 0x7c, 0x5f, 
+0x41, 0x57, 0x75, 0x93, 0xb1, 0xcf, 0xed, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xcb, 0xad, 0x8f, 0x71, 
+0x53, 0x44, 0x62, 0x80, 0x9e, 0xbc, 0xda, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xc0, 0xa2, 0x84, 
+0x66, 0x48, 0x50, 0x6d, 0x8b, 0xa9, 0xc7, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xd3, 0xb5, 0x97, 
+0x79, 0x5b, 0x3d, 0x5b, 0x79, 0x97, 0xb5, 0xd3, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xc7, 0xa9, 
+0x8b, 0x6d, 0x50, 0x48, 0x66, 0x84, 0xa2, 0xc0, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xda, 0xbc, 
+0x9e, 0x80, 0x62, 0x44, 0x53, 0x71, 0x8f, 0xad, 0xcb, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xed, 0xcf, 
+0xb1, 0x93, 0x75, 0x57, 0x41, 0x5f, 0x7c, 0x9a, 0xb8, 0xd6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xe2, 
+0xc4, 0xa6, 0x88, 0x6a, 0x4c, 0x4c, 0x6a, 0x88, 0xa6, 0xc4, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xd6, 0xb8, 0x9a, 0x7c, 0x5f, 0x41, 0x57, 0x75, 0x93, 0xb1, 0xcf, 0xed, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xcb, 0xad, 0x8f, 0x71, 0x53, 0x44, 0x62, 0x80, 0x9e, 0xbc, 0xda, 0xf8, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xc0, 0xa2, 0x84, 0x66, 0x48, 0x50, 0x6d, 0x8b, 0xa9, 0xc7, 0xe5, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xb9, 0x99, 0x79, 0x5b, 0x3d, 0x5b, 0x79, 0x97, 0xb5, 0xd3, 0xf1, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xb9, 0x9a, 0x7b, 0x5e, 0x51, 0x66, 0x84, 0xa2, 0xc0, 0xde, 0xfc, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xa5, 0x8b, 0x77, 0x70, 0x7c, 0x93, 0xae, 0xcb, 0xe9, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xb8, 0xa3, 0x94, 0x90, 0x98, 0xa9, 0xc0, 0xda, 0xf5, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xd0, 0xbe, 0xb3, 0xb0, 0xb6, 0xc3, 0xd6, 0xed, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xd8, 0xc8, 0xbb, 
+0xb3, 0xb0, 0xb3, 0xbb, 0xc8, 0xd8, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xd5, 0xbf, 0xac, 
+0x9d, 0x93, 0x90, 0x93, 0x9d, 0xac, 0xbf, 0xd5, 0xed, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xc1, 0xa8, 
+0x92, 0x80, 0x74, 0x70, 0x74, 0x80, 0x92, 0xa8, 0xc1, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xaf, 
+0x94, 0x7b, 0x65, 0x56, 0x50, 0x56, 0x65, 0x7b, 0x94, 0xaf, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xc1, 
+0xa3, 0x85, 0x68, 0x4e, 0x39, 0x30, 0x39, 0x4e, 0x68, 0x85, 0xa3, 0xc1, 0xff, 0xff, 0xff, 0xff, 
+0xbb, 0x9b, 0x7c, 0x5c, 0x3d, 0x21, 0x10, 0x21, 0x3d, 0x5c, 0x7c, 0x9b, 0xbb, 0xff, 0xff, 0xff, 
+0xff, 0xba, 0x9a, 0x7a, 0x5a, 0x3a, 0x1b, 0x03, 0x1b, 0x3a, 0x5a, 0x7a, 0x9a, 0xba, 0xff, 0xff, 
+0xff, 0xff, 0xbd, 0x9f, 0x80, 0x62, 0x46, 0x2e, 0x23, 0x2e, 0x46, 0x62, 0x80, 0x9f, 0xbd, 0xff, 
+0xff, 0xff, 0xff, 0xbf, 0xa4, 0x8a, 0x71, 0x5b, 0x4a, 0x43, 0x4a, 0x5b, 0x71, 0x8a, 0xa4, 0xbf, 
+0xff, 0xff, 0xff, 0xed, 0xbe, 0xa5, 0x8d, 0x78, 0x67, 0x5c, 0x58, 0x5c, 0x67, 0x78, 0x8d, 0xa5, 
+0xbe, 0xed, 0xff, 0xff, 0xdc, 0xb9, 0xa0, 0x88, 0x74, 0x63, 0x58, 0x55, 0x58, 0x63, 0x74, 0x88, 
+0xa0, 0xb9, 0xdc, 0xff, 0xff, 0xcd, 0xb0, 0x94, 0x7a, 0x62, 0x4e, 0x40, 0x3b, 0x40, 0x4e, 0x62, 
+0x7a, 0x94, 0xb0, 0xcd, 0xff, 0xff, 0xc2, 0xa3, 0x86, 0x69, 0x4d, 0x35, 0x22, 0x1b, 0x22, 0x35, 
+0x4d, 0x69, 0x86, 0xa3, 0xc2, 0xff, 0xff, 0xbb, 0x9b, 0x7c, 0x5d, 0x3e, 0x21, 0x08, 0x00, 0x08, 
+0x21, 0x3e, 0x5d, 0x7c, 0x9b, 0xbb, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 0x00, 
+0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 0x00, 
+0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 0x18, 
+0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 0x38, 
+0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xb9, 0x99, 0x7a, 0x5a, 
+0x3b, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 
+0x64, 0x47, 0x2d, 0x18, 0x10, 0x18, 0x2d, 0x47, 0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xc9, 0xab, 
+0x8f, 0x73, 0x5a, 0x45, 0x36, 0x30, 0x36, 0x45, 0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xd6, 
+0xba, 0xa0, 0x87, 0x72, 0x60, 0x54, 0x50, 0x54, 0x60, 0x72, 0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 
+0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 0x73, 0x70, 0x73, 0x7d, 0x8c, 0x9f, 0xb5, 0xcd, 0xe7, 0xff, 
+0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 0x9b, 0x93, 0x90, 0x93, 0x9b, 0xa8, 0xb8, 0xcc, 0xe2, 0xfa, 
+0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 0xc4, 0xb9, 0xb2, 0xb0, 0xb2, 0xb9, 0xc4, 0xd3, 0xe5, 0xf9, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xe5, 0xd3, 0xc4, 0xb9, 0xb2, 0xb0, 0xb2, 0xb9, 0xc4, 
+0xd3, 0xe5, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xe2, 0xcc, 0xb8, 0xa8, 0x9b, 0x93, 0x90, 0x93, 0x9b, 
+0xa8, 0xb8, 0xcc, 0xe2, 0xfa, 0xff, 0xff, 0xe7, 0xcd, 0xb5, 0x9f, 0x8c, 0x7d, 0x73, 0x70, 0x73, 
+0x7d, 0x8c, 0x9f, 0xb5, 0xcd, 0xe7, 0xff, 0xff, 0xd6, 0xba, 0xa0, 0x87, 0x72, 0x60, 0x54, 0x50, 
+0x54, 0x60, 0x72, 0x87, 0xa0, 0xba, 0xd6, 0xff, 0xff, 0xc9, 0xab, 0x8f, 0x73, 0x5a, 0x45, 0x36, 
+0x30, 0x36, 0x45, 0x5a, 0x73, 0x8f, 0xab, 0xc9, 0xff, 0xff, 0xbf, 0xa0, 0x82, 0x64, 0x47, 0x2d, 
+0x18, 0x10, 0x18, 0x2d, 0x47, 0x64, 0x82, 0xa0, 0xbf, 0xff, 0xff, 0xb9, 0x99, 0x7a, 0x5a, 0x3b, 
+0x1c, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x5a, 0x7a, 0x99, 0xb9, 0xff, 0xff, 0xb8, 0x98, 0x78, 0x58, 
+0x38, 0x18, 0x00, 0x00, 0x00, 0x18, 0x38, 0x58, 0x78, 0x98, 0xb8, 0xff, 0xff, 0xbc, 0x9c, 0x7d, 
+0x5e, 0x40, 0x23, 0x0b, 0x00, 0x0b, 0x23, 0x40, 0x5e, 0x7c, 0x9c, 0xbc, 0xff, 0xff, 0xc3, 0xa5, 
+0x87, 0x6b, 0x50, 0x38, 0x27, 0x20, 0x26, 0x35, 0x4b, 0x66, 0x82, 0xa5, 0xc3, 0xff, 0xff, 0xcf, 
+0xb2, 0x97, 0x7d, 0x66, 0x52, 0x44, 0x3c, 0x36, 0x3c, 0x53, 0x6e, 0x8a, 0xb2, 0xcf, 0xff, 0xff, 
+0xde, 0xc3, 0xa9, 0x92, 0x7c, 0x6a, 0x5a, 0x4c, 0x3d, 0x46, 0x5f, 0x79, 0x95, 0xc3, 0xde, 0xff, 
+0xff, 0xeb, 0xd2, 0xb9, 0xa2, 0x8c, 0x78, 0x64, 0x50, 0x3f, 0x58, 0x71, 0x8a, 0xa4, 0xd7, 0xf0, 
+0xff, 0xff, 0xf5, 0xdb, 0xc2, 0xaa, 0x93, 0x7b, 0x63, 0x48, 0x4e, 0x69, 0x83, 0x9c, 0xb6, 0xed, 
+0xff, 0xff, 0xff, 0xf8, 0xde, 0xc4, 0xaa, 0x90, 0x74, 0x57, 0x3f, 0x5c, 0x79, 0x94, 0xae, 0xc7, 
+0xff, 0xff, 0xff, 0xff, 0xf7, 0xda, 0xbd, 0xa0, 0x83, 0x66, 0x49, 0x4d, 0x6a, 0x87, 0xa4, 0xc1, 
+0xdd, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xcc, 0xaf, 0x92, 0x75, 0x58, 0x3e, 0x5b, 0x78, 0x95, 0xb2, 
+0xce, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbe, 0xa1, 0x84, 0x67, 0x4b, 0x4c, 0x69, 0x86, 0xa2, 
+0xbf, 0xdc, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xb0, 0x93, 0x76, 0x5a, 0x3d, 0x5a, 0x77, 0x93, 
+0xb0, 0xcd, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa2, 0x86, 0x69, 0x4c, 0x4b, 0x68, 0x84, 
+0xa1, 0xbe, 0xdb, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x99, 0x79, 0x5b, 0x3e, 0x58, 0x75, 
+0x92, 0xaf, 0xcc, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9a, 0x7b, 0x5e, 0x51, 0x66, 
+0x83, 0xa0, 0xbd, 0xda, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xa5, 0x8b, 0x77, 0x70, 
+0x7c, 0x93, 0xae, 0xcb, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xb8, 0xa3, 0x94, 
+0x90, 0x98, 0xa9, 0xc0, 0xda, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xd0, 0xbe, 
+0xb3, 0xb0, 0xb6, 0xc3, 0xd6, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xd8, 0xcc, 0xc8, 0xcc, 0xd8, 
+0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xbd, 0xae, 0xa8, 0xae, 
+0xbd, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa5, 0x90, 0x88, 
+0x90, 0xa5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x94, 0x78, 
+0x68, 0x78, 0x94, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x90, 
+0x71, 0x58, 0x71, 0x90, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 
+0x97, 0x81, 0x76, 0x81, 0x97, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xb2, 0x9a, 0x89, 0x82, 0x89, 0x9a, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xb1, 0x97, 0x81, 0x76, 0x81, 0x97, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xb0, 0x90, 0x71, 0x58, 0x71, 0x90, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xb3, 0x94, 0x78, 0x68, 0x78, 0x94, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xbf, 0xa5, 0x90, 0x88, 0x90, 0xa5, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xbd, 0xae, 0xa8, 0xae, 0xbd, 0xd2, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xd8, 0xcc, 0xc8, 0xcc, 0xd8, 0xea, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 
+0xde, 0xc8, 0xb8, 0xb0, 0xb3, 0xbf, 0xd2, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xe6, 0xca, 0xb0, 0x9b, 0x90, 0x94, 0xa5, 0xbd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xfb, 0xdc, 0xbd, 0x9f, 0x83, 0x71, 0x78, 0x90, 0xae, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xf6, 0xd7, 0xb7, 0x97, 0x78, 0x58, 0x68, 0x88, 0xa8, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xf2, 0xd2, 0xb3, 0x93, 0x73, 0x54, 0x6c, 0x8c, 0xac, 0xcb, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xee, 0xce, 0xae, 0x8f, 0x6f, 0x51, 0x71, 0x90, 0xb0, 0xd0, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xe9, 0xca, 0xaa, 0x8a, 0x6a, 0x55, 0x75, 0x95, 0xb4, 0xd4, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xc5, 0xa5, 0x86, 0x66, 0x5a, 0x79, 0x99, 0xb9, 0xd8, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xc1, 0xa1, 0x81, 0x62, 0x5e, 0x7e, 0x9d, 0xbd, 0xdd, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdc, 0xbc, 0x9d, 0x7d, 0x5d, 0x62, 0x82, 0xa2, 0xc2, 
+0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd8, 0xb8, 0x98, 0x78, 0x59, 0x67, 0x87, 0xa6, 
+0xc6, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xd3, 0xb3, 0x94, 0x74, 0x54, 0x6b, 0x8b, 
+0xab, 0xca, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xcf, 0xaf, 0x8f, 0x70, 0x50, 0x70, 
+0x8f, 0xaf, 0xcf, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xca, 0xab, 0x8b, 0x6b, 0x54, 
+0x74, 0x94, 0xb3, 0xd3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xc6, 0xa6, 0x87, 0x67, 
+0x59, 0x78, 0x98, 0xb8, 0xd8, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc2, 0xa2, 0x82, 
+0x62, 0x5d, 0x7d, 0x9d, 0xbc, 0xdc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xbd, 0x9d, 
+0x7e, 0x5e, 0x62, 0x81, 0xa1, 0xc1, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xb9, 
+0x99, 0x79, 0x5a, 0x66, 0x86, 0xa5, 0xc5, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 
+0xb4, 0x95, 0x75, 0x55, 0x6a, 0x8a, 0xaa, 0xca, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xd0, 0xb0, 0x90, 0x71, 0x51, 0x6f, 0x8f, 0xae, 0xce, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xcb, 0xac, 0x8c, 0x6c, 0x54, 0x73, 0x93, 0xb3, 0xd2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xc8, 0xa8, 0x88, 0x68, 0x58, 0x78, 0x97, 0xb7, 0xd7, 0xf6, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xcc, 0xae, 0x90, 0x78, 0x71, 0x83, 0x9f, 0xbd, 0xdc, 0xfb, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xd8, 0xbd, 0xa5, 0x94, 0x90, 0x9b, 0xb0, 0xca, 0xe6, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xd2, 0xbf, 0xb3, 0xb0, 0xb8, 0xc8, 0xde, 0xf6, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+0xff, 0xff, 0xff, 0xff, };
@@ -0,0 +1,168 @@
+// Generated by native/matcapfit (pio run -e matcapfit -t exec), do not edit.
+// 51 x 51 matcap nodes every 4 texels, row by row; see MetaBallSampleMatCapFit().
+
+const unsigned char MatCapFit4[] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x06, 0x01, 0x02, 0x00, 0x00, 0x03, 0x01, 0x04, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x2f, 0x84, 
+0x00, 0x06, 0x00, 0x09, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+0x01, 0x06, 0x04, 0x00, 0x00, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x3a, 0x38, 
+0x0e, 0x00, 0x00, 0x00, 0x02, 0x76, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x08, 0x02, 0x00, 0x01, 0x0a, 0x11, 0x20, 0x16, 0x85, 
+0xff, 0xff, 0xff, 0xff, 0xec, 0xad, 0x52, 0x00, 0x00, 0x01, 0x33, 0x0a, 0x00, 0x02, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x10, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 
+0x00, 0x02, 0x00, 0x00, 0x20, 0x6b, 0xd2, 0xff, 0xff, 0xff, 0xff, 0x95, 0x00, 0x00, 0x16, 0x09, 
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x04, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x14, 0xa9, 0xff, 0xff, 0xff, 0xff, 
+0x68, 0x00, 0x05, 0x05, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x16, 0x1d, 0x00, 0x00, 0x01, 0x01, 
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x04, 0x07, 0x07, 0x00, 0x00, 0x00, 
+0xd5, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x29, 0x23, 0x00, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 
+0x02, 0x0c, 0x00, 0x00, 0x25, 0x5a, 0x8f, 0xdb, 0xff, 0x3c, 0x04, 0x00, 0x06, 0x00, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x3b, 0x31, 
+0x00, 0x02, 0x08, 0x00, 0x03, 0x0e, 0x11, 0x0e, 0x0a, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 
+0x02, 0x02, 0x03, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x04, 0x16, 0x33, 0x38, 0x3e, 0x0e, 0x00, 
+0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 
+0x37, 0x48, 0x00, 0x04, 0x08, 0x00, 0x0e, 0x08, 0x1a, 0x24, 0x18, 0x0f, 0x0c, 0x03, 0x01, 0x02, 
+0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x03, 0x0f, 0x11, 0x20, 0x32, 0x58, 
+0x08, 0x44, 0x0e, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 
+0x05, 0x00, 0x3c, 0x64, 0x00, 0x02, 0x04, 0x00, 0xcf, 0xff, 0xdc, 0x56, 0x04, 0x1c, 0x21, 0x10, 
+0x0c, 0x03, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x09, 0x0f, 
+0x1e, 0x00, 0xbd, 0xff, 0x40, 0x49, 0x0f, 0x00, 0x0e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x02, 0x00, 0x2e, 0x00, 0x25, 0x81, 0x10, 0x00, 0x03, 0x00, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xe3, 
+0x3c, 0x07, 0x24, 0x12, 0x0b, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+0x02, 0x0b, 0x0f, 0x24, 0x08, 0xcb, 0xff, 0xff, 0xaf, 0x4d, 0x00, 0x00, 0x13, 0x00, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x8f, 0x36, 0x00, 0x08, 0x00, 0xff, 0xff, 0xf8, 0xff, 
+0xfc, 0xf5, 0xff, 0xff, 0x90, 0x07, 0x23, 0x14, 0x08, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
+0x01, 0x01, 0x01, 0x00, 0x07, 0x15, 0x1e, 0x16, 0xff, 0xfb, 0xf3, 0xff, 0xd7, 0x43, 0x00, 0x07, 
+0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00, 0x70, 0x68, 0x19, 0x0a, 0x00, 0xf3, 0xff, 
+0xf9, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xe6, 0xff, 0xb0, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x62, 0xff, 0xf7, 0xff, 0xf7, 0xff, 
+0xe5, 0x15, 0x00, 0x13, 0x00, 0x02, 0x00, 0x06, 0x00, 0x43, 0x00, 0x2b, 0x95, 0x35, 0x1f, 0x00, 
+0xa3, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf6, 0xff, 0xbe, 0x00, 0x05, 0x00, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xec, 0xfd, 0xff, 
+0xfe, 0xff, 0xf7, 0xff, 0xbe, 0x00, 0x07, 0x0d, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x90, 0x65, 
+0x2f, 0x06, 0x1b, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xca, 0x00, 0x0a, 0x00, 
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 
+0xcf, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xf5, 0xff, 0x5a, 0x00, 0x28, 0x00, 0x05, 0x01, 0x00, 0x00, 
+0x42, 0x9c, 0x43, 0x31, 0x00, 0xee, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xe4, 0x00, 
+0x0d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x0b, 0x00, 0xcf, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0x00, 0x05, 0x00, 0x0d, 
+0x00, 0x2e, 0x00, 0x8b, 0x7a, 0x40, 0x12, 0x48, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf6, 
+0xff, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0xf5, 0xff, 0xfe, 0xff, 0xff, 0xf7, 0xff, 0x5a, 
+0x00, 0x4a, 0x00, 0x12, 0x00, 0x21, 0xae, 0x67, 0x3f, 0x00, 0xdb, 0xff, 0xfd, 0xff, 0xff, 0xfe, 
+0xff, 0xef, 0xff, 0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xff, 0xf4, 0xff, 0xff, 
+0xfe, 0xff, 0xe1, 0x00, 0x14, 0x00, 0x00, 0x00, 0x60, 0xa9, 0x63, 0x30, 0x27, 0xff, 0xf2, 0xff, 
+0xff, 0xff, 0xff, 0xf9, 0xff, 0x91, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x5c, 
+0xff, 0xf5, 0xff, 0xff, 0xf7, 0xff, 0x1c, 0x00, 0x00, 0x45, 0x00, 0x9f, 0x97, 0x66, 0x29, 0x51, 
+0xff, 0xff, 0xf4, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+0x00, 0x0a, 0x00, 0xd8, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0x75, 0x00, 0x62, 0x01, 0x00, 0xca, 0x87, 
+0x68, 0x34, 0x4d, 0x52, 0xcd, 0xff, 0xff, 0xf6, 0xf5, 0xff, 0x71, 0x00, 0x07, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2a, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0xb2, 0x00, 0x3b, 0x00, 
+0x28, 0xf3, 0x79, 0x68, 0x3d, 0x5c, 0x51, 0x20, 0x33, 0xd3, 0xff, 0xfd, 0xff, 0x00, 0x06, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xdc, 0xff, 0xfd, 0xff, 0xff, 0xdd, 
+0x00, 0x09, 0x00, 0x46, 0xff, 0x88, 0x67, 0x46, 0x58, 0x46, 0x24, 0x0d, 0x00, 0x3b, 0xfa, 0x9f, 
+0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x59, 0xff, 0xf6, 
+0xff, 0xef, 0xf5, 0x09, 0x00, 0x00, 0x6c, 0xf6, 0xdc, 0x47, 0x5b, 0x4d, 0x3b, 0x0a, 0x0f, 0x19, 
+0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x0e, 0xff, 0xf9, 0xfd, 0xe5, 0xf5, 0x26, 0x00, 0x00, 0x98, 0xe9, 0xed, 0xbe, 0x2b, 0x55, 0x28, 
+0x01, 0x05, 0x07, 0x0d, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x05, 0x00, 0xef, 0xff, 0xdf, 0xe0, 0xf0, 0x44, 0x00, 0x00, 0x83, 0xf1, 0xcd, 0xf8, 
+0xac, 0x1e, 0x1f, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x97, 0xd9, 0xdc, 0xd3, 0xeb, 0x3e, 0x00, 0x00, 0x94, 
+0xec, 0xd5, 0xc9, 0xee, 0xc2, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xcd, 0xce, 0xcd, 0xe5, 0x46, 
+0x00, 0x00, 0x59, 0xf1, 0xce, 0xce, 0xbc, 0xc6, 0x8b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7c, 0xba, 0xc1, 
+0xc3, 0xd6, 0x1c, 0x00, 0x00, 0x45, 0xec, 0xce, 0xca, 0xc5, 0xb1, 0x92, 0x36, 0x06, 0x04, 0x03, 
+0x02, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x17, 
+0x86, 0xab, 0xb6, 0xb8, 0xd0, 0x0e, 0x00, 0x00, 0x17, 0xdf, 0xce, 0xce, 0xc4, 0xbb, 0xa4, 0x65, 
+0x2b, 0x11, 0x08, 0x04, 0x02, 0x04, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x04, 
+0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x07, 0x04, 0x02, 0x05, 
+0x09, 0x14, 0x36, 0x92, 0xa4, 0xb1, 0xb9, 0xb6, 0x00, 0x0b, 0x1b, 0x00, 0xcc, 0xcc, 0xc9, 0xcc, 
+0xc5, 0xb3, 0x8c, 0x53, 0x30, 0x22, 0x22, 0x2b, 0x2c, 0x2e, 0x28, 0x20, 0x16, 0x0a, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x19, 0x0d, 0x00, 
+0x08, 0x0c, 0x0f, 0x1c, 0x2a, 0x56, 0x91, 0xa1, 0xad, 0xc0, 0x93, 0x00, 0x35, 0x5a, 0x00, 0x96, 
+0xd7, 0xc2, 0xc6, 0xcf, 0xcf, 0xc1, 0xae, 0x99, 0x8d, 0x7c, 0x70, 0x6b, 0x68, 0x68, 0x65, 0x62, 
+0x60, 0x5e, 0x57, 0x55, 0x51, 0x4c, 0x42, 0x38, 0x33, 0x34, 0x39, 0x3e, 0x40, 0x43, 0x46, 0x48, 
+0x45, 0x43, 0x35, 0x18, 0x0f, 0x24, 0x32, 0x47, 0x70, 0x92, 0xa7, 0xae, 0xc6, 0x54, 0x00, 0x4c, 
+0x00, 0x00, 0x58, 0xda, 0xbf, 0xc0, 0xce, 0xdd, 0xd6, 0xcf, 0xc5, 0xba, 0xb6, 0xb5, 0xb4, 0xb4, 
+0xb5, 0xb1, 0xaa, 0xa8, 0xa4, 0xa2, 0x9f, 0x9f, 0xa0, 0x9f, 0x9e, 0x98, 0x92, 0x8c, 0x85, 0x81, 
+0x7d, 0x78, 0x74, 0x6c, 0x62, 0x60, 0x64, 0x5d, 0x43, 0x49, 0x6e, 0x8e, 0xa0, 0xae, 0xb0, 0xc2, 
+0x1a, 0x00, 0x00, 0x0d, 0x00, 0x0c, 0xc8, 0xbc, 0xbf, 0xc7, 0xdf, 0xda, 0xdb, 0xd8, 0xd5, 0xd6, 
+0xd4, 0xd5, 0xd5, 0xd4, 0xd2, 0xce, 0xcb, 0xc8, 0xc2, 0xbe, 0xbc, 0xb7, 0xb4, 0xb1, 0xb1, 0xb0, 
+0xb3, 0xb1, 0xad, 0xab, 0xaa, 0xa4, 0x9b, 0x96, 0x90, 0x8c, 0x94, 0xa1, 0x9d, 0x92, 0x99, 0xa7, 
+0xb3, 0xb1, 0x9b, 0x00, 0x0b, 0x00, 0x00, 0x44, 0x00, 0x88, 0xc6, 0xb2, 0xc0, 0xe1, 0xe0, 0xe1, 
+0xe2, 0xe2, 0xe1, 0xe4, 0xe4, 0xe3, 0xe1, 0xdf, 0xdf, 0xdd, 0xda, 0xd7, 0xd5, 0xd1, 0xcf, 0xcc, 
+0xc9, 0xc9, 0xc6, 0xc5, 0xc3, 0xc3, 0xc2, 0xbf, 0xbf, 0xbb, 0xb5, 0xb2, 0xb1, 0xb3, 0xb7, 0xbd, 
+0xc7, 0xc4, 0xb6, 0xaf, 0xba, 0x4a, 0x00, 0x39, 0x00, 0x03, 0x00, 0x00, 0x2f, 0xcf, 0xae, 0xb4, 
+0xd8, 0xe4, 0xe4, 0xe6, 0xe7, 0xe9, 0xe7, 0xea, 0xe6, 0xe7, 0xe5, 0xe5, 0xe4, 0xe0, 0xdf, 0xdd, 
+0xda, 0xda, 0xd7, 0xd4, 0xd4, 0xd2, 0xd2, 0xd0, 0xcf, 0xce, 0xcd, 0xcc, 0xce, 0xcb, 0xc8, 0xc7, 
+0xc7, 0xc9, 0xcc, 0xcd, 0xcc, 0xd4, 0xae, 0xaf, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 
+0x91, 0xbb, 0xad, 0xc8, 0xe3, 0xe4, 0xe7, 0xe8, 0xe9, 0xea, 0xea, 0xeb, 0xe9, 0xea, 0xe7, 0xe6, 
+0xe6, 0xe4, 0xe2, 0xe2, 0xdf, 0xde, 0xdd, 0xdc, 0xda, 0xd9, 0xd9, 0xd7, 0xd7, 0xd7, 0xd8, 0xd7, 
+0xd8, 0xd7, 0xd4, 0xd5, 0xd4, 0xd2, 0xd0, 0xd4, 0xc8, 0xb5, 0x57, 0x00, 0x26, 0x00, 0x05, 0x05, 
+0x00, 0x3e, 0x00, 0x0d, 0xc8, 0xa8, 0xb9, 0xe0, 0xe2, 0xe5, 0xe8, 0xe9, 0xea, 0xeb, 0xeb, 0xe9, 
+0xea, 0xe9, 0xe7, 0xe7, 0xe7, 0xe5, 0xe4, 0xe3, 0xe2, 0xe0, 0xe1, 0xe1, 0xdf, 0xdf, 0xdf, 0xdf, 
+0xdf, 0xde, 0xde, 0xdf, 0xdf, 0xdb, 0xd9, 0xd8, 0xd9, 0xd5, 0xdb, 0xb7, 0x9b, 0x00, 0x04, 0x18, 
+0x00, 0x05, 0x00, 0x06, 0x00, 0x26, 0x00, 0x59, 0xc3, 0xa7, 0xce, 0xe1, 0xe3, 0xe5, 0xe9, 0xea, 
+0xeb, 0xea, 0xea, 0xe9, 0xea, 0xe8, 0xe9, 0xe8, 0xe6, 0xe5, 0xe5, 0xe3, 0xe3, 0xe2, 0xe3, 0xe1, 
+0xe0, 0xe1, 0xe1, 0xe1, 0xe2, 0xe2, 0xe0, 0xe1, 0xe0, 0xdc, 0xd9, 0xdb, 0xdb, 0xce, 0xb3, 0x22, 
+0x00, 0x1b, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x9a, 0xb2, 0xb0, 0xde, 0xe0, 
+0xe5, 0xe5, 0xe7, 0xe7, 0xe8, 0xe8, 0xe9, 0xe7, 0xe9, 0xe9, 0xeb, 0xea, 0xe8, 0xe6, 0xe6, 0xe7, 
+0xe5, 0xe5, 0xe5, 0xe4, 0xe6, 0xe3, 0xe5, 0xe1, 0xe1, 0xe1, 0xe2, 0xe1, 0xdf, 0xd9, 0xdd, 0xde, 
+0xbc, 0x64, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x33, 0x00, 0x00, 0xb5, 
+0xa9, 0xc1, 0xe0, 0xdf, 0xe5, 0xe5, 0xe5, 0xe8, 0xe7, 0xe9, 0xe7, 0xe6, 0xe6, 0xe6, 0xe8, 0xe8, 
+0xe7, 0xe7, 0xe6, 0xe5, 0xe5, 0xe5, 0xe4, 0xe2, 0xe1, 0xe3, 0xe3, 0xe4, 0xe4, 0xe3, 0xe1, 0xdf, 
+0xdb, 0xe1, 0xcc, 0x84, 0x00, 0x06, 0x1d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 
+0x1a, 0x00, 0x0c, 0xb7, 0xa7, 0xcb, 0xe4, 0xde, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe6, 0xe6, 0xe6, 
+0xe7, 0xe6, 0xe5, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe6, 0xe5, 0xe4, 0xe3, 0xe2, 0xe1, 
+0xe1, 0xe1, 0xe0, 0xe0, 0xd7, 0x85, 0x00, 0x01, 0x19, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x0e, 0xb3, 0xab, 0xce, 0xe5, 0xe1, 0xe2, 0xe4, 0xe4, 0xe4, 
+0xe5, 0xe6, 0xe6, 0xe7, 0xe7, 0xe7, 0xe6, 0xe6, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe4, 0xe5, 0xe5, 
+0xe3, 0xe2, 0xe1, 0xe2, 0xe0, 0xe2, 0xdd, 0x84, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x15, 0x00, 0x10, 0xa6, 0xaf, 0xcd, 0xe4, 0xe0, 
+0xe0, 0xe4, 0xe4, 0xe3, 0xe2, 0xe3, 0xe4, 0xe4, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 0xe5, 
+0xe4, 0xe2, 0xe5, 0xe2, 0xe1, 0xe1, 0xdd, 0xe5, 0xd9, 0x7b, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x87, 
+0xb6, 0xc3, 0xe3, 0xe5, 0xe0, 0xe0, 0xe1, 0xe3, 0xe3, 0xe5, 0xe4, 0xe3, 0xe4, 0xe4, 0xe5, 0xe3, 
+0xe2, 0xe3, 0xe2, 0xe4, 0xe2, 0xe2, 0xe1, 0xdd, 0xdd, 0xee, 0xc7, 0x55, 0x00, 0x01, 0x09, 0x00, 
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
+0x1d, 0x00, 0x00, 0x43, 0xa7, 0xbc, 0xd7, 0xe5, 0xe3, 0xe1, 0xe2, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 
+0xe1, 0xe1, 0xe2, 0xe3, 0xe1, 0xe2, 0xe0, 0xe0, 0xdd, 0xe0, 0xeb, 0xe4, 0x94, 0x15, 0x00, 0x05, 
+0x16, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x05, 0x00, 0x2c, 0x0c, 0x00, 0x08, 0x77, 0xb2, 0xc2, 0xd6, 0xe2, 0xe3, 0xe3, 0xe3, 
+0xe1, 0xe0, 0xe0, 0xe0, 0xe1, 0xe0, 0xe0, 0xde, 0xdd, 0xe0, 0xe3, 0xf0, 0xe1, 0xa4, 0x3e, 0x00, 
+0x00, 0x0d, 0x16, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x1c, 0x6e, 0xa7, 0xc5, 
+0xd5, 0xdb, 0xd9, 0xdc, 0xe2, 0xdf, 0xdf, 0xe1, 0xe2, 0xe4, 0xeb, 0xee, 0xe7, 0xcd, 0x85, 0x2f, 
+0x00, 0x00, 0x05, 0x14, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x31, 0x18, 0x00, 
+0x00, 0x05, 0x38, 0x82, 0xb9, 0xe4, 0xe1, 0xcd, 0xdb, 0xdc, 0xdc, 0xd1, 0xc2, 0x9c, 0x6f, 0x36, 
+0x09, 0x00, 0x00, 0x01, 0x1c, 0x0b, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
+0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x31, 0x41, 0x37, 0x3a, 0x12, 0x07, 
+0x00, 0x00, 0x00, 0x00, 0x0d, 0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x01, 0x00, 0x0a, 0x02, 0x07, 0x00, 0x0f, 0x00, 0x69, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x0d, 0x25, 0x2f, 0x00, 0x00, 0x00, 0x06, 0x04, 0x03, 0x00, 0x01, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
@@ -0,0 +1,48 @@
+// Generated by native/matcapfit (pio run -e matcapfit -t exec), do not edit.
+// 26 x 26 matcap nodes every 8 texels, row by row; see MetaBallSampleMatCapFit().
+
+const unsigned char MatCapFit8[] PROGMEM = {
+0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x16, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x38, 0x40, 0x04, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x1a, 
+0x00, 0x06, 0x05, 0x03, 0x00, 0x12, 0x0b, 0xd0, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+0x0a, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x12, 0x0a, 0x00, 0x00, 0x01, 0x00, 
+0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xae, 0x00, 0x00, 0x44, 0x00, 0x11, 0x00, 0x03, 0x03, 0x00, 
+0x29, 0x00, 0x00, 0x2f, 0x0e, 0x00, 0x06, 0x07, 0x00, 0x04, 0x02, 0x0d, 0x0a, 0x00, 0x00, 0x38, 
+0xbf, 0xb9, 0x00, 0x0c, 0x3f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x17, 0x00, 0x3f, 
+0x01, 0x0a, 0x11, 0x00, 0x03, 0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x23, 0x58, 0x00, 0x00, 0x71, 
+0x00, 0x12, 0x00, 0x58, 0x00, 0x53, 0x41, 0x00, 0xcc, 0xff, 0xff, 0x54, 0x00, 0x16, 0x00, 0x03, 
+0x01, 0x00, 0x00, 0x04, 0x23, 0x19, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x46, 0x00, 0x10, 0x8b, 
+0x00, 0xc3, 0xff, 0xed, 0xec, 0xff, 0x81, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x8a, 
+0xff, 0xff, 0xda, 0x00, 0x38, 0x00, 0x63, 0x00, 0x96, 0x17, 0x44, 0xff, 0xec, 0xfd, 0xff, 0xa2, 
+0x00, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0b, 0x00, 0xa6, 0xff, 0xe3, 0xff, 0x7d, 0x00, 0x42, 
+0x00, 0x19, 0x9c, 0x00, 0xff, 0xfb, 0xff, 0xff, 0xe1, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x12, 0x00, 0xc9, 0xff, 0xf1, 0xff, 0x00, 0x46, 0x00, 0x89, 0x61, 0x51, 0xff, 0xeb, 
+0xf2, 0xff, 0x00, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0xff, 
+0xf0, 0xff, 0x5b, 0x00, 0x00, 0xbf, 0x59, 0x40, 0xc0, 0xff, 0xff, 0x6f, 0x00, 0x08, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4a, 0xff, 0xff, 0xc5, 0x00, 0x00, 0xfc, 
+0x41, 0x66, 0x01, 0x06, 0xde, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x01, 0x00, 0x09, 0x00, 0xff, 0xff, 0xde, 0x00, 0x00, 0xff, 0xad, 0x21, 0x12, 0x08, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0xc7, 0xf6, 
+0xe1, 0x00, 0x00, 0xea, 0xe6, 0xa7, 0x00, 0x05, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x04, 0x00, 0x4b, 0xe3, 0xd3, 0x00, 0x00, 0xe4, 0xbe, 0xcb, 
+0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 
+0x04, 0x00, 0x82, 0xbe, 0xb8, 0x00, 0x00, 0xc3, 0xd0, 0xc6, 0x93, 0x31, 0x22, 0x26, 0x21, 0x11, 
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x00, 0x08, 0x28, 0x8c, 0xba, 0x96, 0x00, 
+0x00, 0x7b, 0xd2, 0xcc, 0xe1, 0xd0, 0xbe, 0xb6, 0xb7, 0xb0, 0xaa, 0xa3, 0xa0, 0x97, 0x8e, 0x88, 
+0x82, 0x7a, 0x68, 0x5d, 0x49, 0x69, 0x9a, 0xce, 0x40, 0x00, 0x00, 0x04, 0xd3, 0xba, 0xe7, 0xdf, 
+0xe4, 0xe8, 0xe4, 0xe2, 0xdc, 0xd5, 0xcf, 0xcb, 0xca, 0xc8, 0xc5, 0xc2, 0xb9, 0xb4, 0xc4, 0xc7, 
+0xb6, 0xbb, 0x00, 0x1c, 0x52, 0x00, 0x94, 0xb8, 0xe3, 0xe7, 0xea, 0xea, 0xe9, 0xe8, 0xe5, 0xe3, 
+0xe0, 0xdd, 0xdb, 0xd9, 0xd7, 0xd8, 0xda, 0xd5, 0xd4, 0xcf, 0xe0, 0x5e, 0x00, 0x34, 0x25, 0x00, 
+0x00, 0xc3, 0xc2, 0xeb, 0xe6, 0xeb, 0xea, 0xea, 0xea, 0xe8, 0xe5, 0xe4, 0xe4, 0xe2, 0xe3, 0xe2, 
+0xe0, 0xe3, 0xd6, 0xe4, 0xaf, 0x00, 0x1c, 0x00, 0x00, 0x3b, 0x00, 0x2e, 0xcc, 0xd6, 0xe5, 0xe6, 
+0xe8, 0xe6, 0xe6, 0xe8, 0xe7, 0xe6, 0xe5, 0xe4, 0xe2, 0xe3, 0xe6, 0xdd, 0xe0, 0xe3, 0x00, 0x00, 
+0x07, 0x00, 0x0c, 0x00, 0x54, 0x00, 0x36, 0xcf, 0xe3, 0xe0, 0xe3, 0xe6, 0xe6, 0xe6, 0xe6, 0xe5, 
+0xe6, 0xe7, 0xe7, 0xe3, 0xd6, 0xee, 0xec, 0x05, 0x00, 0x7d, 0x00, 0x15, 0x00, 0x0c, 0x00, 0x4b, 
+0x00, 0x1f, 0xba, 0xed, 0xe5, 0xdc, 0xe1, 0xe3, 0xe3, 0xe4, 0xe0, 0xdd, 0xda, 0xe3, 0xff, 0xc3, 
+0x00, 0x00, 0x96, 0x00, 0x13, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x62, 0x00, 0x00, 0x74, 0xd5, 0xf4, 
+0xe8, 0xe3, 0xe2, 0xe3, 0xeb, 0xf5, 0xff, 0xd8, 0x58, 0x00, 0x00, 0x8f, 0x00, 0x1b, 0x00, 0x05, 
+0x00, 0x01, 0x00, 0x0c, 0x00, 0x24, 0x00, 0x00, 0x00, 0x51, 0xbb, 0xd1, 0xd3, 0xd7, 0xb7, 0x85, 
+0x2c, 0x00, 0x00, 0x43, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x00, 
+0x14, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x1e, 0x00, 0x00, 0x17, 
+0x00, 0x05, 0x00, 0x01, 
+};
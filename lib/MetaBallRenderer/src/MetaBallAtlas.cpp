@@ -0,0 +1,69 @@
+#include "MetaBallAtlas.h"
+#include "MetaBallRenderer.h"
+
+#if METABALL_SDF_ATLAS
+
+#include <GlyphAtlas.h>
+
+MetaBallAtlas MetaBallGetAtlas(int scale)
+{
+  MetaBallAtlas atlas = {};
+
+  switch (scale)
+  {
+  case 2:
+    atlas.data = GlyphAtlas2;
+    break;
+
+  case 4:
+    atlas.data = GlyphAtlas4;
+    break;
+
+  default:
+    return atlas;
+  }
+
+  atlas.scale = scale;
+  atlas.width = MetaBallRenderer::GLYPH_WIDTH / scale + 1;
+  atlas.height = MetaBallRenderer::GLYPH_HEIGHT / scale + 1;
+  return atlas;
+}
+
+float MetaBallGetGlyphRadius(int glyph)
+{
+  return GlyphAtlasRadius[glyph];
+}
+
+static float GetSample(const MetaBallAtlas& atlas, const int& glyph, const int& x, const int& y)
+{
+  int value = pgm_read_byte(&atlas.data[(glyph * atlas.height + y) * atlas.width + x]);
+  return (value - ATLAS_DISTANCE_ZERO) * (1.0f / ATLAS_DISTANCE_SCALE);
+}
+
+float MetaBallSampleAtlas(const MetaBallAtlas& atlas, int glyph, int x, int y, float& gradientX, float& gradientY)
+{
+  int cellX = min(x / atlas.scale, atlas.width - 2);
+  int cellY = min(y / atlas.scale, atlas.height - 2);
+  float fx = (x - cellX * atlas.scale) / (float)atlas.scale;
+  float fy = (y - cellY * atlas.scale) / (float)atlas.scale;
+
+  float topLeft = GetSample(atlas, glyph, cellX, cellY);
+  float topRight = GetSample(atlas, glyph, cellX + 1, cellY);
+  float bottomLeft = GetSample(atlas, glyph, cellX, cellY + 1);
+  float bottomRight = GetSample(atlas, glyph, cellX + 1, cellY + 1);
+
+  float top = topLeft + (topRight - topLeft) * fx;
+  float bottom = bottomLeft + (bottomRight - bottomLeft) * fx;
+
+  gradientX = ((topRight - topLeft) + ((bottomRight - bottomLeft) - (topRight - topLeft)) * fy) / atlas.scale;
+  gradientY = (bottom - top) / atlas.scale;
+  return top + (bottom - top) * fy;
+}
+
+#endif
+
+float MetaBallSmoothMin(float a, float b, float blend, float& weight)
+{
+  weight = constrain(0.5f + 0.5f * (b - a) / blend, 0.0f, 1.0f);
+  return b + (a - b) * weight - blend * weight * (1.0f - weight);
+}
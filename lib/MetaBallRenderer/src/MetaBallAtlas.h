@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "MetaBallConfig.h"
+
+// Distance field atlas of the glyphs (METABALL_SDF_ATLAS), an approximation
+// of the metaball blend that is sampled instead of evaluated.
+//
+// Every glyph is stored as a grid of samples every `scale` pixels over its
+// GLYPH_WIDTH x GLYPH_HEIGHT box, both edges included. A sample is the signed
+// distance to the glyph's surface (negative inside) in 1/ATLAS_DISTANCE_SCALE
+// pixels, offset by ATLAS_DISTANCE_ZERO and saturated to a byte. The strokes
+// of a glyph are joined with the same smooth minimum the renderer uses
+// between glyphs, ATLAS_BLEND pixels wide. That width is the one whose
+// shapes match the metaball blend (EXTRA_RADIUS 9) best in bench --atlas.
+
+const int ATLAS_DISTANCE_SCALE = 8;
+const int ATLAS_DISTANCE_ZERO = 128;
+const float ATLAS_BLEND = 11.0f;
+
+struct MetaBallAtlas
+{
+  const uint8_t* data;
+  int scale;
+  int width;
+  int height;
+};
+
+#if METABALL_SDF_ATLAS
+
+// Atlas sampled every scale pixels, from include/GlyphAtlas.h. Only 2 and 4
+// are generated; anything else returns an atlas without data.
+MetaBallAtlas MetaBallGetAtlas(int scale);
+
+// Depth of a glyph's deepest point, the stroke radius its matcap lookup uses.
+float MetaBallGetGlyphRadius(int glyph);
+
+// Bilinear sample at (x, y) of a glyph's box. Returns the distance and sets
+// its gradient, which is constant along each axis within a cell.
+float MetaBallSampleAtlas(const MetaBallAtlas& atlas, int glyph, int x, int y, float& gradientX, float& gradientY);
+
+#endif
+
+// Polynomial smooth minimum of two distances. weight is how much of a is in
+// the result, for blending anything else that goes with the distances.
+float MetaBallSmoothMin(float a, float b, float blend, float& weight);
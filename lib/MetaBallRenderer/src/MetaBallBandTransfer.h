@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+// Where MetaBallRenderer::renderBands() sends each finished band: the
+// display controller over SPI, the GxEPD2 buffer or a mock panel. A transfer
+// may still be running when send() returns; the renderer fills the other
+// half of its double buffer meanwhile and calls wait() before reusing it.
+class MetaBallBandTransfer
+{
+public:
+  virtual ~MetaBallBandTransfer() {}
+
+  // Starts sending rowCount packed rows (MetaBallRenderer layout) that go to
+  // rows [y, y + rowCount) of the panel. rows stays untouched until wait().
+  virtual void send(const uint8_t* rows, int y, int rowCount) = 0;
+
+  // Returns once the last send() has finished, at once if none is running.
+  virtual void wait() = 0;
+};
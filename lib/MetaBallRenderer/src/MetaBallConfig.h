@@ -0,0 +1,197 @@
+#pragma once
+
+// Compile-time switches of the renderer. Override any of them from
+// build_flags in platformio.ini, e.g. -DMETABALL_FIXED_POINT=1.
+
+// Evaluates the metaball kernel in integer fixed point (MetaBallFixed.h)
+// instead of float. setFace() builds its geometry from integer constants, so
+// the frames match the host bit for bit; the tests hold them to a golden
+// hash. About 3.3 times slower than float on the host.
+#ifndef METABALL_FIXED_POINT
+#define METABALL_FIXED_POINT 0
+#endif
+
+// Pixels only one digit reaches are copied from the flash tiles in
+// include/DigitTiles.h (generated by native/tiles) instead of being blended.
+#ifndef METABALL_DIGIT_TILES
+#define METABALL_DIGIT_TILES 0
+#endif
+
+// Renders from the glyph distance field atlas in include/GlyphAtlas.h
+// (generated by native/tiles) sampled every METABALL_SDF_ATLAS pixels, 2 or
+// 4, instead of blending metaballs. 0 keeps the analytic blend.
+#ifndef METABALL_SDF_ATLAS
+#define METABALL_SDF_ATLAS 0
+#endif
+
+// Blends metaballs with an operator whose result does not depend on the
+// order primitives are added in: heights are summed and the normal's center
+// is a height weighted average of the closest points. Surface and outline
+// come out the same; only the shading differs a little from the ordered
+// blend the face was designed with, which 0 keeps.
+#ifndef METABALL_ASSOCIATIVE_BLEND
+#define METABALL_ASSOCIATIVE_BLEND 0
+#endif
+
+// render() splits the frame into bands of METABALL_PARALLEL_BAND_ROWS rows
+// and renders them on both ESP32 cores (two threads on the host). The frame
+// is the same as the one the serial path renders.
+#ifndef METABALL_PARALLEL
+#define METABALL_PARALLEL 0
+#endif
+
+#ifndef METABALL_PARALLEL_BAND_ROWS
+#define METABALL_PARALLEL_BAND_ROWS 8
+#endif
+
+// Stack of the FreeRTOS task that renders bands on the second core.
+#ifndef METABALL_PARALLEL_STACK
+#define METABALL_PARALLEL_STACK 4096
+#endif
+
+// Every matcap, noise and frame read of the shading goes through the hook
+// set with MetaBallSetTraceHook() (MetaBallTrace.h), so a host build can
+// record the renderer's memory accesses for native/cachesim.
+#ifndef METABALL_TRACE
+#define METABALL_TRACE 0
+#endif
+
+// Scanline and atlas traversals classify METABALL_GBUFFER_ROWS rows into a
+// static G-buffer of 16 bit records (coverage class and matcap texel, 400
+// bytes a row) and then shade them in a second pass, so the geometry pass
+// never reads MatCapSource and the shading pass only reads it and the noise.
+#ifndef METABALL_DEFERRED_SHADING
+#define METABALL_DEFERRED_SHADING 0
+#endif
+
+#ifndef METABALL_GBUFFER_ROWS
+#define METABALL_GBUFFER_ROWS 40
+#endif
+
+#if METABALL_DEFERRED_SHADING && METABALL_PARALLEL
+#error "METABALL_DEFERRED_SHADING has one G-buffer, which both METABALL_PARALLEL cores would share"
+#endif
+
+// Shades from include/MatCapTiled.h and include/BlueNoiseTiled.h, which
+// store the tables in 8 x 4 tiles of one flash cache line each
+// (MetaBallTiledIndex) instead of row by row, so nearby normals and nearby
+// rows share cache lines. The cache model measured slightly more misses than
+// row by row, so the headers are not checked in: generate them with
+// `pio run -e tiles -t exec` before building with this option.
+#ifndef METABALL_TILED_TABLES
+#define METABALL_TILED_TABLES 0
+#endif
+
+// Shades from matcap and blue noise tables of 4 bit levels, two to a byte
+// (include/MatCapPacked.h and include/BlueNoisePacked.h, or the TiledPacked
+// versions with METABALL_TILED_TABLES, generated by native/tiles), which
+// halves their 80 KB.
+#ifndef METABALL_PACKED_TABLES
+#define METABALL_PACKED_TABLES 0
+#endif
+
+// Shades from a grid of matcap values every METABALL_MATCAP_FIT texels, 4 or
+// 8, interpolated bilinearly (MetaBallSampleMatCapFit), instead of the
+// 200 x 200 MatCapSource. The grids are least squares fits of it generated by
+// native/matcapfit: include/MatCapFit4.h (2.6 KB) and MatCapFit8.h (676
+// bytes). METABALL_TILED_TABLES and METABALL_PACKED_TABLES then only apply to
+// the noise. 0 keeps MatCapSource.
+#ifndef METABALL_MATCAP_FIT
+#define METABALL_MATCAP_FIT 0
+#endif
+
+#if METABALL_MATCAP_FIT && METABALL_MATCAP_FIT != 4 && METABALL_MATCAP_FIT != 8
+#error "METABALL_MATCAP_FIT has to be 4 or 8; native/matcapfit makes other powers of two, which MetaBallTables.cpp would have to include"
+#endif
+
+// Thresholds from a tileable METABALL_NOISE_MASK x METABALL_NOISE_MASK blue
+// noise mask (include/BlueNoise16.h, 32 or 64, generated by native/bluenoise)
+// repeated across the frame and indexed with bit masks, instead of the
+// 200 x 200 BlueNoise200. The mask is always row by row and 8 bit, so
+// METABALL_TILED_TABLES and METABALL_PACKED_TABLES then only apply to the
+// matcap. 0 keeps BlueNoise200.
+#ifndef METABALL_NOISE_MASK
+#define METABALL_NOISE_MASK 0
+#endif
+
+#if METABALL_NOISE_MASK && METABALL_NOISE_MASK != 16 && METABALL_NOISE_MASK != 32 && METABALL_NOISE_MASK != 64
+#error "METABALL_NOISE_MASK has to be 16, 32 or 64; native/bluenoise makes other powers of two, which MetaBallTables.cpp would have to include"
+#endif
+
+// MetaBallWatchy copies the matcap and blue noise tables (80 KB, 40 KB when
+// packed) from flash to internal DRAM at wake (MetaBallLoadTables) and the
+// inner loops of the renderer are placed in IRAM, so shading does not go
+// through the flash cache.
+#ifndef METABALL_RAM_TABLES
+#define METABALL_RAM_TABLES 0
+#endif
+
+// Scanline traversal steps capsule and circle distances along a row with
+// forward differences instead of recomputing them for every pixel. The
+// rounding moves a few edge pixels a frame, so it is off by default.
+#ifndef METABALL_FORWARD_DIFFERENCING
+#define METABALL_FORWARD_DIFFERENCING 0
+#endif
+
+// Pixels a forward-differenced primitive is stepped before its distances are
+// recomputed exactly, which bounds the accumulated rounding error.
+#ifndef METABALL_RESYNC_INTERVAL
+#define METABALL_RESYNC_INTERVAL 16
+#endif
+
+// MetaBallWatchy renders the next minute into RTC memory while the panel is
+// refreshing, so the next wake only has to copy it to the display.
+#ifndef METABALL_PRERENDER
+#define METABALL_PRERENDER 0
+#endif
+
+// MetaBallWatchy keeps the last frame in RTC memory and on a minute tick only
+// redraws the layers (MetaBallRenderer::renderLayers) whose inputs changed.
+#ifndef METABALL_LAYER_CACHE
+#define METABALL_LAYER_CACHE 0
+#endif
+
+// MetaBallWatchy keeps the last frame it pushed in RTC memory and diffs every
+// new frame against it (MetaBallDiffFrames) to find the windows to refresh.
+#ifndef METABALL_FRAME_DIFF
+#define METABALL_FRAME_DIFF 0
+#endif
+
+// Most windows MetaBallDiffFrames reports before merging the closest ones.
+#ifndef METABALL_DIFF_WINDOWS
+#define METABALL_DIFF_WINDOWS 4
+#endif
+
+#if (METABALL_PRERENDER + METABALL_LAYER_CACHE + METABALL_FRAME_DIFF) > 1
+#error "METABALL_PRERENDER, METABALL_LAYER_CACHE and METABALL_FRAME_DIFF each keep a frame in RTC memory, which only has room for one"
+#endif
+
+// MetaBallWatchy renders in bands of METABALL_BAND_ROWS rows into a double
+// buffer instead of a whole frame, handing each band on while the next one
+// is rasterized (MetaBallRenderer::renderBands).
+#ifndef METABALL_BANDED
+#define METABALL_BANDED 0
+#endif
+
+#ifndef METABALL_BAND_ROWS
+#define METABALL_BAND_ROWS 20
+#endif
+
+#if METABALL_BANDED && (METABALL_PRERENDER || METABALL_LAYER_CACHE || METABALL_FRAME_DIFF)
+#error "METABALL_BANDED never holds a whole frame, which the RTC frame modes need"
+#endif
+
+// Battery fill steps when a frame is cached. The fill is rounded to them so
+// a cached frame still matches on the next wake; a new step invalidates it.
+#ifndef METABALL_BATTERY_LEVELS
+#define METABALL_BATTERY_LEVELS 32
+#endif
+
+// The row evaluator is float only, and so are the digit tiles native/tiles
+// generates.
+#if METABALL_FIXED_POINT
+#undef METABALL_FORWARD_DIFFERENCING
+#define METABALL_FORWARD_DIFFERENCING 0
+#undef METABALL_DIGIT_TILES
+#define METABALL_DIGIT_TILES 0
+#endif
@@ -0,0 +1,353 @@
+#include "MetaBallFixed.h"
+#include "MetaBallRenderer.h"
+
+int32_t ToFixed(float value)
+{
+  return (int32_t)lroundf(value * FIXED_ONE);
+}
+
+// 2^32 / value, rounded down, for value > 0. It is a single 32 bit division,
+// which the ESP32 does in hardware while a 64 bit one is a libgcc call, and
+// the kernel multiplies by it instead of dividing.
+static uint32_t Reciprocal(const uint32_t& value)
+{
+  return UINT32_MAX / value;
+}
+
+static uint32_t ISqrt32(uint32_t value)
+{
+  if (value == 0)
+    return 0;
+
+  // Highest even power of four not above value.
+  uint32_t bit = (uint32_t)1 << ((31 - __builtin_clz(value)) & ~1);
+  uint32_t result = 0;
+
+  while (bit != 0)
+  {
+    if (value >= result + bit)
+    {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else
+      result >>= 1;
+
+    bit >>= 2;
+  }
+
+  return result;
+}
+
+// Bit by bit square root, rounded down. Squared Q8 distances on the face
+// stay below 2^32, so the 32 bit loop is the common case.
+uint32_t ISqrt(uint64_t value)
+{
+  if (value <= UINT32_MAX)
+    return ISqrt32((uint32_t)value);
+
+  uint64_t bit = (uint64_t)1 << ((63 - __builtin_clzll(value)) & ~1);
+  uint64_t result = 0;
+
+  while (bit != 0)
+  {
+    if (value >= result + bit)
+    {
+      value -= result + bit;
+      result = (result >> 1) + bit;
+    }
+    else
+      result >>= 1;
+
+    bit >>= 2;
+  }
+
+  return (uint32_t)result;
+}
+
+static int64_t Square(const int32_t& value)
+{
+  return (int64_t)value * value;
+}
+
+// x * x * (3 - 2 * x) for x in Q16.
+static int32_t Smoothstep(const int32_t& x)
+{
+  int64_t xSqr = Square(x) >> UNIT_SHIFT;
+  return (int32_t)((xSqr * (3 * UNIT_ONE - 2 * x)) >> UNIT_SHIFT);
+}
+
+void MetaBallFixedBegin(MetaBallFixedPixel& pixel, int x, int y, int32_t extraRadius, uint32_t extraRadiusReciprocal)
+{
+  pixel.x = x << FIXED_SHIFT;
+  pixel.y = y << FIXED_SHIFT;
+  pixel.extraRadius = extraRadius;
+  pixel.extraRadiusReciprocal = extraRadiusReciprocal;
+  pixel.count = 0;
+  pixel.totalDistance = 0;
+#if METABALL_ASSOCIATIVE_BLEND
+  pixel.totalWeight = 0;
+  pixel.weightedX = 0;
+  pixel.weightedY = 0;
+#else
+  pixel.prevRadius = 0;
+  pixel.centerX = pixel.x;
+  pixel.centerY = pixel.y;
+#endif
+}
+
+// Same as the float GetHeight(): what a shape adds to the pixel's height.
+static int32_t GetHeight(const MetaBallFixedPixel& pixel, const int64_t& lengthSqr, const int32_t& radius)
+{
+  const int32_t extraRadius = pixel.extraRadius;
+  int64_t radiusSqr = Square(radius);
+
+  if (lengthSqr < radiusSqr)
+    return ISqrt(radiusSqr - lengthSqr) + extraRadius;
+
+  // edge is in (0, extraRadius], so halfUnlerp is edge / extraRadius in Q15.
+  int32_t distance = ISqrt(lengthSqr);
+  int32_t edge = radius + extraRadius - distance;
+  int32_t halfUnlerp = (int32_t)(((uint64_t)edge * pixel.extraRadiusReciprocal) >> (32 - (UNIT_SHIFT - 1)));
+  return (int32_t)(((int64_t)Smoothstep(halfUnlerp) * 2 * extraRadius) >> UNIT_SHIFT);
+}
+
+#if METABALL_ASSOCIATIVE_BLEND
+
+// Same sums as the float associative Blend().
+static void Blend(MetaBallFixedPixel& pixel, const int32_t& circleX, const int32_t& circleY, const int64_t& lengthSqr, const int32_t& radius)
+{
+  int32_t height = GetHeight(pixel, lengthSqr, radius);
+  int64_t weight = ISqrt((uint64_t)height << FIXED_SHIFT);
+
+  pixel.count++;
+  pixel.totalDistance += height;
+  pixel.totalWeight += weight;
+  pixel.weightedX += weight * circleX;
+  pixel.weightedY += weight * circleY;
+}
+
+#else
+
+// Parameter of the point on segment a + t * (b - a) closest to p, clamped to [0, 1], in Q16.
+static int32_t SegmentWeight(const int32_t& ax, const int32_t& ay, const int32_t& bx, const int32_t& by, const int32_t& px, const int32_t& py)
+{
+  int32_t dx = bx - ax;
+  int32_t dy = by - ay;
+  int64_t sqrMagnitude = Square(dx) + Square(dy);
+
+  if (sqrMagnitude <= 0)
+    return 0;
+
+  int64_t dot = (int64_t)(px - ax) * dx + (int64_t)(py - ay) * dy;
+
+  if (dot <= 0)
+    return 0;
+
+  if (dot >= sqrMagnitude)
+    return UNIT_ONE;
+
+  // Both shifted until the divisor fits 16 bits, which keeps the quotient
+  // within the reciprocal's precision.
+  int shift = max(0, 48 - __builtin_clzll(sqrMagnitude));
+  uint32_t divisor = (uint32_t)(sqrMagnitude >> shift);
+  uint32_t dividend = (uint32_t)(dot >> shift);
+  return (int32_t)(((uint64_t)dividend * Reciprocal(divisor)) >> (32 - UNIT_SHIFT));
+}
+
+// Same steps as the float Blend(): lengthSqr is the squared distance from
+// the pixel to (circleX, circleY), already inside radius + extraRadius.
+static void Blend(MetaBallFixedPixel& pixel, const int32_t& circleX, const int32_t& circleY, const int64_t& lengthSqr, const int32_t& radius)
+{
+  const int32_t extraRadius = pixel.extraRadius;
+  int32_t totalRadius = radius + extraRadius;
+  int64_t radiusSqr = Square(radius);
+  int32_t newDistance = 0;
+
+  pixel.count++;
+
+  if (lengthSqr < radiusSqr)
+  {
+    if (pixel.count > 1)
+      newDistance = ISqrt(radiusSqr - lengthSqr) + extraRadius;
+    else
+      newDistance = FIXED_ONE + extraRadius;
+  }
+  else
+  {
+    newDistance = GetHeight(pixel, lengthSqr, radius);
+  }
+
+  if (pixel.count == 1)
+  {
+    pixel.prevRadius = radius;
+    pixel.centerX = circleX;
+    pixel.centerY = circleY;
+    pixel.totalDistance = newDistance;
+    return;
+  }
+  else if (pixel.count == 2)
+  {
+    int64_t lengthPrevSqr = Square(pixel.x - pixel.centerX) + Square(pixel.y - pixel.centerY);
+    int64_t radiusPrevSqr = Square(pixel.prevRadius);
+
+    if (lengthPrevSqr < radiusPrevSqr)
+      pixel.totalDistance = ISqrt(radiusPrevSqr - lengthPrevSqr) + extraRadius;
+  }
+
+  int32_t offsetX = circleX - pixel.centerX;
+  int32_t offsetY = circleY - pixel.centerY;
+  int32_t offsetLength = ISqrt(Square(offsetX) + Square(offsetY));
+  int32_t normalX = 0;
+  int32_t normalY = 0;
+
+  if (offsetLength > 0)
+  {
+    uint32_t reciprocal = Reciprocal(offsetLength);
+    normalX = (int32_t)(((int64_t)offsetX * reciprocal) >> (32 - UNIT_SHIFT));
+    normalY = (int32_t)(((int64_t)offsetY * reciprocal) >> (32 - UNIT_SHIFT));
+  }
+
+  int32_t prevReach = pixel.prevRadius + extraRadius;
+  int32_t weight = SegmentWeight(
+    circleX - (int32_t)(((int64_t)normalX * totalRadius) >> UNIT_SHIFT),
+    circleY - (int32_t)(((int64_t)normalY * totalRadius) >> UNIT_SHIFT),
+    pixel.centerX + (int32_t)(((int64_t)normalX * prevReach) >> UNIT_SHIFT),
+    pixel.centerY + (int32_t)(((int64_t)normalY * prevReach) >> UNIT_SHIFT),
+    pixel.x, pixel.y);
+
+  pixel.centerX += (int32_t)(((int64_t)offsetX * weight) >> UNIT_SHIFT);
+  pixel.centerY += (int32_t)(((int64_t)offsetY * weight) >> UNIT_SHIFT);
+
+  pixel.totalDistance += newDistance;
+  pixel.prevRadius = ISqrt(Square(pixel.x - pixel.centerX) + Square(pixel.y - pixel.centerY) + Square(pixel.totalDistance - extraRadius));
+}
+
+#endif
+
+static void MetaBall(MetaBallFixedPixel& pixel, const int32_t& circleX, const int32_t& circleY, const int32_t& radius)
+{
+  int32_t offsetX = pixel.x - circleX;
+  int32_t offsetY = pixel.y - circleY;
+  int32_t totalRadius = radius + pixel.extraRadius;
+
+  if (offsetX >= totalRadius || -offsetX >= totalRadius || offsetY >= totalRadius || -offsetY >= totalRadius)
+    return;
+
+  int64_t lengthSqr = Square(offsetX) + Square(offsetY);
+
+  if (lengthSqr >= Square(totalRadius))
+    return;
+
+  Blend(pixel, circleX, circleY, lengthSqr, radius);
+}
+
+static void Capsule(MetaBallFixedPixel& pixel, const MetaBallFixedPrimitive& capsule)
+{
+  int32_t t = 0;
+
+  if (capsule.sqrMagnitude > 0)
+  {
+    int64_t dot = (int64_t)(pixel.x - capsule.centerX) * capsule.differenceX + (int64_t)(pixel.y - capsule.centerY) * capsule.differenceY;
+
+    // Clamping first keeps dot below sqrMagnitude, so dot * tScale stays under 2^48.
+    if (dot >= capsule.sqrMagnitude)
+      t = UNIT_ONE;
+    else if (dot > 0)
+      t = (int32_t)((dot * capsule.tScale) >> 32);
+  }
+
+  int32_t closestX = capsule.centerX + (int32_t)(((int64_t)capsule.differenceX * t) >> UNIT_SHIFT);
+  int32_t closestY = capsule.centerY + (int32_t)(((int64_t)capsule.differenceY * t) >> UNIT_SHIFT);
+  MetaBall(pixel, closestX, closestY, capsule.radius);
+}
+
+static void Arc(MetaBallFixedPixel& pixel, const MetaBallFixedPrimitive& arc)
+{
+  int32_t diffX = pixel.x - arc.centerX;
+  int32_t diffY = pixel.y - arc.centerY;
+  int64_t lengthSquared = Square(diffX) + Square(diffY);
+
+  if (lengthSquared >= arc.outterRadiusSqr)
+    return;
+
+  if (lengthSquared <= arc.innerRadiusSqr)
+    return;
+
+  int64_t startPrependicularDot = (int64_t)arc.startPerpendicularX * diffX + (int64_t)arc.startPerpendicularY * diffY;
+  int64_t endPrependicularDot = (int64_t)arc.endPerpendicularX * diffX + (int64_t)arc.endPerpendicularY * diffY;
+
+  bool isPointOnArc = (!arc.over180 && (startPrependicularDot >= 0 && endPrependicularDot >= 0)) || (arc.over180 && !(startPrependicularDot < 0 && endPrependicularDot < 0));
+
+  if (isPointOnArc)
+  {
+    int32_t length = ISqrt(lengthSquared);
+
+    if (length == 0)
+      MetaBall(pixel, arc.centerX, arc.centerY, arc.radius);
+    else
+    {
+      uint32_t reciprocal = Reciprocal(length);
+      MetaBall(pixel, arc.centerX + (int32_t)(((int64_t)diffX * arc.arcRadius * reciprocal) >> 32),
+        arc.centerY + (int32_t)(((int64_t)diffY * arc.arcRadius * reciprocal) >> 32), arc.radius);
+    }
+  }
+  else if (startPrependicularDot < endPrependicularDot)
+    MetaBall(pixel, arc.endPointX, arc.endPointY, arc.radius);
+  else
+    MetaBall(pixel, arc.startPointX, arc.startPointY, arc.radius);
+}
+
+void MetaBallFixedEvaluate(MetaBallFixedPixel& pixel, const MetaBallFixedPrimitive& primitive)
+{
+  switch (primitive.type)
+  {
+  case PRIMITIVE_CIRCLE:
+    MetaBall(pixel, primitive.centerX, primitive.centerY, primitive.radius);
+    break;
+
+  case PRIMITIVE_CAPSULE:
+    Capsule(pixel, primitive);
+    break;
+
+  case PRIMITIVE_ARC:
+    Arc(pixel, primitive);
+    break;
+  }
+}
+
+MetaBallShade MetaBallFixedShade(const MetaBallFixedPixel& pixel, int16_t& u, int16_t& v)
+{
+  if (pixel.count == 0)
+    return SHADE_BACKGROUND;
+
+  if (pixel.totalDistance > pixel.extraRadius)
+  {
+#if METABALL_ASSOCIATIVE_BLEND
+    // Some shape is deeper than extraRadius here, so totalWeight is not zero.
+    // The weighted sums divided by it stay on screen, so their products with
+    // the reciprocal stay below 2^48.
+    uint32_t weightReciprocal = Reciprocal((uint32_t)pixel.totalWeight);
+    int32_t centerX = (int32_t)((pixel.weightedX * weightReciprocal) >> 32);
+    int32_t centerY = (int32_t)((pixel.weightedY * weightReciprocal) >> 32);
+    int32_t prevRadius = ISqrt(Square(pixel.x - centerX) + Square(pixel.y - centerY) + Square(pixel.totalDistance - pixel.extraRadius));
+#else
+    int32_t centerX = pixel.centerX;
+    int32_t centerY = pixel.centerY;
+    int32_t prevRadius = pixel.prevRadius;
+#endif
+
+    // normal = (position - center) * 100 / prevRadius + 100 in Q8, floored to a texel.
+    uint32_t reciprocal = Reciprocal(max(prevRadius, (int32_t)1));
+    int32_t normalX = (int32_t)(((int64_t)(pixel.x - centerX) * 100 * reciprocal) >> (32 - FIXED_SHIFT)) + (100 << FIXED_SHIFT);
+    int32_t normalY = (int32_t)(((int64_t)(pixel.y - centerY) * 100 * reciprocal) >> (32 - FIXED_SHIFT)) + (100 << FIXED_SHIFT);
+    u = constrain(normalX >> FIXED_SHIFT, 0, 199);
+    v = constrain(normalY >> FIXED_SHIFT, 0, 199);
+    return SHADE_SURFACE;
+  }
+
+  if (pixel.totalDistance >= pixel.extraRadius - FIXED_ONE)
+    return SHADE_OUTLINE;
+
+  return SHADE_BACKGROUND;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "MetaBallConfig.h"
+
+// How a pixel of the face is drawn once all primitives are blended.
+enum MetaBallShade : uint8_t
+{
+  SHADE_BACKGROUND,
+  SHADE_OUTLINE,
+  SHADE_SURFACE
+};
+
+// Integer version of the metaball kernel, selected with METABALL_FIXED_POINT.
+// Only additions, multiplications, shifts, 32 bit divisions and an integer
+// square root are used per pixel; quotients are taken as a multiplication
+// by a 32 bit reciprocal rather than a 64 bit division. setFace() builds the
+// primitives from integer constants, so a face is drawn the same on every
+// platform.
+//
+// Formats: positions, radii and distances are Q8 (1/256 pixel) in int32,
+// their squares are Q16 in int64, unit vectors and segment parameters are
+// Q16 fractions.
+
+const int FIXED_SHIFT = 8;
+const int32_t FIXED_ONE = 1 << FIXED_SHIFT;
+const int UNIT_SHIFT = 16;
+const int32_t UNIT_ONE = 1 << UNIT_SHIFT;
+
+// Rounds a float input, such as a glyph position, to Q8.
+int32_t ToFixed(float value);
+uint32_t ISqrt(uint64_t value);
+
+// Fixed point copy of a MetaBallPrimitive, filled in by the renderer.
+struct MetaBallFixedPrimitive
+{
+  uint8_t type;
+  bool over180;
+
+  int32_t radius;
+  int32_t extraRadius;
+  int32_t centerX;
+  int32_t centerY;
+
+  // Capsule: end - start, its squared length and 2^48 / sqrMagnitude.
+  int32_t differenceX;
+  int32_t differenceY;
+  int64_t sqrMagnitude;
+  int64_t tScale;
+
+  // Arc: perpendiculars of both end directions (Q16), the end points, the
+  // arc radius and the squared radii of the influenced annulus.
+  int32_t startPerpendicularX;
+  int32_t startPerpendicularY;
+  int32_t endPerpendicularX;
+  int32_t endPerpendicularY;
+  int32_t startPointX;
+  int32_t startPointY;
+  int32_t endPointX;
+  int32_t endPointY;
+  int32_t arcRadius;
+  int64_t outterRadiusSqr;
+  int64_t innerRadiusSqr;
+};
+
+// Blend state of one pixel, the fixed point twin of PixelBlend in the float
+// kernel. With METABALL_ASSOCIATIVE_BLEND the center is kept as sums of the
+// closest points weighted by the square root of their height (Q8), in Q16.
+struct MetaBallFixedPixel
+{
+  int32_t x;
+  int32_t y;
+  int32_t extraRadius;
+  uint32_t extraRadiusReciprocal;
+  int count;
+  int32_t totalDistance;
+#if METABALL_ASSOCIATIVE_BLEND
+  int64_t totalWeight;
+  int64_t weightedX;
+  int64_t weightedY;
+#else
+  int32_t prevRadius;
+  int32_t centerX;
+  int32_t centerY;
+#endif
+};
+
+// extraRadiusReciprocal is 2^32 / extraRadius, rounded down.
+void MetaBallFixedBegin(MetaBallFixedPixel& pixel, int x, int y, int32_t extraRadius, uint32_t extraRadiusReciprocal);
+void MetaBallFixedEvaluate(MetaBallFixedPixel& pixel, const MetaBallFixedPrimitive& primitive);
+
+// Classifies the blended pixel; for SHADE_SURFACE u and v are the matcap texel.
+MetaBallShade MetaBallFixedShade(const MetaBallFixedPixel& pixel, int16_t& u, int16_t& v);
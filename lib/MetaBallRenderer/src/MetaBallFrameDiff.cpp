@@ -0,0 +1,89 @@
+#include "MetaBallFrameDiff.h"
+
+static int GetArea(const MetaBallRect& rect)
+{
+  return (rect.x1 - rect.x0 + 1) * (rect.y1 - rect.y0 + 1);
+}
+
+static MetaBallRect GetUnion(const MetaBallRect& a, const MetaBallRect& b)
+{
+  MetaBallRect rect = { min(a.x0, b.x0), min(a.y0, b.y0), max(a.x1, b.x1), max(a.y1, b.y1) };
+  return rect;
+}
+
+int MetaBallDiffFrames(const uint8_t* previous, const uint8_t* current, MetaBallRect* windows, int maxWindows)
+{
+  const int ROW_BYTES = MetaBallRenderer::ROW_BYTES;
+
+  // Nowhere to put the first changed row.
+  if (maxWindows < 1)
+    return 0;
+
+  int count = 0;
+  int lastChangedRow = -2;
+
+  for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+  {
+    const uint8_t* a = previous + y * ROW_BYTES;
+    const uint8_t* b = current + y * ROW_BYTES;
+
+    int first = 0;
+    while (first < ROW_BYTES && a[first] == b[first])
+      first++;
+
+    if (first == ROW_BYTES)
+      continue;
+
+    int last = ROW_BYTES - 1;
+    while (a[last] == b[last])
+      last--;
+
+    MetaBallRect row = { (int16_t)(first * 8), (int16_t)y, (int16_t)(last * 8 + 7), (int16_t)y };
+
+    // A row right below the previous changed one extends its run.
+    if (lastChangedRow == y - 1)
+      windows[count - 1] = GetUnion(windows[count - 1], row);
+    else
+    {
+      // Out of windows: fold the pair that grows the least into one first.
+      if (count == maxWindows)
+      {
+        int best = 0;
+        int bestGrowth = INT32_MAX;
+
+        for (int i = 0; i + 1 < count; ++i)
+        {
+          int growth = GetArea(GetUnion(windows[i], windows[i + 1])) - GetArea(windows[i]) - GetArea(windows[i + 1]);
+
+          if (growth < bestGrowth)
+          {
+            bestGrowth = growth;
+            best = i;
+          }
+        }
+
+        if (count > 1)
+        {
+          windows[best] = GetUnion(windows[best], windows[best + 1]);
+
+          for (int i = best + 1; i + 1 < count; ++i)
+            windows[i] = windows[i + 1];
+
+          count--;
+        }
+        else
+        {
+          windows[0] = GetUnion(windows[0], row);
+          lastChangedRow = y;
+          continue;
+        }
+      }
+
+      windows[count++] = row;
+    }
+
+    lastChangedRow = y;
+  }
+
+  return count;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "MetaBallRenderer.h"
+
+// Finds at most maxWindows windows that together cover every pixel that
+// differs between two packed frames (MetaBallRenderer layout). Windows start
+// and end on whole bytes. Rows that changed are grouped into runs, each run
+// spanning the columns of its changed bytes, and the runs closest together are
+// merged until maxWindows are left. Nothing about the face is assumed.
+// Returns the number of windows, 0 when the frames are the same or
+// maxWindows is less than 1.
+int MetaBallDiffFrames(const uint8_t* previous, const uint8_t* current, MetaBallRect* windows, int maxWindows);
@@ -0,0 +1,88 @@
+#include "MetaBallRenderer.h"
+
+#include <atomic>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#else
+#include <thread>
+#endif
+
+// Work shared by both cores. Bands are handed out one at a time so a core
+// that gets the empty rows around the battery line simply takes more.
+struct ParallelJob
+{
+  const MetaBallRenderer* renderer;
+  uint8_t* frame;
+  std::atomic<int> nextBand;
+  std::atomic<int> evaluated;
+#ifdef ARDUINO_ARCH_ESP32
+  // Notified by the helper task once it runs out of bands.
+  TaskHandle_t caller;
+#endif
+};
+
+const int BAND_COUNT = (MetaBallRenderer::HEIGHT + METABALL_PARALLEL_BAND_ROWS - 1) / METABALL_PARALLEL_BAND_ROWS;
+
+static void RenderBands(ParallelJob& job)
+{
+  int evaluated = 0;
+
+  for (int band = job.nextBand++; band < BAND_COUNT; band = job.nextBand++)
+  {
+    int yStart = band * METABALL_PARALLEL_BAND_ROWS;
+    int yEnd = min(yStart + METABALL_PARALLEL_BAND_ROWS, (int)MetaBallRenderer::HEIGHT);
+    evaluated += job.renderer->renderRows(job.frame + yStart * MetaBallRenderer::ROW_BYTES, yStart, yEnd);
+  }
+
+  job.evaluated += evaluated;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+
+static void RenderBandsTask(void* parameter)
+{
+  ParallelJob& job = *(ParallelJob*)parameter;
+  RenderBands(job);
+  xTaskNotifyGive(job.caller);
+  vTaskDelete(NULL);
+}
+
+#endif
+
+int MetaBallRenderer::renderParallel(uint8_t* frame) const
+{
+#if METABALL_DEFERRED_SHADING
+  // Both cores would classify into the one G-buffer.
+  return renderRows(frame, 0, HEIGHT);
+#endif
+
+  ParallelJob job;
+  job.renderer = this;
+  job.frame = frame;
+  job.nextBand = 0;
+  job.evaluated = 0;
+
+#ifdef ARDUINO_ARCH_ESP32
+  // The helper runs on the core the Arduino loop is not on, at the loop's
+  // priority so it does not starve the Wi-Fi and idle tasks there.
+  job.caller = xTaskGetCurrentTaskHandle();
+
+  if (xTaskCreatePinnedToCore(RenderBandsTask, "MetaBallBands", METABALL_PARALLEL_STACK, &job, uxTaskPriorityGet(NULL), NULL, 1 - xPortGetCoreID()) != pdPASS)
+  {
+    // No memory for the task: this core renders every band.
+    RenderBands(job);
+    return job.evaluated;
+  }
+
+  RenderBands(job);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#else
+  std::thread helper(RenderBands, std::ref(job));
+  RenderBands(job);
+  helper.join();
+#endif
+
+  return job.evaluated;
+}
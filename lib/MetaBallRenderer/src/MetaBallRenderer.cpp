@@ -0,0 +1,2477 @@
+#include "MetaBallRenderer.h"
+#include "MetaBallConfig.h"
+#include "MetaBallAtlas.h"
+#include "MetaBallBandTransfer.h"
+
+#include "MetaBallTables.h"
+#include "MetaBallTrace.h"
+
+#if METABALL_DIGIT_TILES
+#include "../../../include/DigitTiles.h"
+#endif
+
+METABALL_IRAM static bool getColor(const int16_t& x, const int16_t& y, const uint16_t& color)
+{
+  METABALL_TRACE_READ(TRACE_NOISE, MetaBallNoiseByte(MetaBallNoiseIndex(x, y)), 1);
+  return color > MetaBallReadNoise(MetaBallNoiseIndex(x, y));
+}
+
+// Matcap value of texel (u, v), read from the table or, with
+// METABALL_MATCAP_FIT, interpolated from the fitted grid.
+METABALL_IRAM static uint8_t ReadMatCap(const int16_t& u, const int16_t& v)
+{
+#if METABALL_MATCAP_FIT
+  METABALL_TRACE_READ(TRACE_MATCAP, (v / METABALL_MATCAP_FIT) * METABALL_MATCAP_FIT_NODES + u / METABALL_MATCAP_FIT, 2);
+  METABALL_TRACE_READ(TRACE_MATCAP, (v / METABALL_MATCAP_FIT + 1) * METABALL_MATCAP_FIT_NODES + u / METABALL_MATCAP_FIT, 2);
+  return MetaBallSampleMatCapFit(MetaBallMatCap, METABALL_MATCAP_FIT, u, v);
+#else
+  METABALL_TRACE_READ(TRACE_MATCAP, MetaBallTableByte(MetaBallTableIndex(u, v)), 1);
+  return MetaBallReadMatCap(MetaBallTableIndex(u, v));
+#endif
+}
+
+static bool getColor3(const int16_t& x, const int16_t& y, const int16_t& xUv, const int16_t& yUv)
+{
+  return getColor(x,y,ReadMatCap(xUv, yUv));
+}
+
+static float clamp(float val, const float& min, const float& max)
+{
+  if (val > max)
+    val = max;
+
+  if (val < min)
+    val = min;
+
+  return val;
+}
+
+static Vec2f getPerpendicular(Vec2f vector) {
+	return Vec2f( -vector.y, vector.x );
+}
+
+static Vec2f ClosestPointOnCapsule(const MetaBallPrimitive& capsule, const Vec2f& p)
+{
+  float unlerp = 0.0f;
+
+  if (capsule.sqrMagnitude > 0.0f)
+    unlerp = (p - capsule.center).dot(capsule.difference) / capsule.sqrMagnitude;
+
+  unlerp = clamp(unlerp, 0.0f, 1.0f);
+  return capsule.center + capsule.difference * unlerp;
+}
+
+static Vec2f ClosestPointOnArc(const MetaBallPrimitive& arc, const Vec2f& p)
+{
+  Vec2f diff = p - arc.center;
+
+  float startPrependicularDot = arc.startPerpendicular.dot(diff);
+  float endPrependicularDot = arc.endPerpendicular.dot(diff);
+
+  bool isPointOnArc = (!arc.over180 && (startPrependicularDot >= 0.0f && endPrependicularDot >= 0.0f)) || (arc.over180 && !(startPrependicularDot < 0.0f && endPrependicularDot < 0.0f));
+
+  if (isPointOnArc)
+    return arc.center + diff.getNormalized() * arc.arcRadius;
+
+  if (startPrependicularDot < endPrependicularDot)
+    return arc.center + arc.end * arc.arcRadius;
+
+  return arc.center + arc.start * arc.arcRadius;
+}
+
+#if !METABALL_FIXED_POINT
+
+static float unlerp(const float& value, const float& min, const float& max) {
+  return (value - min) / (max - min);
+}
+
+static float smoothstep(const float& x) {
+  // Evaluate polynomial
+  return x * x * (3 - 2 * x);
+}
+
+#if METABALL_ASSOCIATIVE_BLEND
+
+// Blend state of one pixel while its primitives are accumulated. Every
+// field is a sum, so primitives can be added in any order.
+struct PixelBlend
+{
+  Vec2f currentPos;
+  int count;
+  float totalDistance;
+  float totalWeight;
+  Vec2f weightedCenter;
+};
+
+#else
+
+// Blend state of one pixel while its primitives are accumulated.
+struct PixelBlend
+{
+  Vec2f currentPos;
+  int count;
+  float totalDistance;
+  float prevRadius;
+  Vec2f center;
+};
+
+#endif
+
+// Height a shape adds to the pixel: the sphere of the given radius inside it,
+// a smooth falloff over extraRadius outside.
+static float GetHeight(const float& lengthSqr, const float& radius, const float& extraRadius)
+{
+  float radiusSqr = radius * radius;
+
+  if (lengthSqr < radiusSqr)
+    return sqrtf(radiusSqr - lengthSqr) + extraRadius;
+
+  float distance = sqrtf(lengthSqr);
+  float edge = radius + extraRadius - distance;
+  return smoothstep(unlerp(edge, 0, extraRadius) * 0.5f) * 2.0f * extraRadius;
+}
+
+#if METABALL_ASSOCIATIVE_BLEND
+
+// Adds one shape to the sums, lengthSqr being the squared distance from the
+// pixel to circleCenter, already known to be inside radius + extraRadius.
+// The heights add up exactly as in the ordered blend; the normal's center is
+// the average of the shapes' closest points weighted by the square root of
+// their height, the weight whose shading came closest in a day of frames.
+static void Blend(PixelBlend& pixel, const Vec2f& circleCenter, const float& lengthSqr, const float& radius, const float& extraRadius)
+{
+  float height = GetHeight(lengthSqr, radius, extraRadius);
+  float weight = sqrtf(height);
+
+  pixel.count++;
+  pixel.totalDistance += height;
+  pixel.totalWeight += weight;
+  pixel.weightedCenter += circleCenter * weight;
+}
+
+#else
+
+static Vec2f ClosestPointOnSegment(const Vec2f& s1, const Vec2f& s2, const Vec2f& p, float& unlerp)
+{
+  Vec2f difference = s2 - s1;
+  float sqrMagnitude = difference.lengthSquared();
+
+  if (sqrMagnitude > 0.0f)
+    unlerp = (p - s1).dot(difference) / sqrMagnitude;
+  else
+    unlerp = 0.0f;
+
+  unlerp = clamp(unlerp, 0.0f, 1.0f);
+  return s1 + difference * unlerp;
+}
+
+// Blends one shape into the pixel, lengthSqr being the squared distance from
+// currentPos to circleCenter, already known to be inside radius + extraRadius.
+static void Blend(PixelBlend& pixel, const Vec2f& circleCenter, const float& lengthSqr, const float& radius, const float& extraRadius)
+{
+  const Vec2f& currentPos = pixel.currentPos;
+  float& totalDistance = pixel.totalDistance;
+  float& prevRadius = pixel.prevRadius;
+  Vec2f& prevCenter = pixel.center;
+
+  float totalRadius = radius + extraRadius;
+  float radiusSqr = radius * radius;
+  float newDistance = 0.0f;
+
+  int count = ++pixel.count;
+
+  if (lengthSqr < radiusSqr)
+  {
+    if (count > 1)
+      newDistance = sqrt(radiusSqr - lengthSqr) + extraRadius;
+    else
+      newDistance = 1.0f + extraRadius;
+  }
+  else
+  {
+    newDistance = GetHeight(lengthSqr, radius, extraRadius);
+  }
+
+  if (count == 1)
+  {
+    prevRadius = radius;
+    prevCenter = circleCenter;
+    totalDistance = newDistance;
+    return;
+  }
+  else if (count == 2)
+  {
+    Vec2f offsetPrev = currentPos - prevCenter;
+    float lengthPrevSqr = offsetPrev.lengthSquared();
+
+    float radiusPrevSqr = prevRadius * prevRadius;
+
+    if (lengthPrevSqr < radiusPrevSqr)
+    {
+      totalDistance = sqrt(radiusPrevSqr - lengthPrevSqr) + extraRadius;
+    }
+  }
+
+  Vec2f offsetBetweenCenters = circleCenter - prevCenter;
+  Vec2f offsetBetweenCentersNormalized = offsetBetweenCenters.getNormalized();
+
+  float weight = 0.0f;
+  ClosestPointOnSegment(circleCenter - offsetBetweenCentersNormalized * totalRadius, prevCenter + offsetBetweenCentersNormalized * (prevRadius + extraRadius), currentPos, weight);
+
+  float otherWeight = 1.0f - weight;
+  Vec2f newCenter = circleCenter * weight + prevCenter * otherWeight;
+  prevCenter = newCenter;
+
+  totalDistance += newDistance;
+  Vec3f pointOnSurface (currentPos.x, currentPos.y, totalDistance);
+  Vec3f centerV3 (newCenter.x, newCenter.y, extraRadius);
+
+  prevRadius = (pointOnSurface - centerV3).length();
+}
+
+#endif
+
+static void MetaBall(PixelBlend& pixel, const Vec2f& circleCenter, const float& radius, const float& extraRadius)
+{
+  Vec2f offset = pixel.currentPos - circleCenter;
+  float totalRadius = radius + extraRadius;
+  float lengthSqr = offset.lengthSquared();
+
+  if (lengthSqr >= totalRadius * totalRadius)
+    return;
+
+  Blend(pixel, circleCenter, lengthSqr, radius, extraRadius);
+}
+
+static void Arc(PixelBlend& pixel, const MetaBallPrimitive& arc, const float& extraRadius)
+{
+  Vec2f offset = pixel.currentPos - arc.center;
+  float lengthSquared = offset.lengthSquared();
+
+  if (lengthSquared >= arc.outterRadiusSqr)
+    return;
+
+  if (lengthSquared <= arc.innerRadiusSqr)
+    return;
+
+  Vec2f closestToArc = ClosestPointOnArc(arc, pixel.currentPos);
+  MetaBall(pixel, closestToArc, arc.radius, extraRadius);
+}
+
+static void Evaluate(PixelBlend& pixel, const MetaBallPrimitive& primitive, const float& extraRadius)
+{
+  switch (primitive.type)
+  {
+  case PRIMITIVE_CIRCLE:
+    MetaBall(pixel, primitive.center, primitive.radius, extraRadius);
+    break;
+
+  case PRIMITIVE_CAPSULE:
+    MetaBall(pixel, ClosestPointOnCapsule(primitive, pixel.currentPos), primitive.radius, extraRadius);
+    break;
+
+  case PRIMITIVE_ARC:
+    Arc(pixel, primitive, extraRadius);
+    break;
+  }
+}
+
+#endif
+
+const float EXTRA_RADIUS = 9.0f;
+const float SCREEN_MAX = 199.0f;
+
+// Heights add up, and a shape alone stays below the outline height of
+// EXTRA_RADIUS - 1 once a pixel is about 0.67 pixels outside its radius.
+// So a pixel that only one shape reaches, and no closer than VISIBLE_MARGIN
+// to its radius, stays background. HALO_WIDTH is the rest of the influence.
+const float VISIBLE_MARGIN = 1.0f;
+const float HALO_WIDTH = EXTRA_RADIUS - VISIBLE_MARGIN;
+
+// The integer kernel rounds its own copy of the shapes (SetFixedFace()), so
+// with METABALL_FIXED_POINT the box is a pixel wider to hold both copies.
+#if METABALL_FIXED_POINT
+const float BOUNDS_MARGIN = 1.0f;
+#else
+const float BOUNDS_MARGIN = 0.0f;
+#endif
+
+static void SetBounds(MetaBallPrimitive& primitive, float minX, float maxX, float minY, float maxY)
+{
+  float influence = primitive.radius + EXTRA_RADIUS;
+  primitive.influenceRadius = influence;
+  primitive.minX = minX - influence - BOUNDS_MARGIN;
+  primitive.maxX = maxX + influence + BOUNDS_MARGIN;
+  primitive.minY = minY - influence - BOUNDS_MARGIN;
+  primitive.maxY = maxY + influence + BOUNDS_MARGIN;
+}
+
+// Narrows the influence box of primitives [first, count) to a region. Integer
+// pixel coordinates make "x < limit" the same as "x <= Below(limit)".
+static void ClipBounds(MetaBallPrimitive* primitives, int first, int count, float minX, float maxX, float minY, float maxY)
+{
+  for (int i = first; i < count; ++i)
+  {
+    MetaBallPrimitive& primitive = primitives[i];
+    primitive.minX = fmaxf(primitive.minX, minX);
+    primitive.maxX = fminf(primitive.maxX, maxX);
+    primitive.minY = fmaxf(primitive.minY, minY);
+    primitive.maxY = fminf(primitive.maxY, maxY);
+  }
+}
+
+static float Below(float limit)
+{
+  return ceilf(limit) - 1.0f;
+}
+
+static float Above(float limit)
+{
+  return floorf(limit) + 1.0f;
+}
+
+static void AddCircle(const Vec2f& center, const float& radius, MetaBallPrimitive* primitives, int& count)
+{
+  MetaBallPrimitive& circle = primitives[count++];
+  circle.type = PRIMITIVE_CIRCLE;
+  circle.radius = radius;
+  circle.center = center;
+
+  SetBounds(circle, center.x, center.x, center.y, center.y);
+}
+
+static void AddSegment(const Vec2f& s1, const Vec2f& s2, const float& radius, MetaBallPrimitive* primitives, int& count)
+{
+  MetaBallPrimitive& capsule = primitives[count++];
+  capsule.type = PRIMITIVE_CAPSULE;
+  capsule.radius = radius;
+  capsule.center = s1;
+  capsule.difference = s2 - s1;
+  capsule.sqrMagnitude = capsule.difference.lengthSquared();
+
+  SetBounds(capsule, fminf(s1.x, s2.x), fmaxf(s1.x, s2.x), fminf(s1.y, s2.y), fmaxf(s1.y, s2.y));
+
+  if (capsule.sqrMagnitude > 0.0f)
+    capsule.influenceOffset = getPerpendicular(capsule.difference) * (capsule.influenceRadius / sqrtf(capsule.sqrMagnitude));
+  else
+    capsule.influenceOffset = Vec2f(0.0f, 0.0f);
+}
+
+static void AddArc(const Vec2f& center, const Vec2f& start, const Vec2f& end, const float& radius,
+ const float& arcRadius, const float& arcStartAngle, const float& arcAngle, MetaBallPrimitive* primitives, int& count)
+{
+  MetaBallPrimitive& arc = primitives[count++];
+  arc.type = PRIMITIVE_ARC;
+  arc.radius = radius;
+  arc.center = center;
+  arc.start = start;
+  arc.end = end;
+  arc.startPerpendicular = getPerpendicular(start);
+  arc.endPerpendicular = -getPerpendicular(end);
+  arc.arcRadius = arcRadius;
+  arc.over180 = arcAngle > 180;
+
+  float outterRadius = radius + EXTRA_RADIUS + arcRadius;
+  arc.outterRadiusSqr = outterRadius * outterRadius;
+
+  float innerRadius = arcRadius - radius - EXTRA_RADIUS;
+  arc.innerRadiusSqr = innerRadius > 0.0f ? innerRadius * innerRadius : -1.0f;
+
+  // Bounds of the swept curve: both end points plus every axis crossing inside the sweep.
+  Vec2f startPoint = center + start * arcRadius;
+  Vec2f endPoint = center + end * arcRadius;
+  float minX = fminf(startPoint.x, endPoint.x);
+  float maxX = fmaxf(startPoint.x, endPoint.x);
+  float minY = fminf(startPoint.y, endPoint.y);
+  float maxY = fmaxf(startPoint.y, endPoint.y);
+
+  for (int axisAngle = 0; axisAngle < 720; axisAngle += 90)
+  {
+    if (axisAngle < arcStartAngle || axisAngle > arcStartAngle + arcAngle)
+      continue;
+
+    switch (axisAngle % 360)
+    {
+    case 0: maxX = center.x + arcRadius; break;
+    case 90: maxY = center.y + arcRadius; break;
+    case 180: minX = center.x - arcRadius; break;
+    case 270: minY = center.y - arcRadius; break;
+    }
+  }
+
+  SetBounds(arc, minX, maxX, minY, maxY);
+  arc.influenceRadius = outterRadius;
+}
+
+const float RADIUS_PERCENTAGE = 0.2f;
+const float HALF_OFFSET = (0.5f - RADIUS_PERCENTAGE);
+const float OFFSET = (1.0f - RADIUS_PERCENTAGE);
+
+static void Draw0(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * 0.5f;
+  Vec2f s1 = center + Vec2f(0.0f, radius);
+  Vec2f s2 = center + Vec2f(0.0f, -radius);
+
+  AddSegment(s1, s2, radius, primitives, count);
+}
+
+static void Draw1(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
+  Vec2f s2 = center + Vec2f(size * HALF_OFFSET, size * OFFSET);
+  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, -size * 0.2f);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddSegment(s1, s3, radius, primitives, count);
+}
+
+const float DRAW_2_ARC_START_ANGLE = 180.0f;
+const Vec2f DRAW_2_ARC_START = Vec2f(cos(DRAW_2_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_2_ARC_START_ANGLE * DEG_TO_RAD));
+
+const float DRAW_2_ARC_END_ANGLE = 198.0f;
+const float DRAW_2_ARC_END_ANGLE_SUM = DRAW_2_ARC_START_ANGLE + DRAW_2_ARC_END_ANGLE;
+const Vec2f DRAW_2_ARC_END = Vec2f(cos(DRAW_2_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_2_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+
+static void Draw2(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f arcCenter = center + Vec2f(0.0f, -size * 0.5f);
+  Vec2f s2 = center + Vec2f(size * 0.2f, -size * 0.2f);
+  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
+  Vec2f s4 = center + Vec2f(size * HALF_OFFSET, size * OFFSET);
+
+  AddArc(arcCenter, DRAW_2_ARC_START, DRAW_2_ARC_END, radius, size * HALF_OFFSET,
+    DRAW_2_ARC_START_ANGLE, DRAW_2_ARC_END_ANGLE, primitives, count);
+  ClipBounds(primitives, count - 1, count, 0.0f, SCREEN_MAX, 0.0f, Below(arcCenter.y + DRAW_2_ARC_END.y * size * HALF_OFFSET + radius + EXTRA_RADIUS));
+
+  AddSegment(s2, s3, radius, primitives, count);
+  AddSegment(s3, s4, radius, primitives, count);
+}
+
+
+const float DRAW_3_ARC_START_ANGLE = 240.0f;
+const Vec2f DRAW_3_ARC_START = Vec2f(cos(DRAW_3_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_3_ARC_START_ANGLE * DEG_TO_RAD));
+
+const float DRAW_3_ARC_END_ANGLE = 200.0f;
+const float DRAW_3_ARC_END_ANGLE_SUM = DRAW_3_ARC_START_ANGLE + DRAW_3_ARC_END_ANGLE;
+const Vec2f DRAW_3_ARC_END = Vec2f(cos(DRAW_3_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_3_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+
+const float DRAW_3_2_ARC_START_ANGLE = 280.0f;
+const Vec2f DRAW_3_2_ARC_START = Vec2f(cos(DRAW_3_2_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_3_2_ARC_START_ANGLE * DEG_TO_RAD));
+
+const float DRAW_3_2_ARC_END_ANGLE = 200.0f;
+const float DRAW_3_2_ARC_END_ANGLE_SUM = DRAW_3_2_ARC_START_ANGLE + DRAW_3_2_ARC_END_ANGLE;
+const Vec2f DRAW_3_2_ARC_END = Vec2f(cos(DRAW_3_2_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_3_2_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+
+static void Draw3(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+
+  AddArc(center + Vec2f(-size * 0.1f, -size * 0.4f), DRAW_3_ARC_START, DRAW_3_ARC_END, radius, size * (HALF_OFFSET + 0.1f),
+   DRAW_3_ARC_START_ANGLE, DRAW_3_ARC_END_ANGLE, primitives, count);
+
+  AddArc(center + Vec2f(-size * 0.1f, size * 0.4f), DRAW_3_2_ARC_START, DRAW_3_2_ARC_END, radius, size * (HALF_OFFSET + 0.1f),
+   DRAW_3_2_ARC_START_ANGLE, DRAW_3_2_ARC_END_ANGLE, primitives, count);
+}
+
+static void Draw4(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(0.0f, -size * OFFSET);
+  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, size * 0.2f);
+  Vec2f s3 = center + Vec2f(size * HALF_OFFSET, size * 0.2f);
+  Vec2f s4 = center + Vec2f(size * 0.3f, 0.0f);
+  Vec2f s5 = center + Vec2f(size * 0.1f, size * OFFSET);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddSegment(s2, s3, radius, primitives, count);
+  AddSegment(s4, s5, radius, primitives, count);
+}
+
+const float DRAW_5_ARC_START_ANGLE = 235.0f;
+const Vec2f DRAW_5_ARC_START = Vec2f(cos(DRAW_5_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_5_ARC_START_ANGLE * DEG_TO_RAD));
+
+const float DRAW_5_ARC_END_ANGLE = 250.0f;
+const float DRAW_5_ARC_END_ANGLE_SUM = DRAW_5_ARC_START_ANGLE + DRAW_5_ARC_END_ANGLE;
+const Vec2f DRAW_5_ARC_END = Vec2f(cos(DRAW_5_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_5_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+
+static void Draw5(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
+  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, -size * OFFSET);
+  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, 0.0f);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddSegment(s2, s3, radius, primitives, count);
+
+  AddArc(center + Vec2f(-size * 0.1f, size * 0.4f), DRAW_5_ARC_START, DRAW_5_ARC_END, radius, size * (HALF_OFFSET + 0.1f),
+   DRAW_5_ARC_START_ANGLE, DRAW_5_ARC_END_ANGLE, primitives, count);
+}
+
+static void Draw6(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
+  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET * 0.5f, size * 0.35f * 0.4f);
+  Vec2f s3 = center + Vec2f(0.0f, size * 0.5f);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddCircle(s3, size * 0.5f, primitives, count);
+}
+
+static void Draw7(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
+  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
+  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, -size * OFFSET);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddSegment(s1, s3, radius, primitives, count);
+}
+
+static void Draw8(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  Vec2f s1 = center + Vec2f(0.0f, -size * 0.6f);
+  Vec2f s2 = center + Vec2f(0.0f, size * 0.5f);
+  Vec2f s3 = center + Vec2f(0.0f, size * 0.2f);
+
+  AddCircle(s1, size * 0.4f, primitives, count);
+  AddSegment(s2, s3, size * 0.5f, primitives, count);
+}
+
+static void Draw9(const Vec2f& center, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  float radius = size * RADIUS_PERCENTAGE;
+  Vec2f s1 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
+  Vec2f s2 = center + Vec2f(size * HALF_OFFSET * 0.5f, -size * 0.35f * 0.4f);
+  Vec2f s3 = center + Vec2f(0.0f, -size * 0.5f);
+
+  AddSegment(s1, s2, radius, primitives, count);
+  AddCircle(s3, size * 0.5f, primitives, count);
+}
+
+static void DrawDigit(const Vec2f& center, const int& digit, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  switch (digit)
+  {
+  case 0:
+    Draw0(center, size, primitives, count);
+    break;
+
+  case 1:
+    Draw1(center, size, primitives, count);
+    break;
+
+  case 2:
+    Draw2(center, size, primitives, count);
+    break;
+
+  case 3:
+    Draw3(center, size, primitives, count);
+    break;
+
+  case 4:
+    Draw4(center, size, primitives, count);
+    break;
+
+  case 5:
+    Draw5(center, size, primitives, count);
+    break;
+
+  case 6:
+    Draw6(center, size, primitives, count);
+    break;
+
+  case 7:
+    Draw7(center, size, primitives, count);
+    break;
+
+  case 8:
+    Draw8(center, size, primitives, count);
+    break;
+
+  case 9:
+    Draw9(center, size, primitives, count);
+    break;
+
+  default:
+    break;
+  }
+}
+
+const float NUMBER_SEPARATION = 4.0f;
+const float NUMBER_SEPARATION_HALF = NUMBER_SEPARATION * 0.5f;
+
+// Center of the first (index 0) or second digit of a number.
+static Vec2f GetDigitCenter(const Vec2f& center, const float& size, const int& index)
+{
+  float offset = size * 0.5f + NUMBER_SEPARATION_HALF;
+  return center + Vec2f(index == 0 ? -offset : offset, 0.0f);
+}
+
+// Returns the index of the second digit's first primitive.
+static int DrawNumber(const Vec2f& center, const int& number, const float& size, MetaBallPrimitive* primitives, int& count)
+{
+  int first = count;
+  int firstDigit = number / 10;
+  DrawDigit(GetDigitCenter(center, size, 0), firstDigit, size, primitives, count);
+  ClipBounds(primitives, first, count, 0.0f, center.x + EXTRA_RADIUS, 0.0f, SCREEN_MAX);
+
+  first = count;
+  int secondDigit = number % 10;
+  DrawDigit(GetDigitCenter(center, size, 1), secondDigit, size, primitives, count);
+  ClipBounds(primitives, first, count, center.x - EXTRA_RADIUS, SCREEN_MAX, 0.0f, SCREEN_MAX);
+  return first;
+}
+
+const float NUMBER_SIZE = 42.0f;
+
+const float COLON_RADIUS = 6.0f;
+const float COLON_OFFSET = 9.0f;
+
+const float HORIZONTAL_CENTER = 99.0f;
+
+const float SLASH_RADIUS = 6.0f;
+const float SLASH_WIDTH = 10.0f;
+const float SLASH_WIDTH_HALF = SLASH_WIDTH * 0.5f;
+
+const float BATTERY_Y_POS = 99.0f;
+const float BATTERY_RADIUS = 5.0f;
+
+const float TOP_LINE = BATTERY_Y_POS - BATTERY_RADIUS - NUMBER_SIZE - EXTRA_RADIUS + 3.0f;
+const float BOTTOM_LINE = BATTERY_Y_POS + BATTERY_RADIUS + NUMBER_SIZE + EXTRA_RADIUS - 3.0f;
+
+const float LEFT_LINE = HORIZONTAL_CENTER - COLON_RADIUS - NUMBER_SIZE - NUMBER_SEPARATION_HALF - 5.0f;
+const float RIGHT_LINE = HORIZONTAL_CENTER + COLON_RADIUS + NUMBER_SIZE + NUMBER_SEPARATION_HALF + 5.0f;
+
+const Vec2f TOP_LEFT_POINT = Vec2f(LEFT_LINE, TOP_LINE);
+const Vec2f TOP_RIGHT_POINT = Vec2f(RIGHT_LINE, TOP_LINE);
+const Vec2f BOTTOM_LEFT_POINT = Vec2f(LEFT_LINE, BOTTOM_LINE);
+const Vec2f BOTTOM_RIGHT_POINT = Vec2f(RIGHT_LINE, BOTTOM_LINE);
+
+const Vec2f COLON_CENTER = Vec2f(HORIZONTAL_CENTER, TOP_LINE);
+
+const Vec2f SLASH_CENTER = Vec2f(HORIZONTAL_CENTER, BOTTOM_LINE);
+const Vec2f CENTER = Vec2f(100.0f, 100.0f);
+
+#if METABALL_FIXED_POINT
+
+// The integer kernel's copy of the face is built from whole pixels and
+// hundredths of the digit size rather than from the float shapes above, so
+// no float rounding reaches it and every platform draws the same frame.
+// The layout is the one of the float constants, in Q8.
+const int32_t FIXED_EXTRA_RADIUS = 9 * FIXED_ONE;
+const uint32_t FIXED_EXTRA_RADIUS_RECIPROCAL = UINT32_MAX / FIXED_EXTRA_RADIUS;
+const int32_t FIXED_NUMBER_SIZE = 42 * FIXED_ONE;
+const int32_t FIXED_DIGIT_OFFSET = 23 * FIXED_ONE;
+const int32_t FIXED_HORIZONTAL_CENTER = 99 * FIXED_ONE;
+const int32_t FIXED_LEFT_LINE = 44 * FIXED_ONE;
+const int32_t FIXED_RIGHT_LINE = 154 * FIXED_ONE;
+const int32_t FIXED_TOP_LINE = 46 * FIXED_ONE;
+const int32_t FIXED_BOTTOM_LINE = 152 * FIXED_ONE;
+const int32_t FIXED_COLON_RADIUS = 6 * FIXED_ONE;
+const int32_t FIXED_COLON_OFFSET = 9 * FIXED_ONE;
+const int32_t FIXED_SLASH_RADIUS = 6 * FIXED_ONE;
+const int32_t FIXED_SLASH_WIDTH_HALF = 5 * FIXED_ONE;
+const int32_t FIXED_SLASH_HALF_HEIGHT = 36 * FIXED_ONE;
+const int32_t FIXED_BATTERY_Y_POS = 99 * FIXED_ONE;
+const int32_t FIXED_BATTERY_RADIUS = 5 * FIXED_ONE;
+const int32_t FIXED_BATTERY_HALF_LENGTH = 94 * FIXED_ONE;
+
+// Start and end directions of the digit arcs in Q16, the cosine and sine of
+// the angles the Draw functions pass to AddArc(). Every sweep is over 180
+// degrees.
+struct FixedArc
+{
+  int32_t startX;
+  int32_t startY;
+  int32_t endX;
+  int32_t endY;
+};
+
+enum FixedArcIndex : uint8_t
+{
+  ARC_2,
+  ARC_3_TOP,
+  ARC_3_BOTTOM,
+  ARC_5
+};
+
+const FixedArc FIXED_ARCS[] =
+{
+  { -65536, 0, 62328, 20252 },      // 180 to 378 degrees
+  { -32768, -56756, 11380, 64540 }, // 240 to 440 degrees
+  { 11380, -64540, -32768, 56756 }, // 280 to 480 degrees
+  { -37590, -53684, -37590, 53684 } // 235 to 485 degrees
+};
+
+// One shape of a digit in hundredths of the digit size from its center:
+// circle center, capsule start and end or arc center, arc radius and arc.
+struct FixedShape
+{
+  MetaBallPrimitiveType type;
+  int8_t radius;
+  int8_t x;
+  int8_t y;
+  int8_t endX;
+  int8_t endY;
+  int8_t arcRadius;
+  uint8_t arc;
+};
+
+const int FIXED_MAX_DIGIT_SHAPES = 3;
+
+// The shapes of Draw0() to Draw9(), in the order they add them.
+const uint8_t FIXED_DIGIT_SHAPE_COUNTS[10] = { 1, 2, 3, 2, 3, 3, 2, 2, 2, 2 };
+const FixedShape FIXED_DIGIT_SHAPES[10][FIXED_MAX_DIGIT_SHAPES] =
+{
+  { { PRIMITIVE_CAPSULE, 50, 0, 50, 0, -50 } },
+  { { PRIMITIVE_CAPSULE, 20, 30, -80, 30, 80 }, { PRIMITIVE_CAPSULE, 20, 30, -80, -30, -20 } },
+  { { PRIMITIVE_ARC, 20, 0, -50, 0, 0, 30, ARC_2 }, { PRIMITIVE_CAPSULE, 20, 20, -20, -30, 80 }, { PRIMITIVE_CAPSULE, 20, -30, 80, 30, 80 } },
+  { { PRIMITIVE_ARC, 20, -10, -40, 0, 0, 40, ARC_3_TOP }, { PRIMITIVE_ARC, 20, -10, 40, 0, 0, 40, ARC_3_BOTTOM } },
+  { { PRIMITIVE_CAPSULE, 20, 0, -80, -30, 20 }, { PRIMITIVE_CAPSULE, 20, -30, 20, 30, 20 }, { PRIMITIVE_CAPSULE, 20, 30, 0, 10, 80 } },
+  { { PRIMITIVE_CAPSULE, 20, 30, -80, -30, -80 }, { PRIMITIVE_CAPSULE, 20, -30, -80, -30, 0 }, { PRIMITIVE_ARC, 20, -10, 40, 0, 0, 40, ARC_5 } },
+  { { PRIMITIVE_CAPSULE, 20, 30, -80, -15, 14 }, { PRIMITIVE_CIRCLE, 50, 0, 50 } },
+  { { PRIMITIVE_CAPSULE, 20, 30, -80, -30, 80 }, { PRIMITIVE_CAPSULE, 20, 30, -80, -30, -80 } },
+  { { PRIMITIVE_CIRCLE, 40, 0, -60 }, { PRIMITIVE_CAPSULE, 50, 0, 50, 0, 20 } },
+  { { PRIMITIVE_CAPSULE, 20, -30, 80, 15, -14 }, { PRIMITIVE_CIRCLE, 50, 0, -50 } }
+};
+
+// value * hundredths / 100, rounded to nearest.
+static int32_t Hundredths(const int32_t& value, const int& hundredths)
+{
+  int32_t scaled = value * hundredths;
+  return (scaled + (scaled < 0 ? -50 : 50)) / 100;
+}
+
+// Q16 direction times a Q8 length, rounded, in Q8.
+static int32_t ScaleUnit(const int32_t& unit, const int32_t& length)
+{
+  return (int32_t)(((int64_t)unit * length + (UNIT_ONE >> 1)) >> UNIT_SHIFT);
+}
+
+static void SetFixedCircle(MetaBallFixedPrimitive& fixed, const int32_t& x, const int32_t& y, const int32_t& radius)
+{
+  fixed.type = PRIMITIVE_CIRCLE;
+  fixed.over180 = false;
+  fixed.radius = radius;
+  fixed.extraRadius = FIXED_EXTRA_RADIUS;
+  fixed.centerX = x;
+  fixed.centerY = y;
+}
+
+static void SetFixedCapsule(MetaBallFixedPrimitive& fixed, const int32_t& x0, const int32_t& y0, const int32_t& x1, const int32_t& y1, const int32_t& radius)
+{
+  SetFixedCircle(fixed, x0, y0, radius);
+  fixed.type = PRIMITIVE_CAPSULE;
+  fixed.differenceX = x1 - x0;
+  fixed.differenceY = y1 - y0;
+  fixed.sqrMagnitude = (int64_t)fixed.differenceX * fixed.differenceX + (int64_t)fixed.differenceY * fixed.differenceY;
+  fixed.tScale = fixed.sqrMagnitude > 0 ? ((int64_t)1 << 48) / fixed.sqrMagnitude : 0;
+}
+
+static void SetFixedArc(MetaBallFixedPrimitive& fixed, const int32_t& x, const int32_t& y, const FixedArc& arc, const int32_t& arcRadius, const int32_t& radius)
+{
+  SetFixedCircle(fixed, x, y, radius);
+  fixed.type = PRIMITIVE_ARC;
+  fixed.over180 = true;
+
+  // Same perpendiculars as AddArc(): the start one turned left, the end one right.
+  fixed.startPerpendicularX = -arc.startY;
+  fixed.startPerpendicularY = arc.startX;
+  fixed.endPerpendicularX = arc.endY;
+  fixed.endPerpendicularY = -arc.endX;
+
+  fixed.arcRadius = arcRadius;
+  fixed.startPointX = x + ScaleUnit(arc.startX, arcRadius);
+  fixed.startPointY = y + ScaleUnit(arc.startY, arcRadius);
+  fixed.endPointX = x + ScaleUnit(arc.endX, arcRadius);
+  fixed.endPointY = y + ScaleUnit(arc.endY, arcRadius);
+
+  int32_t outterRadius = radius + FIXED_EXTRA_RADIUS + arcRadius;
+  int32_t innerRadius = arcRadius - radius - FIXED_EXTRA_RADIUS;
+  fixed.outterRadiusSqr = (int64_t)outterRadius * outterRadius;
+  fixed.innerRadiusSqr = innerRadius > 0 ? (int64_t)innerRadius * innerRadius : -1;
+}
+
+static void SetFixedDigit(MetaBallPrimitive* primitives, int& count, const int32_t& x, const int32_t& y, const int& digit)
+{
+  for (int i = 0; i < FIXED_DIGIT_SHAPE_COUNTS[digit]; ++i)
+  {
+    const FixedShape& shape = FIXED_DIGIT_SHAPES[digit][i];
+    MetaBallFixedPrimitive& fixed = primitives[count++].fixed;
+    int32_t shapeX = x + Hundredths(FIXED_NUMBER_SIZE, shape.x);
+    int32_t shapeY = y + Hundredths(FIXED_NUMBER_SIZE, shape.y);
+    int32_t radius = Hundredths(FIXED_NUMBER_SIZE, shape.radius);
+
+    switch (shape.type)
+    {
+    case PRIMITIVE_CIRCLE:
+      SetFixedCircle(fixed, shapeX, shapeY, radius);
+      break;
+
+    case PRIMITIVE_CAPSULE:
+      SetFixedCapsule(fixed, shapeX, shapeY, x + Hundredths(FIXED_NUMBER_SIZE, shape.endX), y + Hundredths(FIXED_NUMBER_SIZE, shape.endY), radius);
+      break;
+
+    case PRIMITIVE_ARC:
+      SetFixedArc(fixed, shapeX, shapeY, FIXED_ARCS[shape.arc], Hundredths(FIXED_NUMBER_SIZE, shape.arcRadius), radius);
+      break;
+    }
+  }
+}
+
+// Fixed copies of the shapes setGlyph() adds for a glyph centered on (x, y).
+static void SetFixedGlyph(MetaBallPrimitive* primitives, int& count, const int& glyph, const int32_t& x, const int32_t& y)
+{
+  if (glyph == GLYPH_COLON)
+  {
+    SetFixedCircle(primitives[count++].fixed, x, y - FIXED_COLON_OFFSET, FIXED_COLON_RADIUS);
+    SetFixedCircle(primitives[count++].fixed, x, y + FIXED_COLON_OFFSET, FIXED_COLON_RADIUS);
+  }
+  else if (glyph == GLYPH_SLASH)
+  {
+    SetFixedCapsule(primitives[count++].fixed, x + FIXED_SLASH_WIDTH_HALF, y - FIXED_SLASH_HALF_HEIGHT,
+      x - FIXED_SLASH_WIDTH_HALF, y + FIXED_SLASH_HALF_HEIGHT, FIXED_SLASH_RADIUS);
+  }
+  else
+    SetFixedDigit(primitives, count, x, y, glyph);
+}
+
+static void SetFixedNumber(MetaBallPrimitive* primitives, int& count, const int32_t& x, const int32_t& y, const int& number)
+{
+  SetFixedGlyph(primitives, count, number / 10, x - FIXED_DIGIT_OFFSET, y);
+  SetFixedGlyph(primitives, count, number % 10, x + FIXED_DIGIT_OFFSET, y);
+}
+
+// Fixed copies of the shapes setFace() adds, in the same order.
+static void SetFixedFace(MetaBallPrimitive* primitives, const MetaBallFace& face)
+{
+  int count = 0;
+  SetFixedNumber(primitives, count, FIXED_LEFT_LINE, FIXED_TOP_LINE, face.hour);
+  SetFixedNumber(primitives, count, FIXED_RIGHT_LINE, FIXED_TOP_LINE, face.minute);
+  SetFixedGlyph(primitives, count, GLYPH_COLON, FIXED_HORIZONTAL_CENTER, FIXED_TOP_LINE);
+  SetFixedNumber(primitives, count, FIXED_LEFT_LINE, FIXED_BOTTOM_LINE, face.month);
+  SetFixedNumber(primitives, count, FIXED_RIGHT_LINE, FIXED_BOTTOM_LINE, face.day);
+  SetFixedGlyph(primitives, count, GLYPH_SLASH, FIXED_HORIZONTAL_CENTER, FIXED_BOTTOM_LINE);
+
+  // The battery fill is the one float input; a single rounded product
+  // turns it into Q8 the same way everywhere.
+  int32_t batteryHalfSize = (int32_t)lroundf(face.battery * FIXED_BATTERY_HALF_LENGTH);
+  SetFixedCapsule(primitives[count++].fixed, FIXED_HORIZONTAL_CENTER - batteryHalfSize, FIXED_BATTERY_Y_POS,
+    FIXED_HORIZONTAL_CENTER + batteryHalfSize, FIXED_BATTERY_Y_POS, FIXED_BATTERY_RADIUS);
+}
+
+#endif
+
+// Pixels primitives [first, last) can influence.
+static MetaBallRect GetBounds(const MetaBallPrimitive* primitives, int first, int last)
+{
+  MetaBallRect rect = { MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT, -1, -1 };
+
+  for (int i = first; i < last; ++i)
+  {
+    rect.x0 = min(rect.x0, (int16_t)max((int)ceilf(primitives[i].minX), 0));
+    rect.y0 = min(rect.y0, (int16_t)max((int)ceilf(primitives[i].minY), 0));
+    rect.x1 = max(rect.x1, (int16_t)min((int)floorf(primitives[i].maxX), MetaBallRenderer::WIDTH - 1));
+    rect.y1 = max(rect.y1, (int16_t)min((int)floorf(primitives[i].maxY), MetaBallRenderer::HEIGHT - 1));
+  }
+
+  return rect;
+}
+
+static MetaBallRect GetUnion(const MetaBallRect& a, const MetaBallRect& b)
+{
+  if (a.x0 > a.x1 || a.y0 > a.y1)
+    return b;
+
+  if (b.x0 > b.x1 || b.y0 > b.y1)
+    return a;
+
+  MetaBallRect rect = { min(a.x0, b.x0), min(a.y0, b.y0), max(a.x1, b.x1), max(a.y1, b.y1) };
+  return rect;
+}
+
+static void DrawColon(const Vec2f& center, MetaBallPrimitive* primitives, int& count)
+{
+  AddCircle(center + Vec2f(0.0f, -COLON_OFFSET), COLON_RADIUS, primitives, count);
+  AddCircle(center + Vec2f(0.0f, COLON_OFFSET), COLON_RADIUS, primitives, count);
+}
+
+static void DrawSlash(const Vec2f& center, MetaBallPrimitive* primitives, int& count)
+{
+  const float halfHeight = NUMBER_SIZE - SLASH_RADIUS;
+  AddSegment(center + Vec2f(SLASH_WIDTH_HALF, -halfHeight), center + Vec2f(-SLASH_WIDTH_HALF, halfHeight), SLASH_RADIUS, primitives, count);
+}
+
+static void SetGlyph(MetaBallGlyphInstance& instance, const int& glyph, const Vec2f& center, const MetaBallRect& bounds)
+{
+  instance.glyph = glyph;
+  instance.x = (int16_t)lroundf(center.x) - MetaBallRenderer::GLYPH_CENTER_X;
+  instance.y = (int16_t)lroundf(center.y) - MetaBallRenderer::GLYPH_CENTER_Y;
+  instance.bounds = bounds;
+}
+
+#if METABALL_DIGIT_TILES
+
+static void SetTile(MetaBallPrimitive* primitives, int first, int last, uint8_t tile)
+{
+  for (int i = first; i < last; ++i)
+    primitives[i].tile = tile;
+}
+
+#endif
+
+// Places both digits of a number drawn into [first, last) in glyph slots
+// slot and slot + 1, once their shapes are clipped.
+static void SetNumberGlyphs(MetaBallPrimitive* primitives, int first, int ones, int last, const Vec2f& center, const int& number,
+  MetaBallGlyphInstance* glyphs, int slot)
+{
+  SetGlyph(glyphs[slot], number / 10, GetDigitCenter(center, NUMBER_SIZE, 0), GetBounds(primitives, first, ones));
+  SetGlyph(glyphs[slot + 1], number % 10, GetDigitCenter(center, NUMBER_SIZE, 1), GetBounds(primitives, ones, last));
+
+#if METABALL_DIGIT_TILES
+  SetTile(primitives, first, ones, slot + 1);
+  SetTile(primitives, ones, last, slot + 2);
+#endif
+}
+
+void MetaBallRenderer::setFace(const MetaBallFace& face)
+{
+  primitiveCount = 0;
+
+  // Same order the shapes were always blended in; Blend() depends on it
+  // unless METABALL_ASSOCIATIVE_BLEND is set.
+  // Each slot is also clipped to the region it was always evaluated in, as
+  // shapes that barely touch a pixel still change how the others blend.
+  const float topBottom = TOP_LINE + NUMBER_SIZE + EXTRA_RADIUS;
+  const float bottomTop = BOTTOM_LINE - NUMBER_SIZE - EXTRA_RADIUS;
+  const float leftNumberRight = Below(LEFT_LINE + NUMBER_SIZE + NUMBER_SEPARATION_HALF + EXTRA_RADIUS);
+  const float rightNumberLeft = Above(RIGHT_LINE - NUMBER_SIZE - NUMBER_SEPARATION_HALF - EXTRA_RADIUS);
+
+  int first = primitiveCount;
+  int ones = DrawNumber(TOP_LEFT_POINT, face.hour, NUMBER_SIZE, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, 0.0f, leftNumberRight, 0.0f, topBottom);
+  layerBounds[LAYER_HOUR_TENS] = GetBounds(primitives, first, ones);
+  layerBounds[LAYER_HOUR_ONES] = GetBounds(primitives, ones, primitiveCount);
+  SetNumberGlyphs(primitives, first, ones, primitiveCount, TOP_LEFT_POINT, face.hour, glyphs, 0);
+
+  first = primitiveCount;
+  ones = DrawNumber(TOP_RIGHT_POINT, face.minute, NUMBER_SIZE, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, rightNumberLeft, SCREEN_MAX, 0.0f, topBottom);
+  layerBounds[LAYER_MINUTE_TENS] = GetBounds(primitives, first, ones);
+  layerBounds[LAYER_MINUTE_ONES] = GetBounds(primitives, ones, primitiveCount);
+  SetNumberGlyphs(primitives, first, ones, primitiveCount, TOP_RIGHT_POINT, face.minute, glyphs, 2);
+
+  first = primitiveCount;
+  DrawColon(COLON_CENTER, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, 0.0f, SCREEN_MAX, 0.0f, topBottom);
+  MetaBallRect colonBounds = GetBounds(primitives, first, primitiveCount);
+  SetGlyph(glyphs[8], GLYPH_COLON, COLON_CENTER, colonBounds);
+#if METABALL_DIGIT_TILES
+  SetTile(primitives, first, primitiveCount, 0);
+#endif
+
+  first = primitiveCount;
+  ones = DrawNumber(BOTTOM_LEFT_POINT, face.month, NUMBER_SIZE, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, 0.0f, leftNumberRight, bottomTop, SCREEN_MAX);
+  layerBounds[LAYER_MONTH_TENS] = GetBounds(primitives, first, ones);
+  layerBounds[LAYER_MONTH_ONES] = GetBounds(primitives, ones, primitiveCount);
+  SetNumberGlyphs(primitives, first, ones, primitiveCount, BOTTOM_LEFT_POINT, face.month, glyphs, 4);
+
+  first = primitiveCount;
+  ones = DrawNumber(BOTTOM_RIGHT_POINT, face.day, NUMBER_SIZE, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, rightNumberLeft, SCREEN_MAX, bottomTop, SCREEN_MAX);
+  layerBounds[LAYER_DAY_TENS] = GetBounds(primitives, first, ones);
+  layerBounds[LAYER_DAY_ONES] = GetBounds(primitives, ones, primitiveCount);
+  SetNumberGlyphs(primitives, first, ones, primitiveCount, BOTTOM_RIGHT_POINT, face.day, glyphs, 6);
+
+  first = primitiveCount;
+  DrawSlash(SLASH_CENTER, primitives, primitiveCount);
+  ClipBounds(primitives, first, primitiveCount, Above(HORIZONTAL_CENTER - SLASH_WIDTH_HALF - SLASH_RADIUS - EXTRA_RADIUS),
+    Below(HORIZONTAL_CENTER + SLASH_WIDTH_HALF + SLASH_RADIUS + EXTRA_RADIUS), bottomTop, SCREEN_MAX);
+  MetaBallRect slashBounds = GetBounds(primitives, first, primitiveCount);
+  SetGlyph(glyphs[9], GLYPH_SLASH, SLASH_CENTER, slashBounds);
+  layerBounds[LAYER_STATIC] = GetUnion(colonBounds, slashBounds);
+#if METABALL_DIGIT_TILES
+  SetTile(primitives, first, primitiveCount, 0);
+#endif
+
+  first = primitiveCount;
+  const float batteryHalfSize = (100.0f - BATTERY_RADIUS - 1.0f) * face.battery;
+  const Vec2f batteryPointLeft (HORIZONTAL_CENTER - batteryHalfSize, BATTERY_Y_POS);
+  const Vec2f batteryPointRight (HORIZONTAL_CENTER + batteryHalfSize, BATTERY_Y_POS);
+  AddSegment(batteryPointLeft, batteryPointRight, BATTERY_RADIUS, primitives, primitiveCount);
+  layerBounds[LAYER_BATTERY] = GetBounds(primitives, first, primitiveCount);
+#if METABALL_DIGIT_TILES
+  SetTile(primitives, first, primitiveCount, 0);
+#endif
+
+#if METABALL_FIXED_POINT
+  SetFixedFace(primitives, face);
+#endif
+
+  // Order in which primitives enter the scanline active list.
+  for (int i = 0; i < primitiveCount; ++i)
+  {
+    int j = i;
+
+    for (; j > 0 && primitives[rowOrder[j - 1]].minY > primitives[i].minY; --j)
+      rowOrder[j] = rowOrder[j - 1];
+
+    rowOrder[j] = i;
+  }
+}
+
+void MetaBallRenderer::setGlyph(int glyph, float x, float y)
+{
+  primitiveCount = 0;
+
+  if (glyph == GLYPH_COLON)
+    DrawColon(Vec2f(x, y), primitives, primitiveCount);
+  else if (glyph == GLYPH_SLASH)
+    DrawSlash(Vec2f(x, y), primitives, primitiveCount);
+  else
+    DrawDigit(Vec2f(x, y), glyph, NUMBER_SIZE, primitives, primitiveCount);
+
+#if METABALL_FIXED_POINT
+  int fixedCount = 0;
+  SetFixedGlyph(primitives, fixedCount, glyph, ToFixed(x), ToFixed(y));
+#endif
+
+  for (int i = 0; i < primitiveCount; ++i)
+  {
+#if METABALL_DIGIT_TILES
+    primitives[i].tile = 0;
+#endif
+    rowOrder[i] = i;
+  }
+}
+
+int MetaBallRenderer::render(const MetaBallFace& face, uint8_t* frame)
+{
+  setFace(face);
+#if METABALL_PARALLEL
+  return renderParallel(frame);
+#else
+  return renderRows(frame, 0, HEIGHT);
+#endif
+}
+
+int MetaBallRenderer::renderRows(uint8_t* rows, int yStart, int yEnd) const
+{
+  for (int y = yStart; y < yEnd; ++y)
+    memset(rows + (y - yStart) * ROW_BYTES, 0xFF, ROW_BYTES);
+
+#if METABALL_SDF_ATLAS
+  if (atlas.data)
+    return renderAtlas(rows, yStart, yEnd, 0, WIDTH, atlas);
+#endif
+
+  switch (traversal)
+  {
+  case TRAVERSAL_PIXELS:
+    return renderPixels(rows, yStart, yEnd);
+
+  case TRAVERSAL_QUADTREE:
+    return renderQuadtree(rows, yStart, yEnd);
+
+  case TRAVERSAL_SCANLINE:
+  default:
+    return renderScanlines(rows, yStart, yEnd, 0, WIDTH);
+  }
+}
+
+int MetaBallRenderer::renderBands(MetaBallBandTransfer& transfer, uint8_t* buffers, int bandRows) const
+{
+  uint8_t* bands[2] = { buffers, buffers + bandRows * ROW_BYTES };
+  int evaluated = 0;
+
+  for (int yStart = 0, band = 0; yStart < HEIGHT; yStart += bandRows, ++band)
+  {
+    int yEnd = min(yStart + bandRows, (int)HEIGHT);
+    uint8_t* rows = bands[band & 1];
+
+    // This half was last sent two bands ago, and the wait before the
+    // previous send() made sure that transfer is over.
+    evaluated += renderRows(rows, yStart, yEnd);
+
+    transfer.wait();
+    transfer.send(rows, yStart, yEnd - yStart);
+  }
+
+  transfer.wait();
+  return evaluated;
+}
+
+// Sets pixels [x0, x1] of a row to white.
+static void SetWhite(uint8_t* row, const int& x0, const int& x1)
+{
+  int first = x0 >> 3;
+  int last = x1 >> 3;
+  uint8_t firstMask = 0xFF >> (x0 & 7);
+  uint8_t lastMask = 0xFF << (7 - (x1 & 7));
+
+  if (first == last)
+  {
+    row[first] |= firstMask & lastMask;
+    return;
+  }
+
+  row[first] |= firstMask;
+  memset(row + first + 1, 0xFF, last - first - 1);
+  row[last] |= lastMask;
+}
+
+int MetaBallRenderer::renderRect(uint8_t* frame, const MetaBallRect& rect) const
+{
+  if (rect.x0 > rect.x1 || rect.y0 > rect.y1)
+    return 0;
+
+  uint8_t* rows = frame + rect.y0 * ROW_BYTES;
+
+  for (int y = rect.y0; y <= rect.y1; ++y)
+    SetWhite(rows + (y - rect.y0) * ROW_BYTES, rect.x0, rect.x1);
+
+#if METABALL_SDF_ATLAS
+  if (atlas.data)
+    return renderAtlas(rows, rect.y0, rect.y1 + 1, rect.x0, rect.x1 + 1, atlas);
+#endif
+
+  return renderScanlines(rows, rect.y0, rect.y1 + 1, rect.x0, rect.x1 + 1);
+}
+
+// True if the digit or battery a layer shows differs between two faces.
+static bool LayerChanged(const int& layer, const MetaBallFace& a, const MetaBallFace& b)
+{
+  switch (layer)
+  {
+  case LAYER_HOUR_TENS: return a.hour / 10 != b.hour / 10;
+  case LAYER_HOUR_ONES: return a.hour % 10 != b.hour % 10;
+  case LAYER_MINUTE_TENS: return a.minute / 10 != b.minute / 10;
+  case LAYER_MINUTE_ONES: return a.minute % 10 != b.minute % 10;
+  case LAYER_MONTH_TENS: return a.month / 10 != b.month / 10;
+  case LAYER_MONTH_ONES: return a.month % 10 != b.month % 10;
+  case LAYER_DAY_TENS: return a.day / 10 != b.day / 10;
+  case LAYER_DAY_ONES: return a.day % 10 != b.day % 10;
+  case LAYER_BATTERY: return a.battery != b.battery;
+  }
+
+  return false;
+}
+
+static int GetArea(const MetaBallRect& rect)
+{
+  return (rect.x1 - rect.x0 + 1) * (rect.y1 - rect.y0 + 1);
+}
+
+static bool Overlaps(const MetaBallRect& a, const MetaBallRect& b)
+{
+  return a.x0 <= b.x1 && b.x0 <= a.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+}
+
+// Adds a window widened to whole bytes. It is merged with a window it
+// overlaps unless their union covers more than both do apart, like the
+// battery line crossing a digit; drawing the overlap twice is cheaper.
+static void AddWindow(MetaBallRect rect, MetaBallRect* windows, int& count)
+{
+  if (rect.x0 > rect.x1 || rect.y0 > rect.y1)
+    return;
+
+  rect.x0 &= ~7;
+  rect.x1 |= 7;
+
+  for (int i = 0; i < count; ++i)
+  {
+    if (!Overlaps(rect, windows[i]))
+      continue;
+
+    MetaBallRect merged = GetUnion(rect, windows[i]);
+
+    if (GetArea(merged) > GetArea(rect) + GetArea(windows[i]))
+      continue;
+
+    // The merged window may now reach others, so it is added again.
+    rect = merged;
+    windows[i] = windows[--count];
+    AddWindow(rect, windows, count);
+    return;
+  }
+
+  windows[count++] = rect;
+}
+
+int MetaBallRenderer::renderLayers(const MetaBallFace& face, uint8_t* frame, MetaBallLayerCache& cache)
+{
+  setFace(face);
+
+  int evaluated = 0;
+  dirtyWindowCount = 0;
+
+  if (!cache.valid)
+  {
+    evaluated = renderRows(frame, 0, HEIGHT);
+    MetaBallRect screen = { 0, 0, WIDTH - 1, HEIGHT - 1 };
+    dirtyWindows[dirtyWindowCount++] = screen;
+  }
+  else
+  {
+    for (int layer = 0; layer < LAYER_COUNT; ++layer)
+    {
+      if (LayerChanged(layer, face, cache.face))
+        AddWindow(GetUnion(cache.bounds[layer], layerBounds[layer]), dirtyWindows, dirtyWindowCount);
+    }
+
+    for (int i = 0; i < dirtyWindowCount; ++i)
+      evaluated += renderRect(frame, dirtyWindows[i]);
+  }
+
+  cache.valid = true;
+  cache.face = face;
+  memcpy(cache.bounds, layerBounds, sizeof(layerBounds));
+  return evaluated;
+}
+
+// Pixels a primitive can touch on one row, both ends inclusive.
+struct RowSpan
+{
+  int16_t x0;
+  int16_t x1;
+};
+
+// Widens a closed-form interval by a pixel on each side so rounding never
+// drops a pixel MetaBall() would still accept, then clips it to the primitive
+// box and the screen.
+static bool ClipRowSpan(const MetaBallPrimitive& primitive, float left, float right, RowSpan& span)
+{
+  int x0 = max((int)floorf(left) - 1, (int)ceilf(primitive.minX));
+  int x1 = min((int)ceilf(right) + 1, (int)floorf(primitive.maxX));
+  x0 = max(x0, 0);
+  x1 = min(x1, MetaBallRenderer::WIDTH - 1);
+
+  if (x0 > x1)
+    return false;
+
+  span.x0 = x0;
+  span.x1 = x1;
+  return true;
+}
+
+// Intersects a row with a circle, returning false when they do not meet.
+static bool CircleRowInterval(const Vec2f& center, const float& radius, const float& y, float& left, float& right)
+{
+  float dy = y - center.y;
+  float remaining = radius * radius - dy * dy;
+
+  if (remaining <= 0.0f)
+    return false;
+
+  float halfWidth = sqrtf(remaining);
+  left = fminf(left, center.x - halfWidth);
+  right = fmaxf(right, center.x + halfWidth);
+  return true;
+}
+
+// Intersects a row with the straight side of a capsule, s + t * difference for t in [0, 1].
+static void SideRowInterval(const Vec2f& s, const Vec2f& difference, const float& y, float& left, float& right)
+{
+  if (difference.y == 0.0f)
+    return;
+
+  float t = (y - s.y) / difference.y;
+
+  if (t < 0.0f || t > 1.0f)
+    return;
+
+  float x = s.x + difference.x * t;
+  left = fminf(left, x);
+  right = fmaxf(right, x);
+}
+
+// Closed-form x-interval of a row inside a primitive's influence radius, or
+// inside that radius less inset.
+static bool GetRowSpan(const MetaBallPrimitive& primitive, int y, RowSpan& span, const float& inset = 0.0f)
+{
+  float rowY = (float)y;
+  float left = INFINITY;
+  float right = -INFINITY;
+  float reach = primitive.influenceRadius - inset;
+
+  switch (primitive.type)
+  {
+  case PRIMITIVE_CIRCLE:
+  case PRIMITIVE_ARC:
+    // Arcs use their whole outer circle; MetaBall() rejects the rest.
+    CircleRowInterval(primitive.center, reach, rowY, left, right);
+    break;
+
+  case PRIMITIVE_CAPSULE:
+  {
+    // A capsule is convex: the row crosses its outline on the end caps or on
+    // the two sides, and the hull of those crossings is the whole interval.
+    Vec2f offset = primitive.influenceOffset * (reach / primitive.influenceRadius);
+    CircleRowInterval(primitive.center, reach, rowY, left, right);
+    CircleRowInterval(primitive.center + primitive.difference, reach, rowY, left, right);
+    SideRowInterval(primitive.center + offset, primitive.difference, rowY, left, right);
+    SideRowInterval(primitive.center - offset, primitive.difference, rowY, left, right);
+    break;
+  }
+  }
+
+  if (left > right)
+    return false;
+
+  return ClipRowSpan(primitive, left, right, span);
+}
+
+#if METABALL_FIXED_POINT
+
+typedef MetaBallFixedPixel PixelBlend;
+
+static void BeginPixel(PixelBlend& pixel, const int& x, const int& y)
+{
+  MetaBallFixedBegin(pixel, x, y, FIXED_EXTRA_RADIUS, FIXED_EXTRA_RADIUS_RECIPROCAL);
+}
+
+static void EvaluatePixel(PixelBlend& pixel, const MetaBallPrimitive& primitive)
+{
+  MetaBallFixedEvaluate(pixel, primitive.fixed);
+}
+
+static MetaBallShade ClassifyPixel(const PixelBlend& pixel, int16_t& u, int16_t& v)
+{
+  return MetaBallFixedShade(pixel, u, v);
+}
+
+#else
+
+static void BeginPixel(PixelBlend& pixel, const int& x, const int& y)
+{
+  pixel.currentPos = Vec2f((float)x, (float)y);
+  pixel.count = 0;
+  pixel.totalDistance = 0.0f;
+#if METABALL_ASSOCIATIVE_BLEND
+  pixel.totalWeight = 0.0f;
+  pixel.weightedCenter = Vec2f(0.0f, 0.0f);
+#else
+  pixel.prevRadius = 0.0f;
+  pixel.center = pixel.currentPos;
+#endif
+}
+
+static void EvaluatePixel(PixelBlend& pixel, const MetaBallPrimitive& primitive)
+{
+  Evaluate(pixel, primitive, EXTRA_RADIUS);
+}
+
+static MetaBallShade ClassifyPixel(const PixelBlend& pixel, int16_t& u, int16_t& v)
+{
+  if (pixel.count == 0)
+    return SHADE_BACKGROUND;
+
+  if (pixel.totalDistance > EXTRA_RADIUS)
+  {
+#if METABALL_ASSOCIATIVE_BLEND
+    // Radius of the sphere around the weighted center that passes through
+    // the blended surface point, as the ordered blend keeps in prevRadius.
+    Vec2f center = pixel.weightedCenter * (1.0f / pixel.totalWeight);
+    Vec2f offset = pixel.currentPos - center;
+    float height = pixel.totalDistance - EXTRA_RADIUS;
+    Vec2f normal = offset * (100.0f / sqrtf(offset.lengthSquared() + height * height));
+#else
+    Vec2f normal = (pixel.currentPos - pixel.center);
+    normal *= 100.0f / pixel.prevRadius;
+#endif
+    normal += CENTER;
+    // The edge of the surface can land a pixel outside the matcap.
+    u = (int16_t)clamp(normal.x, 0.0f, SCREEN_MAX);
+    v = (int16_t)clamp(normal.y, 0.0f, SCREEN_MAX);
+    return SHADE_SURFACE;
+  }
+
+  if (pixel.totalDistance >= EXTRA_RADIUS - 1.0f)
+    return SHADE_OUTLINE;
+
+  return SHADE_BACKGROUND;
+}
+
+#endif
+
+static void SetBlack(uint8_t* row, const int& x)
+{
+  row[x >> 3] &= ~(0x80 >> (x & 7));
+}
+
+static void WriteShade(uint8_t* row, const int& x, const int& y, const MetaBallShade& shade, const int16_t& u, const int16_t& v)
+{
+  if (shade == SHADE_OUTLINE || (shade == SHADE_SURFACE && !getColor3(x, y, u, v)))
+  {
+    METABALL_TRACE_READ(TRACE_FRAME, y * MetaBallRenderer::ROW_BYTES + (x >> 3), 1);
+    SetBlack(row, x);
+  }
+}
+
+// Writes a blended pixel into a row that was cleared to white.
+static void WritePixel(uint8_t* row, const int& x, const int& y, const PixelBlend& pixel)
+{
+  int16_t u = 0;
+  int16_t v = 0;
+  MetaBallShade shade = ClassifyPixel(pixel, u, v);
+  WriteShade(row, x, y, shade, u, v);
+}
+
+// Shading of one row, collected while its pixels are classified and then
+// thresholded against the blue noise many pixels at a time by WriteShadeRow().
+// Bytes follow the row layout: bit 7 of byte i is pixel 8 * i.
+struct ShadeRow
+{
+  uint8_t matcap[MetaBallRenderer::WIDTH];
+  uint8_t outline[MetaBallRenderer::ROW_BYTES];
+  uint8_t surface[MetaBallRenderer::ROW_BYTES];
+};
+
+static void BeginShadeRow(ShadeRow& shades)
+{
+  memset(&shades, 0, sizeof(shades));
+}
+
+#if UINTPTR_MAX > 0xFFFFFFFFu
+
+// Each byte of a vector that is 0xFF where a > b, 32 pixels per compare.
+typedef uint8_t ShadeVector __attribute__((vector_size(32)));
+
+const int SHADE_VECTOR_BYTES = sizeof(ShadeVector) / 8;
+
+// Bit i (MSB first) set where a[i] > b[i], for eight bytes that are each
+// 0xFF or 0: the top bits are moved next to each other by one multiply.
+static uint8_t PackMask(const uint8_t* mask)
+{
+  uint64_t word;
+  memcpy(&word, mask, sizeof(word));
+  return (uint8_t)((((word >> 7) & 0x0101010101010101ull) * 0x8040201008040201ull) >> 56);
+}
+
+#endif
+
+// Bit i (MSB first) set where a[i] > b[i], eight bytes at once in two 32 bit
+// words. A byte's low seven bits are compared with the high bit borrowed so
+// nothing carries into the next byte, then the high bits decide.
+METABALL_IRAM static uint8_t GreaterMask(const uint8_t* a, const uint8_t* b)
+{
+  const uint32_t HIGH = 0x80808080u;
+  uint8_t result = 0;
+
+  for (int half = 0; half < 2; ++half)
+  {
+    uint32_t x;
+    uint32_t y;
+    memcpy(&x, a + half * 4, sizeof(x));
+    memcpy(&y, b + half * 4, sizeof(y));
+
+    uint32_t lowGreaterOrEqual = ((y | HIGH) - (x & ~HIGH)) & HIGH;
+    uint32_t greaterOrEqual = ((y & ~x) | (~(x ^ y) & lowGreaterOrEqual)) & HIGH;
+    uint32_t greater = ~greaterOrEqual & HIGH;
+
+    // Little endian: byte 0 is the first pixel and goes to the top bit.
+    result |= (uint8_t)((((greater >> 7) * 0x08040201u) >> 24) & 0x0F) << (4 - half * 4);
+  }
+
+  return result;
+}
+
+// Writes the shaded bytes [first, last] of a row: outline pixels black,
+// surface pixels white where their matcap value beats the noise, every
+// other pixel as it was. The noise of each byte's eight pixels is contiguous
+// in either table layout and in a mask.
+METABALL_IRAM static void WriteShadeRow(const ShadeRow& shades, uint8_t* row, const int& y, const int& first, const int& last)
+{
+  for (int i = first; i <= last; )
+  {
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    if (i + SHADE_VECTOR_BYTES <= last + 1)
+    {
+      ShadeVector matcap;
+      ShadeVector threshold;
+      memcpy(&matcap, &shades.matcap[i * 8], sizeof(matcap));
+
+      for (int j = 0; j < SHADE_VECTOR_BYTES; ++j)
+      {
+        METABALL_TRACE_READ(TRACE_NOISE, MetaBallNoiseByte(MetaBallNoiseIndex((i + j) * 8, y)), 8 / METABALL_NOISE_TEXELS_PER_BYTE);
+        MetaBallReadNoiseByte((i + j) * 8, y, (uint8_t*)&threshold + j * 8);
+      }
+
+      ShadeVector greater = (ShadeVector)(matcap > threshold);
+
+      for (int j = 0; j < SHADE_VECTOR_BYTES; ++i, ++j)
+      {
+        uint8_t covered = shades.outline[i] | shades.surface[i];
+        METABALL_TRACE_READ(TRACE_FRAME, y * MetaBallRenderer::ROW_BYTES + i, 1);
+        row[i] = (row[i] & ~covered) | (shades.surface[i] & PackMask((const uint8_t*)&greater + j * 8));
+      }
+
+      continue;
+    }
+#endif
+
+    uint8_t covered = shades.outline[i] | shades.surface[i];
+
+    if (covered)
+    {
+      uint8_t noise[8];
+      METABALL_TRACE_READ(TRACE_NOISE, MetaBallNoiseByte(MetaBallNoiseIndex(i * 8, y)), 8 / METABALL_NOISE_TEXELS_PER_BYTE);
+      MetaBallReadNoiseByte(i * 8, y, noise);
+
+      METABALL_TRACE_READ(TRACE_FRAME, y * MetaBallRenderer::ROW_BYTES + i, 1);
+      row[i] = (row[i] & ~covered) | (shades.surface[i] & GreaterMask(&shades.matcap[i * 8], noise));
+    }
+
+    ++i;
+  }
+}
+
+#if METABALL_DEFERRED_SHADING
+
+// G-buffer of the deferred shading pass, METABALL_GBUFFER_ROWS rows of one
+// 16 bit record per pixel:
+//   0                  background, the frame keeps its pixel
+//   1                  outline
+//   2 + index          surface, shaded from matcap texel (u, v) at
+//                      MetaBallTableIndex(u, v), or at (v << 8 | u) with
+//                      METABALL_MATCAP_FIT, which has no table to index
+// u and v are whole pixels of the 200x200 matcap, so a surface record is its
+// table index plus 2 and fits in 16 bits without losing precision.
+// Only each row's covered bytes are cleared and shaded.
+const uint16_t GBUFFER_BACKGROUND = 0;
+const uint16_t GBUFFER_OUTLINE = 1;
+const uint16_t GBUFFER_SURFACE = 2;
+
+struct GBuffer
+{
+  uint16_t records[METABALL_GBUFFER_ROWS][MetaBallRenderer::WIDTH];
+  uint8_t* rows[METABALL_GBUFFER_ROWS];
+  int16_t y[METABALL_GBUFFER_ROWS];
+  int16_t first[METABALL_GBUFFER_ROWS];
+  int16_t last[METABALL_GBUFFER_ROWS];
+  int count;
+};
+
+// Kept out of the stack: 16 KB at the default 40 rows.
+static GBuffer gbuffer;
+
+// Shading pass: looks up the matcap of every covered record and writes the
+// rows the geometry pass filled.
+METABALL_IRAM static void ShadeGBuffer()
+{
+  for (int i = 0; i < gbuffer.count; ++i)
+  {
+    const uint16_t* records = gbuffer.records[i];
+    int xEnd = min((gbuffer.last[i] + 1) * 8, (int)MetaBallRenderer::WIDTH);
+
+    ShadeRow shades;
+    BeginShadeRow(shades);
+
+    for (int x = gbuffer.first[i] * 8; x < xEnd; ++x)
+    {
+      uint16_t record = records[x];
+
+      if (record == GBUFFER_BACKGROUND)
+        continue;
+
+      uint8_t bit = 0x80 >> (x & 7);
+
+      if (record == GBUFFER_OUTLINE)
+      {
+        shades.outline[x >> 3] |= bit;
+      }
+      else
+      {
+        shades.surface[x >> 3] |= bit;
+#if METABALL_MATCAP_FIT
+        uint16_t texel = record - GBUFFER_SURFACE;
+        shades.matcap[x] = ReadMatCap(texel & 0xFF, texel >> 8);
+#else
+        METABALL_TRACE_READ(TRACE_MATCAP, MetaBallTableByte(record - GBUFFER_SURFACE), 1);
+        shades.matcap[x] = MetaBallReadMatCap(record - GBUFFER_SURFACE);
+#endif
+      }
+    }
+
+    WriteShadeRow(shades, gbuffer.rows[i], gbuffer.y[i], gbuffer.first[i], gbuffer.last[i]);
+  }
+
+  gbuffer.count = 0;
+}
+
+// Geometry pass: classified pixels go to the G-buffer, which is shaded when
+// it is full and once more when the traversal ends.
+struct RowShading
+{
+  uint16_t* records;
+};
+
+static void BeginShading(RowShading&)
+{
+  gbuffer.count = 0;
+}
+
+static void BeginShadingRow(RowShading& shading, uint8_t* row, const int& y, const int& first, const int& last)
+{
+  if (gbuffer.count == METABALL_GBUFFER_ROWS)
+    ShadeGBuffer();
+
+  int i = gbuffer.count;
+  gbuffer.rows[i] = row;
+  gbuffer.y[i] = y;
+  gbuffer.first[i] = first;
+  gbuffer.last[i] = last;
+
+  shading.records = gbuffer.records[i];
+  int xEnd = min((last + 1) * 8, (int)MetaBallRenderer::WIDTH);
+  memset(&shading.records[first * 8], 0, (xEnd - first * 8) * sizeof(uint16_t));
+}
+
+static void AddShade(RowShading& shading, const int& x, const MetaBallShade& shade, const int16_t& u, const int16_t& v)
+{
+  if (shade == SHADE_OUTLINE)
+    shading.records[x] = GBUFFER_OUTLINE;
+  else if (shade == SHADE_SURFACE)
+#if METABALL_MATCAP_FIT
+    shading.records[x] = GBUFFER_SURFACE + (v << 8 | u);
+#else
+    shading.records[x] = GBUFFER_SURFACE + MetaBallTableIndex(u, v);
+#endif
+}
+
+static void EndShadingRow(RowShading&)
+{
+  gbuffer.count++;
+}
+
+static void FinishShading(RowShading&)
+{
+  ShadeGBuffer();
+}
+
+#else
+
+static void AddShade(ShadeRow& shades, const int& x, const MetaBallShade& shade, const int16_t& u, const int16_t& v)
+{
+  uint8_t bit = 0x80 >> (x & 7);
+
+  if (shade == SHADE_OUTLINE)
+  {
+    shades.outline[x >> 3] |= bit;
+  }
+  else if (shade == SHADE_SURFACE)
+  {
+    shades.surface[x >> 3] |= bit;
+    shades.matcap[x] = ReadMatCap(u, v);
+  }
+}
+
+// Matcap looked up while the row is classified, thresholded at its end.
+struct RowShading
+{
+  ShadeRow shades;
+  uint8_t* row;
+  int y;
+  int first;
+  int last;
+};
+
+static void BeginShading(RowShading&)
+{
+}
+
+static void BeginShadingRow(RowShading& shading, uint8_t* row, const int& y, const int& first, const int& last)
+{
+  BeginShadeRow(shading.shades);
+  shading.row = row;
+  shading.y = y;
+  shading.first = first;
+  shading.last = last;
+}
+
+static void AddShade(RowShading& shading, const int& x, const MetaBallShade& shade, const int16_t& u, const int16_t& v)
+{
+  AddShade(shading.shades, x, shade, u, v);
+}
+
+static void EndShadingRow(RowShading& shading)
+{
+  WriteShadeRow(shading.shades, shading.row, shading.y, shading.first, shading.last);
+}
+
+static void FinishShading(RowShading&)
+{
+}
+
+#endif
+
+static void AddPixel(RowShading& shading, const int& x, const PixelBlend& pixel)
+{
+  int16_t u = 0;
+  int16_t v = 0;
+  MetaBallShade shade = ClassifyPixel(pixel, u, v);
+  AddShade(shading, x, shade, u, v);
+}
+
+#if METABALL_DIGIT_TILES
+
+// Slot of the only digit whose active spans hold x, 0 if none or several
+// shapes from different slots reach the pixel.
+static int GetPixelTile(const MetaBallPrimitive* primitives, const uint8_t* active, const RowSpan* spans, const int& activeCount, const int& x)
+{
+  int tile = -1;
+
+  for (int i = 0; i < activeCount; ++i)
+  {
+    if (x < spans[i].x0 || x > spans[i].x1)
+      continue;
+
+    int primitiveTile = primitives[active[i]].tile;
+
+    if (primitiveTile == 0 || (tile >= 0 && tile != primitiveTile))
+      return 0;
+
+    tile = primitiveTile;
+  }
+
+  return max(tile, 0);
+}
+
+// Adds a pixel from a digit tile. Returns false if the tile does not cover it.
+static bool WriteTilePixel(RowShading& shading, const int& x, const int& y, const MetaBallGlyphInstance& tile)
+{
+  int tileX = x - tile.x;
+  int tileY = y - tile.y;
+
+  if (tileX < 0 || tileX >= MetaBallRenderer::GLYPH_WIDTH || tileY < 0 || tileY >= MetaBallRenderer::GLYPH_HEIGHT)
+    return false;
+
+  const uint8_t* texel = &DigitTiles[((tile.glyph * MetaBallRenderer::GLYPH_HEIGHT + tileY) * MetaBallRenderer::GLYPH_WIDTH + tileX) * 2];
+  int16_t u = pgm_read_byte(&texel[0]);
+  int16_t v = pgm_read_byte(&texel[1]);
+
+  if (v == DIGIT_TILE_BACKGROUND)
+    return true;
+
+  AddShade(shading, x, v == DIGIT_TILE_OUTLINE ? SHADE_OUTLINE : SHADE_SURFACE, u, v);
+  return true;
+}
+
+#endif
+
+static bool PixelInBounds(const MetaBallPrimitive& primitive, const int& x, const int& y)
+{
+  return x >= primitive.minX && x <= primitive.maxX && y >= primitive.minY && y <= primitive.maxY;
+}
+
+MetaBallShade MetaBallRenderer::classifyPixel(int x, int y, int16_t& u, int16_t& v) const
+{
+  PixelBlend pixel;
+  BeginPixel(pixel, x, y);
+
+  for (int i = 0; i < primitiveCount; ++i)
+  {
+    if (PixelInBounds(primitives[i], x, y))
+      EvaluatePixel(pixel, primitives[i]);
+  }
+
+  return ClassifyPixel(pixel, u, v);
+}
+
+// Distance from p to the surface of one shape, negative inside.
+static float GetPrimitiveDistance(const MetaBallPrimitive& primitive, const Vec2f& p)
+{
+  switch (primitive.type)
+  {
+  case PRIMITIVE_CAPSULE:
+    return (p - ClosestPointOnCapsule(primitive, p)).length() - primitive.radius;
+
+  case PRIMITIVE_ARC:
+    return (p - ClosestPointOnArc(primitive, p)).length() - primitive.radius;
+
+  case PRIMITIVE_CIRCLE:
+  default:
+    return (p - primitive.center).length() - primitive.radius;
+  }
+}
+
+// Farthest from the surface the value of any distance needs to be known.
+const float ATLAS_FAR = 1000.0f;
+
+float MetaBallRenderer::getDistance(int x, int y, float blend) const
+{
+  Vec2f p((float)x, (float)y);
+  float distance = ATLAS_FAR;
+
+  for (int i = 0; i < primitiveCount; ++i)
+  {
+    if (!PixelInBounds(primitives[i], x, y))
+      continue;
+
+    float weight = 0.0f;
+    distance = MetaBallSmoothMin(GetPrimitiveDistance(primitives[i], p), distance, blend, weight);
+  }
+
+  return distance;
+}
+
+#if METABALL_SDF_ATLAS
+
+// Distance past the surface where the outline of a lone shape ends: its blend
+// falls below EXTRA_RADIUS - 1 two thirds of a pixel out.
+const float ATLAS_OUTLINE = 2.0f / 3.0f;
+
+static bool RectHoldsRow(const MetaBallRect& rect, const int& y, const int& xStart, const int& xEnd)
+{
+  return y >= rect.y0 && y <= rect.y1 && rect.x0 < xEnd && rect.x1 >= xStart;
+}
+
+static bool RectHoldsPixel(const MetaBallRect& rect, const int& x)
+{
+  return x >= rect.x0 && x <= rect.x1;
+}
+
+// Distance of one pixel to the glyphs and battery line joined so far, with
+// the gradient and stroke radius carried along the smooth minimum's weights.
+struct AtlasPixel
+{
+  int count;
+  float distance;
+  Vec2f gradient;
+  float radius;
+};
+
+static void AddAtlasDistance(AtlasPixel& pixel, const float& distance, const Vec2f& gradient, const float& radius)
+{
+  if (pixel.count++ == 0)
+  {
+    pixel.distance = distance;
+    pixel.gradient = gradient;
+    pixel.radius = radius;
+    return;
+  }
+
+  float weight = 0.0f;
+  pixel.distance = MetaBallSmoothMin(distance, pixel.distance, ATLAS_BLEND, weight);
+  pixel.gradient = gradient * weight + pixel.gradient * (1.0f - weight);
+  pixel.radius = radius * weight + pixel.radius * (1.0f - weight);
+}
+
+static void AddAtlasGlyph(AtlasPixel& pixel, const MetaBallAtlas& atlas, const MetaBallGlyphInstance& glyph, const int& x, const int& y)
+{
+  if (!RectHoldsPixel(glyph.bounds, x) || y < glyph.bounds.y0 || y > glyph.bounds.y1)
+    return;
+
+  int glyphX = x - glyph.x;
+  int glyphY = y - glyph.y;
+
+  if (glyphX < 0 || glyphX > MetaBallRenderer::GLYPH_WIDTH || glyphY < 0 || glyphY > MetaBallRenderer::GLYPH_HEIGHT)
+    return;
+
+  Vec2f gradient;
+  float distance = MetaBallSampleAtlas(atlas, glyph.glyph, glyphX, glyphY, gradient.x, gradient.y);
+  AddAtlasDistance(pixel, distance, gradient, MetaBallGetGlyphRadius(glyph.glyph));
+}
+
+static void AddAtlasBattery(AtlasPixel& pixel, const MetaBallPrimitive& battery, const int& x, const int& y)
+{
+  Vec2f p((float)x, (float)y);
+  Vec2f offset = p - ClosestPointOnCapsule(battery, p);
+  float length = offset.length();
+  Vec2f gradient = length > 0.0f ? offset * (1.0f / length) : Vec2f(0.0f, 0.0f);
+  AddAtlasDistance(pixel, length - battery.radius, gradient, battery.radius);
+}
+
+static MetaBallShade ClassifyAtlasPixel(const AtlasPixel& pixel, int16_t& u, int16_t& v)
+{
+  if (pixel.count == 0 || pixel.distance > ATLAS_OUTLINE)
+    return SHADE_BACKGROUND;
+
+  if (pixel.distance > 0.0f)
+    return SHADE_OUTLINE;
+
+  // Same matcap lookup as the blend: the offset from the stroke's core over
+  // its radius, which the gradient and distance give back.
+  float length = pixel.gradient.length();
+  Vec2f normal = length > 0.0f ? pixel.gradient * ((1.0f + pixel.distance / pixel.radius) * 100.0f / length) : Vec2f(0.0f, 0.0f);
+  normal += CENTER;
+  u = (int16_t)clamp(normal.x, 0.0f, SCREEN_MAX);
+  v = (int16_t)clamp(normal.y, 0.0f, SCREEN_MAX);
+  return SHADE_SURFACE;
+}
+
+MetaBallShade MetaBallRenderer::classifyAtlasPixel(int x, int y, const MetaBallAtlas& atlas, int16_t& u, int16_t& v) const
+{
+  AtlasPixel pixel;
+  pixel.count = 0;
+
+  for (int i = 0; i < GLYPH_SLOTS; ++i)
+    AddAtlasGlyph(pixel, atlas, glyphs[i], x, y);
+
+  const MetaBallRect& batteryBounds = layerBounds[LAYER_BATTERY];
+
+  if (RectHoldsRow(batteryBounds, y, x, x + 1))
+    AddAtlasBattery(pixel, primitives[primitiveCount - 1], x, y);
+
+  return ClassifyAtlasPixel(pixel, u, v);
+}
+
+METABALL_IRAM int MetaBallRenderer::renderAtlas(uint8_t* rows, int yStart, int yEnd, int xStart, int xEnd, const MetaBallAtlas& atlas) const
+{
+  // The battery line is the last shape setFace() adds; it changes length
+  // every frame, so it is measured rather than stored.
+  const MetaBallPrimitive& battery = primitives[primitiveCount - 1];
+  const MetaBallRect& batteryBounds = layerBounds[LAYER_BATTERY];
+
+  int evaluated = 0;
+
+  RowShading shading;
+  BeginShading(shading);
+
+  for (int y = yStart; y < yEnd; ++y)
+  {
+    uint8_t* row = rows + (y - yStart) * ROW_BYTES;
+
+    const MetaBallGlyphInstance* active[GLYPH_SLOTS];
+    int activeCount = 0;
+
+    for (int i = 0; i < GLYPH_SLOTS; ++i)
+    {
+      if (RectHoldsRow(glyphs[i].bounds, y, xStart, xEnd))
+        active[activeCount++] = &glyphs[i];
+    }
+
+    bool batteryActive = RectHoldsRow(batteryBounds, y, xStart, xEnd);
+
+    if (activeCount == 0 && !batteryActive)
+      continue;
+
+    BeginShadingRow(shading, row, y, xStart >> 3, (xEnd - 1) >> 3);
+
+    for (int x = xStart; x < xEnd; ++x)
+    {
+      AtlasPixel pixel;
+      pixel.count = 0;
+
+      for (int i = 0; i < activeCount; ++i)
+        AddAtlasGlyph(pixel, atlas, *active[i], x, y);
+
+      if (batteryActive && RectHoldsPixel(batteryBounds, x))
+        AddAtlasBattery(pixel, battery, x, y);
+
+      if (pixel.count == 0)
+        continue;
+
+      evaluated++;
+
+      int16_t u = 0;
+      int16_t v = 0;
+      MetaBallShade shade = ClassifyAtlasPixel(pixel, u, v);
+      AddShade(shading, x, shade, u, v);
+    }
+
+    EndShadingRow(shading);
+  }
+
+  FinishShading(shading);
+  return evaluated;
+}
+
+#endif
+
+// Blends every primitive of the ascending indices whose box holds the pixel.
+static void RenderPixel(const MetaBallPrimitive* primitives, const uint8_t* indices, const int& indexCount, const int& x, const int& y, uint8_t* row)
+{
+  PixelBlend pixel;
+  BeginPixel(pixel, x, y);
+
+  for (int i = 0; i < indexCount; ++i)
+  {
+    const MetaBallPrimitive& primitive = primitives[indices[i]];
+
+    if (PixelInBounds(primitive, x, y))
+      EvaluatePixel(pixel, primitive);
+  }
+
+  WritePixel(row, x, y, pixel);
+}
+
+// Fills indices with 0 to count - 1.
+static void SetAllIndices(uint8_t* indices, const int& count)
+{
+  for (int i = 0; i < count; ++i)
+    indices[i] = i;
+}
+
+int MetaBallRenderer::renderPixels(uint8_t* rows, int yStart, int yEnd) const
+{
+  uint8_t indices[MAX_PRIMITIVES];
+  SetAllIndices(indices, primitiveCount);
+
+  for (int y = yStart; y < yEnd; ++y)
+  {
+    uint8_t* row = rows + (y - yStart) * ROW_BYTES;
+
+    for (int x = 0; x < WIDTH; ++x)
+      RenderPixel(primitives, indices, primitiveCount, x, y, row);
+  }
+
+  return (yEnd - yStart) * WIDTH;
+}
+
+const int QUADTREE_TILE_SIZE = 16;
+const int QUADTREE_LEAF_SIZE = 4;
+
+// Conservative test whether a primitive can influence any pixel of the square
+// tile at (x0, y0), or come within its influence radius less inset of one.
+// The tile is treated as the disc around its center that holds all of its
+// pixels, so the distance from that center to the shape minus the disc
+// radius bounds the distance of every pixel from below.
+static bool TileMayBeInfluenced(const MetaBallPrimitive& primitive, const int& x0, const int& y0, const int& size, const float& inset = 0.0f)
+{
+  if (x0 + size - 1 < primitive.minX || x0 > primitive.maxX || y0 + size - 1 < primitive.minY || y0 > primitive.maxY)
+    return false;
+
+  float halfSize = (size - 1) * 0.5f;
+  Vec2f tileCenter (x0 + halfSize, y0 + halfSize);
+  float tileRadius = halfSize * (float)M_SQRT2 + 1.0f;
+  float reach = primitive.influenceRadius - inset;
+
+  switch (primitive.type)
+  {
+  case PRIMITIVE_CIRCLE:
+    return (tileCenter - primitive.center).length() - tileRadius < reach;
+
+  case PRIMITIVE_CAPSULE:
+    return (tileCenter - ClosestPointOnCapsule(primitive, tileCenter)).length() - tileRadius < reach;
+
+  case PRIMITIVE_ARC:
+  {
+    float distance = (tileCenter - primitive.center).length();
+
+    if (distance - tileRadius >= reach)
+      return false;
+
+    return primitive.innerRadiusSqr <= 0.0f || distance + tileRadius > sqrtf(primitive.innerRadiusSqr);
+  }
+  }
+
+  return true;
+}
+
+int MetaBallRenderer::renderTile(uint8_t* rows, int yStart, int yEnd, int x0, int y0, int size, const uint8_t* indices, int indexCount) const
+{
+  if (x0 >= WIDTH || y0 >= yEnd || y0 + size <= yStart)
+    return 0;
+
+  // The primitives of the parent that reach this tile, still ascending.
+  uint8_t tileIndices[MAX_PRIMITIVES];
+  int tileCount = 0;
+
+  for (int i = 0; i < indexCount; ++i)
+  {
+    if (TileMayBeInfluenced(primitives[indices[i]], x0, y0, size))
+      tileIndices[tileCount++] = indices[i];
+  }
+
+  // Nothing reaches the tile, or only the halo of one primitive: it keeps
+  // the white it was cleared to.
+  if (tileCount == 0)
+    return 0;
+
+  if (tileCount == 1 && !TileMayBeInfluenced(primitives[tileIndices[0]], x0, y0, size, HALO_WIDTH))
+    return 0;
+
+  if (size > QUADTREE_LEAF_SIZE)
+  {
+    int half = size / 2;
+    return renderTile(rows, yStart, yEnd, x0, y0, half, tileIndices, tileCount) +
+      renderTile(rows, yStart, yEnd, x0 + half, y0, half, tileIndices, tileCount) +
+      renderTile(rows, yStart, yEnd, x0, y0 + half, half, tileIndices, tileCount) +
+      renderTile(rows, yStart, yEnd, x0 + half, y0 + half, half, tileIndices, tileCount);
+  }
+
+  int evaluated = 0;
+
+  for (int y = max(y0, yStart); y < min(y0 + size, yEnd); ++y)
+  {
+    uint8_t* row = rows + (y - yStart) * ROW_BYTES;
+
+    for (int x = x0; x < min(x0 + size, (int)WIDTH); ++x)
+    {
+      RenderPixel(primitives, tileIndices, tileCount, x, y, row);
+      evaluated++;
+    }
+  }
+
+  return evaluated;
+}
+
+int MetaBallRenderer::renderQuadtree(uint8_t* rows, int yStart, int yEnd) const
+{
+  uint8_t indices[MAX_PRIMITIVES];
+  SetAllIndices(indices, primitiveCount);
+  int evaluated = 0;
+
+  for (int y = yStart; y < yEnd; y += QUADTREE_TILE_SIZE)
+  {
+    for (int x = 0; x < WIDTH; x += QUADTREE_TILE_SIZE)
+      evaluated += renderTile(rows, yStart, yEnd, x, y, QUADTREE_TILE_SIZE, indices, primitiveCount);
+  }
+
+  return evaluated;
+}
+
+#if METABALL_FORWARD_DIFFERENCING
+
+// Forward-differenced distances of a circle or capsule along one row.
+// Along a row the segment parameter t is linear in x and the squared
+// distances to the start point, the end point and the infinite line through
+// the segment are quadratic, so each pixel costs a few additions.
+struct RowEvaluator
+{
+  float t;
+  float tStep;
+
+  // Squared distance to the start point, the end point and the line, with
+  // their first and (constant) second differences.
+  float lengthSqr[3];
+  float step[3];
+  float stepChange[3];
+
+  // Distances in use: 1 for circles and points, 3 for capsules.
+  int quadratics;
+  int resync;
+};
+
+static void SetQuadratic(RowEvaluator& evaluator, int index, const float& value, const float& linear, const float& quadratic)
+{
+  // f(k) = value + linear * k + quadratic * k * k
+  evaluator.lengthSqr[index] = value;
+  evaluator.step[index] = linear + quadratic;
+  evaluator.stepChange[index] = 2.0f * quadratic;
+}
+
+static void ResetRowEvaluator(RowEvaluator& evaluator, const MetaBallPrimitive& primitive, const int& x, const int& y)
+{
+  float ex = x - primitive.center.x;
+  float ey = y - primitive.center.y;
+  SetQuadratic(evaluator, 0, ex * ex + ey * ey, 2.0f * ex, 1.0f);
+
+  evaluator.t = 0.0f;
+  evaluator.tStep = 0.0f;
+  evaluator.quadratics = 1;
+  evaluator.resync = METABALL_RESYNC_INTERVAL;
+
+  if (primitive.type != PRIMITIVE_CAPSULE || primitive.sqrMagnitude <= 0.0f)
+    return;
+
+  const Vec2f& difference = primitive.difference;
+  float invSqrMagnitude = 1.0f / primitive.sqrMagnitude;
+
+  float fx = ex - difference.x;
+  float fy = ey - difference.y;
+  SetQuadratic(evaluator, 1, fx * fx + fy * fy, 2.0f * fx, 1.0f);
+
+  float cross = ex * difference.y - ey * difference.x;
+  SetQuadratic(evaluator, 2, cross * cross * invSqrMagnitude, 2.0f * cross * difference.y * invSqrMagnitude, difference.y * difference.y * invSqrMagnitude);
+
+  evaluator.t = (ex * difference.x + ey * difference.y) * invSqrMagnitude;
+  evaluator.tStep = difference.x * invSqrMagnitude;
+  evaluator.quadratics = 3;
+}
+
+static void StepRowEvaluator(RowEvaluator& evaluator, const MetaBallPrimitive& primitive, const int& nextX, const int& y)
+{
+  if (--evaluator.resync == 0)
+  {
+    ResetRowEvaluator(evaluator, primitive, nextX, y);
+    return;
+  }
+
+  evaluator.t += evaluator.tStep;
+
+  for (int i = 0; i < evaluator.quadratics; ++i)
+  {
+    evaluator.lengthSqr[i] += evaluator.step[i];
+    evaluator.step[i] += evaluator.stepChange[i];
+  }
+}
+
+// Starts an evaluator for a span beginning at spanStart and moves it to x,
+// leaving it exactly as stepping from spanStart would, resyncs included.
+static void SkipRowEvaluator(RowEvaluator& evaluator, const MetaBallPrimitive& primitive, const int& spanStart, const int& x, const int& y)
+{
+  int start = spanStart + (x - spanStart) / METABALL_RESYNC_INTERVAL * METABALL_RESYNC_INTERVAL;
+  ResetRowEvaluator(evaluator, primitive, start, y);
+
+  for (int k = start; k < x; ++k)
+    StepRowEvaluator(evaluator, primitive, k + 1, y);
+}
+
+static void EvaluateRow(PixelBlend& pixel, const MetaBallPrimitive& primitive, const RowEvaluator& evaluator, const float& extraRadius)
+{
+  float lengthSqr;
+  float t = evaluator.t;
+
+  if (primitive.type == PRIMITIVE_CIRCLE || t <= 0.0f)
+  {
+    lengthSqr = evaluator.lengthSqr[0];
+    t = 0.0f;
+  }
+  else if (t >= 1.0f)
+  {
+    lengthSqr = evaluator.lengthSqr[1];
+    t = 1.0f;
+  }
+  else
+    lengthSqr = evaluator.lengthSqr[2];
+
+  float totalRadius = primitive.radius + extraRadius;
+
+  if (lengthSqr >= totalRadius * totalRadius)
+    return;
+
+  // Rounding can push the line distance a hair below zero.
+  lengthSqr = fmaxf(lengthSqr, 0.0f);
+
+  Vec2f closestPoint = primitive.center + primitive.difference * t;
+  Blend(pixel, closestPoint, lengthSqr, primitive.radius, extraRadius);
+}
+
+static bool UsesRowEvaluator(const MetaBallPrimitive& primitive)
+{
+  return primitive.type != PRIMITIVE_ARC;
+}
+
+#endif
+
+// Where two or more of the spans overlap, sorted by start. At most count - 1
+// ranges.
+static int GetOverlapSpans(const RowSpan* spans, const int& count, RowSpan* overlaps)
+{
+  // Each span starts at x0 and ends before x1 + 1, sorted by x.
+  int16_t eventX[2 * MetaBallRenderer::MAX_PRIMITIVES];
+  int8_t eventDelta[2 * MetaBallRenderer::MAX_PRIMITIVES];
+  int eventCount = 0;
+
+  for (int i = 0; i < 2 * count; ++i)
+  {
+    int x = i & 1 ? spans[i >> 1].x1 + 1 : spans[i >> 1].x0;
+    int j = eventCount++;
+
+    for (; j > 0 && eventX[j - 1] > x; --j)
+    {
+      eventX[j] = eventX[j - 1];
+      eventDelta[j] = eventDelta[j - 1];
+    }
+
+    eventX[j] = x;
+    eventDelta[j] = i & 1 ? -1 : 1;
+  }
+
+  int overlapCount = 0;
+  int depth = 0;
+  bool overlapping = false;
+
+  for (int e = 0; e < eventCount; ++e)
+  {
+    depth += eventDelta[e];
+
+    if (e + 1 < eventCount && eventX[e + 1] == eventX[e])
+      continue;
+
+    if (!overlapping && depth >= 2)
+    {
+      overlaps[overlapCount].x0 = eventX[e];
+      overlapping = true;
+    }
+    else if (overlapping && depth < 2)
+    {
+      overlaps[overlapCount++].x1 = eventX[e] - 1;
+      overlapping = false;
+    }
+  }
+
+  return overlapCount;
+}
+
+METABALL_IRAM int MetaBallRenderer::renderScanlines(uint8_t* rows, int yStart, int yEnd, int xStart, int xEnd) const
+{
+  uint8_t active[MAX_PRIMITIVES];
+  RowSpan activeSpans[MAX_PRIMITIVES];
+  RowSpan visibleSpans[MAX_PRIMITIVES];
+  RowSpan covered[2 * MAX_PRIMITIVES];
+#if METABALL_FORWARD_DIFFERENCING
+  RowEvaluator evaluators[MAX_PRIMITIVES];
+
+  // Where each active span started and the pixel its evaluator is at.
+  int16_t spanStarts[MAX_PRIMITIVES];
+  int16_t evaluatorX[MAX_PRIMITIVES];
+#endif
+
+  // Scanline active list: the indices of the primitives whose vertical
+  // extent holds row y, kept ascending so walking it keeps the blending order.
+  uint8_t rowActive[MAX_PRIMITIVES];
+  int rowActiveCount = 0;
+  int nextPrimitive = 0;
+  int evaluated = 0;
+
+  RowShading shading;
+  BeginShading(shading);
+
+  for (int y = yStart; y < yEnd; ++y)
+  {
+    uint8_t* row = rows + (y - yStart) * ROW_BYTES;
+
+    for (; nextPrimitive < primitiveCount && primitives[rowOrder[nextPrimitive]].minY <= y; ++nextPrimitive)
+    {
+      int index = rowOrder[nextPrimitive];
+      int j = rowActiveCount++;
+
+      for (; j > 0 && rowActive[j - 1] > index; --j)
+        rowActive[j] = rowActive[j - 1];
+
+      rowActive[j] = index;
+    }
+
+    // Primitives touching this row, with their spans. Those the row has
+    // passed leave the active list.
+    int activeCount = 0;
+    int keptCount = 0;
+
+    for (int k = 0; k < rowActiveCount; ++k)
+    {
+      int i = rowActive[k];
+
+      if (primitives[i].maxY < y)
+        continue;
+
+      rowActive[keptCount++] = i;
+
+      RowSpan& span = activeSpans[activeCount];
+
+      if (!GetRowSpan(primitives[i], y, span))
+        continue;
+
+#if METABALL_FORWARD_DIFFERENCING
+      // Evaluators step from where the span starts before it is clipped.
+      int spanStart = span.x0;
+#endif
+      span.x0 = max((int)span.x0, xStart);
+      span.x1 = min((int)span.x1, xEnd - 1);
+
+      if (span.x0 > span.x1)
+        continue;
+
+#if METABALL_FORWARD_DIFFERENCING
+      spanStarts[activeCount] = spanStart;
+      evaluatorX[activeCount] = span.x0;
+
+      if (UsesRowEvaluator(primitives[i]))
+        SkipRowEvaluator(evaluators[activeCount], primitives[i], spanStart, span.x0, y);
+#endif
+
+      RowSpan& visible = visibleSpans[activeCount];
+
+      if (!GetRowSpan(primitives[i], y, visible, HALO_WIDTH))
+        visible.x0 = visible.x1 = -1;
+
+      active[activeCount++] = i;
+    }
+
+    rowActiveCount = keptCount;
+
+    // Union of the visible spans and of where two spans overlap, sorted by
+    // start. Everything outside stays white.
+    int coveredCount = GetOverlapSpans(activeSpans, activeCount, covered);
+
+    for (int i = 0; i < activeCount; ++i)
+    {
+      RowSpan span = visibleSpans[i];
+      span.x0 = max((int)span.x0, xStart);
+      span.x1 = min((int)span.x1, xEnd - 1);
+
+      if (span.x0 > span.x1)
+        continue;
+
+      int j = coveredCount++;
+
+      for (; j > 0 && covered[j - 1].x0 > span.x0; --j)
+        covered[j] = covered[j - 1];
+
+      covered[j] = span;
+    }
+
+    int mergedCount = 0;
+
+    for (int i = 0; i < coveredCount; ++i)
+    {
+      if (mergedCount > 0 && covered[i].x0 <= covered[mergedCount - 1].x1 + 1)
+        covered[mergedCount - 1].x1 = max(covered[mergedCount - 1].x1, covered[i].x1);
+      else
+        covered[mergedCount++] = covered[i];
+    }
+
+    if (mergedCount == 0)
+      continue;
+
+    BeginShadingRow(shading, row, y, covered[0].x0 >> 3, covered[mergedCount - 1].x1 >> 3);
+
+    for (int s = 0; s < mergedCount; ++s)
+    {
+      evaluated += covered[s].x1 - covered[s].x0 + 1;
+
+      for (int x = covered[s].x0; x <= covered[s].x1; ++x)
+      {
+#if METABALL_DIGIT_TILES
+        int tile = GetPixelTile(primitives, active, activeSpans, activeCount, x);
+
+        // Row evaluators left behind here catch up when next used.
+        if (tile > 0 && WriteTilePixel(shading, x, y, glyphs[tile - 1]))
+          continue;
+#endif
+
+        PixelBlend pixel;
+        BeginPixel(pixel, x, y);
+
+        for (int i = 0; i < activeCount; ++i)
+        {
+          if (x < activeSpans[i].x0 || x > activeSpans[i].x1)
+            continue;
+
+          const MetaBallPrimitive& primitive = primitives[active[i]];
+
+#if METABALL_FORWARD_DIFFERENCING
+          if (UsesRowEvaluator(primitive))
+          {
+            if (evaluatorX[i] != x)
+              SkipRowEvaluator(evaluators[i], primitive, spanStarts[i], x, y);
+
+            evaluatorX[i] = x + 1;
+            EvaluateRow(pixel, primitive, evaluators[i], EXTRA_RADIUS);
+            StepRowEvaluator(evaluators[i], primitive, x + 1, y);
+            continue;
+          }
+#endif
+
+          EvaluatePixel(pixel, primitive);
+        }
+
+        AddPixel(shading, x, pixel);
+      }
+    }
+
+    EndShadingRow(shading);
+  }
+
+  FinishShading(shading);
+  return evaluated;
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <Arduino.h>
+#include <VectorXf.h>
+
+#include "MetaBallConfig.h"
+#include "MetaBallFixed.h"
+
+#if METABALL_SDF_ATLAS
+#include "MetaBallAtlas.h"
+#endif
+
+class MetaBallBandTransfer;
+
+// Inputs of one watch face frame.
+struct MetaBallFace
+{
+  int hour;
+  int minute;
+  int month;
+  int day;
+  float battery; // 0..1
+};
+
+enum MetaBallPrimitiveType : uint8_t
+{
+  PRIMITIVE_CIRCLE,
+  PRIMITIVE_CAPSULE,
+  PRIMITIVE_ARC
+};
+
+// One shape of the face with its per-frame constants already resolved.
+struct MetaBallPrimitive
+{
+  MetaBallPrimitiveType type;
+  float radius;
+
+  // Circle center, capsule start point or arc center.
+  Vec2f center;
+
+  // Capsule: end - start and its squared length.
+  Vec2f difference;
+  float sqrMagnitude;
+
+  // Arc: unit directions of both ends, their outward perpendiculars and the
+  // squared radii of the annulus the arc can influence.
+  Vec2f start;
+  Vec2f end;
+  Vec2f startPerpendicular;
+  Vec2f endPerpendicular;
+  float arcRadius;
+  float outterRadiusSqr;
+  float innerRadiusSqr;
+  bool over180;
+
+  // Distance from the shape's core at which it stops influencing pixels
+  // (outer annulus radius for arcs). Capsules also keep the side offset
+  // perpendicular to the segment at that distance.
+  float influenceRadius;
+  Vec2f influenceOffset;
+
+  // Box the shape can influence, extra radius included.
+  float minX;
+  float maxX;
+  float minY;
+  float maxY;
+
+#if METABALL_FIXED_POINT
+  MetaBallFixedPrimitive fixed;
+#endif
+
+#if METABALL_DIGIT_TILES
+  // 1 + index of the digit slot the shape belongs to, 0 for other shapes.
+  uint8_t tile;
+#endif
+};
+
+// Glyphs placed on the face: the digits 0 to 9 and these.
+enum MetaBallGlyph : uint8_t
+{
+  GLYPH_COLON = 10,
+  GLYPH_SLASH,
+  GLYPH_COUNT
+};
+
+// How renderRows() decides which pixels run the metaball blend.
+enum MetaBallTraversal : uint8_t
+{
+  // Every pixel of the frame, the way the face was first drawn.
+  TRAVERSAL_PIXELS,
+  // Per-row spans of the scanline active primitives.
+  TRAVERSAL_SCANLINE,
+  // 16x16 tiles refined to 8x8 and 4x4 while any primitive may reach them.
+  TRAVERSAL_QUADTREE
+};
+
+// Pixel rectangle with both corners inclusive, empty when x0 > x1.
+struct MetaBallRect
+{
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+};
+
+// One glyph on the face: (x, y) is the top left pixel of its GLYPH_WIDTH x
+// GLYPH_HEIGHT box and bounds is what its clipped shapes can reach.
+struct MetaBallGlyphInstance
+{
+  uint8_t glyph;
+  int16_t x;
+  int16_t y;
+  MetaBallRect bounds;
+};
+
+// Parts of the face renderLayers() caches separately, one per digit slot.
+enum MetaBallLayer : uint8_t
+{
+  LAYER_HOUR_TENS,
+  LAYER_HOUR_ONES,
+  LAYER_MINUTE_TENS,
+  LAYER_MINUTE_ONES,
+  LAYER_MONTH_TENS,
+  LAYER_MONTH_ONES,
+  LAYER_DAY_TENS,
+  LAYER_DAY_ONES,
+  LAYER_BATTERY,
+  // Colon and slash, which never change.
+  LAYER_STATIC,
+  LAYER_COUNT
+};
+
+// What renderLayers() knows about the frame it left behind. Zero initialized
+// it is invalid, so it can live in RTC memory next to the frame.
+struct MetaBallLayerCache
+{
+  bool valid;
+  MetaBallFace face;
+  MetaBallRect bounds[LAYER_COUNT];
+};
+
+// Rasterizes the metaball watch face into a packed 1bpp frame.
+// Rows are WIDTH / 8 bytes, MSB is the leftmost pixel and a set bit is white,
+// the same layout the e-paper controller and GxEPD2 buffers use.
+class MetaBallRenderer
+{
+public:
+  static const int WIDTH = 200;
+  static const int HEIGHT = 200;
+  static const int ROW_BYTES = WIDTH / 8;
+  static const int FRAME_SIZE = ROW_BYTES * HEIGHT;
+
+  // Eight digits of at most three shapes, colon, slash and battery line.
+  static const int MAX_PRIMITIVES = 8 * 3 + 4;
+
+  // Box that holds everything a glyph can reach, with the glyph centered on
+  // pixel (GLYPH_CENTER_X, GLYPH_CENTER_Y). Digit tiles and atlases use it.
+  static const int GLYPH_WIDTH = 64;
+  static const int GLYPH_HEIGHT = 104;
+  static const int GLYPH_CENTER_X = 32;
+  static const int GLYPH_CENTER_Y = 52;
+
+  // Eight digits, the colon and the slash.
+  static const int GLYPH_SLOTS = 10;
+
+  // Resolves the face into primitives and renders the whole frame (FRAME_SIZE bytes),
+  // with renderParallel() if METABALL_PARALLEL is set.
+  // Returns the number of pixels the metaball blend was evaluated for.
+  int render(const MetaBallFace& face, uint8_t* frame);
+
+  // Resolves the face into the primitive list used by renderRows().
+  void setFace(const MetaBallFace& face);
+
+  // Replaces the primitive list with one glyph as drawn on the face,
+  // centered on (x, y). Used by the generators in native/tiles.
+  void setGlyph(int glyph, float x, float y);
+
+  // Blends all current primitives for one pixel and classifies it; for
+  // SHADE_SURFACE u and v are the matcap texel.
+  MetaBallShade classifyPixel(int x, int y, int16_t& u, int16_t& v) const;
+
+  // Signed distance from a pixel to the current primitives, negative inside,
+  // their surfaces joined with a smooth minimum of the given width.
+  float getDistance(int x, int y, float blend) const;
+
+#if METABALL_SDF_ATLAS
+  // Renders rows [yStart, yEnd), columns [xStart, xEnd) of the current face
+  // from a glyph distance field atlas instead of the metaball blend.
+  int renderAtlas(uint8_t* rows, int yStart, int yEnd, int xStart, int xEnd, const MetaBallAtlas& atlas) const;
+
+  // What renderAtlas() classifies one pixel of the current face as.
+  MetaBallShade classifyAtlasPixel(int x, int y, const MetaBallAtlas& atlas, int16_t& u, int16_t& v) const;
+#endif
+
+  // Renders rows [yStart, yEnd) of the current face into rows, which holds
+  // (yEnd - yStart) * ROW_BYTES bytes. Returns the evaluated pixel count.
+  int renderRows(uint8_t* rows, int yStart, int yEnd) const;
+
+  // Renders the whole current face (FRAME_SIZE bytes) on two cores, which
+  // take bands of METABALL_PARALLEL_BAND_ROWS rows in turn until none are
+  // left. Returns the evaluated pixel count like renderRows(). With
+  // METABALL_DEFERRED_SHADING it renders on the calling core only.
+  int renderParallel(uint8_t* frame) const;
+
+  // Renders the current face in bands of bandRows rows, alternating between
+  // the two halves of buffers (2 * bandRows * ROW_BYTES bytes), and passes
+  // each band to transfer as soon as it is done. The next band is rendered
+  // while the transfer runs. Returns the evaluated pixel count.
+  int renderBands(MetaBallBandTransfer& transfer, uint8_t* buffers, int bandRows) const;
+
+  // Renders the pixels of rect into frame (FRAME_SIZE bytes) with the
+  // scanline traversal and leaves every other pixel as it was.
+  int renderRect(uint8_t* frame, const MetaBallRect& rect) const;
+
+  // Brings frame, which holds the frame cache describes, up to date with face.
+  // Only the pixels a changed layer could reach, before or after the change,
+  // are rasterized again. Every primitive is still evaluated for them, so
+  // where layers blend into each other the result is the same as render().
+  int renderLayers(const MetaBallFace& face, uint8_t* frame, MetaBallLayerCache& cache);
+
+  // Windows the last renderLayers() call redrew, widened to whole bytes and
+  // merged where they overlap. Nothing outside them changed on the panel.
+  const MetaBallRect* getDirtyWindows() const { return dirtyWindows; }
+  int getDirtyWindowCount() const { return dirtyWindowCount; }
+
+  // Pixels the primitives of a layer can influence on the current face.
+  const MetaBallRect& getLayerBounds(MetaBallLayer layer) const { return layerBounds[layer]; }
+
+  void setTraversal(MetaBallTraversal value) { traversal = value; }
+  MetaBallTraversal getTraversal() const { return traversal; }
+
+#if METABALL_SDF_ATLAS
+  // Atlas the face is rendered from, MetaBallGetAtlas(METABALL_SDF_ATLAS) by
+  // default. One without data renders the metaball blend instead.
+  void setAtlas(const MetaBallAtlas& value) { atlas = value; }
+#endif
+
+  const MetaBallGlyphInstance* getGlyphs() const { return glyphs; }
+  const MetaBallPrimitive* getPrimitives() const { return primitives; }
+  int getPrimitiveCount() const { return primitiveCount; }
+
+private:
+  int renderPixels(uint8_t* rows, int yStart, int yEnd) const;
+  int renderScanlines(uint8_t* rows, int yStart, int yEnd, int xStart, int xEnd) const;
+  int renderQuadtree(uint8_t* rows, int yStart, int yEnd) const;
+  int renderTile(uint8_t* rows, int yStart, int yEnd, int x0, int y0, int size, const uint8_t* indices, int indexCount) const;
+
+  MetaBallTraversal traversal = TRAVERSAL_SCANLINE;
+
+#if METABALL_SDF_ATLAS
+  MetaBallAtlas atlas = MetaBallGetAtlas(METABALL_SDF_ATLAS);
+#endif
+
+  MetaBallPrimitive primitives[MAX_PRIMITIVES];
+  int primitiveCount = 0;
+
+  // Primitive indices sorted by minY.
+  uint8_t rowOrder[MAX_PRIMITIVES];
+
+  MetaBallRect layerBounds[LAYER_COUNT];
+
+  MetaBallRect dirtyWindows[LAYER_COUNT];
+  int dirtyWindowCount = 0;
+
+  MetaBallGlyphInstance glyphs[GLYPH_SLOTS];
+};
@@ -0,0 +1,133 @@
+#include "MetaBallTables.h"
+
+#if METABALL_MATCAP_FIT == 4
+#include "../../../include/MatCapFit4.h"
+
+static const uint8_t* const FlashMatCap = MatCapFit4;
+#elif METABALL_MATCAP_FIT == 8
+#include "../../../include/MatCapFit8.h"
+
+static const uint8_t* const FlashMatCap = MatCapFit8;
+#elif METABALL_TILED_TABLES && METABALL_PACKED_TABLES
+#if !__has_include("../../../include/MatCapTiledPacked.h")
+#error "METABALL_TILED_TABLES needs the tiled tables, generate them with pio run -e tiles -t exec"
+#endif
+#include "../../../include/MatCapTiledPacked.h"
+
+static const uint8_t* const FlashMatCap = MatCapTiledPacked;
+#elif METABALL_TILED_TABLES
+#if !__has_include("../../../include/MatCapTiled.h")
+#error "METABALL_TILED_TABLES needs the tiled tables, generate them with pio run -e tiles -t exec"
+#endif
+#include "../../../include/MatCapTiled.h"
+
+static const uint8_t* const FlashMatCap = MatCapTiled;
+#elif METABALL_PACKED_TABLES
+#include "../../../include/MatCapPacked.h"
+
+static const uint8_t* const FlashMatCap = MatCapPacked;
+#else
+#include "../../../include/MatCapSource.h"
+
+static const uint8_t* const FlashMatCap = MatCapSource;
+#endif
+
+#if METABALL_NOISE_MASK == 16
+#include "../../../include/BlueNoise16.h"
+
+static const uint8_t* const FlashNoise = BlueNoise16;
+#elif METABALL_NOISE_MASK == 32
+#include "../../../include/BlueNoise32.h"
+
+static const uint8_t* const FlashNoise = BlueNoise32;
+#elif METABALL_NOISE_MASK == 64
+#include "../../../include/BlueNoise64.h"
+
+static const uint8_t* const FlashNoise = BlueNoise64;
+#elif METABALL_TILED_TABLES && METABALL_PACKED_TABLES
+#if !__has_include("../../../include/BlueNoiseTiledPacked.h")
+#error "METABALL_TILED_TABLES needs the tiled tables, generate them with pio run -e tiles -t exec"
+#endif
+#include "../../../include/BlueNoiseTiledPacked.h"
+
+static const uint8_t* const FlashNoise = BlueNoiseTiledPacked;
+#elif METABALL_TILED_TABLES
+#if !__has_include("../../../include/BlueNoiseTiled.h")
+#error "METABALL_TILED_TABLES needs the tiled tables, generate them with pio run -e tiles -t exec"
+#endif
+#include "../../../include/BlueNoiseTiled.h"
+
+static const uint8_t* const FlashNoise = BlueNoiseTiled;
+#elif METABALL_PACKED_TABLES
+#include "../../../include/BlueNoisePacked.h"
+
+static const uint8_t* const FlashNoise = BlueNoisePacked;
+#else
+#include "../../../include/BlueNoise200.h"
+
+static const uint8_t* const FlashNoise = BlueNoise200;
+#endif
+
+#if METABALL_RAM_TABLES
+#ifdef ARDUINO_ARCH_ESP32
+#include <esp_heap_caps.h>
+#else
+#include <stdlib.h>
+#endif
+#endif
+
+const uint8_t* MetaBallMatCap = FlashMatCap;
+const uint8_t* MetaBallNoise = FlashNoise;
+
+#if METABALL_RAM_TABLES
+
+static uint8_t* AllocateTable(int bytes)
+{
+#ifdef ARDUINO_ARCH_ESP32
+  // Internal DRAM only: PSRAM would be slower than the flash cache.
+  return (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  return (uint8_t*)malloc(bytes);
+#endif
+}
+
+static void FreeTable(uint8_t* table)
+{
+#ifdef ARDUINO_ARCH_ESP32
+  heap_caps_free(table);
+#else
+  free(table);
+#endif
+}
+
+bool MetaBallLoadTables()
+{
+  if (MetaBallMatCap != FlashMatCap)
+    return true;
+
+  uint8_t* matcap = AllocateTable(METABALL_MATCAP_BYTES);
+  uint8_t* noise = AllocateTable(METABALL_NOISE_BYTES);
+
+  if (!matcap || !noise)
+  {
+    FreeTable(matcap);
+    FreeTable(noise);
+    return false;
+  }
+
+  // Sequential reads: every flash cache line is fetched once.
+  memcpy(matcap, FlashMatCap, METABALL_MATCAP_BYTES);
+  memcpy(noise, FlashNoise, METABALL_NOISE_BYTES);
+  MetaBallMatCap = matcap;
+  MetaBallNoise = noise;
+  return true;
+}
+
+#else
+
+bool MetaBallLoadTables()
+{
+  return false;
+}
+
+#endif
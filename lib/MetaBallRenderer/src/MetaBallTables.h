@@ -0,0 +1,185 @@
+#pragma once
+
+#include <Arduino.h>
+#include "MetaBallConfig.h"
+
+// Texels in each shading table: 200x200, row-major or tiled
+// (METABALL_TILED_TABLES).
+const int METABALL_TABLE_SIZE = 200 * 200;
+
+// Texels in a byte of a table: two 4 bit levels with METABALL_PACKED_TABLES,
+// the texel with the even index in the high nibble, otherwise one.
+const int METABALL_TEXELS_PER_BYTE = METABALL_PACKED_TABLES ? 2 : 1;
+const int METABALL_TABLE_BYTES = METABALL_TABLE_SIZE / METABALL_TEXELS_PER_BYTE;
+
+// The same for the noise, which with METABALL_NOISE_MASK is a small mask of
+// one texel a byte.
+#if METABALL_NOISE_MASK
+const int METABALL_NOISE_TEXELS_PER_BYTE = 1;
+const int METABALL_NOISE_BYTES = METABALL_NOISE_MASK * METABALL_NOISE_MASK;
+#else
+const int METABALL_NOISE_TEXELS_PER_BYTE = METABALL_TEXELS_PER_BYTE;
+const int METABALL_NOISE_BYTES = METABALL_TABLE_BYTES;
+#endif
+
+// Bytes of MetaBallMatCap, which with METABALL_MATCAP_FIT is a grid of
+// METABALL_MATCAP_FIT_NODES x METABALL_MATCAP_FIT_NODES values.
+#if METABALL_MATCAP_FIT
+const int METABALL_MATCAP_FIT_NODES = 199 / METABALL_MATCAP_FIT + 2;
+const int METABALL_MATCAP_BYTES = METABALL_MATCAP_FIT_NODES * METABALL_MATCAP_FIT_NODES;
+#else
+const int METABALL_MATCAP_BYTES = METABALL_TABLE_BYTES;
+#endif
+
+// Tiles of the tiled layout: 8 x 4 texels, one 32 byte flash cache line.
+const int METABALL_TABLE_TILE_WIDTH = 8;
+const int METABALL_TABLE_TILE_HEIGHT = 4;
+
+// Offset of texel (x, y) in the tiled layout. Tiles are stored row by row,
+// and the texels within a tile are too, so eight texels starting at a
+// multiple of 8 are still next to each other.
+inline int MetaBallTiledIndex(int x, int y)
+{
+  return (y / METABALL_TABLE_TILE_HEIGHT) * (200 * METABALL_TABLE_TILE_HEIGHT) + (x / METABALL_TABLE_TILE_WIDTH) * (METABALL_TABLE_TILE_WIDTH * METABALL_TABLE_TILE_HEIGHT)
+    + (y % METABALL_TABLE_TILE_HEIGHT) * METABALL_TABLE_TILE_WIDTH + x % METABALL_TABLE_TILE_WIDTH;
+}
+
+// Offset of texel (x, y) in MetaBallMatCap and MetaBallNoise.
+inline int MetaBallTableIndex(int x, int y)
+{
+#if METABALL_TILED_TABLES
+  return MetaBallTiledIndex(x, y);
+#else
+  return y * 200 + x;
+#endif
+}
+
+// Offset of the threshold of pixel (x, y) in MetaBallNoise. The mask repeats
+// every METABALL_NOISE_MASK pixels, a power of two.
+inline int MetaBallNoiseIndex(int x, int y)
+{
+#if METABALL_NOISE_MASK
+  return (y & (METABALL_NOISE_MASK - 1)) * METABALL_NOISE_MASK + (x & (METABALL_NOISE_MASK - 1));
+#else
+  return MetaBallTableIndex(x, y);
+#endif
+}
+
+// Byte of a table that holds texel index.
+inline int MetaBallTableByte(int index)
+{
+  return index / METABALL_TEXELS_PER_BYTE;
+}
+
+// Byte of MetaBallNoise that holds texel index.
+inline int MetaBallNoiseByte(int index)
+{
+  return index / METABALL_NOISE_TEXELS_PER_BYTE;
+}
+
+// 4 bit levels of the packed tables. A matcap level stands for level * 17,
+// so 0 and 15 are still black and white. A noise level stands for the middle
+// of the 16 thresholds it replaces, so a matcap level of n beats n of them.
+inline uint8_t MetaBallQuantizeMatCap(uint8_t value)
+{
+  return (value + 8) / 17;
+}
+
+inline uint8_t MetaBallExpandMatCap(uint8_t level)
+{
+  return level * 17;
+}
+
+inline uint8_t MetaBallQuantizeNoise(uint8_t value)
+{
+  return value >> 4;
+}
+
+inline uint8_t MetaBallExpandNoise(uint8_t level)
+{
+  return level * 16 + 8;
+}
+
+// The matcap (indexed by the surface normal) and the blue noise (indexed by
+// the pixel) the renderer shades with. Both point at the PROGMEM arrays in
+// flash until MetaBallLoadTables() has copied them to internal RAM.
+extern const uint8_t* MetaBallMatCap;
+extern const uint8_t* MetaBallNoise;
+
+// With METABALL_RAM_TABLES copies both tables to internal DRAM, once per
+// boot, so shading no longer goes through the flash cache. Returns true if
+// they are in RAM; if the option is off or the allocation fails they stay
+// in flash and rendering works as before.
+bool MetaBallLoadTables();
+
+inline uint8_t MetaBallReadNibble(const uint8_t* table, int index)
+{
+  uint8_t pair = pgm_read_byte(&table[index >> 1]);
+  return index & 1 ? pair & 0x0F : pair >> 4;
+}
+
+// 8 bit matcap value of texel index.
+inline uint8_t MetaBallReadMatCap(int index)
+{
+#if METABALL_PACKED_TABLES
+  return MetaBallExpandMatCap(MetaBallReadNibble(MetaBallMatCap, index));
+#else
+  return pgm_read_byte(&MetaBallMatCap[index]);
+#endif
+}
+
+// Matcap texel (u, v) interpolated from a grid of nodes every spacing texels,
+// a power of two, stored row by row. Node (i, j) stands for texel
+// (i * spacing, j * spacing); the last row and column are past the table so
+// every texel has four nodes around it.
+inline uint8_t MetaBallSampleMatCapFit(const uint8_t* nodes, int spacing, int u, int v)
+{
+  int stride = 199 / spacing + 2;
+  int i = (unsigned)u / spacing;
+  int j = (unsigned)v / spacing;
+  int fx = u & (spacing - 1);
+  int fy = v & (spacing - 1);
+  const uint8_t* node = &nodes[j * stride + i];
+
+  int top = pgm_read_byte(&node[0]) * (spacing - fx) + pgm_read_byte(&node[1]) * fx;
+  int bottom = pgm_read_byte(&node[stride]) * (spacing - fx) + pgm_read_byte(&node[stride + 1]) * fx;
+  return (top * (spacing - fy) + bottom * fy + spacing * spacing / 2) / (spacing * spacing);
+}
+
+// 8 bit threshold of texel index.
+inline uint8_t MetaBallReadNoise(int index)
+{
+#if METABALL_PACKED_TABLES && !METABALL_NOISE_MASK
+  return MetaBallExpandNoise(MetaBallReadNibble(MetaBallNoise, index));
+#else
+  return pgm_read_byte(&MetaBallNoise[index]);
+#endif
+}
+
+// Thresholds of pixels x to x + 7 of row y, x a multiple of 8. They are
+// next to each other in every layout and mask, and start on a whole byte
+// when packed.
+inline void MetaBallReadNoiseByte(int x, int y, uint8_t* thresholds)
+{
+  int index = MetaBallNoiseIndex(x, y);
+
+#if METABALL_PACKED_TABLES && !METABALL_NOISE_MASK
+  const uint8_t* pairs = &MetaBallNoise[index >> 1];
+
+  for (int i = 0; i < 4; ++i)
+  {
+    thresholds[i * 2] = MetaBallExpandNoise(pairs[i] >> 4);
+    thresholds[i * 2 + 1] = MetaBallExpandNoise(pairs[i] & 0x0F);
+  }
+#else
+  memcpy(thresholds, &MetaBallNoise[index], 8);
+#endif
+}
+
+// Puts the renderer's inner loops in IRAM along with the tables, so the hot
+// path no longer goes through the flash cache for code either.
+#if METABALL_RAM_TABLES && defined(ARDUINO_ARCH_ESP32)
+#define METABALL_IRAM IRAM_ATTR
+#else
+#define METABALL_IRAM
+#endif
@@ -0,0 +1,7 @@
+#include "MetaBallTrace.h"
+
+#if METABALL_TRACE
+
+MetaBallTraceHook MetaBallTraceReads = nullptr;
+
+#endif
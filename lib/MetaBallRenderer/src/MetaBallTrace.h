@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include "MetaBallConfig.h"
+
+// Memory the trace follows. Table offsets are bytes of the table as stored
+// (MetaBallTableByte), frame offsets y * ROW_BYTES + byte of the full frame.
+enum MetaBallTraceRegion
+{
+  TRACE_MATCAP,
+  TRACE_NOISE,
+  TRACE_FRAME,
+  // Not a read: marks the end of a frame in a trace file.
+  TRACE_FRAME_END
+};
+
+// One read in a trace file, packed into 32 bits (little endian):
+//   bits 30-31  MetaBallTraceRegion
+//   bits 24-29  bytes read - 1
+//   bits  0-23  offset
+inline uint32_t MetaBallPackTrace(MetaBallTraceRegion region, uint32_t offset, uint32_t size)
+{
+  return ((uint32_t)region << 30) | ((size - 1) << 24) | offset;
+}
+
+inline MetaBallTraceRegion MetaBallTraceRecordRegion(uint32_t record)
+{
+  return (MetaBallTraceRegion)(record >> 30);
+}
+
+inline uint32_t MetaBallTraceRecordSize(uint32_t record)
+{
+  return ((record >> 24) & 0x3F) + 1;
+}
+
+inline uint32_t MetaBallTraceRecordOffset(uint32_t record)
+{
+  return record & 0xFFFFFF;
+}
+
+typedef void (*MetaBallTraceHook)(MetaBallTraceRegion region, uint32_t offset, uint32_t size);
+
+#if METABALL_TRACE
+
+extern MetaBallTraceHook MetaBallTraceReads;
+
+// Called with every matcap, noise and frame read the renderer makes while
+// shading; nullptr stops tracing.
+inline void MetaBallSetTraceHook(MetaBallTraceHook hook)
+{
+  MetaBallTraceReads = hook;
+}
+
+#define METABALL_TRACE_READ(region, offset, size) \
+  do { if (MetaBallTraceReads) MetaBallTraceReads((region), (offset), (size)); } while (0)
+
+#else
+
+#define METABALL_TRACE_READ(region, offset, size) ((void)0)
+
+#endif
@@ -0,0 +1,1465 @@
+// Host benchmark for MetaBallWatchy::drawWatchFace().
+//
+// Renders every HH:MM of a day with a spread of dates and battery levels and
+// reports per-frame render time. Frames can be dumped to a file and compared
+// against a previous dump, so an optimization can be checked for pixel changes.
+//
+// With --traversal the renderer is also driven directly in every traversal
+// mode, reporting time, how many pixels ran the metaball blend and how many
+// pixels differ from the per-pixel reference path (TRAVERSAL_PIXELS).
+//
+// With --layers the renderer keeps its frame between minute ticks of a
+// simulated day (starting at noon, so it crosses midnight) and only redraws
+// layers whose inputs changed. Every frame is checked against a full render,
+// and every pixel that differs from the previous full render has to lie in
+// one of the byte-aligned dirty windows the renderer reports.
+//
+// With --diff the same day is rendered in full every tick and diffed against
+// the previous frame (MetaBallDiffFrames), reporting the area of the windows
+// that would be refreshed and checking that they cover every changed pixel.
+//
+// With --prerender (build with -DMETABALL_PRERENDER=1) a day is simulated
+// with one wake per minute, a slowly draining battery, a few button wakes and
+// a manual time change, reporting how often the wake only had to copy a
+// pre-rendered frame and the time spent on and off the wake path.
+//
+// With --atlas (build with -DMETABALL_SDF_ATLAS=2 or 4) every frame is also
+// rendered from the glyph distance field atlas at each generated resolution
+// (MetaBallRenderer::renderAtlas), reporting time, flash size and how many
+// pixels differ from the analytic reference path (TRAVERSAL_PIXELS). Most of
+// those are dither differences, so it also counts pixels classified
+// differently (background, outline or surface) and the mean matcap texel
+// error of pixels both call surface.
+//
+// With --parallel every frame is rendered serially and with
+// MetaBallRenderer::renderParallel(), checking that both give the same frame.
+// As the host may not have two free cores, each band is also timed alone and
+// dealt to two simulated cores the way the bands are claimed, which gives the
+// wall time the watch would see. The extra charge of keeping the second core
+// awake for it uses the ESP32 currents below.
+//
+// With --bands the face is rendered with MetaBallRenderer::renderBands() for
+// a few band heights into a mock panel whose transfers run on their own
+// thread and take as long as SPI_HZ would on the watch. The panel RAM has to
+// match a full render and no band may change while it is being sent. Host
+// sleeps are too coarse to time the overlap, so the wake time comes from the
+// render time of every band laid out on a modelled SPI timeline, against
+// rendering the whole frame and then sending it.
+//
+// With --tables every pixel of each frame is classified to find the
+// MatCapSource and BlueNoise200 cache lines shading reads, row-major and in
+// the tiled layout of METABALL_TILED_TABLES. The flash cache is cold after
+// deep sleep, so each line touched is at least one miss; that lower bound on
+// the stalls of shading from flash is set against copying both tables to RAM
+// at wake (METABALL_RAM_TABLES), using the ESP32 costs below. Lines and
+// bytes are those of the tables this bench is built with, so
+// -DMETABALL_PACKED_TABLES=1 gives the footprint of the 4 bit tables.
+//
+// With --dither every frame is classified once and its surface thresholded
+// with each variant of the matcap and noise tables, the 8 bit originals and
+// the 4 bit levels of METABALL_PACKED_TABLES, the tileable masks of
+// METABALL_NOISE_MASK, for scale white noise, and the fitted matcap grids of
+// METABALL_MATCAP_FIT. After a small blur that stands
+// in for viewing distance, the mean error against the blurred matcap tone
+// says how well each keeps the shading, and the bias whether it lightens or
+// darkens it.
+//
+// With --trace (build with -DMETABALL_TRACE=1) every matcap, noise and frame
+// read of the timed frames is written to a file in the MetaBallTrace.h
+// format, for native/cachesim to replay. Tracing slows the timed frames.
+//
+// The bench exits with 1 when --compare finds a different frame or one of
+// the checks above fails, so a run can gate a build. --atlas and --dither
+// measure approximations and never fail.
+//
+//   bench [--frames N] [--dump FILE] [--compare FILE] [--trace FILE] [--traversal] [--layers] [--diff] [--prerender] [--atlas] [--parallel] [--bands] [--tables] [--dither]
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <MetaBallWatchy.h>
+#include <MetaBallFrameDiff.h>
+#include <MetaBallAtlas.h>
+#include <MetaBallBandTransfer.h>
+#include <MetaBallTables.h>
+#include <MetaBallTrace.h>
+
+#include "../../include/MatCapSource.h"
+#include "../../include/BlueNoise200.h"
+#include "../../include/BlueNoise16.h"
+#include "../../include/BlueNoise32.h"
+#include "../../include/BlueNoise64.h"
+#include "../../include/MatCapFit4.h"
+#include "../../include/MatCapFit8.h"
+
+const int FRAME_COUNT = 24 * 60;
+const int BATTERY_STEPS = 21;
+const float BENCH_VOLTAGE_MIN = 3.4f;
+const float BENCH_VOLTAGE_MAX = 4.3f;
+
+// Pixels per frame the scanline traversal may differ from TRAVERSAL_PIXELS
+// with METABALL_FORWARD_DIFFERENCING, whose distances are stepped in float
+// and only resynced every METABALL_RESYNC_INTERVAL pixels, or with
+// METABALL_DIGIT_TILES, whose digits were evaluated at another position.
+const int SCANLINE_TOLERANCE = 16;
+
+static const watchySettings settings = {};
+
+// Checks that failed; main() exits with 1 if there are any.
+static int failedChecks = 0;
+
+static void expectAtMost(int64_t count, int64_t limit, const char* what)
+{
+  if (count <= limit)
+    return;
+
+  fprintf(stderr, "FAILED        %lld %s\n", (long long)count, what);
+  failedChecks++;
+}
+
+struct FrameInput
+{
+  int hour;
+  int minute;
+  int month;
+  int day;
+  float voltage;
+};
+
+static FrameInput getFrameInput(int index)
+{
+  FrameInput input;
+  input.hour = index / 60;
+  input.minute = index % 60;
+  input.month = 1 + index % 12;
+  input.day = 1 + (index * 7) % 31;
+  input.voltage = BENCH_VOLTAGE_MIN + (BENCH_VOLTAGE_MAX - BENCH_VOLTAGE_MIN) * (index % BATTERY_STEPS) / (BATTERY_STEPS - 1);
+  return input;
+}
+
+static int countPixelDifferences(const uint8_t* a, const uint8_t* b, int size)
+{
+  int count = 0;
+
+  for (int i = 0; i < size; ++i)
+    count += __builtin_popcount(a[i] ^ b[i]);
+
+  return count;
+}
+
+static double percentile(const std::vector<double>& sorted, double p)
+{
+  size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+struct TimeStats
+{
+  double min;
+  double median;
+  double p99;
+  double mean;
+};
+
+static TimeStats getTimeStats(const std::vector<double>& times)
+{
+  std::vector<double> sorted = times;
+  std::sort(sorted.begin(), sorted.end());
+
+  double total = 0.0;
+  for (double t : times)
+    total += t;
+
+  TimeStats stats;
+  stats.min = sorted.front();
+  stats.median = percentile(sorted, 0.5);
+  stats.p99 = percentile(sorted, 0.99);
+  stats.mean = total / times.size();
+  return stats;
+}
+
+static void setFrameInput(MetaBallWatchy& watchy, int index)
+{
+  FrameInput input = getFrameInput(index);
+  watchy.currentTime.Hour = input.hour;
+  watchy.currentTime.Minute = input.minute;
+  watchy.currentTime.Month = input.month;
+  watchy.currentTime.Day = input.day;
+  Watchy::batteryVoltage = input.voltage;
+}
+
+static MetaBallFace getFace(MetaBallWatchy& watchy)
+{
+  MetaBallFace face;
+  face.hour = watchy.currentTime.Hour;
+  face.minute = watchy.currentTime.Minute;
+  face.month = watchy.currentTime.Month;
+  face.day = watchy.currentTime.Day;
+  face.battery = watchy.getBatteryFill();
+  return face;
+}
+
+static const char* getTraversalName(MetaBallTraversal traversal)
+{
+  switch (traversal)
+  {
+  case TRAVERSAL_PIXELS: return "pixels";
+  case TRAVERSAL_SCANLINE: return "scanline";
+  case TRAVERSAL_QUADTREE: return "quadtree";
+  }
+
+  return "?";
+}
+
+static void benchTraversals(MetaBallWatchy& watchy, int frameCount)
+{
+  // The reference path comes first so the other modes can be checked against it.
+  const MetaBallTraversal traversals[] = { TRAVERSAL_PIXELS, TRAVERSAL_SCANLINE, TRAVERSAL_QUADTREE };
+  const int frameSize = MetaBallRenderer::FRAME_SIZE;
+
+  MetaBallRenderer renderer;
+  std::vector<uint8_t> reference((size_t)frameCount * frameSize);
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+
+  printf("\n%-10s %10s %10s %10s %16s %12s\n", "traversal", "min [us]", "median", "p99", "evaluated/frame", "diff pixels");
+
+  for (MetaBallTraversal traversal : traversals)
+  {
+    renderer.setTraversal(traversal);
+    std::vector<double> times;
+    int64_t evaluated = 0;
+    int64_t differentPixels = 0;
+    int worstPixels = 0;
+
+    for (int i = 0; i < frameCount; ++i)
+    {
+      setFrameInput(watchy, i);
+      MetaBallFace face = getFace(watchy);
+
+      auto start = std::chrono::steady_clock::now();
+      evaluated += renderer.render(face, frame);
+      auto end = std::chrono::steady_clock::now();
+
+      times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+      if (traversal == TRAVERSAL_PIXELS)
+        memcpy(&reference[(size_t)i * frameSize], frame, frameSize);
+      else
+      {
+        int count = countPixelDifferences(frame, &reference[(size_t)i * frameSize], frameSize);
+        differentPixels += count;
+        worstPixels = std::max(worstPixels, count);
+      }
+    }
+
+    TimeStats stats = getTimeStats(times);
+    printf("%-10s %10.1f %10.1f %10.1f %16.0f %12lld\n", getTraversalName(traversal), stats.min, stats.median, stats.p99,
+      (double)evaluated / frameCount, (long long)differentPixels);
+
+    if (traversal == TRAVERSAL_SCANLINE && (METABALL_FORWARD_DIFFERENCING || METABALL_DIGIT_TILES))
+      expectAtMost(worstPixels, SCANLINE_TOLERANCE, "pixels of a scanline frame differ from TRAVERSAL_PIXELS");
+    else
+      expectAtMost(differentPixels, 0, "pixels differ from TRAVERSAL_PIXELS");
+  }
+
+  printf("(a full frame is %d pixels)\n", MetaBallRenderer::WIDTH * MetaBallRenderer::HEIGHT);
+}
+
+#if METABALL_SDF_ATLAS
+struct AtlasQuality
+{
+  int64_t shapePixels;
+  int64_t surfacePixels;
+  double texelError;
+};
+
+// Compares the atlas classification of every pixel with the analytic blend.
+static void addAtlasQuality(const MetaBallRenderer& renderer, const MetaBallAtlas& atlas, AtlasQuality& quality)
+{
+  for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+  {
+    for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+    {
+      int16_t u = 0;
+      int16_t v = 0;
+      int16_t atlasU = 0;
+      int16_t atlasV = 0;
+      MetaBallShade shade = renderer.classifyPixel(x, y, u, v);
+      MetaBallShade atlasShade = renderer.classifyAtlasPixel(x, y, atlas, atlasU, atlasV);
+
+      if (shade != atlasShade)
+      {
+        quality.shapePixels++;
+      }
+      else if (shade == SHADE_SURFACE)
+      {
+        quality.surfacePixels++;
+        quality.texelError += sqrt((double)(u - atlasU) * (u - atlasU) + (double)(v - atlasV) * (v - atlasV));
+      }
+    }
+  }
+}
+
+static void benchAtlas(MetaBallWatchy& watchy, int frameCount)
+{
+  // 0 is the analytic reference; the others are atlas sample spacings.
+  const int scales[] = { 0, 2, 4 };
+  const int frameSize = MetaBallRenderer::FRAME_SIZE;
+  const int framePixels = MetaBallRenderer::WIDTH * MetaBallRenderer::HEIGHT;
+
+  MetaBallRenderer renderer;
+  renderer.setTraversal(TRAVERSAL_PIXELS);
+  renderer.setAtlas(MetaBallGetAtlas(0));
+  std::vector<uint8_t> reference((size_t)frameCount * frameSize);
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+
+  printf("\n%-9s %9s %9s %9s %10s %12s %9s %11s %9s\n", "atlas", "min [us]", "median", "p99", "flash [B]",
+    "diff pixels", "diff [%]", "shape [%]", "texel err");
+
+  for (int scale : scales)
+  {
+    MetaBallAtlas atlas = MetaBallGetAtlas(scale);
+    std::vector<double> times;
+    int64_t differentPixels = 0;
+    AtlasQuality quality = {};
+
+    for (int i = 0; i < frameCount; ++i)
+    {
+      setFrameInput(watchy, i);
+      MetaBallFace face = getFace(watchy);
+
+      auto start = std::chrono::steady_clock::now();
+      if (scale == 0)
+      {
+        renderer.render(face, frame);
+      }
+      else
+      {
+        renderer.setFace(face);
+        memset(frame, 0xFF, frameSize);
+        renderer.renderAtlas(frame, 0, MetaBallRenderer::HEIGHT, 0, MetaBallRenderer::WIDTH, atlas);
+      }
+      auto end = std::chrono::steady_clock::now();
+
+      times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+      if (scale == 0)
+      {
+        memcpy(&reference[(size_t)i * frameSize], frame, frameSize);
+      }
+      else
+      {
+        differentPixels += countPixelDifferences(frame, &reference[(size_t)i * frameSize], frameSize);
+        addAtlasQuality(renderer, atlas, quality);
+      }
+    }
+
+    TimeStats stats = getTimeStats(times);
+
+    if (scale == 0)
+    {
+      printf("%-9s %9.1f %9.1f %9.1f %10d %12s %9s %11s %9s\n", "analytic", stats.min, stats.median, stats.p99, 0, "-", "-", "-", "-");
+      continue;
+    }
+
+    char name[8];
+    snprintf(name, sizeof(name), "1/%d", scale);
+    printf("%-9s %9.1f %9.1f %9.1f %10d %12lld %9.2f %11.2f %9.2f\n", name, stats.min, stats.median, stats.p99,
+      atlas.width * atlas.height * GLYPH_COUNT, (long long)differentPixels, 100.0 * differentPixels / frameCount / framePixels,
+      100.0 * quality.shapePixels / frameCount / framePixels, quality.surfacePixels > 0 ? quality.texelError / quality.surfacePixels : 0.0);
+  }
+}
+#endif
+
+// Assumed active current of the ESP32 at 240 MHz with one core running and
+// the other idle, and with both running. The datasheet gives 30-68 mA for
+// the chip active with the radio off; change these to match a measurement.
+const float ONE_CORE_MA = 44.0f;
+const float TWO_CORES_MA = 68.0f;
+
+static void benchParallel(MetaBallWatchy& watchy, int frameCount)
+{
+  const int bandRows = METABALL_PARALLEL_BAND_ROWS;
+  const int bandCount = (MetaBallRenderer::HEIGHT + bandRows - 1) / bandRows;
+
+  MetaBallRenderer renderer;
+  static uint8_t serial[MetaBallRenderer::FRAME_SIZE];
+  static uint8_t parallel[MetaBallRenderer::FRAME_SIZE];
+  std::vector<double> serialTimes;
+  std::vector<double> parallelTimes;
+  std::vector<double> modelTimes;
+  int64_t differentPixels = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    renderer.setFace(getFace(watchy));
+
+    auto start = std::chrono::steady_clock::now();
+    renderer.renderRows(serial, 0, MetaBallRenderer::HEIGHT);
+    auto serialEnd = std::chrono::steady_clock::now();
+    renderer.renderParallel(parallel);
+    auto parallelEnd = std::chrono::steady_clock::now();
+
+    serialTimes.push_back(std::chrono::duration<double, std::micro>(serialEnd - start).count());
+    parallelTimes.push_back(std::chrono::duration<double, std::micro>(parallelEnd - serialEnd).count());
+    differentPixels += countPixelDifferences(serial, parallel, MetaBallRenderer::FRAME_SIZE);
+
+    // Whichever core is free first claims the next band.
+    double coreTimes[2] = { 0.0, 0.0 };
+
+    for (int band = 0; band < bandCount; ++band)
+    {
+      int yStart = band * bandRows;
+      int yEnd = std::min(yStart + bandRows, (int)MetaBallRenderer::HEIGHT);
+
+      auto bandStart = std::chrono::steady_clock::now();
+      renderer.renderRows(parallel + yStart * MetaBallRenderer::ROW_BYTES, yStart, yEnd);
+      auto bandEnd = std::chrono::steady_clock::now();
+
+      double& core = coreTimes[coreTimes[1] < coreTimes[0]];
+      core += std::chrono::duration<double, std::micro>(bandEnd - bandStart).count();
+    }
+
+    modelTimes.push_back(std::max(coreTimes[0], coreTimes[1]));
+  }
+
+  double serialTime = getTimeStats(serialTimes).median;
+  double parallelTime = getTimeStats(parallelTimes).median;
+  double modelTime = getTimeStats(modelTimes).median;
+
+  // Charge while rendering, in microampere seconds: one core for the serial
+  // time against both for the two-core time.
+  double serialCharge = ONE_CORE_MA * serialTime / 1000.0;
+  double modelCharge = TWO_CORES_MA * modelTime / 1000.0;
+
+  printf("\nparallel      %d bands of %d rows, %lld pixels differ from the serial render\n", bandCount, bandRows, (long long)differentPixels);
+  expectAtMost(differentPixels, 0, "pixels of renderParallel() differ from the serial render");
+  printf("render [us]   median %.1f serial, %.1f on %u host threads (%.2fx), %.1f on two modelled cores (%.2fx)\n",
+    serialTime, parallelTime, std::thread::hardware_concurrency(), serialTime / parallelTime, modelTime, serialTime / modelTime);
+  printf("charge [uAs]  %.1f on one core, %.1f on two (%+.1f%% wake energy while rendering at %.0f / %.0f mA)\n",
+    serialCharge, modelCharge, 100.0 * (modelCharge - serialCharge) / serialCharge, ONE_CORE_MA, TWO_CORES_MA);
+}
+
+// Clock of the display SPI bus; GxEPD2 runs the Watchy panel at 4 MHz.
+const double SPI_HZ = 4e6;
+
+// Panel that receives bands on a thread of its own, as a DMA transfer would,
+// and checks that the renderer leaves a band alone until it is sent.
+class MockPanelTransfer : public MetaBallBandTransfer
+{
+public:
+  uint8_t ram[MetaBallRenderer::FRAME_SIZE];
+  int overwrittenBands = 0;
+
+  void send(const uint8_t* rows, int y, int rowCount)
+  {
+    size_t size = (size_t)rowCount * MetaBallRenderer::ROW_BYTES;
+    worker = std::thread([this, rows, y, size]()
+    {
+      uint32_t checksum = std::accumulate(rows, rows + size, 0u);
+      std::this_thread::sleep_for(std::chrono::duration<double>(size * 8 / SPI_HZ));
+      memcpy(ram + y * MetaBallRenderer::ROW_BYTES, rows, size);
+
+      if (std::accumulate(rows, rows + size, 0u) != checksum)
+        overwrittenBands++;
+    });
+  }
+
+  void wait()
+  {
+    if (worker.joinable())
+      worker.join();
+  }
+
+private:
+  std::thread worker;
+};
+
+// Wake time of a banded render on a timeline where every transfer takes as
+// long as SPI_HZ needs: a band is sent once it is rendered and the bus is
+// free, and the next band is rendered meanwhile.
+static double getBandedWakeTime(const std::vector<double>& renderTimes, int bandRows)
+{
+  double cpu = 0.0;
+  double bus = 0.0;
+
+  for (size_t band = 0; band < renderTimes.size(); ++band)
+  {
+    int rowCount = std::min(bandRows, MetaBallRenderer::HEIGHT - (int)band * bandRows);
+    cpu = std::max(cpu + renderTimes[band], bus);
+    bus = cpu + rowCount * MetaBallRenderer::ROW_BYTES * 8 / SPI_HZ * 1e6;
+  }
+
+  return bus;
+}
+
+static void benchBands(MetaBallWatchy& watchy, int frameCount)
+{
+  const int bandHeights[] = { 8, 20, 40, MetaBallRenderer::HEIGHT };
+
+  // Every mock transfer sleeps, so fewer frames are enough.
+  frameCount = std::min(frameCount, 120);
+
+  MetaBallRenderer renderer;
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+  static uint8_t buffers[2 * MetaBallRenderer::FRAME_SIZE];
+  MockPanelTransfer panel;
+
+  printf("\n%-6s %12s %14s %14s %12s %12s\n", "bands", "buffer [B]", "wake [us]", "serial [us]", "diff pixels", "overwritten");
+
+  for (int bandRows : bandHeights)
+  {
+    std::vector<double> wakeTimes;
+    std::vector<double> serialTimes;
+    int64_t differentPixels = 0;
+    panel.overwrittenBands = 0;
+
+    for (int i = 0; i < frameCount; ++i)
+    {
+      setFrameInput(watchy, i);
+      renderer.render(getFace(watchy), frame);
+
+      memset(panel.ram, 0, sizeof(panel.ram));
+      renderer.renderBands(panel, buffers, bandRows);
+      differentPixels += countPixelDifferences(panel.ram, frame, MetaBallRenderer::FRAME_SIZE);
+
+      // Render time of each band alone, for the SPI timeline.
+      std::vector<double> renderTimes;
+      double renderTime = 0.0;
+
+      for (int yStart = 0; yStart < MetaBallRenderer::HEIGHT; yStart += bandRows)
+      {
+        auto start = std::chrono::steady_clock::now();
+        renderer.renderRows(buffers, yStart, std::min(yStart + bandRows, (int)MetaBallRenderer::HEIGHT));
+        auto end = std::chrono::steady_clock::now();
+
+        renderTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        renderTime += renderTimes.back();
+      }
+
+      wakeTimes.push_back(getBandedWakeTime(renderTimes, bandRows));
+      serialTimes.push_back(renderTime + MetaBallRenderer::FRAME_SIZE * 8 / SPI_HZ * 1e6);
+    }
+
+    // A single band never needs the second half of the buffer.
+    int bufferSize = (bandRows < MetaBallRenderer::HEIGHT ? 2 : 1) * bandRows * MetaBallRenderer::ROW_BYTES;
+    printf("%-6d %12d %14.1f %14.1f %12lld %12d\n", bandRows, bufferSize,
+      getTimeStats(wakeTimes).median, getTimeStats(serialTimes).median, (long long)differentPixels, panel.overwrittenBands);
+    expectAtMost(differentPixels, 0, "pixels of renderBands() differ in the mock panel");
+    expectAtMost(panel.overwrittenBands, 0, "bands changed while they were sent");
+  }
+
+  printf("(median of %d frames with %.0f MHz SPI; serial renders all %d bytes of the frame, then sends them)\n",
+    frameCount, SPI_HZ / 1e6, MetaBallRenderer::FRAME_SIZE);
+
+#if METABALL_BANDED
+  // The watch face's own path into the controller RAM.
+  int64_t panelPixels = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    renderer.render(getFace(watchy), frame);
+    watchy.showWatchFaceBanded(true);
+    panelPixels += countPixelDifferences(Watchy::display.epd2.ram, frame, MetaBallRenderer::FRAME_SIZE);
+  }
+
+  printf("showWatchFaceBanded() %lld pixels differ in the controller RAM\n", (long long)panelPixels);
+  expectAtMost(panelPixels, 0, "pixels of showWatchFaceBanded() differ in the controller RAM");
+#endif
+}
+
+// Assumed ESP32 flash cache costs at 240 MHz: a 32 byte line, a miss taking
+// about 100 clocks of 80 MHz QIO flash, and copying a cached line to DRAM at
+// two bytes a cycle. Change these to match a measurement.
+const int CACHE_LINE_BYTES = 32;
+const double CPU_HZ = 240e6;
+const double MISS_CYCLES = 300.0;
+const double COPY_CYCLES_PER_BYTE = 0.5;
+
+static double getCycleTime(double cycles)
+{
+  return cycles / CPU_HZ * 1e6;
+}
+
+// A way of shading a surface pixel: the matcap value of texel (u, v) and
+// the threshold of pixel (x, y) it has to beat to be white.
+struct DitherVariant
+{
+  const char* name;
+  uint8_t (*matcap)(int u, int v);
+  uint8_t (*noise)(int x, int y);
+};
+
+static uint8_t getSourceMatCap(int u, int v)
+{
+  return MatCapSource[v * 200 + u];
+}
+
+static uint8_t getFit4MatCap(int u, int v)
+{
+  return MetaBallSampleMatCapFit(MatCapFit4, 4, u, v);
+}
+
+static uint8_t getFit8MatCap(int u, int v)
+{
+  return MetaBallSampleMatCapFit(MatCapFit8, 8, u, v);
+}
+
+static uint8_t getSourceNoise(int x, int y)
+{
+  return BlueNoise200[y * 200 + x];
+}
+
+static uint8_t getPackedMatCap(int u, int v)
+{
+  return MetaBallExpandMatCap(MetaBallQuantizeMatCap(MatCapSource[v * 200 + u]));
+}
+
+static uint8_t getPackedNoise(int x, int y)
+{
+  return MetaBallExpandNoise(MetaBallQuantizeNoise(BlueNoise200[y * 200 + x]));
+}
+
+static uint8_t getMask16Noise(int x, int y)
+{
+  return BlueNoise16[(y & 15) * 16 + (x & 15)];
+}
+
+static uint8_t getMask32Noise(int x, int y)
+{
+  return BlueNoise32[(y & 31) * 32 + (x & 31)];
+}
+
+static uint8_t getMask64Noise(int x, int y)
+{
+  return BlueNoise64[(y & 63) * 64 + (x & 63)];
+}
+
+// Uncorrelated thresholds, the scale the blue noise errors are read against.
+static uint8_t getWhiteNoise(int x, int y)
+{
+  uint32_t hash = (uint32_t)(y * 200 + x) * 2654435761u;
+  hash ^= hash >> 15;
+  hash *= 2246822519u;
+  return (uint8_t)(hash >> 24);
+}
+
+// 5 x 5 binomial blur, about what the eye averages over on the panel.
+static void blurTone(const std::vector<float>& tone, std::vector<float>& blurred)
+{
+  const float weights[] = { 1.0f, 4.0f, 6.0f, 4.0f, 1.0f };
+  const int width = MetaBallRenderer::WIDTH;
+  const int height = MetaBallRenderer::HEIGHT;
+  std::vector<float> rows(tone.size());
+
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      float sum = 0.0f;
+
+      for (int i = -2; i <= 2; ++i)
+        sum += weights[i + 2] * tone[y * width + std::min(std::max(x + i, 0), width - 1)];
+
+      rows[y * width + x] = sum / 16.0f;
+    }
+  }
+
+  blurred.resize(tone.size());
+
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      float sum = 0.0f;
+
+      for (int i = -2; i <= 2; ++i)
+        sum += weights[i + 2] * rows[std::min(std::max(y + i, 0), height - 1) * width + x];
+
+      blurred[y * width + x] = sum / 16.0f;
+    }
+  }
+}
+
+static void benchDither(MetaBallWatchy& watchy, int frameCount)
+{
+  // The first variant is what the others are compared with.
+  const DitherVariant variants[] = {
+    { "8 bit", getSourceMatCap, getSourceNoise },
+    { "4 bit", getPackedMatCap, getPackedNoise },
+    { "16 x 16 mask", getSourceMatCap, getMask16Noise },
+    { "32 x 32 mask", getSourceMatCap, getMask32Noise },
+    { "64 x 64 mask", getSourceMatCap, getMask64Noise },
+    { "white noise", getSourceMatCap, getWhiteNoise },
+    { "4 texel fit", getFit4MatCap, getSourceNoise },
+    { "8 texel fit", getFit8MatCap, getSourceNoise },
+  };
+  const int variantCount = sizeof(variants) / sizeof(variants[0]);
+  const int framePixels = MetaBallRenderer::WIDTH * MetaBallRenderer::HEIGHT;
+
+  MetaBallRenderer renderer;
+  std::vector<float> tone(framePixels);
+  std::vector<float> blurredTone;
+  std::vector<float> dither(framePixels);
+  std::vector<float> blurredDither;
+  std::vector<uint8_t> reference(framePixels);
+  std::vector<MetaBallShade> shades(framePixels);
+  std::vector<int16_t> texels(framePixels * 2);
+
+  double error[variantCount] = {};
+  double bias[variantCount] = {};
+  double texelError[variantCount] = {};
+  int64_t differentPixels[variantCount] = {};
+  int64_t surfacePixels = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    renderer.setFace(getFace(watchy));
+
+    for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+    {
+      for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+      {
+        int pixel = y * MetaBallRenderer::WIDTH + x;
+        shades[pixel] = renderer.classifyPixel(x, y, texels[pixel * 2], texels[pixel * 2 + 1]);
+
+        // The continuous tone the dither stands for.
+        if (shades[pixel] == SHADE_SURFACE)
+          tone[pixel] = MatCapSource[texels[pixel * 2 + 1] * 200 + texels[pixel * 2]];
+        else
+          tone[pixel] = shades[pixel] == SHADE_OUTLINE ? 0.0f : 255.0f;
+
+        surfacePixels += shades[pixel] == SHADE_SURFACE;
+      }
+    }
+
+    blurTone(tone, blurredTone);
+
+    for (int variant = 0; variant < variantCount; ++variant)
+    {
+      for (int pixel = 0; pixel < framePixels; ++pixel)
+      {
+        dither[pixel] = tone[pixel];
+
+        if (shades[pixel] != SHADE_SURFACE)
+          continue;
+
+        int x = pixel % MetaBallRenderer::WIDTH;
+        int y = pixel / MetaBallRenderer::WIDTH;
+        int16_t u = texels[pixel * 2];
+        int16_t v = texels[pixel * 2 + 1];
+        uint8_t matcap = variants[variant].matcap(u, v);
+        bool white = matcap > variants[variant].noise(x, y);
+        texelError[variant] += abs(matcap - MatCapSource[v * 200 + u]);
+        dither[pixel] = white ? 255.0f : 0.0f;
+
+        if (variant == 0)
+          reference[pixel] = white;
+        else
+          differentPixels[variant] += reference[pixel] != white;
+      }
+
+      blurTone(dither, blurredDither);
+
+      for (int pixel = 0; pixel < framePixels; ++pixel)
+      {
+        if (shades[pixel] != SHADE_SURFACE)
+          continue;
+
+        error[variant] += fabsf(blurredDither[pixel] - blurredTone[pixel]);
+        bias[variant] += blurredDither[pixel] - blurredTone[pixel];
+      }
+    }
+  }
+
+  printf("\n%-14s %12s %10s %12s %12s\n", "dither", "error [%]", "bias [%]", "diff pixels", "matcap err");
+
+  for (int variant = 0; variant < variantCount; ++variant)
+  {
+    printf("%-14s %12.2f %10.2f %12.0f %12.2f\n", variants[variant].name, 100.0 * error[variant] / surfacePixels / 255.0,
+      100.0 * bias[variant] / surfacePixels / 255.0, (double)differentPixels[variant] / frameCount, texelError[variant] / surfacePixels);
+  }
+
+  printf("(surface pixels only, after a 5 x 5 blur, against the blurred 8 bit matcap; diff pixels per frame against %s;\n"
+    " matcap err is the mean distance in levels from MatCapSource of the values shaded)\n", variants[0].name);
+}
+
+// Cache lines of one table a frame reads, in one layout.
+struct TableLines
+{
+  int (*index)(int x, int y);
+  std::vector<bool> frame;
+  std::vector<bool> band;
+  std::vector<int> bandTouched;
+  std::vector<bool> texels;
+  int64_t frameCount;
+  int64_t bandCount;
+  int64_t texelCount;
+};
+
+static int getRowMajorIndex(int x, int y)
+{
+  return y * 200 + x;
+}
+
+static TableLines getTableLines(int (*index)(int x, int y))
+{
+  TableLines lines;
+  lines.index = index;
+  lines.frame.resize(METABALL_TABLE_BYTES / CACHE_LINE_BYTES);
+  lines.band.resize(METABALL_TABLE_BYTES / CACHE_LINE_BYTES);
+  lines.texels.resize(METABALL_TABLE_SIZE);
+  lines.frameCount = 0;
+  lines.bandCount = 0;
+  lines.texelCount = 0;
+  return lines;
+}
+
+static void touchTexel(TableLines& lines, int x, int y)
+{
+  int index = lines.index(x, y);
+  int line = index / METABALL_TEXELS_PER_BYTE / CACHE_LINE_BYTES;
+
+  if (!lines.texels[index])
+    lines.texelCount++;
+
+  lines.texels[index] = true;
+
+  if (lines.band[line])
+    return;
+
+  lines.band[line] = true;
+  lines.bandTouched.push_back(line);
+  lines.bandCount++;
+
+  if (!lines.frame[line])
+    lines.frameCount++;
+
+  lines.frame[line] = true;
+}
+
+static void endTableBand(TableLines& lines)
+{
+  for (int line : lines.bandTouched)
+    lines.band[line] = false;
+
+  lines.bandTouched.clear();
+}
+
+static void endTableFrame(TableLines& lines)
+{
+  std::fill(lines.frame.begin(), lines.frame.end(), false);
+  std::fill(lines.texels.begin(), lines.texels.end(), false);
+}
+
+// Rows whose reads share a window in the --tables locality report.
+const int TABLE_BAND_ROWS = 8;
+
+static void benchTables(MetaBallWatchy& watchy, int frameCount)
+{
+  const int tableLines = METABALL_TABLE_BYTES / CACHE_LINE_BYTES;
+
+  // Matcap and noise, row-major and tiled.
+  TableLines lines[2][2] = {
+    { getTableLines(getRowMajorIndex), getTableLines(MetaBallTiledIndex) },
+    { getTableLines(getRowMajorIndex), getTableLines(MetaBallTiledIndex) },
+  };
+
+  MetaBallRenderer renderer;
+  int64_t surfacePixels = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    renderer.setFace(getFace(watchy));
+
+    for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+    {
+      for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+      {
+        int16_t u = 0;
+        int16_t v = 0;
+
+        if (renderer.classifyPixel(x, y, u, v) != SHADE_SURFACE)
+          continue;
+
+        surfacePixels++;
+
+        for (int layout = 0; layout < 2; ++layout)
+        {
+          touchTexel(lines[0][layout], u, v);
+          touchTexel(lines[1][layout], x, y);
+        }
+      }
+
+      if (y % TABLE_BAND_ROWS != TABLE_BAND_ROWS - 1)
+        continue;
+
+      for (int layout = 0; layout < 2; ++layout)
+      {
+        endTableBand(lines[0][layout]);
+        endTableBand(lines[1][layout]);
+      }
+    }
+
+    for (int layout = 0; layout < 2; ++layout)
+    {
+      endTableFrame(lines[0][layout]);
+      endTableFrame(lines[1][layout]);
+    }
+  }
+
+  // Host copy of both tables, best of a few runs.
+  std::vector<uint8_t> copy(METABALL_MATCAP_BYTES + METABALL_NOISE_BYTES);
+  double hostCopy = 1e9;
+
+  for (int run = 0; run < 20; ++run)
+  {
+    auto start = std::chrono::steady_clock::now();
+    memcpy(&copy[0], MetaBallMatCap, METABALL_MATCAP_BYTES);
+    memcpy(&copy[METABALL_MATCAP_BYTES], MetaBallNoise, METABALL_NOISE_BYTES);
+    auto end = std::chrono::steady_clock::now();
+    hostCopy = std::min(hostCopy, std::chrono::duration<double, std::micro>(end - start).count());
+  }
+
+  printf("\nsurface/frame  %.0f pixels, one matcap and one noise read each\n", (double)surfacePixels / frameCount);
+  printf("%-10s %-7s %12s %12s %12s\n", "layout", "table", "lines", "used [B]", "band lines");
+
+  const char* layoutNames[] = { "row-major", "tiled" };
+  const char* tableNames[] = { "matcap", "noise" };
+
+  for (int layout = 0; layout < 2; ++layout)
+  {
+    for (int table = 0; table < 2; ++table)
+    {
+      const TableLines& read = lines[table][layout];
+      printf("%-10s %-7s %12.0f %12.1f %12.0f\n", layoutNames[layout], tableNames[table], (double)read.frameCount / frameCount,
+        (double)read.texelCount / METABALL_TEXELS_PER_BYTE / read.frameCount, (double)read.bandCount / frameCount);
+    }
+  }
+
+  printf("(per frame, of %d lines a table; used is the bytes of each %d byte line read, band lines sums the lines every %d rows read)\n",
+    tableLines, CACHE_LINE_BYTES, TABLE_BAND_ROWS);
+
+  const int layout = METABALL_TILED_TABLES ? 1 : 0;
+  // A mask or a fitted grid is small enough that every frame reads all of it.
+  const int matcapTableLines = (METABALL_MATCAP_BYTES + CACHE_LINE_BYTES - 1) / CACHE_LINE_BYTES;
+  const int noiseTableLines = METABALL_NOISE_BYTES / CACHE_LINE_BYTES;
+  double matcapLines = METABALL_MATCAP_FIT ? matcapTableLines : (double)lines[0][layout].frameCount / frameCount;
+  double noiseLines = METABALL_NOISE_MASK ? noiseTableLines : (double)lines[1][layout].frameCount / frameCount;
+  double missTime = getCycleTime((matcapLines + noiseLines) * MISS_CYCLES);
+  double copyTime = getCycleTime((matcapTableLines + noiseTableLines) * MISS_CYCLES + (METABALL_MATCAP_BYTES + METABALL_NOISE_BYTES) * COPY_CYCLES_PER_BYTE);
+
+  printf("\ntables in RAM       %s\n", MetaBallLoadTables() ? "yes" : "no (build with -DMETABALL_RAM_TABLES=1)");
+  printf("flash stalls/frame  >= %.1f us %s (%d cycles per cold miss)\n", missTime, layoutNames[layout], (int)MISS_CYCLES);
+  printf("copy at wake        %.1f us modelled, %.1f us on the host, %d bytes\n", copyTime, hostCopy, METABALL_MATCAP_BYTES + METABALL_NOISE_BYTES);
+  printf("(the stalls are compulsory misses only; lines evicted by code in the shared 32 KB cache cost again)\n");
+}
+
+static void benchLayers(int frameCount)
+{
+  const int START_MINUTE = 12 * 60;
+  const int BATTERY_LEVELS = 32;
+
+  MetaBallRenderer renderer;
+  MetaBallRenderer reference;
+  MetaBallLayerCache cache = {};
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+  static uint8_t expected[MetaBallRenderer::FRAME_SIZE];
+  static uint8_t previous[MetaBallRenderer::FRAME_SIZE];
+  std::vector<double> layerTimes;
+  int64_t windowArea = 0;
+  int64_t changedArea = 0;
+  int64_t uncoveredPixels = 0;
+  int maxWindowArea = 0;
+  std::vector<double> fullTimes;
+  int64_t evaluated = 0;
+  int64_t fullEvaluated = 0;
+  int64_t differentPixels = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    int minuteOfDay = START_MINUTE + i;
+
+    MetaBallFace face;
+    face.hour = (minuteOfDay / 60) % 24;
+    face.minute = minuteOfDay % 60;
+    face.month = 3;
+    face.day = 14 + minuteOfDay / (24 * 60);
+    face.battery = (BATTERY_LEVELS - 1 - (BATTERY_LEVELS / 2) * i / FRAME_COUNT) / (float)(BATTERY_LEVELS - 1);
+
+    auto start = std::chrono::steady_clock::now();
+    int count = renderer.renderLayers(face, frame, cache);
+    auto end = std::chrono::steady_clock::now();
+    int fullCount = reference.render(face, expected);
+    auto fullEnd = std::chrono::steady_clock::now();
+
+    // The first frame has nothing cached and is drawn in full.
+    if (i > 0)
+    {
+      const MetaBallRect* windows = renderer.getDirtyWindows();
+      int area = 0;
+
+      for (int w = 0; w < renderer.getDirtyWindowCount(); ++w)
+        area += (windows[w].x1 - windows[w].x0 + 1) * (windows[w].y1 - windows[w].y0 + 1);
+
+      MetaBallRect changed = { MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT, -1, -1 };
+
+      for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+      {
+        for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+        {
+          int index = y * MetaBallRenderer::ROW_BYTES + x / 8;
+          if (!((expected[index] ^ previous[index]) & (0x80 >> (x & 7))))
+            continue;
+
+          changed.x0 = std::min<int16_t>(changed.x0, x);
+          changed.y0 = std::min<int16_t>(changed.y0, y);
+          changed.x1 = std::max<int16_t>(changed.x1, x);
+          changed.y1 = std::max<int16_t>(changed.y1, y);
+
+          bool covered = false;
+          for (int w = 0; w < renderer.getDirtyWindowCount() && !covered; ++w)
+            covered = x >= windows[w].x0 && x <= windows[w].x1 && y >= windows[w].y0 && y <= windows[w].y1;
+
+          if (!covered)
+            uncoveredPixels++;
+        }
+      }
+
+      if (changed.x0 <= changed.x1)
+        changedArea += (changed.x1 - changed.x0 + 1) * (changed.y1 - changed.y0 + 1);
+
+      windowArea += area;
+      maxWindowArea = std::max(maxWindowArea, area);
+
+      layerTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+      fullTimes.push_back(std::chrono::duration<double, std::micro>(fullEnd - end).count());
+      evaluated += count;
+      fullEvaluated += fullCount;
+    }
+
+    differentPixels += countPixelDifferences(frame, expected, MetaBallRenderer::FRAME_SIZE);
+    memcpy(previous, expected, MetaBallRenderer::FRAME_SIZE);
+  }
+
+  if (layerTimes.empty())
+    return;
+
+  const int ticks = (int)layerTimes.size();
+  const double screenArea = MetaBallRenderer::WIDTH * MetaBallRenderer::HEIGHT;
+
+  printf("\nlayers        %.1f%% of the full render's evaluated pixels per tick, %lld pixels differ from a full render\n",
+    100.0 * evaluated / fullEvaluated, (long long)differentPixels);
+  printf("tick   [us]   median %.1f layered, %.1f full\n", getTimeStats(layerTimes).median, getTimeStats(fullTimes).median);
+  printf("windows       %.1f%% of the screen per tick (max %.1f%%), changed pixels' bounding box %.1f%%, %lld changed pixels outside them\n",
+    100.0 * windowArea / ticks / screenArea, 100.0 * maxWindowArea / screenArea, 100.0 * changedArea / ticks / screenArea, (long long)uncoveredPixels);
+  expectAtMost(differentPixels, 0, "pixels of renderLayers() differ from a full render");
+  expectAtMost(uncoveredPixels, 0, "changed pixels lie outside the dirty windows");
+}
+
+// Pixels that differ between two frames but lie outside every window.
+static int countUncoveredPixels(const uint8_t* a, const uint8_t* b, const MetaBallRect* windows, int windowCount)
+{
+  int count = 0;
+
+  for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+  {
+    for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+    {
+      int index = y * MetaBallRenderer::ROW_BYTES + x / 8;
+      if (!((a[index] ^ b[index]) & (0x80 >> (x & 7))))
+        continue;
+
+      bool covered = false;
+      for (int w = 0; w < windowCount && !covered; ++w)
+        covered = x >= windows[w].x0 && x <= windows[w].x1 && y >= windows[w].y0 && y <= windows[w].y1;
+
+      if (!covered)
+        count++;
+    }
+  }
+
+  return count;
+}
+
+static void benchDiff(int frameCount)
+{
+  const int START_MINUTE = 12 * 60;
+  const int MAX_WINDOWS = 4;
+
+  MetaBallRenderer renderer;
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+  static uint8_t previous[MetaBallRenderer::FRAME_SIZE];
+  MetaBallRect windows[MAX_WINDOWS];
+  std::vector<double> diffTimes;
+  int64_t windowArea = 0;
+  int64_t windowCount = 0;
+  int64_t changedPixels = 0;
+  int64_t uncoveredPixels = 0;
+  int unchangedTicks = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    int minuteOfDay = START_MINUTE + i;
+
+    // Unlike --layers the battery is not rounded, the diff has to catch every change.
+    MetaBallFace face;
+    face.hour = (minuteOfDay / 60) % 24;
+    face.minute = minuteOfDay % 60;
+    face.month = 3;
+    face.day = 14 + minuteOfDay / (24 * 60);
+    face.battery = 1.0f - 0.5f * i / FRAME_COUNT;
+
+    renderer.render(face, frame);
+
+    if (i > 0)
+    {
+      auto start = std::chrono::steady_clock::now();
+      int count = MetaBallDiffFrames(previous, frame, windows, MAX_WINDOWS);
+      auto end = std::chrono::steady_clock::now();
+      diffTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+      for (int w = 0; w < count; ++w)
+        windowArea += (windows[w].x1 - windows[w].x0 + 1) * (windows[w].y1 - windows[w].y0 + 1);
+
+      windowCount += count;
+      unchangedTicks += count == 0;
+      changedPixels += countPixelDifferences(previous, frame, MetaBallRenderer::FRAME_SIZE);
+      uncoveredPixels += countUncoveredPixels(previous, frame, windows, count);
+    }
+
+    memcpy(previous, frame, MetaBallRenderer::FRAME_SIZE);
+  }
+
+  if (diffTimes.empty())
+    return;
+
+  const int ticks = (int)diffTimes.size();
+  const double screenArea = MetaBallRenderer::WIDTH * MetaBallRenderer::HEIGHT;
+
+  printf("\ndiff          %.1f%% of the screen in %.2f windows per minute, %.0f changed pixels per minute, %d minutes unchanged\n",
+    100.0 * windowArea / ticks / screenArea, (double)windowCount / ticks, (double)changedPixels / ticks, unchangedTicks);
+  printf("diff   [us]   median %.1f, %lld changed pixels outside the windows\n", getTimeStats(diffTimes).median, (long long)uncoveredPixels);
+  expectAtMost(uncoveredPixels, 0, "changed pixels lie outside the MetaBallDiffFrames() windows");
+}
+
+#if METABALL_PRERENDER
+
+static void benchPrerender(MetaBallWatchy& watchy, int frameCount)
+{
+  const int TIME_SET_FRAME = frameCount / 2;
+  const int TIME_SET_SKIP = 37;
+  const int BUTTON_WAKE_INTERVAL = 10;
+
+  MetaBallRenderer renderer;
+  static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+  std::vector<double> hitTimes;
+  std::vector<double> missTimes;
+  std::vector<double> busyTimes;
+  int wakes = 0;
+  int hits = 0;
+  int64_t differentPixels = 0;
+  int minuteOfDay = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    // The user sets the clock forward once, halfway through the day.
+    if (i == TIME_SET_FRAME)
+      minuteOfDay += TIME_SET_SKIP;
+
+    int wakeCount = (i % BUTTON_WAKE_INTERVAL == 0) ? 2 : 1;
+
+    for (int w = 0; w < wakeCount; ++w)
+    {
+      watchy.currentTime.Hour = (minuteOfDay / 60) % 24;
+      watchy.currentTime.Minute = minuteOfDay % 60;
+      watchy.currentTime.Month = 3;
+      watchy.currentTime.Day = 14;
+      Watchy::batteryVoltage = 4.2f - 0.5f * i / FRAME_COUNT;
+
+      auto start = std::chrono::steady_clock::now();
+      watchy.drawWatchFace();
+      auto drawn = std::chrono::steady_clock::now();
+      Watchy::display.display(true);
+      auto end = std::chrono::steady_clock::now();
+
+      double wakeTime = std::chrono::duration<double, std::micro>(drawn - start).count();
+      busyTimes.push_back(std::chrono::duration<double, std::micro>(end - drawn).count());
+      wakes++;
+
+      if (watchy.usedPrerenderedFrame())
+      {
+        hits++;
+        hitTimes.push_back(wakeTime);
+      }
+      else
+        missTimes.push_back(wakeTime);
+
+      // Whatever path was taken, the frame must match a fresh render of the same (rounded) inputs.
+      MetaBallFace face = getFace(watchy);
+      face.battery = lroundf(face.battery * (METABALL_BATTERY_LEVELS - 1)) / (float)(METABALL_BATTERY_LEVELS - 1);
+      renderer.render(face, frame);
+      differentPixels += countPixelDifferences(frame, Watchy::display.getBuffer(), MetaBallRenderer::FRAME_SIZE);
+    }
+
+    minuteOfDay++;
+  }
+
+  printf("\nprerender     %d/%d wakes copied a pre-rendered frame, %lld pixels differ from a fresh render\n", hits, wakes, (long long)differentPixels);
+  expectAtMost(differentPixels, 0, "pixels of pre-rendered frames differ from a fresh render");
+
+  if (!hitTimes.empty())
+    printf("wake (hit)    median %.1f us\n", getTimeStats(hitTimes).median);
+
+  if (!missTimes.empty())
+    printf("wake (miss)   median %.1f us\n", getTimeStats(missTimes).median);
+
+  printf("display busy  median %.1f us (pre-render while the panel refreshes)\n", getTimeStats(busyTimes).median);
+}
+
+#endif
+
+#if METABALL_TRACE
+
+static FILE* traceFile = nullptr;
+
+static void writeTrace(MetaBallTraceRegion region, uint32_t offset, uint32_t size)
+{
+  uint32_t record = MetaBallPackTrace(region, offset, size);
+  fwrite(&record, sizeof(record), 1, traceFile);
+}
+
+#endif
+
+int main(int argc, char** argv)
+{
+  int frameCount = FRAME_COUNT;
+  const char* dumpPath = nullptr;
+  const char* comparePath = nullptr;
+  const char* tracePath = nullptr;
+  bool traversals = false;
+  bool layers = false;
+  bool diff = false;
+  bool prerender = false;
+  bool atlas = false;
+  bool parallel = false;
+  bool bands = false;
+  bool tables = false;
+  bool dither = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+      frameCount = std::min(atoi(argv[++i]), FRAME_COUNT);
+    else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc)
+      dumpPath = argv[++i];
+    else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+      comparePath = argv[++i];
+    else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+      tracePath = argv[++i];
+    else if (strcmp(argv[i], "--traversal") == 0)
+      traversals = true;
+    else if (strcmp(argv[i], "--layers") == 0)
+      layers = true;
+    else if (strcmp(argv[i], "--diff") == 0)
+      diff = true;
+    else if (strcmp(argv[i], "--prerender") == 0)
+      prerender = true;
+    else if (strcmp(argv[i], "--atlas") == 0)
+      atlas = true;
+    else if (strcmp(argv[i], "--parallel") == 0)
+      parallel = true;
+    else if (strcmp(argv[i], "--bands") == 0)
+      bands = true;
+    else if (strcmp(argv[i], "--tables") == 0)
+      tables = true;
+    else if (strcmp(argv[i], "--dither") == 0)
+      dither = true;
+    else
+    {
+      fprintf(stderr, "usage: %s [--frames N] [--dump FILE] [--compare FILE] [--trace FILE] [--traversal] [--layers] [--diff] [--prerender] [--atlas] [--parallel] [--bands] [--tables] [--dither]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  const int frameSize = GxEPD2_BW_Native::BUFFER_SIZE;
+  std::vector<uint8_t> frames((size_t)frameCount * frameSize);
+  std::vector<double> times;
+  times.reserve(frameCount);
+
+  MetaBallWatchy watchy(settings);
+  uint64_t pixelWrites = 0;
+
+  if (tracePath)
+  {
+#if METABALL_TRACE
+    traceFile = fopen(tracePath, "wb");
+    if (!traceFile)
+    {
+      fprintf(stderr, "cannot open %s\n", tracePath);
+      return 1;
+    }
+
+    MetaBallSetTraceHook(writeTrace);
+#else
+    fprintf(stderr, "--trace needs a build with -DMETABALL_TRACE=1\n");
+    return 1;
+#endif
+  }
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    Watchy::display.pixelWrites = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    watchy.drawWatchFace();
+    auto end = std::chrono::steady_clock::now();
+
+    times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    pixelWrites += Watchy::display.pixelWrites;
+    memcpy(&frames[(size_t)i * frameSize], Watchy::display.getBuffer(), frameSize);
+
+#if METABALL_TRACE
+    if (traceFile)
+      writeTrace(TRACE_FRAME_END, 0, 1);
+#endif
+  }
+
+#if METABALL_TRACE
+  if (traceFile)
+  {
+    MetaBallSetTraceHook(nullptr);
+    fclose(traceFile);
+  }
+#endif
+
+  TimeStats stats = getTimeStats(times);
+
+  printf("frames        %d\n", frameCount);
+  printf("min     [us]  %.1f\n", stats.min);
+  printf("median  [us]  %.1f\n", stats.median);
+  printf("p99     [us]  %.1f\n", stats.p99);
+  printf("mean    [us]  %.1f\n", stats.mean);
+  printf("drawPixel/frame %.0f\n", (double)pixelWrites / frameCount);
+  expectAtMost((int64_t)pixelWrites, 0, "drawPixel() calls of drawWatchFace()");
+
+#if !(METABALL_PRERENDER || METABALL_LAYER_CACHE || METABALL_FRAME_DIFF || METABALL_BANDED)
+  // The same frames written straight into the controller RAM.
+  int64_t directPixels = 0;
+  Watchy::display.pixelWrites = 0;
+
+  for (int i = 0; i < frameCount; ++i)
+  {
+    setFrameInput(watchy, i);
+    watchy.showWatchFaceDirect(true);
+    directPixels += countPixelDifferences(Watchy::display.epd2.ram, &frames[(size_t)i * frameSize], frameSize);
+  }
+
+  printf("direct        %lld pixels differ in the controller RAM, %.0f drawPixel/frame\n", (long long)directPixels,
+    (double)Watchy::display.pixelWrites / frameCount);
+  expectAtMost(directPixels, 0, "pixels of showWatchFaceDirect() differ in the controller RAM");
+#endif
+
+  if (dumpPath)
+  {
+    FILE* file = fopen(dumpPath, "wb");
+    if (!file)
+    {
+      fprintf(stderr, "cannot open %s\n", dumpPath);
+      return 1;
+    }
+
+    fwrite(frames.data(), 1, frames.size(), file);
+    fclose(file);
+  }
+
+  if (comparePath)
+  {
+    std::vector<uint8_t> reference(frames.size());
+    FILE* file = fopen(comparePath, "rb");
+    if (!file || fread(reference.data(), 1, reference.size(), file) != reference.size())
+    {
+      fprintf(stderr, "cannot read %d frames from %s\n", frameCount, comparePath);
+      return 1;
+    }
+    fclose(file);
+
+    int differentFrames = 0;
+    int64_t differentPixels = 0;
+    int worstFrame = 0;
+    int worstCount = 0;
+
+    for (int i = 0; i < frameCount; ++i)
+    {
+      int count = countPixelDifferences(&frames[(size_t)i * frameSize], &reference[(size_t)i * frameSize], frameSize);
+      differentPixels += count;
+
+      if (count > 0)
+        differentFrames++;
+
+      if (count > worstCount)
+      {
+        worstCount = count;
+        worstFrame = i;
+      }
+    }
+
+    printf("compare       %d/%d frames differ, %lld pixels total, worst frame %d (%d pixels)\n",
+      differentFrames, frameCount, (long long)differentPixels, worstFrame, worstCount);
+    expectAtMost(differentFrames, 0, "frames differ from the compared dump");
+  }
+
+  if (traversals)
+    benchTraversals(watchy, frameCount);
+
+  if (layers)
+    benchLayers(frameCount);
+
+  if (atlas)
+  {
+#if METABALL_SDF_ATLAS
+    benchAtlas(watchy, frameCount);
+#else
+    fprintf(stderr, "--atlas needs a build with -DMETABALL_SDF_ATLAS=2 or 4\n");
+    return 1;
+#endif
+  }
+
+  if (diff)
+    benchDiff(frameCount);
+
+  if (parallel)
+    benchParallel(watchy, frameCount);
+
+  if (bands)
+    benchBands(watchy, frameCount);
+
+  if (tables)
+    benchTables(watchy, frameCount);
+
+  if (dither)
+    benchDither(watchy, frameCount);
+
+  if (prerender)
+  {
+#if METABALL_PRERENDER
+    benchPrerender(watchy, frameCount);
+#else
+    fprintf(stderr, "--prerender needs a build with -DMETABALL_PRERENDER=1\n");
+    return 1;
+#endif
+  }
+
+  return failedChecks > 0 ? 1 : 0;
+}
@@ -0,0 +1,239 @@
+// Offline generator for the tileable blue noise masks in include/
+// (METABALL_NOISE_MASK), with the void-and-cluster method:
+//
+// A sparse random pattern is first relaxed by moving its tightest cluster
+// into its largest void until that no longer changes anything. Its points
+// are then ranked by removing the tightest cluster one at a time, and the
+// remaining pixels by filling the largest void one at a time. "Tight" and
+// "void" are the sum of a Gaussian of every set pixel, measured around the
+// torus, so the mask repeats without a seam. A pixel's rank scaled to 0..255
+// is its threshold; every level is used equally often, so a matcap value c
+// lights c / 256 of the pixels, as with BlueNoise200.
+//
+// The random start is seeded, so the same size always gives the same mask.
+//
+//   bluenoise [DIRECTORY [SIZE ...]]    (default include 16 32 64)
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Width of the Gaussian that spreads each point, in pixels. 1.5 is the value
+// the method was published with.
+const float SIGMA = 1.5f;
+
+// Share of pixels set in the initial pattern.
+const float INITIAL_DENSITY = 0.1f;
+
+struct Pattern
+{
+  int size;
+  std::vector<float> kernel;
+  std::vector<float> energy;
+  std::vector<uint8_t> set;
+};
+
+// Gaussian of the distance from (0, 0) to every pixel, the shorter way
+// around the torus.
+static std::vector<float> CreateKernel(int size)
+{
+  std::vector<float> kernel((size_t)size * size);
+
+  for (int y = 0; y < size; ++y)
+  {
+    for (int x = 0; x < size; ++x)
+    {
+      int dx = x < size / 2 ? x : size - x;
+      int dy = y < size / 2 ? y : size - y;
+      kernel[y * size + x] = expf(-(dx * dx + dy * dy) / (2.0f * SIGMA * SIGMA));
+    }
+  }
+
+  return kernel;
+}
+
+static void Toggle(Pattern& pattern, int pixel, bool set)
+{
+  int size = pattern.size;
+  int px = pixel % size;
+  int py = pixel / size;
+  float sign = set ? 1.0f : -1.0f;
+
+  pattern.set[pixel] = set;
+
+  for (int y = 0; y < size; ++y)
+  {
+    const float* row = &pattern.kernel[((y - py + size) % size) * size];
+
+    for (int x = 0; x < size; ++x)
+      pattern.energy[y * size + x] += sign * row[(x - px + size) % size];
+  }
+}
+
+// Set pixel with the most energy around it.
+static int FindTightestCluster(const Pattern& pattern)
+{
+  int best = -1;
+
+  for (int i = 0; i < (int)pattern.set.size(); ++i)
+  {
+    if (pattern.set[i] && (best < 0 || pattern.energy[i] > pattern.energy[best]))
+      best = i;
+  }
+
+  return best;
+}
+
+// Unset pixel with the least energy around it.
+static int FindLargestVoid(const Pattern& pattern)
+{
+  int best = -1;
+
+  for (int i = 0; i < (int)pattern.set.size(); ++i)
+  {
+    if (!pattern.set[i] && (best < 0 || pattern.energy[i] < pattern.energy[best]))
+      best = i;
+  }
+
+  return best;
+}
+
+static uint32_t NextRandom(uint32_t& state)
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static std::vector<uint8_t> CreateMask(int size)
+{
+  int pixels = size * size;
+  Pattern pattern;
+  pattern.size = size;
+  pattern.kernel = CreateKernel(size);
+  pattern.energy.assign(pixels, 0.0f);
+  pattern.set.assign(pixels, 0);
+
+  uint32_t random = 0x9E3779B9u ^ (uint32_t)size;
+  int points = std::max((int)(pixels * INITIAL_DENSITY), 1);
+
+  for (int placed = 0; placed < points;)
+  {
+    int pixel = NextRandom(random) % pixels;
+
+    if (pattern.set[pixel])
+      continue;
+
+    Toggle(pattern, pixel, true);
+    ++placed;
+  }
+
+  // Relax: move the tightest cluster into the largest void until the void
+  // it leaves is the largest one.
+  for (;;)
+  {
+    int cluster = FindTightestCluster(pattern);
+    Toggle(pattern, cluster, false);
+    int hole = FindLargestVoid(pattern);
+
+    if (hole == cluster)
+    {
+      Toggle(pattern, cluster, true);
+      break;
+    }
+
+    Toggle(pattern, hole, true);
+  }
+
+  std::vector<int> rank(pixels);
+  Pattern initial = pattern;
+
+  for (int i = points - 1; i >= 0; --i)
+  {
+    int cluster = FindTightestCluster(pattern);
+    Toggle(pattern, cluster, false);
+    rank[cluster] = i;
+  }
+
+  // Past half full, the largest void of the set pixels is also the tightest
+  // cluster of the unset ones, since the energies of both add up to the
+  // same total everywhere, so one rule ranks the rest.
+  pattern = initial;
+
+  for (int i = points; i < pixels; ++i)
+  {
+    int hole = FindLargestVoid(pattern);
+    Toggle(pattern, hole, true);
+    rank[hole] = i;
+  }
+
+  std::vector<uint8_t> mask(pixels);
+
+  for (int i = 0; i < pixels; ++i)
+    mask[i] = (uint8_t)((int64_t)rank[i] * 256 / pixels);
+
+  return mask;
+}
+
+static int WriteMask(const std::string& directory, int size)
+{
+  std::string name = "BlueNoise" + std::to_string(size);
+  std::string path = directory + "/" + name + ".h";
+  FILE* file = fopen(path.c_str(), "w");
+
+  if (!file)
+  {
+    fprintf(stderr, "cannot open %s\n", path.c_str());
+    return 1;
+  }
+
+  std::vector<uint8_t> mask = CreateMask(size);
+
+  fprintf(file, "// Generated by native/bluenoise (pio run -e bluenoise -t exec), do not edit.\n");
+  fprintf(file, "// %d x %d tileable void-and-cluster thresholds, row by row; see METABALL_NOISE_MASK.\n", size, size);
+  fprintf(file, "\nconst unsigned char %s[] PROGMEM = {\n", name.c_str());
+
+  for (int i = 0; i < size * size; ++i)
+    fprintf(file, "0x%02x, %s", mask[i], i % 16 == 15 ? "\n" : "");
+
+  fprintf(file, "};\n");
+  fclose(file);
+  printf("%s\n", path.c_str());
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  std::string directory = argc > 1 ? argv[1] : "include";
+  std::vector<int> sizes;
+
+  for (int i = 2; i < argc; ++i)
+  {
+    int size = atoi(argv[i]);
+
+    // The renderer wraps with a mask and reads 8 thresholds at a time.
+    if (size < 8 || size > 256 || (size & (size - 1)) != 0)
+    {
+      fprintf(stderr, "size %s is not a power of two from 8 to 256\n", argv[i]);
+      return 1;
+    }
+
+    sizes.push_back(size);
+  }
+
+  if (sizes.empty())
+    sizes = { 16, 32, 64 };
+
+  for (int size : sizes)
+  {
+    if (WriteMask(directory, size) != 0)
+      return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,264 @@
+// Replays a memory trace of the renderer (bench --trace, built with
+// METABALL_TRACE) through a model of the ESP32 flash cache and reports hit
+// rate and stall cycles per frame.
+//
+// The model is a set associative cache with LRU replacement in front of
+// flash: 32 KB, two ways and 32 byte lines by default, the way the ESP32
+// maps flash. MatCapSource and BlueNoise200 sit next to each other in flash
+// and go through it; with --ram-tables they are in internal RAM instead, as
+// with METABALL_RAM_TABLES, and cost nothing. The frame buffer is always in
+// internal RAM, so its reads are only counted. Code shares the cache with
+// the tables; --code-kb takes that much of it away from them. The cache is
+// flushed before every frame, as after deep sleep, unless --warm is given.
+// Which table layout a trace was recorded with (METABALL_TILED_TABLES) is
+// part of the trace, so layouts are compared by replaying two traces; a
+// METABALL_PACKED_TABLES or METABALL_MATCAP_FIT trace has to be replayed by a
+// cachesim built with it too, which places the noise after the smaller
+// matcap.
+//
+//   cachesim TRACE [--cache-kb N] [--ways N] [--line N] [--code-kb N]
+//                  [--miss-cycles N] [--ram-tables] [--warm]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <MetaBallTables.h>
+#include <MetaBallTrace.h>
+
+const double CPU_HZ = 240e6;
+
+struct CacheConfig
+{
+  int cacheBytes = 32 * 1024;
+  int codeBytes = 0;
+  int ways = 2;
+  int lineBytes = 32;
+  // Assumed: a 32 byte line from 80 MHz QIO flash takes about 100 flash
+  // clocks. Change it to match a measurement.
+  int missCycles = 300;
+  bool ramTables = false;
+  bool warm = false;
+};
+
+struct Cache
+{
+  int sets;
+  int ways;
+  int lineBytes;
+  // Tag of each way, most recently used first; -1 is empty.
+  std::vector<int64_t> tags;
+};
+
+struct FrameStats
+{
+  int64_t reads[TRACE_FRAME_END];
+  int64_t lookups;
+  int64_t misses[TRACE_FRAME_END];
+};
+
+static void FlushCache(Cache& cache)
+{
+  std::fill(cache.tags.begin(), cache.tags.end(), -1);
+}
+
+static Cache CreateCache(const CacheConfig& config)
+{
+  Cache cache;
+  cache.ways = config.ways;
+  cache.lineBytes = config.lineBytes;
+  cache.sets = std::max((config.cacheBytes - config.codeBytes) / (config.ways * config.lineBytes), 1);
+  cache.tags.resize((size_t)cache.sets * cache.ways);
+  FlushCache(cache);
+  return cache;
+}
+
+// Returns true on a hit and makes the line the most recently used of its set.
+static bool AccessLine(Cache& cache, int64_t line)
+{
+  int64_t* set = &cache.tags[(size_t)(line % cache.sets) * cache.ways];
+  int way = 0;
+
+  while (way < cache.ways && set[way] != line)
+    ++way;
+
+  bool hit = way < cache.ways;
+
+  if (!hit)
+    way = cache.ways - 1;
+
+  for (; way > 0; --way)
+    set[way] = set[way - 1];
+
+  set[0] = line;
+  return hit;
+}
+
+// Flash address of a table read; the noise follows the matcap.
+static int64_t GetFlashAddress(MetaBallTraceRegion region, uint32_t offset)
+{
+  return (region == TRACE_NOISE ? METABALL_MATCAP_BYTES : 0) + (int64_t)offset;
+}
+
+static void Replay(Cache& cache, const CacheConfig& config, uint32_t record, FrameStats& stats)
+{
+  MetaBallTraceRegion region = MetaBallTraceRecordRegion(record);
+  stats.reads[region]++;
+
+  if (region == TRACE_FRAME || config.ramTables)
+    return;
+
+  int64_t address = GetFlashAddress(region, MetaBallTraceRecordOffset(record));
+  int64_t first = address / cache.lineBytes;
+  int64_t last = (address + MetaBallTraceRecordSize(record) - 1) / cache.lineBytes;
+
+  for (int64_t line = first; line <= last; ++line)
+  {
+    stats.lookups++;
+
+    if (!AccessLine(cache, line))
+      stats.misses[region]++;
+  }
+}
+
+static double GetMean(const std::vector<double>& values)
+{
+  double sum = 0.0;
+
+  for (double value : values)
+    sum += value;
+
+  return values.empty() ? 0.0 : sum / values.size();
+}
+
+static double GetPercentile(std::vector<double> values, double p)
+{
+  if (values.empty())
+    return 0.0;
+
+  std::sort(values.begin(), values.end());
+  return values[std::min((size_t)(p * values.size()), values.size() - 1)];
+}
+
+static int Usage(const char* program)
+{
+  fprintf(stderr, "usage: %s TRACE [--cache-kb N] [--ways N] [--line N] [--code-kb N] [--miss-cycles N] [--ram-tables] [--warm]\n", program);
+  return 1;
+}
+
+int main(int argc, char** argv)
+{
+  const char* tracePath = nullptr;
+  CacheConfig config;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "--cache-kb") == 0 && i + 1 < argc)
+      config.cacheBytes = atoi(argv[++i]) * 1024;
+    else if (strcmp(argv[i], "--ways") == 0 && i + 1 < argc)
+      config.ways = std::max(atoi(argv[++i]), 1);
+    else if (strcmp(argv[i], "--line") == 0 && i + 1 < argc)
+      config.lineBytes = std::max(atoi(argv[++i]), 1);
+    else if (strcmp(argv[i], "--code-kb") == 0 && i + 1 < argc)
+      config.codeBytes = atoi(argv[++i]) * 1024;
+    else if (strcmp(argv[i], "--miss-cycles") == 0 && i + 1 < argc)
+      config.missCycles = atoi(argv[++i]);
+    else if (strcmp(argv[i], "--ram-tables") == 0)
+      config.ramTables = true;
+    else if (strcmp(argv[i], "--warm") == 0)
+      config.warm = true;
+    else if (!tracePath && argv[i][0] != '-')
+      tracePath = argv[i];
+    else
+      return Usage(argv[0]);
+  }
+
+  if (!tracePath)
+    return Usage(argv[0]);
+
+  FILE* file = fopen(tracePath, "rb");
+
+  if (!file)
+  {
+    fprintf(stderr, "cannot open %s\n", tracePath);
+    return 1;
+  }
+
+  Cache cache = CreateCache(config);
+  std::vector<FrameStats> frames;
+  FrameStats stats = {};
+  uint32_t records[4096];
+  size_t count;
+
+  while ((count = fread(records, sizeof(records[0]), sizeof(records) / sizeof(records[0]), file)) > 0)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (MetaBallTraceRecordRegion(records[i]) != TRACE_FRAME_END)
+      {
+        Replay(cache, config, records[i], stats);
+        continue;
+      }
+
+      frames.push_back(stats);
+      stats = FrameStats();
+
+      if (!config.warm)
+        FlushCache(cache);
+    }
+  }
+
+  fclose(file);
+
+  if (frames.empty())
+  {
+    fprintf(stderr, "%s holds no complete frame\n", tracePath);
+    return 1;
+  }
+
+  int64_t totalLookups = 0;
+  int64_t totalMisses = 0;
+  std::vector<double> misses;
+  std::vector<double> stalls;
+  double reads[TRACE_FRAME_END] = {};
+  double regionMisses[TRACE_FRAME_END] = {};
+
+  for (const FrameStats& frame : frames)
+  {
+    int64_t frameMisses = 0;
+
+    for (int region = 0; region < TRACE_FRAME_END; ++region)
+    {
+      reads[region] += frame.reads[region];
+      regionMisses[region] += frame.misses[region];
+      frameMisses += frame.misses[region];
+    }
+
+    totalLookups += frame.lookups;
+    totalMisses += frameMisses;
+    misses.push_back((double)frameMisses);
+    stalls.push_back((double)frameMisses * config.missCycles / CPU_HZ * 1e6);
+  }
+
+  double frameCount = (double)frames.size();
+
+  printf("frames          %d\n", (int)frames.size());
+  printf("cache           %d KB for tables (%d KB, %d KB code), %d ways, %d byte lines, %s\n",
+    std::max(config.cacheBytes - config.codeBytes, 0) / 1024, config.cacheBytes / 1024, config.codeBytes / 1024, config.ways,
+    config.lineBytes, config.warm ? "kept between frames" : "flushed every frame");
+  printf("tables          %s\n", config.ramTables ? "internal RAM" : "flash");
+  printf("reads/frame     matcap %.0f, noise %.0f, frame %.0f\n",
+    reads[TRACE_MATCAP] / frameCount, reads[TRACE_NOISE] / frameCount, reads[TRACE_FRAME] / frameCount);
+  printf("misses/frame    matcap %.0f, noise %.0f\n", regionMisses[TRACE_MATCAP] / frameCount, regionMisses[TRACE_NOISE] / frameCount);
+  if (totalLookups > 0)
+    printf("hit rate        %.2f%% of %.0f line lookups/frame\n", 100.0 * (totalLookups - totalMisses) / totalLookups, totalLookups / frameCount);
+  else
+    printf("hit rate        - (no flash reads)\n");
+  printf("stall [us]      mean %.1f, p99 %.1f, max %.1f (%d cycles a miss at %.0f MHz)\n",
+    GetMean(stalls), GetPercentile(stalls, 0.99), GetPercentile(stalls, 1.0), config.missCycles, CPU_HZ / 1e6);
+  printf("stall [cycles]  mean %.0f\n", GetMean(misses) * config.missCycles);
+  return 0;
+}
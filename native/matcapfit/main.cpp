@@ -0,0 +1,510 @@
+// Offline fitter for the matcap grids in include/ (METABALL_MATCAP_FIT).
+//
+// A grid of nodes every SPACING texels is fitted to MatCapSource so that
+// MetaBallSampleMatCapFit(), bilinear interpolation between the four nodes
+// around a texel, comes as close to the table as it can in the least squares
+// sense. Only texels a normal can reach count fully: the disk of radius 100
+// around the center the renderer maps normals into. The rest of the table
+// only keeps the nodes outside the disk from drifting.
+//
+// The error of each grid is printed after the nodes are rounded to bytes,
+// the way the renderer evaluates them.
+//
+// --compare writes nothing and prints the error of the grids next to the
+// global fits they were chosen over, all fitted to the same weighted texels:
+//
+// - least squares polynomials of the normal up to degree 12,
+// - a value per row plus a value per distance from the center,
+// - sums of 1 to 8 separable products row(v) * column(u).
+//
+// MatCapSource is a chrome sphere, a reflection with a sharp horizon rather
+// than smooth lighting, so the global fits do poorly for their size. A grid is
+// a piecewise polynomial whose coefficients follow the detail where it is.
+//
+//   matcapfit [DIRECTORY [SPACING ...]]    (default include 4 8)
+//   matcapfit --compare
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <MetaBallTables.h>
+
+#include "../../include/MatCapSource.h"
+
+// Weight of texels no normal reaches.
+const double OUTSIDE_WEIGHT = 1e-3;
+
+// Gauss-Seidel sweeps over the normal equations; the system is small and
+// diagonally dominant, so this is plenty.
+const int SWEEPS = 500;
+
+static bool IsReachable(int u, int v)
+{
+  int dx = u - 100;
+  int dy = v - 100;
+  return dx * dx + dy * dy <= 100 * 100;
+}
+
+static double GetWeight(int u, int v)
+{
+  return IsReachable(u, v) ? 1.0 : OUTSIDE_WEIGHT;
+}
+
+struct FitError
+{
+  double rms;
+  double mean;
+  int max;
+};
+
+// Error over reachable texels of a fitted table, each value clamped and
+// rounded to the byte the renderer would shade with.
+static FitError MeasureError(const std::vector<double>& table)
+{
+  double squares = 0.0;
+  double absolute = 0.0;
+  int worst = 0;
+  int texels = 0;
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+    {
+      if (!IsReachable(u, v))
+        continue;
+
+      int value = (int)lround(std::min(std::max(table[v * 200 + u], 0.0), 255.0));
+      int error = value - MatCapSource[v * 200 + u];
+      squares += error * error;
+      absolute += abs(error);
+      worst = std::max(worst, abs(error));
+      texels++;
+    }
+  }
+
+  FitError result = { sqrt(squares / texels), absolute / texels, worst };
+  return result;
+}
+
+// Bilinear weights of texel (u, v) on the four nodes around it, in the
+// order top left, top right, bottom left, bottom right.
+static void GetWeights(int spacing, int u, int v, int* nodes, double* weights)
+{
+  int stride = 199 / spacing + 2;
+  int i = u / spacing;
+  int j = v / spacing;
+  double fx = (double)(u % spacing) / spacing;
+  double fy = (double)(v % spacing) / spacing;
+
+  nodes[0] = j * stride + i;
+  nodes[1] = nodes[0] + 1;
+  nodes[2] = nodes[0] + stride;
+  nodes[3] = nodes[2] + 1;
+  weights[0] = (1.0 - fx) * (1.0 - fy);
+  weights[1] = fx * (1.0 - fy);
+  weights[2] = (1.0 - fx) * fy;
+  weights[3] = fx * fy;
+}
+
+static std::vector<uint8_t> FitGrid(int spacing)
+{
+  int stride = 199 / spacing + 2;
+  int count = stride * stride;
+
+  // Normal equations A x = b, A as a sparse list per row: each node only
+  // couples to the nodes it shares a cell with.
+  std::vector<std::vector<std::pair<int, double>>> a(count);
+  std::vector<double> b(count, 0.0);
+
+  auto add = [&](int row, int column, double value) {
+    for (std::pair<int, double>& entry : a[row])
+    {
+      if (entry.first == column)
+      {
+        entry.second += value;
+        return;
+      }
+    }
+
+    a[row].push_back(std::make_pair(column, value));
+  };
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+    {
+      int nodes[4];
+      double weights[4];
+      GetWeights(spacing, u, v, nodes, weights);
+      double weight = GetWeight(u, v);
+
+      for (int r = 0; r < 4; ++r)
+      {
+        b[nodes[r]] += weight * weights[r] * MatCapSource[v * 200 + u];
+
+        for (int c = 0; c < 4; ++c)
+          add(nodes[r], nodes[c], weight * weights[r] * weights[c]);
+      }
+    }
+  }
+
+  std::vector<double> x(count, 128.0);
+
+  for (int sweep = 0; sweep < SWEEPS; ++sweep)
+  {
+    for (int row = 0; row < count; ++row)
+    {
+      // A node no texel is interpolated from, past the end of the table.
+      if (a[row].empty())
+        continue;
+
+      double sum = b[row];
+      double diagonal = 0.0;
+
+      for (const std::pair<int, double>& entry : a[row])
+      {
+        if (entry.first == row)
+          diagonal = entry.second;
+        else
+          sum -= entry.second * x[entry.first];
+      }
+
+      x[row] = sum / diagonal;
+    }
+  }
+
+  std::vector<uint8_t> grid(count);
+
+  for (int i = 0; i < count; ++i)
+    grid[i] = (uint8_t)lround(std::min(std::max(x[i], 0.0), 255.0));
+
+  return grid;
+}
+
+static std::vector<double> GetGridTable(const std::vector<uint8_t>& grid, int spacing)
+{
+  std::vector<double> table(200 * 200);
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+      table[v * 200 + u] = MetaBallSampleMatCapFit(grid.data(), spacing, u, v);
+  }
+
+  return table;
+}
+
+// Solves the dense system a x = b in place by Gauss-Jordan elimination with
+// partial pivoting, leaving x in b.
+static void Solve(std::vector<double>& a, std::vector<double>& b, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    int pivot = i;
+
+    for (int row = i + 1; row < n; ++row)
+    {
+      if (fabs(a[row * n + i]) > fabs(a[pivot * n + i]))
+        pivot = row;
+    }
+
+    for (int column = 0; column < n; ++column)
+      std::swap(a[i * n + column], a[pivot * n + column]);
+
+    std::swap(b[i], b[pivot]);
+
+    for (int row = 0; row < n; ++row)
+    {
+      if (row == i)
+        continue;
+
+      double factor = a[row * n + i] / a[i * n + i];
+
+      for (int column = i; column < n; ++column)
+        a[row * n + column] -= factor * a[i * n + column];
+
+      b[row] -= factor * b[i];
+    }
+  }
+
+  for (int i = 0; i < n; ++i)
+    b[i] /= a[i * n + i];
+}
+
+// Monomials x^i y^j, i + j <= degree, of texel (u, v) mapped to [-1, 1].
+static std::vector<double> GetMonomials(int degree, int u, int v)
+{
+  double x = (u - 100) / 100.0;
+  double y = (v - 100) / 100.0;
+  std::vector<double> terms;
+
+  for (int i = 0; i <= degree; ++i)
+  {
+    for (int j = 0; j <= degree - i; ++j)
+      terms.push_back(pow(x, i) * pow(y, j));
+  }
+
+  return terms;
+}
+
+static std::vector<double> FitPolynomial(int degree, int& coefficients)
+{
+  coefficients = (degree + 1) * (degree + 2) / 2;
+  int n = coefficients;
+  std::vector<double> a(n * n, 0.0);
+  std::vector<double> b(n, 0.0);
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+    {
+      std::vector<double> terms = GetMonomials(degree, u, v);
+      double weight = GetWeight(u, v);
+
+      for (int r = 0; r < n; ++r)
+      {
+        b[r] += weight * terms[r] * MatCapSource[v * 200 + u];
+
+        for (int c = 0; c < n; ++c)
+          a[r * n + c] += weight * terms[r] * terms[c];
+      }
+    }
+  }
+
+  Solve(a, b, n);
+  std::vector<double> table(200 * 200);
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+    {
+      std::vector<double> terms = GetMonomials(degree, u, v);
+      double sum = 0.0;
+
+      for (int k = 0; k < n; ++k)
+        sum += b[k] * terms[k];
+
+      table[v * 200 + u] = sum;
+    }
+  }
+
+  return table;
+}
+
+static int GetRadius(int u, int v)
+{
+  return std::min((int)lround(hypot(u - 100, v - 100)), 141);
+}
+
+// row[v] + radial[distance from the center], by alternating the weighted
+// average of what is left of each given the other.
+static std::vector<double> FitRowRadial(int& values)
+{
+  const int RADII = 142;
+  std::vector<double> row(200, 0.0);
+  std::vector<double> radial(RADII, 0.0);
+  values = 200 + RADII;
+
+  for (int sweep = 0; sweep < 20; ++sweep)
+  {
+    std::vector<double> sums(RADII, 0.0);
+    std::vector<double> weights(RADII, 0.0);
+
+    for (int v = 0; v < 200; ++v)
+    {
+      for (int u = 0; u < 200; ++u)
+      {
+        int r = GetRadius(u, v);
+        sums[r] += GetWeight(u, v) * (MatCapSource[v * 200 + u] - row[v]);
+        weights[r] += GetWeight(u, v);
+      }
+    }
+
+    for (int r = 0; r < RADII; ++r)
+      radial[r] = sums[r] / weights[r];
+
+    for (int v = 0; v < 200; ++v)
+    {
+      double sum = 0.0;
+      double weight = 0.0;
+
+      for (int u = 0; u < 200; ++u)
+      {
+        sum += GetWeight(u, v) * (MatCapSource[v * 200 + u] - radial[GetRadius(u, v)]);
+        weight += GetWeight(u, v);
+      }
+
+      row[v] = sum / weight;
+    }
+  }
+
+  std::vector<double> table(200 * 200);
+
+  for (int v = 0; v < 200; ++v)
+  {
+    for (int u = 0; u < 200; ++u)
+      table[v * 200 + u] = row[v] + radial[GetRadius(u, v)];
+  }
+
+  return table;
+}
+
+// Sum of rank products row(v) * column(u), each fitted to what the previous
+// ones left by alternating weighted least squares.
+static std::vector<double> FitSeparable(int rank, int& values)
+{
+  std::vector<double> residual(MatCapSource, MatCapSource + 200 * 200);
+  std::vector<double> table(200 * 200, 0.0);
+  values = rank * 400;
+
+  for (int k = 0; k < rank; ++k)
+  {
+    std::vector<double> row(200, 1.0);
+    std::vector<double> column(200, 1.0);
+
+    for (int sweep = 0; sweep < 50; ++sweep)
+    {
+      for (int u = 0; u < 200; ++u)
+      {
+        double sum = 0.0;
+        double norm = 0.0;
+
+        for (int v = 0; v < 200; ++v)
+        {
+          sum += GetWeight(u, v) * residual[v * 200 + u] * row[v];
+          norm += GetWeight(u, v) * row[v] * row[v];
+        }
+
+        column[u] = sum / norm;
+      }
+
+      for (int v = 0; v < 200; ++v)
+      {
+        double sum = 0.0;
+        double norm = 0.0;
+
+        for (int u = 0; u < 200; ++u)
+        {
+          sum += GetWeight(u, v) * residual[v * 200 + u] * column[u];
+          norm += GetWeight(u, v) * column[u] * column[u];
+        }
+
+        row[v] = sum / norm;
+      }
+    }
+
+    for (int i = 0; i < 200 * 200; ++i)
+    {
+      double product = row[i / 200] * column[i % 200];
+      table[i] += product;
+      residual[i] -= product;
+    }
+  }
+
+  return table;
+}
+
+static void PrintError(const std::string& name, int values, const std::vector<double>& table)
+{
+  FitError error = MeasureError(table);
+  printf("%-22s %6d %6.1f %6.1f %4d\n", name.c_str(), values, error.rms, error.mean, error.max);
+}
+
+// Error table of the grids and the global fits, nothing is written.
+static void Compare()
+{
+  printf("%-22s %6s %6s %6s %4s\n", "fit", "values", "rms", "mean", "max");
+
+  for (int spacing : { 4, 8, 16 })
+  {
+    std::vector<uint8_t> grid = FitGrid(spacing);
+    PrintError("grid every " + std::to_string(spacing), (int)grid.size(), GetGridTable(grid, spacing));
+  }
+
+  for (int degree = 2; degree <= 12; degree += 2)
+  {
+    int values = 0;
+    std::vector<double> table = FitPolynomial(degree, values);
+    PrintError("polynomial degree " + std::to_string(degree), values, table);
+  }
+
+  int values = 0;
+  std::vector<double> table = FitRowRadial(values);
+  PrintError("row + radial", values, table);
+
+  for (int rank = 1; rank <= 8; ++rank)
+  {
+    table = FitSeparable(rank, values);
+    PrintError("separable rank " + std::to_string(rank), values, table);
+  }
+}
+
+static int WriteGrid(const std::string& directory, int spacing)
+{
+  std::string name = "MatCapFit" + std::to_string(spacing);
+  std::string path = directory + "/" + name + ".h";
+  FILE* file = fopen(path.c_str(), "w");
+
+  if (!file)
+  {
+    fprintf(stderr, "cannot open %s\n", path.c_str());
+    return 1;
+  }
+
+  std::vector<uint8_t> grid = FitGrid(spacing);
+  int stride = 199 / spacing + 2;
+  FitError error = MeasureError(GetGridTable(grid, spacing));
+
+  fprintf(file, "// Generated by native/matcapfit (pio run -e matcapfit -t exec), do not edit.\n");
+  fprintf(file, "// %d x %d matcap nodes every %d texels, row by row; see MetaBallSampleMatCapFit().\n", stride, stride, spacing);
+  fprintf(file, "\nconst unsigned char %s[] PROGMEM = {\n", name.c_str());
+
+  for (int i = 0; i < (int)grid.size(); ++i)
+    fprintf(file, "0x%02x, %s", grid[i], i % 16 == 15 ? "\n" : "");
+
+  fprintf(file, "%s};\n", grid.size() % 16 != 0 ? "\n" : "");
+  fclose(file);
+  printf("%s  %d bytes, error over reachable texels: rms %.1f, mean %.1f, max %d\n", path.c_str(), (int)grid.size(),
+    error.rms, error.mean, error.max);
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  if (argc > 1 && std::string(argv[1]) == "--compare")
+  {
+    Compare();
+    return 0;
+  }
+
+  std::string directory = argc > 1 ? argv[1] : "include";
+  std::vector<int> spacings;
+
+  for (int i = 2; i < argc; ++i)
+  {
+    int spacing = atoi(argv[i]);
+
+    // MetaBallSampleMatCapFit() splits texels with bit masks.
+    if (spacing < 2 || spacing > 64 || (spacing & (spacing - 1)) != 0)
+    {
+      fprintf(stderr, "spacing %s is not a power of two from 2 to 64\n", argv[i]);
+      return 1;
+    }
+
+    spacings.push_back(spacing);
+  }
+
+  if (spacings.empty())
+    spacings = { 4, 8 };
+
+  for (int spacing : spacings)
+  {
+    if (WriteGrid(directory, spacing) != 0)
+      return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+// Host-side stand-in for the Arduino core, just enough for the watch face to
+// compile in the [env:native] build.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __cplusplus
+#include <algorithm>
+using std::min;
+using std::max;
+#endif
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+#ifndef DEG_TO_RAD
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#endif
+
+#ifndef RAD_TO_DEG
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#endif
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
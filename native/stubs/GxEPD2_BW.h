@@ -0,0 +1,195 @@
+#pragma once
+
+// Host-side stand-in for the GxEPD2_BW display used by Watchy. Keeps the same
+// 1bpp buffer layout as the real driver (MSB first, set bit = white) so frames
+// can be dumped and compared bit for bit.
+
+#include <Arduino.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// Panel driver part of the display. The refresh is not simulated, the busy
+// callback is just run once per display() call as if the panel were busy.
+class GxEPD2_EPD_Native
+{
+public:
+  void setBusyCallback(void (*busyCallback)(const void*), const void* busy_callback_parameter = 0)
+  {
+    callback = busyCallback;
+    parameter = busy_callback_parameter;
+  }
+
+  void waitWhileBusy()
+  {
+    if (callback)
+      callback(parameter);
+  }
+
+  // Writes a bitmap (1bpp, MSB first, x and w whole bytes) straight into the
+  // controller RAM, bypassing the GxEPD2 buffer.
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+  {
+    int16_t byteWidth = w / 8;
+
+    for (int16_t j = 0; j < h; ++j)
+    {
+      for (int16_t i = 0; i < byteWidth; ++i)
+      {
+        uint8_t value = bitmap[j * byteWidth + i];
+        ram[(y + j) * (RAM_WIDTH / 8) + x / 8 + i] = invert ? ~value : value;
+      }
+    }
+
+    ramBytes += (uint32_t)byteWidth * h;
+  }
+
+  // Writes the same bitmap to the controller's previous-image RAM after a
+  // partial refresh; the stub keeps a single RAM, so it is a second write.
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+  {
+    writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+  }
+
+  // Writes the w x h part at (x_part, y_part) of a bitmap w_bitmap pixels
+  // wide to (x, y) in the controller RAM. Like GxEPD2, x and w are widened
+  // to whole bytes.
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+  {
+    int16_t byteWidth = (x % 8 + w + 7) / 8;
+    int16_t bitmapBytes = (w_bitmap + 7) / 8;
+
+    for (int16_t j = 0; j < h; ++j)
+    {
+      for (int16_t i = 0; i < byteWidth; ++i)
+      {
+        uint8_t value = bitmap[(y_part + j) * bitmapBytes + x_part / 8 + i];
+        ram[(y + j) * (RAM_WIDTH / 8) + x / 8 + i] = invert ? ~value : value;
+      }
+    }
+
+    ramBytes += (uint32_t)byteWidth * h;
+  }
+
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+  {
+    writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+  }
+
+  void refresh(bool partial_update_mode = false)
+  {
+    refreshes++;
+    waitWhileBusy();
+  }
+
+  // Partial refresh of a window of the panel.
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    refreshes++;
+    waitWhileBusy();
+  }
+
+  // Host only: controller RAM, the bytes written to it and the refreshes
+  // since reset.
+  static const int16_t RAM_WIDTH = 200;
+  static const int16_t RAM_HEIGHT = 200;
+  uint8_t ram[RAM_WIDTH / 8 * RAM_HEIGHT];
+  uint32_t ramBytes = 0;
+  uint32_t refreshes = 0;
+
+private:
+  void (*callback)(const void*) = nullptr;
+  const void* parameter = nullptr;
+};
+
+class GxEPD2_BW_Native
+{
+public:
+  static const int16_t WIDTH = 200;
+  static const int16_t HEIGHT = 200;
+  static const int32_t BUFFER_SIZE = WIDTH / 8 * HEIGHT;
+
+  int16_t width() const { return WIDTH; }
+  int16_t height() const { return HEIGHT; }
+
+  // The stub keeps the rotation but always draws at rotation 0.
+  void setRotation(uint8_t r) { rotation = r & 3; }
+  uint8_t getRotation() const { return rotation; }
+
+  void setFullWindow() {}
+
+  void fillScreen(uint16_t color)
+  {
+    memset(_buffer, color ? 0xFF : 0x00, sizeof(_buffer));
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+  {
+    for (int16_t j = 0; j < h; ++j)
+    {
+      for (int16_t i = 0; i < w; ++i)
+        drawPixel(x + i, y + j, color);
+    }
+  }
+
+  void setTextColor(uint16_t color) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color)
+  {
+    if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT)
+      return;
+
+    uint8_t& b = _buffer[y * (WIDTH / 8) + x / 8];
+    uint8_t mask = 1 << (7 - x % 8);
+
+    if (color)
+      b |= mask;
+    else
+      b &= ~mask;
+
+    pixelWrites++;
+  }
+
+  // Draws color wherever the bitmap has a cleared bit (1bpp, MSB first).
+  void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+  {
+    int16_t byteWidth = (w + 7) / 8;
+
+    for (int16_t j = 0; j < h; ++j)
+    {
+      for (int16_t i = 0; i < w; ++i)
+      {
+        if (!(pgm_read_byte(&bitmap[j * byteWidth + i / 8]) & (0x80 >> (i & 7))))
+          drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+
+  void display(bool partial_update_mode = false)
+  {
+    epd2.refresh(partial_update_mode);
+  }
+
+  // Partial refresh of a window of the buffer. GxEPD2 widens x and w to whole bytes.
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    windowPixels += (uint32_t)w * h;
+    epd2.writeImagePart(_buffer, x, y, WIDTH, HEIGHT, x, y, w, h);
+    epd2.refresh(x, y, w, h);
+    epd2.writeImagePartAgain(_buffer, x, y, WIDTH, HEIGHT, x, y, w, h);
+  }
+
+  GxEPD2_EPD_Native epd2;
+
+  // Host only: raw frame, the number of drawPixel calls and the pixels sent
+  // with displayWindow() since reset.
+  const uint8_t* getBuffer() const { return _buffer; }
+  uint32_t pixelWrites = 0;
+  uint32_t windowPixels = 0;
+
+private:
+  // Named and laid out like the private buffer of GxEPD2_BW with a full
+  // height page.
+  uint8_t _buffer[BUFFER_SIZE];
+  uint8_t rotation = 0;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+// Host-side stand-in for sqfmi/Watchy. Only the members a watch face touches
+// are provided; time and battery voltage are set directly by the host tool.
+
+#include <Arduino.h>
+#include <GxEPD2_BW.h>
+
+typedef struct
+{
+  uint8_t Second;
+  uint8_t Minute;
+  uint8_t Hour;
+  uint8_t Wday;
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year;
+} tmElements_t;
+
+typedef struct watchySettings
+{
+  const char* cityID;
+  const char* weatherAPIKey;
+  const char* weatherURL;
+  const char* weatherUnit;
+  const char* weatherLang;
+  int8_t weatherUpdateInterval;
+  const char* ntpServer;
+  int gmtOffset;
+  int dstOffset;
+} watchySettings;
+
+class Watchy
+{
+public:
+  static inline GxEPD2_BW_Native display;
+  tmElements_t currentTime = {};
+  watchySettings settings;
+
+  explicit Watchy(const watchySettings& s) : settings(s) {}
+  virtual ~Watchy() {}
+
+  float getBatteryVoltage() { return batteryVoltage; }
+
+  virtual void drawWatchFace() {}
+
+  // Host only: value returned by getBatteryVoltage().
+  static inline float batteryVoltage = 4.2f;
+};
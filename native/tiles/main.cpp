@@ -0,0 +1,274 @@
+// Offline generator for the glyph tables in include/:
+//
+// DigitTiles.h (METABALL_DIGIT_TILES) evaluates every digit on its own, once,
+// at NUMBER_SIZE and stores the classified result of each pixel around it:
+// the matcap texel for surface pixels, or a marker for outline and background
+// pixels. The renderer copies these tiles wherever a pixel is reached by a
+// single digit and falls back to the analytic blend where digits, the colon,
+// slash or battery line overlap.
+//
+// GlyphAtlas.h (METABALL_SDF_ATLAS) stores the signed distance field of every
+// digit, the colon and the slash every 2 and every 4 pixels, in the format
+// MetaBallAtlas.h describes.
+//
+// MatCapTiled.h and BlueNoiseTiled.h (METABALL_TILED_TABLES) hold
+// MatCapSource and BlueNoise200 reordered into 8 x 4 texel tiles of one
+// flash cache line each, at MetaBallTiledIndex(). MatCapPacked.h and
+// BlueNoisePacked.h (METABALL_PACKED_TABLES) hold them quantized to 4 bit
+// levels, two a byte, and the TiledPacked versions do both. The tiled
+// tables are not checked in, they measured as a loss.
+//
+//   tiles [DIRECTORY]    (default include)
+
+#include <math.h>
+#include <stdio.h>
+#include <string>
+
+#include <MetaBallRenderer.h>
+#include <MetaBallAtlas.h>
+#include <MetaBallTables.h>
+
+#include "../../include/MatCapSource.h"
+#include "../../include/BlueNoise200.h"
+
+// Glyphs are centered on a whole pixel at (GLYPH_CENTER_X, GLYPH_CENTER_Y)
+// of their box, the same as every slot on the face.
+const int DIGIT_TILE_WIDTH = MetaBallRenderer::GLYPH_WIDTH;
+const int DIGIT_TILE_HEIGHT = MetaBallRenderer::GLYPH_HEIGHT;
+const int DIGIT_TILE_CENTER_X = MetaBallRenderer::GLYPH_CENTER_X;
+const int DIGIT_TILE_CENTER_Y = MetaBallRenderer::GLYPH_CENTER_Y;
+
+// Where the digit sits while it is evaluated.
+const int REFERENCE_X = 100;
+const int REFERENCE_Y = 100;
+
+const uint8_t TILE_OUTLINE = 254;
+const uint8_t TILE_BACKGROUND = 255;
+
+static FILE* OpenOutput(const std::string& directory, const char* name)
+{
+  std::string path = directory + "/" + name;
+  FILE* file = fopen(path.c_str(), "w");
+
+  if (!file)
+    fprintf(stderr, "cannot open %s\n", path.c_str());
+
+  return file;
+}
+
+static int WriteDigitTiles(const std::string& directory)
+{
+  FILE* file = OpenOutput(directory, "DigitTiles.h");
+
+  if (!file)
+    return 1;
+
+  MetaBallRenderer renderer;
+
+  fprintf(file, "// Generated by native/tiles (pio run -e tiles -t exec), do not edit.\n");
+  fprintf(file, "// Ten digit tiles of %d x %d pixels, two bytes (u, v) per pixel, rows top to bottom.\n", DIGIT_TILE_WIDTH, DIGIT_TILE_HEIGHT);
+  fprintf(file, "// v = %d marks an outline pixel and v = %d a background pixel.\n\n", TILE_OUTLINE, TILE_BACKGROUND);
+  fprintf(file, "const int DIGIT_TILE_WIDTH = %d;\n", DIGIT_TILE_WIDTH);
+  fprintf(file, "const int DIGIT_TILE_HEIGHT = %d;\n", DIGIT_TILE_HEIGHT);
+  fprintf(file, "const int DIGIT_TILE_CENTER_X = %d;\n", DIGIT_TILE_CENTER_X);
+  fprintf(file, "const int DIGIT_TILE_CENTER_Y = %d;\n", DIGIT_TILE_CENTER_Y);
+  fprintf(file, "const unsigned char DIGIT_TILE_OUTLINE = %d;\n", TILE_OUTLINE);
+  fprintf(file, "const unsigned char DIGIT_TILE_BACKGROUND = %d;\n\n", TILE_BACKGROUND);
+  fprintf(file, "const unsigned char DigitTiles[] PROGMEM = {\n");
+
+  int written = 0;
+
+  for (int digit = 0; digit < 10; ++digit)
+  {
+    renderer.setGlyph(digit, REFERENCE_X, REFERENCE_Y);
+
+    // Tiles have to hold everything the digit can reach.
+    for (int i = 0; i < renderer.getPrimitiveCount(); ++i)
+    {
+      const MetaBallPrimitive& primitive = renderer.getPrimitives()[i];
+
+      if (primitive.minX < REFERENCE_X - DIGIT_TILE_CENTER_X || primitive.maxX >= REFERENCE_X - DIGIT_TILE_CENTER_X + DIGIT_TILE_WIDTH ||
+        primitive.minY < REFERENCE_Y - DIGIT_TILE_CENTER_Y || primitive.maxY >= REFERENCE_Y - DIGIT_TILE_CENTER_Y + DIGIT_TILE_HEIGHT)
+      {
+        fprintf(stderr, "digit %d does not fit its tile\n", digit);
+        fclose(file);
+        return 1;
+      }
+    }
+
+    for (int y = 0; y < DIGIT_TILE_HEIGHT; ++y)
+    {
+      for (int x = 0; x < DIGIT_TILE_WIDTH; ++x)
+      {
+        int16_t u = 0;
+        int16_t v = 0;
+        MetaBallShade shade = renderer.classifyPixel(REFERENCE_X - DIGIT_TILE_CENTER_X + x, REFERENCE_Y - DIGIT_TILE_CENTER_Y + y, u, v);
+
+        if (shade == SHADE_OUTLINE)
+          v = TILE_OUTLINE;
+        else if (shade == SHADE_BACKGROUND)
+          v = TILE_BACKGROUND;
+
+        fprintf(file, "0x%02x, 0x%02x, ", (uint8_t)u, (uint8_t)v);
+
+        if (++written % 8 == 0)
+          fprintf(file, "\n");
+      }
+    }
+  }
+
+  fprintf(file, "};\n");
+  fclose(file);
+  return 0;
+}
+
+static uint8_t QuantizeDistance(float distance)
+{
+  long value = lroundf(distance * ATLAS_DISTANCE_SCALE) + ATLAS_DISTANCE_ZERO;
+  return (uint8_t)(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+
+static int WriteGlyphAtlas(const std::string& directory)
+{
+  FILE* file = OpenOutput(directory, "GlyphAtlas.h");
+
+  if (!file)
+    return 1;
+
+  MetaBallRenderer renderer;
+
+  fprintf(file, "// Generated by native/tiles (pio run -e tiles -t exec), do not edit.\n");
+  fprintf(file, "// Signed distance fields of the digits, colon and slash; see MetaBallAtlas.h.\n\n");
+
+  fprintf(file, "const float GlyphAtlasRadius[] = {\n");
+
+  for (int glyph = 0; glyph < GLYPH_COUNT; ++glyph)
+  {
+    renderer.setGlyph(glyph, REFERENCE_X, REFERENCE_Y);
+    float deepest = 0.0f;
+
+    for (int y = 0; y < DIGIT_TILE_HEIGHT; ++y)
+    {
+      for (int x = 0; x < DIGIT_TILE_WIDTH; ++x)
+        deepest = fminf(deepest, renderer.getDistance(REFERENCE_X - DIGIT_TILE_CENTER_X + x, REFERENCE_Y - DIGIT_TILE_CENTER_Y + y, ATLAS_BLEND));
+    }
+
+    fprintf(file, "%.2ff, ", -deepest);
+  }
+
+  fprintf(file, "\n};\n");
+
+  const int scales[] = { 2, 4 };
+
+  for (int scale : scales)
+  {
+    int width = DIGIT_TILE_WIDTH / scale + 1;
+    int height = DIGIT_TILE_HEIGHT / scale + 1;
+    int written = 0;
+
+    fprintf(file, "\n// %d glyphs of %d x %d samples, one every %d pixels.\n", (int)GLYPH_COUNT, width, height, scale);
+    fprintf(file, "const unsigned char GlyphAtlas%d[] PROGMEM = {\n", scale);
+
+    for (int glyph = 0; glyph < GLYPH_COUNT; ++glyph)
+    {
+      renderer.setGlyph(glyph, REFERENCE_X, REFERENCE_Y);
+
+      for (int y = 0; y < height; ++y)
+      {
+        for (int x = 0; x < width; ++x)
+        {
+          float distance = renderer.getDistance(REFERENCE_X - DIGIT_TILE_CENTER_X + x * scale, REFERENCE_Y - DIGIT_TILE_CENTER_Y + y * scale, ATLAS_BLEND);
+          fprintf(file, "0x%02x, ", QuantizeDistance(distance));
+
+          if (++written % 16 == 0)
+            fprintf(file, "\n");
+        }
+      }
+    }
+
+    fprintf(file, "};\n");
+  }
+
+  fclose(file);
+  return 0;
+}
+
+// Writes a 200 x 200 table, reordered into tiles and/or packed into 4 bit
+// levels (quantize) as the renderer reads it with the matching options.
+static int WriteTable(const std::string& directory, const char* name, const uint8_t* source, bool tiled, uint8_t (*quantize)(uint8_t))
+{
+  std::string fileName = std::string(name) + ".h";
+  FILE* file = OpenOutput(directory, fileName.c_str());
+
+  if (!file)
+    return 1;
+
+  uint8_t texels[METABALL_TABLE_SIZE];
+
+  for (int y = 0; y < 200; ++y)
+  {
+    for (int x = 0; x < 200; ++x)
+      texels[tiled ? MetaBallTiledIndex(x, y) : y * 200 + x] = source[y * 200 + x];
+  }
+
+  int size = quantize ? METABALL_TABLE_SIZE / 2 : METABALL_TABLE_SIZE;
+  uint8_t bytes[METABALL_TABLE_SIZE];
+
+  for (int i = 0; i < size; ++i)
+    bytes[i] = quantize ? (quantize(texels[i * 2]) << 4) | quantize(texels[i * 2 + 1]) : texels[i];
+
+  fprintf(file, "// Generated by native/tiles (pio run -e tiles -t exec), do not edit.\n");
+
+  if (tiled)
+    fprintf(file, "// 200 x 200 texels in tiles of %d x %d, see MetaBallTiledIndex().\n", METABALL_TABLE_TILE_WIDTH, METABALL_TABLE_TILE_HEIGHT);
+  else
+    fprintf(file, "// 200 x 200 texels, row by row.\n");
+
+  if (quantize)
+    fprintf(file, "// Two 4 bit levels a byte, the first texel in the high nibble; see MetaBallTables.h.\n");
+
+  fprintf(file, "\nconst unsigned char %s[] PROGMEM = {\n", name);
+
+  for (int i = 0; i < size; ++i)
+    fprintf(file, "0x%02x, %s", bytes[i], i % 16 == 15 ? "\n" : "");
+
+  fprintf(file, "};\n");
+  fclose(file);
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  std::string directory = argc > 1 ? argv[1] : "include";
+
+  if (WriteDigitTiles(directory) != 0)
+    return 1;
+
+  if (WriteGlyphAtlas(directory) != 0)
+    return 1;
+
+  struct Table
+  {
+    const char* name;
+    const uint8_t* source;
+    bool tiled;
+    uint8_t (*quantize)(uint8_t);
+  };
+
+  const Table tables[] = {
+    { "MatCapTiled", MatCapSource, true, nullptr },
+    { "BlueNoiseTiled", BlueNoise200, true, nullptr },
+    { "MatCapPacked", MatCapSource, false, MetaBallQuantizeMatCap },
+    { "BlueNoisePacked", BlueNoise200, false, MetaBallQuantizeNoise },
+    { "MatCapTiledPacked", MatCapSource, true, MetaBallQuantizeMatCap },
+    { "BlueNoiseTiledPacked", BlueNoise200, true, MetaBallQuantizeNoise },
+  };
+
+  for (const Table& table : tables)
+  {
+    if (WriteTable(directory, table.name, table.source, table.tiled, table.quantize) != 0)
+      return 1;
+  }
+
+  return 0;
+}
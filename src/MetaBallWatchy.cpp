@@ -1,5 +1,18 @@
 #include "MetaBallWatchy.h"
-#include <VectorXf.h>
+#include <MetaBallFrameDiff.h>
+
+#include <MetaBallBandTransfer.h>
+#include <MetaBallTables.h>
+
+#if METABALL_PRERENDER && defined(ARDUINO_ARCH_ESP32)
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
+
+#if METABALL_BANDED && defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 const float VOLTAGE_MIN = 3.5;
 const float VOLTAGE_MAX = 4.2;
@@ -8,26 +21,15 @@ const float VOLTAGE_RANGE = VOLTAGE_MAX - VOLTAGE_MIN;
 
 MetaBallWatchy::MetaBallWatchy(const watchySettings& s) : Watchy(s)
 {
+#if METABALL_RAM_TABLES
+  // The watch face object is built on every wake from deep sleep.
+  MetaBallLoadTables();
+#endif
   //Serial.begin(115200);
 //while (!Serial); // wait for serial port to connect. Needed for native USB port on Arduino only
 
 }
 
-static bool getColor(const int16_t& x, const int16_t& y, const uint16_t& color) 
-{
-  return color > BlueNoise200[y * 200 + x];
-}
-
-static bool getColor2(int16_t x, int16_t y, int16_t xUv, int16_t yUv, const uint8_t *bitmap, int16_t w, int16_t h) 
-{
-  return getColor(x, y, bitmap[yUv * w + xUv]);
-}
-
-static bool getColor3(const int16_t& x, const int16_t& y, const int16_t& xUv, const int16_t& yUv, const uint8_t *bitmap, const int16_t& w, const int16_t& h) 
-{
-  return getColor(x,y,bitmap[yUv * w + xUv]);
-}
-
 static float clamp(float val, const float& min, const float& max)
 {
   if (val > max)
@@ -48,522 +50,416 @@ float MetaBallWatchy::getBatteryFill()
   return clamp(batState, 0.0f, 1.0f);
 }
 
-static float unlerp(const float& value, const float& min, const float& max) {
-  return (value - min) / (max - min);
-}
+// GxEPD2_BW<GxEPD2_154_D67, ...> on the watch, the stubs on the host.
+typedef decltype(Watchy::display) Display;
+typedef decltype(Watchy::display.epd2) DisplayDriver;
 
-static float smoothstep(const float& x) {
-  // Evaluate polynomial
-  return x * x * (3 - 2 * x);
-}
+// GxEPD2 keeps its page buffer private and offers only drawPixel() to fill
+// it. An explicit instantiation may name a private member, so this one hands
+// out the buffer; it fails to compile if the buffer is not one frame.
+static uint8_t* getDisplayBuffer(Display& display);
 
-static Vec2f ClosestPointOnSegment(const Vec2f& s1, const Vec2f& s2, const Vec2f& p, float& unlerp)
+template <uint8_t (Display::*Buffer)[MetaBallRenderer::FRAME_SIZE]>
+struct DisplayBufferAccess
 {
-  Vec2f difference = s2 - s1;
-  float sqrMagnitude = difference.lengthSquared();
+  friend uint8_t* getDisplayBuffer(Display& display) { return display.*Buffer; }
+};
 
-  if (sqrMagnitude > 0.0f)
-    unlerp = (p - s1).dot(difference) / sqrMagnitude;
-  else
-    unlerp = 0.0f;
+template struct DisplayBufferAccess<&Display::_buffer>;
 
-  unlerp = clamp(unlerp, 0.0f, 1.0f);
-  return s1 + difference * unlerp;
+// Puts rows of a frame into the display buffer. In the full window
+// showWatchFace() sets and at rotation 0 the buffer has the frame's layout,
+// so they are copied; other rotations draw the black pixels one by one.
+static void drawFrameRows(Display& display, const uint8_t* rows, int y, int rowCount)
+{
+  if (display.getRotation() == 0)
+  {
+    memcpy(getDisplayBuffer(display) + y * MetaBallRenderer::ROW_BYTES, rows, rowCount * MetaBallRenderer::ROW_BYTES);
+    return;
+  }
+
+  display.fillRect(0, y, MetaBallRenderer::WIDTH, rowCount, GxEPD_WHITE);
+  display.drawInvertedBitmap(0, y, rows, MetaBallRenderer::WIDTH, rowCount, GxEPD_BLACK);
 }
 
-static Vec2f ClosestPointOnSegment(const Vec2f& s1, const Vec2f& s2, const Vec2f& p)
+#if !METABALL_BANDED
+
+static void drawFrame(Display& display, const uint8_t* frame)
 {
-  float unlerp = 0.0f;
-  return ClosestPointOnSegment(s1, s2, p, unlerp);
+  drawFrameRows(display, frame, 0, MetaBallRenderer::HEIGHT);
 }
 
-static Vec2f getPerpendicular(Vec2f vector) {
-	return Vec2f( -vector.y, vector.x );
-}
+#endif
 
-static Vec2f ClosestPointOnArc(const Vec2f& center, const Vec2f& start, const Vec2f& end, const float& radius, const float& angleStart, const float& angle, const Vec2f& p)
+static MetaBallFace getFace(const tmElements_t& time, float battery)
 {
-  Vec2f diff = p - center;
+  MetaBallFace face;
+  face.hour = time.Hour;
+  face.minute = time.Minute;
+  face.month = time.Month;
+  face.day = time.Day;
+  face.battery = battery;
+  return face;
+}
 
-  bool over180 = angle > 180;
+#if METABALL_PRERENDER || METABALL_LAYER_CACHE
 
-  Vec2f startPerpendicular = getPerpendicular(start);
-  Vec2f endPerpendicular = -getPerpendicular(end);
-  float startPrependicularDot = startPerpendicular.dot(diff);
-  float endPrependicularDot = endPerpendicular.dot(diff);
+// Battery fill rounded to the steps a cached frame is keyed by.
+static uint8_t getBatteryLevel(float fill)
+{
+  return lroundf(fill * (METABALL_BATTERY_LEVELS - 1));
+}
 
-  bool isPointOnArc = !over180 && (startPrependicularDot >= 0.0f && endPrependicularDot >= 0.0f) || over180 && !(startPrependicularDot < 0.0f && endPrependicularDot < 0.0f);
+static float getLevelFill(uint8_t level)
+{
+  return level / (float)(METABALL_BATTERY_LEVELS - 1);
+}
 
-  if (isPointOnArc)
-    return center + diff.getNormalized() * radius;
+#endif
 
-  if (startPrependicularDot < endPrependicularDot)
-    return center + end * radius;
-  
-  return center + start * radius;
-}
+#if METABALL_LAYER_CACHE || METABALL_FRAME_DIFF
 
-static void MetaBall(const Vec2f& currentPos, const Vec2f& circleCenter, const float& radius, const float& extraRadius, int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+// Writes every window of the frame into the controller RAM and refreshes the
+// panel once over all of them; displayWindow() would refresh once a window.
+// As in displayWindow(), the differential update needs the windows in the
+// previous-image RAM as well afterwards.
+static void showWindows(const uint8_t* frame, const MetaBallRect* windows, int windowCount)
 {
-  Vec2f offset = currentPos - circleCenter;
-  float totalRadius = radius + extraRadius;
-  float lengthSqr = offset.lengthSquared();
-
-  if (lengthSqr >= totalRadius * totalRadius)
+  if (windowCount == 0)
     return;
 
-  float radiusSqr = radius * radius;
-  float newDistance = 0.0f;
-  
-  count++;
+  MetaBallRect bounds = windows[0];
 
-  if (lengthSqr < radiusSqr)
+  for (int i = 0; i < windowCount; ++i)
   {
-    if (count > 1)
-      newDistance = sqrt(radiusSqr - lengthSqr) + extraRadius;
-    else
-      newDistance = 1.0f + extraRadius;
-  }
-  else
-  {
-    float distance = sqrtf(lengthSqr);
-    newDistance = totalRadius - distance;
-    newDistance = smoothstep(unlerp(newDistance, 0, extraRadius) * 0.5f) * 2.0f * extraRadius;
+    const MetaBallRect& window = windows[i];
+    Watchy::display.epd2.writeImagePart(frame, window.x0, window.y0, MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT, window.x0, window.y0, window.x1 - window.x0 + 1, window.y1 - window.y0 + 1);
+
+    bounds.x0 = min(bounds.x0, window.x0);
+    bounds.y0 = min(bounds.y0, window.y0);
+    bounds.x1 = max(bounds.x1, window.x1);
+    bounds.y1 = max(bounds.y1, window.y1);
   }
 
-  if (count == 1)
+  Watchy::display.epd2.refresh(bounds.x0, bounds.y0, bounds.x1 - bounds.x0 + 1, bounds.y1 - bounds.y0 + 1);
+
+  for (int i = 0; i < windowCount; ++i)
   {
-    prevRadius = radius;
-    prevCenter = circleCenter;
-    totalDistance = newDistance;
-    return;
+    const MetaBallRect& window = windows[i];
+    Watchy::display.epd2.writeImagePartAgain(frame, window.x0, window.y0, MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT, window.x0, window.y0, window.x1 - window.x0 + 1, window.y1 - window.y0 + 1);
   }
-  else if (count == 2)
-  {
-    Vec2f offsetPrev = currentPos - prevCenter;
-    float lengthPrevSqr = offsetPrev.lengthSquared();
-  
-    float radiusPrevSqr = prevRadius * prevRadius;
+}
 
-    if (lengthPrevSqr < radiusPrevSqr)
-    {
-      totalDistance = sqrt(radiusPrevSqr - lengthPrevSqr) + extraRadius;
-    }
-  }
+#endif
 
-  Vec2f offsetBetweenCenters = circleCenter - prevCenter;
-  Vec2f offsetBetweenCentersNormalized = offsetBetweenCenters.getNormalized();
+#if METABALL_PRERENDER
 
-  float weight = 0.0f;
-  ClosestPointOnSegment(circleCenter - offsetBetweenCentersNormalized * totalRadius, prevCenter + offsetBetweenCentersNormalized * (prevRadius + extraRadius), currentPos, weight);
-  
-  float otherWeight = 1.0f - weight;
-  Vec2f newCenter = circleCenter * weight + prevCenter * otherWeight;
-  prevCenter = newCenter;
-  
-  totalDistance += newDistance;
-  Vec3f pointOnSurface (currentPos.x, currentPos.y, totalDistance);
-  Vec3f centerV3 (newCenter.x, newCenter.y, extraRadius);
-  
-  prevRadius = (pointOnSurface - centerV3).length();
-}
+static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
 
-static void Arc(const Vec2f& currentPos, const Vec2f& center, const Vec2f& start, const Vec2f& end, const float& radius, const float& extraRadius,
- const float& arcRadius, const float& arcStartAngle, const float& arcAngle,
-  int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+// Everything a frame depends on. A pre-rendered frame is used whenever the
+// wake produces the same key, no matter what woke the watch, so a date
+// rollover, a new battery step or setting the time just miss the cache.
+struct PrerenderKey
 {
-  Vec2f offset = currentPos - center;
-  float outterRadius = radius + extraRadius + arcRadius;
+  uint8_t valid;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t month;
+  uint8_t day;
+  uint8_t battery;
+};
 
-  float lengthSquared = offset.lengthSquared();
-
-  if (lengthSquared >= outterRadius * outterRadius)
-    return;
-    
-  float innerRadius = arcRadius - radius - extraRadius;
+// RTC slow memory survives deep sleep and is cleared on power up.
+RTC_DATA_ATTR static PrerenderKey prerenderedKey;
+RTC_DATA_ATTR static uint8_t prerenderedFrame[MetaBallRenderer::FRAME_SIZE];
 
-  if (innerRadius > 0.0f && lengthSquared <= innerRadius * innerRadius)
-    return;
+static PrerenderKey nextKey;
 
-  Vec2f closestToArc = ClosestPointOnArc(center, start, end, arcRadius, arcStartAngle, arcAngle, currentPos);
-  MetaBall(currentPos, closestToArc, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+static bool isSameKey(const PrerenderKey& a, const PrerenderKey& b)
+{
+  return a.valid && b.valid && a.hour == b.hour && a.minute == b.minute && a.month == b.month && a.day == b.day && a.battery == b.battery;
 }
 
-const float RADIUS_PERCENTAGE = 0.2f;
-const float HALF_OFFSET = (0.5f - RADIUS_PERCENTAGE);
-const float OFFSET = (1.0f - RADIUS_PERCENTAGE);
-
-static void Draw0(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
- int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+static MetaBallFace getFace(const PrerenderKey& key)
 {
-  float radius = size * 0.5f;
-  Vec2f s1 = center + Vec2f(0.0f, radius);
-  Vec2f s2 = center + Vec2f(0.0f, -radius);
-
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  tmElements_t time = {};
+  time.Hour = key.hour;
+  time.Minute = key.minute;
+  time.Month = key.month;
+  time.Day = key.day;
+  return getFace(time, getLevelFill(key.battery));
 }
 
-static void Draw1(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+// Moves the key one minute on. Returns false at midnight, the date is not
+// advanced here so the first frame of a day is always rendered on wake.
+static bool getNextMinute(PrerenderKey& key)
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
-  Vec2f s2 = center + Vec2f(size * HALF_OFFSET, size * OFFSET);
-  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, -size * 0.2f);
+  if (++key.minute < 60)
+    return true;
 
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  closestPoint = ClosestPointOnSegment(s1, s3, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  key.minute = 0;
+  return ++key.hour < 24;
 }
 
-const float DRAW_2_ARC_START_ANGLE = 180.0f;
-const Vec2f DRAW_2_ARC_START = Vec2f(cos(DRAW_2_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_2_ARC_START_ANGLE * DEG_TO_RAD));
-
-const float DRAW_2_ARC_END_ANGLE = 198.0f;
-const float DRAW_2_ARC_END_ANGLE_SUM = DRAW_2_ARC_START_ANGLE + DRAW_2_ARC_END_ANGLE;
-const Vec2f DRAW_2_ARC_END = Vec2f(cos(DRAW_2_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_2_ARC_END_ANGLE_SUM * DEG_TO_RAD));
-
-static void Draw2(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+static void waitWhileDisplayBusy()
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f arcCenter = center + Vec2f(0.0f, -size * 0.5f);
-  Vec2f s2 = center + Vec2f(size * 0.2f, -size * 0.2f);
-  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
-  Vec2f s4 = center + Vec2f(size * HALF_OFFSET, size * OFFSET);
-
-  if (currentPos.y < arcCenter.y + DRAW_2_ARC_END.y * size * HALF_OFFSET + radius + extraRadius)
-    Arc(currentPos, arcCenter, DRAW_2_ARC_START, DRAW_2_ARC_END, radius, extraRadius, size * HALF_OFFSET,
-    DRAW_2_ARC_START_ANGLE, DRAW_2_ARC_END_ANGLE, count, totalDistance, prevRadius, prevCenter);
-
-  Vec2f closestPoint = ClosestPointOnSegment(s2, s3, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  closestPoint = ClosestPointOnSegment(s3, s4, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+#ifdef ARDUINO_ARCH_ESP32
+  // Light sleep until the panel is done, like Watchy's own busy callback that this one replaces.
+  gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_light_sleep_start();
+#endif
 }
 
+// Runs while display() waits for the panel refresh. The first call renders
+// the next minute, later ones just wait.
+void MetaBallWatchy::prerenderNextMinute(const void* watchy)
+{
+  MetaBallWatchy* self = (MetaBallWatchy*)watchy;
 
-const float DRAW_3_ARC_START_ANGLE = 240.0f;
-const Vec2f DRAW_3_ARC_START = Vec2f(cos(DRAW_3_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_3_ARC_START_ANGLE * DEG_TO_RAD));
-
-const float DRAW_3_ARC_END_ANGLE = 200.0f;
-const float DRAW_3_ARC_END_ANGLE_SUM = DRAW_3_ARC_START_ANGLE + DRAW_3_ARC_END_ANGLE;
-const Vec2f DRAW_3_ARC_END = Vec2f(cos(DRAW_3_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_3_ARC_END_ANGLE_SUM * DEG_TO_RAD));
-
-const float DRAW_3_2_ARC_START_ANGLE = 280.0f;
-const Vec2f DRAW_3_2_ARC_START = Vec2f(cos(DRAW_3_2_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_3_2_ARC_START_ANGLE * DEG_TO_RAD));
-
-const float DRAW_3_2_ARC_END_ANGLE = 200.0f;
-const float DRAW_3_2_ARC_END_ANGLE_SUM = DRAW_3_2_ARC_START_ANGLE + DRAW_3_2_ARC_END_ANGLE;
-const Vec2f DRAW_3_2_ARC_END = Vec2f(cos(DRAW_3_2_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_3_2_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+  if (!self->prerenderPending)
+  {
+    waitWhileDisplayBusy();
+    return;
+  }
 
-static void Draw3(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
-{
-  float radius = size * RADIUS_PERCENTAGE;
-  
-  Arc(currentPos, center + Vec2f(-size * 0.1f, -size * 0.4f), DRAW_3_ARC_START, DRAW_3_ARC_END, radius, extraRadius, size * (HALF_OFFSET + 0.1f),
-   DRAW_3_ARC_START_ANGLE, DRAW_3_ARC_END_ANGLE, count, totalDistance, prevRadius, prevCenter);
-  
-  Arc(currentPos, center + Vec2f(-size * 0.1f, size * 0.4f), DRAW_3_2_ARC_START, DRAW_3_2_ARC_END, radius, extraRadius, size * (HALF_OFFSET + 0.1f),
-   DRAW_3_2_ARC_START_ANGLE, DRAW_3_2_ARC_END_ANGLE, count, totalDistance, prevRadius, prevCenter);
+  self->prerenderPending = false;
+  prerenderedKey.valid = 0;
+  self->renderer.render(getFace(nextKey), prerenderedFrame);
+  prerenderedKey = nextKey;
 }
 
-static void Draw4(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+void MetaBallWatchy::drawWatchFace()
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(0.0f, -size * OFFSET);
-  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, size * 0.2f);
-  Vec2f s3 = center + Vec2f(size * HALF_OFFSET, size * 0.2f);
-  Vec2f s4 = center + Vec2f(size * 0.3f, 0.0f);
-  Vec2f s5 = center + Vec2f(size * 0.1f, size * OFFSET);
+  PrerenderKey key;
+  key.valid = 1;
+  key.hour = currentTime.Hour;
+  key.minute = currentTime.Minute;
+  key.month = currentTime.Month;
+  key.day = currentTime.Day;
+  key.battery = getBatteryLevel(getBatteryFill());
 
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  prerenderHit = isSameKey(key, prerenderedKey);
 
-  closestPoint = ClosestPointOnSegment(s2, s3, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  if (!prerenderHit)
+    renderer.render(getFace(key), frame);
 
-  closestPoint = ClosestPointOnSegment(s4, s5, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  nextKey = key;
+  prerenderPending = getNextMinute(nextKey) && !isSameKey(nextKey, prerenderedKey);
+  display.epd2.setBusyCallback(prerenderNextMinute, this);
+
+  drawFrame(display, prerenderHit ? prerenderedFrame : frame);
 }
 
-const float DRAW_5_ARC_START_ANGLE = 235.0f;
-const Vec2f DRAW_5_ARC_START = Vec2f(cos(DRAW_5_ARC_START_ANGLE * DEG_TO_RAD), sin(DRAW_5_ARC_START_ANGLE * DEG_TO_RAD));
+#elif METABALL_LAYER_CACHE
 
-const float DRAW_5_ARC_END_ANGLE = 250.0f;
-const float DRAW_5_ARC_END_ANGLE_SUM = DRAW_5_ARC_START_ANGLE + DRAW_5_ARC_END_ANGLE;
-const Vec2f DRAW_5_ARC_END = Vec2f(cos(DRAW_5_ARC_END_ANGLE_SUM * DEG_TO_RAD), sin(DRAW_5_ARC_END_ANGLE_SUM * DEG_TO_RAD));
+// The last frame and what it shows, kept through deep sleep so a minute tick
+// only redraws the layers that changed.
+RTC_DATA_ATTR static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+RTC_DATA_ATTR static MetaBallLayerCache layerCache;
 
-static void Draw5(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+void MetaBallWatchy::drawWatchFace()
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
-  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, -size * OFFSET);
-  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, 0.0f);
+  // The battery is rounded to a level so it does not redraw every wake.
+  renderer.renderLayers(getFace(currentTime, getLevelFill(getBatteryLevel(getBatteryFill()))), frame, layerCache);
 
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  closestPoint = ClosestPointOnSegment(s2, s3, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-
-  Arc(currentPos, center + Vec2f(-size * 0.1f, size * 0.4f), DRAW_5_ARC_START, DRAW_5_ARC_END, radius, extraRadius, size * (HALF_OFFSET + 0.1f),
-   DRAW_5_ARC_START_ANGLE, DRAW_5_ARC_END_ANGLE, count, totalDistance, prevRadius, prevCenter);
+  drawFrame(display, frame);
 }
 
-static void Draw6(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+void MetaBallWatchy::showWatchFaceWindows()
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
-  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET * 0.5f, size * 0.35f * 0.4f);
-  Vec2f s3 = center + Vec2f(0.0f, size * 0.5f);
-
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  MetaBall(currentPos, s3, size * 0.5f, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  drawWatchFace();
+  showWindows(frame, renderer.getDirtyWindows(), renderer.getDirtyWindowCount());
 }
 
-static void Draw7(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
-{
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(size * HALF_OFFSET, -size * OFFSET);
-  Vec2f s2 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
-  Vec2f s3 = center + Vec2f(-size * HALF_OFFSET, -size * OFFSET);
+#elif METABALL_FRAME_DIFF
 
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  closestPoint = ClosestPointOnSegment(s1, s3, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-}
+static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+
+// The frame last handed to the display, kept through deep sleep.
+RTC_DATA_ATTR static uint8_t pushedFrame[MetaBallRenderer::FRAME_SIZE];
+RTC_DATA_ATTR static bool pushedFrameValid;
 
-static void Draw8(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+void MetaBallWatchy::drawWatchFace()
 {
-  Vec2f s1 = center + Vec2f(0.0f, -size * 0.6f);
-  Vec2f s2 = center + Vec2f(0.0f, size * 0.5f);
-  Vec2f s3 = center + Vec2f(0.0f, size * 0.2f);
+  renderer.render(getFace(currentTime, getBatteryFill()), frame);
 
-  MetaBall(currentPos, s1, size * 0.4f, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  Vec2f closestPoint = ClosestPointOnSegment(s2, s3, currentPos);
-  MetaBall(currentPos, closestPoint, size * 0.5f, extraRadius, count, totalDistance,prevRadius, prevCenter);
+  if (pushedFrameValid)
+    windowCount = MetaBallDiffFrames(pushedFrame, frame, windows, METABALL_DIFF_WINDOWS);
+  else
+  {
+    MetaBallRect screen = { 0, 0, MetaBallRenderer::WIDTH - 1, MetaBallRenderer::HEIGHT - 1 };
+    windows[0] = screen;
+    windowCount = 1;
+  }
+
+  memcpy(pushedFrame, frame, sizeof(frame));
+  pushedFrameValid = true;
+
+  drawFrame(display, frame);
 }
 
-static void Draw9(const Vec2f& currentPos, const Vec2f& center, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+void MetaBallWatchy::showWatchFaceWindows()
 {
-  float radius = size * RADIUS_PERCENTAGE;
-  Vec2f s1 = center + Vec2f(-size * HALF_OFFSET, size * OFFSET);
-  Vec2f s2 = center + Vec2f(size * HALF_OFFSET * 0.5f, -size * 0.35f * 0.4f);
-  Vec2f s3 = center + Vec2f(0.0f, -size * 0.5f);
-
-  Vec2f closestPoint = ClosestPointOnSegment(s1, s2, currentPos);
-  MetaBall(currentPos, closestPoint, radius, extraRadius, count, totalDistance, prevRadius, prevCenter);
-  
-  MetaBall(currentPos, s3, size * 0.5f, extraRadius, count, totalDistance, prevRadius, prevCenter);
+  drawWatchFace();
+  showWindows(frame, windows, windowCount);
 }
 
-static void DrawDigit(const Vec2f& currentPos, const Vec2f& center, const int& digit, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+#elif METABALL_BANDED
+
+// Two bands instead of a whole frame.
+static uint8_t bands[2 * METABALL_BAND_ROWS * MetaBallRenderer::ROW_BYTES];
+
+// Copies each band into the GxEPD2 buffer as it is finished.
+class BufferBandTransfer : public MetaBallBandTransfer
 {
-  switch (digit)
+public:
+  explicit BufferBandTransfer(Display& display) : display(display) {}
+
+  void send(const uint8_t* rows, int y, int rowCount)
   {
-  case 0:
-    Draw0(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 1:
-    Draw1(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 2:
-    Draw2(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 3:
-    Draw3(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 4:
-    Draw4(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 5:
-    Draw5(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 6:
-    Draw6(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 7:
-    Draw7(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 8:
-    Draw8(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-    
-  case 9:
-    Draw9(currentPos, center, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
-    break;
-  
-  default:
-    break;
+    drawFrameRows(display, rows, y, rowCount);
   }
-}
 
-const float NUMBER_SEPARATION = 4.0f;
-const float NUMBER_SEPARATION_HALF = NUMBER_SEPARATION * 0.5f;
+  void wait() {}
 
-static void DrawNumber(const Vec2f& currentPos, const Vec2f& center, const int& number, const float& size, const float& extraRadius,
-int& count, float& totalDistance, float& prevRadius, Vec2f& prevCenter)
+private:
+  Display& display;
+};
+
+// Writes each band straight into the controller RAM. On the ESP32 a task on
+// the other core drives the SPI bus, so the next band is rasterized while
+// this one goes out; elsewhere the write happens inside send().
+class PanelBandTransfer : public MetaBallBandTransfer
 {
-  if (currentPos.x <= center.x + extraRadius)
+public:
+  explicit PanelBandTransfer(DisplayDriver& epd) : epd(epd)
   {
-    int firstDigit = number / 10;
-    DrawDigit(currentPos, center + Vec2f(-size * 0.5f - NUMBER_SEPARATION_HALF, 0.0f), firstDigit, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
+#ifdef ARDUINO_ARCH_ESP32
+    caller = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(writeBands, "MetaBallSpi", 2048, this, uxTaskPriorityGet(NULL), &writer, 1 - xPortGetCoreID());
+#endif
   }
 
-  if (currentPos.x >= center.x - extraRadius)
+  ~PanelBandTransfer()
   {
-    int secondDigit = number % 10;
-    DrawDigit(currentPos, center + Vec2f(size * 0.5f + NUMBER_SEPARATION_HALF, 0.0f), secondDigit, size, extraRadius, count, totalDistance, prevRadius, prevCenter);
+#ifdef ARDUINO_ARCH_ESP32
+    if (writer)
+    {
+      // No rows tells the writer to stop; it confirms before deleting itself.
+      send(nullptr, 0, 0);
+      wait();
+    }
+#endif
   }
-}
 
-const float EXTRA_RADIUS = 9.0f;
-const float NUMBER_SIZE = 42.0f;
+  void send(const uint8_t* rows, int y, int rowCount)
+  {
+#ifdef ARDUINO_ARCH_ESP32
+    if (writer)
+    {
+      pendingRows = rows;
+      pendingY = y;
+      pendingRowCount = rowCount;
+      busy = true;
+      xTaskNotifyGive(writer);
+      return;
+    }
+#endif
+
+    write(rows, y, rowCount);
+  }
 
-const float COLON_RADIUS = 6.0f;
-const float COLON_OFFSET = 9.0f;
+  void wait()
+  {
+#ifdef ARDUINO_ARCH_ESP32
+    if (busy)
+    {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      busy = false;
+    }
+#endif
+  }
 
-const float HORIZONTAL_CENTER = 99.0f;
+private:
+  void write(const uint8_t* rows, int y, int rowCount)
+  {
+    epd.writeImage(rows, 0, y, MetaBallRenderer::WIDTH, rowCount);
+  }
 
-const float SLASH_RADIUS = 6.0f;
-const float SLASH_WIDTH = 10.0f;
-const float SLASH_WIDTH_HALF = SLASH_WIDTH * 0.5f;
+#ifdef ARDUINO_ARCH_ESP32
+  static void writeBands(void* parameter)
+  {
+    PanelBandTransfer* self = (PanelBandTransfer*)parameter;
 
-const float BATTERY_Y_POS = 99.0f;
-const float BATTERY_RADIUS = 5.0f;
+    for (;;)
+    {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-const float TOP_LINE = BATTERY_Y_POS - BATTERY_RADIUS - NUMBER_SIZE - EXTRA_RADIUS + 3.0f;
-const float BOTTOM_LINE = BATTERY_Y_POS + BATTERY_RADIUS + NUMBER_SIZE + EXTRA_RADIUS - 3.0f;
+      if (!self->pendingRows)
+        break;
 
-const float LEFT_LINE = HORIZONTAL_CENTER - COLON_RADIUS - NUMBER_SIZE - NUMBER_SEPARATION_HALF - 5.0f;
-const float RIGHT_LINE = HORIZONTAL_CENTER + COLON_RADIUS + NUMBER_SIZE + NUMBER_SEPARATION_HALF + 5.0f;
+      self->write(self->pendingRows, self->pendingY, self->pendingRowCount);
+      xTaskNotifyGive(self->caller);
+    }
 
-const Vec2f TOP_LEFT_POINT = Vec2f(LEFT_LINE, TOP_LINE);
-const Vec2f TOP_RIGHT_POINT = Vec2f(RIGHT_LINE, TOP_LINE);
-const Vec2f BOTTOM_LEFT_POINT = Vec2f(LEFT_LINE, BOTTOM_LINE);
-const Vec2f BOTTOM_RIGHT_POINT = Vec2f(RIGHT_LINE, BOTTOM_LINE);
+    xTaskNotifyGive(self->caller);
+    vTaskDelete(NULL);
+  }
 
-const Vec2f COLON_TOP = Vec2f(HORIZONTAL_CENTER, TOP_LINE - COLON_OFFSET);
-const Vec2f COLON_BOTTOM = Vec2f(HORIZONTAL_CENTER, TOP_LINE + COLON_OFFSET);
+  TaskHandle_t caller = NULL;
+  TaskHandle_t writer = NULL;
+  const uint8_t* volatile pendingRows = nullptr;
+  volatile int pendingY = 0;
+  volatile int pendingRowCount = 0;
+  bool busy = false;
+#endif
 
-const Vec2f SLASH_TOP = Vec2f(HORIZONTAL_CENTER + SLASH_WIDTH_HALF, BOTTOM_LINE - NUMBER_SIZE + SLASH_RADIUS);
-const Vec2f SLASH_BOTTOM  = Vec2f(HORIZONTAL_CENTER - SLASH_WIDTH_HALF, BOTTOM_LINE + NUMBER_SIZE - SLASH_RADIUS);
-const Vec2f CENTER = Vec2f(100.0f, 100.0f);
+  DisplayDriver& epd;
+};
 
 void MetaBallWatchy::drawWatchFace()
 {
-  display.fillScreen(GxEPD_WHITE);
-  display.setTextColor(GxEPD_BLACK);
+  renderer.setFace(getFace(currentTime, getBatteryFill()));
 
-  const float battery = getBatteryFill();
+  BufferBandTransfer transfer(display);
+  renderer.renderBands(transfer, bands, METABALL_BAND_ROWS);
+}
 
-  const int hour = currentTime.Hour;
-  
-  const int minute = currentTime.Minute;
+void MetaBallWatchy::showWatchFaceBanded(bool partialRefresh)
+{
+  renderer.setFace(getFace(currentTime, getBatteryFill()));
 
-  const int month = currentTime.Month;
+  {
+    PanelBandTransfer transfer(display.epd2);
+    renderer.renderBands(transfer, bands, METABALL_BAND_ROWS);
+  }
 
-  const int day = currentTime.Day;
+  display.epd2.refresh(partialRefresh);
+}
 
-  const float batteryHalfSize = (100.0f - BATTERY_RADIUS - 1.0f) * battery;
-  const Vec2f batteryPointLeft (HORIZONTAL_CENTER - batteryHalfSize, BATTERY_Y_POS);
-  const Vec2f batteryPointRight (HORIZONTAL_CENTER + batteryHalfSize, BATTERY_Y_POS);
+#else
 
-  for (int y = 0; y < 200; ++y)
-  {
-    for (int x = 0; x < 200; ++x)
-    {
-      Vec2f currentPos ((float)x, (float)y);
-
-      float totalDistance = 0.0f;
-      int count = 0;
-
-      float prevRadius = 0.0f;
-      Vec2f center = currentPos;
-
-      if (y <= TOP_LINE + NUMBER_SIZE + EXTRA_RADIUS)
-      {
-        if (x < LEFT_LINE + NUMBER_SIZE + NUMBER_SEPARATION_HALF + EXTRA_RADIUS)
-        {
-          DrawNumber(currentPos, TOP_LEFT_POINT, hour, NUMBER_SIZE, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-
-        if (x > RIGHT_LINE - NUMBER_SIZE - NUMBER_SEPARATION_HALF - EXTRA_RADIUS)
-        {
-          DrawNumber(currentPos, TOP_RIGHT_POINT, minute, NUMBER_SIZE, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-        
-        if (x >= HORIZONTAL_CENTER - COLON_RADIUS - EXTRA_RADIUS && x <= HORIZONTAL_CENTER + COLON_RADIUS + EXTRA_RADIUS)
-        {
-          MetaBall(currentPos, COLON_TOP, COLON_RADIUS, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-          MetaBall(currentPos, COLON_BOTTOM, COLON_RADIUS, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-      }
-
-      if (y >= BOTTOM_LINE - NUMBER_SIZE - EXTRA_RADIUS)
-      {
-        if (x < LEFT_LINE + NUMBER_SIZE + NUMBER_SEPARATION_HALF + EXTRA_RADIUS)
-        {
-          DrawNumber(currentPos, BOTTOM_LEFT_POINT, month, NUMBER_SIZE, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-
-        if (x > RIGHT_LINE - NUMBER_SIZE - NUMBER_SEPARATION_HALF - EXTRA_RADIUS)
-        {
-          DrawNumber(currentPos, BOTTOM_RIGHT_POINT, day, NUMBER_SIZE, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-
-        if (x > HORIZONTAL_CENTER - SLASH_WIDTH_HALF - SLASH_RADIUS - EXTRA_RADIUS && x < HORIZONTAL_CENTER + SLASH_WIDTH_HALF + SLASH_RADIUS + EXTRA_RADIUS)
-        {
-          Vec2f closestPoint = ClosestPointOnSegment(SLASH_TOP, SLASH_BOTTOM, currentPos);
-          MetaBall(currentPos, closestPoint, SLASH_RADIUS, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-        }
-      }
-
-      if (y >= BATTERY_Y_POS - BATTERY_RADIUS - EXTRA_RADIUS && y <= BATTERY_Y_POS + BATTERY_RADIUS + EXTRA_RADIUS &&
-        x >= batteryPointLeft.x - BATTERY_RADIUS - EXTRA_RADIUS && x <= batteryPointRight.x + BATTERY_RADIUS + EXTRA_RADIUS)
-      {
-        Vec2f closestPoint = ClosestPointOnSegment(batteryPointLeft, batteryPointRight, currentPos);
-        MetaBall(currentPos, closestPoint, BATTERY_RADIUS, EXTRA_RADIUS, count, totalDistance, prevRadius, center);
-      }
-
-      if (count > 0)
-      { 
-        if (totalDistance > EXTRA_RADIUS)
-        {
-          Vec2f normal = (currentPos - center);
-          normal *= 100.0f / prevRadius;
-          normal += CENTER;
-          display.drawPixel(x, y, getColor3(x, y, normal.x, normal.y, MatCapSource, 200,200));
-        }
-        else if (totalDistance >= EXTRA_RADIUS - 1.0f)
-          display.drawPixel(x,y,GxEPD_BLACK);
-      }
-    }
-  }
+static uint8_t frame[MetaBallRenderer::FRAME_SIZE];
+
+void MetaBallWatchy::drawWatchFace()
+{
+  renderer.render(getFace(currentTime, getBatteryFill()), frame);
+  drawFrame(display, frame);
+}
+
+void MetaBallWatchy::showWatchFaceDirect(bool partialRefresh)
+{
+  renderer.render(getFace(currentTime, getBatteryFill()), frame);
+
+  // The frame has the controller's layout, a set bit is white.
+  display.epd2.writeImage(frame, 0, 0, MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT);
+  display.epd2.refresh(partialRefresh);
+
+  // Like GxEPD2's display(): the differential update needs the new image in
+  // the previous-image RAM as well.
+  if (partialRefresh)
+    display.epd2.writeImageAgain(frame, 0, 0, MetaBallRenderer::WIDTH, MetaBallRenderer::HEIGHT);
 }
+
+#endif
@@ -2,8 +2,7 @@
 
 #include <Watchy.h>
 #include "../include/images.h"
-#include "../include/MatCapSource.h"
-#include "../include/BlueNoise200.h"
+#include <MetaBallRenderer.h>
 
 class MetaBallWatchy : public Watchy
 {
@@ -12,4 +11,48 @@ public:
   void drawWatchFace();
 
   float getBatteryFill();
+
+#if METABALL_LAYER_CACHE || METABALL_FRAME_DIFF
+  // Redraws the face, writes only the windows that changed since the last
+  // frame, which the panel must still show, and refreshes the panel once.
+  // Watchy's showWatchFace() always refreshes the whole panel, so this is
+  // for wake paths that drive the display themselves.
+  void showWatchFaceWindows();
+#endif
+
+#if METABALL_BANDED
+  // Renders the face band by band straight into the display controller's
+  // RAM, each band going out over SPI while the next one is rasterized, and
+  // refreshes the panel. The GxEPD2 buffer is left as it was, so this is
+  // for wake paths that drive the display themselves.
+  void showWatchFaceBanded(bool partialRefresh);
+#endif
+
+#if !(METABALL_PRERENDER || METABALL_LAYER_CACHE || METABALL_FRAME_DIFF || METABALL_BANDED)
+  // Renders the face and writes the frame straight into the display
+  // controller's RAM, skipping the GxEPD2 buffer drawWatchFace() fills, and
+  // refreshes the panel. The buffer is left as it was, so this is for wake
+  // paths that drive the display themselves.
+  void showWatchFaceDirect(bool partialRefresh);
+#endif
+
+#if METABALL_PRERENDER
+  // True if the last drawWatchFace() copied a frame rendered on a previous wake.
+  bool usedPrerenderedFrame() const { return prerenderHit; }
+#endif
+
+private:
+  MetaBallRenderer renderer;
+
+#if METABALL_FRAME_DIFF
+  MetaBallRect windows[METABALL_DIFF_WINDOWS];
+  int windowCount = 0;
+#endif
+
+#if METABALL_PRERENDER
+  static void prerenderNextMinute(const void* watchy);
+
+  bool prerenderHit = false;
+  bool prerenderPending = false;
+#endif
 };
@@ -0,0 +1,317 @@
+// Checks that MetaBallRenderer draws the frames of the baseline renderer,
+// that its alternative paths draw the same frame as render() and that the
+// refresh windows cover every pixel that changed. Run with
+// `pio test -e native`, or with another native environment to test the
+// paths its options select.
+
+#include <string.h>
+#include <unity.h>
+
+#include <MetaBallRenderer.h>
+#include <MetaBallConfig.h>
+#include <MetaBallFrameDiff.h>
+#include <MetaBallBandTransfer.h>
+
+const int FRAME_SIZE = MetaBallRenderer::FRAME_SIZE;
+
+// A day of minute ticks from noon, so it crosses midnight and the date.
+const int START_MINUTE = 12 * 60;
+const int TICKS = 24 * 60;
+
+// Tests that do not need consecutive minutes take every FRAME_STRIDE-th.
+const int FRAME_STRIDE = 7;
+
+// Pixels per frame the scanline traversal may differ from TRAVERSAL_PIXELS
+// with forward differencing or digit tiles, as in the bench.
+const int SCANLINE_TOLERANCE = 16;
+
+// FNV-1a hash of the frames of the day as the per-pixel renderer of the
+// baseline drew them.
+const uint32_t BASELINE_FRAMES_HASH = 0xCE15F2AE;
+
+// The same for the integer kernel of METABALL_FIXED_POINT. Its frames do not
+// depend on the platform's float code, so the watch draws these as well.
+const uint32_t FIXED_POINT_FRAMES_HASH = 0x2B35037A;
+
+const int BATTERY_LEVELS = 32;
+const int MAX_WINDOWS = 4;
+
+static MetaBallRenderer renderer;
+static MetaBallRenderer reference;
+static uint8_t frame[FRAME_SIZE];
+static uint8_t expected[FRAME_SIZE];
+static uint8_t previous[FRAME_SIZE];
+static uint8_t buffers[2 * FRAME_SIZE];
+
+// The battery drains by half over the day in the steps a cached frame uses.
+static MetaBallFace getFace(int tick)
+{
+  int minuteOfDay = START_MINUTE + tick;
+
+  MetaBallFace face;
+  face.hour = (minuteOfDay / 60) % 24;
+  face.minute = minuteOfDay % 60;
+  face.month = 3;
+  face.day = 14 + minuteOfDay / (24 * 60);
+  face.battery = (BATTERY_LEVELS - 1 - (BATTERY_LEVELS / 2) * tick / TICKS) / (float)(BATTERY_LEVELS - 1);
+  return face;
+}
+
+static uint32_t hashFrame(uint32_t hash, const uint8_t* frame)
+{
+  for (int i = 0; i < FRAME_SIZE; ++i)
+    hash = (hash ^ frame[i]) * 16777619u;
+
+  return hash;
+}
+
+static bool isPixelDifferent(const uint8_t* a, const uint8_t* b, int x, int y)
+{
+  int index = y * MetaBallRenderer::ROW_BYTES + x / 8;
+  return (a[index] ^ b[index]) & (0x80 >> (x & 7));
+}
+
+static int countPixelDifferences(const uint8_t* a, const uint8_t* b)
+{
+  int count = 0;
+
+  for (int i = 0; i < FRAME_SIZE; ++i)
+    count += __builtin_popcount(a[i] ^ b[i]);
+
+  return count;
+}
+
+// Pixels that differ between two frames but lie outside every window.
+static int countUncoveredPixels(const uint8_t* a, const uint8_t* b, const MetaBallRect* windows, int windowCount)
+{
+  int count = 0;
+
+  for (int y = 0; y < MetaBallRenderer::HEIGHT; ++y)
+  {
+    for (int x = 0; x < MetaBallRenderer::WIDTH; ++x)
+    {
+      if (!isPixelDifferent(a, b, x, y))
+        continue;
+
+      bool covered = false;
+      for (int w = 0; w < windowCount && !covered; ++w)
+        covered = x >= windows[w].x0 && x <= windows[w].x1 && y >= windows[w].y0 && y <= windows[w].y1;
+
+      if (!covered)
+        count++;
+    }
+  }
+
+  return count;
+}
+
+// Copies each band into frame at once, like a panel whose transfers are
+// instant.
+class FrameTransfer : public MetaBallBandTransfer
+{
+public:
+  void send(const uint8_t* rows, int y, int rowCount) override
+  {
+    memcpy(frame + y * MetaBallRenderer::ROW_BYTES, rows, rowCount * MetaBallRenderer::ROW_BYTES);
+  }
+
+  void wait() override {}
+};
+
+void setUp()
+{
+  renderer = MetaBallRenderer();
+  reference = MetaBallRenderer();
+}
+
+void tearDown()
+{
+}
+
+// Hash of the frames renderer draws over the day.
+static uint32_t hashDay()
+{
+  uint32_t hash = 2166136261u;
+
+  for (int tick = 0; tick < TICKS; ++tick)
+  {
+    renderer.render(getFace(tick), frame);
+    hash = hashFrame(hash, frame);
+  }
+
+  return hash;
+}
+
+static void test_render_matches_baseline()
+{
+#if METABALL_FIXED_POINT || METABALL_ASSOCIATIVE_BLEND || METABALL_PACKED_TABLES || METABALL_NOISE_MASK || METABALL_MATCAP_FIT
+  TEST_IGNORE_MESSAGE("this build changes the frames on purpose");
+#else
+#if METABALL_FORWARD_DIFFERENCING || METABALL_DIGIT_TILES
+  // The scanline is held to a tolerance below instead.
+  renderer.setTraversal(TRAVERSAL_PIXELS);
+#endif
+#if METABALL_SDF_ATLAS
+  // The atlas is an approximation; the blend it replaces is checked instead.
+  renderer.setAtlas(MetaBallGetAtlas(0));
+#endif
+
+  TEST_ASSERT_EQUAL_HEX32(BASELINE_FRAMES_HASH, hashDay());
+#endif
+}
+
+static void test_fixed_point_matches_golden()
+{
+#if !METABALL_FIXED_POINT
+  TEST_IGNORE_MESSAGE("needs METABALL_FIXED_POINT");
+#elif METABALL_ASSOCIATIVE_BLEND || METABALL_PACKED_TABLES || METABALL_NOISE_MASK || METABALL_MATCAP_FIT
+  TEST_IGNORE_MESSAGE("this build changes the frames on purpose");
+#else
+#if METABALL_SDF_ATLAS
+  renderer.setAtlas(MetaBallGetAtlas(0));
+#endif
+
+  TEST_ASSERT_EQUAL_HEX32(FIXED_POINT_FRAMES_HASH, hashDay());
+#endif
+}
+
+static void test_traversals_match_pixels()
+{
+  int quadtreePixels = 0;
+  int worstScanlinePixels = 0;
+
+  reference.setTraversal(TRAVERSAL_PIXELS);
+
+  for (int tick = 0; tick < TICKS; tick += FRAME_STRIDE)
+  {
+    reference.render(getFace(tick), expected);
+
+    renderer.setTraversal(TRAVERSAL_QUADTREE);
+    renderer.render(getFace(tick), frame);
+    quadtreePixels += countPixelDifferences(frame, expected);
+
+    renderer.setTraversal(TRAVERSAL_SCANLINE);
+    renderer.render(getFace(tick), frame);
+    int scanlinePixels = countPixelDifferences(frame, expected);
+    if (scanlinePixels > worstScanlinePixels)
+      worstScanlinePixels = scanlinePixels;
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, quadtreePixels);
+#if METABALL_FORWARD_DIFFERENCING || METABALL_DIGIT_TILES
+  TEST_ASSERT_LESS_OR_EQUAL_INT(SCANLINE_TOLERANCE, worstScanlinePixels);
+#else
+  TEST_ASSERT_EQUAL_INT(0, worstScanlinePixels);
+#endif
+}
+
+static void test_render_layers_matches_render()
+{
+  MetaBallLayerCache cache = {};
+  int differentPixels = 0;
+
+  for (int tick = 0; tick < TICKS; ++tick)
+  {
+    renderer.renderLayers(getFace(tick), frame, cache);
+    reference.render(getFace(tick), expected);
+    differentPixels += countPixelDifferences(frame, expected);
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, differentPixels);
+}
+
+static void test_dirty_windows_cover_changes()
+{
+  MetaBallLayerCache cache = {};
+  int uncoveredPixels = 0;
+
+  for (int tick = 0; tick < TICKS; ++tick)
+  {
+    if (tick > 0)
+      memcpy(previous, frame, FRAME_SIZE);
+
+    renderer.renderLayers(getFace(tick), frame, cache);
+
+    // The first frame has nothing cached and is drawn in full.
+    if (tick > 0)
+      uncoveredPixels += countUncoveredPixels(previous, frame, renderer.getDirtyWindows(), renderer.getDirtyWindowCount());
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, uncoveredPixels);
+}
+
+static void test_diff_windows_cover_changes()
+{
+  MetaBallRect windows[MAX_WINDOWS];
+  int uncoveredPixels = 0;
+
+  for (int tick = 0; tick < TICKS; ++tick)
+  {
+    renderer.render(getFace(tick), frame);
+
+    if (tick > 0)
+    {
+      int count = MetaBallDiffFrames(previous, frame, windows, MAX_WINDOWS);
+      TEST_ASSERT_TRUE(count <= MAX_WINDOWS);
+      TEST_ASSERT_EQUAL_INT(count == 0, memcmp(previous, frame, FRAME_SIZE) == 0);
+      TEST_ASSERT_EQUAL_INT(0, MetaBallDiffFrames(previous, frame, windows, 0));
+      uncoveredPixels += countUncoveredPixels(previous, frame, windows, count);
+    }
+
+    memcpy(previous, frame, FRAME_SIZE);
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, uncoveredPixels);
+}
+
+static void test_parallel_matches_serial()
+{
+  int differentPixels = 0;
+
+  for (int tick = 0; tick < TICKS; tick += FRAME_STRIDE)
+  {
+    renderer.setFace(getFace(tick));
+    renderer.renderRows(expected, 0, MetaBallRenderer::HEIGHT);
+    renderer.renderParallel(frame);
+    differentPixels += countPixelDifferences(frame, expected);
+  }
+
+  TEST_ASSERT_EQUAL_INT(0, differentPixels);
+}
+
+static void test_bands_match_render()
+{
+  const int bandHeights[] = { 8, 20, 40, MetaBallRenderer::HEIGHT };
+  FrameTransfer transfer;
+
+  for (int bandRows : bandHeights)
+  {
+    int differentPixels = 0;
+
+    for (int tick = 0; tick < TICKS; tick += FRAME_STRIDE)
+    {
+      reference.render(getFace(tick), expected);
+
+      memset(frame, 0, FRAME_SIZE);
+      renderer.setFace(getFace(tick));
+      renderer.renderBands(transfer, buffers, bandRows);
+      differentPixels += countPixelDifferences(frame, expected);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, differentPixels);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_render_matches_baseline);
+  RUN_TEST(test_fixed_point_matches_golden);
+  RUN_TEST(test_traversals_match_pixels);
+  RUN_TEST(test_render_layers_matches_render);
+  RUN_TEST(test_dirty_windows_cover_changes);
+  RUN_TEST(test_diff_windows_cover_changes);
+  RUN_TEST(test_parallel_matches_serial);
+  RUN_TEST(test_bands_match_render);
+  return UNITY_END();
+}
@@ -0,0 +1,122 @@
+// Checks how MetaBallWatchy drives the stub display: drawWatchFace() copies
+// the frame into the buffer instead of drawing it pixel by pixel, and
+// showWatchFaceWindows() refreshes the panel at most once an update and
+// leaves the controller RAM showing the face. Needs the watch face source,
+// so it runs in the environments that build it without the benchmark, e.g.
+// `pio test -e native_layer_cache`.
+
+#include <string.h>
+#include <unity.h>
+
+#include <MetaBallWatchy.h>
+
+const int FRAME_SIZE = MetaBallRenderer::FRAME_SIZE;
+
+// A day of minute ticks from noon, so it crosses midnight and the date.
+const int START_MINUTE = 12 * 60;
+const int TICKS = 24 * 60;
+
+// Tests that do not need consecutive minutes take every FRAME_STRIDE-th.
+const int FRAME_STRIDE = 7;
+
+static watchySettings settings = {};
+static uint8_t copied[FRAME_SIZE];
+
+static int countPixelDifferences(const uint8_t* a, const uint8_t* b)
+{
+  int count = 0;
+
+  for (int i = 0; i < FRAME_SIZE; ++i)
+    count += __builtin_popcount(a[i] ^ b[i]);
+
+  return count;
+}
+
+// The battery drains from full to empty over the day.
+static void setTime(MetaBallWatchy& watchy, int tick)
+{
+  int minuteOfDay = START_MINUTE + tick;
+
+  watchy.currentTime.Hour = (minuteOfDay / 60) % 24;
+  watchy.currentTime.Minute = minuteOfDay % 60;
+  watchy.currentTime.Month = 3;
+  watchy.currentTime.Day = 14 + minuteOfDay / (24 * 60);
+  Watchy::batteryVoltage = 4.2f - 0.7f * tick / TICKS;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static void test_windows_refresh_once()
+{
+#if !(METABALL_LAYER_CACHE || METABALL_FRAME_DIFF)
+  TEST_IGNORE_MESSAGE("showWatchFaceWindows() needs METABALL_LAYER_CACHE or METABALL_FRAME_DIFF");
+#else
+  MetaBallWatchy watchy(settings);
+  int worstRefreshes = 0;
+  int panelPixels = 0;
+
+  memset(Watchy::display.epd2.ram, 0, sizeof(Watchy::display.epd2.ram));
+
+  for (int tick = 0; tick < TICKS; ++tick)
+  {
+    setTime(watchy, tick);
+
+    uint32_t refreshes = Watchy::display.epd2.refreshes;
+    watchy.showWatchFaceWindows();
+    refreshes = Watchy::display.epd2.refreshes - refreshes;
+
+    if ((int)refreshes > worstRefreshes)
+      worstRefreshes = refreshes;
+
+    // The windows written so far must add up to the face in the buffer.
+    panelPixels += countPixelDifferences(Watchy::display.epd2.ram, Watchy::display.getBuffer());
+  }
+
+  TEST_ASSERT_EQUAL_INT(1, worstRefreshes);
+  TEST_ASSERT_EQUAL_INT(0, panelPixels);
+#endif
+}
+
+// The stub draws a rotated display unrotated, so the drawPixel() path it
+// takes has to give the same buffer as the copy.
+static void test_draw_copies_frame()
+{
+  MetaBallWatchy watchy(settings);
+  int pixelWrites = 0;
+  int differentPixels = 0;
+
+  for (int tick = 0; tick < TICKS; tick += FRAME_STRIDE)
+  {
+    setTime(watchy, tick);
+
+    Watchy::display.setRotation(0);
+    Watchy::display.pixelWrites = 0;
+    watchy.drawWatchFace();
+    pixelWrites += Watchy::display.pixelWrites;
+    memcpy(copied, Watchy::display.getBuffer(), FRAME_SIZE);
+
+    Watchy::display.setRotation(2);
+    Watchy::display.fillScreen(GxEPD_BLACK);
+    watchy.drawWatchFace();
+    differentPixels += countPixelDifferences(copied, Watchy::display.getBuffer());
+  }
+
+  Watchy::display.setRotation(0);
+
+  TEST_ASSERT_EQUAL_INT(0, pixelWrites);
+  TEST_ASSERT_EQUAL_INT(0, differentPixels);
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_windows_refresh_once);
+  RUN_TEST(test_draw_copies_frame);
+  return UNITY_END();
+}